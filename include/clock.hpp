@@ -5,7 +5,8 @@
 
 // アナログ時計の初期化と描画
 void initAnalogClock();
-void drawAnalogClock();
+void drawAnalogClock();     // 文字盤と針を全て描画
+void updateAnalogClock();   // 1秒ごとの差分更新（動いた針だけを描き直す）
 void clearClockArea();
 
 // 時計の設定
@@ -16,4 +17,18 @@ void setClockSize(int radius);
 bool isClockVisible();
 void setClockVisible(bool visible);
 
+// ===== 表示スタイル =====
+enum ClockStyle {
+    CLOCK_STYLE_TICK,   // 1秒ごとに針が進む通常表示
+    CLOCK_STYLE_SWEEP   // 秒針が連続して回る30fps表示（アンチエイリアス）
+};
+
+void setClockStyle(ClockStyle style);
+ClockStyle getClockStyle();
+
+// スイープ表示の更新（毎ループ呼び出し、フレーム間隔は内部で管理）
+void updateSmoothClock();
+float getSmoothClockFps();      // 直近1秒の実測フレームレート
+bool isSmoothClockDegraded();   // フレーム予算超過で1Hz表示に落ちているか
+
 #endif
\ No newline at end of file
@@ -0,0 +1,30 @@
+#ifndef HISTORY_HPP
+#define HISTORY_HPP
+
+#include <Arduino.h>
+#include "temperature.hpp"
+
+// ===== センサー履歴（RAM上のリングバッファ） =====
+// HISTORY_INTERVALごとにキャッシュ済みのセンサー値を1件記録する（バス通信なし）。
+// 各サンプルは起動からの通し番号で参照し、古いものは上書きされる。
+// 記録はメインループ、読み出しはWebサーバーのタスクから行うので、1件単位でロックしてコピーする
+#define HISTORY_INTERVAL 10000   // 記録間隔（ms）
+#define HISTORY_SIZE 360         // 保持件数（10秒間隔で1時間分）
+#define HISTORY_INVALID INT16_MIN  // 無効なプローブの温度値
+
+struct HistorySample {
+    uint32_t uptimeSec;                 // 記録時刻（起動からの秒数）
+    int16_t temperature[PROBE_COUNT];   // 温度×100（℃）、無効ならHISTORY_INVALID
+    int16_t speed;                      // 推定車速×100（km/h）
+};
+
+void updateHistory();         // 毎ループ呼び出し。間隔が経過していれば1件記録する
+void recordHistorySample();   // 即座に1件記録する
+void clearHistory();
+
+// 読み出し可能な範囲 [first, end)（通し番号）
+void getHistoryRange(uint32_t* first, uint32_t* end);
+// 指定番号のサンプルをコピーする（上書き済み・未記録ならfalse）
+bool getHistorySample(uint32_t index, HistorySample* out);
+
+#endif
\ No newline at end of file
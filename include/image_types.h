@@ -12,4 +12,28 @@ typedef struct {
     uint8_t dataSize;
 } tImage;
 
+// パレット+RLE圧縮画像（tools/pack_character.py で生成、形式はスクリプト先頭を参照）
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    const uint16_t *palette;  // バイトスワップ済みRGB565（最大255色）
+    const uint32_t *rows;     // 各行の符号化データの先頭オフセット
+    const uint8_t *data;
+    uint32_t bytes;           // パレット・行テーブル込みの合計サイズ（統計表示用）
+} PackedImage;
+
+// ポーズの差分パッチ（ベース画像上の矩形、座標は元画像基準）
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    const PackedImage *image;
+} PosePatch;
+
+// キャラクターのポーズ（ベース画像 + 差分パッチ、キーフレームはパッチなし）
+typedef struct {
+    const PackedImage *base;
+    const PosePatch *patches;
+    uint8_t patchCount;
+} CharacterPose;
+
 #endif // IMAGE_TYPES_H
\ No newline at end of file
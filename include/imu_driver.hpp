@@ -0,0 +1,56 @@
+#ifndef IMU_DRIVER_HPP
+#define IMU_DRIVER_HPP
+
+#include <Arduino.h>
+
+#define MPU_ADDR 0x68  // MPU6050/6500/9250共通のI2Cアドレス（AD0=GND）
+
+// ===== 対応IMUチップ =====
+enum ImuChip {
+  IMU_NONE = 0,     // 未検出
+  IMU_MPU6050 = 1,  // Adafruit MPU6050ライブラリ経由
+  IMU_MPU6500 = 2,  // レジスタ直接アクセス
+  IMU_MPU9250 = 3   // hideakitai/MPU9250ライブラリ経由
+};
+
+// 読み取り結果（加速度: g、角速度: dps に正規化）
+struct ImuReading {
+  float ax, ay, az;
+  float gx, gy, gz;
+};
+
+// ===== チップ別ドライバ（コンパイル時に特殊化、実装はimu_driver.cpp） =====
+// 新しいチップは特殊化を1つ追加し、detectImuChip()/bindImuDriver()に登録するだけでよい
+template <ImuChip CHIP> struct ImuDriver;
+
+template <> struct ImuDriver<IMU_MPU6050> {
+  static const char* name();
+  static bool begin();
+  static bool read(ImuReading& r);
+};
+
+template <> struct ImuDriver<IMU_MPU6500> {
+  static const char* name();
+  static bool begin();
+  static bool read(ImuReading& r);
+};
+
+template <> struct ImuDriver<IMU_MPU9250> {
+  static const char* name();
+  static bool begin();
+  static bool read(ImuReading& r);
+};
+
+// ===== 検出と束縛（initSpeedSensor()で1回だけ実行） =====
+ImuChip detectImuChip();          // WHO_AM_Iを1回だけ読む
+bool bindImuDriver(ImuChip chip); // 初期化し、以降の読み取り経路を固定する
+bool readImu(ImuReading& r);      // 束縛済みドライバで読み取る（WHO_AM_I確認なし）
+ImuChip getImuChip();
+const char* getImuChipName();
+
+// ===== レジスタ直接アクセス（FIFO設定など全チップ共通の処理用） =====
+uint8_t readWhoAmI(uint8_t address);
+bool imuWriteRegister(uint8_t reg, uint8_t value);
+bool imuReadRegisters(uint8_t reg, uint8_t* buf, size_t len);  // 1回のI2C転送
+
+#endif
\ No newline at end of file
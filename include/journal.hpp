@@ -0,0 +1,27 @@
+#ifndef JOURNAL_HPP
+#define JOURNAL_HPP
+
+#include <Arduino.h>
+
+// ===== 状態ジャーナル（NVS、ウェアレベリング付き） =====
+// 時刻・オドメーター・トリップをCRC付きの固定長レコードとして、JOURNAL_SLOTS個の
+// スロットに順番に追記する（同じキーへの上書きを避け、書き込みを分散させる）。
+// 起動時は全スロットを読み、CRCが正しく通し番号が最大のレコードを採用する。
+#define JOURNAL_SLOTS 8              // スロット数
+#define JOURNAL_INTERVAL 60000       // 定期チェックポイントの間隔（ms）
+
+void initJournal();        // 最新の有効レコードを復元する（時刻の設定はinitTimeSystemで行う）
+void updateJournal();      // 毎ループ呼び出し。間隔が経過して内容が変わっていれば書き込む
+void checkpointJournal();  // 即座に書き込む
+void requestJournalCheckpoint();  // 次のupdateJournal()で書き込む（他タスクから呼ぶ用）
+
+// 復元したレコードの時刻（有効なレコードがなければ0）
+time_t getJournalTime();
+
+// 走行距離
+void addTravelDistance(float meters);
+uint32_t getOdometerMeters();
+uint32_t getTripMeters();
+void resetTrip();  // トリップを0に戻す（他タスクから呼べる。反映と保存は次のupdateJournal()）
+
+#endif
\ No newline at end of file
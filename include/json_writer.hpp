@@ -0,0 +1,40 @@
+#ifndef JSON_WRITER_HPP
+#define JSON_WRITER_HPP
+
+#include <Arduino.h>
+
+// ===== ストリーミングJSONライター =====
+// 呼び出し側が渡したバッファに直接書き込む（String・ヒープ確保・printfなし）。
+// 入れ子の状態（カンマの要否）は出力先と独立して保持するので、jsonSetOutput()で
+// 出力先を差し替えながら1つの文書を複数のバッファに分けて書ける（チャンク送信用）。
+// バッファが足りない場合は書ける所まで書いてoverflowを立てる。
+#define JSON_MAX_DEPTH 31
+
+struct JsonWriter {
+    char* out;
+    size_t capacity;
+    size_t length;
+    uint32_t hasItems;  // bit n: 深さnのコンテナに既に要素がある（次の要素の前にカンマ）
+    uint8_t depth;
+    bool afterKey;      // キーの直後（値の前にカンマを付けない）
+    bool overflow;
+};
+
+void jsonInit(JsonWriter& w);                                  // 入れ子の状態を初期化
+void jsonSetOutput(JsonWriter& w, char* out, size_t capacity); // 出力先を差し替える（length=0）
+
+void jsonBeginObject(JsonWriter& w);
+void jsonEndObject(JsonWriter& w);
+void jsonBeginArray(JsonWriter& w);
+void jsonEndArray(JsonWriter& w);
+void jsonKey(JsonWriter& w, const char* key);
+
+void jsonString(JsonWriter& w, const char* value);
+void jsonInt(JsonWriter& w, int32_t value);
+void jsonUInt(JsonWriter& w, uint32_t value);
+void jsonFixed(JsonWriter& w, int32_t value, uint8_t decimals);  // value / 10^decimals を小数で出力
+void jsonFloat(JsonWriter& w, float value, uint8_t decimals);    // NaN・範囲外はnull
+void jsonBool(JsonWriter& w, bool value);
+void jsonNull(JsonWriter& w);
+
+#endif
\ No newline at end of file
@@ -7,7 +7,8 @@
 enum DisplayMode {
     MODE_CHARACTER = 0,    // キャラクター画像モード
     MODE_ANALOG_CLOCK = 1, // アナログ時計モード
-    MODE_COUNT = 2         // モード数（自動計算用）
+    MODE_SMOOTH_CLOCK = 2, // スムーズスイープ時計モード（30fps）
+    MODE_COUNT = 3         // モード数（自動計算用）
 };
 
 // ===== 3ピンロータリーエンコーダー設定 =====
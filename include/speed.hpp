@@ -1,10 +1,39 @@
 #ifndef SPEED_H
 #define SPEED_H
 
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <stddef.h>  // ネイティブビルド（test/）用
+#include <stdint.h>
+#endif
+
+// ===== IMU FIFO取得設定 =====
+#define IMU_INT_PIN 27          // MPU6500/6050 INTピン（データレディ割り込み）
+#define IMU_SAMPLE_RATE_HZ 1000 // FIFO出力レート（ODR）
+#define IMU_RING_SIZE 1024      // リングバッファ長（2のべき乗）
+
+// FIFOから取得した1サンプル分（生値、±8g: 4096 LSB/g、±500dps: 65.5 LSB/dps）
+struct ImuSample {
+  uint32_t timestampUs;   // 取得時刻（esp_timer基準）
+  int16_t ax, ay, az;     // 加速度
+  int16_t gx, gy, gz;     // 角速度
+};
+
 bool initSpeedSensor();
 float readSpeed();  // 加速度センサーから速度を読み取る関数
-float getSpeed();  // 今回は加速度センサーのX軸を仮の「速度」として返す
+float getSpeed();  // 推定車速（km/h）。FIFO未使用時はX軸加速度（g）
+float getCachedSpeed();  // getSpeed()と同じ値をバス通信なしで返す（他タスク用、ポーリング時はメインループが最後に読んだ値）
+
+// ===== FIFO取得モード =====
+bool startImuFifoAcquisition();  // 1kHz FIFO取得タスクを開始
+bool isImuFifoActive();
+// cursorの位置から最大maxCount件を取り出す（全サンプル、下流フィルタ用）
+size_t readImuSamples(uint32_t* cursor, ImuSample* out, size_t maxCount);
+uint32_t getImuWriteIndex();     // 新規リーダーの開始位置
+float getDecimatedAccelX();      // UI向け間引き済みX軸加速度（g、10Hz）
+uint32_t getImuOverrunCount();   // FIFOあふれ・リーダー追い越しの回数
 
 // void drawSpeed(float speed);  // UIに速度（加速度値）を表示
 
-#endif
+#endif
\ No newline at end of file
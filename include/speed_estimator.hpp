@@ -0,0 +1,25 @@
+#ifndef SPEED_ESTIMATOR_HPP
+#define SPEED_ESTIMATOR_HPP
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <stddef.h>  // ネイティブビルド（test/）用
+#include <stdint.h>
+#endif
+#include "speed.hpp"
+
+// ===== 加速度積分による車速推定（固定小数点、IMUの全サンプルで実行） =====
+// X軸を車両前方とする。ジャイロで重力ベクトルを追従して差し引き、
+// 前後加速度を積分する。停車を検出したら速度を0に戻しドリフトを補正する
+
+void initSpeedEstimator();
+void resetSpeedEstimator();
+void stepSpeedEstimator(const ImuSample& s);  // 1サンプル分の更新
+void processSpeedEstimator();                 // リングバッファの新着分をすべて処理（IMUタスクから呼ぶ）
+
+float getEstimatedSpeedKmh();     // 最新の推定車速（km/h、どのコアからでも読める）
+bool isVehicleStationary();       // 停車判定中か
+uint32_t getSpeedEstimatorCyclesPerSample();  // 1サンプルあたりの平均CPUサイクル
+
+#endif
\ No newline at end of file
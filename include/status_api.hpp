@@ -0,0 +1,21 @@
+#ifndef STATUS_API_HPP
+#define STATUS_API_HPP
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+// ===== 状態API（JSON、チャンク転送） =====
+// GET /api/status   センサー・モード・稼働時間・ヒープ・API応答のヒープ使用量・接続数・走行距離
+// GET /api/history  センサー履歴（history.hpp、古い順）
+// 文書は小さな単位（オブジェクトの断片・履歴1件）ごとに、ライブラリが渡す送信バッファへ
+// json_writerで直接書き込む。単位が残り容量に収まらない時だけ小さな退避バッファを経由する。
+// シリアライズではString・DOM・ヒープ確保を使わない（送信中の状態は固定数のスロットで持つ）。
+// ライブラリ自身の確保（応答オブジェクト・送信バッファ）は応答ごとに計測して /api/status で返す。
+#define STATUS_API_STREAMS 4      // 同時に送信できる応答数（超えたら503）
+#define STATUS_API_UNIT_MAX 192   // 1単位の最大バイト数
+
+void initStatusApi(AsyncWebServer& server);  // /api/status, /api/history を登録
+
+void benchmarkStatusApi();  // シリアライズ速度（シリアル出力）
+
+#endif
\ No newline at end of file
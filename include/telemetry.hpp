@@ -0,0 +1,32 @@
+#ifndef TELEMETRY_HPP
+#define TELEMETRY_HPP
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+// ===== テレメトリー配信（WebSocket /ws、バイナリフレーム） =====
+// クライアントはテキストメッセージ "rate=<Hz>" で配信レートを指定する（1〜50Hz、既定10Hz）。
+// フレームは配信時刻の来たクライアントがいる時だけ1回組み立て、共有バッファ（参照カウント）を
+// 全員のキューに積む。送信キューが詰まったクライアントはそのフレームを飛ばす（遅い端末が
+// サンプラーやメインループを止めない）。
+//
+// フレーム形式（リトルエンディアン、30バイト）:
+//   0  uint8   version（TELEMETRY_VERSION）
+//   1  uint8   有効な温度プローブのビットマスク（bit n = TempProbe n）
+//   2  uint16  通し番号
+//   4  uint32  時刻（millis）
+//   8  int16   温度×100（℃）×4プローブ（車室内・エンジンルーム・外気・バッテリー）
+//  16  int16   推定車速×100（km/h）
+//  18  int16   加速度 X/Y/Z（生値、4096 LSB/g）
+//  24  int16   角速度 X/Y/Z（生値、65.5 LSB/dps）
+#define TELEMETRY_VERSION 1
+#define TELEMETRY_MAX_CLIENTS 4
+#define TELEMETRY_DEFAULT_HZ 10
+#define TELEMETRY_MAX_HZ 50
+
+void initTelemetry(AsyncWebServer& server);  // /ws ハンドラーを登録
+void updateTelemetry();                      // 毎ループ呼び出し（配信時刻のクライアントへ送る）
+int getTelemetryClientCount();
+uint32_t getTelemetryDroppedFrames();        // 送信キューが詰まって飛ばしたフレーム数
+
+#endif
\ No newline at end of file
@@ -1,9 +1,25 @@
 #ifndef TEMPERATURE_H
 #define TEMPERATURE_H
 
+// ===== 温度プローブ定義（GPIO25の1-Wireバス上の役割） =====
+enum TempProbe {
+  PROBE_CABIN = 0,    // 車室内
+  PROBE_ENGINE = 1,   // エンジンルーム
+  PROBE_OUTSIDE = 2,  // 外気
+  PROBE_BATTERY = 3,  // バッテリー
+  PROBE_COUNT = 4     // プローブ数
+};
+
 void initTemperatureSensor();
-float readTemperatureC();
-float getTemperature();
+void updateTemperatureSensor();  // 変換ステートマシンを1ステップ進める（ノンブロッキング）
+float getTemperature();          // 車室内プローブの最新サンプル（未取得ならデフォルト値、O(1)、バス通信なし）
+
+// プローブ別API（すべてO(1)、キャッシュ値を返すのみ）
+float getProbeTemperature(TempProbe probe);
+bool isProbeValid(TempProbe probe);              // 有効なサンプルを保持しているか
+unsigned long getProbeLastUpdate(TempProbe probe); // 最終更新時刻（millis）
+const char* getProbeName(TempProbe probe);
+int getProbeCount();                             // 割り当て済みプローブ数
 
 
-#endif
+#endif
\ No newline at end of file
@@ -1,18 +1,37 @@
 #pragma once
 
 #include <Arduino.h>
+#include <time.h>
 
 // 時刻システム初期化
 void initTimeSystem();
 
 // 時刻の保存・復元
-void saveCurrentTime();
-void restoreTimeFromEEPROM();
+void saveCurrentTime();         // ジャーナルへの記録を要求（どのタスクからも呼べる）
+void restoreTimeFromJournal();  // ジャーナルの最新レコードから復元
 
-// 時刻取得関数（タイムアウト設定済み）
-String getCurrentTimeString();
-String getCurrentTime();
-String getCurrentDate();
+// ===== 時刻キャッシュ =====
+// esp_timerで毎秒1回だけ変換・整形した値を保持する。読み出しはロックなしで、
+// どのタスクからも待たずに呼べる
+struct TimeSnapshot {
+    time_t epoch;
+    struct tm local;      // ローカル時刻
+    bool valid;           // 時刻設定済みか
+    char time[6];         // "HH:MM"（未設定時は "--:--"）
+    char date[11];        // "YYYY/MM/DD"（未設定時は "----/--/--"）
+    char dateTime[20];    // "YYYY-MM-DD HH:MM:SS"
+};
+
+void getTimeSnapshot(TimeSnapshot* out);
+void refreshTimeCache();  // 時刻を設定した直後に呼ぶ（次の秒を待たずに反映）
+
+// 時刻取得関数（キャッシュのコピー、UIループ専用の固定バッファを返す）
+const char* getCurrentTimeString();
+const char* getCurrentTime();
+const char* getCurrentDate();
+
+// 時・分・秒を数値で取得（アナログ時計用、文字列を経由しない）
+bool getCurrentClockTime(int* hour, int* minute, int* second);
 
 // 時刻有効性チェック
 bool isTimeValid();
\ No newline at end of file
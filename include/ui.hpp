@@ -5,6 +5,8 @@
 
 // スプラッシュ画面とメイン画面の表示
 void showSplashScreen();
+void startSplashScreen();   // 専用タスクで開始してすぐに戻る
+void finishSplashScreen();  // フェードアウトの完了まで待つ
 void drawUI();
 void fadeInMainScreen();
 
@@ -22,15 +24,15 @@ void drawCarBuddyTitle();
 void updateCarBuddyTitle();
 
 // キャラクター画像表示
-void drawCharacterImageWithFade(int x, int y);
+void initCharacterBlitter();
 void drawCharacterImage(int x, int y);
 void drawCharacterImageWithEdgeFade(int x, int y);
 
 // 各種データ表示（差分描画対応）
 void drawTemperature(float temp);
 void drawSpeed(float speed);
-void drawTime(String timeStr);
-void drawDate(String dateStr);
+void drawTime(const char* timeStr);
+void drawDate(const char* dateStr);
 void drawCharacter();
 
 // 全体描画管理
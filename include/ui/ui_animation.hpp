@@ -0,0 +1,38 @@
+#ifndef UI_ANIMATION_HPP
+#define UI_ANIMATION_HPP
+
+#include <Arduino.h>
+#include "ui_character.hpp"
+#include "ui_blit.hpp"
+
+// ===== キャラクターアニメーション =====
+// クリップはポーズと表示時間のフレーム列。現在のクリップは温度域の変化に反応する
+// "heat" と "cool" の2つで、通常・高温のキーフレームを切り替える。フレームの切り替えはmillis()基準で
+// 毎ループ判定し、delay()は使わない。1ループで送るバイト数には上限があり、キーフレーム間の
+// 切り替えは数ループに分けて転送する（速度表示などの他の要素の更新を待たせない）。
+// フレームの表示時間は、そのポーズが画面に出きった時点から数える。
+#define ANIMATION_SPI_BUDGET (CHAR_DST_SIZE * 2 * 40)  // 1ループあたりの転送上限（40行分、約14KB）
+
+// フレームへの切り替え方
+enum AnimationTransition {
+    ANIM_CUT,        // 差分パッチ／行分割で即座に切り替える
+    ANIM_CROSSFADE   // 前のポーズから合成しながら切り替える（1ループ1スライス）
+};
+
+struct AnimationFrame {
+    CharacterPoseId pose;
+    uint16_t durationMs;  // 0なら最終ポーズとして保持し、クリップを終了する
+    AnimationTransition transition;
+};
+
+struct AnimationClip {
+    const char* name;
+    const AnimationFrame* frames;
+    uint8_t frameCount;
+};
+
+void initCharacterAnimation();
+void updateCharacterAnimation();  // キャラクターモード中に毎ループ呼び出す
+void playCharacterClip(const AnimationClip* clip);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,15 @@
+#ifndef UI_ASSET_HPP
+#define UI_ASSET_HPP
+
+#include <Arduino.h>
+#include "../image_types.h"
+
+// ===== 圧縮キャラクター画像のデコーダー =====
+// PackedImage（パレット+RLE）の1行を、ラインバッファへ直接展開する。
+// 出力はバイトスワップ済みRGB565なので、そのままDMA転送・フレームバッファ書き込みに使える。
+
+// 1行をデコードする。repeatを渡すと元画像のx列目を repeat[x] 回ずつ書き込む（拡大用）。
+// NULLなら等倍。書き込んだ画素数を返す
+int decodePackedRow(const PackedImage* image, int row, uint16_t* out, const uint8_t* repeat);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,29 @@
+#ifndef UI_BACKLIGHT_HPP
+#define UI_BACKLIGHT_HPP
+
+#include <Arduino.h>
+
+// ===== バックライト輝度制御（LEDC PWM） =====
+// platformio.ini で TFT_BL（バックライト制御ピン）を指定した場合のみ有効。
+// フェードはLEDCのハードウェアフェードで行うので、画面の再描画もCPUの待ちも不要。
+// TFT_BL がない（バックライト常時点灯の）基板では、スプラッシュとフェードインは
+// 従来どおり描き直しで明るさを表現する。
+#define BACKLIGHT_CHANNEL 7       // LEDCチャンネル（高速グループの最後、他の用途と重ならない）
+#define BACKLIGHT_FREQUENCY 5000  // PWM周波数（Hz）
+#define BACKLIGHT_DAY 255         // 昼間の輝度（0〜255）
+#define BACKLIGHT_NIGHT 60        // 夜間の輝度
+#define BACKLIGHT_NIGHT_START 19  // 夜間減光の開始時刻（時）
+#define BACKLIGHT_NIGHT_END 6     // 夜間減光の終了時刻（時）
+
+void initBacklight();                 // 消灯状態で開始する
+bool isBacklightAvailable();
+
+void setBacklight(uint8_t level);                       // 即座に変更
+void fadeBacklight(uint8_t level, uint16_t durationMs);  // ハードウェアフェード（待たない）
+uint8_t getBacklightLevel();                            // フェードの目標輝度
+
+// 時刻に応じた輝度（夜間減光）。時刻未設定の場合は昼間扱い
+uint8_t getScheduledBacklightLevel();
+void updateBacklightSchedule();  // 時間帯が変わったらフェードで切り替える（1秒ごとに呼ぶ）
+
+#endif
\ No newline at end of file
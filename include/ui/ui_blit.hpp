@@ -0,0 +1,70 @@
+#ifndef UI_BLIT_HPP
+#define UI_BLIT_HPP
+
+#include <Arduino.h>
+#include "../image_types.h"
+
+// ===== ラインバッファ転送（ダブルバッファ + DMA） =====
+#define CHAR_SRC_SIZE 160        // 元画像サイズ
+#define CHAR_DST_SIZE 180        // 表示サイズ
+#define BLIT_BUFFER_PIXELS 1800  // ラインバッファ1面あたりの画素数（180x10行）
+
+// 出力1行を生成するコールバック
+// outにはバイトスワップ済み（SPI送出順）のRGB565を width 画素分書き込む
+typedef void (*BlitRowFn)(int row, uint16_t* out, int width, void* ctx);
+
+void initCharacterBlitter();  // DMA初期化とスケーリングテーブル作成
+bool isBlitterDMAEnabled();
+
+// 矩形を行単位で生成して描画する。フレームバッファ有効時はそこへ直接書き込み、
+// 無効時はパネルへ転送する
+void blitRows(int x, int y, int width, int height, BlitRowFn rowFn, void* ctx);
+
+// 常にパネルへ転送する（行を生成しながら、前のバッファをDMAで送出する）
+void blitRowsToPanel(int x, int y, int width, int height, BlitRowFn rowFn, void* ctx);
+
+// 160x160の圧縮キャラクターポーズを展開しながら180x180に拡大して転送する
+void blitCharacterImage(int x, int y, const CharacterPose* pose);
+
+// 160x160の圧縮キャラクターポーズを縁ぼかし付きで転送する（背景はグラデーション行カラー）
+void blitCharacterImageEdgeFade(int x, int y, const CharacterPose* pose);
+
+// 表示中のポーズfromからtoへ切り替える（縁ぼかし付き）。同じベース画像を持つ場合は
+// 両ポーズのパッチ矩形だけを転送する。転送したバイト数を返す
+uint32_t blitCharacterPoseSwitch(int x, int y, const CharacterPose* from, const CharacterPose* to);
+uint32_t getPoseSwitchBytes(const CharacterPose* from, const CharacterPose* to);  // 転送せずに計算のみ
+
+// 縁ぼかし付きポーズの表示行 row から rows 行だけを転送する（分割転送用）
+void blitCharacterRows(int x, int y, const CharacterPose* pose, int row, int rows);
+
+// fromとtoをalpha（toの重み、0〜256）で合成した行を転送する（クロスフェード用、縁ぼかし付き）
+void blitCharacterCrossfadeRows(int x, int y, const CharacterPose* from, const CharacterPose* to,
+                                uint16_t alpha, int row, int rows);
+
+// ポーズの1行（元画像の行番号）を180画素に拡大して展開する（スワップ済み）
+void decodeCharacterPoseRow(const CharacterPose* pose, int srcRow, uint16_t* out);
+
+// 非圧縮配列からの拡大と圧縮データからの展開の速度比較（シリアル出力）
+void benchmarkCharacterDecode(const CharacterPose* pose);
+
+// 拡大用のインデックステーブル（表示座標 → 元画像座標、縦横共通）
+const uint8_t* getCharacterScaleTable();
+const uint8_t* getCharacterColumnRepeat();  // 元画像の各列の拡大後の画素数
+
+// RGB565のバイトスワップ（SPI送出順との相互変換）
+static inline uint16_t swapRGB565(uint16_t c) {
+    return (uint16_t)((c << 8) | (c >> 8));
+}
+
+// 2画素同時アルファブレンド（SWAR）
+// fg/bg は2画素を詰めたRGB565ペア（下位16ビット・上位16ビット）、alphaは0〜256（256で前景そのまま）
+// 各チャンネルを16ビットレーンに分けて乗算するため、2画素分を3回の乗算で処理できる
+static inline uint32_t blendRGB565Pair(uint32_t fg, uint32_t bg, uint32_t alpha) {
+    uint32_t inv = 256 - alpha;
+    uint32_t r = ((fg >> 11) & 0x001F001F) * alpha + ((bg >> 11) & 0x001F001F) * inv;
+    uint32_t g = ((fg >> 5) & 0x003F003F) * alpha + ((bg >> 5) & 0x003F003F) * inv;
+    uint32_t b = (fg & 0x001F001F) * alpha + (bg & 0x001F001F) * inv;
+    return (((r >> 8) & 0x001F001F) << 11) | (((g >> 8) & 0x003F003F) << 5) | ((b >> 8) & 0x001F001F);
+}
+
+#endif
\ No newline at end of file
@@ -2,14 +2,27 @@
 #define UI_CHARACTER_HPP
 
 #include <Arduino.h>
+#include "../image_types.h"
+
+// キャラクターのポーズ（アニメーションのフレームから参照する）
+enum CharacterPoseId {
+    POSE_NORMAL,  // wink_close
+    POSE_HOT      // wink_hot
+};
 
 // キャラクター表示機能
-const uint16_t* getCharacterImageArray(float temp);
-void drawCharacterImageWithFade(int x, int y);
+const CharacterPose* getCharacterPose(float temp);
+const CharacterPose* getCharacterPoseById(CharacterPoseId id);
 void drawCharacterImage(int x, int y);
 void drawCharacterImageWithEdgeFade(int x, int y);
-void drawCharacter();
+void drawCharacter();               // キャラクターウィジェットを再描画対象にする
+void renderCharacter(int x, int y);  // ウィジェット描画パス用（背景パッチなし）
+void setCharacterPose(const CharacterPose* pose);  // 表示するポーズ（NULLで温度連動）
+void crossfadeCharacterPose(const CharacterPose* pose);  // 表示中のポーズから合成しながら切り替え
+bool isCharacterPoseSettled();                     // 設定したポーズが画面に出ているか
+uint32_t updateCharacterPose(uint32_t budget);     // budgetバイト以内で転送（差分パッチ/行分割）
 void clearCharacterArea();
 void debugCharacterState();  // 追加：デバッグ用
+void benchmarkCharacterAssets();  // 圧縮画像の展開速度比較（シリアル出力）
 
 #endif
\ No newline at end of file
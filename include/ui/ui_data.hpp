@@ -6,7 +6,7 @@
 // データ表示機能（差分描画対応）
 void drawTemperature(float temp);
 void drawSpeed(float speed);
-void drawTime(String timeStr);
-void drawDate(String dateStr);
+void drawTime(const char* timeStr);
+void drawDate(const char* dateStr);
 
 #endif
\ No newline at end of file
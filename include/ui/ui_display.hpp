@@ -5,6 +5,8 @@
 
 // UI描画・表示機能
 void showSplashScreen();
+void startSplashScreen();   // 専用タスクで開始してすぐに戻る
+void finishSplashScreen();  // フェードアウトの完了まで待つ
 void fadeInMainScreen();
 void drawCarBuddyTitle();
 void updateCarBuddyTitle();
@@ -0,0 +1,32 @@
+#ifndef UI_FRAMEBUFFER_HPP
+#define UI_FRAMEBUFFER_HPP
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// ===== PSRAMシャドウフレームバッファ（320x240 RGB565） =====
+// 各UIモジュールは uiCanvas() に描画し、描画した領域を markDirty() で通知する。
+// ループの最後に flushFrameBuffer() が差分矩形をまとめてパネルへDMA転送する。
+// PSRAMがない場合は uiCanvas() がパネル本体を返し、従来どおり直接描画になる。
+#define FB_WIDTH 320
+#define FB_HEIGHT 240
+#define FB_MAX_DIRTY_RECTS 12  // 保持する差分矩形の上限（超えたら近いもの同士を統合）
+
+void initFrameBuffer();
+bool isFrameBufferActive();
+TFT_eSPI& uiCanvas();                 // 描画先
+uint16_t* getFrameBufferPixels();     // 直接書き込み用（バイトスワップ済みRGB565、行幅FB_WIDTH）
+
+// 差分管理
+void markDirty(int x, int y, int width, int height);
+void markFullDirty();
+void flushFrameBuffer();              // 差分矩形を転送してクリア
+
+// 文字列を描画し、その範囲を差分として登録する（フォント・色はuiCanvas()の現在設定）
+void uiDrawString(const String& text, int x, int y);
+
+// 転送量の統計
+uint32_t getLastFlushBytes();         // 直近1フレームで送った画素データのバイト数
+uint32_t getLastFlushRectCount();
+
+#endif
\ No newline at end of file
@@ -0,0 +1,23 @@
+#ifndef UI_GLYPHS_HPP
+#define UI_GLYPHS_HPP
+
+#include <Arduino.h>
+
+// ===== 数値表示用グリフアトラス =====
+// 0-9 . - 空白 C の14文字を、size 3相当（18x24）で背景グラデーション行の上に
+// 描画済みの画素として静的領域に保持する。数値欄の更新は変化した文字セルだけを
+// アトラスからコピーし、1つの矩形にまとめて転送する（ヒープ確保・フォント描画なし）。
+// アトラスは欄ごとのスロットに持ち、背景温度・文字色・Y座標が変わった時だけ作り直す。
+#define GLYPH_SCALE 3
+#define GLYPH_WIDTH 18
+#define GLYPH_HEIGHT 24
+#define GLYPH_COUNT 14
+#define GLYPH_ATLAS_SLOTS 2       // 数値欄の数（温度・速度）
+#define GLYPH_FIELD_MAX_CELLS 8
+
+// 数値欄を描画する。shownは画面上の現在の文字列（cells文字+終端、描画後に更新される）。
+// fullがtrueなら全セル、falseなら変化したセルの範囲だけを転送する
+void drawGlyphField(int slot, int x, int y, int cells, uint16_t color,
+                    const char* text, char* shown, bool full);
+
+#endif
\ No newline at end of file
@@ -10,6 +10,11 @@ void drawTemperatureGradientBackground(float temp);
 void drawTemperatureGradientArea(int x, int y, int width, int height, float temp);
 void updateBackgroundTemperature(float temp);
 
+// グラデーション行カラーキャッシュ（240行分のRGB565）
+const uint16_t* getGradientRowTable(float temp);
+uint16_t getGradientRowColor(int y);  // 現在の背景温度での行カラー
+void benchmarkGradientFill();         // 旧実装との描画速度比較（シリアル出力）
+
 // 後方互換性のための関数
 void drawGradientBackground();
 void drawGradientArea(int x, int y, int width, int height);
@@ -0,0 +1,48 @@
+#ifndef UI_WIDGETS_HPP
+#define UI_WIDGETS_HPP
+
+#include <Arduino.h>
+
+// ===== 保持型ウィジェットモデル =====
+// 画面上の要素はそれぞれ固定の矩形とdirtyフラグを持つ。値の設定関数は表示内容が
+// 変わった時だけdirtyを立て、描画はしない。renderWidgets() が列挙順（z順）に一度だけ
+// 走査し、dirtyな要素について背景パッチと内容を描き直す。
+// 背景色が変わった時は invalidateAllWidgets() で全画面グラデーションを1回だけ描く。
+enum WidgetId {
+    WIDGET_CHARACTER,    // キャラクター画像（キャラクターモード）
+    WIDGET_CLOCK,        // アナログ時計（時計モード、キャラクターと同じ領域）
+    WIDGET_TITLE,        // "CarBuddy"
+    WIDGET_TEMP_LABEL,   // "Temp:"
+    WIDGET_SPEED_LABEL,  // "Speed:"
+    WIDGET_SPEED_UNIT,   // "km/h"
+    WIDGET_TEMP_VALUE,
+    WIDGET_SPEED_VALUE,
+    WIDGET_TIME,
+    WIDGET_DATE,
+    WIDGET_COUNT
+};
+
+void initWidgets();
+
+// 内容の設定（表示文字列が変わった時のみdirtyにしてtrueを返す）
+bool setWidgetNumber(WidgetId id, float value);
+bool setWidgetText(WidgetId id, const char* text);
+void setWidgetColor(WidgetId id, uint16_t color);
+void setWidgetVisible(WidgetId id, bool visible);
+bool isWidgetVisible(WidgetId id);
+bool isWidgetDirty(WidgetId id);   // 次の描画パスで全体を描き直す予定か
+
+// 再描画要求
+void invalidateWidget(WidgetId id);
+void invalidateAllWidgets();  // 背景ごと描き直す
+
+// dirtyな要素をz順に1回ずつ描画する
+void renderWidgets();
+
+// 背景パッチなしで文字要素だけを指定色で描く（フェードイン演出用）
+void drawWidgetForeground(WidgetId id, uint16_t color);
+
+// 直近のrenderWidgets()で描画した要素数
+int getLastRenderedWidgetCount();
+
+#endif
\ No newline at end of file
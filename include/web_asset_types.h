@@ -0,0 +1,16 @@
+// web_asset_types.h - フラッシュ埋め込みWebアセットの構造体定義
+#ifndef WEB_ASSET_TYPES_H
+#define WEB_ASSET_TYPES_H
+
+#include <Arduino.h>
+
+// gzip圧縮済みの静的ファイル（tools/build_web_assets.py で web/ から生成）
+typedef struct {
+    const char *path;         // URLパス（index.html は "/"）
+    const char *contentType;
+    const uint8_t *data;      // gzipデータ（PROGMEM、そのまま送出する）
+    uint32_t length;
+    const char *etag;         // 圧縮後データのハッシュ（引用符込み）
+} WebAsset;
+
+#endif // WEB_ASSET_TYPES_H
\ No newline at end of file
@@ -1,11 +1,10 @@
 #ifndef WEBSERVER_H
 #define WEBSERVER_H
 
-#include <WebServer.h>
+#include <Arduino.h>
 
-// Webサーバー管理モジュール
+// Webサーバー管理モジュール（ESPAsyncWebServer、ソケットイベント駆動でポーリング不要）
 void initWebServer();
-void handleWebServerClient();
 void stopWebServer();
 bool isClientConnected();
 int getConnectedClientCount();
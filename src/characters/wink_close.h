@@ -1,351 +1,1712 @@
-
 /*******************************************************************************
-* generated by lcd-image-converter rev.030b30d from 2019-03-17 01:38:34 +0500
-* image
-* filename: unsaved
-* name: wink_close
-*
-* preset name: Color R5G6B5
-* data block size: 16 bit(s), uint16_t
-* RLE compression enabled: no
-* conversion type: Color, not_used not_used
-* split to rows: yes
-* bits per pixel: 16
-*
-* preprocess:
-*  main scan direction: top_to_bottom
-*  line scan direction: forward
-*  inverse: no
+* generated by tools/pack_character.py
+* source: image/wink_close.bmp (160x160)
+* format: keyframe, palette + RLE, byte-swapped R5G6B5
 *******************************************************************************/
-
+#ifndef WINK_CLOSE_H
+#define WINK_CLOSE_H
 
 #include "../../include/image_types.h"
-#include <stdint.h>
 
+static const uint16_t winkCloseImagePalette[255] PROGMEM = {
+    0x19ef, 0xf9ee, 0x2b32, 0x18ff, 0x0a2a, 0xea29, 0x8bdd, 0x0b2a, 0xf7fe, 0xf8fe, 0xc6a3, 0x6add,
+    0x4b32, 0x07ac, 0x943b, 0x6bdd, 0x7333, 0x0b32, 0x2b2a, 0x17ff, 0xb43b, 0xe6a3, 0xe7ab, 0xf8ee,
+    0x4c2a, 0x6ad5, 0x50e5, 0x70e5, 0x4619, 0xe7a3, 0x8821, 0x4ad5, 0x5333, 0x6208, 0x6719, 0x6721,
+    0x6d32, 0xa6a3, 0xabdd, 0x0000, 0x8721, 0x2619, 0xe6ab, 0x4719, 0x6d2a, 0xa69b, 0x4200, 0xc921,
+    0x4fe5, 0x0039, 0x2100, 0x0a32, 0x4c32, 0x4108, 0x0008, 0xe038, 0xabe5, 0x8d32, 0xc030, 0x2519,
+    0x4100, 0xa821, 0xca29, 0x8add, 0x0519, 0x8208, 0xea21, 0x6c3a, 0x27ac, 0xfeff, 0x4b3a, 0x2fe5,
+    0xca21, 0xc929, 0x8028, 0x0511, 0x2c2a, 0xa030, 0x859b, 0x2041, 0x70ed, 0xa028, 0x8020, 0xe030,
+    0x48b4, 0x733b, 0x9433, 0xa59b, 0x4208, 0xe929, 0x6c32, 0x28ac, 0x9333, 0x9cff, 0xdeff, 0x2039,
+    0x7433, 0x933b, 0x6108, 0x8308, 0xa308, 0xd543, 0xe510, 0xddff, 0x743b, 0x6b3a, 0xa921, 0x69b4,
+    0x2a32, 0x4041, 0xa020, 0xc038, 0x8210, 0xbdff, 0x28b4, 0x0010, 0x6210, 0x4018, 0xc410, 0x6200,
+    0x4621, 0x4d2a, 0x0041, 0xbcff, 0xfdff, 0x6020, 0x2a2a, 0x6c2a, 0xa5a3, 0xace5, 0xd443, 0x6049,
+    0x27b4, 0x8030, 0x2010, 0xd8e6, 0xa310, 0xe410, 0xd53b, 0x68b4, 0x416a, 0xdcff, 0xa829, 0x2ad5,
+    0xc059, 0xcce5, 0x49b4, 0x89bc, 0x90ed, 0x0018, 0x9dff, 0x5af7, 0x2000, 0x8c3a, 0xa408, 0x248b,
+    0x08ac, 0x8051, 0xffff, 0x8819, 0x2008, 0x19f7, 0x4c3a, 0x39ef, 0x4add, 0xae32, 0xc829, 0x88bc,
+    0x6819, 0x09cd, 0x8693, 0x4049, 0x59ff, 0xc028, 0xe931, 0x6028, 0xf543, 0xb443, 0x6bd5, 0xc5a3,
+    0xaabc, 0x6619, 0xe9cc, 0x2018, 0x6593, 0x38ff, 0x3af7, 0x4020, 0x426a, 0x0acd, 0x0100, 0x2200,
+    0xc69b, 0x39f7, 0x322b, 0x9bff, 0x47b4, 0x0031, 0xf8e6, 0x06ac, 0xc7a3, 0x8abc, 0x4010, 0x258b,
+    0x869b, 0xd6fe, 0xd7fe, 0xfcff, 0xd94c, 0xd8ee, 0x2eee, 0x6821, 0xc9c4, 0xc408, 0x3554, 0xf353,
+    0x4028, 0x2fdd, 0x458b, 0x6018, 0xe040, 0x914b, 0x6051, 0x0062, 0x103b, 0xf54b, 0xb53b, 0x2c22,
+    0x6621, 0x216a, 0xacdd, 0xa9bc, 0x659b, 0x8300, 0x723b, 0xa051, 0xa37a, 0x33fe, 0xeac4, 0x08a4,
+    0x0162, 0x2020, 0xc040, 0x8272, 0x8038, 0x5aff, 0x39ff, 0x0020, 0x18ef, 0x0b22, 0xad3a, 0x8ff6,
+    0xeded, 0x5654, 0x154c,
+};
 
+static const uint32_t winkCloseImageRows[160] PROGMEM = {
+    0, 109, 220, 347, 480, 596, 717, 859, 1003, 1141, 1275, 1410,
+    1534, 1674, 1812, 1953, 2103, 2249, 2388, 2523, 2657, 2810, 2980, 3143,
+    3297, 3462, 3624, 3785, 3956, 4107, 4267, 4425, 4583, 4747, 4906, 5070,
+    5230, 5386, 5552, 5731, 5899, 6070, 6237, 6409, 6595, 6777, 6969, 7161,
+    7336, 7511, 7689, 7876, 8069, 8253, 8432, 8617, 8796, 8981, 9168, 9365,
+    9549, 9732, 9922, 10117, 10296, 10477, 10659, 10850, 11049, 11230, 11420, 11589,
+    11784, 11966, 12134, 12323, 12511, 12710, 12880, 13047, 13219, 13364, 13538, 13714,
+    13889, 14052, 14227, 14378, 14533, 14701, 14867, 15036, 15189, 15339, 15500, 15660,
+    15824, 15979, 16147, 16300, 16469, 16642, 16810, 16965, 17133, 17301, 17474, 17633,
+    17799, 17963, 18124, 18291, 18451, 18609, 18780, 18956, 19121, 19309, 19474, 19646,
+    19812, 19978, 20132, 20296, 20459, 20629, 20801, 20948, 21124, 21291, 21461, 21629,
+    21792, 21961, 22136, 22295, 22458, 22627, 22787, 22957, 23129, 23302, 23468, 23628,
+    23798, 23974, 24150, 24321, 24482, 24652, 24807, 24965, 25142, 25311, 25481, 25646,
+    25801, 25954, 26106, 26268,
+};
 
-const uint16_t winkCloseCharacterImage[25600] PROGMEM = {
-    // ████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████
-    // ██████████████████████████████████████████████████████████████████████░∙∙∙∙∙∙∙∙∙∙∙░█████████████████████████████████████████████████████████████████████████████
-    // █████████████████████████████████████████████████████████████████∙∙∙∙∙∙░░░░░░░░░░░░∙∙∙∙∙████████████████████████████████████████████████████████████████████████
-    // █████████████████████████████████████████████████████████████∙∙∙░░░░∙░░░░░░░░░░░░░░░░░░░∙∙∙∙████████████████████████████████████████████████████████████████████
-    // ██████████████████████████████████████████████████████████∙∙∙░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░∙∙∙█████████████████████████████████████████████████████████████████
-    // ███████████████████████████████████████████████████████▓∙∙░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙∙∙██████████████████████████████████████████████████████████████
-    // █████████████████████████████████████████████████████▓∙░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙████████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙██████████████████████████████████████████████████████████
-    // ██████████████████████████████████████████████████∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░∙∙████████████████████████████████████████████████████████
-    // █████████████████████████████████████████████████∙░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙██████████████████████████████████████████████████████
-    // ███████████████████████████████████████████████∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙███████∙∙∙∙░░∙∙∙█████████████████████████████████████
-    // ██████████████████████████████████████████████∙░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░∙∙███∙∙▓▓▓▓▓▓▓▓█∙∙███████████████████████████████████
-    // █████████████████████████████████████████████∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙░∙▓▓▓▓▓▓▓▓▓▓▓▓█∙██████████████████████████████████
-    // ████████████████████████████████████████████∙∙∙░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙█████████████████████████████████
-    // ███████████████████████████████████████████∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙████████████████████████████████
-    // ██████████████████████████████████████████∙∙∙░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙▓██████████████████████████████
-    // █████████████████████████████████████████∙∙∙∙░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙██████████████████████████████
-    // █████████████████████████████████████████∙∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙▓▓▓▓▓░▓▓▓▓▓▓▓▓▓∙█████████████████████████████
-    // ████████████████████████████████████████∙∙∙∙░░░░░░░░░░░░░░░░∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙█▓▓▓▓▓▓▓░▓▓▓▓▓▓░▒████████████████████████████
-    // ███████████████████████████████████████∙∙∙∙∙░░░░░░░░░∙∙∙∙∙░▒▒▒▒▒▒▒▒░∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░∙▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙████████████████████████████
-    // ███████████████████████████████████████∙∙∙∙░░░░░░∙∙∙▒▒▒▒░░░░▒░▒░▒▒▒░░░▒░░▒░∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░∙▒▒▓▓▓▓▓▓▓░▓▓▓▓█▒███████████████████████████
-    // ██████████████████████████████████████∙∙∙∙∙░░░∙∙░▒░░░▒░░▒░░░░░░▒░░░░░░░░▒░░░░▒∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙▒▒▒▓▓▓▓▓▓▓░▓▓▓▓∙███████████████████████████
-    // █████████████████████████████████████▓∙∙∙∙░░∙░▒░▒░░▒░▒▒░▒▒▒░░▒░░░▒░░░░░░░░░▒░░░▒▒∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░▒▒▓▓▓▓▓▓▓▒▓▓▓▒▓██████████████████████████
-    // █████████████████████████████████████∙∙∙∙∙∙▒▒░▒░▒▒▒▒▒▒▒░░░░░▒░░░▒░░▒░░░░▒░░░░░░▒▒░▒▒∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙▒▒▒▓▓▓▓▓▓▓▓▒▓▓▓∙██████████████████████████
-    // █████████████████████████████████████∙░∙∙░▒░░▒░░▒░░░░▒░▒▒▒░░░░░░░░░░░░░░▒░░░▒▒░▒▒░░▒░░▒∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓∙██████████████████████████
-    // ████████████████████████████████████∙∙∙░░░░▒░░░░░░░░░░░░░░░▒░▒▒░░▒░░▒░░▒░░░░▒▒░░▒░░▒░░▒▒▒∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░∙▓▒▒▒▓▓▓▓▓▓▓▒▓▓▓∙█████████████████████████
-    // ████████████████████████████████████∙∙░░░░▒░░▒▒▒▒░▒░░░░░░▒▒▒░░░░░░▒░▒▒░▒░▒░▒░▒░░░░░░░░░▒▒░▒∙░░░░░░░░░░░░░░░░░░░░░░░░░░∙▓▓▒▒▓▓▓▓▓▓▓▓▒▓▓∙█████████████████████████
-    // ████████████████████████████████████∙░░░░░░▒░░▒░░░░░▒░░▒▒░░░░░░░▒░░░░▒▒░░░▒░░░░░░░░░░░▒░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░∙▓▓▒░▓▓▓▓▓▓▓▓▓▓▒█████████████████████████
-    // ███████████████████████████████████∙░░░░░░░░░░▒░░▒░░▒▒░░░░▒░▒▒░░░░░▒▒▒▒▒▒░░▒░░▒▒░▒░▒░░░░░▒▒░▒▒∙∙░░░░░░░░░░░░░░░░░░░░░░░∙▓▓▓▒░▓▓▓▓▓▓▓░▓▓∙████████████████████████
-    // ███████████████████████████████████∙░░░░░▒░░░░░░▒▒∙∙∙∙∙∙∙∙∙∙∙∙∙∙▒▒▒░▒▒░░▒░▒▒░░▒░▒▒░░░▒░▒░▒░▒░▒░▒∙░░░░░░░░░░░░░░░░░░░░░░∙▓▓▓▓▒▓▓▓▓▓▓▓▓▓▓∙████████████████████████
-    // ██████████████████████████████████∙░░░░░░░▒░∙∙∙░░░░░░░░░░░░░░░░░░░░∙∙∙░▒░░░░▒░▒░░░░░░▒▒░░░░▒▒▒░░░∙░░░░░░░░░░░░░░░░░░░░░∙▒▓▓▓▓░▓▓▓▓▓▓▓░▓∙████████████████████████
-    // ██████████████████████████████████∙░░░░░∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙░░░░▒░▒░░▒▒░▒░░▒░▒░▒░░░▒░∙░░░░░░░░░░░░░░░░░░░∙░▓▓▓▓▒▓▓▓▓▓▓▓▓▓░████████████████████████
-    // █████████████████████████████████▒░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙░▒▒▒░░░░░▒░░░░▒▒▒░▒▒░░▒∙░░░░░░░░░░░░░░░░░░∙∙▒▓▓▓▓░▓▓▓▓▓▓▓▒▓∙███████████████████████
-    // █████████████████████████████████∙░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙▒░░▒░▒░▒▒░░░▒▒▒▒▒▒░░∙░░░░░░░░░░░░░░░░∙∙∙▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙███████████████████████
-    // █████████████████████████████████∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙░▒▒▒▒▒▒▒░░▒▒▒▒░▒▒░∙░░░░░░░░░░░░░░░∙∙∙▒▓▓▓▓▓▒▓▓▓▓▓▓▓▓∙███████████████████████
-    // ██████████████████████████████∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙▒▒░░░▒▒▒░▒░░░░∙░░░∙░░░░░░░░░░░░░∙∙∙▒▒▓▓▓▓▓▓▓▓▓▓▓▓▒░███████████████████████
-    // ████████████████████████████∙∙░░░∙░░▒░░▒▒░░░▒▒▒░∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙▒░░▒▒░░░░░░░░░░░░∙░░░░░░░░░░░░∙∙∙▓▒▓▓▓▓▓▓▓▓▓▓▓▓▓█▓██████████████████████
-    // ██████████████████████████▒∙░░░░▒░░▒▒░▒░▒░░░▒▒▒░░▒░▒∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙▒▒░▒▒░▒░░▒░░░░░░∙░░░░░░░░∙░∙∙∙∙▒▒▓▓▓▓▓▒▓▓▓▓▓▓▓▓∙██████████████████████
-    // ████████████████████████▒∙▒▒░▒░░▒▒░∙∙∙∙∙∙∙∙∙░▒▒▒░▒░░░░░▒∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙▒░░░░░░∙░░░░░░░∙░░░░░░░░░∙∙∙∙∙▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓∙██████████████████████
-    // ███████████████████████∙░░▒▒▒∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙░▒▒░░▒░░░▒∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙▒▒░░░∙░░░░░░░░∙░░░░░░░░∙∙∙∙∙▒▒▓▓▓▓▓▒▓▓▓▓▓▓▓∙██████████████████████
-    // █████████████████████∙▒▒░▒∙∙∙∙∙∙░▒▒▒▒▒▒▒∙▒▒▒∙█▓▓▓▓▒∙∙▒░▒░▒▒░▒▒∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░∙∙∙∙∙▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓∙██████████████████████
-    // ████████████████████∙░░░∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒∙▓▓▓▓▓▓▓▓∙∙∙░░░░░▒▒▒∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙░∙░░░░░░░░░░░∙░░░░░∙∙∙∙∙∙▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓░██████████████████████
-    // ███████████████████∙░░∙∙∙∙∙∙∙∙∙▓▒▒▒▒▒▒▒▒▒▒▒∙▓▓▓▓▓▓▓▓▓∙▒▒∙∙▒░▒░▒░░▒∙░░░░░░░░░░░░░░░░░░░░░░░░░░∙▒░▒∙░░░░░░░░░░░░░░░░░░∙∙∙∙∙∙▒▒▒▓▓▓▓▓▒▓▓▓▓▓▓▓▒█████████████████████
-    // █████████████████∙∙░∙∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒∙▒▒░▓▓▓▓▓▓▓▓▓▓∙▒▒▒∙░∙▒░▒░░▒░░▒∙░░░░░░░░░░░░░░░░░░░░∙∙▒░▒░░░░∙░░░░░░░░░░░░∙░░∙∙∙∙∙∙∙░▒▒▓▓▓▓▓▓▓▓▓▓▓▓█∙█████████████████████
-    // █████████████████∙░∙∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒∙▓▓▓▓▓▓▓▓▓▓∙▒▒▒▒▒▒░∙▒░▒▒▒▒▒░▒∙∙░░░░░░░░░░░░░░∙░▒░▒▒▒▒░░░░░∙∙░░░░░░░░░░░∙░∙∙∙∙∙∙∙▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓∙█████████████████████
-    // ████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒░▒▒▒█▓▓▓▓▓▓▓▓▓▓∙▒▒▒▒▒▒▒▒▒∙∙░▒▒▒▒░░▒▒▒░∙∙∙∙∙∙∙∙▒▒░░░░░▒░░░░░∙∙▒▒░∙░░░░░░░░░░░∙∙∙∙∙∙∙∙▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓∙█████████████████████
-    // ███████████████∙░∙∙∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒░▒▒∙▓▓▓▓▓▓▓▓▓▓▓∙▒▒▒▒▒▒▒▒▒▒▓∙∙░░▒▒▒▒░▒▒░▒▒░░░░░▒░▒░░░░░░░░∙∙▒▒▒▒▒▒∙░░░░░░░░░░░∙∙∙∙∙∙∙▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓∙█████████████████████
-    // ███████████████░∙∙∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒░▓▓▓▓▓▓▓▓▓▓▓∙▓▒▒░▒▒▒▒▒▒▒▒▒∙∙▒░░▒▒▒░░░▒░░░▒░▒░▒░░▒░░∙∙∙▒▒▒▒▒▒▒▒▒∙░░░░░░░░░∙∙∙∙∙∙∙∙▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓∙█████████████████████
-    // ██████████████▓░∙∙∙∙∙∙∙∙∙∙∙∙▒▒░▒▒▒▒▒▒▒▒▒∙▓▓▓▓▓▓▓▓▓▓▓▓█∙▒▒░▒▒▒▒▒▒▒▒▒▒∙█∙∙∙░▒▒▒▒░░░▒░░░░▒░∙∙∙▒▒▒▒▒░▒▒▒▓▓▓▒▒∙∙░░░░░░░∙∙∙∙∙∙∙░▒░▒▒▓▓▓▓▓▓░▓▓▓▓▓░█████████████████████
-    // ███████████████░∙∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒∙▒▒∙▓▓▓▓▓▓▓▓▓▓▓▓▓∙▒▒░▒▒▒▒▒▒▒▒▒▒▓▓▓▓▓█▒∙∙∙∙∙∙∙∙∙∙∙∙▓█▓▓∙▒▒▒▒▒▒▒▓▓▓▓▓▒▒∙∙░░░░░∙∙∙∙∙∙∙∙▓▒░▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▒████████████████████
-    // ███████████████∙∙∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▓▓▓▓▓██▓▓▓▓▓▓▓∙▒▒░▒▒▒▒▒▒▒▒▒∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓█∙▒▒▒▒∙▓▓▓▓▓▓▓▓▒∙∙░░░░∙∙∙∙∙∙∙∙▒▒▒▒▒▒▓▓▓▓▓▓▒▓▓▓▓█∙████████████████████
-    // ████████████████∙∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒∙▓█∙∙░░░∙∙█▓▓▓▓▓▒▒░▒▒▒▒▒▒▒▒▒∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙▒▒▓▓▓▓▓▓▓▓▓▓▓▓▒∙∙░░∙∙∙∙∙∙∙∙∙▒▒▒▒▓▒▓▓▓▓▓▓░▓▓▓▓▓∙████████████████████
-    // █████████████████▒∙∙∙∙∙∙∙∙▒▒▒∙▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙∙∙░░░∙▓▓▓▓▒▒▒▒▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓█∙▓▓▓▓▓▓▓▓▓▓▓▓▓▒░∙∙∙∙∙∙∙∙∙∙∙∙▒▒▒▒▓▒▓▓▓▓▓▓▓▓▓▓▓▓∙████████████████████
-    // ████████████████████∙∙∙∙∙∙▒▒▒░▒▒▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓░∙░∙███∙▓▓▓▓▓▓▓▒▒▒▒▓▓▓▓▓▓▓▓▓▓█∙∙∙∙∙∙∙∙▓██████∙▓▓▓▓░▓▓▓▓▓▓▓▓▒▒▒∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▓▒▓▓▓▓▓▓▓▒▓▓▓▓∙████████████████████
-    // █████████████████████████∙▒▒▒▒▒▒▒▒▒▒▒▒░█▓▓▓▓▓█████░░∙██∙▓▓▓▓▓▓▓▒▒▒▒▓▓▓▓▓▓▓▓∙∙░░░░∙∙∙∙∙∙∙∙▒████∙▓▓▓∙▓▓▓▓▓▓▓▓▒░▒▒∙∙∙∙∙∙∙∙∙▒▒▒▒▒▓▓▓▓▓▓▓▓▓░▓▓▓▓∙████████████████████
-    // █████████████████████████▒▒▒▒▒▒▒▒▒▒▒░▒∙▓▓▓▓█████████∙░██░▓░▓▓▓▓▓▓▒∙▓▓▓▓▓▓∙∙░░∙∙∙███████████▓∙█∙▓▓▓░▓▓▓▓▓▓▓▓▒∙▒▒▒∙∙∙∙∙∙∙∙▒▒▒▒░▓▓▒▓▓▓▓▓▓▓▓▓▓▓∙████████████████████
-    // █████████████████████████▒▒▒∙▒▒▒▒▒▒▒∙▒∙▓▓▓███████████▒██░▓░▓▓▓▓▓▓▒∙█████∙░░∙░█████████████████▒▓▓▓▒▓▓▓▓▓▓▓▓▒∙▒▒▒∙∙∙∙∙∙∙∙▒▒▒▒░▓▓▒▓▓▓▓▓▓▓▒▓▓▓░████████████████████
-    // ████████████████████████∙▒▒▒∙▒▒▒▒▒▒▒∙▒░▓▓████████████████▓▓▓▓▓▓▓▓▒∙████▓░∙▓████████████████████░▓▓▓▓▓▓▓▓▓▓▓▒∙▒▒▒▒∙∙∙∙∙∙∙░▒▒▒░▓▓▓▓▓▓▓▓▓▓▒▓▓▓▓████████████████████
-    // ████████████████████████∙▒▒▒∙▒▒▒▒▒▒▒░▒█▓█████████████████∙▓░▓▓▓▓▓▒∙████░█████████████████████████▓▓▓▓▓▓▓▓▓▓▒∙▒▒▒▒▒∙∙∙∙∙∙░▒▒▒▒▓▓▓▓▓▓▓▓▓▓▒▓▓▓█████████████████████
-    // ████████████████████████∙▒▒∙∙▒▒▒▓▒▓▓░▒▓▓████████░░███████∙▓▒▓▓▓▓▓▒∙█████████████████████████████∙▓▓▓▓▓▓▓▓▓▓▓░░∙∙∙∙∙∙∙∙∙∙░▒▒▒▒▓▓▓▒▓▓▓▓▓▓▓▒▓▓▓░███████████████████
-    // ████████████████████████∙▒▒∙░▒▒▓▓▒▓▒▒▒▓██████∙█████∙██████∙▒█▓▓▓▓▒∙█████████████████████████████▒▓█▓▓▓▓▓▓▒▒∙∙∙░░░░░∙∙∙∙∙▒▒▒▒▒▓▓▓▒▓▓▓▓▓▓▓░▓▓▓∙███████████████████
-    // ████████████████████████∙▒▒∙█░▒▓▓▓▓▓░▒▓████∙∙∙∙∙∙▓██░█████▒▓∙▓▓▓▓▒∙██████████████████████████████▒▓▓▓▓▓▓▓▓▒∙░░░░░░░░∙∙∙∙▒▓▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▒▓▓∙███████████████████
-    // ████████████████████████∙▒▒∙█∙▒▒▓▓▓▓∙▒▓███∙∙∙∙∙∙∙∙∙████████∙▒▒▓▓▓▓∙██████████████████████████████░▒▓▓▓▓▓▓▓▒∙░░░░░░░░░∙∙∙▒░▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▒▓▓∙███████████████████
-    // ████████████████████████∙▒▒░█∙▒▒▓▓▓▓∙▒▓██∙∙∙████∙∙∙░∙███████▓▒▓▓▓▓∙███████████████████████████████░▓▓▓▓▓▓▒▒░░░░░∙▒▒░∙∙∙▒▒░▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▒▓▓∙███████████████████
-    // ████████████████████████∙▒▓▒█∙▒▒▓▓▓▓∙▒▓█∙∙∙████∙∙∙∙∙∙∙██████∙█░▓▓▓∙██████████████▓░▓██████████████∙▓▓▓▓▓▒▒∙░░░░∙▒▒░∙░∙▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓░▒▓∙███████████████████
-    // ████████████████████████∙▒▓▒█▓▓▒▓▓▓▓░▓██∙∙█████∙∙∙∙██∙∙██████∙█∙▓▒∙██████████░████████████████████∙▓▓▓▓▓▓▓░░░░∙▒▒▒▒░░▒∙▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▒▓▒███████████████████
-    // █████████████████████████▒▓░██∙▒▓▓▓▓▒▓▓█∙∙█████∙∙∙███∙░█████████∙▓▓█████████∙██████∙∙∙░████∙██████∙▓▓▓▓▒▒∙░░░░▒▒▒▒▒▒░▒∙▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓░▒█∙██████████████████
-    // █████████████████████████░▒∙██∙▒▓▓▓▓▒▒∙█∙∙█████∙∙∙∙██∙███████████░▓████████████▒∙∙∙∙∙∙∙∙∙∙∙███████∙▓▓▓▓▓▒░░░░∙▒▒░░∙∙░▒∙▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▒▒▓∙██████████████████
-    // █████████████████████████∙▒∙███∙▓▓▓▓▓▓∙█∙∙█████∙∙∙∙∙∙∙∙██████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙███████∙▓▓▓▓▒∙░░░∙▒▒░∙░░░░░∙░▒▒░▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▒▓∙██████████████████
-    // ██████████████████████████▒∙███∙▒▓▓▓▓░∙██∙█████∙░∙∙∙∙░∙████████████████████░∙∙∙∙░██████∙∙∙∙∙∙∙████∙▓▓▓▓░░░░░∙▒▒∙░░░░∙∙░░▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓░▒∙██████████████████
-    // ██████████████████████████∙∙████∙▓▓▓▓∙▒∙███████∙∙∙∙∙∙░∙███████████████████▒∙∙█████████████████████▓▓▓▓▒░░░░∙▒▒░∙░░░░∙░░░▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒∙██████████████████
-    // ███████████████████████████▓████∙█▓▓▓░▒∙███████∙∙░∙∙∙░∙███████████████████████████████████████████▓▓▓▓∙░░░░∙▒▒∙░░░░░∙∙∙∙▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒▒██████████████████
-    // ███████████████████████████∙∙████∙▓▓▓▓▓∙████████░░∙░∙▓∙██████████████████████████████████████████∙▓▓▓∙░░░░░▒▒▒∙░░░░░∙░∙∙▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓░▒∙█████████████████
-    // ██████████████████████████████████∙▓▓▓∙▒████████∙░▒▓▓▓∙██████████████████████████████████████████░▓▓∙∙░░░░∙▒▒▒░░░░░░▒▒∙∙▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒∙█████████████████
-    // ███████████████████████████████████∙▓▓▓▒░████████░▒▓▓░███████████████████████████████████████████░▓▒∙░░░░░∙▒▒∙░░░░░∙▒▒∙∙▒▒▒░▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓░∙█████████████████
-    // ████████████████████████████████████∙▓▓∙∙█████████∙∙▓████████████████████████████████████████████▓∙█∙░░░░░∙▒▒∙░░░░░∙░▒▓█▒▒▒░▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙█████████████████
-    // ████████████████████████████████████∙∙▓▓∙███████████████████████████████████████████████████████∙∙▓█∙░░░░░▒▒▒∙░░░░░▒▒∙██▒▒▒░▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙████████████████
-    // ████████████████████████████████████∙▒▒░∙███████████████████████████████████████████████████████▒██░∙░░░∙░▒▒░∙░∙∙░∙▒▒∙██▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▒▓▓▓░∙████████████████
-    // ████████████████████████████████████∙▒▒▒░██████████████████████████████████████████████████████∙███∙∙░░∙∙∙▒▒░░∙░░∙∙▒▒███∙▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓░████████████████
-    // ████████████████████████████████████∙▒▒▒▒▓█████████████████████████████████████████████████████████∙░░∙∙∙∙▒▒∙∙∙∙∙∙▒▒∙███∙▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓░∙███████████████
-    // ████████████████████████████████████∙▒▒▒▒∙████████████████∙████████████████████████████████████████▒░∙░∙∙∙▒▒▒∙∙∙∙▒░∙████∙▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▒▓▓▓▓∙███████████████
-    // ████████████████████████████████████∙▒▒▒▒∙█████████████████████████████████████████████████████████▓∙∙∙∙∙∙░▒░∙∙∙░░▒∙████∙▒▒▒▒▒▓▓▓▓▒▓▓▓▓▓▓▓▓▒▓▓▓▓∙███████████████
-    // ████████████████████████████████████∙▒▒▒░∙███████████████▓██████████████████████████████████████████░∙∙∙∙░░▒▒░░▒▒░∙█████∙▒▒▒▒▒▓▓▓▓▒▓▓▓▓▓▓▓▓▓▒▓▓▓▓∙██████████████
-    // ████████████████████████████████████∙▒▒▒▒∙██████████████████████████████████████████████████████████∙∙∙∙∙∙∙▒▒▒▒▒▒∙██████∙▒▒▒▒▒▓▓▓▓▒▓▓▓▓▓▓▓▓▓░▓▓▓▓∙██████████████
-    // ████████████████████████████████████░▒▒▒▒░███████████████▓∙███████████████████████████████████████∙█∙∙∙∙∙∙∙▒▒∙░▒∙███████∙▒▒▒▒▒▓▓▓▓▒▒▓▓▓▓▓▓▓▓▒▒▓▓▓█∙█████████████
-    // ████████████████████████████████████▓▒▒▒▒∙∙███████████████████████████████████████████████████████∙∙∙∙∙░░░░∙▒░∙∙████████∙▒▒▒░▒▓▓▓▓▒░▓▓▓▓▓▓▓▓▒▒▓▓▓▓∙█████████████
-    // ████████████████████████████████████▓▒▒▒▒∙∙██████████████████████████████████████████████████████∙∙░∙∙░░░░░░∙∙∙▒████████∙▒▒▒∙▓▓▓▓▓▒░▓▓▓▓▓▓▓▓▒░▒▓▓▓██████████████
-    // █████████████████████████████████████▒▒▒▒▒∙██████████████████████████████████████████████████████∙░░∙░░░∙░░░∙∙██████████∙▒▒▒∙▓▓▓▓▓▒░▓▓▓▓▓▓▓▓▓▒▒▓▓▓▓∙████████████
-    // ███████████████████████████████████▒▓▓▒▒▒█░▓████████████████████████████████████████████████████▓∙░∙░░░∙∙∙∙∙████████████∙▒▒▒░▓▓▓▓▓▒░▓▓▓▓▓▓▓▓▓▒▒▓▓▓▓░████████████
-    // ███████████████████████████████████∙▓▓▒▒▒██∙████████████████████████████████████████████████████∙░∙░░░░∙████████████████∙▒▒▒░▓▓▓▓▓▒▒▓▓▓▓▓▒▓▓▓▒∙▒▓▓▓▓∙███████████
-    // ███████████████████████████████████∙▓▓▓▒∙██∙████████████████████████████████████████████████████∙∙░░░░∙█████████████████∙▒▒▒▒▓▓▓▓▓▒▒▓▓▓▓▓▓▓▓▓▒▒▒▓▓▓▓∙███████████
-    // ███████████████████████████████████∙▓▓▓▒∙██▓∙██████████████████████████████████████████████████∙∙░░░░∙██████████████████∙▒▒▒▒▓▓▓▓▒▒▒▓▓▓▓▓▓▓▓▓▒▒∙▒▓▓▓▓∙██████████
-    // ███████████████████████████████████∙▓▓▓▓∙███∙███████████████████████████████∙██████████████████∙░░░░∙▒██████████████████∙▒▒▒▒▓▓▓▓▒▒▒▓▓▓▓▓▓▓▓▓▒▒∙▒▓▓▓▓∙██████████
-    // ███████████████████████████████████∙▓▓▓▓∙████░████████████▒∙█████████████▓░███████████████████∙░░░░∙████████████████████∙▒▒▒▒▓▓▓▓▒▒▒▓▓▓▓▓▓▒▓▓▒▒∙∙▓▓▓▓▓██████████
-    // ███████████████████████████████████∙▓▓▓▓∙████∙██████████████▒∙░█████▒∙∙█████████████████████∙∙░░░░∙█████████████████████∙▒▒▒▒▓▓▓▓▒▒▒▓▓▓▓▓▓▒▓▓▓▒∙∙▒▓▓▓▓∙█████████
-    // ███████████████████████████████████∙▓▓▓▓▒█████∙████████████████████████████████████████████∙░░░░░∙██████████████████████∙▒▒▒▒▓▓▓▓▒▒▒▓▓▓▓▓▓▒▓▓▒▒▒▒░▓▓▓▓∙█████████
-    // ███████████████████████████████████∙▓▓▓▓███████∙█████████████████████████████████████████∙∙░░░░∙∙∙██████████████████████∙▒▒░▓▓▓▓▒▒▒▒▓▓▓▓▓▓▒▓▓▓▒▒∙∙▓▓▓▓∙█████████
-    // ███████████████████████████████████∙▓▓▓▓████████∙███████████████████████████████████████∙░░░░░∙▒▒░∙█████████████████████∙▒▒∙▓▓▓▓▒░▒▒▓▓▓▓▓▓▒▓▓▓▒▒∙∙▓▓▓▓▓█████████
-    // █████████████████████████████████████▓▓▓█████████∙████████████████████████████████████∙░░░░░∙∙∙▒▒▒▒∙░████▓██████████████∙▒▒▒▓▓▓▓▒▒▒▒▓▓▓▓▓▓▒▒▓▒▒▒∙█∙▓▓▓▓∙████████
-    // ████████████████████████████████████░▓▓▓██████████∙██████████████████████████████████∙░░░░░∙█∙█░∙∙░▒▓▓░∙████████████████∙▒▒▒▓▓▓▓▒▒▒░▓▓▓▓▓▓▒▒▓▒▒▒∙█∙▓▓▒▓∙████████
-    // ████████████████████████████████████∙▓▓████████████∙▓███████████████████████████████∙░░░░∙▒▓▓▒██████████████████████████∙▒▒▓▓▓▓▒░▒▒░▓▓▓▓▓▒▒▒▓▒▒▒∙██▓▓▓▓∙████████
-    // ████████████████████████████████████∙▓▓█████████████∙∙█████████████████████████████▓∙░░∙∙▓▓▓░███████████████████████████∙▒░▓▓▓▓▒▒▒▒░▓▓▓▓▓▒▒▒▓▒▒▒∙██∙▓▓▓∙████████
-    // ████████████████████████████████████∙▓▓▓█████████████▓∙█████████████████████████████∙∙∙▓▓▓▓▓∙███████████████████████████∙▒∙▓▓▓▓▒▒▒▒░▓▓▓▓▓▒▒▒▓▒▒▒∙██∙▓▓▓▒████████
-    // ██████████████████████████████████████▓▓███████████████∙███████████████████████████∙▒▓▓▓▓▓▓▓∙███████████████████████████▓▒▒▓▓▓▒▒▒▒▒▒▓▓▓▓▓▒▒▒▓▒▒▒∙██∙▓▓▒▓████████
-    // █████████████████████████████████████∙▓▓∙███████████████∙████████████████████████∙∙▓▓▓▓▓▓▓▓▓∙▒██████████████████████████▒▒▓▓▓▓▒░▒▒▒▒▓▓▓▓▓▒▒▒▓▒▒▒∙███∙▓▒▓████████
-    // █████████████████████████████████████∙▓▓∙████████████████∙∙████████████████████∙∙▓▓▓▓▓▓▓▓▓▓▓∙∙░∙∙██████████████████████∙▒░▓▓▓▓▒▒▒▒▒▒▓▓▓▓▒▒▒▒▓▒▒▒∙███∙▓▒█████████
-    // █████████████████████████████████████▓▓▓∙██████████████████∙█████████████████∙∙█▓▓▓▓▓▓▓▓▓▓▓▓∙∙∙∙∙∙█████████████████████∙▒░▓▓▓▒▒▒▒▒▒▒▓▓▓▓▒▒▒▒▒▒▒▒∙███∙▓▒▓████████
-    // ██████████████████████████████████████∙▓████████████████████∙██████████████∙∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙∙∙∙∙█████████████████████∙▒▒▓▓▓▒∙▒▒▒▒▒▓▓▓▓▒▒▒▒▒▒▒▓∙███∙▓▒▓████████
-    // ███████████████████████████████████████░▓∙███████████████████░∙█████████∙∙∙∙█▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙∙∙∙∙████████████████████▓▒∙▓▓▓▒▒▒▒▒▒░▒▓▓▓▒▒▒▒▒▒▒▒▒▓███∙▓▒█████████
-    // ███████████████████████████████████████∙▓∙████████████████████▓∙██████∙∙∙∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙∙∙∙∙∙████████████████████∙▒▒▓▓▒▒∙▒▒▒▒▒▓▓▓▓▒▒▒▒▒▒▒▒∙████∙▓▒█████████
-    // ████████████████████████████████████████∙▓∙███████████████████∙∙∙∙∙∙∙∙∙∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙∙░∙∙∙∙∙∙▓███████████████████∙▒▓▓▒▒░▒▒▒▒▒▒▓▓▓▒▒▒▒▒▒▒▒▒∙████∙▒▒░████████
-    // █████████████████████████████████████████∙∙█████████████████∙∙∙∙∙∙░░∙∙∙█▓▓▓▓▓▓▓▓▓▓▓▓▓█∙∙∙░░░∙∙∙∙░∙███████████████████▓▓∙▓▒▒▒∙▒▒▒▒▒▒▓▓▓▒▒▒▒▒▒▒▒▒∙████∙▒∙∙████████
-    // ██████████████████████████████████████████∙∙████████████████∙∙∙∙∙∙∙∙∙▒▓▓▓▓▓▓▓▓▓▓▓▓▓▒∙∙░░░░░░░∙∙∙∙∙▓██████████████████∙▒▒▒▒▒∙∙▒▒▒▒▒▒▓▓▒▒▒▒▒▒▒▒▒▒∙████∙▒▒∙████████
-    // ███████████████████████████████████████████∙∙███████████████∙∙∙∙∙∙∙░▓▓▓▓▓▓▓▓▓▓▓█∙∙∙░░░░░░░░░∙∙∙∙∙∙▓██████████████████▒░▒▒▒▒∙▒▒▒▒▒∙▒▓▓▒▒▒▒▒▒▒▒▒∙████▒░▒▒∙████████
-    // ████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙░████▓∙∙∙∙∙∙∙∙░░░░░░░░░░∙∙∙∙∙▓█████████████████∙▒▒▒▒▒∙▒▒▒▒▒▒▒▒▓▒▒▒▒▒▒▒▒▒▒∙████∙▒∙∙█████████
-    // ████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░∙∙∙∙∙█████████████████∙▓▒▒▒▒▒∙▒▒▒▒▒▒▒▓▒▒▒▒▒▒░▒▒▒▒▒████∙▒▒∙█████████
-    // ████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░∙∙∙∙▓████████████████∙▒▒▒▒▒∙▓▒▒▒▒▒∙▒▓▒▒▒▒▒▒░▒▒▒∙████∙▒▒▒∙█████████
-    // ████████████████████████████████████████████████████████████░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░∙∙∙∙∙███████████████∙▒▒▒▒▒∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙▒▒▒∙████∙░▒∙██████████
-    // ████████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░∙∙∙∙∙∙∙████████████∙░▒▒▒▒▒∙█∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░▒▒▒░███∙▓▒▓∙██████████
-    // ███████████████████████████████████████████████████████████▓∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░∙∙∙∙∙∙∙████████∙∙∙▒▒▒▒▒∙▓██∙▒▒▒▒▒░▒▒▒▒▒▒▒▒▒▒▒▒∙████∙▒▒∙███████████
-    // ███████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░░∙∙∙∙∙░░∙∙∙█████∙∙░▒░∙∙▓███∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙███∙▒▒░░███████████
-    // █████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░░░∙∙∙∙░░░░░░∙∙██████████████∙▒▒▒▒▒░▒▒▒▒▒▒▒▒▒▒▒▒░███∙▒▒▒∙████████████
-    // ███████████████████████████████████████████████████████∙∙░░∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░░░░∙∙∙░░░░░▒░▒░▒∙∙∙███████████∙▒▒▒▒▒▒▒▒▒▒░▒▒▒▒▒▒▒∙█░∙▒▒▒∙█████████████
-    // ██████████████████████████████████████████████████▒∙∙∙░░░░░∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░░░∙∙░░░░░▒░░░░▒░░░░░∙∙███████∙▒▒▒▒▒∙▒▒▒▒▒░▒▒▒▒▒▒░▒∙▓▒▒▒░∙█████████████
-    // ██████████████████████████████████████████████∙∙∙∙░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░░∙∙░░▒░░░▒░▒▒▒▒░░░▒░▒░▒∙∙∙████∙▒▒▒▒▒▒▒▒▒▒▒░▒▒▒▒▒▒∙▒▒▒▒▒▒∙██████████████
-    // █████████████████████████████████████████▒∙∙∙░░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░░∙∙░░∙▒░░▒▒░░░▒░░░░░░░▒░░░▒░▒∙∙∙▒▒▒▒▒░▒▒▒▒▒▒░▒▒▒▒▒∙▒▒▒▒▒▒∙███████████████
-    // ███████████████████████████████████████∙∙░░░░░░░░░▒░░░░∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░∙∙░░░░░░∙░░▒░░▒▒░▒▒░░░░▒░░▒░░░▒▒▒∙∙∙▒░▒▒▒▒▒▒▒░▒▒▒▒▒▒▒▒▒▒▒∙████████████████
-    // █████████████████████████████████████∙∙░░░░░░▒░░░▒░▒∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░∙░░░░░░░░░░░░░∙░░░░░░░░░░░░∙∙▒░░░▒░░░░░░░░░░░▒░░▒░░▒∙∙▒▒▒▒▒▒▒░▒▒▒▒░▒▒▒▒▒∙█████████████████
-    // ███████████████████████████████████∙∙░░░░░░░░░▒∙∙░░░░░░∙∙∙∙∙∙∙∙∙∙∙░░░░∙░░░░░░░░░∙∙░░░░░░░░░░░░░░░░░░░∙░▒░░░░░░▒░░▒▒░░░░∙░░░░∙▒▒▒▒▒▒▒▒▒▒▒∙▒▒▒▒∙██████████████████
-    // ██████████████████████████████████∙░░░░░░░░░∙░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙░░░░∙░░░░░∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░░∙▒░▒░░░░▒░░░▒▒∙░░░░░░∙▒▒▒▒▒▒▒▒▒▒∙▒▒▒∙███████████████████
-    // █████████████████████████████████∙░░░∙░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙∙░░░░░░░░░∙∙░░░░░░░░░░░░░░░░░░░░░░░░∙▒░░░░▒▒░∙░░░░░░░░░∙▒▒▒▒▒▒▒▒▒∙▒∙∙████████████████████
-    // █████████████████████████████████∙░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙▒░▒░░░▒░░░░░░░░░░∙▒▒▒▒▒▒▒▒∙∙██████████████████████
-    // ████████████████████████████████∙░░░░▒░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙∙∙░∙∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙▒░▒▒░░░░░░░░░░░∙▓▒▒▒▒▒▒▒∙███████████████████████
-    // ███████████████████████████████▒░░░░░▒∙░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░∙▒▒▒∙▒▒▒░███████████████████████
-    // ███████████████████████████████∙░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙░░░░░░░░░░░░░∙▒▒▒▒▒▒▒▒███████████████████████
-    // ██████████████████████████████░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙∙∙░░░░░░░░░░░░░∙▒▒▒▒▒▒▒∙██████████████████████
-    // ██████████████████████████████∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙∙∙∙░░░░░░░░░░░░∙▒▒∙▒▒▒▒∙██████████████████████
-    // ██████████████████████████████∙░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░▓▒▒▒▒▒▒∙██████████████████████
-    // █████████████████████████████▒░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░∙░░░░░░░░░░░░∙▒▒∙▒▒▒▒∙█████████████████████
-    // █████████████████████████████∙░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░▒░░░░░░░░░░░∙▒▒∙░∙▒▒∙░████████████████████
-    // █████████████████████████████∙░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░∙░░∙░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░∙▒▒▒∙▒░▒▒∙████████████████████
-    // █████████████████████████████∙░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░∙░░░░░░░░░░░∙▒▒▒∙∙▒░▒▒∙███████∙███████████
-    // ████████████████████████████∙░░░░∙░░░░░░∙∙░░░░░░░░░░░░░░░░░∙░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░▒▒░█∙▒▒▒▒∙░████∙████████████
-    // ████████████████████████████∙░░░∙░░░░∙░░∙░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░▒▒░░░▒░∙░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░∙▒▒▒▒∙█▒∙▒▒▒▒░∙░∙█████████████
-    // ████████████████████████████∙░░░∙∙░░░∙░∙∙░░░░░░░░░░░░░░░░░∙░░░░░░░∙░░░░░░░░░░░░░░░░▒░▒▒░░▒▒░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░∙▓∙▒▒∙███▓∙∙∙∙∙███████████████
-    // ████████████████████████████∙░░░∙∙░░░∙░∙░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░▒░∙∙▒▒░▒░▒░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░∙∙▒░▒▒∙███████████████████████
-    // ███████████████████████████∙░░░∙∙∙∙░░∙∙∙░░░░░░░░░░░░░░░░░∙░░░░░░░∙░░░░░░░░░░░░░░░░∙░▒░░░░░▒░░∙░░░░░░░░░░░░░∙░░░░░░░░░░░∙░░░░░░░░░░∙░▒▒░▒▓∙██████████████████████
-    // ███████████████████████████∙░░░∙∙∙∙░░∙∙∙░░░░░░░░░░░░░░░░░∙░░░░░░░∙░░░░░░░░░░░░░░░░░▒∙░░░░∙▒░▒░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░∙▓∙░▒∙▒▒∙█████████████████████
-    // ███████████████████████████∙░░∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░∙░░░░░░░∙░░░░░░░░░░░░░░░░░░▒░░░░░▒▒░∙░░░░░░░∙░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░∙▓██∙▒▒▒░∙∙███████████████████
-    // ███████████████████████████∙░░∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░∙░░░░░░░∙░░░░░░░░░░░░░░░░░▒░░▒▒░░▒▒▒░░░░░░░░∙░░░░░∙░░░░░░░░░░░░∙░░░░░░░░░∙∙▓███∙∙░▒▒▒░∙▓████████████████
-    // ███████████████████████████∙░░∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░▒░▒░▒▒▒▒▒░░░░░░░░░░░░░░∙░░░░░░░░░░░░∙░░░░░░░░░∙∙▓████████████████████████████
-    // ███████████████████████████∙░░∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░∙░░░░░░░∙░░░░░░░░░░░░░░░░░∙░▒▒▒░▒░░▒∙░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░∙∙▓████████████████████████████
-    // ██████████████████████████▒░░∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░∙∙∙▒░░░░░░░░░░∙░░░∙░░░░∙░░░░░░░░∙░░░░░░░░░∙∙█████████████████████████████
-    // ██████████████████████████∙░░∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░∙░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░∙░░░∙∙░░░░░░░░∙░░░░░░░░░∙∙█████████████████████████████
-    // ██████████████████████████∙░░∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░∙░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░∙∙∙░░░░░░░░∙░░░░░░░░∙∙∙█████████████████████████████
-    // ██████████████████████████∙░∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░∙∙∙∙∙░░░░░░░░∙░░░░░░░░∙∙∙█████████████████████████████
-    // ██████████████████████████∙░∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░∙░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙∙░∙∙∙░░░░░░░░░∙░░░░░░░░∙∙∙█████████████████████████████
-    // █████████████████████████∙░░∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░∙∙∙∙∙∙░░░░░░░░░∙░░░░░░░░∙∙∙█████████████████████████████
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 
-    0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef8, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef8, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef8, 0xeef8, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef8, 0xeef9, 0xeef9, 0xeef8, 0xeef8, 0xef19, 0xeef8, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef8, 0xeef8, 0xeef9, 0xe6d8, 0xf75a, 0xfffe, 0x41e6, 0x0000, 0x0020, 0x1082, 0x1082, 0x1082, 0x1082, 0x1083, 0x10a3, 0x10a3, 0x0021, 0x0000, 0x4a26, 0xf79d, 0xf77b, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef8, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef8, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef8, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef8, 0xfffe, 0x0000, 0x0861, 0x0862, 0x0021, 0x1905, 0x1926, 0x322b, 0x2a0b, 0x29ea, 0x322b, 0x322b, 0x2a0a, 0x29ea, 0x322b, 0x29ea, 0x322b, 0x29ea, 0x3a6b, 0x1926, 0x0021, 0x0883, 0x0842, 0x0820, 0xffde, 0xeed8, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef8, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xf719, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef8, 0xeef8, 0xeef8, 0xfffe, 0x0000, 0x0862, 0x0042, 0x3a4b, 0x324b, 0x2a0a, 0x322a, 0x10e5, 0x2a0a, 0x2a0b, 0x2a0a, 0x2a0a, 0x2a0a, 0x2a0a, 0x322b, 0x29ea, 0x2a0a, 0x29ea, 0x324b, 0x322b, 0x320b, 0x21ca, 0x322b, 0x322b, 0x2a2b, 0x324b, 0x322b, 0x2188, 0x0041, 0x0883, 0x0000, 0xffde, 0xeef8, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef8, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xffbc, 0x0000, 0x0862, 0x1906, 0x3a4c, 0x322b, 0x322b, 0x21a9, 0x2a0b, 0x2167, 0x29ea, 0x29ea, 0x29ca, 0x29ca, 0x29ea, 0x322b, 0x2a0a, 0x2a0a, 0x322b, 0x324b, 0x322b, 0x322b, 0x322b, 0x322b, 0x320b, 0x322b, 0x29ea, 0x320b, 0x322b, 0x322b, 0x2a0a, 0x2a0a, 0x2a0b, 0x29ea, 0x3a4b, 0x0042, 0x0882, 0x0000, 0xfffd, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xa4d1, 0x1082, 0x2167, 0x322b, 0x29ea, 0x29ca, 0x322b, 0x2a0a, 0x324b, 0x320b, 0x0042, 0x21ea, 0x29ea, 0x324b, 0x29ea, 0x2a0a, 0x2a0b, 0x324b, 0x2a0a, 0x29ea, 0x29ea, 0x29ea, 0x2a0b, 0x322b, 0x324b, 0x2a0a, 0x29ea, 0x320b, 0x29ea, 0x2a2b, 0x2a0b, 0x322b, 0x2a0a, 0x29ea, 0x2a0a, 0x29ea, 0x2a0a, 0x322b, 0x322b, 0x1926, 0x1905, 0x0862, 0x0000, 0xfffe, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef8, 0xc5f5, 0x1082, 0x31e9, 0x29ea, 0x29ea, 0x2a0a, 0x29ea, 0x322b, 0x21ca, 0x2a0a, 0x29ea, 0x10e5, 0x29ea, 0x2a0b, 0x2a0a, 0x2a0a, 0x2a2b, 0x2a0a, 0x29ea, 0x322b, 0x322b, 0x2a0b, 0x322b, 0x29ea, 0x29ea, 0x2a2b, 0x324b, 0x320b, 0x2a0a, 0x2a0a, 0x2a0a, 0x322b, 0x29ea, 0x320b, 0x2a0b, 0x322b, 0x320b, 0x2a0a, 0x322b, 0x2a0a, 0x322b, 0x2a0b, 0x3a4b, 0x31ea, 0x428c, 0x0041, 0x1062, 0xfffe, 0xeef8, 0xeef9, 0xeef8, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 
-    0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef8, 0xffbd, 0x1082, 0x2167, 0x2a0a, 0x2a0a, 0x320b, 0x29ea, 0x2a0a, 0x322b, 0x322b, 0x29ea, 0x324b, 0x320a, 0x3a4c, 0x322b, 0x320b, 0x322b, 0x322b, 0x322b, 0x322b, 0x322b, 0x2a0a, 0x2a0a, 0x2a0b, 0x2a0b, 0x324c, 0x322b, 0x322b, 0x322b, 0x2a0a, 0x29ea, 0x2a0a, 0x29ea, 0x2a2b, 0x324b, 0x2a2b, 0x322b, 0x320b, 0x29ca, 0x29ea, 0x322b, 0x29ea, 0x29ea, 0x322b, 0x320b, 0x322b, 0x322a, 0x320a, 0x322b, 0x0021, 0x0862, 0xffbd, 0xeef9, 0xeef8, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef8, 0x0821, 0x1905, 0x322b, 0x2a0a, 0x2a0a, 0x320b, 0x29ea, 0x2a0a, 0x322b, 0x29ea, 0x320b, 0x2a0a, 0x3a8c, 0x322b, 0x2a0a, 0x2a0a, 0x2a0b, 0x2a0b, 0x322b, 0x2a0b, 0x29ea, 0x324b, 0x322b, 0x322b, 0x2a0b, 0x29ea, 0x322b, 0x322b, 0x2a0b, 0x2a0b, 0x322b, 0x29ea, 0x2a0a, 0x29ea, 0x324b, 0x2a0b, 0x2a0b, 0x324c, 0x2a0a, 0x29ea, 0x29ea, 0x29ea, 0x2a0a, 0x2a0a, 0x2a0a, 0x322b, 0x322a, 0x320b, 0x2167, 0x2a2b, 0x322b, 0x29e9, 0x08a4, 0x0862, 0xffde, 0xef19, 0xeef8, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef8, 0xeef8, 0xef1a, 0x0861, 0x322b, 0x322b, 0x2a0a, 0x2a0a, 0x2a0a, 0x2a0a, 0x324b, 0x320b, 0x2a0b, 0x2a0b, 0x21ea, 0x2a0a, 0x08a3, 0x29ea, 0x29ca, 0x2a0b, 0x2a0a, 0x2a0a, 0x2a2b, 0x2a0a, 0x2a0a, 0x320b, 0x29ea, 0x322b, 0x322b, 0x29ea, 0x322b, 0x320b, 0x2a0a, 0x2a0b, 0x2a0a, 0x324b, 0x322b, 0x29ea, 0x322b, 0x322b, 0x324b, 0x2a0a, 0x2a0a, 0x2a0a, 0x2a0a, 0x29ea, 0x322b, 0x322b, 0x322b, 0x2a0b, 0x29ea, 0x322b, 0x3a6c, 0x3a4b, 0x21ca, 0x322b, 0x322b, 0x29ea, 0x0021, 0x0020, 0xeef8, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeed8, 0xf75a, 0xffbc, 0xf75a, 0xeef9, 0xf719, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 
-    0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef8, 0xe6d8, 0x0841, 0x29c9, 0x2a0a, 0x2a0a, 0x322b, 0x2a0a, 0x2a0a, 0x2a0b, 0x29ea, 0x29ea, 0x2a0b, 0x2a0b, 0x2a2b, 0x29ea, 0x29c9, 0x2a0a, 0x29ea, 0x322b, 0x320b, 0x29ea, 0x322b, 0x2a0b, 0x322b, 0x2a0a, 0x2a0a, 0x322b, 0x2a0b, 0x29ea, 0x21c9, 0x322b, 0x322b, 0x322b, 0x2a0a, 0x322b, 0x29ea, 0x2a0a, 0x324b, 0x29ea, 0x29ea, 0x29ea, 0x320b, 0x29ea, 0x320b, 0x29ea, 0x2a0a, 0x322b, 0x29ea, 0x322b, 0x322b, 0x2a0a, 0x21ea, 0x322b, 0x320a, 0x29ea, 0x2a0a, 0x322b, 0x2a0b, 0x2a0b, 0x3a6b, 0x0862, 0xffdd, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef8, 0xffdd, 0x1840, 0x3920, 0x2880, 0x5160, 0x8304, 0x6a42, 0x2060, 0x3920, 0x1840, 0xfffd, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef8, 0x0841, 0x322a, 0x322b, 0x320b, 0x320b, 0x320a, 0x29ea, 0x2a0b, 0x322b, 0x320b, 0x2a0b, 0x2a0a, 0x2a0a, 0x29ea, 0x322b, 0x1926, 0x2a0b, 0x322b, 0x21ca, 0x2a0a, 0x322b, 0x322b, 0x320b, 0x29ea, 0x2a0b, 0x29ca, 0x2a0a, 0x322b, 0x322b, 0x2a0b, 0x324b, 0x2a0a, 0x29ea, 0x29ea, 0x2a0b, 0x29ea, 0x324b, 0x2a0a, 0x2a2b, 0x320b, 0x320b, 0x29ca, 0x29ea, 0x2a2b, 0x2a0b, 0x29ea, 0x2a0b, 0x2a0a, 0x2a0b, 0x322b, 0x2a0a, 0x2a2b, 0x2a0b, 0x2a0a, 0x0062, 0x322b, 0x21c9, 0x2a0a, 0x322b, 0x29ea, 0x2a0b, 0x0041, 0x0840, 0xef19, 0xeef9, 0xff5b, 0x3920, 0x2060, 0xee2e, 0xdd8b, 0xdd6b, 0xe5ab, 0xdd6a, 0xdd6a, 0xdd8b, 0xdd8a, 0xf68f, 0x2880, 0x2060, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef8, 0x0861, 0x2188, 0x29ea, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0a, 0x2a0a, 0x2a0a, 0x2a0a, 0x322b, 0x2a2b, 0x29ea, 0x2a0a, 0x2a0b, 0x29e9, 0x29ea, 0x322b, 0x322b, 0x322b, 0x322b, 0x2a0a, 0x29ea, 0x2a0b, 0x2a0a, 0x2a0b, 0x322b, 0x322b, 0x2a0a, 0x2a0a, 0x29ea, 0x29ea, 0x29ca, 0x2a0a, 0x320b, 0x29ea, 0x322b, 0x322b, 0x29ea, 0x2a0a, 0x29ea, 0x29ea, 0x322b, 0x2a0a, 0x322b, 0x2a2b, 0x322b, 0x2a0a, 0x29ea, 0x29ea, 0x2a0b, 0x2a0a, 0x320b, 0x29ea, 0x21c9, 0x324b, 0x324b, 0x2a0b, 0x2a0b, 0x2a0b, 0x320a, 0x29ea, 0x324b, 0x1905, 0x0000, 0x6265, 0x30e0, 0xe5ac, 0xdd6b, 0xdd8b, 0xdd8b, 0xdd6a, 0xd56a, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd6b, 0xdd6a, 0xdd8b, 0xf670, 0x3900, 0xffdd, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0x0862, 0x1967, 0x2168, 0x320a, 0x2a0a, 0x322b, 0x322b, 0x322b, 0x2a0b, 0x2a0a, 0x2a0a, 0x2a0a, 0x2a0b, 0x322b, 0x322b, 0x2a0a, 0x2187, 0x2a0a, 0x2a0b, 0x2a0b, 0x322b, 0x324b, 0x2a0b, 0x322b, 0x2a0a, 0x2a0a, 0x2a0a, 0x322b, 0x322b, 0x29ea, 0x2a2b, 0x2a0a, 0x29ea, 0x29ea, 0x322b, 0x2a0a, 0x2a0b, 0x29ea, 0x29ea, 0x322b, 0x29ea, 0x2a0a, 0x2a0a, 0x29ea, 0x2a0b, 0x322b, 0x2a0b, 0x322b, 0x322b, 0x322b, 0x29ea, 0x29ea, 0x2a2b, 0x2a0a, 0x2a0b, 0x2a0a, 0x2a0b, 0x08a3, 0x29ea, 0x322b, 0x2a0b, 0x322b, 0x2a0a, 0x324b, 0x324b, 0x3a4b, 0x10a2, 0xd54a, 0xd56a, 0xdd8b, 0xdd8b, 0xdd6b, 0xdd8b, 0xdd6a, 0xdd6a, 0xd56a, 0xdd8b, 0xd54a, 0xdd6b, 0xdd8b, 0xdd6b, 0xe5ab, 0x30a0, 0xeed8, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 
-    0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef39, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0x0862, 0x21a8, 0x2188, 0x2a0a, 0x2a0b, 0x2a0a, 0x322b, 0x2a0a, 0x320b, 0x29ea, 0x322b, 0x2a0a, 0x320a, 0x320b, 0x2a0b, 0x2a0b, 0x324b, 0x2a0a, 0x2a2a, 0x3a4c, 0x2a0b, 0x322b, 0x322b, 0x29ea, 0x2a0a, 0x2a2b, 0x29ea, 0x29ea, 0x2a0b, 0x322b, 0x2a0b, 0x324b, 0x2a0b, 0x324c, 0x29ea, 0x2a0a, 0x2a2b, 0x322b, 0x29ea, 0x2a0b, 0x2a2b, 0x2a0a, 0x2a0a, 0x322b, 0x29ea, 0x322b, 0x2a0a, 0x2a0a, 0x320b, 0x326c, 0x2a2b, 0x320b, 0x2a0a, 0x2a0b, 0x2a0a, 0x322b, 0x2a0b, 0x324b, 0x2a0b, 0x29ea, 0x2a0b, 0x2a0a, 0x2a0b, 0x2a0a, 0x2a0b, 0x2a0a, 0x322b, 0x322b, 0x0862, 0xdd6a, 0xdd8b, 0xdd8b, 0xdd6b, 0xddab, 0xd56a, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd6a, 0xdd6b, 0xdd8a, 0xd56a, 0xd56a, 0xdd6b, 0x30e0, 0xeef8, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef8, 0x1082, 0x2187, 0x2167, 0x21a9, 0x320b, 0x2a2b, 0x29ea, 0x2a0b, 0x324b, 0x2a0b, 0x29ea, 0x2a0b, 0x322b, 0x29ea, 0x2a0b, 0x2a0a, 0x2a0a, 0x10c4, 0x2a0a, 0x2a0a, 0x2a0a, 0x2a0b, 0x29ea, 0x2a0a, 0x322b, 0x324b, 0x2a0a, 0x322b, 0x324b, 0x322b, 0x29ea, 0x29ea, 0x2a0a, 0x2a2b, 0x322b, 0x322b, 0x320b, 0x2a0b, 0x2a0a, 0x29ea, 0x324b, 0x2a2b, 0x322b, 0x29ea, 0x2a0b, 0x29ea, 0x29ea, 0x322b, 0x322b, 0x2a0b, 0x2a0a, 0x322b, 0x322b, 0x29ea, 0x29ea, 0x2a0b, 0x322b, 0x2a0a, 0x2a0b, 0x320b, 0x08a3, 0x322b, 0x29ea, 0x322b, 0x322b, 0x324b, 0x2a0a, 0x322b, 0x2a0a, 0x2a0a, 0x10a2, 0xd549, 0xdd8b, 0xdd8b, 0xdd6b, 0xdd8b, 0xdd6b, 0xdd8b, 0xdd8b, 0xdd6a, 0xdd6a, 0xd56a, 0xe5ac, 0xd56a, 0xdd6a, 0xddab, 0x2860, 0xd615, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0x0000, 0x2188, 0x2188, 0x1967, 0x324b, 0x2a0b, 0x29ea, 0x320b, 0x322b, 0x322b, 0x322b, 0x2a0b, 0x2a0a, 0x324b, 0x322b, 0x29ea, 0x324b, 0x322b, 0x08a3, 0x322b, 0x2a0a, 0x2a2b, 0x324b, 0x2a0a, 0x2a0b, 0x320a, 0x29ea, 0x2a0a, 0x2a2b, 0x322b, 0x2a0b, 0x29ea, 0x2a0a, 0x322b, 0x2a0b, 0x320b, 0x2a2b, 0x2a0a, 0x2a0b, 0x322b, 0x29ea, 0x322b, 0x2a0a, 0x322b, 0x2a2b, 0x2a2b, 0x29ea, 0x2a0a, 0x322b, 0x29ea, 0x2a0a, 0x29ea, 0x2a0b, 0x2a0a, 0x322b, 0x29ea, 0x322b, 0x29ea, 0x322b, 0x322b, 0x29ea, 0x1905, 0x322b, 0x2a0b, 0x2a2b, 0x29ea, 0x29ea, 0x322b, 0x324b, 0x29ea, 0x322b, 0x3a6b, 0x0820, 0xdd8b, 0xdd6a, 0xdd6b, 0xdd6a, 0xdd8b, 0xdd8b, 0xdd6a, 0xdd8b, 0xdd8b, 0xdd8b, 0xd54a, 0xdd8b, 0xdd8b, 0xddab, 0xd54a, 0x3900, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xf7be, 0x0041, 0x2188, 0x2168, 0x2188, 0x2a0b, 0x322b, 0x2a0a, 0x29ea, 0x322b, 0x2a0a, 0x322b, 0x322b, 0x320b, 0x322b, 0x320b, 0x322b, 0x322b, 0x322b, 0x3a6c, 0x2a0a, 0x322b, 0x2a2b, 0x2a0a, 0x322b, 0x2a0a, 0x2a0a, 0x322b, 0x322b, 0x2a0a, 0x322b, 0x322b, 0x322b, 0x29ea, 0x21c9, 0x2a0a, 0x322b, 0x322b, 0x322b, 0x324b, 0x322b, 0x322b, 0x2a0a, 0x320b, 0x2a0b, 0x322b, 0x2a2b, 0x322b, 0x29ea, 0x2a0a, 0x29ea, 0x29ea, 0x2a0b, 0x2a0b, 0x324b, 0x2a0a, 0x29ea, 0x2a0b, 0x322b, 0x322b, 0x322b, 0x320b, 0x3a4b, 0x322b, 0x322b, 0x2a0b, 0x2a0a, 0x324b, 0x2a0a, 0x322b, 0x320b, 0x2a0b, 0x324b, 0x29a8, 0x0800, 0xcd0a, 0xee2d, 0xdd8b, 0xdd8b, 0xeded, 0x6a40, 0xc4c9, 0xdd6a, 0xddab, 0xdd6a, 0xdd6b, 0xdd6a, 0xdd6a, 0xdd8b, 0xdd8b, 0x2060, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0x0041, 0x2167, 0x2188, 0x1947, 0x320b, 0x322b, 0x320b, 0x322b, 0x29ea, 0x322b, 0x322b, 0x2a0b, 0x29ea, 0x29ea, 0x322b, 0x322b, 0x322b, 0x322b, 0x3a4b, 0x3a2a, 0x2187, 0x1925, 0x1105, 0x08a4, 0x1946, 0x21a8, 0x3a4a, 0x3a6c, 0x2a0b, 0x322b, 0x322b, 0x2a0a, 0x2a0a, 0x2a0a, 0x322b, 0x29ea, 0x29ea, 0x322b, 0x29ea, 0x2a0b, 0x324c, 0x322b, 0x2a0a, 0x2a0a, 0x2a0a, 0x322b, 0x322b, 0x2a0a, 0x2a0a, 0x2a0a, 0x29ea, 0x2a0b, 0x2a0a, 0x29ea, 0x2a0a, 0x2a0b, 0x322b, 0x2a2b, 0x324b, 0x2a0a, 0x320b, 0x29ea, 0x29ea, 0x320a, 0x29ea, 0x322b, 0x29ea, 0x322b, 0x322b, 0x29ea, 0x2a0a, 0x324c, 0x2a0a, 0x29ea, 0x08c4, 0xf670, 0xdd6a, 0xdd8b, 0xe5ac, 0xdd8b, 0xdd8b, 0xdd6b, 0xeded, 0x59a0, 0xdd6b, 0xdd6a, 0xdd6a, 0xdd6b, 0xdd8b, 0xdd6a, 0x7ae3, 0x7b69, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef8, 0xef19, 0x0020, 0x2188, 0x2188, 0x2187, 0x1947, 0x2a0a, 0x29ea, 0x322b, 0x324b, 0x2a0a, 0x324b, 0x2a0b, 0x29ea, 0x3a8c, 0x1105, 0x0021, 0x08a2, 0x0001, 0x00a5, 0x2a4c, 0x4392, 0x5456, 0x4c15, 0x3b94, 0x43d5, 0x43d5, 0x4c36, 0x53f4, 0x3b0f, 0x08c5, 0x0022, 0x08a2, 0x0021, 0x1946, 0x3a4b, 0x322b, 0x2a0b, 0x324b, 0x29ea, 0x324b, 0x2a0a, 0x29ea, 0x322b, 0x2a0a, 0x2a0a, 0x29ea, 0x324b, 0x324b, 0x29ea, 0x324b, 0x2a0a, 0x2a0b, 0x322b, 0x322b, 0x322b, 0x322b, 0x322b, 0x2a0a, 0x320b, 0x2a2b, 0x322b, 0x2a0b, 0x2a0a, 0x2a0b, 0x0062, 0x2a0a, 0x322b, 0x322b, 0x320b, 0x29ea, 0x320b, 0x322b, 0x2a0a, 0x2a0a, 0x29ea, 0x2a0a, 0x1062, 0xac27, 0xd52a, 0xdd8b, 0xd54a, 0xdd6b, 0xd56a, 0xdd6a, 0xdd6a, 0xee2e, 0xeded, 0xdd6b, 0xdd6a, 0xdd8b, 0xdd6b, 0xdd8b, 0x4160, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef8, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xffdd, 0x0882, 0x1947, 0x1947, 0x2188, 0x29ea, 0x320a, 0x2a0b, 0x2a0a, 0x322b, 0x3a6b, 0x0042, 0x0862, 0x1127, 0x4393, 0x3bb4, 0x3bb4, 0x3b94, 0x3b94, 0x3b94, 0x3374, 0x3374, 0x3b94, 0x3373, 0x3bb4, 0x3b73, 0x3b94, 0x3bb4, 0x3b94, 0x3353, 0x3373, 0x3353, 0x3bb4, 0x3b73, 0x2b52, 0x4c14, 0x21ea, 0x0042, 0x0841, 0x320a, 0x2a0b, 0x322b, 0x322b, 0x2a0a, 0x2a0a, 0x326c, 0x322b, 0x2a0a, 0x2a2b, 0x2a0a, 0x2a2b, 0x322b, 0x322b, 0x2a0b, 0x2a0a, 0x2a0a, 0x29ea, 0x2a0a, 0x2a2b, 0x29ea, 0x2a0a, 0x322b, 0x29ea, 0x2a0b, 0x2a0b, 0x08a3, 0x29ea, 0x29ea, 0x2a0a, 0x320b, 0x322b, 0x322b, 0x324b, 0x322b, 0x2a0b, 0x322b, 0x320b, 0x322a, 0x1840, 0xac28, 0xa3c6, 0xdd6a, 0xdd8b, 0xdd6b, 0xdd8b, 0xdd8b, 0xdd8b, 0xd54a, 0x59c0, 0xdd8b, 0xdd6a, 0xdd8b, 0xdd8b, 0xfeb0, 0x7b49, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0x0862, 0x2188, 0x1967, 0x1947, 0x1967, 0x2a0b, 0x29ea, 0x3a6c, 0x0062, 0x0042, 0x2a8d, 0x3b94, 0x3373, 0x3b94, 0x3b74, 0x3b94, 0x3b74, 0x3373, 0x3bb4, 0x3b94, 0x3353, 0x2b53, 0x3353, 0x3b94, 0x3393, 0x43d4, 0x3b94, 0x3353, 0x3353, 0x3373, 0x3393, 0x3b94, 0x3373, 0x3353, 0x3bb4, 0x3b94, 0x3373, 0x3373, 0x3353, 0x5415, 0x0063, 0x1082, 0x29a8, 0x322b, 0x324b, 0x322b, 0x2a0a, 0x2a0b, 0x2a0a, 0x29ea, 0x320b, 0x322b, 0x2a0a, 0x322b, 0x2a0a, 0x29ea, 0x322b, 0x2a2b, 0x324b, 0x322b, 0x29ea, 0x324b, 0x29ea, 0x322b, 0x2a0b, 0x29e9, 0x29ea, 0x324c, 0x2a0b, 0x2a0b, 0x322b, 0x21ca, 0x29ea, 0x2a0a, 0x2a0a, 0x2a2b, 0x322b, 0x326c, 0x0842, 0x8b24, 0xa3e6, 0x9b85, 0xdd8b, 0xd54a, 0xdd6a, 0xdd6a, 0xdd8b, 0xdd6a, 0xdd8b, 0x6200, 0xdd6b, 0xdd8b, 0xd56a, 0xdd8b, 0x3920, 0xeef8, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xc5d5, 0x10e4, 0x1967, 0x1967, 0x2188, 0x29a9, 0x3209, 0x0862, 0x2a4c, 0x43d5, 0x3373, 0x3bb4, 0x3373, 0x3373, 0x3bb4, 0x3373, 0x3bd5, 0x3b94, 0x3b93, 0x3bb4, 0x3bb4, 0x3bb4, 0x3374, 0x3b74, 0x3bb4, 0x3353, 0x3b94, 0x3373, 0x3b94, 0x3b94, 0x3353, 0x3373, 0x3353, 0x3373, 0x3373, 0x3b94, 0x3b94, 0x3373, 0x3b94, 0x3b94, 0x3373, 0x3b93, 0x3b94, 0x4c15, 0x0063, 0x0041, 0x3a4b, 0x2a0a, 0x322b, 0x322b, 0x29ea, 0x322b, 0x29ea, 0x29ea, 0x2a0b, 0x322b, 0x322b, 0x320b, 0x2a0b, 0x322b, 0x324b, 0x2a0a, 0x21ca, 0x2a0a, 0x2a0a, 0x322b, 0x3a4b, 0x2a0a, 0x324b, 0x2a0a, 0x322b, 0x322b, 0x2a0b, 0x324b, 0x29ea, 0x2a0a, 0x29ca, 0x2a0a, 0x2a2b, 0x428c, 0x6225, 0x6a42, 0xa3c6, 0xbc68, 0xdd8b, 0xdd6a, 0xdd8b, 0xd56a, 0xdd8b, 0xdd8b, 0xdd6a, 0x9344, 0xdd8b, 0xdd6a, 0xd54a, 0x9bc6, 0xc592, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xf739, 0x0862, 0x2188, 0x2188, 0x2188, 0x0021, 0x0063, 0x43f5, 0x43f5, 0x3353, 0x43d4, 0x3393, 0x3bb4, 0x3bb4, 0x3bb4, 0x3bb4, 0x3bb4, 0x3b94, 0x3bb4, 0x3b74, 0x3373, 0x3353, 0x3b93, 0x3353, 0x3b94, 0x2b33, 0x3b94, 0x3373, 0x3b94, 0x3b94, 0x3353, 0x43b4, 0x3373, 0x3b94, 0x3373, 0x3373, 0x3bb4, 0x3353, 0x3373, 0x3b93, 0x3332, 0x3374, 0x3373, 0x3bb4, 0x3bb4, 0x3374, 0x3bb4, 0x4bf6, 0x08c5, 0x0042, 0x3a4b, 0x2a0b, 0x2a0a, 0x2a0b, 0x322b, 0x322b, 0x322b, 0x2a0a, 0x2a0b, 0x2a2b, 0x29ea, 0x322b, 0x2a0b, 0x2a2b, 0x2a0b, 0x322b, 0x21ca, 0x3a6c, 0x29ea, 0x2a0b, 0x2a0a, 0x2a2b, 0x29ea, 0x322b, 0x2a0a, 0x2a0a, 0x2a0b, 0x2a0b, 0x29ea, 0x2a0a, 0x324b, 0x0842, 0xa3e7, 0xac28, 0xac07, 0xcd0a, 0xd56a, 0xdd8b, 0xd54a, 0xdd8b, 0xdd6a, 0xdd8a, 0xd56b, 0xb468, 0xdd8b, 0xdd8b, 0xdd8a, 0x4160, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xffbd, 0x18e5, 0x21c9, 0x2167, 0x0042, 0x3b10, 0x4415, 0x3b94, 0x3b94, 0x3bb4, 0x3373, 0x3373, 0x3b94, 0x3373, 0x3353, 0x3374, 0x3b94, 0x3bb4, 0x3353, 0x3b94, 0x3b94, 0x3b94, 0x3b94, 0x3b94, 0x2b53, 0x3373, 0x3b94, 0x3394, 0x3373, 0x3373, 0x3b94, 0x3373, 0x3b73, 0x3353, 0x3b94, 0x3373, 0x3bb4, 0x3353, 0x3373, 0x3b74, 0x43d5, 0x3bb4, 0x3b74, 0x3bb4, 0x3bb4, 0x3373, 0x3353, 0x3bb4, 0x3353, 0x3373, 0x53f4, 0x1082, 0x29e9, 0x324b, 0x21a9, 0x2a0a, 0x21ea, 0x29ea, 0x322b, 0x2a0b, 0x29ea, 0x322b, 0x2a0b, 0x2a0b, 0x322b, 0x29ca, 0x2a0b, 0x322b, 0x2a0a, 0x322b, 0x320b, 0x29ea, 0x322b, 0x2a2b, 0x21c9, 0x2a2b, 0x2a0a, 0x2a0a, 0x322b, 0x2a0a, 0x2a0a, 0x2146, 0x8b88, 0xa3e7, 0xac08, 0xac28, 0xdd8b, 0xdd8b, 0xdd6a, 0xdd6b, 0xdd6b, 0xdd6a, 0xdd8b, 0xe5ab, 0xdd4a, 0xd54a, 0xd56a, 0x4960, 0xfffe, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 
-    0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0x0000, 0x2188, 0x0841, 0x4b50, 0x2a4d, 0x32ae, 0x3b94, 0x43d4, 0x3353, 0x3b94, 0x3374, 0x3353, 0x3b94, 0x3373, 0x3373, 0x3b94, 0x3373, 0x3b74, 0x3353, 0x3b74, 0x3374, 0x3373, 0x3373, 0x3bb4, 0x3b94, 0x3b94, 0x3bb4, 0x3b73, 0x3353, 0x43d5, 0x3b73, 0x3373, 0x3bb4, 0x3373, 0x3b74, 0x3bb4, 0x3373, 0x3353, 0x3353, 0x3394, 0x3bb4, 0x3bb4, 0x3353, 0x3b73, 0x3b94, 0x3353, 0x3373, 0x3b94, 0x3373, 0x3393, 0x3bb4, 0x3bb4, 0x43d4, 0x08e5, 0x08a4, 0x2a0a, 0x322b, 0x322b, 0x2a0b, 0x322b, 0x322b, 0x322b, 0x2a0a, 0x29ea, 0x2a0a, 0x2a0a, 0x2a0b, 0x3a4c, 0x2a0b, 0x322b, 0x29ea, 0x322b, 0x322b, 0x29ea, 0x2a0a, 0x21ca, 0x2a0b, 0x29ea, 0x322b, 0x322b, 0x322b, 0x2a0a, 0x1082, 0xedcc, 0xabe7, 0xa3c6, 0xac48, 0xdd6b, 0xdd6b, 0xdd8b, 0xd56a, 0xdd8b, 0xd54a, 0xdd6b, 0x9364, 0xdd6a, 0xdd8b, 0xdd8b, 0x2060, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 
-    0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef8, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0x10a3, 0x0862, 0x3ace, 0x2a4c, 0x2a6d, 0x2aae, 0x3bd5, 0x3373, 0x3b94, 0x3bb4, 0x3b94, 0x3b94, 0x4c16, 0x3373, 0x3bb4, 0x3b94, 0x3b94, 0x3373, 0x3b94, 0x3373, 0x3353, 0x3b94, 0x3b94, 0x43d5, 0x3b94, 0x3b74, 0x3b73, 0x3b74, 0x3353, 0x3373, 0x3b94, 0x3b94, 0x3b94, 0x3bb4, 0x3373, 0x3b94, 0x3373, 0x3b94, 0x3373, 0x3bb4, 0x3b94, 0x3b94, 0x3373, 0x3373, 0x3373, 0x3353, 0x3373, 0x3373, 0x3373, 0x3373, 0x3373, 0x3b94, 0x3bb4, 0x3373, 0x4bf5, 0x0062, 0x322a, 0x2a0a, 0x21ea, 0x322b, 0x2a0b, 0x2a0a, 0x29ea, 0x2a0a, 0x3a6c, 0x29ea, 0x2a2b, 0x2a0a, 0x2a0b, 0x2a0a, 0x2a0a, 0x2a0b, 0x324b, 0x29c9, 0x29ea, 0x322b, 0x2a0a, 0x322b, 0x322b, 0x324b, 0x29ea, 0x320b, 0x0042, 0xe5cc, 0xd54a, 0xa3a6, 0xa3e7, 0xe5cc, 0xdd6b, 0xdd8b, 0xdd6b, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd8b, 0xa406, 0xdd8b, 0xddab, 0x3900, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 
-    0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xfffd, 0x0841, 0x328d, 0x2a6d, 0x2a4d, 0x2a8d, 0x2a8e, 0x3b93, 0x3bb4, 0x3373, 0x3394, 0x3bb4, 0x3373, 0x3b94, 0x3373, 0x3373, 0x3373, 0x43d5, 0x3b94, 0x3374, 0x3b94, 0x3bb4, 0x3374, 0x3373, 0x3b94, 0x3b94, 0x3b94, 0x3353, 0x2b32, 0x3bb4, 0x3373, 0x3b94, 0x3b94, 0x3b94, 0x3bb4, 0x3bb4, 0x3393, 0x3b73, 0x3353, 0x3bb4, 0x3373, 0x3373, 0x3373, 0x3b93, 0x3b74, 0x3373, 0x3373, 0x3373, 0x3b94, 0x3373, 0x3373, 0x3b94, 0x3373, 0x3353, 0x3b94, 0x3374, 0x3394, 0x2a4c, 0x0041, 0x2a0a, 0x21ea, 0x2a0a, 0x2a0a, 0x2a0a, 0x2a0a, 0x320a, 0x2a0a, 0x322b, 0x29ea, 0x29ea, 0x2a0a, 0x29ea, 0x322b, 0x29ea, 0x2a2b, 0x322b, 0x322b, 0x2a2b, 0x2a0a, 0x322b, 0x2a0a, 0x2a0a, 0x2a0a, 0x320a, 0x3122, 0xdd8a, 0xdd8b, 0xa3e6, 0x6a41, 0xdd8b, 0xdd4a, 0xdd6b, 0xdd8b, 0xdd8b, 0xdd8a, 0xdd6b, 0xe5ec, 0xdd8b, 0xdd8b, 0x9385, 0xff9b, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0x0020, 0x2a6d, 0x328d, 0x2a6d, 0x2a6d, 0x32ae, 0x2ad0, 0x3373, 0x3b94, 0x3373, 0x3b94, 0x3b94, 0x3373, 0x3373, 0x3bb4, 0x3373, 0x3353, 0x3bd5, 0x3bb4, 0x3373, 0x3374, 0x3b73, 0x3353, 0x3bb4, 0x3394, 0x3bb4, 0x3b94, 0x3373, 0x3393, 0x3373, 0x3b94, 0x3b94, 0x3b94, 0x3b94, 0x3bb4, 0x43d5, 0x3bb4, 0x3b94, 0x3373, 0x3373, 0x3bb4, 0x3373, 0x3373, 0x3bb4, 0x3bb4, 0x3b73, 0x3bb4, 0x3373, 0x3b94, 0x3b94, 0x3b94, 0x3353, 0x3373, 0x2b32, 0x3bb4, 0x3b94, 0x3b94, 0x3bb4, 0x43d5, 0x0906, 0x2167, 0x322b, 0x29ea, 0x2a0a, 0x29ea, 0x320b, 0x322b, 0x2a0a, 0x324b, 0x322b, 0x2a0a, 0x324b, 0x322b, 0x21ca, 0x29ea, 0x322b, 0x2a0a, 0x322b, 0x322b, 0x324b, 0x320b, 0x320b, 0x322b, 0x322b, 0x0862, 0xdd6a, 0xdd6a, 0xdd8b, 0xabe7, 0x82e3, 0xdd8a, 0xdd8b, 0xdd6b, 0xdd6b, 0xd54a, 0xd56a, 0xdd8a, 0x7aa2, 0xd56b, 0xdd8b, 0x3961, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef3a, 0x10e5, 0x328d, 0x2a4d, 0x2a6d, 0x326d, 0x2a6d, 0x3b94, 0x3353, 0x3373, 0x3b94, 0x3374, 0x3394, 0x3b73, 0x5456, 0x4b92, 0x0084, 0x0021, 0x0862, 0x0862, 0x0862, 0x0041, 0x0042, 0x0842, 0x0862, 0x0862, 0x0862, 0x0041, 0x0022, 0x1989, 0x53d4, 0x43f5, 0x3b94, 0x3353, 0x3b94, 0x3b94, 0x3394, 0x3373, 0x3b94, 0x3373, 0x3bb4, 0x3bb4, 0x3353, 0x3373, 0x3bb4, 0x3b94, 0x3b94, 0x3bb4, 0x3373, 0x3353, 0x3b94, 0x3bb4, 0x3b94, 0x43f5, 0x3373, 0x3bb4, 0x3373, 0x3b94, 0x3b94, 0x3bb5, 0x3393, 0x4bb2, 0x0862, 0x2a0b, 0x2a2b, 0x2a0b, 0x29ea, 0x2a0b, 0x2a0a, 0x2a0b, 0x2a0a, 0x2a0a, 0x322b, 0x21ea, 0x29ea, 0x2a0b, 0x322b, 0x2a0a, 0x29ea, 0x29ea, 0x2a2b, 0x322b, 0x324b, 0x322b, 0x2a2b, 0x0841, 0xcd0a, 0xdd6a, 0xdd8b, 0xe5ac, 0xb449, 0xdd8b, 0xdd6a, 0xdd6b, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd8b, 0xeded, 0xd56a, 0xdd8b, 0x3920, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef8, 0xef19, 0xeef8, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0x0020, 0x2a4d, 0x326d, 0x2a4c, 0x2a4c, 0x222c, 0x2a8e, 0x3394, 0x43d4, 0x430f, 0x0042, 0x0021, 0x2147, 0x3a6c, 0x322b, 0x29ca, 0x322b, 0x29ca, 0x29ea, 0x2a0b, 0x2a0b, 0x322b, 0x322b, 0x322b, 0x2a0a, 0x320b, 0x29ea, 0x2a0a, 0x2a0b, 0x2a0a, 0x21c9, 0x322b, 0x3a4b, 0x0883, 0x0041, 0x0021, 0x4b71, 0x43d4, 0x3373, 0x3373, 0x3394, 0x3374, 0x3bb4, 0x3353, 0x3bb4, 0x3b74, 0x3373, 0x3b74, 0x3b94, 0x3b74, 0x3373, 0x3bb4, 0x3bb4, 0x3374, 0x3373, 0x3373, 0x3373, 0x3bb4, 0x3bd5, 0x3b94, 0x3353, 0x3373, 0x3373, 0x0062, 0x29c9, 0x322b, 0x324b, 0x2a0a, 0x2a0b, 0x320a, 0x29ea, 0x29ea, 0x29ea, 0x322b, 0x2a2b, 0x29ea, 0x2a0a, 0x322b, 0x2a0a, 0x322b, 0x320b, 0x2a0a, 0x2a0b, 0x322b, 0x322b, 0x2166, 0xbc89, 0xdd6a, 0xdd6b, 0xdd8b, 0xe5ab, 0x61e0, 0xddab, 0xdd6a, 0xdd6b, 0xdd8b, 0xdd6b, 0xdd6a, 0xdd8b, 0x61c0, 0xd56a, 0x38e0, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 
-    0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xe6d8, 0x0041, 0x2a6c, 0x326d, 0x326d, 0x2a6c, 0x32ae, 0x1967, 0x0042, 0x29ea, 0x322b, 0x322b, 0x29ea, 0x320b, 0x322b, 0x2a0a, 0x29ea, 0x29ea, 0x2a0a, 0x322b, 0x2a0a, 0x2a0a, 0x2a0b, 0x2a2b, 0x29ea, 0x2a0a, 0x29ea, 0x29ea, 0x2a0a, 0x322b, 0x324b, 0x2a0a, 0x322b, 0x2a0b, 0x322b, 0x2a0a, 0x2a0a, 0x324b, 0x29c8, 0x0042, 0x0001, 0x3b10, 0x3b94, 0x3393, 0x3353, 0x43d5, 0x3373, 0x3bb4, 0x3b93, 0x3353, 0x3b94, 0x3b94, 0x3b94, 0x3b94, 0x3353, 0x3373, 0x3b94, 0x3353, 0x3b94, 0x3b73, 0x3b94, 0x3373, 0x3b94, 0x3373, 0x3bb4, 0x4310, 0x0042, 0x2a0a, 0x2a0a, 0x2a0a, 0x322b, 0x21ca, 0x322b, 0x2a0b, 0x2a0a, 0x2a0b, 0x2a0b, 0x29ea, 0x320b, 0x29ea, 0x322b, 0x29ea, 0x2a0b, 0x322b, 0x21a9, 0x29ea, 0x2147, 0x6a86, 0xddab, 0xd56a, 0xdd6a, 0xdd8b, 0xa3e6, 0xdd8b, 0xdd8b, 0xdd8b, 0xd54a, 0xdd8b, 0xdd8b, 0xdd6b, 0xe5cc, 0xd54a, 0x8305, 0xf739, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef8, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef8, 0x738d, 0x42ce, 0x2a4c, 0x32ae, 0x326c, 0x0042, 0x29c9, 0x322b, 0x29ea, 0x2a0a, 0x29ea, 0x2a0a, 0x29ea, 0x324b, 0x2a2b, 0x29ea, 0x322b, 0x2a0a, 0x322b, 0x29ea, 0x29ea, 0x322b, 0x21ea, 0x2a0a, 0x322b, 0x2a0b, 0x29ea, 0x322b, 0x2a0a, 0x326c, 0x29ea, 0x322b, 0x29ea, 0x29ea, 0x322b, 0x320b, 0x2a0b, 0x322b, 0x2a0a, 0x2a0a, 0x2a2b, 0x3a6c, 0x10e5, 0x0882, 0x21ea, 0x3bb4, 0x3bb4, 0x3b94, 0x3b94, 0x3353, 0x3373, 0x3b74, 0x3374, 0x3b94, 0x3b93, 0x3353, 0x3373, 0x3353, 0x3b94, 0x3bd4, 0x3b94, 0x3353, 0x3bb4, 0x3b94, 0x3353, 0x3353, 0x43d4, 0x0021, 0x29ea, 0x322b, 0x320a, 0x2a0a, 0x2a0a, 0x29ea, 0x324b, 0x2a0b, 0x322b, 0x324b, 0x29ea, 0x2a0a, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0a, 0x322b, 0x21c9, 0x1967, 0x0000, 0xa3e6, 0xdd8b, 0xdd8b, 0xd54a, 0xdd6a, 0x6200, 0xdd6a, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd6b, 0xdd8b, 0xdd8b, 0xbc88, 0xee2e, 0x0800, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef8, 0xeef9, 0xeef9, 0xeef8, 0xef19, 0x0862, 0x328d, 0x0022, 0x29a8, 0x322b, 0x322b, 0x322b, 0x322b, 0x29ea, 0x322b, 0x2a0a, 0x2a0b, 0x2a0a, 0x29ea, 0x29ea, 0x2a0b, 0x2a0a, 0x2a0b, 0x322b, 0x29ea, 0x29ea, 0x322b, 0x29ea, 0x322b, 0x2a0a, 0x324b, 0x324b, 0x29ea, 0x322b, 0x322b, 0x2a0b, 0x2a2b, 0x2a0b, 0x322b, 0x322b, 0x2a0b, 0x2a0b, 0x322b, 0x2a0b, 0x2a0b, 0x320b, 0x322b, 0x324c, 0x322b, 0x322b, 0x3a8c, 0x0042, 0x0021, 0x6cb7, 0x3394, 0x3373, 0x43d5, 0x3b94, 0x3b94, 0x3393, 0x3bb4, 0x3b94, 0x3373, 0x3373, 0x3393, 0x3b94, 0x3bb4, 0x43d5, 0x3b94, 0x3bb4, 0x3bd5, 0x3353, 0x3b94, 0x08a3, 0x3a6b, 0x320a, 0x2a0b, 0x322b, 0x21ea, 0x324c, 0x2a0b, 0x322b, 0x29ea, 0x2a0a, 0x320b, 0x322b, 0x2a0a, 0x2a2b, 0x2a0a, 0x2a0a, 0x2188, 0x2167, 0x0842, 0xb447, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd8a, 0xddab, 0xdd6a, 0xdd8b, 0xdd8b, 0xd56a, 0xdd6a, 0xddab, 0xdd8b, 0xee2e, 0xd56a, 0x4120, 0xf739, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef8, 0xeef8, 0xeef9, 0xd678, 0x0862, 0x3a4b, 0x322b, 0x322b, 0x2a0a, 0x322b, 0x29ea, 0x322b, 0x21ca, 0x2a0a, 0x322b, 0x29ea, 0x2a0a, 0x2a0a, 0x2a0a, 0x2a0a, 0x2a0a, 0x2a0b, 0x324b, 0x29ea, 0x2a0b, 0x29ea, 0x2a0a, 0x2a0a, 0x2a0a, 0x322b, 0x2a0b, 0x29ea, 0x324b, 0x322b, 0x324b, 0x2a0a, 0x2a0a, 0x322b, 0x320a, 0x2a0a, 0x322b, 0x2a0b, 0x2a0a, 0x322b, 0x2a0b, 0x29ea, 0x2a0a, 0x2a2b, 0x2a0b, 0x2a0b, 0x29ea, 0x29ea, 0x320a, 0x0882, 0x1168, 0x3373, 0x43d5, 0x3bb5, 0x3b94, 0x3b94, 0x3bb4, 0x3bb4, 0x3bb4, 0x3353, 0x3374, 0x3bb4, 0x43d5, 0x3b94, 0x43b4, 0x3373, 0x3b94, 0x4bf5, 0x322b, 0x08a4, 0x29c8, 0x29ea, 0x324b, 0x320b, 0x29ea, 0x324b, 0x2a0a, 0x320b, 0x320b, 0x2a0b, 0x322b, 0x322b, 0x320b, 0x29ea, 0x2a0a, 0x2187, 0x1946, 0x0041, 0xa3c6, 0xdd8b, 0xdd8b, 0xdd8b, 0xd56a, 0xdd8b, 0xa3c6, 0xdd8b, 0xdd6b, 0xdd6b, 0xdd6b, 0xd54a, 0xd54a, 0xd56a, 0xd54a, 0x3100, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 
-    0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef8, 0xeef9, 0xeef9, 0x0020, 0x0862, 0x322b, 0x324b, 0x29ea, 0x2a0a, 0x2a0a, 0x322b, 0x322b, 0x3a8c, 0x3a6c, 0x3a6c, 0x3a6c, 0x324b, 0x2a2b, 0x320b, 0x2a0a, 0x2a2b, 0x2a0a, 0x2a2b, 0x2a0a, 0x324c, 0x2a2b, 0x322b, 0x2a0b, 0x29ea, 0x29ea, 0x322b, 0x322b, 0x322b, 0x2a0a, 0x322b, 0x324b, 0x29ea, 0x2a0b, 0x2a0b, 0x29ea, 0x29ea, 0x2a0a, 0x2a0a, 0x2a0a, 0x322b, 0x2a0a, 0x322b, 0x322b, 0x324b, 0x2a0b, 0x322b, 0x320b, 0x322b, 0x21ca, 0x322b, 0x29ea, 0x21ca, 0x29c9, 0x0862, 0x5c15, 0x3bb4, 0x3393, 0x3b94, 0x2b32, 0x3bb4, 0x3bb4, 0x43d5, 0x3373, 0x3b94, 0x3394, 0x3373, 0x3393, 0x3394, 0x0043, 0x322b, 0x2a0b, 0x324b, 0x0862, 0x29ea, 0x21ea, 0x29ea, 0x2a0b, 0x320b, 0x2a0b, 0x324b, 0x324b, 0x29ea, 0x324b, 0x2a0a, 0x320b, 0x2a0b, 0x21a8, 0x1946, 0x0062, 0xb468, 0xa3e6, 0xddab, 0xdd8b, 0xe5ab, 0xdd6b, 0xee2d, 0xdd6a, 0xdd8b, 0xdd6a, 0xdd6b, 0xd56a, 0xdd8a, 0xdd6a, 0x9b84, 0x6a21, 0xff9b, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef8, 0x0820, 0x0882, 0x324b, 0x322b, 0x322b, 0x19a9, 0x19eb, 0x3b52, 0x43d4, 0x3394, 0x2b33, 0x3b94, 0x3bb4, 0x3373, 0x3394, 0x3394, 0x3b94, 0x4bf5, 0x5456, 0x32ef, 0x0084, 0x08a4, 0x322b, 0x21c9, 0x21ca, 0x2a0b, 0x29ea, 0x2a0a, 0x2a0b, 0x2a0b, 0x2a0b, 0x322b, 0x2a0b, 0x2a0a, 0x322b, 0x29ea, 0x29ea, 0x2a0b, 0x2a0b, 0x29ea, 0x29ea, 0x2a0a, 0x29ea, 0x322b, 0x324c, 0x322b, 0x2a0b, 0x326c, 0x324b, 0x324b, 0x2a2b, 0x2a0a, 0x324b, 0x29ea, 0x320b, 0x320b, 0x322b, 0x324c, 0x3a4b, 0x0842, 0x5435, 0x3b94, 0x3b94, 0x3bb4, 0x3bb4, 0x3b94, 0x3393, 0x3353, 0x2b32, 0x3b94, 0x3b74, 0x3b94, 0x2a09, 0x2a0a, 0x29ea, 0x322b, 0x322b, 0x0862, 0x2a0b, 0x322b, 0x29ea, 0x21ea, 0x2a0b, 0x2a0a, 0x2a0a, 0x324b, 0x322b, 0x29ea, 0x29ea, 0x29ea, 0x1947, 0x1946, 0x10a3, 0xcd2c, 0xb427, 0xdd6a, 0xdd8b, 0xdd8b, 0xdd6a, 0xdd6a, 0xddac, 0xdd6a, 0xdd6b, 0xdd8b, 0xdd8b, 0xdd6b, 0xdd8b, 0xddac, 0xf68f, 0xd655, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xe6f8, 0x8c0e, 0x0841, 0x29ea, 0x32ce, 0x3352, 0x3373, 0x3bb4, 0x3b94, 0x3393, 0x3b94, 0x3b94, 0x3373, 0x43b4, 0x3373, 0x3bb4, 0x3394, 0x3373, 0x3b94, 0x3bb4, 0x3b94, 0x3bb4, 0x3373, 0x3373, 0x3bd5, 0x2b53, 0x43b4, 0x1968, 0x0883, 0x3a4b, 0x29ea, 0x324c, 0x322b, 0x2a0a, 0x2a0b, 0x2a0a, 0x2a0b, 0x29ea, 0x322b, 0x322b, 0x322b, 0x324b, 0x2a0a, 0x322b, 0x322b, 0x2a0a, 0x2a0b, 0x2a0a, 0x320b, 0x322b, 0x324b, 0x29ea, 0x29ea, 0x2a0b, 0x322b, 0x2a0a, 0x2a0a, 0x2a0a, 0x2a0b, 0x322b, 0x322b, 0x322b, 0x2a0a, 0x320a, 0x0882, 0x4c36, 0x3bd5, 0x3b94, 0x3bb4, 0x3b94, 0x3b94, 0x3bb4, 0x3b94, 0x3b93, 0x3bb4, 0x324c, 0x322b, 0x322b, 0x29ca, 0x2a0a, 0x322b, 0x0861, 0x2a0a, 0x322b, 0x29ea, 0x2a0a, 0x322b, 0x2a0a, 0x2a0a, 0x21c9, 0x21a9, 0x322b, 0x2188, 0x2167, 0x2167, 0x1925, 0xa40a, 0xa3e6, 0xd52a, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd8b, 0xbca9, 0xd54a, 0xdd6a, 0xddab, 0xd56a, 0xdd6a, 0xd56a, 0xdd6a, 0xdd6a, 0x0800, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef8, 0xef19, 0xeef8, 0x944f, 0x08a3, 0x4392, 0x3b94, 0x3b94, 0x3bb4, 0x3b73, 0x3393, 0x5456, 0x53d3, 0x220a, 0x0022, 0x0000, 0x0000, 0x0000, 0x0820, 0x0000, 0x0000, 0x0000, 0x0042, 0x326c, 0x5c75, 0x4bf4, 0x3bb4, 0x3373, 0x3bb4, 0x3373, 0x3373, 0x3373, 0x3373, 0x3373, 0x4bd5, 0x00a5, 0x29c8, 0x29ea, 0x2a0b, 0x2a0a, 0x2a0a, 0x322b, 0x2a0b, 0x29ea, 0x324c, 0x2a0a, 0x2a0a, 0x320b, 0x322b, 0x21ea, 0x29ea, 0x2a0a, 0x2a0a, 0x322b, 0x2a0a, 0x324b, 0x324b, 0x322b, 0x320a, 0x2a2b, 0x322b, 0x322b, 0x2a0a, 0x29ea, 0x2a0a, 0x322b, 0x2a0a, 0x2a0b, 0x2a0a, 0x3a4b, 0x0862, 0x43d4, 0x3393, 0x3373, 0x3353, 0x3b94, 0x3373, 0x3b94, 0x1968, 0x2a0a, 0x320a, 0x2a0a, 0x29ea, 0x322b, 0x29ea, 0x29ea, 0x0021, 0x3a8c, 0x322b, 0x29ea, 0x2a0a, 0x29ea, 0x2a0a, 0x2a0b, 0x322b, 0x2a0a, 0x1946, 0x1947, 0x1946, 0x2146, 0x3922, 0xabe7, 0xac07, 0xdd6a, 0xdd6a, 0xdd8b, 0xdd8b, 0xdd6a, 0xddab, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd6b, 0xdd6b, 0xcd09, 0x4120, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef8, 0xfffe, 0x1062, 0x3b10, 0x3353, 0x43b4, 0x3b94, 0x4bf4, 0x1989, 0x0882, 0x1062, 0x1060, 0x8b66, 0xbc89, 0xa3e7, 0x9b85, 0xa3c5, 0xa3c6, 0xa3c6, 0xa3e7, 0xb469, 0xabe6, 0xac07, 0xbcaa, 0x30c0, 0x28a0, 0x1881, 0x0020, 0x326c, 0x3bd4, 0x3b94, 0x3b94, 0x3373, 0x3b94, 0x3b73, 0x3b94, 0x3393, 0x5435, 0x0042, 0x3a6c, 0x2a0b, 0x2a0b, 0x29ea, 0x2a0b, 0x2a0a, 0x320b, 0x324b, 0x29ea, 0x324c, 0x2a0b, 0x322b, 0x322b, 0x324c, 0x322b, 0x2a0b, 0x322b, 0x2a0a, 0x322b, 0x2a2b, 0x322b, 0x320b, 0x29ea, 0x324b, 0x2a0a, 0x322b, 0x29ca, 0x324b, 0x324b, 0x322b, 0x2a0b, 0x322b, 0x0883, 0x0084, 0x3bb4, 0x3bb4, 0x3374, 0x3353, 0x3353, 0x2188, 0x322b, 0x2a0a, 0x322b, 0x322b, 0x322b, 0x2a0b, 0x29ea, 0x2a2b, 0x08a4, 0x3a6b, 0x322b, 0x322b, 0x322b, 0x2a0a, 0x320b, 0x322b, 0x2a0a, 0x2167, 0x2167, 0x1926, 0x2167, 0x0000, 0xa3e6, 0xac07, 0xe5ac, 0xdd8b, 0xdd8b, 0xdd6a, 0xdd6b, 0xac06, 0xdd6b, 0xd54a, 0xdd8b, 0xdd6a, 0xdd6a, 0xdd8b, 0xd54a, 0x4140, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 
-    0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef39, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0x0000, 0x53f3, 0x3bb4, 0x3b93, 0x5c55, 0x0001, 0x0861, 0x10c3, 0x1925, 0x1926, 0x18e4, 0x6202, 0xa3a6, 0xa3a6, 0xa3c6, 0xa3a5, 0xa3a6, 0x9ba6, 0x9b65, 0x4960, 0xa3a6, 0xac07, 0xa3c7, 0x3080, 0xfe13, 0xe550, 0xe570, 0xe570, 0xe570, 0x936a, 0x1041, 0x0001, 0x5414, 0x3b94, 0x3b94, 0x3b74, 0x3bb4, 0x3b94, 0x3b94, 0x3b94, 0x5c14, 0x0083, 0x324b, 0x2a0b, 0x320a, 0x2a0a, 0x322b, 0x322b, 0x322b, 0x322b, 0x320b, 0x322b, 0x320b, 0x322b, 0x322b, 0x322b, 0x29ea, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x322b, 0x29ea, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0a, 0x2a0b, 0x324b, 0x322b, 0x322b, 0x08c4, 0x3ace, 0x3b93, 0x3b93, 0x4350, 0x2a0b, 0x2a0a, 0x322b, 0x2a0b, 0x322b, 0x322b, 0x2a0a, 0x2a0a, 0x2a0b, 0x322b, 0x3a4b, 0x320a, 0x29ea, 0x320b, 0x2a2b, 0x29ea, 0x322b, 0x29c9, 0x1967, 0x1946, 0x1946, 0x2166, 0x0000, 0xac07, 0xa3c6, 0xa3c6, 0xd56a, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd6a, 0xd54a, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd6a, 0xdd6a, 0x30a0, 0xf75b, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xffbd, 0x0042, 0x3b72, 0x3393, 0x4330, 0x0862, 0x0882, 0x2146, 0x1925, 0x1925, 0x1105, 0x1946, 0x2080, 0xabe6, 0xa3c6, 0xa3e6, 0xa3c6, 0xa3a6, 0xa3a6, 0xa3c6, 0xa3a6, 0xb448, 0xac07, 0xac07, 0xbc8a, 0x2840, 0xe550, 0xe570, 0xe550, 0xe550, 0xed70, 0xe550, 0xe570, 0xed91, 0x3101, 0x1881, 0x21c9, 0x3373, 0x3373, 0x3373, 0x2b32, 0x3373, 0x3bb5, 0x3b94, 0x5436, 0x0042, 0x322b, 0x322b, 0x324b, 0x322b, 0x29ea, 0x322b, 0x322b, 0x2a0a, 0x322b, 0x322b, 0x2a0a, 0x322b, 0x29ea, 0x322b, 0x2a0b, 0x29ea, 0x2a0b, 0x29ea, 0x322b, 0x320b, 0x2a0a, 0x29ea, 0x2a0b, 0x2a2b, 0x324b, 0x2a0b, 0x2a0a, 0x322b, 0x29ea, 0x322b, 0x1946, 0x0841, 0x2a6d, 0x0084, 0x322b, 0x2a0a, 0x2a0a, 0x2a2b, 0x2a0a, 0x2a2b, 0x322b, 0x29ea, 0x322b, 0x322b, 0x2a0b, 0x2188, 0x29c8, 0x2a0a, 0x21c9, 0x324b, 0x324b, 0x1967, 0x1946, 0x1926, 0x1946, 0x2146, 0x0020, 0xac07, 0xa3c6, 0xa3e6, 0xdd6a, 0xdd6b, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd6b, 0xdd8b, 0xdd8b, 0xdd6b, 0xdd8b, 0xdd8b, 0xdd8b, 0x4980, 0xfffe, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef8, 0xf7bd, 0x0862, 0x3b93, 0x4372, 0x1082, 0x0841, 0x1925, 0x1946, 0x1105, 0x1925, 0x1105, 0x1925, 0x0861, 0xbcca, 0xa3e7, 0xac27, 0x9ba5, 0x9ba6, 0x9ba6, 0xa3e6, 0xa3e6, 0xac28, 0xa3c6, 0xa3c6, 0xa3a6, 0x3900, 0xe550, 0xe570, 0xe550, 0xe550, 0xe550, 0xe570, 0xe570, 0xed70, 0xed90, 0x38e0, 0xac07, 0xb48b, 0x1040, 0x1127, 0x3bb4, 0x3b94, 0x3bd4, 0x3b94, 0x3bb4, 0x3353, 0x3373, 0x4bd4, 0x0042, 0x322a, 0x2a0a, 0x322b, 0x29ea, 0x29e9, 0x2a0a, 0x2a0b, 0x29ea, 0x29ea, 0x322b, 0x322b, 0x2a0a, 0x322b, 0x2a0a, 0x322b, 0x2a0a, 0x2a2b, 0x324b, 0x2a0a, 0x29ea, 0x322b, 0x322b, 0x29ea, 0x322b, 0x2a0a, 0x3a6b, 0x0042, 0x4b92, 0x3b93, 0x3b94, 0x0842, 0x31e9, 0x322b, 0x2a0b, 0x2a0a, 0x29ea, 0x29ea, 0x322b, 0x322b, 0x29ea, 0x2a0a, 0x21ca, 0x322b, 0x21ea, 0x320a, 0x3a6c, 0x29ea, 0x322b, 0x2a0a, 0x1946, 0x1966, 0x1946, 0x1946, 0x1946, 0x0862, 0xa3c6, 0x9ba6, 0xac27, 0xdd8b, 0xe58b, 0xdd8b, 0xdd8b, 0xdd6a, 0xbca8, 0xdd8b, 0xddab, 0xdd8b, 0xdd6a, 0xdd6a, 0xdd6b, 0xcd2b, 0x9c4d, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 
-    0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef8, 0x20e2, 0x08c5, 0x3b31, 0x0842, 0x0862, 0x1105, 0x1905, 0x1905, 0x1105, 0x1925, 0x1925, 0x1905, 0x1904, 0x30e0, 0xa3c6, 0xabe7, 0xa3c6, 0xa3c6, 0xa3c6, 0xa3e6, 0x9ba5, 0xa3c6, 0x4960, 0xa3c6, 0xa3c6, 0x51a0, 0xedf2, 0xed90, 0xe570, 0xdd2f, 0xe550, 0xed70, 0xe570, 0xe570, 0xe570, 0xe550, 0x38e0, 0xa3e7, 0xabe7, 0x9ba6, 0x4100, 0x51a2, 0x0841, 0x5435, 0x3353, 0x3b94, 0x3373, 0x3373, 0x3b94, 0x3353, 0x3374, 0x4b92, 0x0042, 0x3a4b, 0x2a0a, 0x322b, 0x29ea, 0x2a0a, 0x322b, 0x2a0a, 0x2a0a, 0x29ea, 0x29ea, 0x2a0a, 0x2a0a, 0x322b, 0x322b, 0x2a0b, 0x2a0a, 0x322b, 0x322b, 0x2a0b, 0x3a6c, 0x0062, 0x1968, 0x3bb4, 0x3373, 0x3b94, 0x3353, 0x3353, 0x32af, 0x2a0a, 0x10a3, 0x320b, 0x2a0b, 0x29ea, 0x2a0a, 0x324c, 0x322b, 0x2a0a, 0x324b, 0x29ea, 0x2a0b, 0x322b, 0x322b, 0x2167, 0x428c, 0x322b, 0x21a8, 0x1946, 0x1946, 0x2167, 0x1926, 0x1926, 0x0821, 0x82e4, 0xabe7, 0xac07, 0xcce9, 0xdd8b, 0xdd6a, 0xdd6a, 0xdd8b, 0xdd8b, 0xdd8a, 0xdd8b, 0xdd8b, 0xdd6a, 0xd54a, 0xdd6b, 0xf66f, 0x0800, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xf77c, 0x0884, 0x4b2f, 0x0862, 0x1926, 0x1925, 0x10e5, 0x1905, 0x10e5, 0x1105, 0x1925, 0x1925, 0x10e4, 0x0861, 0xa3c6, 0xa3c6, 0x9b85, 0xa3c6, 0xa3e7, 0xa3e7, 0xa3c6, 0xa3c6, 0x9ba6, 0xa407, 0xabe7, 0xa3c6, 0x4100, 0xe570, 0xe570, 0xe550, 0xe570, 0xe570, 0xe52f, 0xed90, 0xe570, 0xe570, 0xe550, 0x3900, 0xa3c6, 0xa3c6, 0x9ba6, 0xa3c7, 0xa3e6, 0xa3c6, 0x72a4, 0x1061, 0x5414, 0x3333, 0x3bb4, 0x3b94, 0x3b94, 0x3b94, 0x3bb4, 0x3373, 0x43b4, 0x0926, 0x0862, 0x3a8b, 0x2a2b, 0x2a2b, 0x29ca, 0x322b, 0x2a2b, 0x2a0b, 0x322b, 0x322b, 0x322b, 0x322b, 0x322b, 0x322b, 0x31e9, 0x0021, 0x19c9, 0x43f4, 0x3373, 0x3bb4, 0x3b94, 0x3b94, 0x3b94, 0x3b94, 0x3b73, 0x328e, 0x2a2c, 0x42ac, 0x28c1, 0x2167, 0x2a0a, 0x2a0b, 0x2a0b, 0x322b, 0x322b, 0x2a0a, 0x2a2b, 0x2a0b, 0x322b, 0x320a, 0x2a0a, 0x10c4, 0x3a8c, 0x1926, 0x1946, 0x1946, 0x1967, 0x2146, 0x1946, 0x0820, 0x8b24, 0xa3c6, 0xa3c6, 0xac07, 0xdd6a, 0xdd6b, 0xdd8b, 0xdd6a, 0xdd8b, 0xcd09, 0xdd6a, 0xdd8b, 0xdd8b, 0xe5ab, 0xdd8b, 0xd54a, 0x30e0, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xf79d, 0x0021, 0x1905, 0x0841, 0x1925, 0x1925, 0x1925, 0x1925, 0x1925, 0x1905, 0x10e5, 0x1905, 0x1905, 0x0882, 0x8327, 0xa3c6, 0xa3c6, 0x9ba6, 0x9ba6, 0xa3c6, 0xa3e7, 0xa3e7, 0xa3e6, 0x7aa3, 0xac07, 0xa3e7, 0x9386, 0xfe33, 0xed90, 0xed70, 0xe570, 0xed70, 0xe550, 0xe54f, 0xe550, 0xe570, 0xe570, 0xed70, 0x4100, 0xa3a6, 0xa3c6, 0xa3c6, 0xb469, 0xac07, 0xa3c6, 0xac07, 0xa3c6, 0xbcab, 0x1881, 0x1927, 0x3373, 0x3b94, 0x3b94, 0x3bb4, 0x3b94, 0x3b94, 0x3b94, 0x3bb4, 0x3bb4, 0x43f4, 0x4330, 0x00a4, 0x0022, 0x0862, 0x0863, 0x0862, 0x0862, 0x0042, 0x1968, 0x4bb3, 0x3b94, 0x3b94, 0x3b94, 0x3373, 0x3353, 0x3352, 0x3b94, 0x3b94, 0x3b93, 0x3b93, 0x32cf, 0x32cf, 0x1946, 0x1020, 0xb489, 0xa3c6, 0x5180, 0x0840, 0x322b, 0x2a0a, 0x322b, 0x2a0b, 0x2a2b, 0x324b, 0x2a0b, 0x21ca, 0x322b, 0x324b, 0x2a0b, 0x10e5, 0x2167, 0x1946, 0x1946, 0x1946, 0x1926, 0x1926, 0x0000, 0xac07, 0xa3e6, 0xa3c6, 0xb447, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd6a, 0xdd6a, 0xcd0a, 0xdd6b, 0xdd6a, 0xdd8b, 0xdd8b, 0xdd8b, 0xd56a, 0x3900, 0xeef8, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 
-    0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0x0862, 0x322b, 0x0861, 0x1926, 0x1946, 0x1925, 0x10e5, 0x1905, 0x1925, 0x10e4, 0x1105, 0x1905, 0x1925, 0x1060, 0xabe7, 0x9ba6, 0x8b45, 0x9ba6, 0x9b85, 0x9ba6, 0xac07, 0xac07, 0xabe7, 0x6221, 0xa3c6, 0xabe7, 0x38e0, 0xe590, 0xe550, 0xe570, 0xed70, 0xe550, 0xe550, 0xe550, 0xe54f, 0xe570, 0xe570, 0xed70, 0x4100, 0xabe7, 0xa3e6, 0x9ba6, 0x8b24, 0xa3c6, 0xa3e7, 0xac07, 0xabe6, 0xabe6, 0xa3e7, 0xc4ea, 0x1040, 0x00a4, 0x3373, 0x3353, 0x3bb4, 0x3bb4, 0x3bb4, 0x3bb4, 0x3373, 0x43d5, 0x3bb4, 0x3b94, 0x3b94, 0x3bd4, 0x3373, 0x3b94, 0x2b12, 0x3373, 0x3373, 0x3bb4, 0x3b94, 0x3bb4, 0x3394, 0x3373, 0x3394, 0x3353, 0x3b73, 0x2b53, 0x3331, 0x3b30, 0x08c4, 0x1860, 0xac49, 0xac27, 0xa3c6, 0xa3c6, 0xa3e6, 0xa3e8, 0x20a0, 0x322b, 0x322b, 0x322b, 0x322b, 0x320b, 0x2a0a, 0x29ea, 0x322b, 0x2a0a, 0x322b, 0x322b, 0x0862, 0x1967, 0x1946, 0x1946, 0x1946, 0x2167, 0x0000, 0xa3a6, 0xa3e7, 0xac07, 0xa3a6, 0xddab, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd6a, 0xdd6a, 0xd56a, 0xe5ab, 0xdd6b, 0xdd8b, 0xd56a, 0xdd6b, 0x3900, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xfffe, 0x3209, 0x0841, 0x1905, 0x1926, 0x1905, 0x1926, 0x1105, 0x1905, 0x1105, 0x1925, 0x1905, 0x1925, 0x0882, 0x8b47, 0xa3c6, 0xa3c7, 0x9b85, 0x9344, 0xa3a6, 0xa3e7, 0xa3c6, 0x9ba5, 0x9ba6, 0xac48, 0xa3a6, 0xb449, 0x6a03, 0xe54f, 0xe550, 0xe54f, 0xed70, 0xe54f, 0xe570, 0xed70, 0xed70, 0xe550, 0xe570, 0xe570, 0x5120, 0xc4cb, 0xac07, 0xa3c6, 0x6a41, 0xabe7, 0xb428, 0xa3a6, 0xac07, 0x9ba5, 0xa3c6, 0xa3a6, 0xabe7, 0xbca9, 0x1020, 0x0000, 0x5c55, 0x3353, 0x3b94, 0x3b94, 0x3bd5, 0x43f5, 0x3b73, 0x3353, 0x3b73, 0x43b4, 0x3373, 0x3b94, 0x3373, 0x43d5, 0x3373, 0x3b94, 0x3373, 0x3bb4, 0x3373, 0x3b73, 0x3bb4, 0x2311, 0x3374, 0x2188, 0x0820, 0x4961, 0xa408, 0xac48, 0xa3c6, 0xac28, 0xac27, 0xa3c6, 0xa3e7, 0xac07, 0xb448, 0x30e0, 0x322b, 0x322b, 0x324b, 0x2a2b, 0x322b, 0x322b, 0x29ea, 0x2a0a, 0x29c9, 0x1946, 0x2167, 0x10a3, 0x1946, 0x1946, 0x2167, 0x1946, 0x1040, 0xabe7, 0xa3e7, 0xa3e7, 0xa3c6, 0xcd2a, 0xdd6a, 0xd54a, 0xdd6b, 0xdd8b, 0xdd8b, 0xd56a, 0xdd6a, 0xdd8b, 0xdd8b, 0xdd6a, 0xd56a, 0x1840, 0xf77b, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xad12, 0x2a2a, 0x0861, 0x1926, 0x1905, 0x1925, 0x1905, 0x10e5, 0x1925, 0x1925, 0x10c4, 0x1105, 0x10e5, 0x1861, 0xa3c6, 0xa3e7, 0x51a0, 0x9b85, 0xa3c6, 0xa3e7, 0xa3e6, 0xa3c6, 0xa3e6, 0x9bc6, 0xa3c6, 0x9b85, 0x30c0, 0xe550, 0xed90, 0xe54f, 0xe550, 0xe550, 0xe570, 0xe54f, 0xe550, 0xe570, 0xe54f, 0xe570, 0xe550, 0xfe53, 0x2880, 0xa3c6, 0xa3e6, 0x61e0, 0xabe7, 0xabe6, 0xa3c6, 0xa3c6, 0xac07, 0xac07, 0xac07, 0xa3c6, 0xac07, 0xa3c6, 0x4120, 0xfeb5, 0x0000, 0x0841, 0x00a4, 0x430f, 0x5c75, 0x4bf5, 0x43d4, 0x3bb4, 0x2b12, 0x3352, 0x3353, 0x3bb4, 0x3393, 0x3394, 0x3353, 0x3353, 0x4bf5, 0x4371, 0x08e5, 0x0841, 0x30e0, 0x93c7, 0xac07, 0xa3a5, 0xa3c6, 0xabe7, 0x6a62, 0x8b24, 0xa3e6, 0xabe7, 0xd54b, 0xdd8b, 0xdd8b, 0xa3c6, 0xa407, 0x28a0, 0x1904, 0x29ea, 0x322b, 0x29ea, 0x29ea, 0x320b, 0x2a0a, 0x322b, 0x1966, 0x2166, 0x1925, 0x2188, 0x1926, 0x1946, 0x1905, 0x72a5, 0xabe7, 0x6200, 0xa3c6, 0xabe7, 0xdd6a, 0xdd6b, 0xdd6a, 0xd54a, 0xdd8b, 0xdd6a, 0x8b03, 0xd56a, 0xdd8b, 0xdd8b, 0xe5ab, 0xdd6b, 0x61e1, 0xfffe, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xffdd, 0x424a, 0x0041, 0x1105, 0x1125, 0x10e4, 0x1925, 0x1105, 0x1925, 0x10e5, 0x1105, 0x10e4, 0x18e4, 0xa3e8, 0xa3e7, 0xa3e7, 0x8b45, 0x8b24, 0xa3c6, 0x9b85, 0xa3c6, 0xa3e7, 0xa3c6, 0x4920, 0xac07, 0xa3e7, 0x30a0, 0xe550, 0xe54f, 0xe570, 0xe570, 0xe570, 0xed70, 0xe570, 0xe570, 0xed70, 0xed70, 0xe570, 0xe570, 0xdd2f, 0x30e0, 0xac07, 0xa3c6, 0x6200, 0xa3c6, 0xa3e6, 0xa3c6, 0xa3c6, 0xabe7, 0xa3e6, 0xa3a6, 0xac07, 0x9b85, 0xb449, 0xedd2, 0xe550, 0xe550, 0xe550, 0xedb1, 0xfeb6, 0x8b6a, 0x1020, 0x0000, 0x0000, 0x0000, 0x0842, 0x0841, 0x0841, 0x0821, 0x0001, 0x0000, 0x0000, 0x38e2, 0xd592, 0xfe33, 0xe550, 0xe550, 0x3920, 0xac07, 0xa3c6, 0xa3e6, 0xa3a6, 0xac07, 0x9ba6, 0xa3a5, 0xdd8a, 0xd54a, 0xdd8a, 0xdd6b, 0xdd6b, 0xac06, 0xac07, 0x2880, 0x2146, 0x2a0a, 0x322b, 0x2a0a, 0x29ea, 0x2a0a, 0x1947, 0x1125, 0x1946, 0x2167, 0x0862, 0x2187, 0x1946, 0x0041, 0xc4aa, 0xa3c6, 0x7aa2, 0xa3e6, 0x9ba6, 0xcd09, 0xdd8b, 0xdd6b, 0xdd6a, 0xddab, 0xd56a, 0xe5ac, 0xe5ab, 0xdd8b, 0xd54a, 0xdd8b, 0xdd8b, 0xe5cd, 0xa4af, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0x0000, 0x0842, 0x1105, 0x1105, 0x10e5, 0x1925, 0x1905, 0x1905, 0x1925, 0x1105, 0x1105, 0x0841, 0xa3a6, 0xabe7, 0x9ba6, 0x9ba6, 0x8b25, 0xac07, 0xa3c6, 0x9ba6, 0xabe7, 0xa3e6, 0x9366, 0xabe6, 0xb469, 0xf5f2, 0xed70, 0xed71, 0xdd0f, 0xf5f2, 0xfe33, 0xf613, 0xe550, 0xe570, 0xe590, 0xed90, 0xe570, 0xe570, 0xf5b1, 0x30c0, 0x9ba6, 0xa3e6, 0x51c0, 0xa3e6, 0xa3c6, 0xa3c6, 0xabe7, 0xac07, 0xac07, 0x9ba6, 0xa3e6, 0xa3c6, 0x38e0, 0xe56f, 0xe550, 0xe52f, 0xe550, 0xe570, 0xe570, 0xe550, 0xe550, 0xed70, 0xe570, 0xe570, 0xe54f, 0xe570, 0xed70, 0xe570, 0xe550, 0xe54f, 0xe550, 0xe570, 0xe550, 0xe550, 0xe570, 0xe550, 0xfe74, 0x4940, 0xabe7, 0xac07, 0xa3c6, 0xac06, 0x4120, 0xdd6b, 0xdd8b, 0xdd8b, 0xdd8b, 0xddab, 0xe5ab, 0xdd6b, 0xcce9, 0xa3e6, 0x2060, 0x0841, 0x2a0b, 0x322b, 0x322b, 0x2a0b, 0x1966, 0x1926, 0x2147, 0x1946, 0x1926, 0x10a3, 0x1926, 0x0862, 0xa3c5, 0xabe6, 0xb469, 0xa3e7, 0xa3c6, 0x9ba5, 0xdd8b, 0xdd8b, 0xdd6a, 0xdd6b, 0xdd8b, 0xdd6a, 0xb447, 0xdd8b, 0xdd6a, 0xd56a, 0xdd6b, 0xf68f, 0x0800, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef8, 0x0000, 0x0882, 0x10e5, 0x1925, 0x10e5, 0x10e4, 0x1105, 0x1905, 0x1905, 0x1105, 0x1860, 0xa3c6, 0xa3c6, 0xac28, 0xa3c6, 0x8b25, 0xa3e7, 0xa3e7, 0xac07, 0xac07, 0xa3c6, 0xb448, 0x9ba5, 0x3080, 0xe570, 0xfe33, 0x4140, 0x5160, 0x6a21, 0x6a41, 0x6201, 0x30c0, 0x30a0, 0xf633, 0xe52f, 0xe550, 0xe570, 0xe570, 0xccee, 0xac07, 0xabe7, 0x6a41, 0xa3c6, 0xa3c6, 0xa3e6, 0xa3c6, 0xabe7, 0xa3c6, 0xa3c6, 0xa3c6, 0xabe7, 0x3080, 0xe550, 0xe570, 0xe550, 0xe550, 0xe570, 0xe52f, 0xe570, 0xe550, 0xe570, 0xe570, 0xe550, 0xe570, 0xed70, 0xed70, 0xe54f, 0xed91, 0xe570, 0xe570, 0xe570, 0xe550, 0xe570, 0xed90, 0xe550, 0xe550, 0x38e0, 0xabe6, 0xa3a5, 0xe5cc, 0xdd8b, 0xe5cd, 0xee0e, 0xdd8b, 0xdd8b, 0xdd6a, 0xd56a, 0xd56a, 0xe5ab, 0xdd6a, 0xd52a, 0xa3e6, 0x3900, 0x0842, 0x29ea, 0x322b, 0x2167, 0x2167, 0x1926, 0x1946, 0x1926, 0x1946, 0x0883, 0x1926, 0x0882, 0xabe6, 0xa3a6, 0xb448, 0xa3e6, 0xdd6b, 0xa3e7, 0xdd6a, 0xdd6b, 0xdd8b, 0xdd6b, 0xd54a, 0xdd8b, 0x82e2, 0xdd8b, 0xdd8b, 0xdd8b, 0xddab, 0xdd6a, 0x1820, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 
-    0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0x6b4b, 0x0041, 0x10c3, 0x1926, 0x1105, 0x1925, 0x1905, 0x10e5, 0x10a3, 0xbcab, 0xabe6, 0xa3c6, 0x4100, 0x9b86, 0x9b86, 0xabe7, 0xac07, 0xabe7, 0xabe6, 0xa3e6, 0xac28, 0xa3a6, 0x30c0, 0x2020, 0x2840, 0x40c0, 0x40c0, 0x1800, 0x30c0, 0x38e0, 0x61e1, 0x82a2, 0x6a41, 0x38c0, 0xed70, 0xe570, 0xe571, 0xe591, 0x9365, 0xac07, 0xbcaa, 0xa3e6, 0xac07, 0xb427, 0xabe6, 0xabe6, 0xac07, 0xa3e6, 0x9365, 0xa3a6, 0xf5f2, 0xe54f, 0xe570, 0xe550, 0xe570, 0xe550, 0xe550, 0xe550, 0xe550, 0xe54f, 0xe550, 0xe570, 0xe550, 0xe52f, 0xe570, 0xe570, 0xed90, 0xe52f, 0xe570, 0xe54f, 0xe570, 0xe570, 0xe550, 0xe550, 0xe550, 0xff59, 0x4920, 0xe5ab, 0xdd8b, 0xdd6a, 0xdd4a, 0xd54b, 0xdd6b, 0xdd6a, 0xdd8b, 0xdd6b, 0xdd8b, 0xd56a, 0xd56a, 0xdd8b, 0xac27, 0x8304, 0x3940, 0x10a3, 0x2187, 0x1126, 0x1946, 0x1926, 0x1926, 0x1946, 0x1926, 0x1947, 0x0882, 0x0000, 0xac07, 0xa3c6, 0xac07, 0xac27, 0xdd6a, 0xa3a6, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd6b, 0xdd8b, 0xddab, 0xdd6b, 0xdd8b, 0xdd6a, 0xdd6a, 0x3920, 0xef19, 0xeef9, 0xef19, 0xeef8, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xfffe, 0x0000, 0x1062, 0x0862, 0x0882, 0x10c4, 0x1881, 0xabe6, 0xa3c6, 0xa3c6, 0x7283, 0x9bc6, 0xa3c6, 0xa3c6, 0xa3a6, 0xa3e6, 0xa3c6, 0xb469, 0xa3e6, 0xb448, 0x9327, 0xed70, 0xe54f, 0xe570, 0xe570, 0xe570, 0xe570, 0xe570, 0xedb1, 0x82a5, 0x38c0, 0x7282, 0x38e0, 0xfffb, 0xfef7, 0xfef7, 0x4940, 0xdd6b, 0xee0d, 0xd529, 0xdd6a, 0xdd6a, 0xd54a, 0xd56a, 0xac07, 0x9ba6, 0x9ba5, 0xb469, 0xe52f, 0xe570, 0xe550, 0xe550, 0xe570, 0xe570, 0xe54f, 0xe54f, 0xe550, 0xe52f, 0xf633, 0x40c0, 0x2860, 0x28a0, 0x3900, 0x30a0, 0x30a0, 0x2840, 0x3880, 0xedf2, 0xfe54, 0xf654, 0xff38, 0xfef7, 0xfef7, 0xfef7, 0x2820, 0xdd8b, 0xd54a, 0xdd6b, 0xdd8b, 0x6a41, 0xdd6a, 0xdd8b, 0xdd6a, 0xdd8b, 0xdd8b, 0xdd8b, 0xe5ab, 0xdd8b, 0xa3c6, 0x8b45, 0xa3e7, 0x1861, 0x10e4, 0x1946, 0x1946, 0x1946, 0x1946, 0x1946, 0x1946, 0x1946, 0x0862, 0x9bc8, 0xb427, 0xabe7, 0xac27, 0xbc89, 0xdd8b, 0xbc88, 0xdd8b, 0xe5ab, 0xdd8b, 0xdd6a, 0xdd6a, 0xdd8a, 0xdd6b, 0xa3a5, 0xdd8b, 0xdd6b, 0xdd6a, 0xdd8b, 0x3920, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 
-    0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xf73a, 0xffdd, 0xffbe, 0x1860, 0xac07, 0xabe7, 0xac07, 0xbc89, 0xa3c6, 0xb428, 0xac27, 0xac07, 0xa3e6, 0xabe6, 0x9ba7, 0xabe6, 0x6a42, 0xfe33, 0xe570, 0xe570, 0xe570, 0xe570, 0xe591, 0xfef7, 0xfef7, 0xfef8, 0xfef7, 0xfef7, 0x8284, 0x5180, 0x4900, 0xff7a, 0xfef7, 0x4900, 0xdd8b, 0xdd8a, 0xee2e, 0xddab, 0xdd8b, 0xdd8b, 0xdd6a, 0xa3a5, 0xac07, 0xac07, 0x9b87, 0xe570, 0xed70, 0xe550, 0xe550, 0xe550, 0xe550, 0xe550, 0xe570, 0x2820, 0x38a0, 0x6a21, 0x6a40, 0x7a81, 0x7263, 0x38e0, 0x30c0, 0x3900, 0x4120, 0x4100, 0x4140, 0x4120, 0x4140, 0x9367, 0xfe95, 0xfef7, 0xfef7, 0xff7a, 0x5140, 0xdd8b, 0xdd8b, 0xdd8b, 0x38c0, 0xddab, 0xdd8b, 0xd56a, 0xdd8b, 0xddab, 0xdd8b, 0xdd8b, 0xd52a, 0xabe7, 0x51a1, 0xa3e7, 0x9ba6, 0x0841, 0x1926, 0x1966, 0x1926, 0x2167, 0x1946, 0x1946, 0x1926, 0x10e4, 0xb428, 0xa3e6, 0xac07, 0xa3c6, 0x8b24, 0xdd6a, 0xd56b, 0xdd8b, 0xdd6a, 0xdd6b, 0xdd6a, 0xdd6b, 0xdd8b, 0xdd8a, 0x7282, 0xdd6a, 0xd56a, 0xdd8b, 0xdd8b, 0x30c0, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef8, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef8, 0xbc8a, 0xac07, 0xa3e7, 0x8325, 0xbc88, 0x9bc6, 0xa3e7, 0xa3c6, 0xa3c6, 0xac07, 0xac07, 0x4960, 0xabe7, 0x38e0, 0xe570, 0xe571, 0xe570, 0xe570, 0xfed6, 0xff18, 0xfef8, 0xfef7, 0xff18, 0xfef7, 0xfef7, 0xfef7, 0xfed7, 0x2840, 0x59c0, 0xff17, 0xff5a, 0x7aa3, 0xdd8b, 0x59e0, 0xd56a, 0xdd6b, 0xdd8b, 0xd54a, 0xd52a, 0xdd6b, 0xa3e7, 0x38c0, 0xdd2f, 0xe52f, 0xe550, 0xe570, 0xe54f, 0xdd30, 0x2860, 0x5140, 0x7221, 0x7241, 0x38c0, 0x38c0, 0x5101, 0xfffd, 0xff17, 0xff18, 0xff18, 0xfef7, 0xff17, 0xfef7, 0xff17, 0xfef7, 0xfef7, 0xff39, 0xd591, 0x2020, 0xfef8, 0x40e0, 0xdd8b, 0xdd8b, 0xdd6a, 0x7261, 0xdd6b, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd8b, 0xcce9, 0xa3c6, 0x30a0, 0x9365, 0xa3c7, 0xa3c6, 0x0862, 0x1946, 0x2166, 0x1125, 0x1125, 0x1125, 0x1926, 0x1905, 0xb469, 0xa3c6, 0xabe7, 0xac07, 0x59c0, 0xdd8b, 0xdd6b, 0xa3c6, 0xdd8b, 0xdd6a, 0xdd8b, 0xdd6a, 0xd56a, 0xdd8b, 0xe5cc, 0xdd8b, 0xd58a, 0xdd6a, 0xd56a, 0x1820, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 
-    0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xffbc, 0xac07, 0xac07, 0xa3e7, 0x3900, 0xac07, 0xa3e7, 0xac07, 0xac07, 0xabe6, 0xac27, 0xabe7, 0x38e0, 0xa3c6, 0x30a0, 0xed70, 0xed70, 0xed91, 0xfef7, 0xfef7, 0xfef8, 0xff17, 0xfef7, 0xfef7, 0xff18, 0xff17, 0xfef7, 0xfef7, 0xff18, 0xa3c9, 0xff99, 0xff18, 0x5980, 0xdd6a, 0x6201, 0xdd6b, 0xdd8b, 0xddab, 0xdd8b, 0xcd09, 0xdd8a, 0xac07, 0x40e0, 0xfef7, 0xff17, 0xff38, 0xfed6, 0xf675, 0x4120, 0x7aa2, 0x6a41, 0x4120, 0x5982, 0xff18, 0xff18, 0xfef8, 0xfef8, 0xff18, 0xfef7, 0xfef7, 0xfef8, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0xfef7, 0xfef8, 0xff9a, 0xa3a8, 0xd52a, 0xdd6a, 0xdd6a, 0xa407, 0xdd8b, 0xdd6a, 0xdd8b, 0xdd8b, 0xdd6b, 0xdd8b, 0xdd6a, 0xc4e9, 0xa3e6, 0x30e0, 0x9ba6, 0xabe7, 0xa3c6, 0x20a0, 0x10c4, 0x1926, 0x1926, 0x1946, 0x1105, 0x1926, 0x1905, 0xb44a, 0xa3c6, 0xabe7, 0xa3e6, 0x59c0, 0xdd6a, 0xdd8b, 0x9b84, 0xdd6a, 0xdd8b, 0xdd6a, 0xdd6a, 0xdd6b, 0xdd6a, 0xdd6a, 0x9ba5, 0xdd6a, 0xdd6a, 0xd56a, 0x5180, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0x1860, 0xac27, 0xa3c6, 0xac07, 0x4141, 0xa407, 0x9365, 0xa3a6, 0xac07, 0xa3c6, 0xac07, 0xac07, 0x4120, 0xabe6, 0x7223, 0xed70, 0xe571, 0xff18, 0xfef7, 0xff17, 0xfef7, 0xfef7, 0xfef8, 0xff18, 0xfef8, 0xfef7, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xfef8, 0xee54, 0xe5cb, 0xe5cc, 0xd54a, 0xdd8b, 0xddab, 0xdd8a, 0xccc8, 0xe5ab, 0xb427, 0x4940, 0xff18, 0xff18, 0xff18, 0xff18, 0xdd90, 0x7281, 0x40e0, 0xddd1, 0xff18, 0xfef7, 0xfef7, 0xfef8, 0xff17, 0xfef7, 0xfef8, 0xff18, 0xfef7, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff17, 0xfef7, 0xff18, 0xfef8, 0xfef7, 0x6a00, 0xe5ab, 0xd54a, 0xcd2a, 0xdd6b, 0xe5ab, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd8b, 0xd56a, 0xa3e7, 0x30e0, 0x9ba6, 0x9ba6, 0xa3c6, 0xa3e6, 0x0881, 0x1946, 0x1926, 0x1946, 0x1946, 0x1926, 0x10e5, 0x82e4, 0xac07, 0xac07, 0xabe6, 0x7ac4, 0xdd8b, 0xdd8b, 0xdd8b, 0xd54a, 0xdd8b, 0xdd6a, 0xdd6a, 0xdd6a, 0xddab, 0xdd6b, 0xa3c6, 0xdd8b, 0xdd8b, 0xdd8b, 0xd56c, 0xffdd, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0x2880, 0xac27, 0xbc48, 0xac28, 0x0800, 0xac07, 0x8b45, 0xac07, 0xa3e6, 0xac07, 0xac07, 0xac07, 0x6a42, 0xb448, 0xf633, 0xe550, 0xff18, 0xfef7, 0xff18, 0xff17, 0xfef8, 0xfef7, 0xfef8, 0xfef8, 0xfef8, 0xfef7, 0xfef7, 0xff17, 0xff18, 0xfef7, 0xff17, 0xfef8, 0xff18, 0x40e0, 0xe5cc, 0x59c1, 0xdd6a, 0xdd8b, 0xdd8b, 0xd56a, 0xdd8b, 0xac07, 0x4900, 0xff18, 0xfef7, 0xff18, 0xfef7, 0x61c1, 0xfffc, 0xfef7, 0xff18, 0xfef7, 0xff17, 0xfef8, 0xfef7, 0xfef8, 0xfef7, 0xff18, 0xfef7, 0xff17, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xfef8, 0xfef7, 0xff18, 0xfef7, 0xff17, 0xfef7, 0xff18, 0xff79, 0xfe8f, 0xdd8b, 0xe5ec, 0xdd6b, 0xdd8b, 0xdd6a, 0xdd6a, 0xdd8a, 0xe5ab, 0xdd8b, 0xedec, 0xa3c6, 0x4120, 0x9385, 0xac08, 0x9386, 0x9364, 0xb428, 0x1061, 0x1926, 0x1925, 0x1926, 0x1925, 0x10c4, 0x6a41, 0xa3c6, 0xa3e6, 0xa3c6, 0x9ba6, 0xd54a, 0xdd6a, 0xddab, 0xe5ac, 0xdd8b, 0xdd6b, 0xdd6a, 0xd54a, 0xd56a, 0xdd8b, 0xbc89, 0xc4c8, 0xdd8b, 0xdd6a, 0xf66f, 0xf77a, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0x3900, 0xa3e6, 0xb448, 0x30a0, 0x0800, 0xbc89, 0x8b24, 0xabe6, 0xcd09, 0xa3e6, 0xd56a, 0xc4c9, 0x8304, 0xac28, 0xed91, 0xedb1, 0xfef7, 0xfef7, 0xfef8, 0xff18, 0xfef7, 0xfef8, 0xff18, 0xfffd, 0x6204, 0x7aa6, 0xff18, 0xff18, 0xfef8, 0xfef8, 0xff18, 0xff18, 0xff18, 0x4920, 0xddac, 0xa3e8, 0xdd8b, 0xe5ab, 0xdd8b, 0xdd6b, 0xdd8b, 0xa3e6, 0x40a0, 0xff17, 0xfef8, 0xfef7, 0xfef8, 0xff9b, 0xff18, 0xff18, 0xff17, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff17, 0xfef7, 0xfef8, 0xfef7, 0xff18, 0xfef8, 0x5160, 0xd54a, 0xf64e, 0xdd8b, 0xddab, 0xdd8b, 0xdd6a, 0xdd8b, 0xdd6a, 0xdd8b, 0xe5ac, 0xc4ea, 0x7ac4, 0x61e1, 0x1880, 0x0841, 0x0842, 0x0862, 0x0842, 0x2167, 0x1946, 0x1946, 0x1926, 0x0882, 0x7ae3, 0xac07, 0xa3e6, 0xa3e6, 0xb448, 0xdd6b, 0xdd8b, 0xdd6a, 0xc4a8, 0xdd6a, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd6a, 0xdd6b, 0xddab, 0xa3c6, 0xdd6a, 0xdd6a, 0xd54a, 0x49e3, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef8, 0x30a0, 0xac07, 0xb428, 0x2880, 0x5a86, 0xbcaa, 0xac08, 0xddac, 0xe5ab, 0xbca8, 0xdd6a, 0xc4a8, 0x8b45, 0xbc6a, 0xf5f3, 0xf634, 0xfef7, 0xfef7, 0xfef8, 0xffbc, 0xee95, 0x2880, 0xf739, 0xff18, 0xfef7, 0xff18, 0xff39, 0x1820, 0xff18, 0xfef8, 0xff18, 0xff18, 0xff18, 0xfef7, 0x40c0, 0xb426, 0xfe90, 0xdd8b, 0xddab, 0xdd8b, 0xdd6b, 0xac07, 0x50e0, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef8, 0xfef8, 0xff18, 0xfef7, 0xff18, 0xfef8, 0xff18, 0xff18, 0xfef7, 0xfef8, 0xff17, 0xfef8, 0xff18, 0xfef8, 0xfef7, 0xfef8, 0xff18, 0xff18, 0xfef7, 0xfef8, 0xfef8, 0xff18, 0xff18, 0xfef7, 0xff18, 0x92e5, 0xd509, 0xf66f, 0xd54a, 0xddab, 0xdd8b, 0xe5ab, 0xdd8b, 0xdd8b, 0x9ba5, 0x9ba5, 0x4940, 0x1040, 0x0883, 0x2a0a, 0x322b, 0x322b, 0x2a0b, 0x29ea, 0x10c4, 0x0841, 0x1926, 0x1105, 0x0861, 0xb428, 0xa3e7, 0xa3e6, 0xabe6, 0xac07, 0xe5ab, 0xdd8b, 0xdd8b, 0xbc87, 0xdd6b, 0xddab, 0xdd6a, 0xdd8b, 0xdd6a, 0xdd6a, 0xd54a, 0x6a41, 0xdd8b, 0xdd6a, 0xdd4a, 0x1000, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 
-    0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0x30c0, 0xa3e6, 0xb428, 0x1020, 0xde96, 0x6a43, 0xb469, 0xcd2a, 0xd56a, 0xcd29, 0xdd6a, 0xcd09, 0x6a22, 0xb449, 0xedf2, 0xfed7, 0xfef7, 0xff18, 0xffdc, 0x28c0, 0x28c0, 0x30e1, 0x20a0, 0x2080, 0x28a0, 0xcd10, 0xfef7, 0xfef8, 0x5982, 0xff18, 0xff18, 0xfef7, 0xff18, 0xfef7, 0x9b68, 0xdd6a, 0x38e0, 0xe5ab, 0xdd8b, 0xdd8b, 0xdd8b, 0xac07, 0x5120, 0xff18, 0xff18, 0xff18, 0xff17, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef7, 0xff18, 0xfef8, 0xfef8, 0xfef8, 0xff18, 0xff18, 0xff18, 0xfef8, 0xfef8, 0xfef7, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xff17, 0xfef7, 0xff17, 0xfef8, 0xfef7, 0xff18, 0xbc69, 0xc4ca, 0xd56b, 0xdd6a, 0xdd6a, 0xdd8b, 0xdd6a, 0xdd6b, 0xcd09, 0xa3c6, 0x30c0, 0x29e9, 0x2a0b, 0x322b, 0x2a0a, 0x29ca, 0x322b, 0x29ea, 0x2a0a, 0x2187, 0x10a3, 0x1105, 0x1041, 0xac07, 0xbcaa, 0xa3c6, 0xb428, 0xb448, 0xdd6b, 0xdd8b, 0xdd6a, 0xe5ab, 0xddab, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd8b, 0xd54a, 0xdd6b, 0xc4c9, 0xbc88, 0xdd6a, 0xdd8b, 0x3900, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0x3080, 0xa3a6, 0xabe6, 0x3101, 0xffdd, 0x2860, 0xabe6, 0xa3c5, 0xdd6a, 0xdd6a, 0xdd6a, 0xddac, 0x4120, 0xb489, 0xf5f2, 0xfef7, 0xfef7, 0xfffc, 0x28a0, 0x2080, 0x2080, 0x28a0, 0x20a0, 0x2080, 0x3101, 0x28c1, 0x2860, 0xff5b, 0xfef8, 0xff18, 0xff17, 0xff18, 0xfef8, 0xff18, 0xff18, 0x38c0, 0xbc69, 0x9ba6, 0xdd6a, 0xdd6a, 0xdd6b, 0xd54a, 0x40c0, 0xfef7, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0xfef8, 0xfef7, 0xfef7, 0xff18, 0xff18, 0xfef8, 0xfef7, 0xfef8, 0xff18, 0xfef8, 0xfef8, 0xfef7, 0xfef7, 0xff18, 0xfef7, 0xfef7, 0xff18, 0xfef7, 0xff18, 0xfef7, 0xfef7, 0xff18, 0xff18, 0xfef7, 0x59a0, 0x9345, 0xdd6b, 0xdd8b, 0xdd6a, 0xdd6a, 0xd54a, 0xdd8b, 0xe5ac, 0xac07, 0x3921, 0x2a0b, 0x29ea, 0x2a0b, 0x322b, 0x29ea, 0x2a0b, 0x3a6c, 0x3a6b, 0x29ea, 0x0882, 0x1905, 0x0820, 0xa3c6, 0x6a21, 0xa3e6, 0xa3a6, 0xac28, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd6a, 0xdd6b, 0xdd8b, 0xdd6a, 0xdd8b, 0xd56a, 0xdd8b, 0xdd8b, 0xdd8b, 0xa3e6, 0xdd8b, 0xdd6b, 0x3900, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef39, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0x38e0, 0xb428, 0xac27, 0x7328, 0xe6d8, 0x3900, 0xac27, 0xac07, 0xdd8b, 0xdd8b, 0xdd6b, 0xe5cc, 0x2880, 0xbcaa, 0xedd2, 0xff18, 0xff18, 0x28a0, 0x20a0, 0x0000, 0xe698, 0xe698, 0xeeb8, 0xffbd, 0x2080, 0x20a0, 0x2080, 0x4184, 0x1000, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xff9b, 0xc4ea, 0x9b88, 0xe5cc, 0xdd8b, 0xdd8b, 0xdd8b, 0x3880, 0xfef7, 0xff18, 0xff17, 0xff18, 0xfef8, 0xfef8, 0xff18, 0xff18, 0xff17, 0xff18, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef7, 0xff18, 0xfef8, 0xff18, 0xfef7, 0xff18, 0xff17, 0xfef8, 0xff18, 0xff18, 0xfef8, 0xfef7, 0xffbb, 0x7a84, 0xdd8a, 0xdd8b, 0xdd8b, 0xdd8b, 0xe5ab, 0xd54a, 0x9b85, 0xb469, 0x3a29, 0x322b, 0x2a0a, 0x322b, 0x324b, 0x0862, 0x4b91, 0x4bd3, 0x4371, 0x08a4, 0x0883, 0x0862, 0xabe6, 0xa3e6, 0x7ac3, 0xabe7, 0xa3c6, 0xac07, 0xdd8b, 0xdd6a, 0xdd8b, 0xdd8b, 0xd52a, 0xdd6b, 0xd54a, 0xd56a, 0xdd6b, 0xdd8b, 0xdd6a, 0xddab, 0x9365, 0xddac, 0xd54a, 0x38e0, 0xe6d8, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef8, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0x3900, 0xa3c6, 0xcce9, 0xa4ae, 0xeef9, 0x28a0, 0xac07, 0xabe7, 0xdd6a, 0xdd6a, 0xdd6a, 0xdd8b, 0x30c0, 0xbc8a, 0xedd2, 0xff18, 0x0800, 0x20a0, 0x1840, 0xe698, 0xe698, 0xee98, 0xeeb8, 0x0800, 0x2080, 0x20a0, 0x2080, 0x2080, 0x1860, 0x0820, 0xfef7, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0x38c0, 0xff38, 0x59c0, 0xdd8b, 0xdd6b, 0xd54b, 0x3080, 0xff17, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xff18, 0xff17, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff17, 0xffdc, 0xc48d, 0x7224, 0xd50f, 0xff18, 0xff18, 0xff18, 0xff17, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef7, 0xff17, 0xff18, 0x3060, 0xdd8b, 0xdd8b, 0xdd6b, 0xdd6a, 0xdd8b, 0xc4a8, 0xabc6, 0x30c0, 0x29ea, 0x2a2b, 0x29ca, 0x320a, 0x0883, 0x43f5, 0x4c97, 0x3b51, 0x19a9, 0x2a4c, 0x0883, 0xa40a, 0xabe7, 0xac07, 0xb469, 0xabe6, 0xabe7, 0xa3e7, 0xdd8b, 0xdd8b, 0xdd8b, 0xd54a, 0xd54a, 0xdd6b, 0xdd6b, 0xd56a, 0xdd6b, 0xdd6a, 0xd56a, 0xd56a, 0x82e2, 0xa3c6, 0xdd8b, 0x2040, 0xff9c, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 
-    0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0x1000, 0xa3c6, 0xdd6b, 0xa48e, 0xef19, 0xd636, 0xcd2c, 0x9365, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd8b, 0x6201, 0xc4ea, 0xf614, 0xff18, 0x0000, 0x28a0, 0xffbc, 0xe678, 0xeed9, 0xffbd, 0xffdd, 0x20a0, 0x20a0, 0x2080, 0x0000, 0xffde, 0xffff, 0x28a0, 0x2040, 0xff18, 0xfef8, 0xfef7, 0xff18, 0xff18, 0xfef7, 0x3880, 0xff18, 0x38e0, 0xe5ed, 0xbc88, 0x3880, 0xfef8, 0xff18, 0xfef8, 0xff18, 0xfef8, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xfef7, 0x69e3, 0xee55, 0xfef7, 0xff18, 0xff18, 0xff17, 0xfef7, 0xfef7, 0xff17, 0xff18, 0xff18, 0xff18, 0xfef8, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef8, 0xfef8, 0xfef8, 0xfef7, 0x2820, 0xdd8b, 0xdd6a, 0xdd6a, 0xdd8b, 0xe5ab, 0xdd8c, 0xbcca, 0x41a4, 0x29ea, 0x322b, 0x320b, 0x08a4, 0x4436, 0x4cda, 0x4bb2, 0x4b91, 0x3aee, 0x32ce, 0x53b1, 0x1840, 0xac07, 0xa3e6, 0xa3c6, 0xabe7, 0xac27, 0xa3e7, 0xd52a, 0xdd8b, 0xd56a, 0xdd6a, 0xd54a, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd6a, 0xdd8b, 0xdd6a, 0xdd6b, 0xac07, 0xdd8b, 0x9386, 0xe676, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xffde, 0xb448, 0xdd6b, 0x5205, 0xeef9, 0xeef9, 0x2060, 0xac07, 0xd54a, 0xdd8b, 0xd54a, 0xdd6a, 0xa3c7, 0xcceb, 0xbc8e, 0xff18, 0x1040, 0x28a0, 0xf71a, 0xff9c, 0xff9d, 0xff9c, 0xff9c, 0x28c0, 0x28c0, 0x28a0, 0xffde, 0xffde, 0xffff, 0x2080, 0x6245, 0xff59, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff17, 0x2040, 0xdd6a, 0xd54c, 0xff18, 0xff18, 0xfef8, 0xff18, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff18, 0x2840, 0xff38, 0xff18, 0xfef8, 0xff18, 0xff18, 0xee55, 0x0800, 0x0800, 0x0800, 0x5143, 0xfffc, 0xfed7, 0xfef7, 0xfffd, 0x2000, 0xfef8, 0xfef7, 0xfef7, 0xfef8, 0xff18, 0xfef7, 0x38c0, 0xdd8b, 0xdd6a, 0xdd8b, 0xdd6b, 0xac06, 0xa3e6, 0x3900, 0x29ea, 0x2a0a, 0x322b, 0x29e9, 0x3c36, 0x4cd9, 0x5cd9, 0x4bb2, 0x4b91, 0x53f3, 0x2a6c, 0x4bd3, 0x0862, 0xac07, 0xa3c6, 0xabe7, 0xac27, 0xac07, 0xa3c6, 0xcce9, 0xdd6b, 0xdd6a, 0xdd6a, 0xd56a, 0xdd6a, 0xdd8b, 0xdd8b, 0xdd6b, 0xd52a, 0xd54a, 0xd54a, 0xdd8b, 0x6a41, 0xabe6, 0xfeb0, 0x20a0, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 
-    0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xf719, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeed8, 0x6a22, 0xb427, 0x0800, 0xef19, 0xef19, 0x3900, 0xb427, 0xddab, 0xe5ab, 0xdd8b, 0xdd8b, 0xbc88, 0xbc89, 0x30a0, 0xff18, 0x2880, 0x2080, 0xffbd, 0xff9c, 0xff9d, 0xff9c, 0xff9c, 0x28e0, 0x30e0, 0x2080, 0x0000, 0xfffe, 0xffff, 0x28a0, 0xffff, 0xff3a, 0xff18, 0xff18, 0xfef7, 0xff18, 0xfef7, 0xff18, 0xfef8, 0xfef8, 0xff17, 0x7223, 0xf64f, 0xfef8, 0xff18, 0xfef7, 0xfef7, 0xff18, 0xfef7, 0xfef8, 0xfef8, 0xfef7, 0xff17, 0xff18, 0xff17, 0xa3ab, 0x28c1, 0x2080, 0x2880, 0x28a0, 0x28a0, 0x20a0, 0x2080, 0x2080, 0x30e0, 0x30c0, 0x1000, 0xff38, 0xfef7, 0xff18, 0xfef8, 0xff18, 0xff18, 0xfef7, 0x5120, 0xdd8b, 0xdd8b, 0xdd6b, 0xe5ab, 0xdd8b, 0xabe7, 0x5226, 0x2a0a, 0x2a0a, 0x322b, 0x0042, 0x4cda, 0x4cd9, 0x32ef, 0x4b70, 0x0862, 0x0021, 0x4371, 0x53f3, 0x0021, 0xbc8a, 0xa3c6, 0xa3c6, 0x9365, 0xac07, 0xa3c6, 0xb447, 0xdd8b, 0xdd8b, 0xdd6a, 0xdd8b, 0xd56a, 0xdd6a, 0xdd6a, 0xdd6a, 0xdd8b, 0xdd8b, 0xdd6a, 0xd54a, 0xbca9, 0xac07, 0xe5ab, 0x2880, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0x4140, 0xb447, 0x2880, 0xef19, 0xef19, 0xffde, 0x2060, 0xcce9, 0xc4e8, 0xdd8b, 0xdd8a, 0xdd8b, 0xdd8e, 0x30c0, 0xfef7, 0x1000, 0x28a0, 0xff9c, 0xff9c, 0xff9c, 0xff9c, 0xff9d, 0x3920, 0x3100, 0x2080, 0x2080, 0x0800, 0x30a0, 0x30c0, 0x0000, 0xffbd, 0xff18, 0xff17, 0xfef8, 0xff18, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff59, 0xfef7, 0xff59, 0x2880, 0x28a0, 0x28a0, 0x28c0, 0x20a0, 0x2080, 0x2080, 0x2080, 0x20a0, 0x2080, 0x30e1, 0x28c0, 0x20a0, 0x0800, 0xff7b, 0xff18, 0xff17, 0xff18, 0xfef8, 0xfef8, 0xff18, 0x40e0, 0xdd8b, 0xdd8b, 0xdd8a, 0xdd8b, 0xa3c6, 0x38e0, 0x2a0a, 0x2a0a, 0x2a0a, 0x0883, 0x3bf5, 0x4cb9, 0x2acf, 0x0042, 0x3a8c, 0x2a0a, 0x3a6c, 0x21a8, 0x224c, 0x1968, 0x72a5, 0xac07, 0xabe6, 0x59c0, 0xa3e6, 0xac07, 0xac06, 0xdd8b, 0xdd8b, 0xddab, 0xdd8b, 0xdd8b, 0xdd6a, 0xdd8a, 0xdd6b, 0xdd8b, 0xd54a, 0xdd8b, 0xdd8a, 0xd54a, 0xb468, 0xdd6b, 0x4120, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xe6b6, 0xbc89, 0x38e0, 0xef19, 0xef19, 0xeef9, 0x30c0, 0xac07, 0xddab, 0xd56a, 0xdd8b, 0xdd8b, 0x7263, 0x28a0, 0xffbc, 0xf696, 0x0800, 0xff9d, 0xff9d, 0xffbd, 0xff9c, 0xffbc, 0x3900, 0x51a2, 0x28c0, 0x2080, 0x2080, 0x1020, 0x6266, 0x1880, 0xffbd, 0xff18, 0xff18, 0xff18, 0xff17, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff17, 0xff18, 0xfef8, 0xfef8, 0xfef8, 0xff18, 0xff17, 0xff18, 0xff18, 0x7265, 0x2060, 0x3902, 0x28a0, 0x2080, 0x5163, 0xfffd, 0xff59, 0xfed7, 0xfed6, 0xfef7, 0xfffc, 0x1800, 0x2080, 0x2880, 0x4163, 0x28a0, 0x30e1, 0x3080, 0xff18, 0xff18, 0xfef7, 0xf6f7, 0x38c0, 0xdd8b, 0xddab, 0xdd8b, 0xd54a, 0x7284, 0x3a29, 0x29ea, 0x2a0a, 0x322b, 0x0084, 0x54fa, 0x4c99, 0x08c6, 0x3a4b, 0x29ea, 0x2a0b, 0x322b, 0x0041, 0x0107, 0x328d, 0x59e2, 0xa3e6, 0xa3c6, 0x8b45, 0xac07, 0xa3c6, 0xa3c6, 0xdd6b, 0xd56a, 0xdd6a, 0xddab, 0xdd8b, 0xdd6a, 0xdd8b, 0xdd8b, 0xd529, 0xdd8b, 0xdd8b, 0xdd8b, 0xd54a, 0x5980, 0xabe6, 0x30c0, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xf719, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0x38e0, 0x38e0, 0xe6f8, 0xeef9, 0xeef9, 0xf719, 0x2860, 0xdd8b, 0xdd8b, 0xddab, 0xdd6b, 0x30c0, 0xb449, 0x1800, 0xff17, 0xffdc, 0xffff, 0xff9d, 0xffbd, 0xff9c, 0xff9d, 0x28a0, 0x3900, 0x3100, 0x30e0, 0x30e0, 0x3100, 0x59e2, 0x30c0, 0xffbd, 0xff17, 0xfef7, 0xfef7, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef8, 0xfef8, 0xfef7, 0xff18, 0xff18, 0xff18, 0xff18, 0xff17, 0xff18, 0xff18, 0xb44d, 0x4140, 0x1800, 0xff7a, 0xff17, 0xff17, 0xff18, 0xfef7, 0xfef8, 0xff18, 0xfef7, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef7, 0xee55, 0xee57, 0xff59, 0xff18, 0xff18, 0xfef7, 0xff18, 0xffdc, 0xd56c, 0xe5ab, 0xdd8b, 0xddab, 0xa427, 0x4206, 0x2a0a, 0x2a0a, 0x29ea, 0x0883, 0x3bf6, 0x4cd9, 0x3b72, 0x1946, 0x29ea, 0x29ea, 0x2a0b, 0x2a0a, 0x0882, 0x19eb, 0x328d, 0x7ac5, 0xac07, 0xabe6, 0xb448, 0xabe6, 0xabe7, 0xa3c5, 0xdd8b, 0xd56a, 0xdd6a, 0xdd8b, 0xdd8b, 0xdd8b, 0xd54a, 0xdd6a, 0xdd6a, 0xdd8b, 0xdd8a, 0xdd6b, 0xdd8b, 0xeded, 0xa3c6, 0x38c0, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xffbc, 0xe5ef, 0xfffe, 0xef19, 0xef19, 0xef19, 0x0800, 0xf66f, 0xdd8b, 0xdd8b, 0xddab, 0x6222, 0xabe7, 0x4100, 0xfef7, 0xfed6, 0xeef9, 0xff9c, 0xff9d, 0xff9d, 0xff9d, 0x1840, 0x4960, 0x51c2, 0x3920, 0x3900, 0x4140, 0x82e6, 0x4120, 0xff9c, 0xfef8, 0xff18, 0xff18, 0xfef7, 0xff18, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xfef8, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff38, 0xfef8, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff59, 0xff18, 0xff18, 0xff18, 0xff17, 0xee35, 0xee0d, 0xe5ab, 0xdd8b, 0xd56a, 0x4120, 0x29c9, 0x2a0a, 0x29ca, 0x322b, 0x0042, 0x4c99, 0x4cd9, 0x08c4, 0x2a0a, 0x29ea, 0x322b, 0x2a0b, 0x29ca, 0x0021, 0x0969, 0x1988, 0x3920, 0xa3c6, 0xabe7, 0xa3c6, 0xabe6, 0xac07, 0xa3a6, 0xdd6b, 0xdd8b, 0xdd6a, 0xdd6b, 0xdd8b, 0xdd6a, 0xdd6b, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd6b, 0xdd6a, 0xdd8b, 0xdd6a, 0xac28, 0xbc89, 0xffde, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0x3942, 0x1860, 0xeef9, 0xef19, 0xef19, 0xeef9, 0x3920, 0xdd8b, 0xdd8b, 0xe5ab, 0xf66e, 0xc4eb, 0x38c0, 0xfed6, 0xfef7, 0xfef8, 0xff9c, 0xff9c, 0xff9d, 0xff9c, 0xffff, 0x6a64, 0x59c1, 0x4140, 0x5180, 0x4960, 0xc510, 0x2880, 0xff19, 0xfef8, 0xfef7, 0xff18, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xff17, 0xfef8, 0xff18, 0xfef8, 0xfef7, 0xff18, 0xff17, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xff17, 0xfef8, 0xff17, 0xfef8, 0xfef8, 0xfef8, 0xfef7, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef7, 0xff18, 0xfef7, 0xfef7, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0x3880, 0xdd8b, 0xdd6b, 0xe58b, 0x3080, 0x29e9, 0x322b, 0x2a0a, 0x2a0b, 0x3a4c, 0x5477, 0x4cb9, 0x4cb9, 0x0883, 0x2a0a, 0x2a0a, 0x322b, 0x2a2b, 0x322b, 0x0062, 0x2a8e, 0x0042, 0x38e0, 0x9ba5, 0xac07, 0xa3c6, 0xb448, 0xa3c6, 0xa3c6, 0xdd8b, 0xdd8b, 0xdd6b, 0xdd8b, 0xdd8b, 0xdd6b, 0xdd8b, 0xdd6b, 0xdd6a, 0xdd8b, 0xddab, 0xdd6b, 0xd56a, 0xdd8b, 0x59a0, 0xb468, 0x3942, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef18, 0xfffd, 0xeef8, 0xeef9, 0xef19, 0xef19, 0xeef8, 0x3900, 0xddab, 0xe5ab, 0xdd8b, 0x3900, 0xa3e8, 0xfffc, 0xff18, 0xfef7, 0xff5b, 0xff9d, 0xff9c, 0xff7c, 0xff9c, 0x1820, 0x6a22, 0x9ba8, 0xcd2f, 0xe654, 0xe634, 0x30c1, 0xfef7, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xfef8, 0xff18, 0xff18, 0xfef7, 0xff18, 0xfef8, 0xfef7, 0xff18, 0xfef8, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff17, 0xff18, 0xfef7, 0xfef8, 0xff17, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0xfef7, 0xfef8, 0xfef8, 0xff18, 0x5980, 0xdd8b, 0xddab, 0x30a0, 0x20a0, 0x320a, 0x322b, 0x29ea, 0x322b, 0x08a3, 0x4477, 0x4cd9, 0x4bd3, 0x322b, 0x2a0a, 0x21c9, 0x322b, 0x29ea, 0x322b, 0x4bb2, 0x4c15, 0x0042, 0x2040, 0xa3a6, 0xa3e6, 0xac07, 0x9386, 0xa3c6, 0xa3c5, 0xdd8b, 0xdd8b, 0xdd6a, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd6b, 0xdd6a, 0xdd8b, 0xdd8b, 0xd56a, 0xe5ab, 0xd56a, 0xdd6a, 0xddab, 0xb428, 0x30e0, 0xef19, 0xeef9, 0xef19, 0xf739, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xf75a, 0x2880, 0xe5ab, 0xdd8b, 0xddad, 0xb44a, 0x7a65, 0xfef7, 0xfef8, 0xfef7, 0xff5a, 0xff7c, 0xff9c, 0xff9c, 0xfffe, 0x7263, 0x8b25, 0xc50e, 0xddb2, 0x7aa4, 0xff5a, 0xff18, 0xff18, 0xfef8, 0xfef8, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff17, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0xfef8, 0xfef8, 0xff18, 0xfef8, 0xfef7, 0xff18, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef8, 0xff18, 0xfed7, 0x7aa2, 0xe5cc, 0x9ba6, 0x28c0, 0x3a2a, 0x2a0a, 0x2a0a, 0x29ea, 0x2a0a, 0x0842, 0x4c99, 0x4cd9, 0x1126, 0x2a0b, 0x2a0a, 0x29ea, 0x21ca, 0x2a0a, 0x1906, 0x4c14, 0x43d4, 0x0020, 0x1800, 0xac07, 0xac07, 0xac07, 0x6a21, 0xac07, 0x9bc6, 0xd56a, 0xd56a, 0xdd6b, 0xdd8b, 0xdd8b, 0xd54a, 0xdd6a, 0xdd6b, 0xdd6b, 0xdd6a, 0xd56a, 0xdd8b, 0xdd6b, 0xdd8b, 0xdd8b, 0x59e0, 0x30e0, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0x30e0, 0xd56b, 0xd56b, 0x3080, 0x1800, 0xfef7, 0xfef8, 0xff18, 0xfef7, 0xfef7, 0xff19, 0xff7c, 0xff7c, 0xffde, 0x2020, 0x1000, 0xbcae, 0xff39, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef8, 0xfef7, 0xff17, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef7, 0xff18, 0xfef7, 0xfef8, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xff18, 0xfef7, 0xff18, 0xfef8, 0xff17, 0xff18, 0xff18, 0xfef7, 0xff18, 0xfef7, 0xfef7, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xdd4a, 0x4920, 0xee54, 0x1062, 0x2a0b, 0x29ea, 0x2a0b, 0x324b, 0x29ea, 0x1968, 0x4cb9, 0x4cd9, 0x0882, 0x2a0a, 0x29ea, 0x2a0a, 0x2a0a, 0x29c9, 0x0062, 0x3310, 0x6476, 0xad12, 0xe6f8, 0xa3a6, 0xac27, 0xabe7, 0x59c0, 0xa3e6, 0xac07, 0xdd6b, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd6a, 0xd56a, 0xdd6b, 0xdd8b, 0xdd6a, 0xdd6a, 0xdd8b, 0xd56a, 0xdd8b, 0xe5ab, 0xdd8b, 0xee0d, 0x4940, 0xfffe, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0x0800, 0x2880, 0xe5cd, 0xc4c8, 0x38c0, 0xff18, 0xfef8, 0xff18, 0xff17, 0xff18, 0xff18, 0xff18, 0xff18, 0xff17, 0xfef7, 0xff17, 0xfef7, 0xfef8, 0xff18, 0xff18, 0xfef8, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef8, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef8, 0xff18, 0xff18, 0xff17, 0xff17, 0xfef7, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef7, 0xff17, 0xfef7, 0xfef7, 0xff18, 0xff18, 0xfef8, 0xff18, 0xfef8, 0xff18, 0xff18, 0xff18, 0x38a0, 0x40e0, 0xe5f3, 0xff19, 0x0861, 0x322b, 0x322b, 0x322b, 0x29e9, 0x3a6b, 0x6496, 0x4cb9, 0x3bb4, 0x0041, 0x29e9, 0x29ea, 0x29e9, 0x29c9, 0x29a8, 0x53f3, 0x5477, 0x0041, 0xeef9, 0xffbd, 0xbcaa, 0xabe7, 0xa3e6, 0x7aa3, 0x9ba5, 0xa3e6, 0xdd8b, 0xddab, 0xdd8b, 0xdd8b, 0xdd6b, 0xdd8b, 0xdd8a, 0xdd8b, 0xdd8b, 0xdd8b, 0xddab, 0xdd8b, 0xdd6a, 0xddab, 0xdd8b, 0xddab, 0xd54c, 0x1020, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0x0800, 0xa3e6, 0xb48a, 0x5180, 0x38e0, 0xfed7, 0xfef8, 0xff18, 0xfef7, 0xff18, 0xfef7, 0xfef8, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff17, 0xfef7, 0xff17, 0xfef8, 0xff18, 0xfef7, 0xff18, 0xfef8, 0xff18, 0xff17, 0xff18, 0xff17, 0xff18, 0xff17, 0xff18, 0xfef7, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xff18, 0xff17, 0xfef7, 0xff18, 0xfef8, 0xff18, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff17, 0xfef8, 0xff18, 0xff18, 0xfef7, 0xfef8, 0xfed7, 0x9ba7, 0xfffd, 0xfed7, 0x7223, 0x0041, 0x322b, 0x2a0a, 0x2a0a, 0x1968, 0x31e9, 0x4c77, 0x4cd9, 0x3b10, 0x1926, 0x320a, 0x2188, 0x21a8, 0x29e9, 0x0841, 0x6d39, 0x4c98, 0x0000, 0xef19, 0xef19, 0x8b24, 0xabe6, 0xac07, 0x9bc6, 0xabe7, 0xa3e6, 0xddab, 0xd54a, 0xdd6a, 0xddab, 0xdd6b, 0xe5ac, 0xd56a, 0xdd6a, 0xdd8b, 0xdd8b, 0xdd6b, 0xdd6b, 0xbca8, 0xd54a, 0xd54a, 0xdd8b, 0x59c0, 0x3900, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 
-    0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0x1820, 0xac07, 0xa3c6, 0x9b85, 0x59c1, 0xffdc, 0xff18, 0xff18, 0xff18, 0xfef8, 0xfef7, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff39, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff17, 0xfef7, 0xff18, 0xfef8, 0xff18, 0xfef8, 0xff17, 0xfef7, 0xff18, 0xfef8, 0xfef7, 0xff17, 0xfef7, 0xfef7, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xfef8, 0xfef7, 0xfef7, 0xfef8, 0xfef8, 0xff18, 0xff18, 0xfef8, 0x2000, 0xfef7, 0xfef8, 0xfef7, 0x1000, 0x1926, 0x29ea, 0x29c9, 0x2188, 0x21a8, 0x10e5, 0x4457, 0x4cfa, 0x19c9, 0x29c8, 0x2188, 0x29c9, 0x29c9, 0x1926, 0x1106, 0x5cf9, 0x6d18, 0xffdd, 0xeef8, 0xeef9, 0x4140, 0xabe6, 0xa3a5, 0xb448, 0xac27, 0xa3e7, 0xdd8b, 0xdd6b, 0xdd6a, 0xdd8b, 0xdd6b, 0xdd8b, 0xdd8b, 0xd56a, 0xdd6a, 0xe58b, 0xd54a, 0xdd8b, 0xd52a, 0xdd6a, 0xdd6a, 0xdd8b, 0xdd6b, 0x7aa4, 0xffde, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0x30c0, 0xac07, 0xb448, 0xa3a6, 0xb429, 0xbcad, 0xfef8, 0xff17, 0xff17, 0xff18, 0xff17, 0xff18, 0xfef8, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xff17, 0xfef8, 0xff18, 0xfef7, 0xff17, 0xfeb6, 0xfef7, 0xfef7, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0xfef8, 0xfef7, 0xff18, 0xfef7, 0xff18, 0xff17, 0xfef8, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff17, 0xfef7, 0xff18, 0xff18, 0xff18, 0xff17, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef8, 0xfef8, 0xff18, 0xfef8, 0xff18, 0xfef8, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0x30c0, 0x29c8, 0x29c9, 0x21a8, 0x1967, 0x1967, 0x08a3, 0x4c97, 0x4cfa, 0x19a9, 0x2187, 0x21a8, 0x2188, 0x2187, 0x0841, 0x5434, 0x4498, 0x10a3, 0xeef9, 0xef19, 0xeef9, 0x30a0, 0xb428, 0xa3e6, 0xac07, 0xb448, 0xabe6, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd6b, 0xdd6a, 0xd56a, 0xdd6a, 0xd56a, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd6a, 0xcd29, 0xdd6b, 0xdd8a, 0xdd6b, 0x5180, 0x0800, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0x4140, 0xa3c6, 0xa3c6, 0xa3e7, 0xac07, 0x1800, 0xfef7, 0xfef7, 0xfef8, 0xff18, 0xfef7, 0xfef8, 0xfef8, 0xfef7, 0xfef8, 0xff17, 0xfef7, 0xfef7, 0xfef8, 0xfef7, 0xff17, 0xfef8, 0x2840, 0xff18, 0xfef7, 0xfef7, 0xfef7, 0xff18, 0xfef7, 0xfef8, 0xfef8, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0xfef8, 0xff18, 0xfef8, 0xff18, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff17, 0xff18, 0xfef8, 0xfef7, 0xfef7, 0xfef8, 0xfef8, 0xfef8, 0xfef7, 0xff18, 0xff18, 0xfef8, 0xff18, 0xfef8, 0xfef8, 0xff18, 0xfef8, 0xa42d, 0x29a8, 0x2167, 0x29a8, 0x21a8, 0x2187, 0x0883, 0x4436, 0x4cfb, 0x53d2, 0x1946, 0x1967, 0x1967, 0x0041, 0x4bd3, 0x3b72, 0x00c6, 0xfffe, 0xef19, 0xeef9, 0xef19, 0x38e0, 0xac07, 0xac07, 0xa3e6, 0xbc69, 0xac07, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd8b, 0xcce9, 0xdd6a, 0xdd8b, 0xdd6b, 0xdd8b, 0xd54a, 0xdd8b, 0xdd6b, 0xdd8b, 0xa3c6, 0xdd8b, 0xe5ab, 0xdd8b, 0xd54a, 0x3900, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 
-    0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0x30e0, 0xa3e6, 0xabe6, 0xa3c6, 0xa3e7, 0x4100, 0xff18, 0xff18, 0xfef8, 0xff18, 0xfef8, 0xfef7, 0xfef8, 0xff18, 0xfef8, 0xfef7, 0xfef8, 0xff18, 0xfef8, 0xfef8, 0xff18, 0xfe33, 0xff79, 0xff18, 0xfef8, 0xfef7, 0xfef8, 0xfef7, 0xfef8, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xfef7, 0xff18, 0xfef8, 0xfef8, 0xfef8, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xfef8, 0xfef8, 0xfef7, 0xff18, 0xfef8, 0xff18, 0xfef8, 0xfef7, 0xff18, 0xfef8, 0xfef8, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef8, 0xc532, 0x21a8, 0x29a8, 0x1946, 0x1947, 0x1946, 0x2146, 0x3393, 0x553c, 0x3b51, 0x0882, 0x0882, 0x0883, 0x4350, 0x4b70, 0x4c35, 0x0000, 0xef19, 0xeef9, 0xef19, 0xef19, 0x3900, 0xabe6, 0xa3e6, 0xac07, 0xbc8a, 0xa3c6, 0xdd8b, 0xd56a, 0xdd6b, 0xdd6a, 0xb447, 0xe5ab, 0xd54a, 0xe5ab, 0xdd6a, 0xdd6b, 0xdd6a, 0xdd8a, 0xd54a, 0xbc68, 0xdd8b, 0xd56a, 0xdd8b, 0xdd8b, 0x4940, 0xffbd, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeed8, 0x28a0, 0xabe7, 0xa3c6, 0xa3e7, 0x7241, 0x30c0, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xfef7, 0xff18, 0xfef7, 0xfef7, 0xfef8, 0xfef8, 0xff17, 0xff18, 0xd4ed, 0xfef7, 0xfef7, 0xfef7, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff17, 0xff18, 0xff18, 0xff18, 0xfef7, 0xff18, 0xfef8, 0xfef7, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xfef7, 0xff18, 0xfef8, 0xfef8, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xff17, 0xfef7, 0xff17, 0xff18, 0xff3a, 0x29c8, 0x2167, 0x1925, 0x2187, 0x1946, 0x29e9, 0x3b72, 0x54d9, 0x4bd2, 0x3b30, 0x3b30, 0x4b91, 0x53f3, 0x3b71, 0x0862, 0xeed8, 0xef19, 0xeef9, 0xef19, 0xef19, 0x3900, 0xa3c6, 0xa3c6, 0xa3c6, 0xb48a, 0x9ba5, 0xdd8b, 0xdd4a, 0xdd8b, 0xdd8b, 0xb447, 0xddab, 0xdd8b, 0xdd8b, 0xdd8b, 0xddab, 0xdd6a, 0xdd8b, 0xddab, 0xdd8b, 0xabe6, 0xdd6a, 0xdd8b, 0xdd8b, 0xe5cc, 0x0800, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xe6f8, 0x4120, 0xabe7, 0xa3c6, 0xabe7, 0xac08, 0x38c0, 0xfef7, 0xff17, 0xfef7, 0xfef8, 0xff18, 0xfef8, 0xff17, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xfe94, 0xff59, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xfef8, 0xff18, 0xfef8, 0xff17, 0xff18, 0xfef7, 0xff18, 0xfef7, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xff18, 0xfef8, 0xfef7, 0xff79, 0xff9a, 0x1925, 0x1946, 0x1905, 0x2146, 0x1926, 0x1126, 0x2188, 0x43b3, 0x4bb2, 0x4b91, 0x4b91, 0x53d2, 0x43b2, 0x0882, 0xffde, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0x30e0, 0xa3c6, 0xabe7, 0xac07, 0x9be7, 0xa3c5, 0xdd8b, 0xdd8b, 0xdd8b, 0xd54a, 0xa3c6, 0xcd0a, 0xdd6a, 0xdd8b, 0xdd8b, 0xdd6b, 0xdd8b, 0xdd6b, 0xdd6b, 0xdd8b, 0x7282, 0xdd8b, 0xdd8b, 0xdd8b, 0xdd8b, 0x4160, 0xf77b, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xffbc, 0x7aa3, 0xabe7, 0xa3c6, 0xa3c6, 0xa3e7, 0x7284, 0xffdc, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xff18, 0xff18, 0xfef8, 0xff17, 0xfdd2, 0x3880, 0xff18, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xff18, 0xfef7, 0xff18, 0xfef8, 0xfef8, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff17, 0xff17, 0xff18, 0xfef8, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef7, 0xff18, 0xfef8, 0xfef7, 0xfef7, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xff18, 0xff18, 0x2040, 0xfef7, 0x0861, 0x1926, 0x1925, 0x1105, 0x1946, 0x2188, 0x0862, 0x4392, 0x53d2, 0x1988, 0x220b, 0x53f2, 0x08a3, 0xde99, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0x2060, 0xa3a6, 0xa3e6, 0xabe6, 0x8326, 0xb427, 0xdd6b, 0xdd6a, 0xe5ab, 0xdd8b, 0x9b85, 0x9b65, 0xdd6a, 0xdd8b, 0xdd6b, 0xdd6a, 0xdd6a, 0xdd4a, 0xdd8b, 0xd56a, 0xb448, 0xa3a6, 0xdd8b, 0xdd8b, 0xdd8b, 0xf68f, 0x1000, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xffff, 0xc4ea, 0xac07, 0xabe6, 0xa3c6, 0x9ba6, 0x1820, 0x1000, 0xfef7, 0xfef7, 0xfef7, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xff17, 0xff18, 0xfed6, 0xffbb, 0xff18, 0xff17, 0xfef7, 0xff18, 0xfef8, 0xfef8, 0xff17, 0xfef7, 0xff18, 0xfef8, 0xfef7, 0xfef7, 0xff18, 0xff18, 0xff17, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xfef8, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xfef8, 0xff18, 0xff5a, 0x30c0, 0x38e0, 0x1861, 0x1925, 0x1926, 0x322b, 0x322b, 0x29ea, 0x29ea, 0x0021, 0x4392, 0x3b50, 0x0083, 0x0862, 0xffbc, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0x1000, 0xb427, 0xac07, 0xa3c6, 0x51a0, 0xbc88, 0xdd8b, 0xdd6a, 0xdd8b, 0xdd6a, 0xa3c6, 0x6a41, 0xdd8b, 0xdd8b, 0xdd6b, 0xdd6a, 0xdd6a, 0xd54a, 0xdd8b, 0xdd8b, 0x9ba5, 0x9b86, 0xdd8b, 0xdd6b, 0xdd8b, 0xdd8b, 0x3900, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xffdf, 0xee2e, 0xa3e6, 0xa3c6, 0xac07, 0x8b24, 0x1860, 0x38a0, 0xff18, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xfef8, 0xfef8, 0xfef8, 0xfef7, 0xff17, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef7, 0xfef8, 0xff18, 0xff18, 0xfef8, 0xfef7, 0xff18, 0xff18, 0xfef8, 0xff17, 0xfef8, 0xff18, 0xfef7, 0xfef7, 0xfef7, 0xff17, 0xff18, 0xfef7, 0xfef8, 0xff17, 0xfef7, 0xfef7, 0xff17, 0xff18, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef8, 0xfef8, 0xff18, 0xff18, 0x1000, 0x4100, 0x6200, 0x0800, 0x0841, 0x3a6c, 0x324b, 0x322b, 0x322b, 0x29ea, 0x322b, 0x10c4, 0x08a3, 0x08a3, 0x9c91, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0x0800, 0xb448, 0xabe6, 0xac07, 0x4120, 0xd54b, 0xdd6a, 0xddab, 0xdd8a, 0xdd6a, 0xa3c6, 0x6200, 0xdd8b, 0xdd8b, 0xdd6b, 0xd54a, 0xd54a, 0xdd8b, 0xdd8b, 0xdd6a, 0xac27, 0x82e4, 0xb468, 0xd54a, 0xdd6b, 0xdd8b, 0xf68f, 0xe6b7, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef8, 0xfe8f, 0xabc6, 0xabe7, 0x9ba6, 0xac07, 0x9c2b, 0x38e0, 0xfef7, 0xfef8, 0xfef7, 0xff18, 0xfef8, 0xfef8, 0xfef8, 0xff18, 0xfef7, 0xfef8, 0xfef7, 0xfef8, 0xfef7, 0xff18, 0xfef8, 0xff18, 0xfef7, 0xff17, 0xff17, 0xff17, 0xff18, 0xff18, 0xff18, 0xff18, 0xff17, 0xff17, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xfef8, 0xfef7, 0xfef7, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xfef8, 0xfef7, 0xff18, 0xfef8, 0xfef7, 0xff18, 0xfef8, 0xfef8, 0xff17, 0xff18, 0xfef7, 0xfef7, 0xff18, 0xff18, 0x38e0, 0x61e0, 0x59c1, 0x08a3, 0x2a0a, 0x29ea, 0x320b, 0x2168, 0x29ea, 0x29e9, 0x29c9, 0x2187, 0x0882, 0xffdd, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0x1000, 0xac07, 0xac27, 0xa3e6, 0x4100, 0xdd8b, 0xdd6a, 0xdd6b, 0xdd6a, 0xdd6b, 0xac07, 0x7241, 0xd56a, 0xdd6b, 0xdd8b, 0xd56a, 0xdd6a, 0xdd8b, 0xe58b, 0xdd8b, 0xd54a, 0xa3e7, 0x9bc6, 0xdd6b, 0xdd6a, 0xdd8b, 0xdd6a, 0x4120, 0xef19, 0xef19, 0xeef8, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 
-    0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0x8bec, 0xee2d, 0xdd6b, 0xac07, 0x9b86, 0xac28, 0xfffd, 0x4982, 0xddb2, 0xfef8, 0xff18, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xfef8, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0xfef7, 0xff17, 0xff18, 0xfef8, 0xff17, 0xff18, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff17, 0xff18, 0xff17, 0xff18, 0xfef7, 0xff18, 0xff17, 0xff18, 0xfef8, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xff18, 0xff18, 0xfef8, 0xfef7, 0xff18, 0xff18, 0xfef8, 0xfef7, 0xff17, 0xff18, 0xfef8, 0xfef8, 0xff18, 0xee14, 0x4940, 0x6a43, 0x0841, 0x2a0a, 0x2a0a, 0x21c9, 0x2187, 0x1062, 0x0862, 0x0862, 0x0000, 0xffde, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0x1000, 0xa3e6, 0xac07, 0xabe7, 0x59c0, 0xdd8b, 0xd56a, 0xdd6b, 0xd56a, 0xdd6a, 0xa3c6, 0x82e3, 0xd54a, 0xdd8b, 0xdd8b, 0xdd6a, 0xdd6a, 0xcce8, 0xdd6a, 0xdd6b, 0xddab, 0xabe7, 0x9386, 0xc4c9, 0xdd8b, 0xd54a, 0xdd8b, 0x59a1, 0xff7b, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0x4163, 0xddab, 0xd56a, 0xabe6, 0xabe7, 0xa408, 0xeef9, 0xfffe, 0x2860, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xff18, 0xfef8, 0xff18, 0xff18, 0xff18, 0xfef7, 0xfef8, 0xfef8, 0xff18, 0xfef7, 0xfef8, 0xff18, 0xfef8, 0xff18, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff17, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff17, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff17, 0xff18, 0xfef7, 0xfef7, 0xff18, 0xfef8, 0xfef7, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0x38c0, 0x6a21, 0x0841, 0x29ea, 0x2a0a, 0x21c9, 0x3a6b, 0x0861, 0xeed8, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0x0800, 0xabe7, 0xa3a5, 0xa3e6, 0x82c4, 0xdd6b, 0xd54a, 0xdd6a, 0xdd6b, 0xdd8b, 0xac07, 0x9386, 0xd56a, 0xddab, 0xdd8b, 0xdd8b, 0xdd6b, 0xbc67, 0xddab, 0xdd8b, 0xdd8b, 0xac07, 0x4120, 0xac07, 0xd56a, 0xdd8b, 0xdd8b, 0xcd29, 0x3920, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0x1020, 0xdd6a, 0xdd8a, 0xdd8b, 0xac07, 0x2880, 0xeef9, 0xeef9, 0x3080, 0xff39, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef7, 0xfef8, 0xfef7, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef7, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff17, 0xff17, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xfef8, 0xfef7, 0xfef7, 0xfef8, 0xfef7, 0xff17, 0xff18, 0xfef8, 0xfef8, 0xff79, 0x30a0, 0x1061, 0x322b, 0x29ca, 0x29ea, 0x320a, 0x0841, 0xeef8, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0x0800, 0xa406, 0xac07, 0xabe7, 0xb46a, 0xdd6a, 0xdd8b, 0xe5ab, 0xdd8b, 0xdd6b, 0xabe6, 0xac08, 0xdd6a, 0xd56a, 0xdd8b, 0xdd6a, 0xdd8b, 0xdd6b, 0xdd6b, 0xdd8b, 0xdd6a, 0xa3e7, 0xb469, 0xa3e7, 0xdd8b, 0xdd6b, 0xdd6b, 0xdd6b, 0x30c0, 0xffde, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0x0800, 0xdd6a, 0xdd6a, 0xd54a, 0xac06, 0x28a0, 0xef19, 0xeef8, 0xb530, 0x3080, 0xfef8, 0xfef8, 0xff18, 0xfef7, 0xfef7, 0xfef8, 0xfef8, 0xff18, 0xff17, 0xfef8, 0xff18, 0xff18, 0xff18, 0xfef7, 0xff17, 0xff18, 0xff18, 0xff18, 0xfef8, 0xfef7, 0xfef8, 0xff18, 0xfef7, 0xfef8, 0xff18, 0xff17, 0xff18, 0xff18, 0xfef8, 0xff17, 0xfef7, 0xff18, 0xfef8, 0xff18, 0xfef8, 0xff18, 0xfef7, 0xff18, 0xff18, 0xfef8, 0xfef8, 0xfef7, 0xff18, 0xff17, 0xff18, 0xff18, 0xff18, 0xfef8, 0xfef8, 0xfef8, 0x30c0, 0x1082, 0x3a6c, 0x2a0a, 0x322b, 0x322b, 0x0842, 0xffdd, 0xeef8, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0x0800, 0xac07, 0xa3a5, 0xb427, 0xac08, 0xdd6a, 0xdd8b, 0xd56a, 0xdd6b, 0xbc88, 0xac07, 0xac28, 0xdd6a, 0xdd8b, 0xdd8b, 0xdd6a, 0xdd6a, 0xdd8b, 0xe5ab, 0xdd6a, 0xdd6a, 0x9ba5, 0xabe6, 0x38e0, 0xac06, 0xdd6a, 0xdd6b, 0xd56a, 0xe5cc, 0x1840, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 
-    0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0x0800, 0xdd8b, 0xdd8b, 0xdd8b, 0xcd09, 0x38e0, 0xeef9, 0xeef9, 0xeef9, 0x30c0, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff17, 0xff18, 0xfef8, 0xfef8, 0xff17, 0xff18, 0xff17, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef8, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff17, 0xff18, 0xff18, 0xff18, 0xff18, 0xff38, 0xff17, 0xfef8, 0xffbb, 0x2000, 0xff17, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef8, 0xfef8, 0xfef8, 0xfef8, 0xfef8, 0xfef7, 0xfef8, 0xff18, 0xfef8, 0xfef7, 0xff18, 0xff5a, 0x1062, 0x3a6b, 0x324b, 0x322b, 0x320b, 0x0042, 0x8c2f, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0x0800, 0xac06, 0xa3e6, 0xa3a6, 0xb468, 0xdd8b, 0xdd8b, 0xdd8b, 0xd56a, 0x9b85, 0xa3e6, 0xa3e7, 0xdd8b, 0xdd8b, 0xdd6b, 0xdd8b, 0xdd8b, 0xdd8b, 0xd54a, 0xdd8b, 0xdd6a, 0xa3e6, 0xa3e6, 0x4140, 0xb469, 0xd54a, 0xdd6a, 0xdd8b, 0xdd8b, 0x38e0, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 
-    0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0x1020, 0xdd6a, 0xdd6a, 0xdd8b, 0xe5ab, 0x0800, 0xeef9, 0xef19, 0xef19, 0xfffe, 0x69c2, 0xff18, 0xfef8, 0xff17, 0xff18, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef7, 0xff18, 0xb42c, 0x38e0, 0xfffc, 0xff18, 0xfef7, 0xff18, 0xfef8, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0xff59, 0xd50f, 0x7204, 0xff38, 0xff18, 0xff18, 0xfef8, 0xfef8, 0xff17, 0xfef7, 0xff18, 0xff18, 0xfef8, 0xfef8, 0xfef8, 0xff18, 0xff17, 0xff18, 0xff18, 0xff18, 0xff18, 0xffbc, 0x0861, 0x29ca, 0x320a, 0x29ea, 0x320b, 0x0021, 0xffde, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef8, 0xeef9, 0x0800, 0xb427, 0xabe6, 0xa3e6, 0xa3e7, 0xdd8b, 0xdd6b, 0xdd8b, 0xdd8b, 0xabe7, 0xa3a6, 0xb468, 0xd54a, 0xdd8b, 0xdd6a, 0xdd8b, 0xdd8b, 0xdd8b, 0x9b85, 0xddab, 0xdd8b, 0xb427, 0xb428, 0x4140, 0x4120, 0xdd6b, 0xdd6a, 0xdd6a, 0xddab, 0xcd2b, 0xfffd, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef8, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0x1840, 0xdd6a, 0xddab, 0xdd6b, 0xd56a, 0x1840, 0xef19, 0xef19, 0xef19, 0xef19, 0x2880, 0xfffc, 0xfef7, 0xfef8, 0xff17, 0xfef8, 0xff18, 0xff18, 0xfef8, 0xff18, 0xfef8, 0xff18, 0xfef8, 0xfef7, 0xfef7, 0x936a, 0x2060, 0x7a25, 0xff18, 0xff18, 0xff18, 0xff18, 0xfffc, 0xb42c, 0x1800, 0x2020, 0xf655, 0xff59, 0xff18, 0xff18, 0xfef8, 0xff18, 0xfef8, 0xfef8, 0xff18, 0xff18, 0xfef8, 0xff18, 0xfef7, 0xfef8, 0xfef8, 0xff18, 0xfef8, 0xff18, 0xff18, 0xfef7, 0xff17, 0x0000, 0x0021, 0x29ea, 0x29ea, 0x2a0a, 0x322a, 0x0842, 0xe6da, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0x1000, 0xa3e6, 0xa3c6, 0xbc89, 0x9b85, 0xdd8b, 0xdd8b, 0xd58b, 0xdd8b, 0xabe7, 0xa3e6, 0xac28, 0xdd6a, 0xdd6a, 0xdd6a, 0xdd6a, 0xdd8b, 0xdd8b, 0x9ba6, 0xd56a, 0xdd8b, 0xc4c9, 0xa3c6, 0x30c0, 0x30c0, 0xb427, 0xdd6a, 0xdd6b, 0xdd8b, 0xdd8b, 0x28e0, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0x0800, 0xdd6a, 0xdd6a, 0xd54a, 0xd54a, 0x8389, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0x38c1, 0xfef7, 0xfef7, 0xfef8, 0xfef8, 0xff18, 0xff18, 0xfef8, 0xfef8, 0xff18, 0xfef8, 0xff18, 0xfef8, 0xfef8, 0xfef7, 0xff18, 0xff18, 0xfef8, 0xfef7, 0xff18, 0xff18, 0xfef8, 0xfef7, 0xff18, 0xff17, 0xff17, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff17, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xff17, 0xff18, 0xff18, 0xff7b, 0x1082, 0x3a6c, 0x2a0a, 0x29ea, 0x2a0a, 0x31c9, 0x0001, 0xe6f8, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef8, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0x1840, 0xa3e6, 0xac07, 0xac28, 0xbc67, 0xdd6b, 0xdd6a, 0xdd6a, 0xe5ac, 0xabe7, 0xabe7, 0xac28, 0xd56a, 0xdd8b, 0xd54a, 0xdd6b, 0xdd6a, 0xdd8b, 0xb428, 0xdd6b, 0xdd6a, 0xc4a8, 0xa3a6, 0xac28, 0xac6a, 0x6201, 0xdd6a, 0xdd8b, 0xcd09, 0xdd6a, 0x3920, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 
-    0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0x0800, 0xdd6a, 0xd54a, 0xd56a, 0xd56b, 0xde76, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef18, 0x3080, 0xfef7, 0xfef8, 0xfef8, 0xff18, 0xfef7, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef8, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef8, 0xfef7, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xff18, 0xff17, 0xff17, 0xfef8, 0xff18, 0xfef7, 0x0000, 0x0842, 0x2a0b, 0x29ea, 0x2a0a, 0x21ea, 0x0041, 0x0800, 0x0800, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0x2060, 0xa3a5, 0xabe7, 0x6201, 0xe5ac, 0xdd8b, 0xdd6a, 0xdd6a, 0xbc88, 0xac07, 0xac07, 0xa408, 0xdd6b, 0xddab, 0xdd6b, 0xdd6b, 0xdd6a, 0xdd6a, 0xac27, 0xdd8b, 0xdd6a, 0xc4c8, 0xa3e6, 0xac27, 0x1020, 0x3900, 0xdd6b, 0xdd4a, 0xd56a, 0xdd8b, 0x2880, 0xf73a, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 
-    0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0x4162, 0xf64d, 0xdd8b, 0xd52a, 0xdd8b, 0xfffe, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xfffe, 0x30a0, 0xff18, 0xff18, 0xfef7, 0xff17, 0xfef8, 0xff18, 0xfef7, 0xff18, 0xfef8, 0xfef7, 0xff18, 0xff17, 0xff18, 0xff18, 0xfef7, 0xff17, 0xff18, 0xfef8, 0xfef8, 0xff18, 0xfef8, 0xff18, 0xff18, 0xff18, 0xfef8, 0xfef8, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xfef7, 0xff17, 0xfef7, 0xff17, 0xff18, 0xff18, 0xfef7, 0xffbc, 0x0862, 0x3a4b, 0x320b, 0x29ca, 0x2a0a, 0x320a, 0x0861, 0xb4ab, 0xb427, 0x8305, 0x1820, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0x28c0, 0xac07, 0xac07, 0x3900, 0xdd8b, 0xdd6b, 0xdd8a, 0xd56a, 0xa3c6, 0x7aa2, 0xa3e6, 0xa408, 0xdd6b, 0xdd6a, 0xdd8b, 0xdd6b, 0xdd6b, 0xdd8b, 0xabe7, 0xdd8b, 0xdd8b, 0xcd0a, 0xabe6, 0xa3e6, 0x30c0, 0x1020, 0xee2e, 0xd56a, 0xd56a, 0xddab, 0xcd2b, 0xf718, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 
-    0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef8, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xf71a, 0xf690, 0xdd6b, 0xd529, 0xedec, 0xffdd, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xf73a, 0x38c1, 0xff58, 0xfef8, 0xfef7, 0xff18, 0xfef8, 0xfef8, 0xff17, 0xff18, 0xfef7, 0xfef7, 0xfef8, 0xfef7, 0xfef8, 0xff18, 0xfef7, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0xfef8, 0xff17, 0xfef7, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef7, 0xff18, 0xfef7, 0xfef8, 0xffdc, 0x0862, 0x29c9, 0x322b, 0x2a0a, 0x2a0a, 0x2a0a, 0x0862, 0x1060, 0x38e0, 0xb48a, 0xa3a6, 0xa3c6, 0xac27, 0x3900, 0x6ac6, 0xff9c, 0xeef9, 0xeef9, 0xf75a, 0xcdf4, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0x3100, 0xa3e6, 0xabe7, 0xa3e7, 0xdd6a, 0xdd8b, 0xdd8b, 0xdd8a, 0xac07, 0xb469, 0xac07, 0x8b24, 0xd56a, 0xdd6a, 0xdd8b, 0xd54a, 0xdd8b, 0xdd6b, 0xa3c6, 0xb427, 0xd54a, 0xbc88, 0xabe7, 0xa3e6, 0x3920, 0xf739, 0x2880, 0xdd8b, 0xdd6a, 0xcd2a, 0xdd8b, 0x1020, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 
-    0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xffdd, 0x7262, 0xdd8b, 0xd56a, 0xf64e, 0xff5b, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef8, 0x3080, 0xfffd, 0xff17, 0xff18, 0xff18, 0xfef8, 0xff17, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff17, 0xfef8, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xff18, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xfef8, 0xff18, 0xff17, 0xfef7, 0xfef8, 0xfef7, 0xff18, 0xfef8, 0xfef8, 0xff18, 0xff9b, 0x0841, 0x2a0a, 0x29ea, 0x322b, 0x2a0a, 0x31e9, 0x0841, 0xfed6, 0x0000, 0xeef8, 0x41a3, 0x3920, 0x30c0, 0x6222, 0xb449, 0xcd2c, 0xc50b, 0x51a1, 0x0800, 0xf75a, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0x3920, 0xa3e7, 0xa3c6, 0xac27, 0xdd8b, 0xdd8b, 0xdd8b, 0xe5ac, 0xbca9, 0x9ba6, 0xabe7, 0x7aa3, 0xd54a, 0xdd6a, 0xddab, 0xd56a, 0xdd8b, 0xcd0a, 0xb448, 0xa3a5, 0xdd8b, 0xbc68, 0xac07, 0xac07, 0x4120, 0xef19, 0x30e0, 0xdd8b, 0xdd6b, 0xabe5, 0xdd6a, 0x4140, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef8, 0x1820, 0xdd8a, 0xdd6a, 0xfe8f, 0xf75a, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0x0800, 0xe614, 0xfef8, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef7, 0xfef8, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef8, 0xfef8, 0xff5a, 0x0862, 0x322b, 0x2a0a, 0x2a0a, 0x3a4b, 0x0841, 0x8b29, 0xe52f, 0xdd6f, 0x8b8a, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xe6d8, 0xe6d8, 0xeef8, 0xeef8, 0xef19, 0xeef8, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0x4100, 0xb448, 0xb449, 0xcce9, 0xdd8a, 0xdd8b, 0xd56a, 0xa3c5, 0x6221, 0xa3c6, 0xac07, 0x59c0, 0xd56a, 0xdd6a, 0xdd6a, 0xd56a, 0xdd6a, 0xa3e6, 0xac27, 0xabe7, 0xd56a, 0xa3c5, 0xabe6, 0xa3c6, 0x4140, 0xef19, 0xf75a, 0xcd2b, 0xd529, 0xd52a, 0xdd4a, 0x38e0, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0x4140, 0xdd8b, 0xdd6a, 0xfe8f, 0xff9b, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0x0800, 0x2000, 0xff17, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef8, 0xfef8, 0xff18, 0xfef8, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xfef7, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0xfef7, 0xff17, 0xfef7, 0xb4cf, 0x2146, 0x2a0a, 0x29ea, 0x0041, 0x1880, 0xf5d2, 0xe54f, 0xed50, 0x82e6, 0xf6d7, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0x30c0, 0xac07, 0x82e4, 0xdd8b, 0xe5ab, 0xdd8b, 0xddab, 0xa3a6, 0x8b25, 0xac07, 0xabe7, 0x5160, 0xdd8b, 0xd54a, 0xdd8b, 0xdd6a, 0xd54a, 0xb468, 0xa3e7, 0xa3e6, 0xdd8b, 0x9ba5, 0xac27, 0xac07, 0x4140, 0xef19, 0xeef8, 0x2880, 0xd54a, 0xdd8b, 0xdd8b, 0x30c0, 0xe6d8, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0x1000, 0xdd6a, 0xd54a, 0xee0d, 0xffdd, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xbd31, 0x2840, 0xfef8, 0xff18, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef7, 0xff18, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xfef8, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xfef8, 0xff18, 0xff18, 0xfef8, 0xff18, 0xfef7, 0xfef7, 0xfef7, 0x1060, 0x0861, 0x0841, 0xedf3, 0xe550, 0xe570, 0xe54f, 0xe550, 0x5121, 0xfffe, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0x38e0, 0xa3a6, 0x4120, 0xd56a, 0xd56a, 0xd56a, 0xdd8b, 0xabe7, 0xa3e6, 0xa3c6, 0xac27, 0x6a61, 0xdd8b, 0xdd6a, 0xdd8a, 0xdd6b, 0xdd6b, 0xa3c6, 0xac07, 0xa3e6, 0xdd8b, 0xac27, 0xa3c6, 0x9ba5, 0x3920, 0xef19, 0xef19, 0x4120, 0xd54a, 0xdd6a, 0xdd8b, 0x8324, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xf719, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xffbe, 0xf64e, 0xdd8b, 0xd56a, 0xeef8, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0x38c0, 0xffdc, 0xfef7, 0xfef7, 0xfef8, 0xff18, 0xfef8, 0xff18, 0xff18, 0xff17, 0xff18, 0xff18, 0xfef7, 0xff18, 0xff18, 0xfef8, 0xff17, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef8, 0xfef7, 0xfffd, 0x30a0, 0x9b69, 0xe54f, 0xe54f, 0xe550, 0xe52f, 0xe550, 0xe52f, 0xe52f, 0x40c0, 0xffdc, 0xeef9, 0xeef9, 0xeef8, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xf73a, 0xc4cb, 0xabe6, 0xb448, 0xdd8b, 0xdd6b, 0xe5ab, 0xa3e6, 0x8325, 0xabe7, 0xabe7, 0xac07, 0xac28, 0xd54a, 0xdd6b, 0xdd6a, 0xdd6b, 0xdd8a, 0xabe7, 0xabe6, 0xabe7, 0xdd8b, 0xac07, 0xac07, 0xa3e6, 0x3920, 0xef19, 0xef19, 0x1840, 0xcd0b, 0xdd8b, 0xa3c5, 0xee4e, 0xffde, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0x4100, 0xdd6a, 0xdd8b, 0x1020, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef8, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0x2860, 0xffbb, 0xfef7, 0xfef7, 0xff18, 0xff18, 0xff18, 0xfef7, 0xfef8, 0xff18, 0xff17, 0xff18, 0xff18, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xff18, 0xff18, 0xfef7, 0xff18, 0xfef7, 0xfef8, 0xff18, 0xfed6, 0x2000, 0x2020, 0xed90, 0xed70, 0xe52f, 0xe52f, 0xe52f, 0xe54f, 0xe52f, 0xe570, 0xe54f, 0x4941, 0x9c4e, 0xf71a, 0xeef9, 0xeef8, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xff9c, 0xabe6, 0xac07, 0xe5ac, 0xdd8b, 0xdd6b, 0xdd6a, 0xac07, 0x6a41, 0xa3e6, 0xa3c6, 0xac07, 0xbc89, 0xddab, 0xd54a, 0xdd6b, 0xdd6b, 0xcd0a, 0xa3e7, 0xac07, 0xac07, 0xdd6a, 0xac07, 0xabe7, 0x9ba6, 0x4140, 0xef19, 0xef19, 0xffdd, 0x38e0, 0xd56a, 0xac07, 0xee4f, 0xffde, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef8, 0x3100, 0xd56a, 0xdd6a, 0x3921, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0x3942, 0x2060, 0xff18, 0xff17, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef7, 0xfef8, 0xff18, 0xff18, 0xfef8, 0xfef8, 0xfef7, 0xfef7, 0xff17, 0xff17, 0xff18, 0xff17, 0xfef7, 0xff39, 0x1800, 0x2000, 0xed91, 0xe54f, 0xe54f, 0xe54f, 0xe550, 0xe550, 0xe54f, 0xe54f, 0xe550, 0xe54f, 0xe550, 0x4101, 0x2168, 0x29c8, 0x0842, 0x0000, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0x0800, 0xb428, 0x59e0, 0xdd6b, 0xd54a, 0xdd6b, 0xc4e9, 0xa3c6, 0xac27, 0xabe7, 0xa3e6, 0xa3e7, 0xa3e6, 0xdd8a, 0xdd8b, 0xd56a, 0xdd6a, 0x9ba5, 0xa3e6, 0xa3c6, 0xabe7, 0xdd8b, 0xa3e7, 0xa3c6, 0xa3c6, 0x4120, 0xef19, 0xef19, 0xef39, 0x4100, 0xddab, 0xb448, 0xfef2, 0xef1a, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xd655, 0xdd8d, 0xd54a, 0x2880, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xffff, 0x38e1, 0xff38, 0xff18, 0xfef7, 0xff18, 0xff18, 0xfef8, 0xff18, 0xfef8, 0xff18, 0xfef8, 0xfef8, 0xff18, 0xfef8, 0xff17, 0xff17, 0xfef7, 0xff7a, 0x1800, 0x30a0, 0xfe74, 0xe550, 0xe54f, 0xe550, 0xe54f, 0xe550, 0xe530, 0xe550, 0xed70, 0xe52f, 0xe52f, 0xe550, 0xe54f, 0x38c0, 0x1947, 0x1967, 0x1967, 0x2987, 0x0000, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0x3900, 0xa3c6, 0x82c4, 0xdd8b, 0xdd8b, 0xd54a, 0xabe7, 0xac28, 0xac07, 0xabe6, 0xa3e6, 0xb448, 0xabe7, 0xdd8b, 0xdd8a, 0xdd6a, 0xd54a, 0xac07, 0xabc7, 0xa3a6, 0xabe7, 0xabe6, 0xa3e6, 0xac07, 0xa3c6, 0x28a0, 0xef19, 0xef19, 0xef19, 0x4120, 0xdd6b, 0xa3e6, 0xddad, 0xe6d8, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 
-    0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef8, 0x38e0, 0xdd6a, 0xf66f, 0xf738, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef8, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef8, 0xeef9, 0x38e0, 0xffbb, 0xfef8, 0xfef8, 0xff18, 0xff18, 0xff18, 0xff18, 0xff18, 0xfef8, 0xff18, 0xff17, 0xff17, 0xff18, 0xffdd, 0x2860, 0x2880, 0x4900, 0xe570, 0xe570, 0xe52f, 0xe550, 0xdd2f, 0xe570, 0xed70, 0xe52f, 0xe54f, 0xe52f, 0xe570, 0xe550, 0xe54f, 0xe52f, 0x4100, 0x2188, 0x1947, 0x2146, 0x1105, 0x0862, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0x4100, 0xac07, 0xa3c6, 0xdd8b, 0xdd6b, 0xcce9, 0xac07, 0x38c0, 0xac07, 0xabe7, 0xac07, 0x8b65, 0xa3e6, 0xdd6a, 0xdd6a, 0xdd6a, 0xcd09, 0xac07, 0xa3c6, 0xac07, 0xa3e7, 0xa3e6, 0xa3e7, 0xac07, 0xc4ea, 0x0800, 0xeef9, 0xef19, 0xef19, 0x2040, 0xddab, 0xa3c6, 0xe62f, 0xf75a, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xfffe, 0x7ac4, 0xddab, 0x38e0, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef39, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0x4983, 0x1800, 0xff18, 0xfef8, 0xff18, 0xfef7, 0xff18, 0xff18, 0xff18, 0xff17, 0xff18, 0x1800, 0x2880, 0x2880, 0x30a0, 0xfe95, 0xe550, 0xe550, 0xe570, 0xe54f, 0xe52f, 0xe54f, 0xe550, 0xed90, 0xe550, 0xe54f, 0xe52f, 0xdd2f, 0xe550, 0xe550, 0xe54f, 0x20a0, 0x0862, 0x0882, 0x1946, 0x1967, 0x10e5, 0xf77c, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef8, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xcdd3, 0xb469, 0x4940, 0xdd6b, 0xdd6b, 0xdd6b, 0xa3c6, 0xb449, 0xa3e7, 0xabe7, 0xabe7, 0x9ba6, 0x51a0, 0xa3c6, 0xdd8b, 0xdd8b, 0xdd8b, 0xac07, 0xa3c6, 0xac07, 0xa3c6, 0xa3c6, 0xac07, 0xabe6, 0xac07, 0x9386, 0xacf0, 0xeef9, 0xef19, 0xef19, 0x0000, 0xe5ed, 0xabe7, 0xff12, 0xffde, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0x0800, 0xdd6a, 0x40e0, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xde35, 0x3080, 0xffff, 0xff18, 0xff18, 0xff18, 0xfef8, 0xfffe, 0x1820, 0x30a0, 0x30c0, 0x4120, 0x2060, 0xe54f, 0xe54f, 0xe550, 0xe550, 0xdd2f, 0xe550, 0xe52f, 0xe570, 0xe54f, 0xe52f, 0xe52f, 0xe570, 0xe570, 0xe550, 0xe570, 0xbcae, 0x1082, 0x0862, 0x2167, 0x2188, 0x1947, 0x1967, 0x1925, 0xe6fa, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0x2080, 0xa3e6, 0xac48, 0xdd4a, 0xdd8b, 0xabe7, 0xac07, 0x3920, 0xa3e6, 0xabe7, 0xa3e6, 0xa3e7, 0x9365, 0xc4c9, 0xdd8b, 0xdd8b, 0xdd8b, 0xa3c6, 0xa3c6, 0xa3e6, 0xa3a6, 0xa3e6, 0xa3c6, 0xabe7, 0xa3e6, 0x30a0, 0xfffe, 0xeef9, 0xef19, 0xeef9, 0x1000, 0xe5ad, 0x9ba6, 0xf6b0, 0xfffe, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 
-    0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0x4141, 0xd54a, 0x20a0, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xffde, 0x0841, 0x0841, 0x18c2, 0x28a0, 0x4120, 0x38e0, 0x30a0, 0x2880, 0x3920, 0x30e0, 0x2020, 0xedb1, 0xe550, 0xe570, 0xe54f, 0xed90, 0xe550, 0xe54f, 0xe52f, 0xe54f, 0xe550, 0xe54f, 0xe550, 0xe550, 0xe52f, 0xe570, 0x0800, 0x0882, 0x10c5, 0x29ea, 0x2188, 0x2188, 0x2188, 0x2167, 0x2188, 0x18e5, 0xcdf6, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0x2040, 0xac07, 0xc4c9, 0xdd8b, 0xa3c6, 0xac07, 0x8304, 0x9ba7, 0xa3c6, 0xa3c6, 0xa3c6, 0xac07, 0xb448, 0xdd8b, 0xdd6a, 0xdd6a, 0xa3e6, 0xa3c6, 0x9ba5, 0xa3a6, 0x9ba5, 0xabe7, 0xa3e7, 0xa3e7, 0xabe7, 0x38e0, 0xeef9, 0xeef9, 0xef19, 0xef19, 0x1000, 0xbc89, 0xac28, 0x6221, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xff7b, 0x30c0, 0x2880, 0xeef8, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0x0000, 0x0062, 0x2188, 0x1967, 0x1946, 0x2187, 0x3985, 0x49a2, 0x30e0, 0x30c0, 0x30a0, 0xfe74, 0xe570, 0xe550, 0xe570, 0xe54f, 0xe570, 0xe54f, 0xed70, 0xe550, 0xed70, 0xe550, 0xe52f, 0xe550, 0xe52f, 0xfe54, 0x0000, 0x0842, 0x1926, 0x320a, 0x29ea, 0x322b, 0x21a8, 0x2188, 0x1967, 0x21a8, 0x29a8, 0x18e4, 0xded9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xd636, 0xc4eb, 0x4120, 0xdd8b, 0x9b85, 0xa3a6, 0xa3c6, 0x4120, 0xac07, 0xac07, 0xabe7, 0xac07, 0xa3e6, 0xabe7, 0xd56a, 0xd56a, 0xdd8b, 0xa3c6, 0xac07, 0xabe7, 0xa3e7, 0xa3a6, 0xa3c6, 0xac07, 0xac07, 0x9ba6, 0x3100, 0xef19, 0xeef9, 0xef19, 0xeef9, 0x3900, 0xac07, 0x30c0, 0x30a0, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xf75c, 0x3080, 0x20a0, 0xeef9, 0xeef8, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xf75a, 0x0842, 0x2187, 0x1926, 0x2187, 0x1947, 0x2167, 0x1925, 0x4140, 0x30a0, 0x8ae6, 0xe570, 0xe550, 0xe52f, 0xe52f, 0xe570, 0xe570, 0xe570, 0xe54f, 0xe550, 0xe54f, 0xe54f, 0xe550, 0xe530, 0xac2d, 0x1041, 0x0862, 0x31e9, 0x322b, 0x29c9, 0x2a0a, 0x2a0a, 0x322b, 0x29c9, 0x2167, 0x2167, 0x1967, 0x2167, 0x10e4, 0xce37, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0x3920, 0xac07, 0xabe6, 0xa3c6, 0xa3c6, 0xac07, 0x4960, 0x4960, 0xa3c6, 0xac07, 0xabe7, 0xa3e6, 0xa408, 0xa3c6, 0xdd6a, 0xdd6a, 0x9ba5, 0xa3e6, 0xa3a6, 0xa3e6, 0xb468, 0xac07, 0xa3a6, 0xa3e7, 0xa3e6, 0xbcaa, 0x30e1, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0x30e0, 0xa3c6, 0xac29, 0x3940, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0x1880, 0x2080, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef8, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xffbd, 0x2146, 0x1946, 0x0862, 0x0882, 0x2146, 0x2187, 0x2125, 0x7aa5, 0xed90, 0xe550, 0xe570, 0xe54f, 0xed70, 0xe570, 0xe550, 0xe550, 0xe52f, 0xed70, 0xdd2f, 0xfeb6, 0x0000, 0x1082, 0x0842, 0x29c8, 0x2a0a, 0x2a0a, 0x29ea, 0x29ea, 0x29ea, 0x29ea, 0x322b, 0x2a0a, 0x1988, 0x2188, 0x1947, 0x2188, 0x1947, 0x1905, 0xce17, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xffdd, 0xbcaa, 0x6a41, 0x9ba6, 0xa3a6, 0xa3c6, 0xb448, 0x3900, 0xa3c6, 0xa3c6, 0xa3c6, 0xa3e7, 0x9b85, 0x4940, 0x9ba5, 0xdd6a, 0xd56b, 0xa3e6, 0xac08, 0xa3c6, 0xac07, 0xb469, 0xac07, 0xa3e7, 0xa3e6, 0xac27, 0x30a0, 0xfffd, 0xef19, 0xef19, 0xeef9, 0x9c4d, 0x7284, 0xb468, 0xbc69, 0x0800, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xf719, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef8, 0xeef8, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xfffe, 0x2987, 0x1947, 0x2167, 0x2187, 0x29a8, 0x0862, 0x0861, 0x0800, 0x0800, 0x7ae9, 0xf655, 0xfeb6, 0xfe96, 0xfe75, 0xc4f0, 0x2081, 0x0000, 0x1062, 0x0841, 0x0862, 0x2987, 0x1947, 0x2188, 0x2a0a, 0x2a0a, 0x320b, 0x2a0a, 0x2a0a, 0x322b, 0x29ea, 0x322b, 0x21c9, 0x29e9, 0x2188, 0x2187, 0x1967, 0x2188, 0x2126, 0xc5f6, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0x30e0, 0x8b25, 0x9b85, 0xa3c6, 0xa3c6, 0xa3c6, 0x28a0, 0xbca9, 0x9ba5, 0xabe6, 0xabe7, 0xa3a6, 0xac07, 0xb449, 0xabe6, 0xdd6a, 0xa3e6, 0xabe6, 0x9b85, 0xa3c6, 0xac07, 0x9ba6, 0xa3e6, 0xa3c6, 0xabe7, 0xac07, 0x3900, 0xef19, 0xef19, 0xef19, 0xef19, 0x30e0, 0xa3e7, 0x3900, 0x4920, 0xfffe, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xffff, 0x29a8, 0x2188, 0x2188, 0x1967, 0x2188, 0x1946, 0x1967, 0x0041, 0x2187, 0x2187, 0x2167, 0x18e4, 0x1926, 0x2166, 0x2187, 0x2188, 0x2188, 0x2187, 0x2187, 0x1967, 0x2167, 0x2a0a, 0x2a0a, 0x2a0a, 0x2a0a, 0x29ea, 0x2a0a, 0x2a0a, 0x29ea, 0x29ea, 0x2a0a, 0x2a0a, 0x2a0a, 0x21a8, 0x2167, 0x1967, 0x21a8, 0x1905, 0xf75c, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0x3922, 0xcd4c, 0xa3c6, 0xa3e7, 0x9b85, 0xac07, 0xb469, 0x2880, 0xac07, 0xac07, 0xa3e7, 0xa3c6, 0xac07, 0xbc8a, 0xa3e7, 0xddab, 0xb447, 0xa3c6, 0xa3c6, 0xa3c6, 0xa3c6, 0xa3c6, 0x7aa3, 0xabe6, 0xac07, 0xabe7, 0xabe7, 0x83cb, 0xeef9, 0xeef9, 0xef19, 0xf73a, 0x2880, 0xbc8a, 0xa3e7, 0x3900, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef8, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xffdd, 0x2988, 0x2187, 0x2187, 0x2187, 0x1947, 0x2188, 0x1946, 0x0861, 0x1967, 0x2187, 0x2167, 0x2167, 0x2167, 0x1947, 0x2187, 0x2187, 0x2187, 0x21a8, 0x1967, 0x2167, 0x3a4b, 0x322b, 0x2a0a, 0x29ea, 0x2a0a, 0x2a0a, 0x322b, 0x322b, 0x2a0a, 0x322b, 0x2a0a, 0x29ea, 0x29ea, 0x29e9, 0x1967, 0x1947, 0x1926, 0x1925, 0xb554, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xffbc, 0x4980, 0xb468, 0x9b86, 0xabe7, 0xa3e6, 0xa3a5, 0x38e0, 0xc4ca, 0xa3c6, 0xac27, 0xa3a5, 0xa3c6, 0xabe7, 0x4960, 0xa3c6, 0xd56b, 0xa3a6, 0xa3c6, 0xa3a6, 0x9ba6, 0x9ba6, 0xa3c6, 0x59a0, 0xabe7, 0xa3c6, 0xa3c6, 0x4960, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0x0800, 0xb468, 0x9385, 0xac07, 0x3942, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xf75c, 0x29c9, 0x2188, 0x1967, 0x2187, 0x2167, 0x1967, 0x1967, 0x0841, 0x1967, 0x2187, 0x08a3, 0x2188, 0x1967, 0x2167, 0x2167, 0x1967, 0x1946, 0x1967, 0x21a8, 0x2a0a, 0x21c9, 0x320b, 0x320b, 0x322b, 0x2a0a, 0x21ca, 0x21ea, 0x2a0a, 0x2a0a, 0x322b, 0x320a, 0x29ea, 0x322b, 0x21c9, 0x2187, 0x21a8, 0x21a8, 0x2987, 0x0020, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xffdc, 0x38e0, 0xabe7, 0xabc6, 0xa3c6, 0xac07, 0xa3a5, 0x3900, 0x28a0, 0xa3c6, 0xac07, 0xac28, 0xac27, 0xa3c6, 0xabe7, 0xb469, 0xa3c6, 0xa3c6, 0xa3c6, 0xa3c6, 0xabe7, 0xac28, 0xa3a6, 0x9ba6, 0x5160, 0xa3a6, 0xa3c6, 0xa3a6, 0x3900, 0xef19, 0xef19, 0xeef9, 0xeef8, 0x30e0, 0x5180, 0xac07, 0x2880, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xde98, 0x2188, 0x2187, 0x2167, 0x2187, 0x1947, 0x1967, 0x1967, 0x0041, 0x2167, 0x1947, 0x0862, 0x21a8, 0x1967, 0x1947, 0x2188, 0x2188, 0x1947, 0x29ea, 0x324b, 0x322b, 0x322b, 0x2a0a, 0x29ea, 0x322b, 0x324c, 0x322b, 0x29ea, 0x29ea, 0x322b, 0x2a0a, 0x322b, 0x2a0a, 0x322b, 0x1988, 0x1987, 0x2167, 0x1967, 0x1946, 0x10c4, 0x0000, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef8, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xf73a, 0x2880, 0x82e4, 0xb428, 0xabe7, 0xa3c6, 0xabe7, 0xac49, 0x30c0, 0xeef9, 0x3900, 0xa3e7, 0xa3e6, 0xa3a6, 0xa3c6, 0xabe7, 0xac28, 0xa3e6, 0xa3c6, 0xa3c6, 0xa3a6, 0xabe7, 0xa3c6, 0xa3c6, 0xabe7, 0xa3e7, 0x6221, 0xabe6, 0xabe7, 0xb469, 0x5a45, 0xef19, 0xef19, 0xef19, 0x2060, 0xcd2c, 0xb407, 0xc4ca, 0x1840, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xb574, 0x21a8, 0x2187, 0x1967, 0x1967, 0x2167, 0x1967, 0x2187, 0x0882, 0x1946, 0x1947, 0x0842, 0x1947, 0x2188, 0x1947, 0x21a8, 0x2188, 0x322b, 0x2a0b, 0x29ea, 0x2a0a, 0x324b, 0x21ca, 0x2a0a, 0x29ea, 0x322b, 0x322b, 0x29ea, 0x29ea, 0x322b, 0x2a0a, 0x2a0b, 0x2a0a, 0x322b, 0x29ea, 0x2188, 0x1967, 0x2187, 0x0042, 0x1947, 0x18e5, 0x0841, 0xfffe, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xe6b7, 0xef39, 0x2080, 0x3940, 0x4940, 0xa3e7, 0xa3c6, 0xa3e6, 0xa3e6, 0xac28, 0x38c0, 0xcdf3, 0xeef9, 0xffbd, 0x4120, 0xa3e6, 0xa3e6, 0xa3e7, 0xa3e7, 0xa3c6, 0x6a42, 0xac07, 0x9b86, 0xa3e7, 0x9b85, 0xac07, 0xa3c6, 0xa3c6, 0xa3a6, 0xa3e6, 0x8b25, 0x9ba6, 0xa3c6, 0x38e0, 0xef39, 0xef19, 0xeef9, 0xffdc, 0x4140, 0xb448, 0xa3e7, 0x3900, 0xff9b, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 
-    0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef8, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef8, 0xef18, 0x20e2, 0x1967, 0x1947, 0x21a8, 0x2167, 0x1947, 0x1947, 0x2187, 0x10c4, 0x2187, 0x2167, 0x1905, 0x2188, 0x1967, 0x29c9, 0x2a2b, 0x322b, 0x2a0b, 0x29ea, 0x2a0a, 0x324b, 0x2a0a, 0x322b, 0x2a0b, 0x29ea, 0x2a0a, 0x2a0a, 0x2a0a, 0x2a0a, 0x324b, 0x2a0a, 0x2a0b, 0x2a0b, 0x2a0a, 0x21c9, 0x1967, 0x1925, 0x0882, 0x1946, 0x1967, 0x2a2b, 0x2a2b, 0x08c4, 0x0882, 0x3164, 0xef19, 0xef19, 0xeef9, 0xef19, 0xf739, 0x0800, 0x2880, 0x5160, 0x8b66, 0x4980, 0x30a0, 0x3920, 0xc593, 0xeef9, 0xef19, 0xeef9, 0x2040, 0xac27, 0xa3c6, 0xa3e6, 0xabe7, 0xabe7, 0x9ba6, 0xa3a6, 0x9344, 0x9ba6, 0xa3e7, 0xa3a6, 0xa3e7, 0xa3c6, 0xa3e7, 0xa3c6, 0xac07, 0xb448, 0xa3c6, 0xa3a6, 0x2040, 0xef19, 0xef19, 0xffbd, 0x3920, 0x9b65, 0xac07, 0x6a83, 0x62c6, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xe6b8, 0x0841, 0x0862, 0x0041, 0x2188, 0x1967, 0x2188, 0x2167, 0x2187, 0x1947, 0x2167, 0x1946, 0x1967, 0x1988, 0x1947, 0x2188, 0x2a0a, 0x322b, 0x322b, 0x322b, 0x2a0b, 0x29ea, 0x29ea, 0x2a0a, 0x29ea, 0x2a0a, 0x29ea, 0x29ea, 0x29ea, 0x2a0a, 0x320b, 0x29ea, 0x2a0a, 0x2a0a, 0x322b, 0x322b, 0x2a0a, 0x29ea, 0x10c4, 0x2188, 0x2187, 0x21a9, 0x32ae, 0x2a6c, 0x222c, 0x3b72, 0x3373, 0x32cf, 0x0862, 0x0000, 0xfffe, 0xef19, 0xef19, 0xeef9, 0xeef8, 0xfffe, 0xe6b7, 0xffdd, 0xf73a, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0x3900, 0xa3a6, 0xa3a6, 0x9b65, 0xac07, 0xa3a6, 0x6a42, 0xa3c6, 0x9365, 0xa3a6, 0xa3c7, 0x9ba6, 0xa3e6, 0xa3a6, 0xa3e6, 0xa3a6, 0xabe7, 0xb448, 0xa3e6, 0x7ac4, 0xfffe, 0xef19, 0xffbc, 0x30e0, 0xa3c6, 0xa3c6, 0xabe7, 0x3920, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 
-    0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef8, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef8, 0xeef8, 0xf75c, 0x0820, 0x0021, 0x3a4c, 0x21ea, 0x0861, 0x2188, 0x1967, 0x2147, 0x2167, 0x2188, 0x1946, 0x1967, 0x2187, 0x2167, 0x2167, 0x29c8, 0x322b, 0x29ea, 0x29ea, 0x29ea, 0x2a0a, 0x322b, 0x324b, 0x2a0a, 0x324b, 0x29ca, 0x2a0b, 0x2a0a, 0x29ca, 0x29ca, 0x29ea, 0x2a0b, 0x21c9, 0x2a0a, 0x29ea, 0x320b, 0x2a0a, 0x29ea, 0x0862, 0x21a8, 0x1967, 0x21c9, 0x224d, 0x2a6d, 0x3b52, 0x3b94, 0x3bb4, 0x3b94, 0x43b4, 0x3394, 0x5415, 0x0042, 0x1083, 0x2103, 0xff7b, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xf75b, 0x30c0, 0xa3e6, 0xac07, 0xa3e7, 0xa3c6, 0xabe7, 0xb469, 0xa3c6, 0x9b86, 0x9bc6, 0xac07, 0x82e3, 0xa3c6, 0xb428, 0xa3c7, 0xa3c6, 0xa3e6, 0xa3c6, 0xa3c6, 0x3900, 0xef19, 0x6265, 0x30a0, 0xa3c6, 0xa3e7, 0xac07, 0x30a0, 0xffdd, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef8, 0xeef8, 0xeef9, 0xeef8, 0xeef8, 0xeef9, 0xef19, 0xeef8, 0xe6d8, 0xff9c, 0x840e, 0x0000, 0x0862, 0x0042, 0x322a, 0x21ea, 0x29ea, 0x2a0b, 0x2a0b, 0x0841, 0x1947, 0x1947, 0x1947, 0x2188, 0x2188, 0x1967, 0x2188, 0x1947, 0x1967, 0x21a8, 0x3a4b, 0x322b, 0x29ea, 0x2a0a, 0x322b, 0x322b, 0x2a0b, 0x2a0a, 0x324c, 0x2a0b, 0x324b, 0x29ea, 0x2a0a, 0x29ea, 0x2a0b, 0x29ea, 0x2a0a, 0x2a0a, 0x320a, 0x322b, 0x2a0a, 0x2a0a, 0x0042, 0x1967, 0x21c9, 0x3310, 0x3b93, 0x3394, 0x2b32, 0x43b5, 0x3b94, 0x3373, 0x3b73, 0x3352, 0x43d5, 0x3b93, 0x3393, 0x3373, 0x3b93, 0x21ea, 0x0842, 0x0000, 0xffde, 0xe6f8, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0x1840, 0xb449, 0xac07, 0xabe7, 0x9ba6, 0xa3c6, 0x4960, 0x9ba6, 0x8b45, 0xb428, 0xa3e7, 0xa3e7, 0x51a0, 0xa3a6, 0xa3e6, 0xa3c6, 0xa3c6, 0xac07, 0xa3c6, 0x51a0, 0x8368, 0x38e0, 0xbcca, 0xac07, 0xa3c6, 0xa3c6, 0x6a42, 0x1060, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 
-    0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef8, 0xeef9, 0xe6d8, 0xffdd, 0x0000, 0x1062, 0x0882, 0x0042, 0x324b, 0x324c, 0x21ca, 0x21ea, 0x2a0a, 0x2a0a, 0x2a0a, 0x220b, 0x0862, 0x18e4, 0x2188, 0x2167, 0x1946, 0x2187, 0x1946, 0x1967, 0x2187, 0x2167, 0x21a9, 0x2a0a, 0x3a6b, 0x2a0a, 0x21c9, 0x29ea, 0x29ea, 0x2a0a, 0x322b, 0x324b, 0x29ea, 0x29ea, 0x324b, 0x2a0a, 0x29ea, 0x2a0b, 0x29ea, 0x322b, 0x320a, 0x322b, 0x320a, 0x29ea, 0x1105, 0x2166, 0x2a2b, 0x2ad0, 0x3bb4, 0x3374, 0x3353, 0x3b94, 0x3bb4, 0x3b94, 0x3bb4, 0x3b94, 0x3b94, 0x3b94, 0x3b94, 0x3b74, 0x3353, 0x43d5, 0x3373, 0x3b94, 0x3353, 0x43b4, 0x08e5, 0x1082, 0x0821, 0xe6b8, 0xef19, 0xeef9, 0xef19, 0x30c0, 0xa3e6, 0xabe7, 0xa3c6, 0xa3c6, 0xa3c6, 0x9ba6, 0x9ba6, 0xa3c7, 0xa3e6, 0xabe7, 0xb407, 0x59c0, 0xabe7, 0xa3a6, 0xabe7, 0xa3c6, 0xb449, 0xa3c6, 0x3100, 0xb469, 0xa3e7, 0xa3c6, 0xa3c6, 0xa3c6, 0xa3a6, 0x28c0, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 
-    0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef8, 0xeef9, 0xeef9, 0xef19, 0xf75b, 0x840e, 0x0861, 0x0862, 0x0042, 0x3aad, 0x2a6c, 0x220b, 0x326d, 0x32ad, 0x326d, 0x326d, 0x2a4c, 0x222b, 0x2a2b, 0x2a0a, 0x2a09, 0x0882, 0x2167, 0x1947, 0x0041, 0x2187, 0x2167, 0x1967, 0x2188, 0x2167, 0x1946, 0x29c9, 0x29c9, 0x29ea, 0x3a6b, 0x2a0a, 0x2a0b, 0x29ea, 0x2a0a, 0x320b, 0x2a0a, 0x324b, 0x324b, 0x2a0a, 0x322b, 0x2a0a, 0x2a0b, 0x2a0a, 0x29ea, 0x322b, 0x29ea, 0x322b, 0x1947, 0x0042, 0x2a0b, 0x2a0b, 0x0883, 0x4bf4, 0x3394, 0x3374, 0x43f5, 0x3bb4, 0x3373, 0x3b94, 0x3373, 0x3bb4, 0x3353, 0x3373, 0x3373, 0x3353, 0x2b32, 0x3373, 0x3353, 0x43b5, 0x3373, 0x3373, 0x3353, 0x3bb4, 0x3373, 0x5c35, 0x0042, 0x0882, 0x0000, 0x940a, 0xa3c6, 0xac07, 0xabe7, 0xa3e6, 0x7282, 0xa3c6, 0xac07, 0xa3c6, 0xabe7, 0x9b85, 0xa3c6, 0x59c0, 0xa3c6, 0xa3c6, 0x9b85, 0x9ba5, 0xac28, 0x30c0, 0xa3c6, 0xa3c6, 0xa3c6, 0x9b85, 0xa3e7, 0xa3e7, 0x3900, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef8, 0xdeb8, 0x0020, 0x0021, 0x322b, 0x326d, 0x2a4c, 0x328d, 0x2a6d, 0x2a4c, 0x222c, 0x224d, 0x3b73, 0x3bb4, 0x3353, 0x226e, 0x224c, 0x3a6b, 0x0862, 0x2988, 0x2187, 0x1967, 0x2188, 0x2187, 0x10e4, 0x2187, 0x2167, 0x1967, 0x2188, 0x1926, 0x29e9, 0x322b, 0x2a0a, 0x320a, 0x21c9, 0x29ea, 0x324b, 0x324b, 0x2a0a, 0x29ea, 0x2a0a, 0x29ea, 0x322b, 0x320b, 0x29ea, 0x322b, 0x29ea, 0x2a0a, 0x2a0a, 0x08a3, 0x10a4, 0x322b, 0x2a2b, 0x320b, 0x322b, 0x2a0a, 0x3a4b, 0x0861, 0x4b71, 0x3393, 0x3bb4, 0x3373, 0x3b94, 0x43d5, 0x3bb4, 0x3373, 0x3bb4, 0x3b94, 0x3373, 0x3373, 0x3373, 0x3373, 0x3bb4, 0x3353, 0x2b32, 0x3b94, 0x3b73, 0x3b93, 0x3393, 0x3bb4, 0x3b94, 0x43f5, 0x08e6, 0x1083, 0x1840, 0x9ba5, 0x7241, 0x9ba6, 0xa3c6, 0xa3c6, 0xa3c6, 0xac07, 0xabe7, 0x9b85, 0x5180, 0xa3c6, 0x9b85, 0xa3e6, 0xac27, 0x9366, 0x9366, 0xa3a6, 0xac07, 0xac07, 0xa3c6, 0x9b85, 0x38e0, 0xffdc, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xffde, 0x1062, 0x1925, 0x2a4b, 0x2a4c, 0x328d, 0x326d, 0x328e, 0x3310, 0x43d4, 0x3b94, 0x3373, 0x3b73, 0x3b94, 0x3393, 0x4b91, 0x0021, 0x2126, 0x2188, 0x2188, 0x21a8, 0x1967, 0x1967, 0x2167, 0x2188, 0x1946, 0x1966, 0x21a8, 0x2188, 0x1946, 0x2167, 0x29ea, 0x322b, 0x322b, 0x1926, 0x324b, 0x2a0b, 0x2a0a, 0x2a0b, 0x29ea, 0x2a0a, 0x2a0a, 0x29ea, 0x322b, 0x322b, 0x2a0a, 0x29ea, 0x3a6b, 0x0062, 0x31e9, 0x2a0b, 0x322b, 0x29ea, 0x322b, 0x2a0a, 0x2a0a, 0x320b, 0x2a0b, 0x29ea, 0x29ea, 0x3a6c, 0x0041, 0x1147, 0x4c15, 0x3373, 0x3b73, 0x3373, 0x3b94, 0x3353, 0x3353, 0x3373, 0x3b74, 0x3373, 0x3373, 0x3373, 0x3393, 0x3b94, 0x3b93, 0x3353, 0x3bb4, 0x3373, 0x3373, 0x3b94, 0x3353, 0x3373, 0x5bd2, 0x0841, 0x3941, 0xac07, 0xac27, 0xac27, 0xabe6, 0xa3c6, 0xa3c6, 0xabe7, 0x6201, 0xa3e7, 0xa3c6, 0xa3c6, 0xa3c6, 0x5180, 0xa3c6, 0xabe7, 0xac07, 0xa3e6, 0xa3c6, 0x38e0, 0xfffe, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef8, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0x0000, 0x2187, 0x2a2b, 0x3aad, 0x326d, 0x2a6d, 0x328d, 0x2a8e, 0x3373, 0x3353, 0x3b73, 0x43d4, 0x1127, 0x0042, 0x3a4a, 0x322b, 0x2a2a, 0x29ea, 0x322b, 0x21c9, 0x1967, 0x2167, 0x1968, 0x2187, 0x2167, 0x2188, 0x1967, 0x2167, 0x0841, 0x2187, 0x2188, 0x29a8, 0x29ea, 0x2a0b, 0x320b, 0x0041, 0x2a0a, 0x29ea, 0x2a0a, 0x29ca, 0x2a0a, 0x29ea, 0x21c9, 0x29ea, 0x322b, 0x2146, 0x0841, 0x29e9, 0x2a0a, 0x2a2b, 0x322b, 0x322b, 0x322b, 0x29ea, 0x324b, 0x324c, 0x324b, 0x2a0a, 0x29ea, 0x322b, 0x322b, 0x320b, 0x2a0b, 0x320a, 0x29ea, 0x3a4b, 0x0062, 0x32ce, 0x3b94, 0x3373, 0x3353, 0x3353, 0x3353, 0x3373, 0x3b94, 0x43d5, 0x3b94, 0x3b73, 0x3bb4, 0x3b94, 0x3b94, 0x3b94, 0x3b94, 0x3b94, 0x0021, 0x42cd, 0x2a4c, 0x324c, 0x3aad, 0x0862, 0xabe7, 0xa3c6, 0xa3c6, 0xa3e7, 0xa3c6, 0xa3c6, 0x8b25, 0xabe7, 0xa3e7, 0xac07, 0xac07, 0x30c0, 0xa3e6, 0xa3c6, 0xa3c6, 0xa3c6, 0x3900, 0xf73a, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 
-    0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0x0000, 0x3acd, 0x2a4c, 0x2a2b, 0x2a4c, 0x2a6d, 0x3aae, 0x328d, 0x3b93, 0x3353, 0x19ca, 0x29c9, 0x29ea, 0x322b, 0x2a0b, 0x322b, 0x2a0a, 0x29ea, 0x2a0a, 0x29ea, 0x324b, 0x2a0a, 0x21a8, 0x1967, 0x1967, 0x2167, 0x1967, 0x1947, 0x1947, 0x2167, 0x2187, 0x0883, 0x29c9, 0x29ea, 0x2a0b, 0x320b, 0x0882, 0x2a0a, 0x324b, 0x2a0a, 0x3a4b, 0x322a, 0x10c4, 0x0841, 0x0021, 0x322a, 0x29ea, 0x2a0a, 0x29ea, 0x2a0a, 0x2a0a, 0x322b, 0x322b, 0x29ea, 0x2a0a, 0x29ea, 0x320b, 0x29ea, 0x29ea, 0x324b, 0x2a0a, 0x2a0a, 0x322b, 0x322b, 0x29ea, 0x322b, 0x322b, 0x322b, 0x29ea, 0x3a4b, 0x0021, 0x5c55, 0x3373, 0x3b94, 0x3373, 0x3373, 0x3373, 0x3393, 0x3bb4, 0x3b74, 0x3353, 0x3b93, 0x3bb4, 0x5c35, 0x1106, 0x2a6d, 0x326d, 0x2a4c, 0x2a4d, 0x2a4c, 0x2a4c, 0x1062, 0xa3e7, 0xac07, 0xabe7, 0xabe7, 0xabe7, 0xac08, 0xa3e7, 0xa3c6, 0xa3e7, 0xac07, 0x28a0, 0xac07, 0xac07, 0xb489, 0x38e0, 0xff9b, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0x0000, 0x324b, 0x326d, 0x326d, 0x0083, 0x326c, 0x326d, 0x2a6c, 0x2af1, 0x0021, 0x3a6b, 0x21ea, 0x2a0a, 0x29ea, 0x2a0a, 0x322b, 0x322b, 0x29ea, 0x29ea, 0x2a2b, 0x324b, 0x322b, 0x29ea, 0x29ea, 0x322b, 0x2a0a, 0x2a0a, 0x320b, 0x21c9, 0x29c9, 0x21a9, 0x31e9, 0x320a, 0x2a0b, 0x322b, 0x3a2a, 0x2187, 0x2146, 0x2987, 0x3a2a, 0x3a6c, 0x322a, 0x322b, 0x21c9, 0x2a0a, 0x2a0a, 0x320a, 0x29c9, 0x2188, 0x2188, 0x29ea, 0x29ea, 0x29ea, 0x29ea, 0x322b, 0x2a0a, 0x29ea, 0x21ca, 0x2a0a, 0x322b, 0x2a0a, 0x322b, 0x322b, 0x322b, 0x29ea, 0x322b, 0x2a0a, 0x2a0b, 0x2a2b, 0x322b, 0x2a0b, 0x2a0a, 0x2a0b, 0x29e9, 0x0022, 0x5435, 0x3394, 0x3374, 0x3353, 0x3393, 0x3bb4, 0x3bb4, 0x3373, 0x19a9, 0x4372, 0x2a6d, 0x2a4c, 0x2a4c, 0x2a4c, 0x328d, 0x326d, 0x326d, 0x326c, 0x0861, 0xa3c6, 0xac07, 0x9b85, 0xabe7, 0x9344, 0xabe6, 0xa3c6, 0xa3e6, 0x9b86, 0x30a0, 0xac08, 0x30c0, 0x0800, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xf77c, 0x0062, 0x3aae, 0x326d, 0x326d, 0x2a2b, 0x2a4c, 0x328d, 0x430e, 0x1926, 0x29ea, 0x29ea, 0x29ea, 0x320b, 0x2a0b, 0x29ea, 0x2a2a, 0x2a2b, 0x29ea, 0x322b, 0x21ca, 0x2a0b, 0x2a0a, 0x322b, 0x322b, 0x29ea, 0x2a0a, 0x2a0b, 0x322b, 0x2a0b, 0x2a0a, 0x2a0a, 0x0041, 0x2a0b, 0x322b, 0x324b, 0x29ea, 0x2a0a, 0x29ea, 0x0021, 0x21a9, 0x2188, 0x2188, 0x1967, 0x2188, 0x1988, 0x21a8, 0x2188, 0x1987, 0x21c9, 0x29ea, 0x2a0a, 0x2a2b, 0x29ea, 0x322b, 0x2a0a, 0x2a0b, 0x322b, 0x29ea, 0x324b, 0x2a0a, 0x320b, 0x322b, 0x29ea, 0x2a0a, 0x29ea, 0x29ea, 0x322b, 0x2a0b, 0x324b, 0x322b, 0x2a0a, 0x2a0a, 0x2a0a, 0x2a0a, 0x29ea, 0x324b, 0x0042, 0x6455, 0x3332, 0x3bb4, 0x3353, 0x3332, 0x220b, 0x4bd3, 0x2a6d, 0x2a6d, 0x222b, 0x326d, 0x2a6d, 0x2a4c, 0x2a4c, 0x328d, 0x328d, 0x3aad, 0x0000, 0xa3e6, 0xa3e7, 0xac07, 0x9345, 0xac07, 0xa3e7, 0xa3c6, 0xa3e7, 0x30a0, 0x1840, 0xff9c, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef8, 0x0882, 0x2a4c, 0x326d, 0x2a4c, 0x32ce, 0x5435, 0x3373, 0x1106, 0x2a2b, 0x2a2b, 0x2a0a, 0x21c9, 0x21ea, 0x322b, 0x324b, 0x2a0a, 0x322b, 0x2a0b, 0x29ea, 0x322b, 0x2a0a, 0x2a0a, 0x2a0b, 0x29ea, 0x324b, 0x2a0b, 0x29ea, 0x29ea, 0x2a0a, 0x324b, 0x2a0b, 0x31e9, 0x3a6c, 0x322b, 0x322b, 0x322b, 0x3a6c, 0x29ea, 0x322b, 0x0021, 0x21a8, 0x2188, 0x2188, 0x21c9, 0x2188, 0x2188, 0x2188, 0x21a8, 0x322b, 0x322b, 0x324b, 0x320b, 0x322b, 0x2a0a, 0x2a0b, 0x324b, 0x322b, 0x322b, 0x2a0a, 0x2a0a, 0x29ea, 0x322b, 0x2a0a, 0x2a0b, 0x2a0a, 0x322b, 0x322b, 0x29ea, 0x2a0a, 0x29ea, 0x29ea, 0x324b, 0x2a0a, 0x29ea, 0x2a0b, 0x322b, 0x322b, 0x324b, 0x322b, 0x0042, 0x4c15, 0x3373, 0x5416, 0x53f3, 0x2a6c, 0x326d, 0x2a6d, 0x328d, 0x2a2c, 0x326d, 0x2a4c, 0x326d, 0x2a6d, 0x326c, 0x326d, 0x0022, 0xc4cc, 0x9b65, 0xa3c6, 0xabe7, 0xa407, 0x9ba5, 0xa3c6, 0xac07, 0x28a0, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0x83ee, 0x3a8d, 0x326c, 0x328d, 0x326d, 0x3b73, 0x43d4, 0x0042, 0x2a0a, 0x322b, 0x324b, 0x2a2b, 0x322b, 0x324c, 0x322b, 0x29ea, 0x29ea, 0x322b, 0x2a0b, 0x29ea, 0x29ea, 0x324b, 0x2a2b, 0x29ea, 0x2a0b, 0x324b, 0x2a2b, 0x322b, 0x324b, 0x322b, 0x29ea, 0x324b, 0x0862, 0x2a0a, 0x2a0b, 0x29ea, 0x322b, 0x324b, 0x2a0a, 0x2167, 0x21a8, 0x21a8, 0x2167, 0x21a8, 0x2188, 0x2188, 0x21c9, 0x322b, 0x29ea, 0x2a0a, 0x21c9, 0x2a0b, 0x2a0a, 0x324b, 0x2a0b, 0x29ea, 0x2a0a, 0x322b, 0x2a0a, 0x2a2b, 0x29ea, 0x322b, 0x2a0b, 0x2a0a, 0x2a0a, 0x322b, 0x324c, 0x2a0b, 0x324b, 0x324b, 0x29ea, 0x29ea, 0x29ea, 0x29ea, 0x322b, 0x324b, 0x2a0b, 0x2a0a, 0x322b, 0x2a0b, 0x2a0a, 0x2a0a, 0x08a4, 0x326c, 0x32ae, 0x2a2c, 0x2a6d, 0x2a6d, 0x222c, 0x2a4c, 0x2a6d, 0x2a6c, 0x326d, 0x326d, 0x326d, 0x326c, 0x2a4c, 0x1062, 0xa3c6, 0x9b85, 0xac07, 0x4960, 0xa3c6, 0xa3c6, 0xac07, 0x7263, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 
-    0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef39, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0x10a2, 0x324d, 0x328d, 0x2a4c, 0x222c, 0x3332, 0x0041, 0x322a, 0x2a0a, 0x320b, 0x29ea, 0x29ea, 0x322b, 0x322b, 0x29ea, 0x29ea, 0x2a0a, 0x2a0b, 0x322b, 0x320b, 0x2a0b, 0x2a0a, 0x2a2a, 0x29ea, 0x2a0a, 0x2a0b, 0x29ea, 0x322b, 0x322b, 0x29e9, 0x21a9, 0x322b, 0x2167, 0x322b, 0x29ea, 0x322b, 0x320b, 0x322b, 0x2a0a, 0x0862, 0x2168, 0x2168, 0x2188, 0x2187, 0x29e9, 0x2a0a, 0x320b, 0x29ea, 0x2a2b, 0x2a0a, 0x322b, 0x2a2b, 0x324c, 0x322b, 0x320b, 0x322b, 0x2a0a, 0x322b, 0x2a0b, 0x320b, 0x320b, 0x2a0a, 0x2a0a, 0x2a0b, 0x2a0a, 0x2a0b, 0x2a0a, 0x2a0b, 0x322b, 0x322b, 0x322b, 0x2a0b, 0x2a2b, 0x322b, 0x322b, 0x2a0b, 0x29ea, 0x29ea, 0x29ea, 0x2a0a, 0x3a4c, 0x322b, 0x0862, 0x0862, 0x328d, 0x326d, 0x2a6d, 0x328d, 0x326d, 0x326d, 0x326d, 0x2a6d, 0x2a4c, 0x2a4c, 0x2a4d, 0x2a4c, 0x328d, 0x10e5, 0x8b69, 0xa3e6, 0xa3e7, 0xb46a, 0xa3c6, 0xa3e6, 0xac27, 0xb489, 0xffdc, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0x62ea, 0x322a, 0x328d, 0x328d, 0x2a4c, 0x3b51, 0x0062, 0x320a, 0x324b, 0x322b, 0x322b, 0x2a0a, 0x2a2b, 0x29ea, 0x322b, 0x320b, 0x2a0b, 0x322b, 0x2a0b, 0x322b, 0x2a0b, 0x2a0a, 0x322b, 0x2a0b, 0x29ea, 0x2a0a, 0x322b, 0x322b, 0x322b, 0x324b, 0x2a0a, 0x29ea, 0x0041, 0x29ea, 0x322b, 0x21ca, 0x2a0b, 0x2a0a, 0x320b, 0x29ca, 0x1926, 0x2188, 0x1988, 0x324b, 0x2a0a, 0x322b, 0x29ea, 0x322b, 0x29ea, 0x2a0a, 0x2a0a, 0x2a0a, 0x2a0b, 0x2a0a, 0x2a0a, 0x29ea, 0x2a0a, 0x2a0b, 0x2a0a, 0x29ea, 0x2a0b, 0x320b, 0x2a0a, 0x2a0b, 0x322b, 0x29ea, 0x322b, 0x322b, 0x29ea, 0x29ea, 0x29ea, 0x2a0b, 0x322b, 0x29ea, 0x322b, 0x2a0b, 0x2a0a, 0x2a0a, 0x29ea, 0x320b, 0x322b, 0x29ea, 0x0862, 0x1967, 0x1947, 0x0862, 0x3b31, 0x326d, 0x2a4c, 0x328d, 0x2a4c, 0x220c, 0x326d, 0x328d, 0x326d, 0x326d, 0x2a6d, 0x328d, 0x29eb, 0x1062, 0xac07, 0x9ba5, 0xa408, 0x8b25, 0xabe7, 0xabe7, 0x9b65, 0x1040, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0x1062, 0x326d, 0x2a4c, 0x326d, 0x326d, 0x3b93, 0x322a, 0x322b, 0x29ea, 0x29ea, 0x29ea, 0x29ea, 0x2a0a, 0x2a0a, 0x2a2b, 0x322b, 0x322b, 0x2a0a, 0x322b, 0x2a2b, 0x322b, 0x324b, 0x29ea, 0x322b, 0x2a0a, 0x2a0a, 0x320b, 0x29ea, 0x2a0a, 0x2a0a, 0x2a0a, 0x320b, 0x0042, 0x29ea, 0x29ea, 0x21e9, 0x2a0a, 0x29ea, 0x326c, 0x2167, 0x1968, 0x2a0a, 0x322b, 0x2a0a, 0x2a0a, 0x322b, 0x2a0a, 0x29ea, 0x29ea, 0x2a0a, 0x29ea, 0x29ea, 0x2a0a, 0x29ea, 0x2a0b, 0x322b, 0x2a0b, 0x2a0a, 0x322b, 0x322b, 0x2a0b, 0x2a0a, 0x2a0a, 0x2a0a, 0x324b, 0x2a0b, 0x324b, 0x2a0a, 0x29ea, 0x29ea, 0x2a0a, 0x29ea, 0x2a0b, 0x320b, 0x322b, 0x2a0a, 0x322b, 0x2a0a, 0x322b, 0x2a0a, 0x322b, 0x3a4b, 0x21a8, 0x1967, 0x1968, 0x1988, 0x0042, 0x2a8e, 0x2a4c, 0x328d, 0x2a2c, 0x2a6d, 0x326d, 0x2a4c, 0x328d, 0x2a4c, 0x326d, 0x3ace, 0x2a4c, 0x0021, 0xa3a6, 0xa3e6, 0x38e0, 0x9386, 0xa3e6, 0xb428, 0xac07, 0x3900, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 
-    0xef19, 0xef39, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xe6b8, 0x0041, 0x2a4c, 0x326d, 0x2a4c, 0x326d, 0x0001, 0x29ea, 0x2a2a, 0x2a0b, 0x2a0a, 0x322b, 0x322b, 0x322b, 0x2a0a, 0x29ea, 0x322b, 0x2a0b, 0x29ea, 0x324c, 0x2a0a, 0x29ea, 0x2a0a, 0x29ea, 0x29ea, 0x2a0b, 0x29ea, 0x322b, 0x320b, 0x2a2a, 0x29ea, 0x322b, 0x322b, 0x3a8c, 0x322b, 0x2a0a, 0x2a0b, 0x2a0a, 0x2a0a, 0x322b, 0x0862, 0x322b, 0x322b, 0x2a0a, 0x29ca, 0x2a0a, 0x2a0a, 0x29ea, 0x320b, 0x21c9, 0x2a0b, 0x320b, 0x322b, 0x29ea, 0x322b, 0x322b, 0x2a0a, 0x322b, 0x2a0a, 0x2a0b, 0x2a0a, 0x320b, 0x2a0b, 0x29ea, 0x29ea, 0x29ea, 0x29ea, 0x324b, 0x320b, 0x2a0a, 0x2a0a, 0x2a0a, 0x320b, 0x320b, 0x2a0b, 0x2a0a, 0x320b, 0x2a0b, 0x322b, 0x2a0a, 0x322b, 0x324b, 0x0882, 0x322b, 0x29ea, 0x322b, 0x29ea, 0x2a0a, 0x4351, 0x32ad, 0x32ae, 0x2a4c, 0x2a4c, 0x2a6d, 0x2a4c, 0x2a4d, 0x2a6d, 0x2a4d, 0x326d, 0x2a4c, 0x324b, 0xc4cc, 0xa3e7, 0xac08, 0xb468, 0x9386, 0x9ba5, 0xa3c6, 0x30c0, 0xffde, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 
-    0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0x9490, 0x3aad, 0x326c, 0x324d, 0x2a2c, 0x326d, 0x322b, 0x2a0b, 0x3a8c, 0x2a0a, 0x2a0b, 0x320b, 0x2a0a, 0x1947, 0x324b, 0x2a0a, 0x29ea, 0x29ea, 0x29ea, 0x2a0a, 0x322b, 0x2a0b, 0x2a2b, 0x29ea, 0x324c, 0x322b, 0x2a0a, 0x2a0a, 0x2a2b, 0x2a0b, 0x322b, 0x2a0a, 0x0021, 0x322b, 0x322b, 0x2a0a, 0x322b, 0x2a0a, 0x320a, 0x322b, 0x29e9, 0x29ea, 0x2a0b, 0x322b, 0x324b, 0x324b, 0x322b, 0x2a0a, 0x29ea, 0x29eb, 0x322b, 0x326c, 0x29ea, 0x2a0b, 0x324b, 0x2a0b, 0x2a0a, 0x320b, 0x322b, 0x2a0b, 0x21ea, 0x320b, 0x2a0b, 0x29ea, 0x2a0a, 0x324b, 0x2a0a, 0x2a0a, 0x322b, 0x29ea, 0x2a0b, 0x322b, 0x322b, 0x322b, 0x2a0a, 0x2a0a, 0x322b, 0x2a0a, 0x320b, 0x324b, 0x322b, 0x10e5, 0x2a2b, 0x29ea, 0x2a0a, 0x2a0b, 0x2a0b, 0x2a0a, 0x0884, 0x3b10, 0x328d, 0x2a6d, 0x2a6d, 0x2a4c, 0x2a6d, 0x2a6d, 0x2a4c, 0x2a4c, 0x2a6c, 0x2a4c, 0x324c, 0x1040, 0xa3e7, 0x9b85, 0x3900, 0xac48, 0xa3c6, 0xa3c6, 0xabc6, 0x3940, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0x0000, 0x326d, 0x326d, 0x2a4c, 0x326d, 0x0042, 0x322b, 0x322b, 0x324b, 0x2a0a, 0x29ca, 0x29ea, 0x322b, 0x29c9, 0x324c, 0x2a0b, 0x2a0a, 0x322b, 0x2a0a, 0x322b, 0x2a0a, 0x29ea, 0x29ea, 0x322b, 0x29ea, 0x29ea, 0x2a0a, 0x320a, 0x2a0b, 0x324b, 0x322b, 0x29ea, 0x0062, 0x3a6c, 0x21c9, 0x324b, 0x324c, 0x322b, 0x29ea, 0x0041, 0x29ea, 0x29ea, 0x322b, 0x2a0a, 0x29ea, 0x2a0b, 0x322b, 0x29ea, 0x29ea, 0x2a0b, 0x322b, 0x322b, 0x322b, 0x320b, 0x322b, 0x322b, 0x2a0b, 0x324b, 0x322b, 0x2a0b, 0x2a2b, 0x2a0b, 0x322b, 0x2a0a, 0x322b, 0x324b, 0x2a0a, 0x322b, 0x2a0a, 0x2a0a, 0x322b, 0x29ea, 0x29ea, 0x2a0b, 0x29ea, 0x21ca, 0x29ea, 0x2a0a, 0x2a0a, 0x29ea, 0x324c, 0x08a3, 0x322b, 0x2a2b, 0x2a0a, 0x2a0b, 0x2a0b, 0x322b, 0x324b, 0x4372, 0x2a6d, 0x328d, 0x2a2c, 0x2a4d, 0x2a2c, 0x2a6c, 0x326d, 0x2a4c, 0x326d, 0x326d, 0x2a2c, 0x0021, 0xac07, 0xa3e7, 0x30c0, 0x7ac4, 0x4120, 0xa3a6, 0xa3c6, 0x4960, 0x6286, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0x0861, 0x324c, 0x2a4c, 0x2a2c, 0x328d, 0x29e9, 0x2a0a, 0x2a0b, 0x3a6c, 0x324b, 0x322b, 0x29ea, 0x08c4, 0x322b, 0x326c, 0x2a0a, 0x29ea, 0x322b, 0x2a0a, 0x322b, 0x29ea, 0x2a0a, 0x21ea, 0x29ea, 0x2a0b, 0x29ea, 0x324b, 0x320b, 0x2a0a, 0x322b, 0x2a0a, 0x0042, 0x2a0a, 0x322b, 0x21a9, 0x2a2b, 0x324b, 0x29ea, 0x322b, 0x1946, 0x320b, 0x29ea, 0x29ea, 0x322b, 0x2a0a, 0x29ea, 0x2a0a, 0x320b, 0x2a0b, 0x2a0a, 0x324b, 0x322b, 0x322b, 0x29ea, 0x2a0b, 0x29ea, 0x322b, 0x2a0b, 0x2a2b, 0x322b, 0x324b, 0x29ea, 0x2a0a, 0x2a0b, 0x2a0a, 0x324b, 0x29ea, 0x2a0b, 0x21ca, 0x2a0a, 0x2a0a, 0x2a0a, 0x2a0a, 0x322b, 0x322b, 0x2a0a, 0x322b, 0x21ea, 0x322b, 0x29ea, 0x3209, 0x29ea, 0x2a0a, 0x2a2b, 0x29ea, 0x322b, 0x29ea, 0x322b, 0x2a2b, 0x0083, 0x2a6d, 0x2a4c, 0x2a4d, 0x3ace, 0x328d, 0x2a4c, 0x326d, 0x2a6d, 0x326d, 0x2a2c, 0x324c, 0x1062, 0x9b85, 0xa3c6, 0xb448, 0x4100, 0xbcaa, 0x5180, 0xabe7, 0xac07, 0x2880, 0xfffe, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xf719, 0xf739, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef8, 0xffde, 0x08a4, 0x328d, 0x2a2c, 0x326c, 0x0021, 0x2a2b, 0x2a2b, 0x21ea, 0x3a4b, 0x2a0b, 0x2a0a, 0x21c9, 0x21a8, 0x2a0b, 0x2a0a, 0x324b, 0x29ea, 0x29ea, 0x29ea, 0x2a0b, 0x2a0a, 0x29ea, 0x322b, 0x29ea, 0x2a0b, 0x2a0b, 0x324c, 0x322b, 0x322b, 0x322b, 0x322b, 0x0883, 0x29ea, 0x2a0a, 0x29ea, 0x322b, 0x322b, 0x320b, 0x0842, 0x322b, 0x2a0a, 0x322b, 0x324b, 0x322b, 0x29ea, 0x2a0a, 0x2a0b, 0x2a2b, 0x2a0a, 0x2a0b, 0x324b, 0x322b, 0x322b, 0x2a2b, 0x322b, 0x322b, 0x29ea, 0x21ea, 0x29ea, 0x29ea, 0x2a2b, 0x322b, 0x2a0a, 0x320b, 0x2a0a, 0x2a0a, 0x320b, 0x29ea, 0x324c, 0x322b, 0x29ea, 0x29ea, 0x29ca, 0x320b, 0x2a0b, 0x29ea, 0x2a0a, 0x322b, 0x322b, 0x322b, 0x0862, 0x322b, 0x322b, 0x29ea, 0x322b, 0x322b, 0x322b, 0x29ea, 0x29ea, 0x08a3, 0x32ae, 0x2a6d, 0x2a4d, 0x32ad, 0x2a2c, 0x326d, 0x2a4c, 0x2a4c, 0x328d, 0x2a2b, 0x2a2c, 0x0842, 0x9ba6, 0xa3e6, 0xa3e6, 0x3900, 0x38e0, 0xb489, 0x7282, 0xac07, 0xa3c6, 0x3900, 0xfffd, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0x0820, 0xe6d8, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 
-    0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0x0000, 0x3a8c, 0x326d, 0x326d, 0x2a2c, 0x1905, 0x2a0a, 0x2a0b, 0x29ea, 0x3209, 0x322b, 0x2a0a, 0x08a3, 0x2167, 0x2a0a, 0x29ea, 0x29ea, 0x2a0a, 0x324b, 0x29ea, 0x2a2b, 0x324b, 0x322b, 0x2a0a, 0x320a, 0x2a0b, 0x29ea, 0x2a0a, 0x324b, 0x21e9, 0x2a0a, 0x1946, 0x29ea, 0x2a0a, 0x320b, 0x324c, 0x2a0a, 0x322b, 0x322b, 0x0042, 0x2a0a, 0x324b, 0x2a0a, 0x2a0b, 0x2a0b, 0x29ea, 0x322b, 0x29ea, 0x322b, 0x322b, 0x2a0a, 0x2a0a, 0x322b, 0x2a0b, 0x322b, 0x29ea, 0x21a9, 0x3a4b, 0x324b, 0x2a0b, 0x322b, 0x29ea, 0x322b, 0x322b, 0x322b, 0x322b, 0x2a0a, 0x21ca, 0x2a0a, 0x2a0a, 0x29ea, 0x322b, 0x29ea, 0x322b, 0x322b, 0x324b, 0x2a2b, 0x29ea, 0x2a2b, 0x2a0a, 0x3a6c, 0x3a6c, 0x2a0b, 0x2a0a, 0x2a0a, 0x29ea, 0x2a0a, 0x322b, 0x322b, 0x2a0a, 0x31ea, 0x3b10, 0x2a6d, 0x2a4c, 0x2a4c, 0x2a4c, 0x2a4c, 0x2a6d, 0x324d, 0x326d, 0x326d, 0x2a4c, 0x0021, 0x7ac3, 0xabe7, 0xa3c6, 0x6a42, 0xeef9, 0x28e0, 0xac08, 0xa3e7, 0xa3c6, 0xabe7, 0x3900, 0x6aa6, 0xef18, 0xef19, 0xeef9, 0xfffe, 0x2080, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0x1083, 0x2a4c, 0x2a4c, 0x2a2c, 0x0000, 0x21c9, 0x29ea, 0x320a, 0x29ea, 0x10e5, 0x2a0a, 0x29ea, 0x1967, 0x2a0a, 0x324b, 0x29ea, 0x322b, 0x2a2b, 0x2a0b, 0x2a0a, 0x322b, 0x2a0a, 0x2a0a, 0x2a0b, 0x2a0b, 0x29ea, 0x322b, 0x322b, 0x322b, 0x29ca, 0x2a2b, 0x0842, 0x322b, 0x322b, 0x2a0a, 0x324b, 0x320b, 0x29ea, 0x3a6b, 0x322b, 0x2a0b, 0x322b, 0x2a0a, 0x322b, 0x29ea, 0x29ea, 0x322b, 0x29ea, 0x2a0a, 0x2a0a, 0x322b, 0x324b, 0x322b, 0x2a0a, 0x322b, 0x5435, 0x3bb4, 0x3373, 0x3373, 0x3b74, 0x5435, 0x21eb, 0x0083, 0x29c9, 0x3a8c, 0x2a0a, 0x29ea, 0x322b, 0x29ea, 0x29ea, 0x29ea, 0x2a0a, 0x2a0a, 0x2a0b, 0x324b, 0x29ea, 0x322b, 0x21c9, 0x2a0a, 0x2a0a, 0x0041, 0x2a0a, 0x322b, 0x2a2b, 0x322b, 0x2a0a, 0x2a0a, 0x2a0a, 0x2a0a, 0x324b, 0x324b, 0x3b31, 0x328d, 0x2a2c, 0x2a6d, 0x2a4c, 0x2a4d, 0x328e, 0x2a6c, 0x2a4c, 0x324c, 0x2a2b, 0x0082, 0xbca9, 0xac07, 0xac07, 0x9b85, 0x0000, 0xef19, 0x93ec, 0x3921, 0x8325, 0xa3a6, 0xa3c6, 0xb448, 0x59e1, 0x38e0, 0x6243, 0x0800, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef8, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef8, 0x0841, 0x326c, 0x328d, 0x324c, 0x10c3, 0x1947, 0x29ea, 0x2a0a, 0x2a0a, 0x0042, 0x2a0a, 0x08c4, 0x2188, 0x3a6c, 0x29ea, 0x322b, 0x324b, 0x29ea, 0x2a0a, 0x2a0a, 0x2a2b, 0x322b, 0x2a0b, 0x29ea, 0x2a2b, 0x322b, 0x322b, 0x322b, 0x2a0a, 0x29ea, 0x0041, 0x2a0a, 0x2a0a, 0x322b, 0x322b, 0x2a0a, 0x29ea, 0x322b, 0x0862, 0x324b, 0x2a0a, 0x29ea, 0x322b, 0x322b, 0x2a0b, 0x2a0a, 0x2a0a, 0x2a2b, 0x2a0a, 0x2a0b, 0x320b, 0x29ea, 0x2a0a, 0x21a9, 0x29ea, 0x43f5, 0x3394, 0x3b94, 0x3bb4, 0x3b94, 0x3374, 0x3bd5, 0x3bb4, 0x3353, 0x3394, 0x2a2b, 0x324b, 0x29ea, 0x2a0a, 0x2a0b, 0x2a0b, 0x322b, 0x2a0a, 0x322b, 0x2a2b, 0x21c9, 0x322b, 0x322b, 0x29ea, 0x29ea, 0x1906, 0x322b, 0x2a0b, 0x2a2b, 0x29ea, 0x2a0b, 0x324b, 0x29ea, 0x322b, 0x2a0a, 0x29ea, 0x3b30, 0x2a6d, 0x326d, 0x328d, 0x328d, 0x326d, 0x2a4c, 0x326d, 0x326c, 0x2a2c, 0x2a2b, 0x10c4, 0xbcab, 0x4960, 0x9ba6, 0xa3e7, 0x30a0, 0xffdd, 0xeef9, 0xeef8, 0xacd0, 0x30e0, 0x3900, 0x30c0, 0x30e0, 0x1840, 0xffde, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xff9c, 0x10c4, 0x326c, 0x2a4c, 0x3a6c, 0x1946, 0x2167, 0x2a0a, 0x322b, 0x2a0b, 0x0862, 0x21c9, 0x1947, 0x21c9, 0x322b, 0x3a6c, 0x322b, 0x2a0a, 0x322b, 0x322b, 0x320b, 0x2a0a, 0x2a0a, 0x21ea, 0x324b, 0x2a0a, 0x324b, 0x2a0a, 0x29ea, 0x324b, 0x2a2b, 0x10e4, 0x2a0a, 0x322b, 0x29ea, 0x29ea, 0x29ea, 0x322b, 0x3a4b, 0x29e9, 0x2a2b, 0x322b, 0x2a0a, 0x2a0a, 0x2a0a, 0x2a0a, 0x322b, 0x29ea, 0x322b, 0x2a0a, 0x322b, 0x29ea, 0x2a2b, 0x2a0a, 0x322b, 0x3a2b, 0x3bd5, 0x3373, 0x0000, 0x19ca, 0x4bf5, 0x3bb4, 0x3373, 0x3bb5, 0x2b52, 0x3bb4, 0x220b, 0x2a0b, 0x320b, 0x322b, 0x29ea, 0x324b, 0x2a0a, 0x2a0b, 0x2a0a, 0x29ea, 0x322b, 0x2a0a, 0x324b, 0x322b, 0x1946, 0x29ea, 0x29ea, 0x322b, 0x322b, 0x322b, 0x2a0b, 0x2a0a, 0x21ca, 0x2a0a, 0x2a0a, 0x2a2b, 0x42ef, 0x328e, 0x2a6d, 0x2a6d, 0x326d, 0x2a4c, 0x2a4c, 0x2a2c, 0x2a4c, 0x2a2c, 0x2a4c, 0x10e4, 0x30e0, 0xa3e6, 0x5180, 0x9ba6, 0xa3a5, 0x4141, 0xf719, 0xeef8, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0x0840, 0x3a4b, 0x324c, 0x2a4c, 0x0862, 0x1967, 0x1967, 0x1967, 0x322b, 0x2a0a, 0x0862, 0x08a3, 0x1967, 0x2a0b, 0x2a0a, 0x322b, 0x29ca, 0x21c9, 0x2a0a, 0x2a0a, 0x2a0a, 0x2a0a, 0x29ea, 0x2a0b, 0x29ea, 0x324b, 0x322b, 0x324b, 0x324b, 0x322b, 0x0021, 0x322b, 0x21ea, 0x322b, 0x2a0a, 0x2a0a, 0x29ea, 0x322b, 0x0021, 0x21ea, 0x2a0a, 0x2a0a, 0x324b, 0x3a4b, 0x322b, 0x2a0a, 0x320b, 0x2a0a, 0x322b, 0x29ea, 0x29ea, 0x29ea, 0x322b, 0x2a0a, 0x2a0a, 0x0906, 0x3b94, 0x4c57, 0x2a2a, 0x29ea, 0x29ea, 0x2a0a, 0x3a6b, 0x3b94, 0x3373, 0x3394, 0x2188, 0x29ea, 0x2a0b, 0x2a0a, 0x2a0a, 0x320b, 0x29ea, 0x2a0a, 0x29ea, 0x2a0a, 0x2a0a, 0x29ea, 0x2a0b, 0x2a0a, 0x0862, 0x2a0b, 0x2a0b, 0x2a0a, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0a, 0x29ea, 0x322b, 0x2a0a, 0x21ca, 0x1988, 0x328d, 0x3aae, 0x2a4c, 0x2a4c, 0x326d, 0x2a2c, 0x326d, 0x2a4c, 0x2a2c, 0x324c, 0x10a3, 0x5a45, 0x9386, 0xa3a6, 0x59e0, 0xabe7, 0xbcca, 0x1000, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef8, 0x0021, 0x326c, 0x328d, 0x326d, 0x0883, 0x1946, 0x2187, 0x1966, 0x2a0b, 0x21a9, 0x0841, 0x2188, 0x21a8, 0x29ea, 0x29ea, 0x320b, 0x322b, 0x2a2a, 0x2a0a, 0x324b, 0x2a0a, 0x29ea, 0x2a0a, 0x2a2a, 0x2a0a, 0x322b, 0x2a0a, 0x322b, 0x320b, 0x29ea, 0x08a3, 0x324b, 0x29ca, 0x2a0a, 0x2a0a, 0x322b, 0x2a0a, 0x29ea, 0x0883, 0x2a0a, 0x322b, 0x29ea, 0x29ea, 0x2a0a, 0x322b, 0x2a0a, 0x320b, 0x2a0b, 0x2a0a, 0x2a0a, 0x320b, 0x29ea, 0x2a0a, 0x29ea, 0x2a0a, 0x3b93, 0x3bb5, 0x0021, 0x322b, 0x29ea, 0x322b, 0x29ea, 0x08a4, 0x3bb4, 0x3b94, 0x4bf6, 0x29ea, 0x2a0b, 0x322b, 0x324b, 0x2a0a, 0x29ea, 0x2a0b, 0x21c9, 0x320b, 0x2a0a, 0x322b, 0x2a0b, 0x29ea, 0x320b, 0x320a, 0x2a0a, 0x320b, 0x324b, 0x324c, 0x29ea, 0x322b, 0x320b, 0x322b, 0x322b, 0x322b, 0x322b, 0x0083, 0x326d, 0x328d, 0x2a4d, 0x328d, 0x2a4c, 0x326d, 0x2a4c, 0x2a4c, 0x326d, 0x2a2b, 0x10c3, 0xb573, 0x1020, 0x7283, 0xac07, 0x4120, 0xa3e7, 0x8b24, 0x1020, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef18, 0x0862, 0x2a4c, 0x2a2c, 0x1105, 0x2188, 0x1967, 0x2187, 0x1946, 0x1967, 0x2187, 0x0061, 0x1967, 0x29e9, 0x2a0a, 0x322b, 0x29ea, 0x2a0a, 0x2a0b, 0x2a0a, 0x2a0b, 0x322b, 0x322b, 0x29ea, 0x324b, 0x2a0a, 0x2a0a, 0x29ea, 0x2a0b, 0x2a2b, 0x08a3, 0x29ea, 0x2a0a, 0x2a0a, 0x322b, 0x2a0a, 0x322b, 0x322b, 0x2167, 0x2a0a, 0x29ea, 0x2a0a, 0x322b, 0x3a6c, 0x322b, 0x322b, 0x324b, 0x320b, 0x29ea, 0x29ea, 0x322b, 0x2a0a, 0x29ea, 0x29ea, 0x2a0a, 0x29c9, 0x3394, 0x3bd5, 0x3a2b, 0x29c9, 0x320a, 0x322b, 0x322b, 0x3bd5, 0x3bd5, 0x3b73, 0x0001, 0x21ea, 0x322b, 0x2a2a, 0x326c, 0x2a0b, 0x322b, 0x29ea, 0x1106, 0x320b, 0x29ea, 0x2a0b, 0x324b, 0x320b, 0x322a, 0x322b, 0x2a0a, 0x322b, 0x322b, 0x29ea, 0x322b, 0x3a6c, 0x2a0a, 0x324b, 0x322b, 0x2a2b, 0x21ea, 0x0042, 0x2a4c, 0x326d, 0x2a4c, 0x2a6d, 0x2a4d, 0x2a6d, 0x2a4c, 0x326d, 0x328d, 0x29ea, 0x10c4, 0xa4d1, 0xef18, 0xffbc, 0x4120, 0xb449, 0xa3c6, 0xac28, 0x7282, 0x28a0, 0x20c0, 0xef19, 0xeef8, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0x1082, 0x220b, 0x324c, 0x0841, 0x2167, 0x1946, 0x2187, 0x2167, 0x1946, 0x2167, 0x2167, 0x21a9, 0x2a0a, 0x322b, 0x324b, 0x21ca, 0x2a0b, 0x2a0a, 0x322b, 0x29ea, 0x29ea, 0x2a0b, 0x2a0b, 0x21ca, 0x2a0a, 0x320b, 0x29ea, 0x322b, 0x322b, 0x0041, 0x29ea, 0x29ea, 0x322b, 0x2a0a, 0x2a2b, 0x322b, 0x2a0b, 0x0882, 0x2a0a, 0x322b, 0x29ea, 0x322b, 0x2a0b, 0x322b, 0x2a0a, 0x29ea, 0x324c, 0x3a6c, 0x2a0a, 0x2a2b, 0x2a0a, 0x322b, 0x21ea, 0x2a0a, 0x3b31, 0x3bb4, 0x3394, 0x3353, 0x43d5, 0x4bf4, 0x19ca, 0x3b72, 0x3bf5, 0x3b94, 0x3bb4, 0x320a, 0x2a0a, 0x2a0a, 0x2a0b, 0x2a0b, 0x2a0a, 0x2a2b, 0x322b, 0x1947, 0x2a2b, 0x2a0a, 0x2a0a, 0x322b, 0x2a0a, 0x0041, 0x2a0a, 0x29ea, 0x322b, 0x2a2b, 0x29ea, 0x2a0b, 0x21ea, 0x322b, 0x322b, 0x29ea, 0x2a0a, 0x29ea, 0x0021, 0x2a4c, 0x2a6d, 0x222c, 0x326d, 0x2a4c, 0x2a4c, 0x2a4c, 0x2a4c, 0x324c, 0x2188, 0x1905, 0xad33, 0xeef9, 0xeef9, 0xef19, 0x1040, 0x38e0, 0x72a3, 0xbc8a, 0xac28, 0xac69, 0x51a1, 0x3901, 0xaccf, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef8, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xe6f8, 0x0041, 0x2a2b, 0x324c, 0x2146, 0x1946, 0x1946, 0x1967, 0x1946, 0x2167, 0x0021, 0x1967, 0x2a2b, 0x322b, 0x322b, 0x322b, 0x2a0a, 0x2a0a, 0x2a0b, 0x21c9, 0x2a0b, 0x320b, 0x2a0a, 0x2a0a, 0x2a0a, 0x320b, 0x21ca, 0x2a0a, 0x29ea, 0x0862, 0x2a0a, 0x2a0a, 0x324c, 0x2a0a, 0x320b, 0x2a0b, 0x2a2b, 0x3a6b, 0x3a4b, 0x29ea, 0x2a0a, 0x320b, 0x29ea, 0x320b, 0x29ea, 0x2a0a, 0x2a0a, 0x2a2b, 0x2a2b, 0x2a0a, 0x2a0a, 0x322b, 0x2a0a, 0x29ea, 0x324c, 0x3353, 0x3373, 0x3bb4, 0x3374, 0x3bb4, 0x3373, 0x3bd4, 0x3b94, 0x43d5, 0x3bb5, 0x4c16, 0x29ea, 0x29ea, 0x29ea, 0x322b, 0x2a0a, 0x2a0b, 0x2a0a, 0x320b, 0x29e9, 0x2a0a, 0x2a0b, 0x320b, 0x322b, 0x2a0b, 0x29a8, 0x2a0b, 0x21ca, 0x324b, 0x2a0a, 0x322b, 0x320b, 0x322b, 0x324c, 0x322b, 0x322b, 0x2a0a, 0x322b, 0x0041, 0x326d, 0x2a4d, 0x2a6c, 0x2a6d, 0x2a4c, 0x2a4c, 0x2a4c, 0x2a4c, 0x2a4c, 0x2188, 0x10c4, 0xad53, 0xeef9, 0xeef8, 0xeef9, 0xef19, 0xef19, 0xe6f9, 0xef19, 0xf73a, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xef19, 0xeef9, 0xef19, 0xeef9, 0xf719, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xffde, 0x1105, 0x2a2c, 0x3a6c, 0x1946, 0x1946, 0x1926, 0x1946, 0x1926, 0x0841, 0x1947, 0x2a2b, 0x2a0a, 0x322b, 0x322b, 0x3a6c, 0x2a0a, 0x322b, 0x322b, 0x324b, 0x322b, 0x2a0a, 0x322b, 0x2a0a, 0x322b, 0x322b, 0x2a2b, 0x29ea, 0x322b, 0x0021, 0x322b, 0x2a2b, 0x29ea, 0x324b, 0x322b, 0x320b, 0x29ea, 0x0862, 0x2a0a, 0x2a0a, 0x2a0b, 0x29ea, 0x2a0a, 0x2a0b, 0x320b, 0x2a0a, 0x2a0a, 0x2a0a, 0x2a0a, 0x320b, 0x2a0a, 0x2a2b, 0x29ea, 0x29ea, 0x29c9, 0x0063, 0x2a4c, 0x5414, 0x5456, 0x3b94, 0x3353, 0x43d5, 0x3373, 0x3373, 0x3bb4, 0x0022, 0x2a0b, 0x29ea, 0x322b, 0x29ea, 0x29ea, 0x2a0a, 0x322b, 0x2a0b, 0x29c9, 0x322b, 0x2a0a, 0x322b, 0x2a0a, 0x322a, 0x2a2b, 0x2a0b, 0x29ca, 0x2a0b, 0x322b, 0x2a2a, 0x322b, 0x29ea, 0x2a0a, 0x324b, 0x2a0a, 0x322b, 0x2a0b, 0x0042, 0x326d, 0x2a6d, 0x2a6c, 0x2a6d, 0x2a4c, 0x2a2c, 0x326d, 0x2a4c, 0x326c, 0x2167, 0x0883, 0xce37, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef39, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0x7b8c, 0x42cd, 0x2a2c, 0x0021, 0x2167, 0x1946, 0x2167, 0x1946, 0x1947, 0x0842, 0x1967, 0x320b, 0x2a0b, 0x2a0b, 0x320b, 0x322b, 0x29ea, 0x2a0a, 0x29ca, 0x322b, 0x2a0a, 0x322b, 0x320b, 0x29ea, 0x322b, 0x2a0a, 0x29ea, 0x2a0a, 0x322a, 0x324b, 0x322b, 0x2a0a, 0x322b, 0x320b, 0x29ea, 0x322b, 0x3a4b, 0x0883, 0x2a0a, 0x29ea, 0x324b, 0x2a0a, 0x2a0b, 0x322b, 0x2a0a, 0x2a0b, 0x29ea, 0x2a0a, 0x322b, 0x320b, 0x29ea, 0x322b, 0x322b, 0x324c, 0x324b, 0x2a2b, 0x2a0b, 0x29ca, 0x2a0a, 0x324b, 0x324b, 0x2188, 0x0021, 0x08c6, 0x53f3, 0x322a, 0x320a, 0x322b, 0x2a0b, 0x2a0b, 0x2a0a, 0x2a0b, 0x2a0a, 0x322b, 0x29ea, 0x21a8, 0x322b, 0x2a0a, 0x29ea, 0x0041, 0x322b, 0x320b, 0x324b, 0x2a0b, 0x2188, 0x21a8, 0x2a0a, 0x324b, 0x2a0a, 0x322b, 0x2a0a, 0x29ea, 0x29ea, 0x0062, 0x2a2c, 0x328d, 0x2a6d, 0x2a2c, 0x2a4c, 0x2a4c, 0x2a6c, 0x2a4c, 0x2a2c, 0x1967, 0x08a3, 0xffbd, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 
-    0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0x0000, 0x326c, 0x2a4c, 0x10a3, 0x1947, 0x1926, 0x1126, 0x1946, 0x0841, 0x1947, 0x2a0a, 0x2a0a, 0x324b, 0x29ea, 0x2a2b, 0x322b, 0x21c9, 0x29ea, 0x21a9, 0x322b, 0x322b, 0x322b, 0x324b, 0x324b, 0x322b, 0x21c9, 0x29ea, 0x324b, 0x0882, 0x2a0a, 0x2a0b, 0x320b, 0x322b, 0x2a0b, 0x322b, 0x2a0b, 0x0021, 0x2a0a, 0x322b, 0x322b, 0x29ea, 0x2a0b, 0x29ea, 0x2a0b, 0x2a0a, 0x322b, 0x29ca, 0x29ea, 0x322b, 0x2a0a, 0x320b, 0x2a2b, 0x322b, 0x322b, 0x2a0a, 0x29ea, 0x2a0a, 0x2a0a, 0x322b, 0x322b, 0x21a9, 0x3a4c, 0x2a0b, 0x324b, 0x324b, 0x322b, 0x2a0a, 0x29ea, 0x320b, 0x2a0a, 0x322b, 0x322b, 0x2a0a, 0x29ea, 0x29ea, 0x1905, 0x2a0a, 0x2a0a, 0x2a0a, 0x1926, 0x324b, 0x320b, 0x320b, 0x1988, 0x21a8, 0x29ea, 0x2a0a, 0x21c9, 0x2a0a, 0x21c9, 0x2a0b, 0x322b, 0x322b, 0x0883, 0x32ae, 0x326d, 0x2a4c, 0x326d, 0x326d, 0x328d, 0x2a4c, 0x2a2c, 0x324c, 0x1967, 0x0862, 0xffde, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0x1062, 0x322c, 0x3aad, 0x2146, 0x1946, 0x1926, 0x1966, 0x1966, 0x0041, 0x21a9, 0x2a0a, 0x2a0a, 0x322b, 0x324b, 0x322b, 0x322b, 0x2a0a, 0x29ea, 0x2a0a, 0x29ea, 0x2a0a, 0x322b, 0x2a0a, 0x322b, 0x29ea, 0x2a0b, 0x324b, 0x326b, 0x2187, 0x2a2b, 0x2a0b, 0x320b, 0x2a0a, 0x2a0a, 0x324b, 0x29ea, 0x0042, 0x2a0a, 0x2a2b, 0x320b, 0x322b, 0x21ca, 0x29ea, 0x2a0a, 0x322b, 0x21ea, 0x322b, 0x29ea, 0x324b, 0x2a0a, 0x2a0a, 0x322b, 0x322b, 0x322b, 0x29ea, 0x2a0a, 0x29ea, 0x2a2b, 0x2a0a, 0x320b, 0x2a2b, 0x2a0b, 0x322b, 0x324b, 0x2a0a, 0x2a0b, 0x2a0a, 0x322b, 0x322b, 0x2a0a, 0x320b, 0x2a0a, 0x2a0a, 0x322b, 0x29ea, 0x2167, 0x2a0a, 0x2a0a, 0x2a2a, 0x322b, 0x29ea, 0x29ca, 0x21a8, 0x2188, 0x1988, 0x29ea, 0x2a2b, 0x2a0a, 0x322b, 0x21ea, 0x320b, 0x29ea, 0x322b, 0x10c4, 0x2a4c, 0x326d, 0x326d, 0x2a4c, 0x2a6d, 0x326d, 0x2a4c, 0x326c, 0x19a9, 0x1947, 0x0042, 0xfffe, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 
-    0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0x0021, 0x2a4c, 0x0041, 0x1926, 0x1946, 0x1947, 0x1946, 0x0841, 0x1947, 0x322b, 0x2a0a, 0x2a0a, 0x2a0b, 0x322b, 0x322b, 0x21c9, 0x2a0b, 0x29ea, 0x2a0b, 0x29ea, 0x21ca, 0x2a2a, 0x322b, 0x2a2b, 0x2a0a, 0x2a0b, 0x29ea, 0x0021, 0x2a0a, 0x2a0a, 0x322b, 0x2a0a, 0x2a0b, 0x2a0a, 0x29ea, 0x3a6b, 0x322b, 0x2a0a, 0x2a0a, 0x322b, 0x3a6c, 0x2a0a, 0x2a0a, 0x322b, 0x2a0a, 0x2a2b, 0x29ea, 0x322b, 0x29ea, 0x3a4c, 0x2a0a, 0x29ea, 0x29ea, 0x322b, 0x324b, 0x21c9, 0x2a2b, 0x324b, 0x2a0b, 0x2a0a, 0x2a0a, 0x322b, 0x322b, 0x322b, 0x2a0b, 0x324b, 0x320b, 0x2a0a, 0x21c9, 0x322b, 0x2a0a, 0x322b, 0x322b, 0x2a0a, 0x2a0a, 0x29ea, 0x21c9, 0x2a0a, 0x10e4, 0x29e9, 0x2188, 0x21a8, 0x1967, 0x10e5, 0x2167, 0x29ca, 0x2a2a, 0x2a0a, 0x2a0b, 0x2a0b, 0x322b, 0x322b, 0x322b, 0x08a3, 0x32ae, 0x2a6d, 0x326d, 0x2a2c, 0x2a2c, 0x324d, 0x2a4c, 0x2a2c, 0x1967, 0x1947, 0x0041, 0xf75a, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 
-    0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xffff, 0x1946, 0x2a2b, 0x0841, 0x1946, 0x1946, 0x1946, 0x1947, 0x0861, 0x29ea, 0x322b, 0x2a0a, 0x29ea, 0x322b, 0x2a0a, 0x2a0b, 0x2a0a, 0x29ea, 0x324b, 0x2a0a, 0x322b, 0x2a0b, 0x2a0a, 0x324b, 0x322b, 0x322b, 0x2a0a, 0x324b, 0x0021, 0x322b, 0x29ea, 0x2a0a, 0x320a, 0x320b, 0x322b, 0x322b, 0x0021, 0x29eb, 0x320b, 0x320b, 0x322b, 0x2a0a, 0x324b, 0x2a0a, 0x2a2b, 0x2a0a, 0x29ea, 0x322b, 0x2a0a, 0x2a0b, 0x2a0a, 0x2a0a, 0x2a0a, 0x29ea, 0x2a0b, 0x322b, 0x324b, 0x322b, 0x29ea, 0x2a0a, 0x29ea, 0x2a0b, 0x2a2b, 0x2a0b, 0x322b, 0x322b, 0x2a0a, 0x2a0a, 0x2a0a, 0x21a9, 0x322b, 0x322b, 0x322b, 0x322b, 0x322b, 0x2a0a, 0x29ea, 0x21a9, 0x1967, 0x0862, 0x1967, 0x21a9, 0x2168, 0x2167, 0x2187, 0x2a0a, 0x29ea, 0x2a0a, 0x2a0a, 0x2a0a, 0x320b, 0x322b, 0x322b, 0x2a0a, 0x0883, 0x2a6d, 0x2a4c, 0x2a4d, 0x2a4c, 0x2a4c, 0x2a2c, 0x2a4c, 0x2a4c, 0x1966, 0x1947, 0x0862, 0xe6f8, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 
-    0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xeef9, 0xeef8, 0x0840, 0x3a6c, 0x2a2b, 0x0882, 0x1105, 0x1946, 0x1947, 0x0862, 0x1105, 0x2a0a, 0x2a0b, 0x2a0a, 0x2a0a, 0x29ea, 0x324b, 0x322b, 0x2a0a, 0x2a0a, 0x2a0a, 0x322b, 0x322b, 0x2a0a, 0x2a0a, 0x2a0a, 0x2a0b, 0x322b, 0x29c9, 0x3a6b, 0x3a4c, 0x324b, 0x2a0a, 0x322b, 0x29ea, 0x29ea, 0x2a2b, 0x2a0b, 0x0042, 0x322b, 0x29ea, 0x29ea, 0x29ea, 0x21c9, 0x2a0a, 0x29ca, 0x2a0b, 0x29ea, 0x2a0b, 0x2a0b, 0x322b, 0x29ea, 0x2a0b, 0x324b, 0x322b, 0x322b, 0x2a0a, 0x29ea, 0x324b, 0x322b, 0x324b, 0x2a0a, 0x2a0a, 0x2a0a, 0x29ea, 0x2a0a, 0x322b, 0x2a0a, 0x322b, 0x322b, 0x2a0a, 0x2a2b, 0x29ea, 0x29ea, 0x2a0a, 0x320b, 0x2a0b, 0x322b, 0x2a0a, 0x2188, 0x29a9, 0x08c3, 0x2187, 0x1967, 0x2167, 0x1105, 0x2188, 0x322b, 0x320b, 0x322b, 0x320b, 0x29ea, 0x2a0b, 0x322b, 0x2a0b, 0x29ea, 0x08a3, 0x2a6d, 0x2a4c, 0x2a6d, 0x328d, 0x2a4c, 0x2a4c, 0x2a6c, 0x2a2b, 0x2187, 0x2167, 0x0862, 0xe6d8, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xeef9, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19, 0xef19
+static const uint8_t winkCloseImageData[26432] PROGMEM = {
+    0x85, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x01, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x86, 0x00,
+    0x81, 0x01, 0x82, 0x00, 0x81, 0x01, 0x88, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x81, 0x01, 0x89,
+    0x00, 0x82, 0x01, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x85, 0x00, 0x84, 0x01, 0x00,
+    0x00, 0x81, 0x01, 0x82, 0x00, 0x81, 0x01, 0x01, 0x00, 0x01, 0x82, 0x00, 0x81, 0x01, 0x82, 0x00,
+    0x81, 0x01, 0x01, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x86, 0x00, 0x00,
+    0x01, 0x82, 0x00, 0x81, 0x01, 0x00, 0x00, 0x81, 0x01, 0x86, 0x00, 0x00, 0x01, 0x83, 0x00, 0x04,
+    0x01, 0x00, 0x01, 0x00, 0x01, 0x88, 0x00, 0x81, 0x01, 0x00, 0x00, 0x81, 0x01, 0x81, 0x01, 0x81,
+    0x00, 0x00, 0x01, 0x91, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x85, 0x00,
+    0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0x82, 0x00,
+    0x81, 0x01, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00, 0x82, 0x01, 0x00, 0x00, 0x86, 0x01, 0x03, 0x00,
+    0x01, 0x00, 0x01, 0x81, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x82, 0x01, 0x81, 0x00, 0x81, 0x01,
+    0x87, 0x00, 0x81, 0x01, 0x84, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x85, 0x00, 0x82, 0x01,
+    0x85, 0x00, 0x81, 0x01, 0x03, 0x00, 0x01, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00, 0x81,
+    0x01, 0x01, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01,
+    0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x01, 0x00, 0x83, 0x01, 0x82, 0x00, 0x81, 0x01, 0x82,
+    0x00, 0x02, 0x01, 0x00, 0x01, 0x82, 0x00, 0x00, 0x17, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02,
+    0x01, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x00, 0x00,
+    0x82, 0x01, 0x00, 0x17, 0x83, 0x01, 0x00, 0x00, 0x81, 0x17, 0x00, 0x01, 0x81, 0x00, 0x83, 0x01,
+    0x00, 0x17, 0x81, 0x01, 0x81, 0x17, 0x01, 0x00, 0x17, 0x82, 0x01, 0x81, 0x00, 0x88, 0x01, 0x83,
+    0x00, 0x83, 0x01, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00, 0x82, 0x01, 0x87, 0x00, 0x00, 0x01, 0x82,
+    0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x85, 0x00, 0x00, 0x01, 0x82, 0x00, 0x81, 0x01, 0x86,
+    0x00, 0x02, 0x01, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x83, 0x00, 0x89, 0x00, 0x81, 0x01, 0x01,
+    0x00, 0x01, 0x81, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x82, 0x01, 0x8b, 0x00, 0x00, 0x01, 0x83,
+    0x00, 0x00, 0x01, 0x82, 0x00, 0x81, 0x01, 0x82, 0x00, 0x83, 0x01, 0x00, 0x00, 0x83, 0x01, 0x00,
+    0x00, 0x83, 0x01, 0x00, 0x00, 0x81, 0x17, 0x06, 0x01, 0x87, 0x97, 0x45, 0xff, 0x41, 0xe6, 0x27,
+    0x98, 0x83, 0x70, 0x00, 0xff, 0x10, 0x83, 0x81, 0x88, 0x09, 0x32, 0x27, 0xff, 0x4a, 0x26, 0xff,
+    0xf7, 0x9d, 0xff, 0xf7, 0x7b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x81, 0x01, 0x00, 0x17, 0x84, 0x01,
+    0x01, 0x17, 0x00, 0x81, 0x01, 0x82, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x85, 0x00, 0x00, 0x01,
+    0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x8a, 0x00,
+    0x81, 0x01, 0x82, 0x00, 0x04, 0x01, 0x00, 0x01, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00,
+    0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x85, 0x00, 0x81, 0x01, 0x85, 0x00, 0x00, 0x01,
+    0x88, 0x00, 0x00, 0x01, 0x8a, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x01, 0x01,
+    0x17, 0x87, 0x01, 0x0b, 0x00, 0x17, 0x45, 0x27, 0x62, 0x21, 0x32, 0x40, 0x29, 0x02, 0x07, 0x05,
+    0x81, 0x02, 0x0d, 0x04, 0x05, 0x02, 0x05, 0x02, 0x05, 0x69, 0x29, 0x32, 0x63, 0x58, 0xa0, 0x5e,
+    0xd1, 0x81, 0x00, 0x81, 0x01, 0x00, 0x17, 0x82, 0x01, 0x00, 0x00, 0x81, 0x01, 0x82, 0x00, 0x81,
+    0x01, 0x82, 0x00, 0x00, 0x01, 0x85, 0x00, 0x81, 0x01, 0x03, 0x00, 0x01, 0x00, 0x01, 0x81, 0x00,
+    0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x01, 0x81, 0x00,
+    0x00, 0x01, 0x8d, 0x00, 0x86, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x01, 0x00, 0xa1, 0x83,
+    0x00, 0x00, 0x01, 0x82, 0x00, 0x81, 0x01, 0x84, 0x00, 0x00, 0x01, 0x87, 0x00, 0x81, 0x01, 0x82,
+    0x00, 0x02, 0x01, 0x00, 0x01, 0x84, 0x00, 0x82, 0x01, 0x01, 0x00, 0x01, 0x82, 0x17, 0x0a, 0x45,
+    0x27, 0x21, 0x2e, 0x46, 0x0c, 0x04, 0x6c, 0x66, 0x04, 0x07, 0x83, 0x04, 0x07, 0x02, 0x05, 0x04,
+    0x05, 0x0c, 0x02, 0x11, 0x48, 0x81, 0x02, 0x08, 0x12, 0x0c, 0x02, 0x1e, 0x3c, 0x63, 0x27, 0x5e,
+    0x17, 0x83, 0x01, 0x84, 0x00, 0x81, 0x01, 0x00, 0x00, 0x81, 0x01, 0x01, 0x00, 0x01, 0x84, 0x00,
+    0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x83, 0x00, 0x04, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x8b, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x81, 0x01, 0x86, 0x00, 0x00, 0x01, 0x81,
+    0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81,
+    0x00, 0x00, 0x01, 0x82, 0x00, 0x81, 0x01, 0x8f, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81,
+    0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x02, 0x17, 0x01, 0x00, 0x82, 0x01, 0x04, 0x7b, 0x27, 0x21,
+    0xff, 0x19, 0x06, 0xa2, 0x81, 0x02, 0x02, 0x6a, 0x07, 0x23, 0x81, 0x05, 0x81, 0x3e, 0x01, 0x05,
+    0x02, 0x81, 0x04, 0x01, 0x02, 0x0c, 0x83, 0x02, 0x03, 0x11, 0x02, 0x05, 0x11, 0x81, 0x02, 0x81,
+    0x04, 0x09, 0x07, 0x05, 0x46, 0x2e, 0x41, 0x27, 0x7c, 0x00, 0x01, 0x00, 0x86, 0x01, 0x85, 0x00,
+    0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00,
+    0x81, 0x01, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x05, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x88, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00,
+    0x01, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x86,
+    0x00, 0x81, 0x01, 0x88, 0x00, 0x00, 0x01, 0x84, 0x00, 0x82, 0x01, 0x02, 0x00, 0x01, 0x00, 0x82,
+    0x01, 0x13, 0x00, 0xff, 0xa4, 0xd1, 0x70, 0x23, 0x02, 0x05, 0x3e, 0x02, 0x04, 0x0c, 0x11, 0x2e,
+    0x42, 0x05, 0x0c, 0x05, 0x04, 0x07, 0x0c, 0x04, 0x82, 0x05, 0x0e, 0x07, 0x02, 0x0c, 0x04, 0x05,
+    0x11, 0x05, 0x12, 0x07, 0x02, 0x04, 0x05, 0x04, 0x05, 0x04, 0x81, 0x02, 0x0a, 0x29, 0x40, 0x21,
+    0x27, 0x45, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00, 0x81, 0x01,
+    0x81, 0x00, 0x84, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x02, 0x01,
+    0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x00, 0x00, 0x82, 0x01, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x01, 0x82, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x81, 0x00, 0x8d, 0x00, 0x81, 0x01, 0x82,
+    0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x8a, 0x00, 0x00, 0x01, 0x83,
+    0x00, 0x82, 0x01, 0x00, 0x00, 0x82, 0x01, 0x03, 0x17, 0xff, 0xc5, 0xf5, 0x70, 0xae, 0x81, 0x05,
+    0x08, 0x04, 0x05, 0x02, 0x48, 0x04, 0x05, 0x66, 0x05, 0x07, 0x81, 0x04, 0x02, 0x12, 0x04, 0x05,
+    0x81, 0x02, 0x01, 0x07, 0x02, 0x81, 0x05, 0x02, 0x12, 0x0c, 0x11, 0x82, 0x04, 0x13, 0x02, 0x05,
+    0x11, 0x07, 0x02, 0x11, 0x04, 0x02, 0x04, 0x02, 0x07, 0x46, 0xff, 0x31, 0xea, 0xff, 0x42, 0x8c,
+    0x3c, 0x74, 0x45, 0x17, 0x01, 0x17, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x03, 0x00, 0x01, 0x00,
+    0x01, 0x81, 0x00, 0x04, 0x01, 0x00, 0x01, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01,
+    0x01, 0x00, 0x81, 0x01, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x81,
+    0x01, 0x86, 0x00, 0x81, 0x01, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x01, 0x82,
+    0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x82, 0x00, 0x02, 0x01, 0x00, 0x01, 0x83, 0x00, 0x02,
+    0x01, 0x00, 0x01, 0x86, 0x00, 0x81, 0x01, 0x00, 0x00, 0x82, 0x01, 0x03, 0x17, 0x71, 0x70, 0x23,
+    0x81, 0x04, 0x02, 0x11, 0x05, 0x04, 0x81, 0x02, 0x05, 0x05, 0x0c, 0x33, 0xa2, 0x02, 0x11, 0x84,
+    0x02, 0x81, 0x04, 0x81, 0x07, 0x00, 0x34, 0x82, 0x02, 0x0b, 0x04, 0x05, 0x04, 0x05, 0x12, 0x0c,
+    0x12, 0x02, 0x11, 0x3e, 0x05, 0x02, 0x81, 0x05, 0x0a, 0x02, 0x11, 0x02, 0x6c, 0x33, 0x02, 0x32,
+    0x21, 0x71, 0x01, 0x17, 0x81, 0x01, 0x84, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00,
+    0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x85, 0x01, 0x81, 0x00, 0x00,
+    0x01, 0x84, 0x00, 0x00, 0x01, 0x8b, 0x00, 0x00, 0x01, 0x83, 0x00, 0x82, 0x00, 0x00, 0x01, 0x82,
+    0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0x89, 0x00, 0x00, 0x01, 0x87,
+    0x00, 0x81, 0x01, 0x87, 0x00, 0x81, 0x01, 0x03, 0x17, 0xff, 0x08, 0x21, 0x40, 0x02, 0x81, 0x04,
+    0x08, 0x11, 0x05, 0x04, 0x02, 0x05, 0x11, 0x04, 0x99, 0x02, 0x81, 0x04, 0x81, 0x07, 0x03, 0x02,
+    0x07, 0x05, 0x0c, 0x81, 0x02, 0x01, 0x07, 0x05, 0x81, 0x02, 0x81, 0x07, 0x04, 0x02, 0x05, 0x04,
+    0x05, 0x0c, 0x81, 0x07, 0x01, 0x34, 0x04, 0x82, 0x05, 0x82, 0x04, 0x0b, 0x02, 0x6c, 0x11, 0x23,
+    0x12, 0x02, 0x59, 0x9a, 0x21, 0x5e, 0x00, 0x17, 0x82, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00,
+    0x81, 0x01, 0x86, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x83, 0x00, 0x81, 0x01, 0x01, 0x00,
+    0x01, 0x82, 0x00, 0x00, 0x01, 0x83, 0x00, 0x82, 0x01, 0x01, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01,
+    0x83, 0x00, 0x97, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x01, 0x00, 0x01,
+    0x84, 0x00, 0x00, 0x01, 0x82, 0x00, 0x81, 0x17, 0x01, 0xff, 0xef, 0x1a, 0x62, 0x81, 0x02, 0x83,
+    0x04, 0x01, 0x0c, 0x11, 0x81, 0x07, 0x05, 0x42, 0x04, 0x64, 0x05, 0x3e, 0x07, 0x81, 0x04, 0x00,
+    0x12, 0x81, 0x04, 0x01, 0x11, 0x05, 0x81, 0x02, 0x08, 0x05, 0x02, 0x11, 0x04, 0x07, 0x04, 0x0c,
+    0x02, 0x05, 0x81, 0x02, 0x00, 0x0c, 0x83, 0x04, 0x00, 0x05, 0x82, 0x02, 0x05, 0x07, 0x05, 0x02,
+    0x43, 0x46, 0x48, 0x81, 0x02, 0x03, 0x05, 0x32, 0x98, 0x17, 0x83, 0x01, 0x81, 0x00, 0x00, 0x01,
+    0x81, 0x00, 0x05, 0xd1, 0x97, 0x7b, 0x97, 0x01, 0xa1, 0x82, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81,
+    0x01, 0x84, 0x00, 0x81, 0x01, 0x8a, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x83, 0x00, 0x02, 0x01, 0x00, 0x01, 0x8b, 0x00, 0x00, 0x01, 0x89, 0x00, 0x00, 0x01, 0x85, 0x00,
+    0x00, 0x01, 0x82, 0x00, 0x06, 0x01, 0x00, 0x01, 0x17, 0x87, 0x35, 0x49, 0x81, 0x04, 0x00, 0x02,
+    0x81, 0x04, 0x00, 0x07, 0x81, 0x05, 0x81, 0x07, 0x0a, 0x12, 0x05, 0x49, 0x04, 0x05, 0x02, 0x11,
+    0x05, 0x02, 0x07, 0x02, 0x81, 0x04, 0x03, 0x02, 0x07, 0x05, 0x2f, 0x82, 0x02, 0x04, 0x04, 0x02,
+    0x05, 0x04, 0x0c, 0x82, 0x05, 0x06, 0x11, 0x05, 0x11, 0x05, 0x04, 0x02, 0x05, 0x81, 0x02, 0x06,
+    0x04, 0x42, 0x02, 0x33, 0x05, 0x04, 0x02, 0x81, 0x07, 0x02, 0x69, 0x21, 0x67, 0x82, 0x00, 0x0c,
+    0x01, 0x17, 0x67, 0x75, 0x5f, 0x4a, 0xde, 0xff, 0x83, 0x04, 0xbc, 0x7d, 0x5f, 0x75, 0x7c, 0x82,
+    0x01, 0x03, 0x00, 0x01, 0x00, 0x01, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x01, 0x00, 0x81,
+    0x01, 0x01, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x83, 0x00, 0x96, 0x00, 0x00, 0x01, 0x81, 0x00,
+    0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x81, 0x00, 0x01,
+    0x01, 0x00, 0x82, 0x01, 0x03, 0x17, 0x35, 0x6c, 0x02, 0x81, 0x11, 0x05, 0x33, 0x05, 0x07, 0x02,
+    0x11, 0x07, 0x81, 0x04, 0x06, 0x05, 0x02, 0x29, 0x07, 0x02, 0x48, 0x04, 0x81, 0x02, 0x04, 0x11,
+    0x05, 0x07, 0x3e, 0x04, 0x81, 0x02, 0x02, 0x07, 0x0c, 0x04, 0x81, 0x05, 0x04, 0x07, 0x05, 0x0c,
+    0x04, 0x12, 0x81, 0x11, 0x1e, 0x3e, 0x05, 0x12, 0x07, 0x05, 0x07, 0x04, 0x07, 0x02, 0x04, 0x12,
+    0x07, 0x04, 0x77, 0x02, 0x2f, 0x04, 0x02, 0x05, 0x07, 0x3c, 0xff, 0x08, 0x40, 0x00, 0x01, 0xff,
+    0xff, 0x5b, 0x5f, 0x7d, 0xd2, 0x06, 0x0f, 0x38, 0x81, 0x0b, 0x04, 0x06, 0x3f, 0xfb, 0x4a, 0x7d,
+    0x82, 0x01, 0x83, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x8b, 0x00,
+    0x81, 0x01, 0x83, 0x00, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01,
+    0x82, 0x00, 0x00, 0x01, 0x8e, 0x00, 0x00, 0x01, 0x84, 0x00, 0x81, 0x01, 0x02, 0x17, 0x62, 0x1e,
+    0x81, 0x05, 0x81, 0x07, 0x83, 0x04, 0x06, 0x02, 0x12, 0x05, 0x04, 0x07, 0x59, 0x05, 0x83, 0x02,
+    0x04, 0x04, 0x05, 0x07, 0x04, 0x07, 0x81, 0x02, 0x81, 0x04, 0x81, 0x05, 0x03, 0x3e, 0x04, 0x11,
+    0x05, 0x81, 0x02, 0x01, 0x05, 0x04, 0x81, 0x05, 0x05, 0x02, 0x04, 0x02, 0x12, 0x02, 0x04, 0x81,
+    0x05, 0x04, 0x07, 0x04, 0x11, 0x05, 0x2f, 0x81, 0x0c, 0x82, 0x07, 0x08, 0x33, 0x05, 0x0c, 0x40,
+    0x27, 0xff, 0x62, 0x65, 0x53, 0x81, 0x0f, 0x81, 0x06, 0x01, 0x0b, 0x19, 0x82, 0x06, 0x05, 0x0f,
+    0x0b, 0x06, 0xff, 0xf6, 0x70, 0x31, 0x67, 0x82, 0x00, 0x04, 0x01, 0x00, 0x01, 0x00, 0x01, 0x83,
+    0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x86, 0x00, 0x00,
+    0x01, 0x84, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x83, 0x01, 0x83, 0x00, 0x00, 0x01, 0x82, 0x00,
+    0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x89, 0x00, 0x81, 0x01, 0x07, 0x00,
+    0x01, 0x00, 0x21, 0x22, 0xd3, 0x33, 0x04, 0x82, 0x02, 0x00, 0x07, 0x82, 0x04, 0x00, 0x07, 0x81,
+    0x02, 0x02, 0x04, 0x28, 0x04, 0x81, 0x07, 0x03, 0x02, 0x0c, 0x07, 0x02, 0x82, 0x04, 0x81, 0x02,
+    0x02, 0x05, 0x12, 0x04, 0x81, 0x05, 0x02, 0x02, 0x04, 0x07, 0x81, 0x05, 0x01, 0x02, 0x05, 0x81,
+    0x04, 0x03, 0x05, 0x07, 0x02, 0x07, 0x82, 0x02, 0x81, 0x05, 0x0a, 0x12, 0x04, 0x07, 0x04, 0x07,
+    0x64, 0x05, 0x02, 0x07, 0x02, 0x04, 0x81, 0x0c, 0x03, 0x46, 0xff, 0x10, 0xa2, 0x1f, 0x19, 0x81,
+    0x06, 0x01, 0x0f, 0x06, 0x81, 0x0b, 0x09, 0x19, 0x06, 0x1f, 0x0f, 0x06, 0x0f, 0x38, 0x4d, 0xd1,
+    0x01, 0x87, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x83,
+    0x00, 0x81, 0x01, 0x85, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x8b,
+    0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x82, 0x00, 0x00, 0xa3, 0x86, 0x00, 0x00, 0x01, 0x82, 0x00,
+    0x83, 0x01, 0x0d, 0x21, 0x3d, 0x1e, 0x04, 0x07, 0x04, 0x02, 0x04, 0x11, 0x05, 0x02, 0x04, 0x33,
+    0x11, 0x81, 0x07, 0x04, 0x0c, 0x04, 0x7e, 0xa2, 0x07, 0x81, 0x02, 0x02, 0x05, 0x04, 0x12, 0x81,
+    0x05, 0x0c, 0x07, 0x02, 0x07, 0x0c, 0x07, 0x34, 0x05, 0x04, 0x12, 0x02, 0x05, 0x07, 0x12, 0x81,
+    0x04, 0x02, 0x02, 0x05, 0x02, 0x81, 0x04, 0x11, 0x11, 0x5a, 0x12, 0x11, 0x04, 0x07, 0x04, 0x02,
+    0x07, 0x0c, 0x07, 0x05, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04, 0x81, 0x02, 0x01, 0x21, 0x0b, 0x81,
+    0x06, 0x02, 0x0f, 0x26, 0x19, 0x82, 0x06, 0x02, 0x0b, 0x0f, 0x3f, 0x81, 0x19, 0x02, 0x0f, 0x53,
+    0x17, 0x88, 0x00, 0x00, 0x01, 0x82, 0x00, 0x02, 0x01, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x82,
+    0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00, 0x83, 0x00, 0x00, 0x01, 0x8a, 0x00, 0x00,
+    0x01, 0x85, 0x00, 0x00, 0x01, 0x8b, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x0f, 0x17, 0x70,
+    0x28, 0x23, 0x6a, 0x11, 0x12, 0x05, 0x07, 0x0c, 0x07, 0x05, 0x07, 0x02, 0x05, 0x07, 0x81, 0x04,
+    0x00, 0x76, 0x82, 0x04, 0x08, 0x07, 0x05, 0x04, 0x02, 0x0c, 0x04, 0x02, 0x0c, 0x02, 0x81, 0x05,
+    0x01, 0x04, 0x12, 0x81, 0x02, 0x08, 0x11, 0x07, 0x04, 0x05, 0x0c, 0x12, 0x02, 0x05, 0x07, 0x81,
+    0x05, 0x81, 0x02, 0x01, 0x07, 0x04, 0x81, 0x02, 0x81, 0x05, 0x07, 0x07, 0x02, 0x04, 0x07, 0x11,
+    0x64, 0x02, 0x05, 0x81, 0x02, 0x02, 0x0c, 0x04, 0x02, 0x81, 0x04, 0x01, 0xff, 0x10, 0xa2, 0xff,
+    0xd5, 0x49, 0x81, 0x06, 0x02, 0x0f, 0x06, 0x0f, 0x81, 0x06, 0x81, 0x0b, 0x06, 0x19, 0x81, 0x19,
+    0x0b, 0x26, 0xaf, 0xff, 0xd6, 0x15, 0x83, 0x00, 0x00, 0x01, 0x84, 0x00, 0x84, 0x01, 0x83, 0x00,
+    0x00, 0x01, 0x89, 0x00, 0x82, 0x01, 0x01, 0x00, 0x01, 0x87, 0x00, 0x81, 0x01, 0x01, 0x00, 0x01,
+    0x82, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x89, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01,
+    0x00, 0x27, 0x81, 0x1e, 0x04, 0x22, 0x0c, 0x07, 0x05, 0x11, 0x82, 0x02, 0x20, 0x07, 0x04, 0x0c,
+    0x02, 0x05, 0x0c, 0x02, 0x64, 0x02, 0x04, 0x12, 0x0c, 0x04, 0x07, 0x33, 0x05, 0x04, 0x12, 0x02,
+    0x07, 0x05, 0x04, 0x02, 0x07, 0x11, 0x12, 0x04, 0x07, 0x02, 0x05, 0x02, 0x04, 0x02, 0x81, 0x12,
+    0x0b, 0x05, 0x04, 0x02, 0x05, 0x04, 0x05, 0x07, 0x04, 0x02, 0x05, 0x02, 0x05, 0x81, 0x02, 0x04,
+    0x05, 0x40, 0x02, 0x07, 0x12, 0x81, 0x05, 0x09, 0x02, 0x0c, 0x05, 0x02, 0x69, 0xa0, 0x06, 0x0b,
+    0x0f, 0x0b, 0x81, 0x06, 0x00, 0x0b, 0x82, 0x06, 0x00, 0x1f, 0x81, 0x06, 0x03, 0x26, 0x1f, 0x31,
+    0x01, 0x83, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0x90, 0x00, 0x88, 0x00, 0x00, 0x01, 0x87,
+    0x00, 0x00, 0x01, 0x92, 0x00, 0x81, 0x01, 0x0a, 0xff, 0xf7, 0xbe, 0x3c, 0x1e, 0xd3, 0x1e, 0x07,
+    0x02, 0x04, 0x05, 0x02, 0x04, 0x81, 0x02, 0x02, 0x11, 0x02, 0x11, 0x82, 0x02, 0x05, 0x43, 0x04,
+    0x02, 0x12, 0x04, 0x02, 0x81, 0x04, 0x81, 0x02, 0x00, 0x04, 0x82, 0x02, 0x02, 0x05, 0x2f, 0x04,
+    0x82, 0x02, 0x00, 0x0c, 0x81, 0x02, 0x07, 0x04, 0x11, 0x07, 0x02, 0x12, 0x02, 0x05, 0x04, 0x81,
+    0x05, 0x81, 0x07, 0x03, 0x0c, 0x04, 0x05, 0x07, 0x82, 0x02, 0x01, 0x11, 0x46, 0x81, 0x02, 0x0b,
+    0x07, 0x04, 0x0c, 0x04, 0x02, 0x11, 0x07, 0x0c, 0x8e, 0x36, 0xbd, 0xff, 0xee, 0x2d, 0x81, 0x06,
+    0x06, 0xfc, 0xff, 0x6a, 0x40, 0xd4, 0x0b, 0x26, 0x0b, 0x0f, 0x81, 0x0b, 0x81, 0x06, 0x00, 0x7d,
+    0x86, 0x00, 0x81, 0x01, 0x01, 0x00, 0x01, 0x87, 0x00, 0x84, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81,
+    0x00, 0x85, 0x00, 0x81, 0x01, 0x00, 0x00, 0x81, 0x01, 0x84, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81,
+    0x01, 0x8f, 0x00, 0x82, 0x01, 0x08, 0x3c, 0x23, 0x1e, 0x2b, 0x11, 0x02, 0x11, 0x02, 0x05, 0x81,
+    0x02, 0x00, 0x07, 0x81, 0x05, 0x83, 0x02, 0x0a, 0x46, 0xff, 0x3a, 0x2a, 0x28, 0x3b, 0x4b, 0x9a,
+    0x1c, 0x3d, 0xff, 0x3a, 0x4a, 0x43, 0x07, 0x81, 0x02, 0x82, 0x04, 0x00, 0x02, 0x81, 0x05, 0x04,
+    0x02, 0x05, 0x07, 0x34, 0x02, 0x82, 0x04, 0x81, 0x02, 0x82, 0x04, 0x0a, 0x05, 0x07, 0x04, 0x05,
+    0x04, 0x07, 0x02, 0x12, 0x0c, 0x04, 0x11, 0x81, 0x05, 0x03, 0x33, 0x05, 0x02, 0x05, 0x81, 0x02,
+    0x09, 0x05, 0x04, 0x34, 0x04, 0x05, 0xd5, 0xff, 0xf6, 0x70, 0x0b, 0x06, 0x81, 0x81, 0x06, 0x03,
+    0x0f, 0xfc, 0xff, 0x59, 0xa0, 0x0f, 0x81, 0x0b, 0x04, 0x0f, 0x06, 0x0b, 0xff, 0x7a, 0xe3, 0xff,
+    0x7b, 0x69, 0x84, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81,
+    0x01, 0x01, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x82, 0x00, 0x82, 0x01, 0x00, 0x00,
+    0x81, 0x01, 0x83, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x83, 0x00, 0x81, 0x01, 0x00, 0x00,
+    0x81, 0x01, 0x84, 0x00, 0x00, 0x01, 0x81, 0x00, 0x02, 0x17, 0x00, 0x98, 0x81, 0x1e, 0x14, 0x28,
+    0x2b, 0x04, 0x05, 0x02, 0x0c, 0x04, 0x0c, 0x07, 0x05, 0x99, 0x4b, 0x32, 0xff, 0x08, 0xa2, 0xbe,
+    0xff, 0x00, 0xa5, 0x18, 0xff, 0x43, 0x92, 0xfd, 0xfe, 0x0e, 0x81, 0x65, 0x10, 0xff, 0x4c, 0x36,
+    0xff, 0x53, 0xf4, 0xff, 0x3b, 0x0f, 0xff, 0x08, 0xc5, 0xbf, 0xff, 0x08, 0xa2, 0x32, 0x1c, 0x46,
+    0x02, 0x07, 0x0c, 0x05, 0x0c, 0x04, 0x05, 0x02, 0x81, 0x04, 0x00, 0x05, 0x81, 0x0c, 0x03, 0x05,
+    0x0c, 0x04, 0x07, 0x84, 0x02, 0x08, 0x04, 0x11, 0x12, 0x02, 0x07, 0x04, 0x07, 0x77, 0x04, 0x81,
+    0x02, 0x03, 0x11, 0x05, 0x11, 0x02, 0x81, 0x04, 0x08, 0x05, 0x04, 0x74, 0x44, 0x8f, 0x06, 0x1f,
+    0x0f, 0x19, 0x81, 0x0b, 0x09, 0xd2, 0xfc, 0x0f, 0x0b, 0x06, 0x0f, 0x06, 0xff, 0x41, 0x60, 0x00,
+    0x01, 0x85, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x02, 0x17,
+    0x00, 0x01, 0x85, 0x00, 0x88, 0x00, 0x81, 0x01, 0x82, 0x00, 0x81, 0x01, 0x82, 0x00, 0x00, 0x01,
+    0x84, 0x00, 0x81, 0x01, 0x87, 0x00, 0x81, 0x01, 0x02, 0x00, 0x67, 0x41, 0x81, 0x2b, 0x0a, 0x1e,
+    0x05, 0x33, 0x07, 0x04, 0x02, 0x69, 0x2e, 0x21, 0xff, 0x11, 0x27, 0xff, 0x43, 0x93, 0x81, 0x14,
+    0x82, 0x0e, 0x81, 0x60, 0x12, 0x0e, 0x10, 0x14, 0x55, 0x0e, 0x14, 0x0e, 0x20, 0x10, 0x20, 0x14,
+    0x55, 0xff, 0x2b, 0x52, 0xff, 0x4c, 0x14, 0x42, 0x2e, 0x35, 0x33, 0x07, 0x81, 0x02, 0x81, 0x04,
+    0x05, 0x5a, 0x02, 0x04, 0x12, 0x04, 0x12, 0x81, 0x02, 0x00, 0x07, 0x81, 0x04, 0x06, 0x05, 0x04,
+    0x12, 0x05, 0x04, 0x02, 0x05, 0x81, 0x07, 0x00, 0x64, 0x81, 0x05, 0x01, 0x04, 0x11, 0x81, 0x02,
+    0x0b, 0x0c, 0x02, 0x07, 0x02, 0x11, 0x6c, 0x75, 0x5b, 0x0a, 0x0b, 0x06, 0x0f, 0x82, 0x06, 0x03,
+    0x1f, 0x90, 0x06, 0x0b, 0x81, 0x06, 0x01, 0xff, 0xfe, 0xb0, 0xff, 0x7b, 0x49, 0x82, 0x00, 0x02,
+    0x01, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81,
+    0x00, 0x02, 0x01, 0x00, 0x01, 0x83, 0x00, 0x82, 0x00, 0x00, 0x01, 0x85, 0x00, 0x81, 0x01, 0x82,
+    0x00, 0x81, 0x01, 0x85, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x83, 0x00, 0x00, 0x01, 0x84, 0x00,
+    0x1b, 0x01, 0x21, 0x1e, 0x22, 0x2b, 0x22, 0x07, 0x05, 0x43, 0x77, 0x2e, 0xff, 0x2a, 0x8d, 0x0e,
+    0x10, 0x0e, 0x68, 0x0e, 0x68, 0x10, 0x14, 0x0e, 0x20, 0xff, 0x2b, 0x53, 0x20, 0x0e, 0x5c, 0x82,
+    0x0e, 0x81, 0x20, 0x06, 0x10, 0x5c, 0x0e, 0x10, 0x20, 0x14, 0x0e, 0x81, 0x10, 0x1d, 0x20, 0xff,
+    0x54, 0x15, 0xff, 0x00, 0x63, 0x70, 0x8e, 0x02, 0x0c, 0x02, 0x04, 0x07, 0x04, 0x05, 0x11, 0x02,
+    0x04, 0x02, 0x04, 0x05, 0x02, 0x12, 0x0c, 0x02, 0x05, 0x0c, 0x05, 0x02, 0x07, 0x59, 0x05, 0x34,
+    0x81, 0x07, 0x02, 0x02, 0x48, 0x05, 0x81, 0x04, 0x08, 0x12, 0x02, 0x5a, 0x58, 0x9b, 0x15, 0x4e,
+    0x06, 0x1f, 0x81, 0x0b, 0x09, 0x06, 0x0b, 0x06, 0xdf, 0x0f, 0x06, 0x19, 0x06, 0x5f, 0x17, 0x83,
+    0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84,
+    0x00, 0x00, 0x01, 0x8f, 0x00, 0x04, 0x01, 0x00, 0x01, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81,
+    0x00, 0x02, 0x01, 0x00, 0x01, 0x84, 0x00, 0x03, 0x01, 0x00, 0xff, 0xc5, 0xd5, 0x89, 0x81, 0x22,
+    0x07, 0x1e, 0xff, 0x29, 0xa9, 0xff, 0x32, 0x09, 0x21, 0x18, 0x65, 0x10, 0x14, 0x81, 0x10, 0x04,
+    0x14, 0x10, 0x8a, 0x0e, 0x61, 0x82, 0x14, 0x05, 0x60, 0x68, 0x14, 0x20, 0x0e, 0x10, 0x81, 0x0e,
+    0x02, 0x20, 0x10, 0x20, 0x81, 0x10, 0x81, 0x0e, 0x00, 0x10, 0x81, 0x0e, 0x07, 0x10, 0x61, 0x0e,
+    0xfe, 0xff, 0x00, 0x63, 0x3c, 0x46, 0x04, 0x81, 0x02, 0x01, 0x05, 0x02, 0x81, 0x05, 0x00, 0x07,
+    0x81, 0x02, 0x05, 0x11, 0x07, 0x02, 0x0c, 0x04, 0x48, 0x81, 0x04, 0x04, 0x02, 0x46, 0x04, 0x0c,
+    0x04, 0x81, 0x02, 0x0f, 0x07, 0x0c, 0x05, 0x04, 0x3e, 0x04, 0x12, 0xff, 0x42, 0x8c, 0xff, 0x62,
+    0x25, 0xbc, 0x0a, 0xff, 0xbc, 0x68, 0x06, 0x0b, 0x06, 0x19, 0x81, 0x06, 0x06, 0x0b, 0xff, 0x93,
+    0x44, 0x06, 0x0b, 0x1f, 0xc0, 0xff, 0xc5, 0x92, 0x81, 0x00, 0x81, 0x01, 0x88, 0x00, 0x02, 0x01,
+    0x00, 0x01, 0x88, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x01, 0x00, 0x81,
+    0x01, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x8b, 0x00, 0x81, 0x01, 0x01, 0x00, 0x01, 0x83, 0x00,
+    0x02, 0x01, 0xc1, 0x21, 0x82, 0x1e, 0x01, 0x32, 0xff, 0x00, 0x63, 0x81, 0xb0, 0x02, 0x20, 0x82,
+    0x5c, 0x84, 0x14, 0x0a, 0x0e, 0x14, 0x68, 0x10, 0x20, 0x61, 0x20, 0x0e, 0xff, 0x2b, 0x33, 0x0e,
+    0x10, 0x81, 0x0e, 0x03, 0x20, 0xb1, 0x10, 0x0e, 0x81, 0x10, 0x06, 0x14, 0x20, 0x10, 0x61, 0xff,
+    0x33, 0x32, 0x60, 0x10, 0x81, 0x14, 0x08, 0x60, 0x14, 0xff, 0x4b, 0xf6, 0xff, 0x08, 0xc5, 0x2e,
+    0x46, 0x07, 0x04, 0x07, 0x82, 0x02, 0x10, 0x04, 0x07, 0x12, 0x05, 0x02, 0x07, 0x12, 0x07, 0x02,
+    0x48, 0x43, 0x05, 0x07, 0x04, 0x12, 0x05, 0x02, 0x81, 0x04, 0x81, 0x07, 0x0f, 0x05, 0x04, 0x0c,
+    0x58, 0x1d, 0x5b, 0x0d, 0xbd, 0x19, 0x06, 0x1f, 0x06, 0x0b, 0x3f, 0xb2, 0x8b, 0x81, 0x06, 0x01,
+    0x3f, 0xff, 0x41, 0x60, 0x85, 0x00, 0x00, 0x01, 0x81, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x82, 0x01, 0x01, 0x00, 0x01, 0x85, 0x00, 0x83, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x01,
+    0x83, 0x00, 0x81, 0x01, 0x84, 0x00, 0x81, 0x01, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00, 0x07, 0x01,
+    0x71, 0xff, 0x18, 0xe5, 0x2f, 0x23, 0x2e, 0xe0, 0xff, 0x44, 0x15, 0x81, 0x0e, 0x00, 0x14, 0x81,
+    0x10, 0x06, 0x0e, 0x10, 0x20, 0x60, 0x0e, 0x14, 0x20, 0x84, 0x0e, 0x03, 0xff, 0x2b, 0x53, 0x10,
+    0x0e, 0x56, 0x81, 0x10, 0x0c, 0x0e, 0x10, 0x55, 0x20, 0x0e, 0x10, 0x14, 0x20, 0x10, 0x68, 0x65,
+    0x14, 0x68, 0x81, 0x14, 0x10, 0x10, 0x20, 0x14, 0x20, 0x10, 0xff, 0x53, 0xf4, 0x70, 0x59, 0x0c,
+    0x6a, 0x04, 0x42, 0x05, 0x02, 0x07, 0x05, 0x02, 0x81, 0x07, 0x0b, 0x02, 0x3e, 0x07, 0x02, 0x04,
+    0x02, 0x11, 0x05, 0x02, 0x12, 0x2f, 0x12, 0x81, 0x04, 0x00, 0x02, 0x81, 0x04, 0x04, 0x78, 0xff,
+    0x8b, 0x88, 0x1d, 0x9c, 0x5b, 0x81, 0x06, 0x00, 0x0b, 0x81, 0x0f, 0x07, 0x0b, 0x06, 0x38, 0xa4,
+    0x1f, 0x19, 0x83, 0x45, 0x86, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x83, 0x00, 0x03, 0x01,
+    0x00, 0x01, 0x00, 0x81, 0x01, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x82,
+    0x00, 0x00, 0x01, 0x82, 0x00, 0x02, 0x01, 0x00, 0x01, 0x82, 0x00, 0x82, 0x01, 0x81, 0x00, 0x00,
+    0x01, 0x83, 0x00, 0x00, 0x01, 0x83, 0x00, 0x83, 0x01, 0x0c, 0x27, 0x1e, 0x35, 0xff, 0x4b, 0x50,
+    0x79, 0xa5, 0x0e, 0x82, 0x20, 0x0e, 0x60, 0x20, 0x0e, 0x81, 0x10, 0x05, 0x0e, 0x10, 0x68, 0x20,
+    0x68, 0x60, 0x81, 0x10, 0x00, 0x14, 0x81, 0x0e, 0x0a, 0x14, 0x55, 0x20, 0x65, 0x55, 0x10, 0x14,
+    0x10, 0x68, 0x14, 0x10, 0x81, 0x20, 0x00, 0x56, 0x81, 0x14, 0x07, 0x20, 0x55, 0x0e, 0x20, 0x10,
+    0x0e, 0x10, 0x5c, 0x81, 0x14, 0x03, 0x82, 0xff, 0x08, 0xe5, 0x9a, 0x04, 0x81, 0x02, 0x00, 0x07,
+    0x82, 0x02, 0x01, 0x04, 0x05, 0x81, 0x04, 0x04, 0x07, 0xa2, 0x07, 0x02, 0x05, 0x81, 0x02, 0x04,
+    0x05, 0x04, 0x48, 0x07, 0x05, 0x82, 0x02, 0x05, 0x04, 0x70, 0xff, 0xed, 0xcc, 0x16, 0x0a, 0xff,
+    0xac, 0x48, 0x81, 0x0f, 0x06, 0x06, 0x19, 0x06, 0x1f, 0x0f, 0xff, 0x93, 0x64, 0x0b, 0x81, 0x06,
+    0x02, 0x7d, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x87, 0x00, 0x82, 0x01, 0x00, 0x00, 0x82, 0x01,
+    0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x01, 0x8a, 0x00, 0x02, 0x01,
+    0x00, 0x01, 0x81, 0x00, 0x00, 0x17, 0x82, 0x01, 0x01, 0x00, 0x01, 0x81, 0x00, 0x09, 0x88, 0x21,
+    0xff, 0x3a, 0xce, 0x18, 0x2c, 0xff, 0x2a, 0xae, 0x8a, 0x10, 0x0e, 0x14, 0x81, 0x0e, 0x02, 0xff,
+    0x4c, 0x16, 0x10, 0x14, 0x81, 0x0e, 0x03, 0x10, 0x0e, 0x10, 0x20, 0x81, 0x0e, 0x06, 0x65, 0x0e,
+    0x68, 0x55, 0x68, 0x20, 0x10, 0x82, 0x0e, 0x06, 0x14, 0x10, 0x0e, 0x10, 0x0e, 0x10, 0x14, 0x81,
+    0x0e, 0x82, 0x10, 0x00, 0x20, 0x84, 0x10, 0x11, 0x0e, 0x14, 0x10, 0xe1, 0x77, 0x6c, 0x04, 0x42,
+    0x02, 0x07, 0x04, 0x05, 0x04, 0x43, 0x05, 0x12, 0x04, 0x07, 0x81, 0x04, 0x05, 0x07, 0x0c, 0x49,
+    0x05, 0x02, 0x04, 0x81, 0x02, 0x0b, 0x0c, 0x05, 0x11, 0x2e, 0x91, 0x1f, 0x25, 0x1d, 0x91, 0x0f,
+    0x06, 0x0f, 0x83, 0x06, 0x03, 0xff, 0xa4, 0x06, 0x06, 0x26, 0x31, 0x89, 0x00, 0x01, 0x01, 0x00,
+    0x81, 0x01, 0x01, 0x00, 0x01, 0x82, 0x00, 0x83, 0x01, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00, 0x03,
+    0x01, 0x00, 0x01, 0x00, 0x82, 0x01, 0x81, 0x00, 0x81, 0x01, 0x82, 0x00, 0x00, 0x01, 0x85, 0x00,
+    0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x0d, 0x7c, 0x35, 0x39, 0x2c, 0x79, 0xff, 0x2a,
+    0x8d, 0xff, 0x2a, 0x8e, 0x61, 0x14, 0x10, 0x56, 0x14, 0x10, 0x0e, 0x82, 0x10, 0x06, 0x65, 0x0e,
+    0x60, 0x0e, 0x14, 0x60, 0x10, 0x82, 0x0e, 0x03, 0x20, 0xc2, 0x14, 0x10, 0x82, 0x0e, 0x81, 0x14,
+    0x03, 0x5c, 0x55, 0x20, 0x14, 0x82, 0x10, 0x01, 0x61, 0x68, 0x82, 0x10, 0x00, 0x0e, 0x81, 0x10,
+    0x09, 0x0e, 0x10, 0x20, 0x0e, 0x60, 0x56, 0x18, 0x3c, 0x04, 0x42, 0x83, 0x04, 0x02, 0x33, 0x04,
+    0x02, 0x81, 0x05, 0x04, 0x04, 0x05, 0x02, 0x05, 0x12, 0x81, 0x02, 0x02, 0x12, 0x04, 0x02, 0x82,
+    0x04, 0x08, 0x33, 0xff, 0x31, 0x22, 0x3f, 0x06, 0x15, 0x8c, 0x06, 0xa4, 0x0f, 0x81, 0x06, 0x02,
+    0x3f, 0x0f, 0xff, 0xe5, 0xec, 0x81, 0x06, 0x02, 0xff, 0x93, 0x85, 0xc3, 0x01, 0x82, 0x00, 0x00,
+    0x01, 0x88, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x84, 0x00, 0x89, 0x00, 0x81, 0x01, 0x01,
+    0x00, 0x01, 0x82, 0x00, 0x02, 0x01, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x84, 0x00, 0x81, 0x01,
+    0x05, 0x00, 0x01, 0x00, 0x98, 0x2c, 0x39, 0x81, 0x2c, 0x04, 0xa5, 0xff, 0x2a, 0xd0, 0x10, 0x0e,
+    0x10, 0x81, 0x0e, 0x81, 0x10, 0x0f, 0x14, 0x10, 0x20, 0x8a, 0x14, 0x10, 0x60, 0x55, 0x20, 0x14,
+    0x56, 0x14, 0x0e, 0x10, 0x5c, 0x10, 0x83, 0x0e, 0x03, 0x14, 0x65, 0x14, 0x0e, 0x81, 0x10, 0x00,
+    0x14, 0x81, 0x10, 0x81, 0x14, 0x02, 0x55, 0x14, 0x10, 0x82, 0x0e, 0x03, 0x20, 0x10, 0xc2, 0x14,
+    0x81, 0x0e, 0x13, 0x14, 0x65, 0xff, 0x09, 0x06, 0x23, 0x02, 0x05, 0x04, 0x05, 0x11, 0x02, 0x04,
+    0x0c, 0x02, 0x04, 0x0c, 0x02, 0x48, 0x05, 0x02, 0x04, 0x81, 0x02, 0x00, 0x0c, 0x81, 0x11, 0x81,
+    0x02, 0x00, 0x21, 0x81, 0x0b, 0x04, 0x06, 0x16, 0xff, 0x82, 0xe3, 0x3f, 0x06, 0x81, 0x0f, 0x06,
+    0x1f, 0x19, 0x3f, 0xff, 0x7a, 0xa2, 0xb2, 0x06, 0xff, 0x39, 0x61, 0x82, 0x00, 0x00, 0x01, 0x81,
+    0x00, 0x00, 0x01, 0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x8a, 0x00, 0x81, 0x01, 0x81, 0x00, 0x83,
+    0x01, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00, 0x81, 0x01, 0x13, 0x00, 0x01,
+    0xff, 0xef, 0x3a, 0x66, 0x39, 0x79, 0x2c, 0x24, 0x2c, 0x0e, 0x20, 0x10, 0x0e, 0x60, 0x56, 0x55,
+    0xfd, 0xff, 0x4b, 0x92, 0xff, 0x00, 0x84, 0x32, 0x82, 0x21, 0x02, 0x3c, 0x2e, 0x58, 0x82, 0x21,
+    0x06, 0x3c, 0xbf, 0xff, 0x19, 0x89, 0xff, 0x53, 0xd4, 0xb0, 0x0e, 0x20, 0x81, 0x0e, 0x03, 0x56,
+    0x10, 0x0e, 0x10, 0x81, 0x14, 0x02, 0x20, 0x10, 0x14, 0x81, 0x0e, 0x09, 0x14, 0x10, 0x20, 0x0e,
+    0x14, 0x0e, 0xb0, 0x10, 0x14, 0x10, 0x81, 0x0e, 0x0a, 0xe2, 0x5c, 0xff, 0x4b, 0xb2, 0x21, 0x07,
+    0x12, 0x07, 0x05, 0x07, 0x04, 0x07, 0x81, 0x04, 0x05, 0x02, 0x42, 0x05, 0x07, 0x02, 0x04, 0x81,
+    0x05, 0x0d, 0x12, 0x02, 0x0c, 0x02, 0x12, 0x35, 0xbd, 0x0b, 0x06, 0x81, 0x92, 0x06, 0x0b, 0x0f,
+    0x83, 0x06, 0x05, 0xfc, 0x19, 0x06, 0x5f, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00,
+    0x01, 0x81, 0x00, 0x00, 0x01, 0x8a, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x02,
+    0x01, 0x00, 0x01, 0x82, 0x00, 0x83, 0x01, 0x86, 0x00, 0x81, 0x01, 0x02, 0x17, 0x00, 0x17, 0x84,
+    0x01, 0x02, 0x98, 0x79, 0x24, 0x81, 0x18, 0x0d, 0xe3, 0xff, 0x2a, 0x8e, 0x56, 0x82, 0xff, 0x43,
+    0x0f, 0x2e, 0x32, 0xff, 0x21, 0x47, 0x43, 0x02, 0x3e, 0x02, 0x3e, 0x05, 0x81, 0x07, 0x82, 0x02,
+    0x0d, 0x04, 0x11, 0x05, 0x04, 0x07, 0x04, 0x2f, 0x02, 0x46, 0x63, 0x3c, 0x32, 0xff, 0x4b, 0x71,
+    0x82, 0x81, 0x10, 0x0a, 0x56, 0x60, 0x14, 0x20, 0x14, 0x68, 0x10, 0x68, 0x0e, 0x68, 0x10, 0x81,
+    0x14, 0x00, 0x60, 0x82, 0x10, 0x03, 0x14, 0x8a, 0x0e, 0x20, 0x81, 0x10, 0x06, 0x77, 0x49, 0x02,
+    0x0c, 0x04, 0x07, 0x33, 0x82, 0x05, 0x09, 0x02, 0x12, 0x05, 0x04, 0x02, 0x04, 0x02, 0x11, 0x04,
+    0x07, 0x81, 0x02, 0x12, 0xe4, 0x93, 0x0b, 0x0f, 0x06, 0x38, 0xff, 0x61, 0xe0, 0x26, 0x0b, 0x0f,
+    0x06, 0x0f, 0x0b, 0x06, 0xff, 0x61, 0xc0, 0x19, 0x37, 0x00, 0x01, 0x82, 0x00, 0x02, 0x01, 0x00,
+    0x01, 0x86, 0x00, 0x82, 0x01, 0x00, 0x00, 0x81, 0x01, 0x82, 0x00, 0x81, 0x01, 0x82, 0x00, 0x00,
+    0x01, 0x82, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x81, 0x01, 0x00, 0x00, 0x82,
+    0x01, 0x81, 0x00, 0x03, 0x01, 0x87, 0x3c, 0x7f, 0x81, 0x24, 0x04, 0x7f, 0xa5, 0x22, 0x2e, 0x05,
+    0x81, 0x02, 0x03, 0x05, 0x11, 0x02, 0x04, 0x81, 0x05, 0x01, 0x04, 0x02, 0x81, 0x04, 0x03, 0x07,
+    0x12, 0x05, 0x04, 0x81, 0x05, 0x06, 0x04, 0x02, 0x0c, 0x04, 0x02, 0x07, 0x02, 0x81, 0x04, 0x0c,
+    0x0c, 0xa6, 0x2e, 0xbe, 0xe0, 0x0e, 0x5c, 0x20, 0x65, 0x10, 0x14, 0x61, 0x20, 0x83, 0x0e, 0x0c,
+    0x20, 0x10, 0x0e, 0x20, 0x0e, 0x55, 0x0e, 0x10, 0x0e, 0x10, 0x14, 0xff, 0x43, 0x10, 0x2e, 0x82,
+    0x04, 0x04, 0x02, 0x48, 0x02, 0x07, 0x04, 0x81, 0x07, 0x0f, 0x05, 0x11, 0x05, 0x02, 0x05, 0x07,
+    0x02, 0x6a, 0x05, 0xff, 0x21, 0x47, 0xff, 0x6a, 0x86, 0x26, 0x19, 0x0b, 0x06, 0x15, 0x82, 0x06,
+    0x00, 0x1f, 0x81, 0x06, 0x04, 0x0f, 0x91, 0x1f, 0xff, 0x83, 0x05, 0xc1, 0x82, 0x00, 0x81, 0x01,
+    0x81, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x01, 0x84, 0x00, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00,
+    0x02, 0x01, 0x17, 0x01, 0x82, 0x00, 0x00, 0x01, 0x84, 0x00, 0x81, 0x01, 0x00, 0x00, 0x86, 0x01,
+    0x00, 0x00, 0x82, 0x01, 0x13, 0x17, 0xff, 0x73, 0x8d, 0xff, 0x42, 0xce, 0x18, 0xa5, 0x5a, 0x2e,
+    0x49, 0x02, 0x05, 0x04, 0x05, 0x04, 0x05, 0x0c, 0x12, 0x05, 0x02, 0x04, 0x02, 0x81, 0x05, 0x0a,
+    0x02, 0x42, 0x04, 0x02, 0x07, 0x05, 0x02, 0x04, 0x5a, 0x05, 0x02, 0x81, 0x05, 0x03, 0x02, 0x11,
+    0x07, 0x02, 0x81, 0x04, 0x04, 0x12, 0x43, 0x66, 0x41, 0x42, 0x81, 0x14, 0x81, 0x0e, 0x0e, 0x20,
+    0x10, 0x68, 0x60, 0x0e, 0x61, 0x20, 0x10, 0x20, 0x0e, 0xff, 0x3b, 0xd4, 0x0e, 0x20, 0x14, 0x0e,
+    0x81, 0x20, 0x04, 0x82, 0x32, 0x05, 0x02, 0x33, 0x81, 0x04, 0x06, 0x05, 0x0c, 0x07, 0x02, 0x0c,
+    0x05, 0x04, 0x82, 0x07, 0x05, 0x04, 0x02, 0x2f, 0x22, 0x27, 0x15, 0x81, 0x06, 0x03, 0x1f, 0x0b,
+    0xdf, 0x0b, 0x82, 0x06, 0x00, 0x0f, 0x81, 0x06, 0x04, 0xa7, 0xd2, 0x36, 0x00, 0x01, 0x81, 0x00,
+    0x81, 0x01, 0x86, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x88, 0x00,
+    0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x85, 0x00, 0x06, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x17, 0x81, 0x01, 0x05, 0x17, 0x00, 0x21, 0x39, 0xbf, 0x8e, 0x83, 0x02, 0x04,
+    0x05, 0x02, 0x04, 0x07, 0x04, 0x81, 0x05, 0x03, 0x07, 0x04, 0x07, 0x02, 0x81, 0x05, 0x03, 0x02,
+    0x05, 0x02, 0x04, 0x81, 0x0c, 0x00, 0x05, 0x81, 0x02, 0x02, 0x07, 0x12, 0x07, 0x81, 0x02, 0x81,
+    0x07, 0x00, 0x02, 0x81, 0x07, 0x02, 0x11, 0x02, 0x34, 0x81, 0x02, 0x06, 0x99, 0x2e, 0x32, 0xff,
+    0x6c, 0xb7, 0x56, 0x10, 0x65, 0x81, 0x0e, 0x02, 0x5c, 0x14, 0x0e, 0x81, 0x10, 0x17, 0x5c, 0x0e,
+    0x14, 0x65, 0x0e, 0x14, 0x8a, 0x20, 0x0e, 0x64, 0x69, 0x33, 0x07, 0x02, 0x42, 0x34, 0x07, 0x02,
+    0x05, 0x04, 0x11, 0x02, 0x04, 0x12, 0x81, 0x04, 0x03, 0x1e, 0x23, 0x58, 0xc4, 0x82, 0x06, 0x02,
+    0x3f, 0x26, 0x0b, 0x81, 0x06, 0x08, 0x19, 0x0b, 0x26, 0x06, 0xd2, 0x19, 0x4f, 0xc1, 0x00, 0x81,
+    0x01, 0x85, 0x00, 0x81, 0x01, 0x01, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x83, 0x00, 0x83, 0x00,
+    0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x82, 0x01, 0x82, 0x00, 0x81, 0x01, 0x01, 0x00,
+    0x01, 0x81, 0x00, 0x84, 0x01, 0x81, 0x17, 0x03, 0x01, 0xff, 0xd6, 0x78, 0x21, 0x46, 0x81, 0x02,
+    0x07, 0x04, 0x02, 0x05, 0x02, 0x48, 0x04, 0x02, 0x05, 0x84, 0x04, 0x04, 0x07, 0x0c, 0x05, 0x07,
+    0x05, 0x82, 0x04, 0x05, 0x02, 0x07, 0x05, 0x0c, 0x02, 0x0c, 0x81, 0x04, 0x0a, 0x02, 0x33, 0x04,
+    0x02, 0x07, 0x04, 0x02, 0x07, 0x05, 0x04, 0x12, 0x81, 0x07, 0x81, 0x05, 0x05, 0x33, 0x41, 0xff,
+    0x11, 0x68, 0x10, 0x65, 0xe2, 0x81, 0x0e, 0x82, 0x14, 0x11, 0x20, 0x60, 0x14, 0x65, 0x0e, 0xb1,
+    0x10, 0x0e, 0xe1, 0x02, 0x9a, 0xa6, 0x05, 0x0c, 0x11, 0x05, 0x0c, 0x04, 0x81, 0x11, 0x00, 0x07,
+    0x81, 0x02, 0x06, 0x11, 0x05, 0x04, 0x28, 0x1c, 0x3c, 0x0a, 0x82, 0x06, 0x03, 0x19, 0x06, 0x0a,
+    0x06, 0x82, 0x0f, 0x81, 0x1f, 0x03, 0x19, 0x1f, 0xc5, 0x01, 0x85, 0x00, 0x00, 0x01, 0x82, 0x00,
+    0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x82, 0x01, 0x00, 0x01, 0x83, 0x00, 0x04, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x01, 0x00, 0x89, 0x01, 0x00,
+    0x17, 0x81, 0x01, 0x04, 0x98, 0x21, 0x02, 0x0c, 0x05, 0x81, 0x04, 0x81, 0x02, 0x00, 0x99, 0x82,
+    0x43, 0x0b, 0x0c, 0x12, 0x11, 0x04, 0x12, 0x04, 0x12, 0x04, 0x34, 0x12, 0x02, 0x07, 0x81, 0x05,
+    0x82, 0x02, 0x03, 0x04, 0x02, 0x0c, 0x05, 0x81, 0x07, 0x81, 0x05, 0x82, 0x04, 0x01, 0x02, 0x04,
+    0x81, 0x02, 0x0f, 0x0c, 0x07, 0x02, 0x11, 0x02, 0x48, 0x02, 0x05, 0x48, 0x49, 0x21, 0xff, 0x5c,
+    0x15, 0x14, 0x5c, 0x0e, 0xc2, 0x81, 0x14, 0x11, 0x65, 0x10, 0x0e, 0x56, 0x10, 0x5c, 0x56, 0xff,
+    0x00, 0x43, 0x02, 0x07, 0x0c, 0x21, 0x05, 0x42, 0x05, 0x07, 0x11, 0x07, 0x81, 0x0c, 0x1a, 0x05,
+    0x0c, 0x04, 0x11, 0x07, 0x3d, 0x1c, 0x77, 0x8b, 0x15, 0x26, 0x06, 0x38, 0x0f, 0xff, 0xee, 0x2d,
+    0x0b, 0x06, 0x0b, 0x0f, 0x19, 0x3f, 0x0b, 0xff, 0x9b, 0x84, 0xe5, 0xc3, 0x00, 0x01, 0x84, 0x00,
+    0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01,
+    0x82, 0x00, 0x02, 0x01, 0x00, 0x01, 0x82, 0x00, 0x81, 0x01, 0x82, 0x00, 0x81, 0x01, 0x82, 0x00,
+    0x01, 0x01, 0x00, 0x85, 0x01, 0x03, 0x17, 0xa0, 0x41, 0x0c, 0x81, 0x02, 0x08, 0xff, 0x19, 0xa9,
+    0xff, 0x19, 0xeb, 0xff, 0x3b, 0x52, 0x82, 0x56, 0xff, 0x2b, 0x33, 0x0e, 0x14, 0x10, 0x81, 0x56,
+    0x0b, 0x0e, 0xe1, 0xfd, 0xff, 0x32, 0xef, 0xff, 0x00, 0x84, 0x9a, 0x02, 0x2f, 0x48, 0x07, 0x05,
+    0x04, 0x82, 0x07, 0x03, 0x02, 0x07, 0x04, 0x02, 0x81, 0x05, 0x81, 0x07, 0x81, 0x05, 0x06, 0x04,
+    0x05, 0x02, 0x34, 0x02, 0x07, 0x5a, 0x81, 0x0c, 0x03, 0x12, 0x04, 0x0c, 0x05, 0x81, 0x11, 0x04,
+    0x02, 0x34, 0x46, 0x58, 0xd6, 0x81, 0x0e, 0x81, 0x14, 0x09, 0x0e, 0x5c, 0x20, 0xc2, 0x0e, 0x68,
+    0x0e, 0xff, 0x2a, 0x09, 0x04, 0x05, 0x81, 0x02, 0x05, 0x21, 0x07, 0x02, 0x05, 0x42, 0x07, 0x81,
+    0x04, 0x01, 0x0c, 0x02, 0x82, 0x05, 0x05, 0x2b, 0x1c, 0x88, 0xff, 0xcd, 0x2c, 0x84, 0x0b, 0x81,
+    0x06, 0x81, 0x0b, 0x02, 0xe6, 0x0b, 0x0f, 0x81, 0x06, 0x04, 0x0f, 0x06, 0xe6, 0xfb, 0xff, 0xd6,
+    0x55, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x00, 0x00, 0x81, 0x01, 0x86, 0x00, 0x81,
+    0x01, 0x82, 0x00, 0x8a, 0x00, 0x81, 0x01, 0x03, 0x00, 0x01, 0x00, 0x01, 0x83, 0x00, 0x83, 0x01,
+    0x09, 0xc6, 0xff, 0x8c, 0x0e, 0x35, 0x05, 0xff, 0x32, 0xce, 0xff, 0x33, 0x52, 0x10, 0x14, 0x0e,
+    0x5c, 0x81, 0x0e, 0x09, 0x10, 0xb1, 0x10, 0x14, 0x56, 0x10, 0x0e, 0x14, 0x0e, 0x14, 0x81, 0x10,
+    0x0d, 0x8a, 0xff, 0x2b, 0x53, 0xb1, 0xa8, 0x63, 0x46, 0x05, 0x34, 0x02, 0x04, 0x07, 0x04, 0x07,
+    0x05, 0x82, 0x02, 0x01, 0x0c, 0x04, 0x81, 0x02, 0x05, 0x04, 0x07, 0x04, 0x11, 0x02, 0x0c, 0x81,
+    0x05, 0x01, 0x07, 0x02, 0x82, 0x04, 0x00, 0x07, 0x82, 0x02, 0x06, 0x04, 0x33, 0x41, 0xff, 0x4c,
+    0x36, 0x8a, 0x0e, 0x14, 0x81, 0x0e, 0x04, 0x14, 0x0e, 0x61, 0x14, 0x34, 0x81, 0x02, 0x08, 0x3e,
+    0x04, 0x02, 0x62, 0x04, 0x02, 0x05, 0x04, 0x02, 0x81, 0x04, 0x03, 0x2f, 0x6a, 0x02, 0x1e, 0x81,
+    0x23, 0x03, 0x3b, 0xff, 0xa4, 0x0a, 0x15, 0x8f, 0x83, 0x06, 0x06, 0xe7, 0x1f, 0x0b, 0x26, 0x19,
+    0x0b, 0x19, 0x81, 0x0b, 0x04, 0x36, 0x00, 0x01, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00,
+    0x81, 0x01, 0x01, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00, 0x82, 0x00, 0x81, 0x01, 0x00,
+    0x00, 0x83, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x00, 0x00, 0x82, 0x01, 0x05,
+    0x17, 0x00, 0x17, 0xff, 0x94, 0x4f, 0x64, 0xff, 0x43, 0x92, 0x81, 0x0e, 0x06, 0x14, 0x55, 0x5c,
+    0xfd, 0xff, 0x53, 0xd3, 0xff, 0x22, 0x0a, 0xbf, 0x82, 0x27, 0x00, 0xa0, 0x82, 0x27, 0x06, 0x2e,
+    0x5a, 0xff, 0x5c, 0x75, 0xff, 0x4b, 0xf4, 0x14, 0x10, 0x14, 0x84, 0x10, 0x04, 0xff, 0x4b, 0xd5,
+    0xff, 0x00, 0xa5, 0xa6, 0x05, 0x07, 0x81, 0x04, 0x03, 0x02, 0x07, 0x05, 0x34, 0x81, 0x04, 0x03,
+    0x11, 0x02, 0x42, 0x05, 0x81, 0x04, 0x01, 0x02, 0x04, 0x81, 0x0c, 0x02, 0x02, 0x33, 0x12, 0x81,
+    0x02, 0x15, 0x04, 0x05, 0x04, 0x02, 0x04, 0x07, 0x04, 0x46, 0x21, 0x82, 0x5c, 0x10, 0x20, 0x0e,
+    0x10, 0x0e, 0xa8, 0x04, 0x33, 0x04, 0x05, 0x02, 0x81, 0x05, 0x10, 0x32, 0x99, 0x02, 0x05, 0x04,
+    0x05, 0x04, 0x07, 0x02, 0x04, 0x1c, 0x2b, 0x1c, 0x78, 0xff, 0x39, 0x22, 0x16, 0x0d, 0x81, 0x0b,
+    0x81, 0x06, 0x01, 0x0b, 0x26, 0x83, 0x06, 0x81, 0x0f, 0x02, 0xa9, 0x4f, 0x01, 0x81, 0x00, 0x01,
+    0x01, 0x00, 0x82, 0x01, 0x8d, 0x00, 0x86, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00,
+    0x86, 0x01, 0x10, 0x17, 0x45, 0x74, 0xe0, 0x20, 0xb1, 0x0e, 0xff, 0x4b, 0xf4, 0xff, 0x19, 0x89,
+    0x41, 0x74, 0xff, 0x10, 0x60, 0xff, 0x8b, 0x66, 0x93, 0x1d, 0x4e, 0xb3, 0x81, 0x0a, 0x0a, 0x1d,
+    0x6b, 0x2a, 0x0d, 0xb4, 0x3a, 0x51, 0xff, 0x18, 0x81, 0x98, 0x5a, 0xff, 0x3b, 0xd4, 0x81, 0x0e,
+    0x07, 0x10, 0x0e, 0x55, 0x0e, 0x5c, 0xd6, 0x2e, 0x43, 0x81, 0x07, 0x07, 0x05, 0x07, 0x04, 0x11,
+    0x0c, 0x05, 0x34, 0x07, 0x81, 0x02, 0x0d, 0x34, 0x02, 0x07, 0x02, 0x04, 0x02, 0x12, 0x02, 0x11,
+    0x05, 0x0c, 0x04, 0x02, 0x3e, 0x81, 0x0c, 0x04, 0x02, 0x07, 0x02, 0x63, 0xff, 0x00, 0x84, 0x81,
+    0x14, 0x00, 0x60, 0x81, 0x20, 0x02, 0x1e, 0x02, 0x04, 0x82, 0x02, 0x04, 0x07, 0x05, 0x12, 0x9a,
+    0x69, 0x82, 0x02, 0x03, 0x04, 0x11, 0x02, 0x04, 0x81, 0x23, 0x05, 0x29, 0x23, 0x27, 0x15, 0x0d,
+    0x81, 0x81, 0x06, 0x05, 0x0b, 0x0f, 0xc7, 0x0f, 0x1f, 0x06, 0x81, 0x0b, 0x03, 0x06, 0x1f, 0x6d,
+    0x01, 0x8b, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x83,
+    0x01, 0x01, 0x00, 0xa3, 0x82, 0x00, 0x82, 0x01, 0x81, 0x00, 0x83, 0x01, 0x0c, 0x00, 0x27, 0xd7,
+    0x14, 0x61, 0xff, 0x5c, 0x55, 0xbe, 0x62, 0xff, 0x10, 0xc3, 0x3b, 0x29, 0xff, 0x18, 0xe4, 0xff,
+    0x62, 0x02, 0x81, 0x25, 0x0b, 0x0a, 0x80, 0x25, 0x2d, 0xe8, 0x83, 0x25, 0x0d, 0xc8, 0x85, 0xff,
+    0xfe, 0x13, 0x1a, 0x82, 0x1b, 0x03, 0xff, 0x93, 0x6a, 0xff, 0x10, 0x41, 0xbe, 0xff, 0x54, 0x14,
+    0x81, 0x0e, 0x01, 0x68, 0x14, 0x82, 0x0e, 0x05, 0xff, 0x5c, 0x14, 0xe9, 0x0c, 0x07, 0x33, 0x04,
+    0x83, 0x02, 0x02, 0x11, 0x02, 0x11, 0x82, 0x02, 0x81, 0x05, 0x84, 0x07, 0x01, 0x02, 0x05, 0x81,
+    0x07, 0x03, 0x12, 0x04, 0x07, 0x0c, 0x81, 0x02, 0x01, 0xd5, 0xff, 0x3a, 0xce, 0x81, 0x61, 0x04,
+    0xff, 0x43, 0x50, 0x07, 0x04, 0x02, 0x07, 0x81, 0x02, 0x81, 0x04, 0x0a, 0x07, 0x02, 0x46, 0x33,
+    0x05, 0x11, 0x12, 0x05, 0x02, 0x49, 0x22, 0x81, 0x1c, 0x02, 0xe4, 0x27, 0x0d, 0x81, 0x0a, 0x00,
+    0x19, 0x83, 0x06, 0x01, 0x0b, 0x1f, 0x82, 0x06, 0x81, 0x0b, 0x01, 0x4d, 0xff, 0xf7, 0x5b, 0x86,
+    0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x81,
+    0x00, 0x00, 0x01, 0x82, 0x00, 0x81, 0x01, 0x81, 0x00, 0x83, 0x01, 0x07, 0x71, 0x2e, 0xea, 0x5c,
+    0xff, 0x43, 0x30, 0x21, 0x41, 0x78, 0x81, 0x3b, 0x06, 0x4b, 0x1c, 0x52, 0x2a, 0x0a, 0x15, 0x0a,
+    0x81, 0x25, 0x02, 0x0a, 0x25, 0x54, 0x81, 0x0d, 0x03, 0xc9, 0xd8, 0x1a, 0x1b, 0x81, 0x1a, 0x06,
+    0x50, 0x1a, 0x1b, 0xff, 0xed, 0x91, 0xff, 0x31, 0x01, 0xff, 0x18, 0x81, 0x2f, 0x82, 0x10, 0x05,
+    0xc2, 0x10, 0xe2, 0x0e, 0xff, 0x54, 0x36, 0x2e, 0x81, 0x02, 0x02, 0x0c, 0x02, 0x05, 0x81, 0x02,
+    0x00, 0x04, 0x81, 0x02, 0x18, 0x04, 0x02, 0x05, 0x02, 0x07, 0x05, 0x07, 0x05, 0x02, 0x11, 0x04,
+    0x05, 0x07, 0x12, 0x0c, 0x07, 0x04, 0x02, 0x05, 0x02, 0x1c, 0x35, 0x2c, 0xff, 0x00, 0x84, 0x02,
+    0x81, 0x04, 0x04, 0x12, 0x04, 0x12, 0x02, 0x05, 0x81, 0x02, 0x04, 0x07, 0x1e, 0xa6, 0x04, 0x2f,
+    0x81, 0x0c, 0x0a, 0x22, 0x1c, 0x29, 0x1c, 0x78, 0x98, 0x0d, 0x0a, 0x15, 0x0b, 0x0f, 0x82, 0x06,
+    0x00, 0x0f, 0x81, 0x06, 0x00, 0x0f, 0x82, 0x06, 0x05, 0xff, 0x49, 0x80, 0x45, 0x00, 0x01, 0x00,
+    0x01, 0x81, 0x00, 0x82, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00,
+    0x01, 0x82, 0x00, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x00,
+    0x00, 0x82, 0x01, 0x11, 0x17, 0xff, 0xf7, 0xbd, 0x21, 0x61, 0xff, 0x43, 0x72, 0x70, 0x35, 0x3b,
+    0x1c, 0x4b, 0x3b, 0x4b, 0x3b, 0x62, 0xff, 0xbc, 0xca, 0x1d, 0x44, 0x57, 0x81, 0x2d, 0x81, 0x15,
+    0x00, 0x5b, 0x81, 0x0a, 0x03, 0x25, 0x31, 0x1a, 0x1b, 0x82, 0x1a, 0x81, 0x1b, 0x16, 0x50, 0x94,
+    0x37, 0x0d, 0xff, 0xb4, 0x8b, 0xca, 0xff, 0x11, 0x27, 0x14, 0x0e, 0xff, 0x3b, 0xd4, 0x0e, 0x14,
+    0x20, 0x10, 0xff, 0x4b, 0xd4, 0x2e, 0x6c, 0x04, 0x02, 0x05, 0x59, 0x04, 0x07, 0x81, 0x05, 0x81,
+    0x02, 0x08, 0x04, 0x02, 0x04, 0x02, 0x04, 0x12, 0x0c, 0x04, 0x05, 0x81, 0x02, 0x0c, 0x05, 0x02,
+    0x04, 0x69, 0x2e, 0xff, 0x4b, 0x92, 0x61, 0x0e, 0x58, 0xae, 0x02, 0x07, 0x04, 0x81, 0x05, 0x81,
+    0x02, 0x0b, 0x05, 0x04, 0x48, 0x02, 0x42, 0x33, 0x43, 0x05, 0x02, 0x04, 0x1c, 0xb5, 0x82, 0x1c,
+    0x05, 0x21, 0x0a, 0x2d, 0x44, 0x06, 0xff, 0xe5, 0x8b, 0x81, 0x06, 0x04, 0x0b, 0xff, 0xbc, 0xa8,
+    0x06, 0x26, 0x06, 0x81, 0x0b, 0x04, 0x0f, 0xff, 0xcd, 0x2b, 0xff, 0x9c, 0x4d, 0x00, 0x01, 0x88,
+    0x00, 0x82, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x81,
+    0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x82, 0x01, 0x06, 0x17, 0xff, 0x20, 0xe2, 0xff, 0x08, 0xc5,
+    0xff, 0x3b, 0x31, 0x58, 0x21, 0x4b, 0x81, 0x40, 0x00, 0x4b, 0x81, 0x3b, 0x04, 0x40, 0xff, 0x19,
+    0x04, 0x53, 0x0a, 0x16, 0x82, 0x0a, 0x03, 0x15, 0x57, 0x0a, 0x83, 0x81, 0x0a, 0x06, 0xeb, 0xff,
+    0xed, 0xf2, 0x94, 0x1b, 0xd9, 0x1a, 0x50, 0x82, 0x1b, 0x0a, 0x1a, 0x37, 0x1d, 0x16, 0x2d, 0x7a,
+    0xff, 0x51, 0xa2, 0x35, 0xd6, 0x20, 0x0e, 0x81, 0x10, 0x0a, 0x0e, 0x20, 0x60, 0xff, 0x4b, 0x92,
+    0x2e, 0x46, 0x04, 0x02, 0x05, 0x04, 0x02, 0x81, 0x04, 0x81, 0x05, 0x81, 0x04, 0x81, 0x02, 0x01,
+    0x07, 0x04, 0x81, 0x02, 0x06, 0x07, 0x43, 0x77, 0xa8, 0x14, 0x10, 0x0e, 0x81, 0x20, 0x0c, 0xff,
+    0x32, 0xaf, 0x04, 0x88, 0x11, 0x07, 0x05, 0x04, 0x34, 0x02, 0x04, 0x0c, 0x05, 0x07, 0x81, 0x02,
+    0x03, 0x23, 0xff, 0x42, 0x8c, 0x02, 0x3d, 0x81, 0x1c, 0x00, 0x23, 0x81, 0x29, 0x05, 0xff, 0x08,
+    0x21, 0xff, 0x82, 0xe4, 0x16, 0x0d, 0xb6, 0x06, 0x81, 0x0b, 0x81, 0x06, 0x00, 0x3f, 0x81, 0x06,
+    0x05, 0x0b, 0x1f, 0x0f, 0xff, 0xf6, 0x6f, 0x36, 0x01, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00, 0x83,
+    0x01, 0x84, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x00, 0x01, 0x83, 0x00, 0x02, 0x01, 0x00,
+    0x01, 0x82, 0x00, 0x81, 0x01, 0x0c, 0x00, 0x01, 0x00, 0xff, 0xf7, 0x7c, 0xff, 0x08, 0x84, 0xff,
+    0x4b, 0x2f, 0x21, 0x29, 0x3b, 0x66, 0x40, 0x66, 0x4b, 0x81, 0x3b, 0x01, 0x89, 0x62, 0x81, 0x0a,
+    0x01, 0x4e, 0x0a, 0x81, 0x1d, 0x81, 0x0a, 0x04, 0x2d, 0xff, 0xa4, 0x07, 0x16, 0x0a, 0x7a, 0x81,
+    0x1b, 0x00, 0x1a, 0x81, 0x1b, 0x01, 0x47, 0x94, 0x81, 0x1b, 0x01, 0x1a, 0x31, 0x81, 0x0a, 0x08,
+    0x2d, 0xc8, 0x15, 0x0a, 0xff, 0x72, 0xa4, 0xff, 0x10, 0x61, 0xff, 0x54, 0x14, 0xff, 0x33, 0x33,
+    0x14, 0x82, 0x0e, 0x05, 0x14, 0x10, 0xb1, 0xff, 0x09, 0x26, 0x21, 0xff, 0x3a, 0x8b, 0x81, 0x12,
+    0x03, 0x3e, 0x02, 0x12, 0x07, 0x85, 0x02, 0x05, 0xae, 0x32, 0xff, 0x19, 0xc9, 0xff, 0x43, 0xf4,
+    0x10, 0x14, 0x83, 0x0e, 0x06, 0x55, 0xff, 0x32, 0x8e, 0x4c, 0xff, 0x42, 0xac, 0xff, 0x28, 0xc1,
+    0x23, 0x04, 0x81, 0x07, 0x81, 0x02, 0x08, 0x04, 0x12, 0x07, 0x02, 0x33, 0x04, 0x76, 0x99, 0x29,
+    0x81, 0x1c, 0x04, 0x22, 0x78, 0x1c, 0xa0, 0x9b, 0x81, 0x0a, 0x07, 0x0d, 0x0b, 0x0f, 0x06, 0x0b,
+    0x06, 0xa9, 0x0b, 0x81, 0x06, 0x03, 0x38, 0x06, 0x1f, 0x53, 0x84, 0x00, 0x81, 0x01, 0x01, 0x00,
+    0x01, 0x81, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x01, 0x00, 0x83, 0x01,
+    0x03, 0xff, 0xf7, 0x9d, 0x32, 0x40, 0x35, 0x84, 0x3b, 0x01, 0x40, 0x66, 0x81, 0x40, 0x01, 0x41,
+    0xff, 0x83, 0x27, 0x81, 0x0a, 0x81, 0x2d, 0x00, 0x0a, 0x81, 0x1d, 0x0c, 0x15, 0xec, 0x0d, 0x1d,
+    0xaa, 0xed, 0x94, 0x50, 0x1b, 0x50, 0x1a, 0x30, 0x1a, 0x81, 0x1b, 0x02, 0x50, 0x7a, 0x25, 0x81,
+    0x0a, 0x08, 0x6b, 0x0d, 0x0a, 0x0d, 0x0a, 0xff, 0xbc, 0xab, 0xff, 0x18, 0x81, 0xff, 0x19, 0x27,
+    0x10, 0x81, 0x0e, 0x00, 0x14, 0x82, 0x0e, 0x81, 0x14, 0x05, 0xff, 0x43, 0xf4, 0xff, 0x43, 0x30,
+    0xff, 0x00, 0xa4, 0xbf, 0x21, 0xff, 0x08, 0x63, 0x81, 0x21, 0x02, 0x2e, 0xa8, 0xff, 0x4b, 0xb3,
+    0x82, 0x0e, 0x02, 0x10, 0x20, 0xff, 0x33, 0x52, 0x81, 0x0e, 0x81, 0x61, 0x81, 0xff, 0x32, 0xcf,
+    0x12, 0x1c, 0x86, 0xff, 0xb4, 0x89, 0x0a, 0x9d, 0xff, 0x08, 0x40, 0x02, 0x04, 0x02, 0x07, 0x12,
+    0x0c, 0x07, 0x48, 0x02, 0x0c, 0x07, 0x66, 0x23, 0x82, 0x1c, 0x81, 0x29, 0x04, 0x27, 0x0d, 0x15,
+    0x0a, 0xc4, 0x82, 0x06, 0x81, 0x0b, 0x02, 0xbd, 0x0f, 0x0b, 0x82, 0x06, 0x02, 0x19, 0x31, 0x17,
+    0x83, 0x00, 0x00, 0x01, 0x8b, 0x00, 0x82, 0x01, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x86, 0x00,
+    0x82, 0x01, 0x14, 0x00, 0x21, 0x02, 0x62, 0x29, 0x1c, 0x3b, 0x66, 0x40, 0x3b, 0x89, 0x4b, 0x40,
+    0x3b, 0xff, 0x10, 0x60, 0x16, 0x2d, 0xda, 0x2d, 0x4e, 0x2d, 0x81, 0x0d, 0x08, 0x16, 0xff, 0x62,
+    0x21, 0x0a, 0x16, 0x37, 0xff, 0xe5, 0x90, 0x1a, 0x1b, 0x50, 0x82, 0x1a, 0x00, 0x30, 0x81, 0x1b,
+    0x08, 0x50, 0x7a, 0x16, 0x15, 0x2d, 0x9b, 0x0a, 0x1d, 0x0d, 0x81, 0x2a, 0x05, 0x1d, 0xee, 0xca,
+    0xff, 0x00, 0xa4, 0x10, 0x20, 0x83, 0x14, 0x02, 0x10, 0x65, 0x14, 0x81, 0x0e, 0x03, 0xff, 0x3b,
+    0xd4, 0x10, 0x0e, 0xff, 0x2b, 0x12, 0x81, 0x10, 0x0e, 0x14, 0x0e, 0x14, 0x56, 0x10, 0x56, 0x20,
+    0x55, 0xff, 0x2b, 0x53, 0xff, 0x33, 0x31, 0xff, 0x3b, 0x30, 0xd5, 0xdb, 0xff, 0xac, 0x49, 0x44,
+    0x81, 0x0a, 0x02, 0x15, 0xff, 0xa3, 0xe8, 0x6e, 0x83, 0x02, 0x04, 0x11, 0x04, 0x05, 0x02, 0x04,
+    0x81, 0x02, 0x01, 0x21, 0x22, 0x82, 0x1c, 0x06, 0x23, 0x27, 0x25, 0x1d, 0x0d, 0x25, 0x26, 0x82,
+    0x06, 0x81, 0x0b, 0x06, 0x19, 0x38, 0x0f, 0x06, 0x19, 0x0f, 0x31, 0x82, 0x01, 0x83, 0x00, 0x00,
+    0x01, 0x82, 0x00, 0x00, 0x01, 0x88, 0x00, 0x8b, 0x00, 0x81, 0x01, 0x21, 0x45, 0xff, 0x32, 0x09,
+    0x35, 0x40, 0x29, 0x40, 0x29, 0x4b, 0x40, 0x4b, 0x3b, 0x40, 0x3b, 0x41, 0xff, 0x8b, 0x47, 0x0a,
+    0xc8, 0x4e, 0xff, 0x93, 0x44, 0x25, 0x1d, 0x0a, 0x57, 0x2d, 0xff, 0xac, 0x48, 0x25, 0x92, 0xff,
+    0x6a, 0x03, 0x30, 0x1a, 0x30, 0x50, 0x30, 0x1b, 0x81, 0x50, 0x00, 0x1a, 0x81, 0x1b, 0x11, 0xff,
+    0x51, 0x20, 0xff, 0xc4, 0xcb, 0x0d, 0x0a, 0x8c, 0x16, 0x72, 0x25, 0x0d, 0x57, 0x0a, 0x25, 0x16,
+    0xe7, 0x86, 0x27, 0xff, 0x5c, 0x55, 0x20, 0x81, 0x0e, 0x1f, 0x8a, 0xb0, 0x55, 0x20, 0x55, 0xb1,
+    0x10, 0x0e, 0x10, 0x65, 0x10, 0x0e, 0x10, 0x14, 0x10, 0x55, 0x14, 0xff, 0x23, 0x11, 0x60, 0x1e,
+    0xa0, 0xff, 0x49, 0x61, 0xef, 0xff, 0xac, 0x48, 0x0a, 0x5b, 0x44, 0x0a, 0x1d, 0x0d, 0x54, 0x53,
+    0x81, 0x02, 0x01, 0x0c, 0x12, 0x81, 0x02, 0x05, 0x05, 0x04, 0x49, 0x1c, 0x23, 0x88, 0x81, 0x1c,
+    0x03, 0x23, 0x1c, 0xca, 0x16, 0x81, 0x1d, 0x04, 0x0a, 0xff, 0xcd, 0x2a, 0x0b, 0x1f, 0x0f, 0x81,
+    0x06, 0x01, 0x19, 0x0b, 0x81, 0x06, 0x03, 0x0b, 0x19, 0x75, 0xff, 0xf7, 0x7b, 0x81, 0x00, 0x00,
+    0x01, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0x8d, 0x00, 0x07, 0xff, 0xad, 0x12, 0x7e,
+    0x62, 0x29, 0x40, 0x3b, 0x40, 0x66, 0x81, 0x3b, 0x13, 0x76, 0x4b, 0x66, 0xff, 0x18, 0x61, 0x0a,
+    0x1d, 0xeb, 0x4e, 0x0a, 0x1d, 0x15, 0x0a, 0x15, 0xc0, 0x0a, 0x4e, 0x3a, 0x1a, 0x94, 0x30, 0x81,
+    0x1a, 0x0d, 0x1b, 0x30, 0x1a, 0x1b, 0x30, 0x1b, 0x1a, 0xff, 0xfe, 0x53, 0x4a, 0x0a, 0x15, 0xff,
+    0x61, 0xe0, 0x16, 0x2a, 0x81, 0x0a, 0x82, 0x0d, 0x12, 0x0a, 0x0d, 0x0a, 0x4f, 0xff, 0xfe, 0xb5,
+    0x27, 0x35, 0xff, 0x00, 0xa4, 0xff, 0x43, 0x0f, 0xff, 0x5c, 0x75, 0xe1, 0x82, 0x14, 0xff, 0x2b,
+    0x12, 0xff, 0x33, 0x52, 0x20, 0x14, 0x5c, 0x56, 0x81, 0x20, 0x0e, 0xe1, 0xff, 0x43, 0x71, 0xff,
+    0x08, 0xe5, 0x35, 0x53, 0xff, 0x93, 0xc7, 0x0d, 0x80, 0x0a, 0x16, 0xff, 0x6a, 0x62, 0x9b, 0x15,
+    0x16, 0xff, 0xd5, 0x4b, 0x81, 0x06, 0x05, 0x0a, 0xff, 0xa4, 0x07, 0x51, 0xff, 0x19, 0x04, 0x05,
+    0x02, 0x81, 0x05, 0x16, 0x11, 0x04, 0x02, 0xb5, 0xe4, 0x3b, 0x1e, 0x29, 0x1c, 0x40, 0xff, 0x72,
+    0xa5, 0x16, 0xdf, 0x0a, 0x16, 0x0b, 0x0f, 0x0b, 0x1f, 0x06, 0x0b, 0xff, 0x8b, 0x03, 0x19, 0x81,
+    0x06, 0x03, 0x38, 0x0f, 0xff, 0x61, 0xe1, 0x45, 0x86, 0x00, 0x81, 0x01, 0x83, 0x00, 0x00, 0x01,
+    0x84, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01,
+    0x00, 0x00, 0x81, 0x01, 0x0d, 0x67, 0xff, 0x42, 0x4a, 0x3c, 0x4b, 0xff, 0x11, 0x25, 0x89, 0x3b,
+    0x4b, 0x3b, 0x66, 0x4b, 0x89, 0xff, 0x18, 0xe4, 0xff, 0xa3, 0xe8, 0x81, 0x1d, 0x0c, 0xda, 0x9b,
+    0x0a, 0x4e, 0x0a, 0x1d, 0x0a, 0xff, 0x49, 0x20, 0x0d, 0x1d, 0x4d, 0x1a, 0x30, 0x82, 0x1b, 0x00,
+    0x50, 0x81, 0x1b, 0x81, 0x50, 0x81, 0x1b, 0x06, 0xd9, 0x53, 0x0d, 0x0a, 0xdf, 0x0a, 0x15, 0x81,
+    0x0a, 0x06, 0x16, 0x15, 0x25, 0x0d, 0x4e, 0x92, 0xff, 0xed, 0xd2, 0x82, 0x1a, 0x03, 0xff, 0xed,
+    0xb1, 0xff, 0xfe, 0xb6, 0xff, 0x8b, 0x6a, 0x86, 0x82, 0x27, 0x00, 0x58, 0x81, 0x35, 0x01, 0xff,
+    0x08, 0x21, 0xbe, 0x81, 0x27, 0x02, 0xff, 0x38, 0xe2, 0xff, 0xd5, 0x92, 0xed, 0x81, 0x1a, 0x0a,
+    0x5f, 0x0d, 0x0a, 0x15, 0x25, 0x0d, 0x2d, 0x80, 0x3f, 0x1f, 0x3f, 0x81, 0x0f, 0x1f, 0xc7, 0x0d,
+    0x4a, 0x78, 0x04, 0x02, 0x04, 0x05, 0x04, 0x2b, 0xff, 0x11, 0x25, 0x1c, 0x23, 0x21, 0x28, 0x1c,
+    0x3c, 0xff, 0xc4, 0xaa, 0x0a, 0xff, 0x7a, 0xa2, 0x15, 0x2d, 0xa9, 0x06, 0x0f, 0x0b, 0x26, 0x19,
+    0x81, 0x38, 0x06, 0x1f, 0x81, 0x06, 0x01, 0xff, 0xe5, 0xcd, 0xff, 0xa4, 0xaf, 0x83, 0x00, 0x81,
+    0x01, 0x8c, 0x00, 0x00, 0x01, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x85, 0x00, 0x81, 0x01, 0x01,
+    0x27, 0x58, 0x81, 0x4b, 0x01, 0x66, 0x3b, 0x81, 0x40, 0x00, 0x3b, 0x81, 0x4b, 0x02, 0x35, 0x25,
+    0x16, 0x81, 0x2d, 0x13, 0xcb, 0x0d, 0x0a, 0x2d, 0x16, 0x15, 0xff, 0x93, 0x66, 0x2a, 0x6b, 0xff,
+    0xf5, 0xf2, 0x50, 0xff, 0xed, 0x71, 0xff, 0xdd, 0x0f, 0xff, 0xf5, 0xf2, 0xed, 0xff, 0xf6, 0x13,
+    0x1a, 0x1b, 0xff, 0xe5, 0x90, 0x94, 0x81, 0x1b, 0x05, 0xff, 0xf5, 0xb1, 0x3a, 0x2d, 0x15, 0xff,
+    0x51, 0xc0, 0x15, 0x81, 0x0a, 0x00, 0x16, 0x81, 0x0d, 0x07, 0x2d, 0x15, 0x0a, 0x37, 0xff, 0xe5,
+    0x6f, 0x1a, 0x47, 0x1a, 0x81, 0x1b, 0x81, 0x1a, 0x00, 0x50, 0x81, 0x1b, 0x07, 0x30, 0x1b, 0x50,
+    0x1b, 0x1a, 0x30, 0x1a, 0x1b, 0x81, 0x1a, 0x09, 0x1b, 0x1a, 0xff, 0xfe, 0x74, 0xab, 0x16, 0x0d,
+    0x0a, 0xc7, 0x4f, 0x0f, 0x82, 0x06, 0x07, 0x26, 0x38, 0x0f, 0xb6, 0x15, 0x7d, 0x35, 0x07, 0x81,
+    0x02, 0x0e, 0x07, 0xb5, 0x29, 0xff, 0x21, 0x47, 0x1c, 0x29, 0x88, 0x29, 0x21, 0xb3, 0x2a, 0x6b,
+    0x1d, 0x0a, 0x57, 0x81, 0x06, 0x0a, 0x0b, 0x0f, 0x06, 0x0b, 0xc4, 0x06, 0x0b, 0x19, 0x0f, 0xfb,
+    0x36, 0x84, 0x00, 0x02, 0x01, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x82,
+    0x00, 0x81, 0x01, 0x00, 0x00, 0x81, 0x01, 0x84, 0x00, 0x08, 0x01, 0x17, 0x27, 0x41, 0x66, 0x3b,
+    0x66, 0x89, 0x4b, 0x81, 0x40, 0x01, 0x4b, 0xdb, 0x81, 0x0a, 0x02, 0x5b, 0x0a, 0xcb, 0x81, 0x1d,
+    0x81, 0x0d, 0x0f, 0x0a, 0x54, 0x57, 0x85, 0x1b, 0xed, 0x6d, 0xde, 0xe5, 0x8c, 0xf0, 0x3a, 0x4d,
+    0xff, 0xf6, 0x33, 0x47, 0x1a, 0x81, 0x1b, 0x03, 0xff, 0xcc, 0xee, 0x0d, 0x16, 0x8c, 0x81, 0x0a,
+    0x02, 0x15, 0x0a, 0x16, 0x82, 0x0a, 0x03, 0x16, 0x85, 0x1a, 0x1b, 0x81, 0x1a, 0x03, 0x1b, 0x47,
+    0x1b, 0x1a, 0x81, 0x1b, 0x01, 0x1a, 0x1b, 0x81, 0x50, 0x01, 0x30, 0xff, 0xed, 0x91, 0x82, 0x1b,
+    0x02, 0x1a, 0x1b, 0x94, 0x81, 0x1a, 0x06, 0x37, 0x2a, 0x80, 0x91, 0x06, 0xff, 0xe5, 0xcd, 0xff,
+    0xee, 0x0e, 0x81, 0x06, 0x00, 0x0b, 0x81, 0x19, 0x07, 0x38, 0x0b, 0x8f, 0x15, 0x31, 0x58, 0x05,
+    0x02, 0x81, 0x23, 0x13, 0x29, 0x1c, 0x29, 0x1c, 0x63, 0x29, 0x41, 0x2a, 0x25, 0x54, 0x15, 0x0f,
+    0x1d, 0x0b, 0x0f, 0x06, 0x0f, 0x1f, 0x06, 0xff, 0x82, 0xe2, 0x82, 0x06, 0x03, 0x26, 0x0b, 0xb7,
+    0x01, 0x83, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01,
+    0x01, 0x00, 0x01, 0x82, 0x00, 0x02, 0x01, 0x00, 0x01, 0x84, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01,
+    0x0c, 0xff, 0x6b, 0x4b, 0x3c, 0xff, 0x10, 0xc3, 0x29, 0x4b, 0x3b, 0x40, 0x66, 0x88, 0xff, 0xbc,
+    0xab, 0x2a, 0x0a, 0x7a, 0x81, 0xcc, 0x09, 0x16, 0x0d, 0x16, 0x2a, 0x15, 0x5b, 0x25, 0x3a, 0xf1,
+    0xd8, 0x81, 0xf2, 0x10, 0x95, 0x3a, 0x37, 0xff, 0x61, 0xe1, 0xff, 0x82, 0xa2, 0x8c, 0x6f, 0x50,
+    0x1b, 0xff, 0xe5, 0x71, 0xff, 0xe5, 0x91, 0xb8, 0x0d, 0xb4, 0x15, 0x0d, 0x84, 0x81, 0x2a, 0x08,
+    0x0d, 0x15, 0xb8, 0x25, 0xff, 0xf5, 0xf2, 0x30, 0x1b, 0x1a, 0x1b, 0x83, 0x1a, 0x04, 0x30, 0x1a,
+    0x1b, 0x1a, 0x47, 0x81, 0x1b, 0x03, 0x94, 0x47, 0x1b, 0x30, 0x81, 0x1b, 0x82, 0x1a, 0x0b, 0xac,
+    0xff, 0x49, 0x20, 0x38, 0x06, 0x0b, 0xa4, 0xff, 0xd5, 0x4b, 0x0f, 0x0b, 0x06, 0x0f, 0x06, 0x81,
+    0x19, 0x07, 0x06, 0x44, 0xff, 0x83, 0x04, 0xff, 0x39, 0x40, 0x88, 0x28, 0xff, 0x11, 0x26, 0x1c,
+    0x81, 0x29, 0x0a, 0x1c, 0x29, 0x2b, 0x41, 0x27, 0x0d, 0x0a, 0x0d, 0x44, 0x0b, 0x25, 0x84, 0x06,
+    0x04, 0x0f, 0x06, 0x26, 0x0f, 0x06, 0x81, 0x0b, 0x05, 0x5f, 0x00, 0x01, 0x00, 0x17, 0x01, 0x86,
+    0x00, 0x81, 0x01, 0x02, 0x00, 0x01, 0x00, 0x82, 0x01, 0x87, 0x00, 0x02, 0x01, 0x00, 0x01, 0x85,
+    0x00, 0x09, 0x01, 0x00, 0x45, 0x27, 0x74, 0x21, 0x41, 0x76, 0xff, 0x18, 0x81, 0x2a, 0x81, 0x0a,
+    0x01, 0xff, 0x72, 0x83, 0xc0, 0x81, 0x0a, 0x08, 0x25, 0x15, 0x0a, 0x6b, 0x15, 0x54, 0xff, 0x93,
+    0x27, 0x50, 0x30, 0x84, 0x1b, 0x05, 0xff, 0xed, 0xb1, 0xff, 0x82, 0xa5, 0x6f, 0xf3, 0x37, 0xff,
+    0xff, 0xfb, 0x81, 0x08, 0x03, 0xab, 0x0f, 0xff, 0xee, 0x0d, 0xff, 0xd5, 0x29, 0x81, 0x0b, 0x07,
+    0x1f, 0x19, 0x0d, 0x2d, 0x57, 0x6b, 0x47, 0x1b, 0x81, 0x1a, 0x81, 0x1b, 0x81, 0x30, 0x06, 0x1a,
+    0x47, 0xff, 0xf6, 0x33, 0xf2, 0xaf, 0x51, 0x31, 0x81, 0x4d, 0x05, 0xd8, 0xf4, 0xff, 0xed, 0xf2,
+    0xff, 0xfe, 0x54, 0xff, 0xf6, 0x54, 0xb9, 0x82, 0x08, 0x08, 0xff, 0x28, 0x20, 0x06, 0x1f, 0x0f,
+    0x06, 0x8c, 0x0b, 0x06, 0x0b, 0x82, 0x06, 0x06, 0x38, 0x06, 0x0a, 0xda, 0x1d, 0xff, 0x18, 0x61,
+    0x89, 0x86, 0x1c, 0x0a, 0x21, 0xff, 0x9b, 0xc8, 0x84, 0x16, 0x44, 0x93, 0x06, 0xa7, 0x06, 0x38,
+    0x06, 0x81, 0x0b, 0x0b, 0x3f, 0x0f, 0x80, 0x06, 0x0f, 0x0b, 0x06, 0x5f, 0x00, 0x01, 0x00, 0x01,
+    0x81, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00, 0x81, 0x01,
+    0x85, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x12, 0x00, 0xba, 0x67,
+    0xff, 0xff, 0xbe, 0xdb, 0x0d, 0x16, 0x0d, 0x93, 0x0a, 0x72, 0x44, 0x0d, 0x15, 0x2a, 0xff, 0x9b,
+    0xa7, 0x2a, 0xbc, 0xed, 0x83, 0x1b, 0x00, 0xff, 0xe5, 0x91, 0x81, 0x08, 0x00, 0x09, 0x81, 0x08,
+    0x09, 0xff, 0x82, 0x84, 0x9d, 0xff, 0x49, 0x00, 0xff, 0xff, 0x7a, 0x08, 0xff, 0x49, 0x00, 0x06,
+    0x3f, 0xd2, 0x26, 0x81, 0x06, 0x01, 0x0b, 0x80, 0x81, 0x0d, 0x02, 0xff, 0x9b, 0x87, 0x1b, 0x50,
+    0x84, 0x1a, 0x10, 0x1b, 0xff, 0x28, 0x20, 0xff, 0x38, 0xa0, 0xe5, 0xff, 0x6a, 0x40, 0xff, 0x7a,
+    0x81, 0xff, 0x72, 0x63, 0x37, 0x3a, 0x31, 0x4f, 0x7a, 0x6d, 0x4f, 0x6d, 0xff, 0x93, 0x67, 0xff,
+    0xfe, 0x95, 0x81, 0x08, 0x01, 0xff, 0xff, 0x7a, 0xff, 0x51, 0x40, 0x82, 0x06, 0x05, 0x6f, 0x26,
+    0x06, 0x19, 0x06, 0x26, 0x81, 0x06, 0x09, 0x8f, 0x16, 0xff, 0x51, 0xa1, 0x1d, 0x2d, 0x35, 0x29,
+    0xb5, 0x29, 0x23, 0x81, 0x1c, 0x12, 0x29, 0x89, 0x72, 0x15, 0x0d, 0x0a, 0x9b, 0x0b, 0xb2, 0x06,
+    0x0b, 0x0f, 0x0b, 0x0f, 0x06, 0x3f, 0xf3, 0x0b, 0x19, 0x81, 0x06, 0x00, 0x3a, 0x82, 0x00, 0x00,
+    0x01, 0x8e, 0x00, 0x00, 0x01, 0x82, 0x01, 0x01, 0x00, 0x17, 0x82, 0x00, 0x81, 0x01, 0x82, 0x00,
+    0x03, 0x01, 0x00, 0x01, 0x00, 0x82, 0x01, 0x81, 0x00, 0x81, 0x01, 0x07, 0x17, 0xc9, 0x0d, 0x1d,
+    0xff, 0x83, 0x25, 0xa7, 0xc0, 0x1d, 0x81, 0x0a, 0x81, 0x0d, 0x04, 0x83, 0x16, 0x37, 0x1b, 0xff,
+    0xe5, 0x71, 0x81, 0x1b, 0x04, 0xcd, 0x03, 0x09, 0x08, 0x03, 0x82, 0x08, 0x19, 0xce, 0xd8, 0x90,
+    0x13, 0xf5, 0xec, 0x06, 0xff, 0x59, 0xe0, 0x19, 0x0f, 0x06, 0x1f, 0x8f, 0x0f, 0x1d, 0x6f, 0xd9,
+    0x47, 0x1a, 0x1b, 0x30, 0xff, 0xdd, 0x30, 0xaf, 0xff, 0x51, 0x40, 0xff, 0x72, 0x21, 0xff, 0x72,
+    0x41, 0x81, 0x6f, 0x02, 0xff, 0x51, 0x01, 0x7c, 0x13, 0x81, 0x03, 0x03, 0x08, 0x13, 0x08, 0x13,
+    0x81, 0x08, 0x04, 0xf6, 0xff, 0xd5, 0x91, 0xf1, 0x09, 0xdc, 0x81, 0x06, 0x02, 0x0b, 0xff, 0x72,
+    0x61, 0x0f, 0x85, 0x06, 0x08, 0xb6, 0x0a, 0x4d, 0xb8, 0xc8, 0x0a, 0x21, 0x1c, 0xe4, 0x82, 0xff,
+    0x11, 0x25, 0x17, 0x29, 0x40, 0x6b, 0x0a, 0x16, 0x0d, 0x90, 0x06, 0x0f, 0x0a, 0x06, 0x0b, 0x06,
+    0x0b, 0x19, 0x06, 0x91, 0x06, 0xff, 0xd5, 0x8a, 0x0b, 0x19, 0xb7, 0x00, 0x01, 0x81, 0x00, 0x00,
+    0x01, 0x82, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x01, 0x00, 0x01,
+    0x01, 0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0x82, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81,
+    0x00, 0x04, 0x01, 0x00, 0x01, 0x00, 0x7b, 0x81, 0x0d, 0x03, 0x1d, 0x31, 0x0d, 0x1d, 0x81, 0x0d,
+    0x05, 0x2a, 0x44, 0x16, 0x37, 0x0a, 0x4d, 0x81, 0x50, 0x00, 0xff, 0xed, 0x91, 0x81, 0x08, 0x01,
+    0x09, 0x13, 0x81, 0x08, 0x01, 0x03, 0x13, 0x81, 0x08, 0x18, 0x03, 0xff, 0xa3, 0xc9, 0xff, 0xff,
+    0x99, 0x03, 0xff, 0x59, 0x80, 0x0b, 0xf0, 0x0f, 0x06, 0x26, 0x06, 0xa9, 0x3f, 0x0d, 0xdc, 0x08,
+    0x13, 0xb9, 0xcd, 0xff, 0xf6, 0x75, 0x4f, 0xff, 0x7a, 0xa2, 0x8c, 0x4f, 0xff, 0x59, 0x82, 0x81,
+    0x03, 0x81, 0x09, 0x00, 0x03, 0x81, 0x08, 0x00, 0x09, 0x82, 0x03, 0x00, 0x09, 0x81, 0x03, 0x04,
+    0x08, 0x09, 0xff, 0xff, 0x9a, 0xff, 0xa3, 0xa8, 0x8f, 0x81, 0x0b, 0x02, 0xff, 0xa4, 0x07, 0x06,
+    0x0b, 0x81, 0x06, 0x0a, 0x0f, 0x06, 0x0b, 0xff, 0xc4, 0xe9, 0x15, 0x53, 0x2d, 0x16, 0x0a, 0x6e,
+    0x76, 0x81, 0x29, 0x0d, 0x1c, 0x4b, 0x29, 0x40, 0xff, 0xb4, 0x4a, 0x0a, 0x16, 0x15, 0x90, 0x0b,
+    0x06, 0xff, 0x9b, 0x84, 0x0b, 0x06, 0x81, 0x0b, 0x00, 0x0f, 0x81, 0x0b, 0x00, 0x57, 0x81, 0x0b,
+    0x01, 0x19, 0x9d, 0x83, 0x00, 0x83, 0x01, 0x00, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x82,
+    0x00, 0x00, 0x01, 0x81, 0x00, 0x83, 0x00, 0x81, 0x01, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x0c,
+    0x01, 0x00, 0x01, 0xdb, 0x44, 0x0a, 0x0d, 0xff, 0x41, 0x41, 0xff, 0xa4, 0x07, 0xb8, 0x25, 0x0d,
+    0x0a, 0x81, 0x0d, 0x07, 0x4f, 0x2a, 0xff, 0x72, 0x23, 0x50, 0xff, 0xe5, 0x71, 0x03, 0x08, 0x13,
+    0x81, 0x08, 0x02, 0x09, 0x03, 0x09, 0x81, 0x08, 0x81, 0x03, 0x81, 0x08, 0x0b, 0x09, 0xff, 0xee,
+    0x54, 0xff, 0xe5, 0xcb, 0x91, 0x1f, 0x06, 0x26, 0x3f, 0xff, 0xcc, 0xc8, 0x38, 0x84, 0xab, 0x83,
+    0x03, 0x04, 0xff, 0xdd, 0x90, 0xff, 0x72, 0x81, 0xdc, 0xff, 0xdd, 0xd1, 0x03, 0x81, 0x08, 0x06,
+    0x09, 0x13, 0x08, 0x09, 0x03, 0x08, 0x09, 0x83, 0x03, 0x0b, 0x09, 0x13, 0x08, 0x03, 0x09, 0x08,
+    0xff, 0x6a, 0x00, 0x38, 0x1f, 0xff, 0xcd, 0x2a, 0x0f, 0x38, 0x84, 0x06, 0x02, 0x19, 0x1d, 0x53,
+    0x81, 0x2d, 0x04, 0x0a, 0x15, 0xff, 0x08, 0x81, 0x1c, 0x29, 0x81, 0x1c, 0x02, 0x29, 0x66, 0xff,
+    0x82, 0xe4, 0x81, 0x0d, 0x01, 0x2a, 0xff, 0x7a, 0xc4, 0x82, 0x06, 0x01, 0x1f, 0x06, 0x82, 0x0b,
+    0x02, 0x26, 0x0f, 0x0a, 0x82, 0x06, 0x05, 0xff, 0xd5, 0x6c, 0x67, 0x00, 0x01, 0x00, 0x01, 0x83,
+    0x00, 0x02, 0x01, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x82, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01,
+    0x81, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x01, 0x83, 0x00, 0x81, 0x01, 0x83, 0x00, 0x08, 0x4a,
+    0x44, 0xff, 0xbc, 0x48, 0x5b, 0x36, 0x0d, 0xda, 0x0d, 0x15, 0x82, 0x0d, 0x09, 0xbc, 0x54, 0xff,
+    0xf6, 0x33, 0x1a, 0x03, 0x08, 0x03, 0x13, 0x09, 0x08, 0x82, 0x09, 0x81, 0x08, 0x09, 0x13, 0x03,
+    0x08, 0x13, 0x09, 0x03, 0xdc, 0x91, 0xff, 0x59, 0xc1, 0x0b, 0x81, 0x06, 0x14, 0x19, 0x06, 0x0d,
+    0xff, 0x49, 0x00, 0x03, 0x08, 0x03, 0x08, 0xff, 0x61, 0xc1, 0xcf, 0x08, 0x03, 0x08, 0x13, 0x09,
+    0x08, 0x09, 0x08, 0x03, 0x08, 0x13, 0x81, 0x03, 0x81, 0x08, 0x0c, 0x09, 0x08, 0x03, 0x08, 0x13,
+    0x08, 0x03, 0xff, 0xff, 0x79, 0xff, 0xfe, 0x8f, 0x06, 0xff, 0xe5, 0xec, 0x0f, 0x06, 0x81, 0x0b,
+    0x26, 0x3f, 0x38, 0x06, 0xff, 0xed, 0xec, 0x0a, 0x4f, 0xff, 0x93, 0x85, 0x9c, 0xaa, 0xff, 0x93,
+    0x64, 0x72, 0xff, 0x10, 0x61, 0x29, 0x3b, 0x29, 0x3b, 0x76, 0x8c, 0x0a, 0x15, 0x0a, 0x2d, 0x1f,
+    0x0b, 0x26, 0x81, 0x06, 0x0f, 0x0b, 0x1f, 0x19, 0x06, 0x93, 0xff, 0xc4, 0xc8, 0x06, 0x0b, 0xff,
+    0xf6, 0x6f, 0xff, 0xf7, 0x7a, 0x01, 0x85, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x03, 0x00, 0x01,
+    0x00, 0x01, 0x83, 0x00, 0x83, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x01, 0x00, 0x01, 0x85, 0x00,
+    0x02, 0x01, 0x00, 0x01, 0x82, 0x00, 0x81, 0x01, 0x0f, 0x31, 0x15, 0x54, 0x4d, 0x36, 0x93, 0x9b,
+    0x2a, 0xa9, 0x15, 0x19, 0xd4, 0xff, 0x83, 0x04, 0x5b, 0xff, 0xed, 0x91, 0xff, 0xed, 0xb1, 0x81,
+    0x08, 0x07, 0x09, 0x03, 0x08, 0x09, 0x03, 0x7c, 0xff, 0x62, 0x04, 0xff, 0x7a, 0xa6, 0x81, 0x03,
+    0x81, 0x09, 0x82, 0x03, 0x0e, 0xff, 0x49, 0x20, 0xe6, 0xff, 0xa3, 0xe8, 0x06, 0x38, 0x06, 0x0f,
+    0x06, 0x15, 0xff, 0x40, 0xa0, 0x13, 0x09, 0x08, 0x09, 0xc3, 0x81, 0x03, 0x00, 0x13, 0x83, 0x03,
+    0x00, 0x08, 0x82, 0x03, 0x02, 0x09, 0x03, 0x08, 0x82, 0x03, 0x1a, 0x09, 0x13, 0x08, 0x09, 0x08,
+    0x03, 0x09, 0xde, 0x1f, 0xff, 0xf6, 0x4e, 0x06, 0x26, 0x06, 0x0b, 0x06, 0x0b, 0x06, 0x81, 0xee,
+    0xff, 0x7a, 0xc4, 0xff, 0x61, 0xe1, 0xff, 0x18, 0x80, 0x35, 0x58, 0x21, 0x58, 0x23, 0x81, 0x1c,
+    0x03, 0x29, 0x41, 0xff, 0x7a, 0xe3, 0x0d, 0x81, 0x15, 0x05, 0x54, 0x0f, 0x06, 0x0b, 0xff, 0xc4,
+    0xa8, 0x0b, 0x82, 0x06, 0x03, 0x0b, 0x0f, 0x26, 0x0a, 0x81, 0x0b, 0x01, 0x1f, 0xff, 0x49, 0xe3,
+    0x81, 0x00, 0x00, 0x01, 0x82, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x81, 0x01, 0x01, 0x00, 0x01,
+    0x84, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00, 0x81, 0x01, 0x01, 0x00, 0x01, 0x81,
+    0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x10, 0x17, 0x4d, 0x0d, 0x72, 0x4a,
+    0xff, 0x5a, 0x86, 0xb4, 0x9c, 0xe6, 0x38, 0xff, 0xbc, 0xa8, 0x0b, 0xff, 0xc4, 0xa8, 0xda, 0xff,
+    0xbc, 0x6a, 0xff, 0xf5, 0xf3, 0xff, 0xf6, 0x34, 0x81, 0x08, 0x0b, 0x09, 0x7b, 0xff, 0xee, 0x95,
+    0x4a, 0xc1, 0x03, 0x08, 0x03, 0xf6, 0xb7, 0x03, 0x09, 0x82, 0x03, 0x09, 0x08, 0xf2, 0xff, 0xb4,
+    0x26, 0xff, 0xfe, 0x90, 0x06, 0x26, 0x06, 0x0f, 0x0d, 0xff, 0x50, 0xe0, 0x83, 0x03, 0x81, 0x09,
+    0x03, 0x03, 0x08, 0x03, 0x09, 0x81, 0x03, 0x07, 0x08, 0x09, 0x13, 0x09, 0x03, 0x09, 0x08, 0x09,
+    0x81, 0x03, 0x00, 0x08, 0x81, 0x09, 0x81, 0x03, 0x08, 0x08, 0x03, 0xff, 0x92, 0xe5, 0xff, 0xd5,
+    0x09, 0xff, 0xf6, 0x6f, 0x1f, 0x26, 0x06, 0x38, 0x81, 0x06, 0x81, 0x57, 0x03, 0xab, 0xca, 0x63,
+    0x04, 0x81, 0x02, 0x0c, 0x07, 0x05, 0x76, 0x35, 0x29, 0x4b, 0x62, 0x72, 0x1d, 0x15, 0x2a, 0x0d,
+    0x38, 0x81, 0x06, 0x04, 0xff, 0xbc, 0x87, 0x0f, 0x26, 0x0b, 0x06, 0x81, 0x0b, 0x05, 0x1f, 0x8c,
+    0x06, 0x0b, 0xa4, 0x73, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x82, 0x01, 0x81, 0x00, 0x01, 0x01,
+    0x00, 0x83, 0x01, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00,
+    0x01, 0x82, 0x00, 0x02, 0x01, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x12, 0x3a, 0x15, 0x72, 0x86,
+    0xff, 0xde, 0x96, 0xff, 0x6a, 0x43, 0x6b, 0xff, 0xcd, 0x2a, 0x19, 0xff, 0xcd, 0x29, 0x0b, 0xa9,
+    0xff, 0x6a, 0x22, 0x92, 0xff, 0xed, 0xf2, 0xce, 0x08, 0x03, 0x8d, 0x81, 0xad, 0x07, 0xff, 0x30,
+    0xe1, 0x6e, 0x52, 0x51, 0xff, 0xcd, 0x10, 0x08, 0x09, 0xff, 0x59, 0x82, 0x81, 0x03, 0x06, 0x08,
+    0x03, 0x08, 0xff, 0x9b, 0x68, 0x0b, 0x37, 0x38, 0x82, 0x06, 0x01, 0x0d, 0xff, 0x51, 0x20, 0x82,
+    0x03, 0x00, 0x13, 0x84, 0x03, 0x01, 0x08, 0x03, 0x82, 0x09, 0x82, 0x03, 0x81, 0x09, 0x81, 0x08,
+    0x81, 0x03, 0x09, 0x08, 0x13, 0x08, 0x13, 0x09, 0x08, 0x03, 0xff, 0xbc, 0x69, 0xff, 0xc4, 0xca,
+    0xb2, 0x81, 0x0b, 0x1b, 0x06, 0x0b, 0x0f, 0xa9, 0x0a, 0x3a, 0x59, 0x07, 0x02, 0x04, 0x3e, 0x02,
+    0x05, 0x04, 0x28, 0x88, 0x4b, 0xff, 0x10, 0x41, 0x0d, 0xb4, 0x0a, 0x72, 0x54, 0x0f, 0x06, 0x0b,
+    0x38, 0x26, 0x83, 0x06, 0x08, 0x1f, 0x0f, 0xd4, 0xa7, 0x0b, 0x06, 0x31, 0x00, 0x01, 0x83, 0x00,
+    0x00, 0x01, 0x82, 0x00, 0x81, 0x01, 0x86, 0x00, 0x88, 0x00, 0x82, 0x01, 0x00, 0x00, 0x83, 0x01,
+    0x81, 0x00, 0x81, 0x01, 0x00, 0x00, 0x81, 0x01, 0x07, 0x85, 0x25, 0x2a, 0xff, 0x31, 0x01, 0x67,
+    0xaf, 0x2a, 0xb3, 0x82, 0x0b, 0x03, 0xe6, 0x4f, 0xff, 0xb4, 0x89, 0xff, 0xf5, 0xf2, 0x81, 0x08,
+    0x01, 0xcf, 0x51, 0x81, 0x52, 0x0b, 0x51, 0x6e, 0x52, 0xff, 0x31, 0x01, 0xff, 0x28, 0xc1, 0xaf,
+    0xff, 0xff, 0x5b, 0x09, 0x03, 0x13, 0x03, 0x09, 0x81, 0x03, 0x02, 0x6f, 0xff, 0xbc, 0x69, 0x2d,
+    0x81, 0x0b, 0x03, 0x0f, 0x1f, 0xf2, 0x08, 0x81, 0x03, 0x00, 0x09, 0x81, 0x03, 0x00, 0x09, 0x81,
+    0x08, 0x81, 0x03, 0x03, 0x09, 0x08, 0x09, 0x03, 0x81, 0x09, 0x81, 0x08, 0x00, 0x03, 0x81, 0x08,
+    0x02, 0x03, 0x08, 0x03, 0x81, 0x08, 0x81, 0x03, 0x04, 0x08, 0xff, 0x59, 0xa0, 0xff, 0x93, 0x45,
+    0x0f, 0x06, 0x81, 0x0b, 0x15, 0x1f, 0x06, 0x81, 0x0d, 0xff, 0x39, 0x21, 0x07, 0x05, 0x07, 0x02,
+    0x05, 0x07, 0x43, 0x69, 0x05, 0x41, 0x40, 0xa0, 0x0a, 0xe5, 0x15, 0x25, 0x5b, 0x82, 0x06, 0x05,
+    0x0b, 0x0f, 0x06, 0x0b, 0x06, 0x19, 0x82, 0x06, 0x03, 0x15, 0x06, 0x0f, 0x31, 0x81, 0x00, 0x82,
+    0x01, 0x01, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x85, 0x00, 0x01, 0x01, 0x00, 0x82, 0x00, 0x81,
+    0x01, 0x01, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00, 0x81, 0x01, 0x00, 0xa3, 0x82, 0x00,
+    0x82, 0x01, 0x81, 0x00, 0x07, 0x37, 0x72, 0x44, 0xff, 0x73, 0x28, 0x87, 0x31, 0x44, 0x0d, 0x81,
+    0x06, 0x04, 0x0f, 0x91, 0x4a, 0xb4, 0xff, 0xed, 0xd2, 0x81, 0x03, 0x02, 0x51, 0x6e, 0x27, 0x81,
+    0xff, 0xe6, 0x98, 0x07, 0xff, 0xee, 0xb8, 0x71, 0x52, 0x6e, 0x52, 0xff, 0x41, 0x84, 0x73, 0x08,
+    0x82, 0x03, 0x81, 0x08, 0x03, 0xc3, 0xee, 0xff, 0x9b, 0x88, 0x91, 0x82, 0x06, 0x04, 0xf4, 0x08,
+    0x03, 0x13, 0x03, 0x81, 0x09, 0x81, 0x03, 0x02, 0x13, 0x03, 0x09, 0x86, 0x03, 0x07, 0x08, 0x03,
+    0x09, 0x03, 0x08, 0x03, 0x13, 0x09, 0x81, 0x03, 0x04, 0x09, 0x08, 0xff, 0xff, 0xbb, 0xff, 0x7a,
+    0x84, 0x3f, 0x82, 0x06, 0x17, 0x38, 0x1f, 0x4e, 0x6b, 0xff, 0x3a, 0x29, 0x02, 0x04, 0x02, 0x0c,
+    0x21, 0xdd, 0xff, 0x4b, 0xd3, 0xff, 0x43, 0x71, 0x9a, 0x63, 0x21, 0x2a, 0x15, 0xff, 0x7a, 0xc3,
+    0x16, 0x0a, 0x0d, 0x06, 0x0b, 0x81, 0x06, 0x0e, 0x8f, 0x0f, 0x1f, 0x19, 0x0f, 0x06, 0x0b, 0x26,
+    0xb8, 0xe6, 0x1f, 0x37, 0x87, 0x00, 0x01, 0x81, 0x00, 0x82, 0x01, 0x00, 0x00, 0x83, 0x01, 0x84,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x85, 0x00, 0x03,
+    0x01, 0x17, 0x00, 0x01, 0x82, 0x00, 0x09, 0x01, 0x00, 0x31, 0x0a, 0xb6, 0xff, 0xa4, 0xae, 0x01,
+    0x51, 0x0d, 0x16, 0x82, 0x0b, 0x07, 0x06, 0x3a, 0xc9, 0xff, 0xed, 0xd2, 0x03, 0x36, 0x6e, 0x75,
+    0x81, 0xff, 0xe6, 0x98, 0x04, 0xff, 0xee, 0x98, 0xff, 0xee, 0xb8, 0x36, 0x52, 0x6e, 0x81, 0x52,
+    0x02, 0xdb, 0xa0, 0x08, 0x84, 0x03, 0x07, 0x6f, 0xb9, 0x90, 0x06, 0x0f, 0xff, 0xd5, 0x4b, 0x85,
+    0x13, 0x81, 0x03, 0x81, 0x08, 0x01, 0x03, 0x13, 0x84, 0x03, 0x04, 0x13, 0x8d, 0xff, 0xc4, 0x8d,
+    0xff, 0x72, 0x24, 0xff, 0xd5, 0x0f, 0x82, 0x03, 0x01, 0x13, 0x09, 0x85, 0x03, 0x03, 0x08, 0x13,
+    0x03, 0xff, 0x30, 0x60, 0x81, 0x06, 0x17, 0x0f, 0x0b, 0x06, 0xff, 0xc4, 0xa8, 0xff, 0xab, 0xc6,
+    0x3a, 0x05, 0x12, 0x3e, 0x33, 0x63, 0xb0, 0xff, 0x4c, 0x97, 0xff, 0x3b, 0x51, 0xff, 0x19, 0xa9,
+    0x18, 0x63, 0xff, 0xa4, 0x0a, 0x16, 0x0d, 0x6b, 0x2a, 0x16, 0x1d, 0x82, 0x06, 0x81, 0x1f, 0x81,
+    0x0f, 0x02, 0x19, 0x0f, 0x0b, 0x81, 0x19, 0x04, 0xff, 0x82, 0xe2, 0x0a, 0x06, 0xbb, 0x5d, 0x82,
+    0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x81, 0x00,
+    0x00, 0x01, 0x81, 0x01, 0x84, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00, 0x82, 0x01,
+    0x01, 0x00, 0x01, 0x82, 0x00, 0x09, 0x01, 0x00, 0x73, 0x0a, 0x0f, 0xff, 0xa4, 0x8e, 0x00, 0xff,
+    0xd6, 0x36, 0xff, 0xcd, 0x2c, 0xb8, 0x83, 0x06, 0x0a, 0xf0, 0xee, 0xff, 0xf6, 0x14, 0x03, 0x27,
+    0x51, 0x7b, 0xff, 0xe6, 0x78, 0xff, 0xee, 0xd9, 0x71, 0x67, 0x81, 0x6e, 0x08, 0x52, 0x27, 0x5e,
+    0x9e, 0x51, 0xbb, 0x03, 0x09, 0x08, 0x81, 0x03, 0x0c, 0x08, 0xf4, 0x03, 0x37, 0xff, 0xe5, 0xed,
+    0xa7, 0xf4, 0x09, 0x03, 0x09, 0x03, 0x09, 0x08, 0x81, 0x03, 0x81, 0x08, 0x02, 0xff, 0x69, 0xe3,
+    0xff, 0xee, 0x55, 0x08, 0x81, 0x03, 0x00, 0x13, 0x81, 0x08, 0x00, 0x13, 0x82, 0x03, 0x01, 0x09,
+    0x08, 0x82, 0x03, 0x82, 0x09, 0x02, 0x08, 0xff, 0x28, 0x20, 0x06, 0x81, 0x0b, 0x1b, 0x06, 0x38,
+    0xff, 0xdd, 0x8c, 0xff, 0xbc, 0xca, 0xff, 0x41, 0xa4, 0x05, 0x02, 0x11, 0x9a, 0xff, 0x44, 0x36,
+    0xff, 0x4c, 0xda, 0xff, 0x4b, 0xb2, 0xdd, 0xff, 0x3a, 0xee, 0xff, 0x32, 0xce, 0xff, 0x53, 0xb1,
+    0x75, 0x0d, 0x15, 0x0a, 0x16, 0x44, 0x1d, 0x8f, 0x06, 0x19, 0x0b, 0x1f, 0x83, 0x06, 0x07, 0x0b,
+    0x06, 0x0b, 0x0f, 0x0d, 0x06, 0xaa, 0xff, 0xe6, 0x76, 0x82, 0x01, 0x81, 0x00, 0x02, 0x01, 0x00,
+    0x01, 0x81, 0x00, 0x83, 0x01, 0x82, 0x00, 0x00, 0x01, 0x81, 0x01, 0x8c, 0x00, 0x83, 0x01, 0x84,
+    0x00, 0x03, 0x5e, 0x54, 0x0f, 0xff, 0x52, 0x05, 0x81, 0x01, 0x0e, 0x7d, 0x0d, 0x1f, 0x06, 0x1f,
+    0x0b, 0xc8, 0xff, 0xcc, 0xeb, 0xff, 0xbc, 0x8e, 0x03, 0xca, 0x51, 0xff, 0xf7, 0x1a, 0x5d, 0x96,
+    0x81, 0x5d, 0x81, 0xad, 0x00, 0x51, 0x81, 0x5e, 0x03, 0x9e, 0x52, 0xff, 0x62, 0x45, 0xac, 0x84,
+    0x03, 0x05, 0x09, 0x03, 0x13, 0xbb, 0x0b, 0xff, 0xd5, 0x4c, 0x81, 0x03, 0x02, 0x09, 0x03, 0x09,
+    0x83, 0x03, 0x03, 0xd8, 0xb9, 0x03, 0x09, 0x81, 0x03, 0x00, 0xff, 0xee, 0x55, 0x82, 0x36, 0x06,
+    0xff, 0x51, 0x43, 0xcf, 0xce, 0x08, 0x7c, 0xf7, 0x09, 0x81, 0x08, 0x1f, 0x09, 0x03, 0x08, 0x6f,
+    0x06, 0x0b, 0x06, 0x0f, 0xc7, 0x15, 0x31, 0x05, 0x04, 0x02, 0x59, 0xff, 0x3c, 0x36, 0xd0, 0xff,
+    0x5c, 0xd9, 0xff, 0x4b, 0xb2, 0xdd, 0xd7, 0x7f, 0xff, 0x4b, 0xd3, 0x21, 0x0d, 0x0a, 0x16, 0x44,
+    0x0d, 0x0a, 0xb6, 0x0f, 0x81, 0x0b, 0x01, 0x19, 0x0b, 0x81, 0x06, 0x01, 0x0f, 0x8f, 0x81, 0x1f,
+    0x05, 0x06, 0x8c, 0x2a, 0xff, 0xfe, 0xb0, 0x6e, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x02,
+    0x01, 0x00, 0x01, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x81, 0x00, 0x01, 0x01, 0x00, 0x81, 0x00,
+    0x81, 0x01, 0x82, 0x00, 0x03, 0x01, 0x00, 0xa1, 0x01, 0x85, 0x00, 0x00, 0x01, 0x83, 0x00, 0x05,
+    0x01, 0x00, 0xd1, 0xff, 0x6a, 0x22, 0x84, 0x36, 0x81, 0x00, 0x03, 0x31, 0x84, 0x26, 0x38, 0x81,
+    0x06, 0x08, 0xa7, 0x93, 0x4d, 0x03, 0x4a, 0x52, 0x71, 0x5d, 0x96, 0x81, 0x5d, 0x08, 0xff, 0x28,
+    0xe0, 0x53, 0x52, 0x27, 0x45, 0x9e, 0x51, 0x9e, 0xff, 0xff, 0x3a, 0x81, 0x03, 0x03, 0x08, 0x03,
+    0x08, 0x03, 0x81, 0x09, 0x04, 0x13, 0xff, 0x72, 0x23, 0xff, 0xf6, 0x4f, 0x09, 0x03, 0x81, 0x08,
+    0x01, 0x03, 0x08, 0x81, 0x09, 0x07, 0x08, 0x13, 0x03, 0x13, 0xff, 0xa3, 0xab, 0xff, 0x28, 0xc1,
+    0x52, 0x4a, 0x81, 0x51, 0x00, 0x6e, 0x81, 0x52, 0x06, 0x53, 0x3a, 0x73, 0xb9, 0x08, 0x03, 0x09,
+    0x81, 0x03, 0x01, 0x08, 0xff, 0x51, 0x20, 0x81, 0x06, 0x04, 0x0f, 0x38, 0x06, 0x16, 0xff, 0x52,
+    0x26, 0x81, 0x04, 0x0b, 0x02, 0x2e, 0xff, 0x4c, 0xda, 0xd0, 0xff, 0x32, 0xef, 0xff, 0x4b, 0x70,
+    0x21, 0x32, 0xff, 0x43, 0x71, 0xd7, 0x32, 0xc9, 0x81, 0x0a, 0x03, 0xb8, 0x0d, 0x0a, 0xc4, 0x81,
+    0x06, 0x02, 0x0b, 0x06, 0x19, 0x82, 0x0b, 0x81, 0x06, 0x05, 0x0b, 0x1f, 0xe7, 0x0d, 0x38, 0x4a,
+    0x82, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x88, 0x00, 0x82, 0x00, 0x82, 0x01,
+    0x83, 0x00, 0x00, 0x01, 0x85, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00, 0x02, 0x6d,
+    0xc4, 0x4a, 0x81, 0x00, 0x0b, 0x5e, 0x7d, 0xb6, 0xff, 0xc4, 0xe8, 0x06, 0x3f, 0x06, 0xff, 0xdd,
+    0x8e, 0x3a, 0x08, 0x73, 0x51, 0x83, 0x5d, 0x02, 0x96, 0x5f, 0xc5, 0x81, 0x52, 0x09, 0x36, 0x4d,
+    0x3a, 0x27, 0x71, 0x03, 0x13, 0x09, 0x03, 0x08, 0x81, 0x03, 0x81, 0x08, 0x01, 0x03, 0x08, 0x86,
+    0x03, 0x03, 0xac, 0x08, 0xac, 0x4a, 0x81, 0x51, 0x01, 0xad, 0x6e, 0x82, 0x52, 0x09, 0x6e, 0x52,
+    0xff, 0x30, 0xe1, 0xad, 0x6e, 0x36, 0xff, 0xff, 0x7b, 0x03, 0x13, 0x03, 0x81, 0x09, 0x01, 0x03,
+    0xdc, 0x81, 0x06, 0x03, 0x3f, 0x06, 0x0a, 0x37, 0x82, 0x04, 0x11, 0x63, 0xff, 0x3b, 0xf5, 0xff,
+    0x4c, 0xb9, 0xff, 0x2a, 0xcf, 0x2e, 0x99, 0x04, 0x43, 0x3d, 0xff, 0x22, 0x4c, 0xa8, 0xff, 0x72,
+    0xa5, 0x0d, 0x2a, 0x90, 0x15, 0x0d, 0xc7, 0x81, 0x06, 0x00, 0x26, 0x81, 0x06, 0x0c, 0x0b, 0x3f,
+    0x0f, 0x06, 0x1f, 0x06, 0x3f, 0x1f, 0x8b, 0x0f, 0x4f, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x82,
+    0x00, 0x00, 0x01, 0x86, 0x00, 0x85, 0x00, 0x00, 0x01, 0x89, 0x00, 0x02, 0x01, 0x00, 0x01, 0x83,
+    0x00, 0x03, 0x01, 0xff, 0xe6, 0xb6, 0x93, 0x37, 0x81, 0x00, 0x04, 0x01, 0x3a, 0x0d, 0x26, 0x19,
+    0x81, 0x06, 0x04, 0xff, 0x72, 0x63, 0x51, 0x7b, 0xff, 0xf6, 0x96, 0x36, 0x81, 0x96, 0x05, 0x71,
+    0x5d, 0x7b, 0x31, 0xff, 0x51, 0xa2, 0xad, 0x81, 0x52, 0x03, 0x86, 0xff, 0x62, 0x66, 0xff, 0x18,
+    0x80, 0x71, 0x82, 0x03, 0x00, 0x13, 0x83, 0x03, 0x03, 0x09, 0x03, 0x13, 0x03, 0x82, 0x09, 0x01,
+    0x03, 0x13, 0x81, 0x03, 0x12, 0xff, 0x72, 0x65, 0x7d, 0xff, 0x39, 0x02, 0x51, 0x52, 0xff, 0x51,
+    0x63, 0x7c, 0xac, 0xce, 0xcd, 0x08, 0xcf, 0x95, 0x52, 0x4a, 0xff, 0x41, 0x63, 0x51, 0xff, 0x30,
+    0xe1, 0x85, 0x81, 0x03, 0x1b, 0x08, 0xff, 0xf6, 0xf7, 0x6f, 0x06, 0x26, 0x06, 0x1f, 0xff, 0x72,
+    0x84, 0xff, 0x3a, 0x29, 0x05, 0x04, 0x02, 0xff, 0x00, 0x84, 0xff, 0x54, 0xfa, 0xff, 0x4c, 0x99,
+    0xff, 0x08, 0xc6, 0x46, 0x05, 0x07, 0x02, 0x3c, 0xff, 0x01, 0x07, 0x39, 0xff, 0x59, 0xe2, 0x15,
+    0x0a, 0xda, 0x0d, 0x81, 0x0a, 0x05, 0x0f, 0x19, 0x0b, 0x26, 0x06, 0x0b, 0x81, 0x06, 0x00, 0xff,
+    0xd5, 0x29, 0x82, 0x06, 0x04, 0x1f, 0xff, 0x59, 0x80, 0x2a, 0x3a, 0x00, 0x81, 0x01, 0x83, 0x00,
+    0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0x82, 0x00, 0x82, 0x00, 0x82, 0x01, 0x89, 0x00, 0x02, 0xa1,
+    0x01, 0x00, 0x81, 0x01, 0x01, 0x00, 0x01, 0x82, 0x00, 0x81, 0x37, 0x00, 0xc6, 0x81, 0x01, 0x01,
+    0xa1, 0xaf, 0x81, 0x06, 0x0e, 0x26, 0x0f, 0x3a, 0x92, 0x95, 0x13, 0x8d, 0x9e, 0x96, 0x71, 0x5d,
+    0x96, 0x51, 0x31, 0xc5, 0x81, 0x53, 0x04, 0xc5, 0xff, 0x59, 0xe2, 0x3a, 0x71, 0x13, 0x81, 0x08,
+    0x00, 0x09, 0x83, 0x03, 0x81, 0x09, 0x00, 0x08, 0x83, 0x03, 0x00, 0x13, 0x81, 0x03, 0x03, 0xff,
+    0xb4, 0x4d, 0x6d, 0x95, 0xff, 0xff, 0x7a, 0x81, 0x13, 0x03, 0x03, 0x08, 0x09, 0x03, 0x81, 0x08,
+    0x82, 0x03, 0x03, 0x08, 0xff, 0xee, 0x55, 0xff, 0xee, 0x57, 0xac, 0x81, 0x03, 0x08, 0x08, 0x03,
+    0x8d, 0xff, 0xd5, 0x6c, 0x38, 0x06, 0x26, 0xff, 0xa4, 0x27, 0xff, 0x42, 0x06, 0x81, 0x04, 0x05,
+    0x05, 0x63, 0xff, 0x3b, 0xf6, 0xd0, 0xea, 0x1c, 0x81, 0x05, 0x0e, 0x07, 0x04, 0x41, 0xff, 0x19,
+    0xeb, 0x39, 0xff, 0x7a, 0xc5, 0x0d, 0x2a, 0x54, 0x2a, 0x16, 0xb3, 0x06, 0x19, 0x0b, 0x82, 0x06,
+    0x00, 0x1f, 0x81, 0x0b, 0x07, 0x06, 0x3f, 0x0f, 0x06, 0xfc, 0x0a, 0x6f, 0x00, 0x81, 0x01, 0x01,
+    0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00,
+    0x02, 0x01, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x01, 0x00, 0x01, 0x83, 0x00,
+    0x03, 0x01, 0x7b, 0xff, 0xe5, 0xef, 0x45, 0x82, 0x00, 0x01, 0x36, 0xff, 0xf6, 0x6f, 0x81, 0x06,
+    0x07, 0x26, 0xff, 0x62, 0x22, 0x16, 0x7a, 0x08, 0xcd, 0x01, 0x5d, 0x82, 0x96, 0x09, 0x75, 0x83,
+    0xff, 0x51, 0xc2, 0x5f, 0x31, 0x6d, 0xff, 0x82, 0xe6, 0x4f, 0x5d, 0x09, 0x81, 0x03, 0x02, 0x08,
+    0x03, 0x08, 0x81, 0x03, 0x03, 0x08, 0x09, 0x03, 0x08, 0x83, 0x03, 0x03, 0x08, 0x03, 0xb9, 0x09,
+    0x81, 0x03, 0x00, 0x08, 0x85, 0x03, 0x02, 0x09, 0x03, 0x08, 0x82, 0x03, 0x01, 0x09, 0xac, 0x82,
+    0x03, 0x24, 0x13, 0xff, 0xee, 0x35, 0xff, 0xee, 0x0d, 0x38, 0x06, 0x19, 0x4f, 0x49, 0x04, 0x3e,
+    0x02, 0x2e, 0xff, 0x4c, 0x99, 0xd0, 0xd5, 0x04, 0x05, 0x02, 0x07, 0x3e, 0x32, 0xff, 0x09, 0x69,
+    0x9f, 0x5f, 0x0a, 0x16, 0x0a, 0x2a, 0x0d, 0x25, 0x0f, 0x06, 0x0b, 0x0f, 0x06, 0x0b, 0x0f, 0x82,
+    0x06, 0x0d, 0x0f, 0x0b, 0x06, 0x0b, 0x5b, 0x93, 0x5e, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x85, 0x00, 0x00, 0x01, 0x82, 0x00, 0x83, 0x00, 0x00, 0x01, 0x83, 0x00, 0x04, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x83, 0x00, 0x81, 0x01, 0x00, 0x00, 0x81, 0x01, 0x01, 0x00, 0x01, 0x81, 0x00, 0x02,
+    0xff, 0x39, 0x42, 0xdb, 0x01, 0x81, 0x00, 0x01, 0x01, 0x5f, 0x81, 0x06, 0x06, 0x38, 0xff, 0xf6,
+    0x6e, 0xff, 0xc4, 0xeb, 0x6f, 0xcd, 0x08, 0x09, 0x81, 0x5d, 0x0e, 0x96, 0x5d, 0x9e, 0xff, 0x6a,
+    0x64, 0xff, 0x59, 0xc1, 0x6d, 0x9d, 0x83, 0xff, 0xc5, 0x10, 0x4a, 0xff, 0xff, 0x19, 0x09, 0x08,
+    0x03, 0x08, 0x81, 0x03, 0x07, 0x08, 0x13, 0x09, 0x03, 0x09, 0x08, 0x03, 0x13, 0x81, 0x03, 0x81,
+    0x08, 0x02, 0x13, 0x09, 0x13, 0x82, 0x09, 0x01, 0x08, 0x09, 0x85, 0x03, 0x01, 0x08, 0x03, 0x81,
+    0x08, 0x81, 0x03, 0x00, 0x09, 0x81, 0x03, 0x0a, 0xf4, 0x06, 0x0f, 0xff, 0xe5, 0x8b, 0x85, 0x59,
+    0x02, 0x04, 0x07, 0xa2, 0xff, 0x54, 0x77, 0x81, 0xff, 0x4c, 0xb9, 0x00, 0x63, 0x81, 0x04, 0x0a,
+    0x02, 0x12, 0x02, 0x77, 0xff, 0x2a, 0x8e, 0x2e, 0x37, 0x57, 0x0d, 0x0a, 0x54, 0x81, 0x0a, 0x81,
+    0x06, 0x00, 0x0f, 0x81, 0x06, 0x0c, 0x0f, 0x06, 0x0f, 0x0b, 0x06, 0x26, 0x0f, 0x19, 0x06, 0xff,
+    0x59, 0xa0, 0x8b, 0xff, 0x39, 0x42, 0x00, 0x81, 0x01, 0x81, 0x00, 0x04, 0x01, 0x00, 0x01, 0x00,
+    0x01, 0x86, 0x00, 0x81, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x81, 0x01, 0x01, 0x00,
+    0x01, 0x85, 0x00, 0x81, 0x01, 0x84, 0x00, 0x81, 0x01, 0x03, 0xf8, 0x7c, 0x17, 0x01, 0x81, 0x00,
+    0x15, 0x17, 0x31, 0x26, 0x38, 0x06, 0x31, 0xff, 0xa3, 0xe8, 0xcf, 0x03, 0x08, 0xff, 0xff, 0x5b,
+    0x96, 0x5d, 0xff, 0xff, 0x7c, 0x5d, 0xb7, 0xff, 0x6a, 0x22, 0xff, 0x9b, 0xa8, 0xff, 0xcd, 0x2f,
+    0xff, 0xe6, 0x54, 0xff, 0xe6, 0x34, 0xff, 0x30, 0xc1, 0x81, 0x08, 0x82, 0x03, 0x81, 0x08, 0x00,
+    0x09, 0x81, 0x03, 0x05, 0x08, 0x03, 0x09, 0x08, 0x03, 0x09, 0x81, 0x03, 0x00, 0x09, 0x81, 0x03,
+    0x00, 0x08, 0x82, 0x03, 0x06, 0x09, 0x03, 0x13, 0x03, 0x08, 0x09, 0x13, 0x82, 0x03, 0x00, 0x09,
+    0x81, 0x03, 0x00, 0x08, 0x81, 0x09, 0x1d, 0x03, 0xff, 0x59, 0x80, 0x06, 0x26, 0x4d, 0x6e, 0x33,
+    0x02, 0x05, 0x02, 0x64, 0xff, 0x44, 0x77, 0xd0, 0xff, 0x4b, 0xd3, 0x02, 0x04, 0x2f, 0x02, 0x05,
+    0x02, 0xff, 0x4b, 0xb2, 0xfe, 0x2e, 0xbb, 0x25, 0x15, 0x0d, 0xaa, 0x0a, 0xb3, 0x81, 0x06, 0x00,
+    0x0b, 0x82, 0x06, 0x01, 0x0f, 0x0b, 0x81, 0x06, 0x0b, 0x19, 0x38, 0x19, 0x0b, 0x26, 0x72, 0x53,
+    0x00, 0x01, 0x00, 0xc1, 0x01, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x83, 0x00, 0x81,
+    0x00, 0x81, 0x01, 0x82, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81,
+    0x00, 0x01, 0x01, 0x00, 0x82, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x0c, 0x01, 0x97, 0x4a,
+    0x38, 0x06, 0xff, 0xdd, 0xad, 0xff, 0xb4, 0x4a, 0xff, 0x7a, 0x65, 0x08, 0x09, 0x08, 0xf5, 0xff,
+    0xff, 0x7c, 0x81, 0x5d, 0x06, 0x45, 0xff, 0x72, 0x63, 0xcb, 0xff, 0xc5, 0x0e, 0xff, 0xdd, 0xb2,
+    0xff, 0x7a, 0xa4, 0xf5, 0x81, 0x03, 0x81, 0x09, 0x00, 0x08, 0x81, 0x03, 0x00, 0x08, 0x81, 0x03,
+    0x00, 0x08, 0x82, 0x03, 0x00, 0x08, 0x81, 0x03, 0x00, 0x08, 0x81, 0x03, 0x00, 0x13, 0x81, 0x03,
+    0x00, 0x08, 0x81, 0x03, 0x00, 0x09, 0x81, 0x03, 0x81, 0x09, 0x03, 0x03, 0x09, 0x08, 0x03, 0x83,
+    0x08, 0x07, 0x09, 0x03, 0xce, 0xff, 0x7a, 0xa2, 0x91, 0x2d, 0xad, 0xff, 0x3a, 0x2a, 0x81, 0x04,
+    0x0f, 0x05, 0x04, 0x58, 0xff, 0x4c, 0x99, 0xd0, 0xff, 0x11, 0x26, 0x07, 0x04, 0x05, 0x48, 0x04,
+    0xff, 0x19, 0x06, 0xff, 0x4c, 0x14, 0x82, 0x98, 0x95, 0x82, 0x0d, 0x02, 0xe5, 0x0d, 0xc0, 0x81,
+    0x19, 0x00, 0x0f, 0x81, 0x06, 0x01, 0x1f, 0x0b, 0x81, 0x0f, 0x03, 0x0b, 0x19, 0x06, 0x0f, 0x81,
+    0x06, 0x01, 0xff, 0x59, 0xe0, 0x53, 0x81, 0x01, 0x84, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01,
+    0x81, 0x00, 0x81, 0x01, 0x00, 0x00, 0x88, 0x00, 0x02, 0x01, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01,
+    0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x86, 0x00, 0x81, 0x01,
+    0x00, 0x53, 0x81, 0xb2, 0x04, 0x85, 0x95, 0x08, 0x09, 0x03, 0x81, 0x08, 0x00, 0xff, 0xff, 0x19,
+    0x81, 0xff, 0xff, 0x7c, 0x04, 0x5e, 0xf1, 0x73, 0xff, 0xbc, 0xae, 0xf6, 0x84, 0x03, 0x02, 0x09,
+    0x08, 0x13, 0x81, 0x03, 0x81, 0x08, 0x00, 0x09, 0x84, 0x03, 0x04, 0x08, 0x03, 0x08, 0x09, 0x08,
+    0x81, 0x03, 0x81, 0x08, 0x04, 0x03, 0x08, 0x03, 0x09, 0x13, 0x81, 0x03, 0x01, 0x08, 0x03, 0x81,
+    0x08, 0x84, 0x03, 0x0e, 0xa4, 0xff, 0x49, 0x20, 0xff, 0xee, 0x54, 0x74, 0x07, 0x05, 0x07, 0x0c,
+    0x05, 0xa8, 0xff, 0x4c, 0xb9, 0xd0, 0x41, 0x04, 0x05, 0x81, 0x04, 0x0c, 0x49, 0x77, 0xff, 0x33,
+    0x10, 0xff, 0x64, 0x76, 0xff, 0xad, 0x12, 0xc6, 0x25, 0x44, 0x16, 0x90, 0x15, 0x0d, 0x0f, 0x82,
+    0x06, 0x03, 0x0b, 0x19, 0x0f, 0x06, 0x81, 0x0b, 0x08, 0x06, 0x19, 0x06, 0x38, 0x06, 0xff, 0xee,
+    0x0d, 0xab, 0x45, 0x01, 0x83, 0x00, 0x81, 0x01, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x83, 0x00,
+    0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x82, 0x01, 0x82, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01,
+    0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x83, 0x00,
+    0x08, 0x36, 0x4a, 0xff, 0xe5, 0xcd, 0xff, 0xc4, 0xc8, 0x6f, 0x03, 0x09, 0x03, 0x13, 0x83, 0x03,
+    0x04, 0x13, 0x08, 0x13, 0x08, 0x09, 0x81, 0x03, 0x02, 0x09, 0x03, 0x08, 0x84, 0x03, 0x00, 0x09,
+    0x83, 0x08, 0x00, 0x09, 0x81, 0x03, 0x81, 0x13, 0x00, 0x08, 0x88, 0x03, 0x01, 0x08, 0x13, 0x81,
+    0x08, 0x81, 0x03, 0x02, 0x09, 0x03, 0x09, 0x82, 0x03, 0x04, 0xff, 0x38, 0xa0, 0xdc, 0xff, 0xe5,
+    0xf3, 0xff, 0xff, 0x19, 0x62, 0x82, 0x02, 0x17, 0x59, 0x69, 0xff, 0x64, 0x96, 0xff, 0x4c, 0xb9,
+    0x14, 0x3c, 0x59, 0x05, 0x59, 0x49, 0x8e, 0xd7, 0xff, 0x54, 0x77, 0x3c, 0x01, 0x71, 0xb4, 0x16,
+    0x15, 0xec, 0x57, 0x15, 0x06, 0x26, 0x81, 0x06, 0x02, 0x0f, 0x06, 0x3f, 0x82, 0x06, 0x0f, 0x26,
+    0x06, 0x0b, 0x26, 0x06, 0x26, 0xff, 0xd5, 0x4c, 0x86, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x01, 0x82, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x85, 0x00, 0x04,
+    0x01, 0x00, 0x01, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x84,
+    0x00, 0x0f, 0x01, 0x00, 0x36, 0x15, 0xff, 0xb4, 0x8a, 0x9d, 0x37, 0xce, 0x09, 0x03, 0x08, 0x03,
+    0x08, 0x09, 0x03, 0x08, 0x81, 0x03, 0x0f, 0x13, 0x08, 0x13, 0x09, 0x03, 0x08, 0x03, 0x09, 0x03,
+    0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x08, 0x81, 0x03, 0x00, 0x09, 0x81, 0x03, 0x81, 0x08, 0x04,
+    0x03, 0x13, 0x08, 0x03, 0x09, 0x82, 0x03, 0x00, 0x08, 0x82, 0x03, 0x03, 0x09, 0x03, 0x13, 0x09,
+    0x81, 0x03, 0x08, 0x08, 0x09, 0xce, 0xff, 0x9b, 0xa7, 0x7c, 0xce, 0xff, 0x72, 0x23, 0x3c, 0x02,
+    0x81, 0x04, 0x0d, 0xa8, 0xae, 0xff, 0x4c, 0x77, 0xd0, 0xe0, 0x29, 0x33, 0x1e, 0x3d, 0x59, 0x35,
+    0xff, 0x6d, 0x39, 0xff, 0x4c, 0x98, 0x27, 0x81, 0x00, 0x0d, 0x9b, 0x2a, 0x0d, 0xc0, 0x16, 0x15,
+    0x26, 0x1f, 0x0b, 0x26, 0x0f, 0x81, 0x19, 0x0b, 0x81, 0x06, 0x81, 0x0f, 0x00, 0xff, 0xbc, 0xa8,
+    0x81, 0x1f, 0x02, 0x06, 0x90, 0x31, 0x84, 0x00, 0x00, 0x01, 0x82, 0x00, 0x03, 0x01, 0x00, 0x01,
+    0x00, 0x82, 0x01, 0x01, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x97, 0x00, 0x00, 0x01, 0x82, 0x00,
+    0x05, 0xb7, 0x0d, 0x0a, 0x4e, 0xff, 0x59, 0xc1, 0x8d, 0x82, 0x03, 0x02, 0x09, 0x08, 0x09, 0x88,
+    0x03, 0x02, 0x08, 0x03, 0xf6, 0x83, 0x03, 0x02, 0x09, 0x03, 0x08, 0x81, 0x03, 0x0b, 0x13, 0x08,
+    0x03, 0x09, 0x03, 0x09, 0x13, 0x08, 0x03, 0x09, 0x08, 0x13, 0x82, 0x08, 0x81, 0x03, 0x01, 0x08,
+    0x09, 0x81, 0x08, 0x81, 0x09, 0x81, 0x03, 0x10, 0x09, 0xf7, 0x08, 0x09, 0x08, 0x73, 0x29, 0x05,
+    0x49, 0x1e, 0x3d, 0x66, 0xff, 0x44, 0x57, 0xff, 0x4c, 0xfa, 0xff, 0x19, 0xc9, 0xa6, 0x1e, 0x81,
+    0x49, 0x11, 0x29, 0xff, 0x11, 0x06, 0xff, 0x5c, 0xf9, 0xff, 0x6d, 0x18, 0x67, 0x17, 0x01, 0x6d,
+    0x2a, 0x80, 0x54, 0x44, 0x1d, 0x06, 0x0f, 0x0b, 0x06, 0x0f, 0x81, 0x06, 0x05, 0x19, 0x0b, 0xff,
+    0xe5, 0x8b, 0x1f, 0x06, 0x8f, 0x81, 0x0b, 0x03, 0x06, 0x0f, 0xff, 0x7a, 0xa4, 0x5e, 0x84, 0x00,
+    0x81, 0x01, 0x87, 0x00, 0x82, 0x00, 0x00, 0x01, 0x8b, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01,
+    0x02, 0x00, 0x01, 0x00, 0x81, 0x01, 0x00, 0x00, 0x81, 0x01, 0x01, 0x00, 0x01, 0x81, 0x00, 0x07,
+    0x01, 0x3a, 0x0d, 0x54, 0x25, 0xff, 0xb4, 0x29, 0xff, 0xbc, 0xad, 0x09, 0x81, 0x13, 0x03, 0x03,
+    0x13, 0x03, 0x09, 0x83, 0x08, 0x05, 0x13, 0x09, 0x03, 0x08, 0x13, 0xff, 0xfe, 0xb6, 0x81, 0x08,
+    0x81, 0x03, 0x00, 0x09, 0x81, 0x03, 0x06, 0x09, 0x08, 0x03, 0x08, 0x03, 0x13, 0x09, 0x82, 0x03,
+    0x02, 0x09, 0x13, 0x08, 0x82, 0x03, 0x00, 0x13, 0x83, 0x03, 0x81, 0x09, 0x03, 0x03, 0x09, 0x03,
+    0x09, 0x81, 0x03, 0x00, 0x08, 0x82, 0x03, 0x03, 0x3a, 0xa6, 0x49, 0x3d, 0x81, 0x22, 0x14, 0x64,
+    0xff, 0x4c, 0x97, 0xff, 0x4c, 0xfa, 0xff, 0x19, 0xa9, 0x28, 0x3d, 0x1e, 0x28, 0x35, 0xff, 0x54,
+    0x34, 0xff, 0x44, 0x98, 0x88, 0x01, 0x00, 0x01, 0x4d, 0x72, 0x15, 0x0d, 0x54, 0x2a, 0x83, 0x06,
+    0x04, 0x0f, 0x0b, 0x19, 0x0b, 0x19, 0x82, 0x06, 0x08, 0x0b, 0xff, 0xcd, 0x29, 0x0f, 0x3f, 0x0f,
+    0x9d, 0x36, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01,
+    0x82, 0x00, 0x01, 0x00, 0x01, 0x85, 0x00, 0x02, 0x01, 0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0x82,
+    0x00, 0x02, 0x01, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02,
+    0x01, 0x00, 0x6d, 0x81, 0x0a, 0x02, 0x1d, 0x0d, 0x95, 0x81, 0x08, 0x02, 0x09, 0x03, 0x08, 0x81,
+    0x09, 0x02, 0x08, 0x09, 0x13, 0x81, 0x08, 0x05, 0x09, 0x08, 0x13, 0x09, 0xd8, 0x03, 0x82, 0x08,
+    0x01, 0x03, 0x08, 0x81, 0x09, 0x81, 0x03, 0x00, 0x09, 0x81, 0x03, 0x04, 0x09, 0x03, 0x09, 0x03,
+    0x08, 0x81, 0x03, 0x00, 0x08, 0x81, 0x03, 0x02, 0x13, 0x03, 0x09, 0x81, 0x08, 0x82, 0x09, 0x00,
+    0x08, 0x81, 0x03, 0x01, 0x09, 0x03, 0x81, 0x09, 0x0c, 0x03, 0x09, 0xff, 0xa4, 0x2d, 0x8e, 0x23,
+    0x8e, 0x3d, 0x28, 0x63, 0xff, 0x44, 0x36, 0xff, 0x4c, 0xfb, 0xff, 0x53, 0xd2, 0x1c, 0x81, 0x22,
+    0x08, 0x3c, 0xff, 0x4b, 0xd3, 0xea, 0xff, 0x00, 0xc6, 0x45, 0x00, 0x01, 0x00, 0x37, 0x81, 0x0d,
+    0x02, 0x15, 0xff, 0xbc, 0x69, 0x0d, 0x83, 0x06, 0x12, 0xb6, 0x0b, 0x06, 0x0f, 0x06, 0x1f, 0x06,
+    0x0f, 0x06, 0x0a, 0x06, 0x38, 0x06, 0x1f, 0x31, 0x00, 0x01, 0x00, 0x01, 0x87, 0x00, 0x00, 0x01,
+    0x81, 0x00, 0x01, 0x00, 0x01, 0x81, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x83, 0x00, 0x00, 0x01,
+    0x81, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x83, 0x00, 0x81, 0x01, 0x84, 0x00, 0x00, 0x01,
+    0x81, 0x00, 0x81, 0x01, 0x05, 0x53, 0x15, 0x2a, 0x0a, 0x1d, 0x7a, 0x81, 0x03, 0x09, 0x09, 0x03,
+    0x09, 0x08, 0x09, 0x03, 0x09, 0x08, 0x09, 0x03, 0x81, 0x09, 0x08, 0x03, 0xed, 0xff, 0xff, 0x79,
+    0x03, 0x09, 0x08, 0x09, 0x08, 0x09, 0x82, 0x03, 0x00, 0x09, 0x81, 0x03, 0x82, 0x08, 0x00, 0x03,
+    0x82, 0x09, 0x00, 0x08, 0x81, 0x03, 0x00, 0x08, 0x81, 0x09, 0x06, 0x08, 0x03, 0x09, 0x03, 0x09,
+    0x08, 0x03, 0x81, 0x09, 0x01, 0x03, 0x08, 0x82, 0x03, 0x0a, 0x09, 0xff, 0xc5, 0x32, 0x3d, 0x8e,
+    0x1c, 0x2b, 0x1c, 0x78, 0x5c, 0xff, 0x55, 0x3c, 0xff, 0x3b, 0x51, 0x81, 0x41, 0x06, 0x63, 0xff,
+    0x43, 0x50, 0xff, 0x4b, 0x70, 0xff, 0x4c, 0x35, 0x27, 0x00, 0x01, 0x81, 0x00, 0x15, 0x31, 0x2a,
+    0x15, 0x0d, 0xc9, 0x0a, 0x06, 0x19, 0x0f, 0x0b, 0xc4, 0x38, 0x1f, 0x38, 0x0b, 0x0f, 0x0b, 0x3f,
+    0x1f, 0xff, 0xbc, 0x68, 0x06, 0x19, 0x81, 0x06, 0x01, 0xab, 0x71, 0x83, 0x00, 0x81, 0x01, 0x87,
+    0x00, 0x02, 0x01, 0x00, 0x01, 0x83, 0x00, 0x81, 0x01, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x82,
+    0x00, 0x00, 0x01, 0x81, 0x00, 0x84, 0x01, 0x81, 0x00, 0x82, 0x01, 0x84, 0x00, 0x06, 0xd1, 0x51,
+    0x16, 0x0a, 0x1d, 0xff, 0x72, 0x41, 0x3a, 0x81, 0x03, 0x00, 0x09, 0x81, 0x03, 0x82, 0x08, 0x00,
+    0x03, 0x81, 0x08, 0x81, 0x09, 0x02, 0x13, 0x03, 0xff, 0xd4, 0xed, 0x82, 0x08, 0x01, 0x03, 0x08,
+    0x81, 0x03, 0x00, 0x13, 0x82, 0x03, 0x03, 0x08, 0x03, 0x09, 0x08, 0x86, 0x03, 0x03, 0x09, 0x03,
+    0x08, 0x03, 0x81, 0x09, 0x82, 0x03, 0x02, 0x09, 0x03, 0x08, 0x81, 0x03, 0x0e, 0x08, 0x13, 0x08,
+    0x13, 0x03, 0xff, 0xff, 0x3a, 0xa6, 0x23, 0x3b, 0x28, 0x1c, 0x59, 0xea, 0xff, 0x54, 0xd9, 0xff,
+    0x4b, 0xd2, 0x81, 0xff, 0x3b, 0x30, 0x06, 0xdd, 0xd7, 0xff, 0x3b, 0x71, 0x21, 0xd1, 0x00, 0x01,
+    0x81, 0x00, 0x00, 0x31, 0x82, 0x0a, 0x03, 0xff, 0xb4, 0x8a, 0x57, 0x06, 0xa4, 0x81, 0x06, 0x01,
+    0xc4, 0x26, 0x82, 0x06, 0x06, 0x26, 0x0b, 0x06, 0x26, 0x06, 0x2a, 0x0b, 0x81, 0x06, 0x02, 0x91,
+    0x36, 0x01, 0x8c, 0x00, 0x01, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x01, 0x00,
+    0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x81, 0x00, 0x81, 0x01, 0x84, 0x00,
+    0x82, 0x01, 0x0d, 0xc6, 0x4f, 0x16, 0x0a, 0x16, 0x9c, 0x6f, 0x08, 0x13, 0x08, 0x09, 0x03, 0x09,
+    0x13, 0x81, 0x03, 0x00, 0x09, 0x84, 0x03, 0x01, 0xff, 0xfe, 0x94, 0xac, 0x81, 0x03, 0x00, 0x08,
+    0x81, 0x03, 0x09, 0x08, 0x09, 0x03, 0x09, 0x13, 0x03, 0x08, 0x03, 0x08, 0x09, 0x86, 0x03, 0x02,
+    0x09, 0x03, 0x08, 0x82, 0x03, 0x00, 0x09, 0x81, 0x03, 0x00, 0x09, 0x81, 0x03, 0x81, 0x08, 0x0d,
+    0x03, 0x09, 0x08, 0xff, 0xff, 0x79, 0xff, 0xff, 0x9a, 0x3b, 0x1c, 0x40, 0x78, 0x29, 0xff, 0x11,
+    0x26, 0x1e, 0xff, 0x43, 0xb3, 0xff, 0x4b, 0xb2, 0x81, 0xdd, 0x04, 0xff, 0x53, 0xd2, 0xff, 0x43,
+    0xb2, 0x41, 0x5e, 0x01, 0x83, 0x00, 0x05, 0x53, 0x0a, 0x16, 0x0d, 0xff, 0x9b, 0xe7, 0xb3, 0x82,
+    0x06, 0x03, 0x1f, 0x0a, 0xbd, 0x0b, 0x81, 0x06, 0x01, 0x0f, 0x06, 0x81, 0x0f, 0x01, 0x06, 0xf3,
+    0x83, 0x06, 0x01, 0xff, 0x41, 0x60, 0xff, 0xf7, 0x7b, 0x83, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00,
+    0x01, 0x83, 0x00, 0x83, 0x00, 0x00, 0x01, 0x94, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x7b, 0xec,
+    0x16, 0x81, 0x0a, 0x02, 0x1d, 0xff, 0x72, 0x84, 0x8d, 0x82, 0x03, 0x00, 0x09, 0x83, 0x03, 0x81,
+    0x08, 0x81, 0x03, 0x05, 0x09, 0x13, 0xff, 0xfd, 0xd2, 0xf4, 0x03, 0x08, 0x81, 0x03, 0x03, 0x08,
+    0x03, 0x08, 0x03, 0x81, 0x09, 0x01, 0x03, 0x08, 0x82, 0x03, 0x00, 0x09, 0x81, 0x13, 0x01, 0x03,
+    0x09, 0x81, 0x03, 0x00, 0x08, 0x82, 0x03, 0x02, 0x08, 0x03, 0x09, 0x81, 0x08, 0x83, 0x03, 0x81,
+    0x08, 0x81, 0x03, 0x12, 0xbb, 0x08, 0x62, 0x29, 0x3b, 0x4b, 0x1c, 0x1e, 0x21, 0xff, 0x43, 0x92,
+    0xff, 0x53, 0xd2, 0x9f, 0xf9, 0xff, 0x53, 0xf2, 0x64, 0xff, 0xde, 0x99, 0x01, 0x00, 0x01, 0x82,
+    0x00, 0x0e, 0x7d, 0x25, 0x15, 0x2a, 0xff, 0x83, 0x26, 0x84, 0x0f, 0x0b, 0x38, 0x06, 0x4e, 0xe8,
+    0x0b, 0x06, 0x0f, 0x81, 0x0b, 0x04, 0xa4, 0x06, 0x19, 0x54, 0x25, 0x82, 0x06, 0x01, 0xfb, 0x73,
+    0x82, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0x81, 0x00, 0x8f, 0x00, 0x00, 0x01, 0x83, 0x00,
+    0x82, 0x01, 0x84, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x07, 0x9e, 0xee, 0x0d,
+    0x2a, 0x0a, 0x2d, 0xb7, 0x73, 0x82, 0x08, 0x01, 0x03, 0x08, 0x83, 0x03, 0x00, 0x08, 0x82, 0x03,
+    0x07, 0x13, 0x03, 0xcd, 0xff, 0xff, 0xbb, 0x03, 0x13, 0x08, 0x03, 0x81, 0x09, 0x03, 0x13, 0x08,
+    0x03, 0x09, 0x81, 0x08, 0x81, 0x03, 0x00, 0x13, 0x84, 0x03, 0x02, 0x09, 0x03, 0x09, 0x81, 0x03,
+    0x81, 0x08, 0x81, 0x03, 0x00, 0x08, 0x82, 0x03, 0x81, 0x08, 0x07, 0x09, 0x03, 0xf5, 0x3a, 0x37,
+    0xff, 0x18, 0x61, 0x3b, 0x29, 0x81, 0x02, 0x81, 0x05, 0x05, 0x32, 0xff, 0x43, 0x92, 0xff, 0x3b,
+    0x50, 0xe9, 0x21, 0x7b, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x81, 0x00, 0x0b, 0x73, 0x84, 0x0d,
+    0x0a, 0xeb, 0xa7, 0x06, 0x0b, 0x06, 0x0b, 0x0a, 0x8c, 0x81, 0x06, 0x00, 0x0f, 0x81, 0x0b, 0x00,
+    0x1f, 0x81, 0x06, 0x03, 0x57, 0xcc, 0x06, 0x0f, 0x81, 0x06, 0x01, 0x31, 0x00, 0x81, 0x01, 0x83,
+    0x00, 0x81, 0x01, 0x83, 0x00, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x01, 0x00, 0x82, 0x01,
+    0x00, 0x00, 0x81, 0x01, 0x03, 0x00, 0x01, 0x00, 0x01, 0x8a, 0x00, 0x00, 0x01, 0x83, 0x00, 0x08,
+    0x01, 0xff, 0xff, 0xdf, 0xd2, 0x15, 0x0a, 0x0d, 0x9b, 0xdb, 0xff, 0x38, 0xa0, 0x82, 0x03, 0x00,
+    0x08, 0x81, 0x03, 0x00, 0x08, 0x81, 0x03, 0x82, 0x09, 0x02, 0x08, 0x13, 0x08, 0x82, 0x03, 0x01,
+    0x08, 0x09, 0x81, 0x03, 0x01, 0x09, 0x08, 0x81, 0x03, 0x03, 0x09, 0x13, 0x09, 0x03, 0x82, 0x08,
+    0x04, 0x13, 0x03, 0x08, 0x09, 0x13, 0x81, 0x08, 0x00, 0x13, 0x82, 0x03, 0x81, 0x08, 0x83, 0x03,
+    0x81, 0x09, 0x81, 0x03, 0x06, 0x73, 0x7a, 0xdf, 0x36, 0x35, 0x43, 0x0c, 0x81, 0x02, 0x02, 0x05,
+    0x02, 0x76, 0x81, 0x64, 0x02, 0xff, 0x9c, 0x91, 0x01, 0x00, 0x81, 0x01, 0x00, 0x00, 0x81, 0x01,
+    0x0c, 0x00, 0x36, 0x54, 0x2a, 0x0d, 0x4f, 0xff, 0xd5, 0x4b, 0x0b, 0x26, 0x3f, 0x0b, 0x0a, 0xdf,
+    0x81, 0x06, 0x00, 0x0f, 0x81, 0x1f, 0x81, 0x06, 0x09, 0x0b, 0x44, 0xff, 0x82, 0xe4, 0x8b, 0x1f,
+    0x0f, 0x06, 0xfb, 0xff, 0xe6, 0xb7, 0x01, 0x84, 0x00, 0x82, 0x01, 0x82, 0x00, 0x81, 0x00, 0x00,
+    0x01, 0x83, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x86, 0x00, 0x81,
+    0x01, 0x85, 0x00, 0x00, 0x01, 0x81, 0x00, 0x0c, 0x01, 0x17, 0xff, 0xfe, 0x8f, 0xff, 0xab, 0xc6,
+    0x16, 0x2d, 0x0d, 0xff, 0x9c, 0x2b, 0x37, 0x08, 0x09, 0x08, 0x03, 0x82, 0x09, 0x09, 0x03, 0x08,
+    0x09, 0x08, 0x09, 0x08, 0x03, 0x09, 0x03, 0x08, 0x82, 0x13, 0x83, 0x03, 0x81, 0x13, 0x82, 0x03,
+    0x02, 0x09, 0x03, 0x09, 0x81, 0x08, 0x83, 0x03, 0x07, 0x09, 0x03, 0x09, 0x08, 0x03, 0x09, 0x08,
+    0x03, 0x81, 0x09, 0x01, 0x13, 0x03, 0x81, 0x08, 0x81, 0x03, 0x0f, 0x37, 0xff, 0x61, 0xe0, 0xff,
+    0x59, 0xc1, 0x64, 0x04, 0x05, 0x11, 0xd3, 0x05, 0x59, 0x49, 0x28, 0x41, 0x67, 0x01, 0x00, 0x81,
+    0x01, 0x81, 0x00, 0x1e, 0x01, 0x00, 0x01, 0x73, 0x0d, 0x44, 0x15, 0x7a, 0x06, 0x0b, 0x0f, 0x0b,
+    0x0f, 0x0d, 0xff, 0x72, 0x41, 0x19, 0x0f, 0x06, 0x19, 0x0b, 0x06, 0xff, 0xe5, 0x8b, 0x06, 0x1f,
+    0x1d, 0xc0, 0x0f, 0x0b, 0x06, 0x0b, 0x4f, 0x81, 0x00, 0x00, 0x17, 0x81, 0x00, 0x00, 0x01, 0x81,
+    0x00, 0x83, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x8b, 0x00, 0x81, 0x01, 0x84,
+    0x00, 0x00, 0x01, 0x88, 0x00, 0x09, 0xff, 0x8b, 0xec, 0xff, 0xee, 0x2d, 0x0f, 0x0d, 0xcc, 0x5b,
+    0x7c, 0xff, 0x49, 0x82, 0xff, 0xdd, 0xb2, 0x09, 0x82, 0x03, 0x81, 0x08, 0x00, 0x09, 0x81, 0x03,
+    0x00, 0x09, 0x81, 0x03, 0x04, 0x08, 0x13, 0x03, 0x09, 0x13, 0x82, 0x03, 0x0a, 0x08, 0x03, 0x13,
+    0x03, 0x13, 0x03, 0x08, 0x03, 0x13, 0x03, 0x09, 0x82, 0x03, 0x00, 0x09, 0x81, 0x03, 0x81, 0x08,
+    0x81, 0x03, 0x01, 0x09, 0x08, 0x81, 0x03, 0x03, 0x09, 0x08, 0x13, 0x03, 0x81, 0x09, 0x04, 0x03,
+    0xff, 0xee, 0x14, 0xab, 0xff, 0x6a, 0x43, 0x35, 0x81, 0x04, 0x02, 0x2f, 0x28, 0x74, 0x81, 0x21,
+    0x02, 0x27, 0x5e, 0x00, 0x81, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x0d, 0x01, 0x73, 0x15,
+    0x0d, 0x16, 0x90, 0x06, 0x19, 0x0f, 0x19, 0x0b, 0x0a, 0xff, 0x82, 0xe3, 0x1f, 0x81, 0x06, 0x81,
+    0x0b, 0x0b, 0xff, 0xcc, 0xe8, 0x0b, 0x0f, 0x26, 0x16, 0xaa, 0xd4, 0x06, 0x1f, 0x06, 0xff, 0x59,
+    0xa1, 0xff, 0xff, 0x7b, 0x81, 0x01, 0x84, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x00, 0x01, 0x98,
+    0x00, 0x02, 0x01, 0x00, 0x01, 0x81, 0x00, 0x0b, 0x01, 0x00, 0x01, 0xff, 0x41, 0x63, 0x26, 0x19,
+    0x2a, 0x16, 0xef, 0x01, 0x45, 0xaf, 0x81, 0x03, 0x00, 0x08, 0x81, 0x03, 0x00, 0x08, 0x81, 0x03,
+    0x02, 0x08, 0x03, 0x09, 0x82, 0x03, 0x00, 0x08, 0x81, 0x09, 0x04, 0x03, 0x08, 0x09, 0x03, 0x09,
+    0x82, 0x03, 0x02, 0x08, 0x03, 0x13, 0x82, 0x03, 0x01, 0x09, 0x13, 0x81, 0x03, 0x00, 0x09, 0x82,
+    0x03, 0x01, 0x13, 0x03, 0x81, 0x08, 0x02, 0x03, 0x09, 0x08, 0x85, 0x03, 0x08, 0x6f, 0xe5, 0x35,
+    0x05, 0x04, 0x2f, 0x69, 0x62, 0xd1, 0x84, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01,
+    0x82, 0x00, 0x0d, 0x36, 0x16, 0x80, 0x15, 0xff, 0x82, 0xc4, 0x0f, 0x1f, 0x0b, 0x0f, 0x06, 0x0d,
+    0xaa, 0x19, 0x26, 0x81, 0x06, 0x02, 0x0f, 0xff, 0xbc, 0x67, 0x26, 0x81, 0x06, 0x03, 0x0d, 0x4f,
+    0x0d, 0x19, 0x81, 0x06, 0x01, 0xff, 0xcd, 0x29, 0x5f, 0x81, 0x01, 0x00, 0x00, 0x81, 0x01, 0x81,
+    0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02, 0x01,
+    0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x82, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x82, 0x00,
+    0x02, 0x01, 0x00, 0x01, 0x82, 0x00, 0x05, 0x86, 0x0b, 0x3f, 0x06, 0x0d, 0x4a, 0x81, 0x01, 0x02,
+    0x85, 0xf6, 0x09, 0x87, 0x03, 0x02, 0x08, 0x09, 0x08, 0x85, 0x03, 0x01, 0x08, 0x09, 0x85, 0x03,
+    0x00, 0x08, 0x86, 0x03, 0x81, 0x13, 0x81, 0x03, 0x00, 0x08, 0x81, 0x03, 0x00, 0x09, 0x81, 0x08,
+    0x03, 0x09, 0x08, 0x13, 0x03, 0x81, 0x09, 0x08, 0xff, 0xff, 0x79, 0x4d, 0xff, 0x10, 0x61, 0x02,
+    0x3e, 0x05, 0x33, 0x35, 0x17, 0x83, 0x01, 0x81, 0x00, 0x01, 0x01, 0x00, 0x82, 0x01, 0x81, 0x00,
+    0x13, 0x01, 0x00, 0x01, 0x36, 0xff, 0xa4, 0x06, 0x0d, 0x16, 0xff, 0xb4, 0x6a, 0x0b, 0x06, 0x38,
+    0x06, 0x0f, 0x2a, 0x9c, 0x0b, 0x19, 0x06, 0x0b, 0x06, 0x81, 0x0f, 0x05, 0x06, 0x0b, 0x1d, 0x6b,
+    0x1d, 0x06, 0x82, 0x0f, 0x01, 0x3a, 0x5e, 0x88, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x82,
+    0x00, 0x82, 0x01, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x88, 0x00,
+    0x81, 0x01, 0x81, 0x00, 0x01, 0x01, 0x36, 0x81, 0x0b, 0x06, 0x1f, 0xc7, 0x51, 0x00, 0x17, 0xff,
+    0xb5, 0x30, 0x85, 0x81, 0x09, 0x00, 0x03, 0x81, 0x08, 0x81, 0x09, 0x02, 0x03, 0x13, 0x09, 0x82,
+    0x03, 0x01, 0x08, 0x13, 0x82, 0x03, 0x07, 0x09, 0x08, 0x09, 0x03, 0x08, 0x09, 0x03, 0x13, 0x81,
+    0x03, 0x08, 0x09, 0x13, 0x08, 0x03, 0x09, 0x03, 0x09, 0x03, 0x08, 0x81, 0x03, 0x81, 0x09, 0x02,
+    0x08, 0x03, 0x13, 0x82, 0x03, 0x82, 0x09, 0x03, 0x3a, 0x70, 0x43, 0x04, 0x81, 0x02, 0x02, 0x58,
+    0x67, 0x17, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x01,
+    0x00, 0x82, 0x01, 0x0c, 0x36, 0x0d, 0x80, 0x84, 0x9c, 0x0b, 0x06, 0x19, 0x0f, 0xa7, 0x0d, 0x5b,
+    0x0b, 0x81, 0x06, 0x81, 0x0b, 0x01, 0x06, 0x38, 0x81, 0x0b, 0x08, 0x57, 0x2a, 0x37, 0xc7, 0x0b,
+    0x0f, 0x19, 0x91, 0x75, 0x84, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x03, 0x00, 0x01, 0x00,
+    0x01, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x82, 0x00, 0x82, 0x01, 0x82, 0x00, 0x00, 0x01, 0x82,
+    0x00, 0x82, 0x01, 0x82, 0x00, 0x04, 0x01, 0x00, 0x01, 0x00, 0x01, 0x81, 0x00, 0x00, 0x36, 0x82,
+    0x06, 0x01, 0xa9, 0x37, 0x82, 0x01, 0x01, 0x3a, 0x08, 0x82, 0x03, 0x02, 0x09, 0x13, 0x03, 0x81,
+    0x09, 0x04, 0x13, 0x03, 0x13, 0x03, 0x08, 0x82, 0x03, 0x81, 0x09, 0x82, 0x03, 0x00, 0x13, 0x83,
+    0x03, 0x06, 0xb9, 0x13, 0x09, 0xff, 0xff, 0xbb, 0xf7, 0x13, 0x09, 0x83, 0x03, 0x84, 0x09, 0x11,
+    0x08, 0x09, 0x03, 0x09, 0x08, 0x03, 0xf5, 0x74, 0x69, 0x0c, 0x02, 0x11, 0x2e, 0xff, 0x8c, 0x2f,
+    0x00, 0x01, 0x00, 0x01, 0x81, 0x00, 0x85, 0x01, 0x02, 0x00, 0x01, 0x00, 0x81, 0x01, 0x05, 0x00,
+    0x36, 0xc7, 0x15, 0x25, 0x8b, 0x82, 0x06, 0x03, 0x19, 0x4e, 0x15, 0x1d, 0x81, 0x06, 0x00, 0x0f,
+    0x82, 0x06, 0x02, 0x1f, 0x06, 0x0b, 0x81, 0x15, 0x03, 0x6d, 0x6b, 0x1f, 0x0b, 0x81, 0x06, 0x00,
+    0x37, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00,
+    0x01, 0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x87, 0x00, 0x04, 0x01, 0x00, 0x01, 0x00,
+    0x01, 0x82, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x01, 0x86, 0x81, 0x0b, 0x03, 0x06, 0x38, 0x36,
+    0x01, 0x81, 0x00, 0x06, 0x45, 0xff, 0x69, 0xc2, 0x03, 0x09, 0x13, 0x03, 0x09, 0x84, 0x03, 0x09,
+    0x08, 0x03, 0xff, 0xb4, 0x2c, 0x37, 0xcf, 0x03, 0x08, 0x03, 0x09, 0x08, 0x82, 0x03, 0x00, 0x09,
+    0x81, 0x03, 0x03, 0xac, 0xff, 0xd5, 0x0f, 0xff, 0x72, 0x04, 0xb9, 0x81, 0x03, 0x81, 0x09, 0x01,
+    0x13, 0x08, 0x81, 0x03, 0x82, 0x09, 0x01, 0x03, 0x13, 0x83, 0x03, 0x07, 0x7b, 0x62, 0x3e, 0x33,
+    0x05, 0x11, 0x32, 0x5e, 0x81, 0x00, 0x81, 0x01, 0x86, 0x00, 0x00, 0x01, 0x81, 0x00, 0x82, 0x01,
+    0x08, 0x17, 0x01, 0x36, 0x84, 0x2a, 0x15, 0x1d, 0x06, 0x0f, 0x81, 0x06, 0x05, 0x16, 0x25, 0x8b,
+    0x1f, 0x06, 0x0b, 0x82, 0x06, 0x07, 0x4e, 0x26, 0x06, 0x84, 0x72, 0x6d, 0x4f, 0x0f, 0x81, 0x0b,
+    0x02, 0x26, 0xff, 0xcd, 0x2b, 0x7c, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01,
+    0x8c, 0x00, 0x02, 0x01, 0x00, 0x01, 0x82, 0x00, 0x02, 0x01, 0x17, 0x01, 0x8c, 0x00, 0x05, 0x75,
+    0x0b, 0x26, 0x0f, 0x19, 0x75, 0x83, 0x00, 0x05, 0x4a, 0xcf, 0x08, 0x09, 0x13, 0x09, 0x81, 0x03,
+    0x04, 0x09, 0x03, 0x09, 0x03, 0x09, 0x81, 0x08, 0x02, 0xff, 0x93, 0x6a, 0x7d, 0xff, 0x7a, 0x25,
+    0x83, 0x03, 0x05, 0xcf, 0xff, 0xb4, 0x2c, 0x95, 0xf1, 0xff, 0xf6, 0x55, 0xac, 0x81, 0x03, 0x01,
+    0x09, 0x03, 0x81, 0x09, 0x81, 0x03, 0x02, 0x09, 0x03, 0x08, 0x81, 0x09, 0x01, 0x03, 0x09, 0x81,
+    0x03, 0x03, 0x08, 0x13, 0x27, 0x32, 0x81, 0x05, 0x03, 0x04, 0x6c, 0x58, 0xff, 0xe6, 0xda, 0x81,
+    0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x01, 0x82, 0x00, 0x05, 0x01, 0x73,
+    0x15, 0x0a, 0x93, 0x4e, 0x81, 0x06, 0x04, 0xff, 0xd5, 0x8b, 0x06, 0x16, 0x15, 0x5b, 0x83, 0x0b,
+    0x81, 0x06, 0x04, 0x2d, 0x19, 0x06, 0xd4, 0x0a, 0x81, 0x3a, 0x02, 0x84, 0x0b, 0x0f, 0x81, 0x06,
+    0x00, 0xff, 0x28, 0xe0, 0x81, 0x01, 0x01, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x89, 0x00, 0x00,
+    0x01, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x8b, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00,
+    0x36, 0x81, 0x0b, 0x81, 0x1f, 0x01, 0xff, 0x83, 0x89, 0x01, 0x81, 0x00, 0x81, 0x01, 0x00, 0xff,
+    0x38, 0xc1, 0x81, 0x08, 0x81, 0x09, 0x81, 0x03, 0x81, 0x09, 0x02, 0x03, 0x09, 0x03, 0x81, 0x09,
+    0x00, 0x08, 0x81, 0x03, 0x01, 0x09, 0x08, 0x81, 0x03, 0x02, 0x09, 0x08, 0x03, 0x81, 0x13, 0x01,
+    0x03, 0x08, 0x81, 0x03, 0x00, 0x13, 0x81, 0x03, 0x81, 0x08, 0x83, 0x03, 0x81, 0x08, 0x00, 0x13,
+    0x81, 0x03, 0x08, 0xff, 0xff, 0x7b, 0x70, 0x43, 0x04, 0x05, 0x04, 0xff, 0x31, 0xc9, 0xbe, 0xc6,
+    0x81, 0x00, 0x81, 0x01, 0x00, 0x00, 0x81, 0x01, 0x03, 0x17, 0x00, 0x01, 0x00, 0x83, 0x01, 0x82,
+    0x00, 0x00, 0x01, 0x81, 0x00, 0x05, 0x75, 0x15, 0x0d, 0x5b, 0xff, 0xbc, 0x67, 0x0f, 0x81, 0x0b,
+    0x00, 0x81, 0x81, 0x16, 0x13, 0x5b, 0x19, 0x06, 0x1f, 0x0f, 0x0b, 0x06, 0x72, 0x0f, 0x0b, 0xff,
+    0xc4, 0xa8, 0x25, 0x5b, 0xff, 0xac, 0x6a, 0xf0, 0x0b, 0x06, 0xa9, 0x0b, 0x5f, 0x84, 0x00, 0x00,
+    0x01, 0x82, 0x00, 0x81, 0x01, 0x82, 0x00, 0x81, 0x01, 0x89, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00,
+    0x01, 0x83, 0x00, 0x00, 0x01, 0x85, 0x00, 0x07, 0x01, 0x00, 0x36, 0x0b, 0x1f, 0x19, 0xb2, 0xff,
+    0xde, 0x76, 0x81, 0x01, 0x81, 0x00, 0x03, 0x01, 0xf8, 0x85, 0x08, 0x81, 0x09, 0x02, 0x03, 0x08,
+    0x09, 0x84, 0x03, 0x00, 0x09, 0x83, 0x03, 0x01, 0x09, 0x08, 0x82, 0x03, 0x00, 0x09, 0x85, 0x03,
+    0x03, 0x09, 0x08, 0x03, 0x08, 0x83, 0x03, 0x81, 0x13, 0x09, 0x09, 0x03, 0x08, 0x27, 0x58, 0x07,
+    0x05, 0x04, 0x42, 0x3c, 0x81, 0x36, 0x81, 0x01, 0x00, 0x00, 0x82, 0x01, 0x00, 0x00, 0x82, 0x01,
+    0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x81, 0x01, 0x05, 0x7d, 0x80,
+    0x16, 0xf0, 0x81, 0x06, 0x81, 0x0b, 0x00, 0xa7, 0x81, 0x0d, 0x02, 0xef, 0x0f, 0x26, 0x81, 0x0f,
+    0x81, 0x0b, 0x0d, 0x44, 0x06, 0x0b, 0xff, 0xc4, 0xc8, 0x15, 0x44, 0x86, 0x31, 0x0f, 0xa4, 0x19,
+    0x06, 0x4a, 0xba, 0x81, 0x01, 0x01, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x00, 0x01, 0x82, 0x00,
+    0x00, 0x01, 0x87, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x01, 0x00, 0x01, 0x87, 0x00, 0x82, 0x01,
+    0x08, 0x00, 0x01, 0xff, 0x41, 0x62, 0xff, 0xf6, 0x4d, 0x06, 0x8f, 0x06, 0x45, 0x01, 0x82, 0x00,
+    0x03, 0x01, 0x00, 0x45, 0x4d, 0x81, 0x03, 0x09, 0x08, 0x13, 0x09, 0x03, 0x08, 0x03, 0x09, 0x08,
+    0x03, 0x13, 0x81, 0x03, 0x02, 0x08, 0x13, 0x03, 0x81, 0x09, 0x01, 0x03, 0x09, 0x82, 0x03, 0x81,
+    0x09, 0x00, 0x08, 0x81, 0x03, 0x82, 0x08, 0x02, 0x13, 0x08, 0x13, 0x81, 0x03, 0x0c, 0x08, 0x7b,
+    0x21, 0x46, 0x11, 0x3e, 0x04, 0x33, 0x62, 0xff, 0xb4, 0xab, 0x84, 0xff, 0x83, 0x05, 0xb7, 0x84,
+    0x01, 0x01, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x81, 0x00,
+    0x82, 0x01, 0x00, 0xad, 0x81, 0x0d, 0x0b, 0x31, 0x06, 0x0f, 0x3f, 0x19, 0x0a, 0xff, 0x7a, 0xa2,
+    0x15, 0xef, 0x0f, 0x0b, 0x06, 0x81, 0x0f, 0x01, 0x06, 0x16, 0x81, 0x06, 0x05, 0xbd, 0x2a, 0x15,
+    0x3a, 0x86, 0xd2, 0x81, 0x19, 0x04, 0x26, 0xff, 0xcd, 0x2b, 0xff, 0xf7, 0x18, 0x00, 0x01, 0x82,
+    0x00, 0x02, 0x01, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x17, 0x00, 0x01, 0x8b,
+    0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x81, 0x00, 0x08, 0x01, 0x00, 0x01, 0xff, 0xf7, 0x1a,
+    0xff, 0xf6, 0x90, 0x0f, 0xff, 0xd5, 0x29, 0xff, 0xed, 0xec, 0x67, 0x83, 0x00, 0x08, 0x01, 0x00,
+    0x01, 0xba, 0xff, 0x38, 0xc1, 0xff, 0xff, 0x58, 0x09, 0x08, 0x03, 0x81, 0x09, 0x01, 0x13, 0x03,
+    0x81, 0x08, 0x03, 0x09, 0x08, 0x09, 0x03, 0x81, 0x08, 0x82, 0x03, 0x00, 0x09, 0x81, 0x03, 0x04,
+    0x09, 0x13, 0x08, 0x03, 0x08, 0x83, 0x03, 0x07, 0x08, 0x03, 0x08, 0x09, 0x8d, 0x21, 0x49, 0x02,
+    0x82, 0x04, 0x09, 0x21, 0xff, 0x10, 0x60, 0x37, 0xff, 0xb4, 0x8a, 0x25, 0x0a, 0x44, 0x31, 0xff,
+    0x6a, 0xc6, 0x5d, 0x81, 0x01, 0x01, 0x97, 0xff, 0xcd, 0xf4, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00,
+    0x00, 0x01, 0x83, 0x00, 0x81, 0x01, 0x04, 0xc5, 0x15, 0x16, 0x1d, 0x0b, 0x81, 0x06, 0x1b, 0x3f,
+    0x0d, 0x6b, 0x0d, 0x9b, 0x19, 0x0b, 0x06, 0x1f, 0x06, 0x0f, 0x0a, 0x84, 0x1f, 0xa7, 0x16, 0x15,
+    0x5f, 0xc1, 0x4a, 0x06, 0x0b, 0xff, 0xcd, 0x2a, 0x06, 0x86, 0x01, 0x00, 0x01, 0x82, 0x00, 0x01,
+    0x01, 0x00, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00,
+    0x81, 0x01, 0x83, 0x00, 0x00, 0x01, 0x89, 0x00, 0x06, 0x01, 0x67, 0xff, 0x72, 0x62, 0x06, 0x19,
+    0xff, 0xf6, 0x4e, 0xff, 0xff, 0x5b, 0x81, 0x00, 0x84, 0x01, 0x04, 0x00, 0x17, 0x85, 0x7c, 0x13,
+    0x81, 0x03, 0x01, 0x09, 0x13, 0x85, 0x03, 0x01, 0x13, 0x09, 0x81, 0x03, 0x81, 0x08, 0x01, 0x03,
+    0x08, 0x81, 0x03, 0x07, 0x08, 0x09, 0x03, 0x13, 0x08, 0x09, 0x08, 0x03, 0x81, 0x09, 0x16, 0x03,
+    0xc3, 0x35, 0x04, 0x05, 0x02, 0x04, 0xae, 0x35, 0xcd, 0x27, 0x17, 0xff, 0x41, 0xa3, 0x5f, 0x3a,
+    0xff, 0x62, 0x22, 0x92, 0xff, 0xcd, 0x2c, 0xff, 0xc5, 0x0b, 0xff, 0x51, 0xa1, 0x36, 0x97, 0x01,
+    0x82, 0x00, 0x81, 0x01, 0x82, 0x00, 0x81, 0x01, 0x81, 0x00, 0x05, 0x01, 0x00, 0x5f, 0x1d, 0x0a,
+    0x44, 0x82, 0x06, 0x0e, 0x81, 0xe7, 0x2d, 0x16, 0xec, 0x1f, 0x0b, 0x26, 0x19, 0x06, 0xbd, 0x54,
+    0x80, 0x06, 0xff, 0xbc, 0x68, 0x81, 0x0d, 0x07, 0x4f, 0x00, 0x53, 0x06, 0x0f, 0xff, 0xab, 0xe5,
+    0x0b, 0x6d, 0x82, 0x00, 0x02, 0x01, 0x00, 0x01, 0x81, 0x00, 0x88, 0x00, 0x81, 0x01, 0x83, 0x00,
+    0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x8d, 0x00, 0x0a, 0x01, 0x17, 0xb7, 0x3f, 0x0b, 0xff, 0xfe,
+    0x8f, 0x97, 0x00, 0x01, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x06, 0x00, 0x01, 0x36, 0xff, 0xe6,
+    0x14, 0x09, 0x03, 0x08, 0x82, 0x03, 0x00, 0x08, 0x83, 0x03, 0x02, 0x08, 0x09, 0x08, 0x81, 0x03,
+    0x00, 0x08, 0x86, 0x03, 0x00, 0x08, 0x82, 0x03, 0x81, 0x09, 0x02, 0xf5, 0x21, 0x02, 0x81, 0x04,
+    0x06, 0x46, 0x35, 0xff, 0x8b, 0x29, 0x47, 0xff, 0xdd, 0x6f, 0xff, 0x8b, 0x8a, 0x00, 0x81, 0x01,
+    0x00, 0x00, 0x81, 0x87, 0x81, 0x17, 0x01, 0x00, 0x17, 0x82, 0x01, 0x03, 0x00, 0x01, 0x00, 0x01,
+    0x82, 0x00, 0x01, 0x01, 0x00, 0x83, 0x01, 0x0c, 0x7a, 0x54, 0x92, 0xb6, 0x3f, 0x06, 0x19, 0xb3,
+    0xff, 0x62, 0x21, 0x0a, 0x0d, 0x90, 0x19, 0x81, 0x0b, 0x10, 0x19, 0x0b, 0x15, 0x44, 0x16, 0x19,
+    0xb3, 0x2a, 0x0a, 0x6d, 0x00, 0x97, 0xff, 0xcd, 0x2b, 0xff, 0xd5, 0x29, 0x8f, 0xa4, 0x37, 0x82,
+    0x00, 0x00, 0x01, 0x83, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00,
+    0x81, 0x01, 0x82, 0x00, 0x00, 0x01, 0x83, 0x00, 0x83, 0x01, 0x81, 0x00, 0x06, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x81, 0x00, 0x05, 0x01, 0x6d, 0x06, 0x0b, 0xff, 0xfe, 0x8f, 0xc3, 0x82,
+    0x01, 0x83, 0x00, 0x82, 0x01, 0x04, 0x00, 0x36, 0xf7, 0x13, 0x08, 0x82, 0x03, 0x81, 0x09, 0x01,
+    0x03, 0x09, 0x81, 0x03, 0x00, 0x09, 0x82, 0x03, 0x03, 0x09, 0x03, 0x08, 0x09, 0x83, 0x03, 0x00,
+    0x09, 0x81, 0x03, 0x0e, 0x08, 0x13, 0x08, 0xff, 0xb4, 0xcf, 0x78, 0x04, 0x05, 0x3c, 0xff, 0x18,
+    0x80, 0xff, 0xf5, 0xd2, 0x30, 0xff, 0xed, 0x50, 0xff, 0x82, 0xe6, 0xff, 0xf6, 0xd7, 0x01, 0x81,
+    0x00, 0x02, 0x01, 0x00, 0x01, 0x83, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x85, 0x00, 0x1f,
+    0x01, 0x00, 0x01, 0x3a, 0x0d, 0xff, 0x82, 0xe4, 0x06, 0x38, 0x06, 0x26, 0x25, 0xcb, 0x0d, 0x16,
+    0xde, 0x06, 0x1f, 0x06, 0x0b, 0x1f, 0x8b, 0x1d, 0x15, 0x06, 0x57, 0x44, 0x0d, 0x6d, 0x00, 0x17,
+    0x4a, 0x1f, 0x81, 0x06, 0x05, 0x3a, 0x87, 0x00, 0x01, 0x00, 0x01, 0x82, 0x00, 0x82, 0x00, 0x81,
+    0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x83, 0x00, 0x81,
+    0x01, 0x84, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x00, 0x00, 0x81, 0x01, 0x04, 0x73, 0x0b,
+    0x1f, 0xff, 0xee, 0x0d, 0x67, 0x82, 0x00, 0x81, 0x01, 0x84, 0x00, 0x06, 0x01, 0x00, 0xff, 0xbd,
+    0x31, 0xd8, 0x09, 0x03, 0x09, 0x83, 0x03, 0x02, 0x08, 0x03, 0x09, 0x83, 0x03, 0x81, 0x08, 0x01,
+    0x09, 0x08, 0x81, 0x03, 0x01, 0x08, 0x09, 0x81, 0x03, 0x01, 0x09, 0x03, 0x82, 0x08, 0x0c, 0xff,
+    0x10, 0x60, 0x62, 0x35, 0xff, 0xed, 0xf3, 0x1a, 0x1b, 0x30, 0x1a, 0xff, 0x51, 0x21, 0x45, 0x00,
+    0x01, 0x00, 0x83, 0x01, 0x02, 0x00, 0x01, 0x00, 0x81, 0x01, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01,
+    0x83, 0x00, 0x83, 0x01, 0x03, 0x00, 0x37, 0x25, 0x4f, 0x82, 0x19, 0x08, 0x06, 0x16, 0x15, 0x0a,
+    0x44, 0xff, 0x6a, 0x61, 0x06, 0x0b, 0x3f, 0x81, 0x0f, 0x07, 0x0a, 0x0d, 0x15, 0x06, 0x44, 0x0a,
+    0x57, 0x5f, 0x81, 0x00, 0x05, 0x4f, 0x1f, 0x0b, 0x06, 0xff, 0x83, 0x24, 0x00, 0x81, 0x01, 0x81,
+    0x00, 0x00, 0x01, 0x81, 0x00, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00,
+    0x01, 0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x83, 0x01, 0x01, 0x00, 0xa1, 0x83, 0x00, 0x00, 0x01,
+    0x85, 0x00, 0x05, 0x01, 0xff, 0xff, 0xbe, 0xff, 0xf6, 0x4e, 0x06, 0x19, 0x17, 0x81, 0x01, 0x00,
+    0x00, 0x82, 0x01, 0x03, 0x00, 0x01, 0x00, 0x01, 0x82, 0x00, 0x02, 0x01, 0x6f, 0x8d, 0x81, 0x08,
+    0x02, 0x09, 0x03, 0x09, 0x81, 0x03, 0x00, 0x13, 0x81, 0x03, 0x00, 0x08, 0x81, 0x03, 0x01, 0x09,
+    0x13, 0x82, 0x03, 0x00, 0x09, 0x83, 0x03, 0x04, 0x09, 0x08, 0x7c, 0x4d, 0xff, 0x9b, 0x69, 0x81,
+    0x30, 0x02, 0x1a, 0x47, 0x1a, 0x81, 0x47, 0x01, 0xf2, 0x8d, 0x81, 0x01, 0x00, 0x17, 0x81, 0x00,
+    0x01, 0x01, 0x00, 0x84, 0x01, 0x00, 0x00, 0x82, 0x01, 0x83, 0x00, 0x81, 0x01, 0x0b, 0x00, 0x01,
+    0x00, 0xba, 0xff, 0xc4, 0xcb, 0x2a, 0x54, 0x06, 0x0f, 0x38, 0x15, 0xff, 0x83, 0x25, 0x81, 0x16,
+    0x0a, 0x0d, 0x5b, 0x1f, 0x0f, 0x0b, 0x0f, 0x3f, 0x16, 0x2a, 0x16, 0x06, 0x81, 0x0d, 0x01, 0x15,
+    0x5f, 0x81, 0x00, 0x05, 0x75, 0xff, 0xcd, 0x0b, 0x06, 0xb3, 0xff, 0xee, 0x4e, 0x5e, 0x81, 0x01,
+    0x84, 0x00, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00, 0x81, 0x01, 0x01, 0x00, 0x01, 0x81, 0x00, 0x00,
+    0x01, 0x85, 0x00, 0x02, 0x01, 0x00, 0x01, 0x8b, 0x00, 0x81, 0x01, 0x03, 0x7a, 0x0b, 0x06, 0x86,
+    0x85, 0x00, 0x01, 0x01, 0x17, 0x82, 0x00, 0x81, 0x01, 0x03, 0x00, 0x01, 0xaf, 0xff, 0xff, 0xbb,
+    0x81, 0x08, 0x82, 0x03, 0x03, 0x08, 0x09, 0x03, 0x13, 0x81, 0x03, 0x83, 0x08, 0x81, 0x03, 0x09,
+    0x08, 0x03, 0x08, 0x09, 0x03, 0xcd, 0xf7, 0xf1, 0x94, 0x50, 0x82, 0x47, 0x0b, 0x30, 0x47, 0x1b,
+    0x30, 0xff, 0x49, 0x41, 0xff, 0x9c, 0x4e, 0xff, 0xf7, 0x1a, 0x01, 0x17, 0x00, 0x01, 0x00, 0x81,
+    0x01, 0x01, 0x00, 0x01, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x81, 0x00, 0x82, 0x01, 0x83, 0x00,
+    0x0f, 0x01, 0x5d, 0x2a, 0x0d, 0x81, 0x06, 0x0f, 0x0b, 0x0d, 0x8c, 0x15, 0x0a, 0x0d, 0x93, 0x26,
+    0x1f, 0x81, 0x0f, 0x01, 0xbd, 0x1d, 0x81, 0x0d, 0x04, 0x0b, 0x0d, 0x16, 0x2d, 0x6d, 0x81, 0x00,
+    0x05, 0x67, 0x37, 0x19, 0x0d, 0xff, 0xee, 0x4f, 0x5e, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00,
+    0x01, 0x02, 0x01, 0x00, 0x01, 0x87, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01,
+    0x01, 0x00, 0x82, 0x01, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x05, 0x00, 0x17, 0xc5,
+    0x19, 0x0b, 0xff, 0x39, 0x21, 0x81, 0x00, 0x82, 0x01, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x82, 0x00, 0x05, 0x01, 0x00, 0xff, 0x39, 0x42, 0x7d, 0x03, 0x13, 0x83, 0x03, 0x01, 0x08, 0x09,
+    0x81, 0x03, 0x81, 0x09, 0x81, 0x08, 0x81, 0x13, 0x06, 0x03, 0x13, 0x08, 0xf6, 0x95, 0xf7, 0xff,
+    0xed, 0x91, 0x82, 0x30, 0x81, 0x1a, 0x81, 0x30, 0x08, 0x1a, 0x30, 0x1a, 0xff, 0x41, 0x01, 0xd3,
+    0xa6, 0x58, 0x27, 0x00, 0x82, 0x01, 0x82, 0x00, 0x82, 0x01, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00,
+    0x00, 0x01, 0x81, 0x00, 0x18, 0x01, 0x00, 0x36, 0x72, 0xff, 0x59, 0xe0, 0x0f, 0x1f, 0x0f, 0xff,
+    0xc4, 0xe9, 0x0a, 0x44, 0x16, 0x15, 0x1d, 0x15, 0x3f, 0x06, 0x19, 0x0b, 0x57, 0x15, 0x0a, 0x16,
+    0x06, 0x1d, 0x81, 0x0a, 0x00, 0x4f, 0x81, 0x00, 0x05, 0xa3, 0x7a, 0x26, 0x54, 0xff, 0xfe, 0xf2,
+    0xff, 0xef, 0x1a, 0x83, 0x00, 0x82, 0x01, 0x84, 0x00, 0x82, 0x01, 0x81, 0x00, 0x00, 0x01, 0x83,
+    0x00, 0x02, 0x01, 0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0x89, 0x00, 0x07, 0x01, 0x00, 0xff, 0xd6,
+    0x55, 0xff, 0xdd, 0x8d, 0x1f, 0x4a, 0x01, 0x00, 0x81, 0x01, 0x82, 0x00, 0x83, 0x01, 0x82, 0x00,
+    0x07, 0x01, 0x00, 0x01, 0x9e, 0xff, 0x38, 0xe1, 0xb9, 0x03, 0x08, 0x81, 0x03, 0x03, 0x09, 0x03,
+    0x09, 0x03, 0x81, 0x09, 0x01, 0x03, 0x09, 0x81, 0x13, 0x0c, 0x08, 0xff, 0xff, 0x7a, 0x95, 0x4d,
+    0xff, 0xfe, 0x74, 0x1a, 0x30, 0x1a, 0x30, 0x1a, 0xff, 0xe5, 0x30, 0x1a, 0x50, 0x81, 0x47, 0x03,
+    0x1a, 0x30, 0x6f, 0x2b, 0x81, 0x22, 0x01, 0xff, 0x29, 0x87, 0x27, 0x84, 0x01, 0x81, 0x00, 0x00,
+    0x01, 0x83, 0x00, 0x00, 0x01, 0x83, 0x00, 0x81, 0x01, 0x81, 0x00, 0x02, 0x31, 0x0a, 0xff, 0x82,
+    0xc4, 0x81, 0x06, 0x14, 0x1f, 0x16, 0x5b, 0x0d, 0x2a, 0x15, 0x54, 0x16, 0x06, 0x3f, 0x0b, 0x1f,
+    0x0d, 0xff, 0xab, 0xc7, 0x25, 0x16, 0x2a, 0x15, 0x0d, 0x0a, 0x51, 0x82, 0x00, 0x04, 0x4f, 0x0f,
+    0x15, 0xff, 0xdd, 0xad, 0x87, 0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x00, 0x01, 0x85, 0x00,
+    0x81, 0x01, 0x01, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00,
+    0x01, 0x82, 0x00, 0x00, 0x01, 0x84, 0x00, 0x05, 0x17, 0x37, 0x0b, 0xff, 0xf6, 0x6f, 0xff, 0xf7,
+    0x38, 0x00, 0x81, 0x01, 0x86, 0x00, 0x00, 0x17, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x03, 0x17,
+    0x01, 0x37, 0xff, 0xff, 0xbb, 0x81, 0x09, 0x84, 0x03, 0x01, 0x09, 0x03, 0x81, 0x13, 0x04, 0x03,
+    0x67, 0xaf, 0x4a, 0xff, 0x49, 0x00, 0x81, 0x1b, 0x12, 0x47, 0x1a, 0xd9, 0x1b, 0x50, 0x47, 0x30,
+    0x47, 0x1b, 0x1a, 0x30, 0x47, 0x7a, 0x1e, 0x2b, 0x78, 0x4b, 0x21, 0x01, 0x82, 0x00, 0x04, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x82, 0x00, 0x01, 0x01, 0x00, 0x81,
+    0x01, 0x0c, 0x7a, 0x0d, 0x0a, 0x06, 0x0f, 0xb6, 0x0d, 0x6f, 0x0d, 0x16, 0x0d, 0xff, 0x8b, 0x65,
+    0x15, 0x82, 0x0b, 0x0a, 0xa9, 0x0d, 0x0a, 0x0d, 0x1d, 0x15, 0x1d, 0x0d, 0xee, 0x36, 0x01, 0x81,
+    0x00, 0x05, 0xbb, 0x26, 0x0a, 0xff, 0xe6, 0x2f, 0x97, 0x01, 0x85, 0x00, 0x82, 0x00, 0x82, 0x01,
+    0x85, 0x00, 0x81, 0x01, 0x01, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81,
+    0x00, 0x82, 0x01, 0x85, 0x00, 0x05, 0x45, 0xff, 0x7a, 0xc4, 0x26, 0x37, 0x01, 0x00, 0x81, 0x01,
+    0x01, 0xa3, 0x01, 0x85, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x05, 0xff,
+    0x49, 0x83, 0x95, 0x03, 0x09, 0x03, 0x08, 0x82, 0x03, 0x02, 0x13, 0x03, 0x95, 0x81, 0x4a, 0x01,
+    0x4d, 0xff, 0xfe, 0x95, 0x81, 0x1a, 0x09, 0x1b, 0x30, 0x47, 0x30, 0x1a, 0x94, 0x1a, 0x30, 0x47,
+    0xd9, 0x81, 0x1a, 0x08, 0x30, 0x6e, 0x21, 0x41, 0x1c, 0x22, 0x66, 0xff, 0xf7, 0x7c, 0x00, 0x81,
+    0x01, 0x81, 0x00, 0x01, 0x01, 0x17, 0x84, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00,
+    0x02, 0xff, 0xcd, 0xd3, 0x6b, 0xab, 0x82, 0x0f, 0x02, 0x0a, 0x92, 0x1d, 0x81, 0x16, 0x02, 0x2d,
+    0xeb, 0x0a, 0x82, 0x06, 0x02, 0x0d, 0x0a, 0x0d, 0x81, 0x0a, 0x05, 0x0d, 0x2a, 0x0d, 0xaa, 0xff,
+    0xac, 0xf0, 0x01, 0x81, 0x00, 0x04, 0x27, 0xff, 0xe5, 0xed, 0x16, 0xff, 0xff, 0x12, 0x5e, 0x85,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x82, 0x01, 0x86, 0x00, 0x81,
+    0x01, 0x01, 0x00, 0x01, 0x85, 0x00, 0x02, 0x01, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81, 0x00,
+    0x06, 0x01, 0x36, 0x0b, 0xdc, 0x01, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00, 0x82, 0x01,
+    0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x03, 0x01, 0xff, 0xde, 0x35, 0x85, 0x9e, 0x82, 0x03, 0x06,
+    0x09, 0x45, 0xb7, 0x4d, 0x3a, 0x4f, 0x7d, 0x81, 0x30, 0x81, 0x1a, 0x04, 0xd9, 0x1a, 0x47, 0x1b,
+    0x30, 0x81, 0x47, 0x81, 0x1b, 0x0c, 0x1a, 0x1b, 0xff, 0xbc, 0xae, 0x70, 0x21, 0x23, 0x1e, 0x2b,
+    0x22, 0x3b, 0xff, 0xe6, 0xfa, 0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x86,
+    0x00, 0x0d, 0x52, 0x15, 0xff, 0xac, 0x48, 0xa4, 0x06, 0x16, 0x0d, 0x5f, 0x15, 0x16, 0x15, 0x1d,
+    0xb8, 0xd4, 0x82, 0x06, 0x81, 0x0a, 0x11, 0x15, 0x25, 0x15, 0x0a, 0x16, 0x15, 0x4d, 0x45, 0x01,
+    0x00, 0x01, 0x73, 0xff, 0xe5, 0xad, 0x2d, 0xff, 0xf6, 0xb0, 0x45, 0x00, 0x01, 0x81, 0x00, 0x02,
+    0x01, 0x00, 0x01, 0x82, 0x00, 0x81, 0x01, 0x84, 0x00, 0x81, 0x01, 0x90, 0x00, 0x81, 0x01, 0x01,
+    0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x03, 0xff, 0x41, 0x41, 0x1f, 0x6e, 0x00, 0x81,
+    0x01, 0x00, 0x00, 0x81, 0x01, 0x81, 0x00, 0x01, 0x01, 0x00, 0x83, 0x01, 0x00, 0x00, 0x82, 0x01,
+    0x00, 0x5e, 0x81, 0x35, 0x13, 0xff, 0x18, 0xc2, 0x51, 0x4f, 0x37, 0x4d, 0x4a, 0x5f, 0x53, 0xf1,
+    0xff, 0xed, 0xb1, 0x1a, 0x1b, 0x30, 0x94, 0x1a, 0x30, 0x47, 0x30, 0x1a, 0x30, 0x81, 0x1a, 0x05,
+    0x47, 0x1b, 0x36, 0x41, 0xff, 0x10, 0xc5, 0x05, 0x82, 0x1e, 0x04, 0x23, 0x1e, 0xff, 0x18, 0xe5,
+    0xff, 0xcd, 0xf6, 0x01, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00, 0x81, 0x01, 0x87, 0x00, 0x08, 0x01,
+    0xbb, 0x0d, 0xd4, 0x06, 0x0a, 0x0d, 0xff, 0x83, 0x04, 0xff, 0x9b, 0xa7, 0x82, 0x0a, 0x02, 0x0d,
+    0x54, 0x06, 0x81, 0x0b, 0x05, 0x15, 0x0a, 0x57, 0x25, 0x57, 0x16, 0x81, 0x1d, 0x01, 0x16, 0x37,
+    0x81, 0x01, 0x81, 0x00, 0x05, 0x73, 0x93, 0x5b, 0xff, 0x62, 0x21, 0x01, 0x00, 0x81, 0x01, 0x83,
+    0x00, 0x00, 0x01, 0x83, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00, 0x82, 0x01, 0x82,
+    0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x81, 0x00, 0x02, 0x01, 0x00,
+    0x01, 0x82, 0x00, 0x03, 0xff, 0xff, 0x7b, 0x3a, 0x4a, 0x17, 0x82, 0x01, 0x00, 0x00, 0x82, 0x01,
+    0x81, 0x00, 0x00, 0x01, 0x83, 0x00, 0x81, 0x01, 0x26, 0x27, 0x77, 0x1e, 0x22, 0x1c, 0x28, 0xff,
+    0x39, 0x85, 0xff, 0x49, 0xa2, 0x53, 0x3a, 0x4d, 0xff, 0xfe, 0x74, 0x1b, 0x1a, 0x1b, 0x30, 0x1b,
+    0x30, 0x50, 0x1a, 0x50, 0x1a, 0x47, 0x1a, 0x47, 0xff, 0xfe, 0x54, 0x27, 0x58, 0x29, 0x33, 0x05,
+    0x02, 0x3d, 0x1e, 0x22, 0x3d, 0x8e, 0xff, 0x18, 0xe4, 0xff, 0xde, 0xd9, 0x82, 0x01, 0x82, 0x00,
+    0x00, 0x01, 0x83, 0x00, 0x01, 0x01, 0x00, 0x82, 0x01, 0x09, 0x00, 0x01, 0xff, 0xd6, 0x36, 0xff,
+    0xc4, 0xeb, 0x4f, 0x06, 0x4e, 0x25, 0x0a, 0x4f, 0x81, 0x0d, 0x03, 0x16, 0x0d, 0x15, 0x16, 0x81,
+    0x19, 0x06, 0x06, 0x0a, 0x0d, 0x16, 0x1d, 0x25, 0x0a, 0x81, 0x0d, 0x0a, 0x2d, 0xc5, 0x00, 0x01,
+    0x00, 0x01, 0x31, 0x0d, 0x3a, 0x4d, 0x01, 0x84, 0x00, 0x01, 0x01, 0x00, 0x83, 0x00, 0x81, 0x01,
+    0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x87, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x82, 0x00,
+    0x82, 0x01, 0x83, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x06, 0xff, 0xf7, 0x5c,
+    0x85, 0x6e, 0x01, 0x17, 0x01, 0x00, 0x81, 0x01, 0x83, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x0d,
+    0x00, 0x97, 0x58, 0x28, 0x29, 0x28, 0x2b, 0x23, 0x3b, 0x6d, 0x4d, 0xff, 0x8a, 0xe6, 0x1b, 0x1a,
+    0x81, 0x47, 0x82, 0x1b, 0x01, 0x30, 0x1a, 0x81, 0x30, 0x07, 0x1a, 0xff, 0xe5, 0x30, 0xff, 0xac,
+    0x2d, 0xff, 0x10, 0x41, 0x21, 0xae, 0x02, 0x49, 0x81, 0x04, 0x01, 0x02, 0x49, 0x81, 0x23, 0x03,
+    0x22, 0x23, 0x89, 0xff, 0xce, 0x37, 0x82, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x00, 0x00, 0x82,
+    0x01, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02, 0x5f, 0x0d, 0x2a, 0x81, 0x0a, 0x00, 0x0d, 0x81,
+    0x83, 0x05, 0x0a, 0x0d, 0x16, 0x15, 0xef, 0x0a, 0x81, 0x0b, 0x0a, 0x57, 0x15, 0x25, 0x15, 0x8b,
+    0x0d, 0x25, 0x1d, 0x15, 0xb4, 0xff, 0x30, 0xe1, 0x81, 0x01, 0x06, 0x00, 0x01, 0x53, 0x0a, 0xff,
+    0xac, 0x29, 0xff, 0x39, 0x40, 0x01, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00, 0x83, 0x00, 0x81, 0x01,
+    0x83, 0x00, 0x00, 0x01, 0x88, 0x00, 0x02, 0x01, 0x00, 0x01, 0x83, 0x00, 0x02, 0x01, 0x00, 0x01,
+    0x83, 0x00, 0x00, 0x01, 0x82, 0x00, 0x82, 0x01, 0x03, 0x00, 0x01, 0xff, 0x18, 0x80, 0x52, 0x81,
+    0x00, 0x04, 0x01, 0x00, 0x17, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00, 0x0e, 0x71, 0x78,
+    0x1c, 0x21, 0x41, 0x78, 0x28, 0xff, 0x21, 0x25, 0xff, 0x7a, 0xa5, 0x94, 0x1a, 0x1b, 0x30, 0x50,
+    0x1b, 0x81, 0x1a, 0x07, 0x47, 0x50, 0xd9, 0xff, 0xfe, 0xb6, 0x27, 0x70, 0x58, 0xa6, 0x81, 0x04,
+    0x83, 0x05, 0x08, 0x02, 0x04, 0x9f, 0x1e, 0x2b, 0x1e, 0x2b, 0x40, 0xff, 0xce, 0x17, 0x81, 0x00,
+    0x02, 0x01, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x83, 0x00, 0x08, 0x01,
+    0x67, 0xb4, 0x8c, 0x2d, 0x25, 0x0a, 0x54, 0x31, 0x82, 0x0a, 0x10, 0x1d, 0x4e, 0xab, 0x57, 0x0b,
+    0xb2, 0x15, 0x9c, 0x0a, 0x0d, 0x6b, 0x0d, 0x1d, 0x15, 0x44, 0x4d, 0x7c, 0x81, 0x00, 0x05, 0x01,
+    0xff, 0x9c, 0x4d, 0xff, 0x72, 0x84, 0x8b, 0xff, 0xbc, 0x69, 0x36, 0x81, 0x00, 0x82, 0x01, 0x82,
+    0x00, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x02, 0xa1, 0x00,
+    0x01, 0x85, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01,
+    0x01, 0x00, 0x81, 0x01, 0x83, 0x00, 0x01, 0x01, 0x00, 0x82, 0x01, 0x00, 0x00, 0x81, 0x17, 0x00,
+    0x00, 0x81, 0x01, 0x01, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x08, 0x00,
+    0x45, 0xff, 0x29, 0x87, 0x2b, 0x23, 0x28, 0x8e, 0x21, 0x62, 0x81, 0x36, 0x0d, 0xff, 0x7a, 0xe9,
+    0xff, 0xf6, 0x55, 0xff, 0xfe, 0xb6, 0xff, 0xfe, 0x96, 0xff, 0xfe, 0x75, 0xff, 0xc4, 0xf0, 0xff,
+    0x20, 0x81, 0x27, 0x74, 0x35, 0x21, 0xff, 0x29, 0x87, 0x2b, 0x1e, 0x81, 0x04, 0x00, 0x11, 0x81,
+    0x04, 0x0a, 0x02, 0x05, 0x02, 0x2f, 0x59, 0x1e, 0x28, 0x22, 0x1e, 0xff, 0x21, 0x26, 0xff, 0xc5,
+    0xf6, 0x81, 0x01, 0x00, 0x00, 0x82, 0x01, 0x81, 0x00, 0x83, 0x01, 0x00, 0x00, 0x83, 0x01, 0x02,
+    0x53, 0xcb, 0x4e, 0x82, 0x0a, 0x14, 0x51, 0xe7, 0x57, 0x2a, 0x16, 0x25, 0x0d, 0x92, 0x2a, 0x0b,
+    0x15, 0x2a, 0x4e, 0x0a, 0x0d, 0x2d, 0x15, 0x0a, 0x16, 0x0d, 0x31, 0x83, 0x00, 0x04, 0x53, 0x1d,
+    0x31, 0xff, 0x49, 0x20, 0x45, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x83, 0x00, 0x81,
+    0x01, 0x00, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00,
+    0x01, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x00, 0x00, 0x81,
+    0x01, 0x81, 0x00, 0x82, 0x01, 0x01, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00, 0x82, 0x01,
+    0x03, 0x00, 0x01, 0x9e, 0x8e, 0x81, 0x1e, 0x04, 0x22, 0x1e, 0x1c, 0x22, 0x3c, 0x81, 0x28, 0x04,
+    0x23, 0xff, 0x18, 0xe4, 0x29, 0xe4, 0x28, 0x81, 0x1e, 0x81, 0x28, 0x01, 0x22, 0x23, 0x83, 0x04,
+    0x00, 0x05, 0x81, 0x04, 0x81, 0x05, 0x82, 0x04, 0x05, 0x3d, 0x23, 0x22, 0x3d, 0x40, 0xff, 0xf7,
+    0x5c, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x81, 0x01, 0x0b, 0x00,
+    0x01, 0x00, 0x01, 0xff, 0x39, 0x22, 0xff, 0xcd, 0x4c, 0x0a, 0x1d, 0x4e, 0x0d, 0x6b, 0x4a, 0x81,
+    0x0d, 0x06, 0x1d, 0x0a, 0x0d, 0xc9, 0x1d, 0x26, 0xc4, 0x84, 0x0a, 0x02, 0xec, 0x2a, 0x0d, 0x81,
+    0x16, 0x00, 0xff, 0x83, 0xcb, 0x81, 0x01, 0x05, 0x00, 0xba, 0x4a, 0xc9, 0x1d, 0x31, 0x87, 0x00,
+    0x00, 0x01, 0x81, 0x01, 0x82, 0x00, 0x81, 0x01, 0x82, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01,
+    0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x03, 0x00, 0x01, 0x00, 0x01, 0x82, 0x00, 0x81,
+    0x01, 0x01, 0x00, 0x01, 0x81, 0x00, 0x83, 0x01, 0x00, 0x00, 0x82, 0x01, 0x81, 0x00, 0x03, 0x17,
+    0x01, 0x00, 0x01, 0x81, 0x00, 0x86, 0x01, 0x02, 0x00, 0x67, 0xff, 0x29, 0x88, 0x82, 0x28, 0x05,
+    0x2b, 0x1e, 0x1c, 0x62, 0x22, 0x28, 0x82, 0x23, 0x00, 0x2b, 0x82, 0x28, 0x06, 0x3d, 0x22, 0x23,
+    0x46, 0x02, 0x04, 0x05, 0x81, 0x04, 0x81, 0x02, 0x02, 0x04, 0x02, 0x04, 0x81, 0x05, 0x05, 0x59,
+    0x22, 0x2b, 0x29, 0x3b, 0xff, 0xb5, 0x54, 0x84, 0x01, 0x00, 0x00, 0x83, 0x01, 0x18, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x7b, 0xff, 0x49, 0x80, 0x8b, 0xcc, 0x16, 0x15, 0x80, 0x37, 0xff, 0xc4, 0xca,
+    0x0a, 0x44, 0x80, 0x0a, 0x16, 0x83, 0x0a, 0xb2, 0x25, 0x0a, 0x25, 0x81, 0x2d, 0x02, 0x0a, 0xff,
+    0x59, 0xa0, 0x16, 0x81, 0x0a, 0x02, 0x83, 0x01, 0x00, 0x81, 0x01, 0x04, 0x36, 0x8b, 0xff, 0x93,
+    0x85, 0x0d, 0xff, 0x39, 0x42, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x01, 0x00, 0x82, 0x00,
+    0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00,
+    0x01, 0x85, 0x00, 0x81, 0x01, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81,
+    0x00, 0x83, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x81, 0x01,
+    0x00, 0x00, 0x82, 0x01, 0x05, 0xff, 0xf7, 0x5c, 0x49, 0x1e, 0x22, 0x28, 0x23, 0x81, 0x22, 0x05,
+    0x35, 0x22, 0x28, 0x64, 0x1e, 0x22, 0x81, 0x23, 0x05, 0x22, 0x1c, 0x22, 0x3d, 0x04, 0x2f, 0x81,
+    0x11, 0x03, 0x02, 0x04, 0x48, 0x42, 0x81, 0x04, 0x05, 0x02, 0x33, 0x05, 0x02, 0x2f, 0x28, 0x81,
+    0x3d, 0x04, 0xff, 0x29, 0x87, 0x98, 0x00, 0x01, 0x00, 0x83, 0x01, 0x02, 0x00, 0x01, 0x00, 0x81,
+    0x01, 0x11, 0x00, 0x01, 0x8d, 0x37, 0x16, 0xff, 0xab, 0xc6, 0x0a, 0x0d, 0x80, 0x31, 0x51, 0x0a,
+    0x0d, 0x5b, 0x44, 0x0a, 0x16, 0x6b, 0x83, 0x0a, 0x08, 0x16, 0x5b, 0x25, 0x2d, 0xde, 0x25, 0x0a,
+    0x25, 0x31, 0x81, 0x00, 0x06, 0x01, 0x17, 0x53, 0x9d, 0x0d, 0x4a, 0x01, 0x81, 0x00, 0x00, 0x01,
+    0x84, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x84, 0x00, 0x81, 0x01, 0x82,
+    0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x8a, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00,
+    0x00, 0x01, 0x82, 0x00, 0x81, 0x01, 0x01, 0x00, 0x01, 0x82, 0x00, 0x84, 0x01, 0x82, 0x00, 0x05,
+    0xff, 0xde, 0x98, 0x1e, 0x28, 0x23, 0x28, 0x2b, 0x81, 0x22, 0x06, 0x3c, 0x23, 0x2b, 0x21, 0x3d,
+    0x22, 0x2b, 0x81, 0x1e, 0x02, 0x2b, 0x05, 0x0c, 0x81, 0x02, 0x04, 0x04, 0x05, 0x02, 0x34, 0x02,
+    0x81, 0x05, 0x0d, 0x02, 0x04, 0x02, 0x04, 0x02, 0x9f, 0xff, 0x19, 0x87, 0x23, 0x22, 0x1c, 0x76,
+    0x27, 0x01, 0x00, 0x82, 0x01, 0x00, 0x17, 0x81, 0x00, 0x81, 0x01, 0x12, 0x00, 0xba, 0x4a, 0xff,
+    0x82, 0xe4, 0x72, 0x16, 0x0a, 0x16, 0xff, 0xac, 0x49, 0x3a, 0x01, 0x31, 0x1d, 0x15, 0x25, 0x0a,
+    0x16, 0x5b, 0x15, 0x81, 0x0a, 0x01, 0x25, 0x16, 0x81, 0x0a, 0x06, 0x16, 0x1d, 0xff, 0x62, 0x21,
+    0x2a, 0x16, 0x6b, 0xff, 0x5a, 0x45, 0x82, 0x00, 0x04, 0x7d, 0xff, 0xcd, 0x2c, 0xff, 0xb4, 0x07,
+    0xff, 0xc4, 0xca, 0x75, 0x81, 0x00, 0x81, 0x01, 0x85, 0x00, 0x81, 0x00, 0x00, 0x01, 0x8e, 0x00,
+    0x00, 0x01, 0x85, 0x00, 0x81, 0x01, 0x00, 0x00, 0x81, 0x01, 0x83, 0x00, 0x81, 0x01, 0x04, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x81, 0x01, 0x00, 0x00, 0x82, 0x01, 0x00, 0x00, 0x8a, 0x01, 0x02, 0xff,
+    0xb5, 0x74, 0x3d, 0x28, 0x81, 0x22, 0x13, 0x23, 0x22, 0x28, 0x41, 0x1c, 0x2b, 0x58, 0x2b, 0x1e,
+    0x2b, 0x3d, 0x1e, 0x02, 0x07, 0x05, 0x04, 0x0c, 0x48, 0x04, 0x05, 0x81, 0x02, 0x81, 0x05, 0x0f,
+    0x02, 0x04, 0x07, 0x04, 0x02, 0x05, 0x1e, 0x22, 0x28, 0x2e, 0x2b, 0xff, 0x18, 0xe5, 0x35, 0x45,
+    0x01, 0x00, 0x81, 0x01, 0x07, 0x00, 0xff, 0xe6, 0xb7, 0xa3, 0x52, 0xff, 0x39, 0x40, 0xab, 0x1d,
+    0x0a, 0x81, 0x15, 0x05, 0x5b, 0x6f, 0xff, 0xcd, 0xf3, 0x01, 0x71, 0x4f, 0x81, 0x15, 0x81, 0x1d,
+    0x06, 0x0a, 0xbc, 0x0d, 0xcc, 0x1d, 0x4e, 0x0d, 0x81, 0x0a, 0x0e, 0x25, 0x15, 0xcb, 0x2d, 0x0a,
+    0x37, 0xa3, 0x00, 0x01, 0x8d, 0x6d, 0x54, 0x1d, 0x31, 0xc3, 0x81, 0x00, 0x82, 0x01, 0x00, 0x00,
+    0x82, 0x01, 0x00, 0x00, 0x00, 0x01, 0x82, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x82, 0x01, 0x8b,
+    0x00, 0x81, 0x01, 0x82, 0x00, 0x02, 0x01, 0x00, 0x01, 0x82, 0x00, 0x01, 0x01, 0x00, 0x87, 0x01,
+    0x02, 0x00, 0x01, 0x00, 0x83, 0x01, 0x00, 0x17, 0x83, 0x01, 0x07, 0x00, 0x17, 0xf8, 0xff, 0x20,
+    0xe2, 0x22, 0x2b, 0x3d, 0x23, 0x81, 0x2b, 0x11, 0x28, 0x76, 0x28, 0x23, 0x40, 0x1e, 0x22, 0x49,
+    0x12, 0x02, 0x07, 0x05, 0x04, 0x0c, 0x04, 0x02, 0x07, 0x05, 0x83, 0x04, 0x01, 0x0c, 0x04, 0x81,
+    0x07, 0x06, 0x04, 0x2f, 0x22, 0x3b, 0x41, 0x1c, 0x22, 0x81, 0x12, 0x02, 0xd5, 0x41, 0xff, 0x31,
+    0x64, 0x81, 0x00, 0x11, 0x01, 0x00, 0xc1, 0x36, 0x4a, 0xde, 0xff, 0x8b, 0x66, 0xff, 0x49, 0x80,
+    0x4d, 0x5f, 0xff, 0xc5, 0x93, 0x01, 0x00, 0x01, 0xbb, 0x44, 0x0a, 0x15, 0x81, 0x16, 0x0e, 0x2d,
+    0x25, 0xff, 0x93, 0x44, 0x2d, 0x1d, 0x25, 0x1d, 0x0a, 0x1d, 0x0a, 0x0d, 0x54, 0x0a, 0x25, 0xbb,
+    0x81, 0x00, 0x05, 0x71, 0x5f, 0xe8, 0x0d, 0xff, 0x6a, 0x83, 0xff, 0x62, 0xc6, 0x81, 0x01, 0x00,
+    0x00, 0x82, 0x01, 0x82, 0x00, 0x01, 0x01, 0x00, 0x82, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x01,
+    0x82, 0x00, 0x82, 0x01, 0x01, 0x00, 0x01, 0x82, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x83, 0x01,
+    0x04, 0x00, 0x01, 0x00, 0x01, 0x00, 0x83, 0x01, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0x81, 0x01,
+    0x00, 0x00, 0x85, 0x01, 0x12, 0x00, 0x01, 0xff, 0xe6, 0xb8, 0x35, 0x21, 0x3c, 0x1e, 0x22, 0x1e,
+    0x23, 0x28, 0x2b, 0x23, 0x1c, 0x22, 0x9f, 0x2b, 0x1e, 0x04, 0x82, 0x02, 0x00, 0x07, 0x81, 0x05,
+    0x02, 0x04, 0x05, 0x04, 0x82, 0x05, 0x02, 0x04, 0x11, 0x05, 0x81, 0x04, 0x81, 0x02, 0x0e, 0x04,
+    0x05, 0x76, 0x1e, 0x28, 0x6a, 0xa5, 0x7f, 0xe3, 0xea, 0x10, 0xff, 0x32, 0xcf, 0x21, 0x27, 0x45,
+    0x81, 0x00, 0x05, 0x01, 0x17, 0x45, 0xff, 0xe6, 0xb7, 0x67, 0xba, 0x84, 0x00, 0x00, 0x31, 0x81,
+    0x25, 0x14, 0xe8, 0x0d, 0x25, 0xbc, 0x0a, 0xb8, 0x25, 0xc8, 0x2d, 0x15, 0x25, 0x15, 0x25, 0x16,
+    0x54, 0x15, 0xff, 0x7a, 0xc4, 0x45, 0x00, 0x7b, 0x53, 0x81, 0x0a, 0x03, 0x16, 0x5f, 0x00, 0x01,
+    0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00,
+    0x01, 0x8a, 0x00, 0x02, 0x01, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x82,
+    0x00, 0x82, 0x01, 0x00, 0x00, 0x82, 0x01, 0x00, 0x00, 0x81, 0x01, 0x00, 0x17, 0x85, 0x01, 0x81,
+    0x00, 0x81, 0x17, 0x0d, 0xff, 0xf7, 0x5c, 0xa0, 0x32, 0xa2, 0x42, 0x62, 0x1e, 0x22, 0xff, 0x21,
+    0x47, 0x23, 0x1e, 0x1c, 0x22, 0x28, 0x81, 0x23, 0x01, 0xa6, 0x02, 0x82, 0x05, 0x07, 0x04, 0x02,
+    0x0c, 0x04, 0x0c, 0x3e, 0x07, 0x04, 0x81, 0x3e, 0x18, 0x05, 0x07, 0x2f, 0x04, 0x05, 0x11, 0x04,
+    0x05, 0x21, 0x3d, 0x22, 0x2f, 0xff, 0x22, 0x4d, 0x2c, 0xff, 0x3b, 0x52, 0x0e, 0x14, 0x0e, 0xb1,
+    0x56, 0xff, 0x54, 0x15, 0x2e, 0xff, 0x10, 0x83, 0xff, 0x21, 0x03, 0xff, 0xff, 0x7b, 0x81, 0x01,
+    0x02, 0x00, 0x01, 0x00, 0x83, 0x01, 0x11, 0xff, 0xf7, 0x5b, 0x3a, 0x15, 0x0d, 0x1d, 0x0a, 0x16,
+    0x6b, 0x0a, 0xcc, 0xc0, 0x0d, 0xff, 0x82, 0xe3, 0x0a, 0x72, 0xc8, 0x0a, 0x15, 0x81, 0x0a, 0x08,
+    0x31, 0x00, 0xff, 0x62, 0x65, 0x4d, 0x0a, 0x1d, 0x0d, 0x4d, 0x67, 0x83, 0x01, 0x83, 0x00, 0x00,
+    0x01, 0x81, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x81, 0x00, 0x03,
+    0x01, 0x00, 0x01, 0x00, 0x81, 0x01, 0x82, 0x00, 0x81, 0x01, 0x88, 0x00, 0x04, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x81, 0x17, 0x00, 0x01, 0x81, 0x17, 0x0b, 0x01, 0x00, 0x17, 0x87, 0x5d, 0xff, 0x84,
+    0x0e, 0x27, 0x21, 0x2e, 0x6c, 0x42, 0x05, 0x81, 0x07, 0x00, 0x35, 0x82, 0x2b, 0x81, 0x1e, 0x08,
+    0x22, 0x1e, 0x2b, 0x22, 0x3d, 0x46, 0x02, 0x05, 0x04, 0x81, 0x02, 0x09, 0x07, 0x04, 0x34, 0x07,
+    0x0c, 0x05, 0x04, 0x05, 0x07, 0x05, 0x81, 0x04, 0x01, 0x33, 0x02, 0x81, 0x04, 0x15, 0x2e, 0x22,
+    0x2f, 0xff, 0x33, 0x10, 0x61, 0x56, 0xc2, 0xff, 0x43, 0xb5, 0x0e, 0x10, 0x55, 0xff, 0x33, 0x52,
+    0x65, 0x61, 0x5c, 0x10, 0x61, 0x42, 0x58, 0x27, 0x5e, 0xc6, 0x83, 0x01, 0x0a, 0x00, 0x75, 0x92,
+    0x0d, 0x16, 0x2d, 0x0a, 0x83, 0x2d, 0xda, 0x72, 0x81, 0x1d, 0x02, 0xeb, 0x25, 0x15, 0x81, 0x0a,
+    0x06, 0x0d, 0x0a, 0xeb, 0xff, 0x83, 0x68, 0x37, 0xff, 0xbc, 0xca, 0x0d, 0x81, 0x0a, 0x02, 0xbc,
+    0xff, 0x10, 0x60, 0x00, 0x81, 0x01, 0x01, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81,
+    0x01, 0x01, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x8a, 0x00, 0x00, 0x01, 0x87, 0x00, 0x81, 0x01,
+    0x82, 0x00, 0x85, 0x01, 0x0c, 0x00, 0x17, 0x01, 0x87, 0x67, 0x27, 0x74, 0x41, 0x2e, 0x0c, 0x34,
+    0x48, 0x42, 0x82, 0x04, 0x0f, 0xf9, 0x21, 0xff, 0x18, 0xe4, 0x1e, 0x23, 0x1c, 0x28, 0x1c, 0x22,
+    0x28, 0x23, 0x6a, 0x04, 0x69, 0x04, 0x2f, 0x81, 0x05, 0x02, 0x04, 0x02, 0x0c, 0x81, 0x05, 0x14,
+    0x0c, 0x04, 0x05, 0x07, 0x05, 0x02, 0x33, 0x02, 0x33, 0x05, 0x4b, 0xe4, 0x12, 0xff, 0x2a, 0xd0,
+    0x14, 0x60, 0x20, 0x0e, 0x14, 0x0e, 0x14, 0x83, 0x0e, 0x10, 0x68, 0x20, 0x65, 0x10, 0x0e, 0x20,
+    0xb1, 0xff, 0x08, 0xe5, 0x70, 0xff, 0x08, 0x21, 0xff, 0xe6, 0xb8, 0x00, 0x01, 0x00, 0x3a, 0x15,
+    0x16, 0x82, 0x0a, 0x81, 0x2d, 0x0d, 0xc8, 0x15, 0x16, 0xff, 0xb4, 0x07, 0x90, 0x16, 0x25, 0x16,
+    0x0a, 0x92, 0x0a, 0xc5, 0x6b, 0x1d, 0x82, 0x0a, 0x01, 0x25, 0xad, 0x83, 0x00, 0x00, 0x01, 0x86,
+    0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x84, 0x00, 0x81, 0x01, 0x00, 0x00, 0x81, 0x01, 0x84, 0x00,
+    0x00, 0x01, 0x83, 0x00, 0x02, 0x01, 0x00, 0x01, 0x81, 0x00, 0x82, 0x01, 0x85, 0x00, 0x01, 0x01,
+    0x17, 0x81, 0x01, 0x0a, 0x00, 0xff, 0xf7, 0x5b, 0xff, 0x84, 0x0e, 0x62, 0x21, 0x2e, 0xfa, 0x7f,
+    0xf9, 0x24, 0xff, 0x32, 0xad, 0x81, 0x24, 0x0e, 0x18, 0xff, 0x22, 0x2b, 0x12, 0x04, 0xff, 0x2a,
+    0x09, 0x41, 0x23, 0x2b, 0x3c, 0x28, 0x23, 0x22, 0x1e, 0x23, 0x1c, 0x81, 0x49, 0x07, 0x05, 0x69,
+    0x04, 0x07, 0x05, 0x04, 0x11, 0x04, 0x81, 0x0c, 0x0a, 0x04, 0x02, 0x04, 0x07, 0x04, 0x05, 0x02,
+    0x05, 0x02, 0x2b, 0x2e, 0x81, 0x07, 0x0a, 0x63, 0xff, 0x4b, 0xf4, 0x56, 0x60, 0xb0, 0x14, 0x10,
+    0x0e, 0x10, 0x14, 0x20, 0x81, 0x10, 0x04, 0x20, 0xc2, 0x10, 0x20, 0xff, 0x43, 0xb5, 0x81, 0x10,
+    0x13, 0x20, 0x14, 0x10, 0xff, 0x5c, 0x35, 0x2e, 0x41, 0x27, 0xff, 0x94, 0x0a, 0x0a, 0x0d, 0x16,
+    0x15, 0xf3, 0x0a, 0x0d, 0x0a, 0x16, 0x4e, 0x0a, 0x90, 0x81, 0x0a, 0x03, 0x4e, 0x57, 0x5b, 0x3a,
+    0x82, 0x0a, 0x00, 0x4e, 0x81, 0x1d, 0x04, 0x31, 0x01, 0x00, 0x01, 0x00, 0x83, 0x01, 0x83, 0x00,
+    0x00, 0x01, 0x81, 0x00, 0x83, 0x00, 0x04, 0x01, 0x00, 0x01, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01,
+    0x8e, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x00, 0x00, 0x82, 0x01, 0x24, 0x00, 0x17, 0xff,
+    0xde, 0xb8, 0x98, 0x32, 0x02, 0x24, 0x18, 0x39, 0x2c, 0x18, 0xe3, 0xff, 0x22, 0x4d, 0x55, 0x14,
+    0x20, 0xff, 0x22, 0x6e, 0xff, 0x22, 0x4c, 0x69, 0x21, 0xff, 0x29, 0x88, 0x28, 0x22, 0x1e, 0x28,
+    0x89, 0x28, 0x23, 0x22, 0x1e, 0x29, 0x59, 0x02, 0x04, 0x33, 0x2f, 0x05, 0x81, 0x0c, 0x08, 0x04,
+    0x05, 0x04, 0x05, 0x02, 0x11, 0x05, 0x02, 0x05, 0x81, 0x04, 0x12, 0x64, 0xff, 0x10, 0xa4, 0x02,
+    0x12, 0x11, 0x02, 0x04, 0x46, 0x62, 0xff, 0x4b, 0x71, 0x5c, 0x14, 0x10, 0x0e, 0x65, 0x14, 0x10,
+    0x14, 0x0e, 0x83, 0x10, 0x0f, 0x14, 0x20, 0xc2, 0x0e, 0x55, 0x61, 0x5c, 0x14, 0x0e, 0xb0, 0xff,
+    0x08, 0xe6, 0xff, 0x10, 0x83, 0x75, 0x57, 0xff, 0x72, 0x41, 0x2d, 0x82, 0x0a, 0x07, 0x0d, 0x16,
+    0x4e, 0x9d, 0x0a, 0x4e, 0x15, 0x44, 0x81, 0xff, 0x93, 0x66, 0x00, 0x25, 0x81, 0x0d, 0x05, 0x0a,
+    0x4e, 0x37, 0x8d, 0x00, 0x01, 0x81, 0x00, 0x82, 0x01, 0x87, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01,
+    0x84, 0x00, 0x81, 0x01, 0x03, 0x00, 0x01, 0x00, 0x01, 0x82, 0x00, 0x81, 0x01, 0x82, 0x00, 0x00,
+    0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x83, 0x01, 0x11, 0x5e, 0x74, 0x3b, 0xff, 0x2a, 0x4b,
+    0x18, 0x39, 0x24, 0xff, 0x32, 0x8e, 0xff, 0x33, 0x10, 0x82, 0x0e, 0x10, 0x55, 0x0e, 0x5c, 0xdd,
+    0x32, 0xff, 0x21, 0x26, 0x81, 0x1e, 0x00, 0x3d, 0x81, 0x22, 0x08, 0x23, 0x1e, 0x1c, 0xb5, 0x3d,
+    0x1e, 0x1c, 0x23, 0x05, 0x81, 0x02, 0x05, 0x29, 0x0c, 0x07, 0x04, 0x07, 0x05, 0x81, 0x04, 0x00,
+    0x05, 0x81, 0x02, 0x08, 0x04, 0x05, 0x69, 0x77, 0xae, 0x07, 0x02, 0x05, 0x02, 0x81, 0x04, 0x01,
+    0x11, 0x07, 0x81, 0x05, 0x07, 0x43, 0x3c, 0xff, 0x11, 0x47, 0xfe, 0x10, 0x55, 0x10, 0x0e, 0x81,
+    0x20, 0x01, 0x10, 0x68, 0x82, 0x10, 0x04, 0x5c, 0x0e, 0x61, 0x20, 0x14, 0x81, 0x10, 0x06, 0x0e,
+    0x20, 0x10, 0xff, 0x5b, 0xd2, 0x35, 0xff, 0x39, 0x41, 0x0d, 0x81, 0x44, 0x00, 0x2a, 0x81, 0x0a,
+    0x02, 0x16, 0xf0, 0x1d, 0x82, 0x0a, 0x07, 0x9d, 0x0a, 0x16, 0x0d, 0x15, 0x0a, 0x37, 0x45, 0x88,
+    0x00, 0x81, 0x01, 0x84, 0x00, 0x82, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00,
+    0x01, 0x81, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x81, 0x00, 0x01, 0x17, 0x01, 0x81, 0x00, 0x00,
+    0x01, 0x81, 0x00, 0x81, 0x01, 0x31, 0x27, 0x28, 0x12, 0xfa, 0x24, 0x2c, 0x39, 0xff, 0x2a, 0x8e,
+    0x10, 0x20, 0x55, 0x82, 0xff, 0x11, 0x27, 0x2e, 0xff, 0x3a, 0x4a, 0x02, 0x7e, 0x05, 0x02, 0x2f,
+    0x22, 0x23, 0xa8, 0x28, 0x23, 0x1e, 0x22, 0x23, 0x35, 0x28, 0x1e, 0x8e, 0x05, 0x07, 0x11, 0x3c,
+    0x04, 0x05, 0x04, 0x3e, 0x04, 0x05, 0x2f, 0x05, 0x02, 0x78, 0x35, 0x59, 0x04, 0x12, 0x82, 0x02,
+    0x05, 0x05, 0x0c, 0x34, 0x0c, 0x04, 0x05, 0x81, 0x02, 0x08, 0x11, 0x07, 0x33, 0x05, 0x46, 0x77,
+    0xff, 0x32, 0xce, 0x0e, 0x10, 0x82, 0x20, 0x05, 0x10, 0x0e, 0x65, 0x0e, 0x55, 0x14, 0x84, 0x0e,
+    0x06, 0x32, 0xff, 0x42, 0xcd, 0x18, 0x34, 0xfa, 0x21, 0x16, 0x81, 0x0a, 0x00, 0x1d, 0x81, 0x0a,
+    0x02, 0xcb, 0x16, 0x1d, 0x81, 0x0d, 0x01, 0x3a, 0x15, 0x82, 0x0a, 0x03, 0x31, 0xba, 0x00, 0x01,
+    0x84, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81,
+    0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x8a, 0x00, 0x00, 0x01, 0x81,
+    0x00, 0x81, 0x01, 0x00, 0x00, 0x81, 0x01, 0x16, 0x27, 0xff, 0x3a, 0xcd, 0x18, 0x12, 0x18, 0x2c,
+    0xff, 0x3a, 0xae, 0x39, 0x61, 0x20, 0xff, 0x19, 0xca, 0x49, 0x05, 0x02, 0x07, 0x02, 0x04, 0x05,
+    0x04, 0x05, 0x0c, 0x04, 0x3d, 0x81, 0x22, 0x01, 0x23, 0x22, 0x81, 0x2b, 0x13, 0x23, 0x28, 0x63,
+    0x49, 0x05, 0x07, 0x11, 0x41, 0x04, 0x0c, 0x04, 0x46, 0x6c, 0x76, 0x35, 0x32, 0x6c, 0x05, 0x04,
+    0x05, 0x81, 0x04, 0x81, 0x02, 0x03, 0x05, 0x04, 0x05, 0x11, 0x81, 0x05, 0x00, 0x0c, 0x81, 0x04,
+    0x81, 0x02, 0x00, 0x05, 0x82, 0x02, 0x05, 0x05, 0x46, 0x32, 0xff, 0x5c, 0x55, 0x10, 0x0e, 0x82,
+    0x10, 0x0b, 0x5c, 0x14, 0x68, 0x20, 0x61, 0x14, 0xff, 0x5c, 0x35, 0xff, 0x11, 0x06, 0x2c, 0x24,
+    0x18, 0x79, 0x81, 0x18, 0x02, 0x74, 0x1d, 0x0d, 0x82, 0x16, 0x05, 0x9c, 0x1d, 0x0a, 0x1d, 0x0d,
+    0x51, 0x81, 0x0d, 0x02, 0xff, 0xb4, 0x89, 0x37, 0xc3, 0x8d, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00,
+    0x84, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x83, 0x00, 0x04, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x83, 0x00, 0x01, 0x01, 0x00, 0x83, 0x01, 0x04, 0x00, 0x01, 0x00, 0x27, 0x0c, 0x81, 0x24, 0x0a,
+    0xe9, 0x5a, 0x24, 0x7f, 0xff, 0x2a, 0xf1, 0x32, 0x69, 0x42, 0x04, 0x05, 0x04, 0x81, 0x02, 0x81,
+    0x05, 0x02, 0x12, 0x0c, 0x02, 0x81, 0x05, 0x00, 0x02, 0x81, 0x04, 0x10, 0x11, 0x2f, 0x49, 0x6a,
+    0xae, 0x33, 0x07, 0x02, 0xff, 0x3a, 0x2a, 0x28, 0x78, 0xff, 0x29, 0x87, 0xff, 0x3a, 0x2a, 0x43,
+    0x6c, 0x02, 0x2f, 0x81, 0x04, 0x01, 0x33, 0x49, 0x81, 0x1e, 0x83, 0x05, 0x06, 0x02, 0x04, 0x05,
+    0x48, 0x04, 0x02, 0x04, 0x82, 0x02, 0x0f, 0x05, 0x02, 0x04, 0x07, 0x12, 0x02, 0x07, 0x04, 0x07,
+    0x59, 0xbf, 0xd6, 0x56, 0x60, 0x20, 0x5c, 0x81, 0x14, 0x03, 0x10, 0xff, 0x19, 0xa9, 0xff, 0x43,
+    0x72, 0x2c, 0x82, 0x18, 0x00, 0x39, 0x81, 0x24, 0x0e, 0x5a, 0x62, 0x0a, 0x0d, 0x4e, 0x16, 0xff,
+    0x93, 0x44, 0x2a, 0x0a, 0x15, 0xcc, 0x4d, 0x9c, 0x3a, 0x36, 0x82, 0x01, 0x01, 0x00, 0x01, 0x84,
+    0x00, 0x81, 0x01, 0x82, 0x00, 0x81, 0x01, 0x82, 0x00, 0x01, 0x00, 0x01, 0x8a, 0x00, 0x00, 0x01,
+    0x87, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x82, 0x01, 0x02, 0xff, 0xf7, 0x7c,
+    0x77, 0xff, 0x3a, 0xae, 0x81, 0x24, 0x04, 0x12, 0x18, 0x39, 0xff, 0x43, 0x0e, 0x29, 0x82, 0x05,
+    0x09, 0x11, 0x07, 0x05, 0x7e, 0x12, 0x05, 0x02, 0x48, 0x07, 0x04, 0x81, 0x02, 0x04, 0x05, 0x04,
+    0x07, 0x02, 0x07, 0x81, 0x04, 0x08, 0x3c, 0x07, 0x02, 0x0c, 0x05, 0x04, 0x05, 0x32, 0x6a, 0x81,
+    0x1e, 0x15, 0x22, 0x1e, 0x9f, 0x3d, 0x1e, 0xff, 0x19, 0x87, 0x2f, 0x05, 0x04, 0x12, 0x05, 0x02,
+    0x04, 0x07, 0x02, 0x05, 0x0c, 0x04, 0x11, 0x02, 0x05, 0x04, 0x81, 0x05, 0x03, 0x02, 0x07, 0x0c,
+    0x02, 0x83, 0x04, 0x09, 0x05, 0x0c, 0x2e, 0xff, 0x64, 0x55, 0xff, 0x33, 0x32, 0x14, 0x20, 0xff,
+    0x33, 0x32, 0xf9, 0xff, 0x4b, 0xd3, 0x81, 0x2c, 0x02, 0xff, 0x22, 0x2b, 0x24, 0x2c, 0x81, 0x18,
+    0x81, 0x39, 0x0e, 0xfa, 0x27, 0x15, 0x1d, 0x0d, 0xff, 0x93, 0x45, 0x0d, 0x1d, 0x0a, 0x1d, 0x4d,
+    0x75, 0x5d, 0x01, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00,
+    0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00, 0x8e, 0x00, 0x00, 0x01, 0x81, 0x00, 0x02, 0x01,
+    0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x00, 0x00, 0x84, 0x01, 0x08, 0x17, 0x41, 0x18, 0x24, 0x18,
+    0xff, 0x32, 0xce, 0xd6, 0x10, 0xff, 0x11, 0x06, 0x81, 0x12, 0x09, 0x04, 0x2f, 0x42, 0x02, 0x0c,
+    0x04, 0x02, 0x07, 0x05, 0x02, 0x81, 0x04, 0x03, 0x07, 0x05, 0x0c, 0x07, 0x81, 0x05, 0x04, 0x04,
+    0x0c, 0x07, 0xae, 0x43, 0x82, 0x02, 0x04, 0x43, 0x05, 0x02, 0x32, 0x3d, 0x81, 0x1e, 0x00, 0x2f,
+    0x82, 0x1e, 0x00, 0x3d, 0x81, 0x02, 0x05, 0x0c, 0x11, 0x02, 0x04, 0x07, 0x0c, 0x81, 0x02, 0x81,
+    0x04, 0x04, 0x05, 0x02, 0x04, 0x07, 0x04, 0x81, 0x02, 0x01, 0x05, 0x04, 0x81, 0x05, 0x03, 0x0c,
+    0x04, 0x05, 0x07, 0x81, 0x02, 0x1b, 0x0c, 0x02, 0x2e, 0xfe, 0x10, 0xff, 0x54, 0x16, 0xd7, 0x7f,
+    0x24, 0x2c, 0x39, 0x4c, 0x24, 0x18, 0x24, 0x2c, 0x5a, 0x24, 0xbf, 0xff, 0xc4, 0xcc, 0xe8, 0x0a,
+    0x16, 0xff, 0xa4, 0x07, 0x57, 0x0a, 0x0d, 0x51, 0x82, 0x01, 0x83, 0x00, 0x00, 0x01, 0x82, 0x00,
+    0x81, 0x01, 0x01, 0x00, 0x01, 0x87, 0x00, 0x83, 0x00, 0x02, 0x01, 0x00, 0x01, 0x84, 0x00, 0x01,
+    0x01, 0x00, 0x81, 0x01, 0x82, 0x00, 0x81, 0x01, 0x00, 0x00, 0x81, 0x01, 0x00, 0x00, 0x82, 0x01,
+    0x81, 0x00, 0x0f, 0x01, 0xff, 0x83, 0xee, 0xff, 0x3a, 0x8d, 0x5a, 0x39, 0x24, 0x55, 0x82, 0x2e,
+    0x04, 0x02, 0x0c, 0x12, 0x02, 0x34, 0x02, 0x81, 0x05, 0x01, 0x02, 0x07, 0x81, 0x05, 0x12, 0x0c,
+    0x12, 0x05, 0x07, 0x0c, 0x12, 0x02, 0x0c, 0x02, 0x05, 0x0c, 0x21, 0x04, 0x07, 0x05, 0x02, 0x0c,
+    0x04, 0x23, 0x81, 0x3d, 0x01, 0x23, 0x3d, 0x81, 0x1e, 0x10, 0x2f, 0x02, 0x05, 0x04, 0x2f, 0x07,
+    0x04, 0x0c, 0x07, 0x05, 0x04, 0x02, 0x04, 0x12, 0x05, 0x02, 0x07, 0x81, 0x04, 0x02, 0x02, 0x34,
+    0x07, 0x81, 0x0c, 0x83, 0x05, 0x05, 0x02, 0x0c, 0x07, 0x04, 0x02, 0x07, 0x81, 0x04, 0x03, 0x9a,
+    0x5a, 0xa5, 0x4c, 0x81, 0x2c, 0x03, 0xe3, 0x18, 0x2c, 0x7f, 0x82, 0x24, 0x06, 0x5a, 0x18, 0x74,
+    0x0a, 0x4e, 0x0d, 0x83, 0x81, 0x0a, 0x02, 0x0d, 0xff, 0x72, 0x63, 0x01, 0x86, 0x00, 0x00, 0x01,
+    0x83, 0x00, 0x82, 0x01, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x83, 0x00,
+    0x00, 0x01, 0x82, 0x00, 0x01, 0xa3, 0x01, 0x82, 0x00, 0x02, 0x01, 0x00, 0x01, 0x84, 0x00, 0x00,
+    0x01, 0x81, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x09, 0xff, 0x10, 0xa2, 0xff, 0x32, 0x4d, 0x39,
+    0x18, 0xe3, 0xff, 0x33, 0x32, 0x3c, 0x6c, 0x04, 0x11, 0x81, 0x05, 0x81, 0x02, 0x81, 0x05, 0x0a,
+    0x04, 0x07, 0x02, 0x11, 0x07, 0x04, 0x7e, 0x05, 0x04, 0x07, 0x05, 0x81, 0x02, 0x0a, 0x59, 0x6a,
+    0x02, 0x23, 0x02, 0x05, 0x02, 0x11, 0x02, 0x04, 0x21, 0x81, 0xd3, 0x10, 0x1e, 0x28, 0x59, 0x04,
+    0x11, 0x05, 0x12, 0x04, 0x02, 0x12, 0x34, 0x02, 0x11, 0x02, 0x04, 0x02, 0x07, 0x81, 0x11, 0x81,
+    0x04, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07, 0x82, 0x02, 0x01, 0x07, 0x12, 0x81, 0x02, 0x00, 0x07,
+    0x82, 0x05, 0x02, 0x04, 0xa2, 0x02, 0x81, 0x21, 0x03, 0x39, 0x24, 0x2c, 0x39, 0x82, 0x24, 0x00,
+    0x2c, 0x81, 0x18, 0x0e, 0x79, 0x18, 0x39, 0x66, 0xff, 0x8b, 0x69, 0x15, 0x1d, 0xff, 0xb4, 0x6a,
+    0x0a, 0x15, 0x44, 0xff, 0xb4, 0x89, 0x8d, 0x01, 0x00, 0x81, 0x01, 0x86, 0x00, 0x02, 0x01, 0x00,
+    0x01, 0x87, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x82, 0x00, 0x00, 0x01,
+    0x87, 0x00, 0x82, 0x01, 0x82, 0x00, 0x84, 0x01, 0x01, 0xff, 0x62, 0xea, 0x6c, 0x81, 0x39, 0x04,
+    0x18, 0xff, 0x3b, 0x51, 0x77, 0x33, 0x0c, 0x81, 0x02, 0x0e, 0x04, 0x12, 0x05, 0x02, 0x11, 0x07,
+    0x02, 0x07, 0x02, 0x07, 0x04, 0x02, 0x07, 0x05, 0x04, 0x82, 0x02, 0x13, 0x0c, 0x04, 0x05, 0x3c,
+    0x05, 0x02, 0x48, 0x07, 0x04, 0x11, 0x3e, 0x29, 0x1e, 0x9f, 0x0c, 0x04, 0x02, 0x05, 0x02, 0x05,
+    0x82, 0x04, 0x00, 0x07, 0x81, 0x04, 0x0a, 0x05, 0x04, 0x07, 0x04, 0x05, 0x07, 0x11, 0x04, 0x07,
+    0x02, 0x05, 0x81, 0x02, 0x82, 0x05, 0x04, 0x07, 0x02, 0x05, 0x02, 0x07, 0x81, 0x04, 0x0f, 0x05,
+    0x11, 0x02, 0x05, 0x21, 0x22, 0x2b, 0x21, 0xff, 0x3b, 0x31, 0x24, 0x18, 0x39, 0x18, 0xff, 0x22,
+    0x0c, 0x24, 0x39, 0x81, 0x24, 0x07, 0x2c, 0x39, 0xff, 0x29, 0xeb, 0x74, 0x0d, 0x57, 0xef, 0xcb,
+    0x81, 0x16, 0x01, 0xe8, 0xca, 0x82, 0x01, 0x81, 0x00, 0x82, 0x01, 0x84, 0x00, 0x00, 0x01, 0x86,
+    0x00, 0x00, 0x01, 0x81, 0x01, 0x00, 0x00, 0x81, 0x01, 0x82, 0x00, 0x81, 0x01, 0x83, 0x00, 0x81,
+    0x01, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x03,
+    0x01, 0x74, 0x24, 0x18, 0x81, 0x24, 0x02, 0x61, 0x6c, 0x02, 0x83, 0x05, 0x81, 0x04, 0x00, 0x12,
+    0x81, 0x02, 0x06, 0x04, 0x02, 0x12, 0x02, 0x0c, 0x05, 0x02, 0x81, 0x04, 0x01, 0x11, 0x05, 0x82,
+    0x04, 0x01, 0x11, 0x2e, 0x81, 0x05, 0x07, 0xff, 0x21, 0xe9, 0x04, 0x05, 0x5a, 0x23, 0xa8, 0x04,
+    0x02, 0x81, 0x04, 0x01, 0x02, 0x04, 0x81, 0x05, 0x00, 0x04, 0x81, 0x05, 0x05, 0x04, 0x05, 0x07,
+    0x02, 0x07, 0x04, 0x81, 0x02, 0x00, 0x07, 0x82, 0x04, 0x03, 0x0c, 0x07, 0x0c, 0x04, 0x81, 0x05,
+    0x26, 0x04, 0x05, 0x07, 0x11, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x46, 0x3d, 0x22, 0xa8,
+    0x9f, 0x2e, 0xff, 0x2a, 0x8e, 0x18, 0x39, 0x4c, 0x2c, 0x24, 0x18, 0x39, 0x18, 0x24, 0xff, 0x3a,
+    0xce, 0x18, 0x32, 0x25, 0x15, 0x37, 0xaa, 0x15, 0x72, 0x0d, 0x31, 0x01, 0x81, 0x00, 0x82, 0x01,
+    0x84, 0x00, 0x81, 0x01, 0x82, 0x00, 0x81, 0x01, 0x01, 0x00, 0x01, 0x81, 0x00, 0x02, 0x00, 0xa3,
+    0x01, 0x82, 0x00, 0x82, 0x01, 0x03, 0x00, 0x01, 0x00, 0x01, 0x81, 0x00, 0x01, 0x01, 0x00, 0x81,
+    0x01, 0x81, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x81, 0x01, 0x81, 0x00, 0x0a, 0xff, 0xe6, 0xb8,
+    0x3c, 0x18, 0x24, 0x18, 0x24, 0xbe, 0x05, 0x7e, 0x07, 0x04, 0x82, 0x02, 0x08, 0x04, 0x05, 0x02,
+    0x07, 0x05, 0x34, 0x04, 0x05, 0x04, 0x81, 0x05, 0x05, 0x07, 0x05, 0x02, 0x11, 0x7e, 0x05, 0x81,
+    0x02, 0x03, 0x99, 0x02, 0x04, 0x07, 0x81, 0x04, 0x01, 0x02, 0x21, 0x81, 0x02, 0x01, 0x04, 0x3e,
+    0x81, 0x04, 0x06, 0x05, 0x11, 0x2f, 0x07, 0x11, 0x02, 0x05, 0x81, 0x02, 0x06, 0x04, 0x02, 0x04,
+    0x07, 0x04, 0x11, 0x07, 0x83, 0x05, 0x01, 0x0c, 0x11, 0x82, 0x04, 0x81, 0x11, 0x10, 0x07, 0x04,
+    0x11, 0x07, 0x02, 0x04, 0x02, 0x0c, 0x41, 0x02, 0x05, 0x02, 0x05, 0x04, 0xff, 0x43, 0x51, 0xff,
+    0x32, 0xad, 0xa5, 0x81, 0x18, 0x12, 0x2c, 0x18, 0x79, 0x2c, 0x79, 0x24, 0x18, 0x0c, 0xff, 0xc4,
+    0xcc, 0x1d, 0x9c, 0x8b, 0xaa, 0x57, 0x0a, 0x3a, 0x5e, 0x01, 0x00, 0x82, 0x01, 0x02, 0x00, 0x01,
+    0x00, 0x82, 0x01, 0x85, 0x00, 0x81, 0x01, 0x81, 0x00, 0x01, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01,
+    0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00, 0x81, 0x01, 0x84, 0x00, 0x02, 0x01,
+    0x00, 0x01, 0x81, 0x00, 0x0f, 0xff, 0x94, 0x90, 0xfa, 0x5a, 0xff, 0x32, 0x4d, 0x4c, 0x24, 0x02,
+    0x07, 0x99, 0x04, 0x07, 0x11, 0x04, 0x2b, 0x0c, 0x04, 0x82, 0x05, 0x06, 0x04, 0x02, 0x07, 0x12,
+    0x05, 0x34, 0x02, 0x81, 0x04, 0x04, 0x12, 0x07, 0x02, 0x04, 0x32, 0x81, 0x02, 0x08, 0x04, 0x02,
+    0x04, 0x33, 0x02, 0x59, 0x05, 0x07, 0x02, 0x81, 0x0c, 0x13, 0x02, 0x04, 0x05, 0xff, 0x29, 0xeb,
+    0x02, 0x5a, 0x05, 0x07, 0x0c, 0x07, 0x04, 0x11, 0x02, 0x07, 0x42, 0x11, 0x07, 0x05, 0x04, 0x0c,
+    0x81, 0x04, 0x02, 0x02, 0x05, 0x07, 0x82, 0x02, 0x81, 0x04, 0x08, 0x02, 0x04, 0x11, 0x0c, 0x02,
+    0x66, 0x12, 0x05, 0x04, 0x81, 0x07, 0x03, 0x04, 0xff, 0x08, 0x84, 0xe0, 0x39, 0x81, 0x2c, 0x00,
+    0x18, 0x81, 0x2c, 0x81, 0x18, 0x07, 0x7f, 0x18, 0x34, 0xca, 0x1d, 0x4e, 0x31, 0xff, 0xac, 0x48,
+    0x81, 0x0a, 0x01, 0xff, 0xab, 0xc6, 0xff, 0x39, 0x40, 0x84, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82,
+    0x01, 0x86, 0x00, 0x01, 0x01, 0x00, 0x84, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x83, 0x00,
+    0x02, 0x01, 0x00, 0x01, 0x87, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x00, 0x27, 0x81, 0x24, 0x02,
+    0x18, 0x24, 0x2e, 0x81, 0x02, 0x0c, 0x0c, 0x04, 0x3e, 0x05, 0x02, 0x49, 0x34, 0x07, 0x04, 0x02,
+    0x04, 0x02, 0x04, 0x81, 0x05, 0x00, 0x02, 0x81, 0x05, 0x0d, 0x04, 0x33, 0x07, 0x0c, 0x02, 0x05,
+    0x77, 0x43, 0x2f, 0x0c, 0x34, 0x02, 0x05, 0x3c, 0x81, 0x05, 0x04, 0x02, 0x04, 0x05, 0x07, 0x02,
+    0x81, 0x05, 0x00, 0x07, 0x82, 0x02, 0x00, 0x11, 0x81, 0x02, 0x0b, 0x07, 0x0c, 0x02, 0x07, 0x12,
+    0x07, 0x02, 0x04, 0x02, 0x0c, 0x04, 0x02, 0x81, 0x04, 0x00, 0x02, 0x81, 0x05, 0x03, 0x07, 0x05,
+    0x48, 0x05, 0x81, 0x04, 0x05, 0x05, 0x34, 0x64, 0x02, 0x12, 0x04, 0x81, 0x07, 0x0a, 0x02, 0x0c,
+    0xff, 0x43, 0x72, 0x2c, 0x39, 0x4c, 0x79, 0x4c, 0x7f, 0x24, 0x18, 0x81, 0x24, 0x0b, 0x4c, 0x32,
+    0x0d, 0x1d, 0x3a, 0xff, 0x7a, 0xc4, 0x4f, 0x25, 0x0a, 0x83, 0xff, 0x62, 0x86, 0x01, 0x81, 0x00,
+    0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x83, 0x00, 0x81, 0x01, 0x85, 0x00, 0x82, 0x00, 0x02, 0x01,
+    0x00, 0x01, 0x83, 0x00, 0x82, 0x01, 0x81, 0x00, 0x81, 0x01, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00,
+    0x00, 0x01, 0x82, 0x00, 0x29, 0x01, 0x62, 0x34, 0x18, 0x4c, 0x39, 0x59, 0x04, 0x07, 0x43, 0x0c,
+    0x02, 0x05, 0xd5, 0x02, 0x5a, 0x04, 0x05, 0x02, 0x04, 0x02, 0x05, 0x04, 0x42, 0x05, 0x07, 0x05,
+    0x0c, 0x11, 0x04, 0x02, 0x04, 0x2e, 0x04, 0x02, 0x6a, 0x12, 0x0c, 0x05, 0x02, 0x1c, 0x11, 0x81,
+    0x05, 0x07, 0x02, 0x04, 0x05, 0x04, 0x11, 0x07, 0x04, 0x0c, 0x81, 0x02, 0x0f, 0x05, 0x07, 0x05,
+    0x02, 0x07, 0x12, 0x02, 0x0c, 0x05, 0x04, 0x07, 0x04, 0x0c, 0x05, 0x07, 0x48, 0x83, 0x04, 0x81,
+    0x02, 0x24, 0x04, 0x02, 0x42, 0x02, 0x05, 0xff, 0x32, 0x09, 0x05, 0x04, 0x12, 0x05, 0x02, 0x05,
+    0x02, 0x12, 0xe9, 0x2c, 0x18, 0x79, 0xff, 0x3a, 0xce, 0x39, 0x18, 0x24, 0x2c, 0x24, 0x4c, 0x34,
+    0x74, 0x4e, 0x0a, 0x54, 0x7a, 0xb4, 0x9d, 0x16, 0x0d, 0x4a, 0x45, 0x82, 0x00, 0x00, 0x01, 0x82,
+    0x00, 0x03, 0xa1, 0xc1, 0x00, 0x01, 0x83, 0x00, 0x81, 0x01, 0x81, 0x00, 0x83, 0x00, 0x04, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x85, 0x00, 0x81, 0x01, 0x00, 0x00, 0x82, 0x01,
+    0x09, 0x00, 0x01, 0x00, 0x17, 0x5e, 0x9a, 0x39, 0x4c, 0x5a, 0x32, 0x81, 0x12, 0x08, 0x42, 0x46,
+    0x07, 0x04, 0x2f, 0x3d, 0x07, 0x04, 0x0c, 0x82, 0x05, 0x04, 0x07, 0x04, 0x05, 0x02, 0x05, 0x81,
+    0x07, 0x00, 0x34, 0x83, 0x02, 0x03, 0x63, 0x05, 0x04, 0x05, 0x81, 0x02, 0x0d, 0x11, 0x58, 0x02,
+    0x04, 0x02, 0x0c, 0x02, 0x05, 0x04, 0x07, 0x12, 0x04, 0x07, 0x0c, 0x81, 0x02, 0x00, 0x12, 0x81,
+    0x02, 0x01, 0x05, 0x42, 0x81, 0x05, 0x03, 0x12, 0x02, 0x04, 0x11, 0x81, 0x04, 0x03, 0x11, 0x05,
+    0x34, 0x02, 0x81, 0x05, 0x04, 0x3e, 0x11, 0x07, 0x05, 0x04, 0x82, 0x02, 0x00, 0x21, 0x81, 0x02,
+    0x00, 0x05, 0x82, 0x02, 0x81, 0x05, 0x06, 0x64, 0xa5, 0x2c, 0x79, 0xff, 0x32, 0xad, 0x4c, 0x24,
+    0x81, 0x18, 0x04, 0x39, 0x12, 0x4c, 0x58, 0x2d, 0x81, 0x15, 0x07, 0x31, 0x37, 0xff, 0xb4, 0x89,
+    0xf3, 0x0d, 0x0a, 0x31, 0x7c, 0x81, 0x00, 0x83, 0x01, 0x03, 0xa0, 0x87, 0x00, 0x01, 0x83, 0x00,
+    0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x87, 0x00, 0x81, 0x01, 0x82, 0x00,
+    0x02, 0x01, 0x00, 0x01, 0x85, 0x00, 0x04, 0x01, 0x00, 0x01, 0x27, 0x99, 0x81, 0x24, 0x0a, 0x4c,
+    0x40, 0x04, 0x07, 0x05, 0xff, 0x32, 0x09, 0x02, 0x04, 0x64, 0x23, 0x04, 0x81, 0x05, 0x13, 0x04,
+    0x0c, 0x05, 0x12, 0x0c, 0x02, 0x04, 0x33, 0x07, 0x05, 0x04, 0x0c, 0xff, 0x21, 0xe9, 0x04, 0x1c,
+    0x05, 0x04, 0x11, 0x34, 0x04, 0x81, 0x02, 0x03, 0x2e, 0x04, 0x0c, 0x04, 0x81, 0x07, 0x02, 0x05,
+    0x02, 0x05, 0x81, 0x02, 0x81, 0x04, 0x09, 0x02, 0x07, 0x02, 0x05, 0x6a, 0x46, 0x0c, 0x07, 0x02,
+    0x05, 0x83, 0x02, 0x01, 0x04, 0x48, 0x81, 0x04, 0x02, 0x05, 0x02, 0x05, 0x81, 0x02, 0x04, 0x0c,
+    0x12, 0x05, 0x12, 0x04, 0x81, 0x43, 0x00, 0x07, 0x81, 0x04, 0x01, 0x05, 0x04, 0x81, 0x02, 0x03,
+    0x04, 0xff, 0x31, 0xea, 0xe0, 0x2c, 0x83, 0x18, 0x01, 0x2c, 0xff, 0x32, 0x4d, 0x81, 0x24, 0x12,
+    0x18, 0x32, 0xff, 0x7a, 0xc3, 0x16, 0x0a, 0xbc, 0x01, 0xff, 0x28, 0xe0, 0x9c, 0x1d, 0x0a, 0x16,
+    0x31, 0xff, 0x6a, 0xa6, 0xf8, 0x00, 0x01, 0x45, 0x52, 0x81, 0x01, 0x01, 0x00, 0x01, 0x82, 0x00,
+    0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x88, 0x00, 0x02, 0x01, 0x00, 0x01, 0x89, 0x00, 0x00, 0x01,
+    0x81, 0x00, 0x03, 0x01, 0x00, 0x01, 0xff, 0x10, 0x83, 0x81, 0x18, 0x11, 0x4c, 0x27, 0x2f, 0x05,
+    0x33, 0x05, 0x66, 0x04, 0x05, 0x22, 0x04, 0x0c, 0x05, 0x02, 0x12, 0x07, 0x04, 0x02, 0x81, 0x04,
+    0x81, 0x07, 0x00, 0x05, 0x82, 0x02, 0x02, 0x3e, 0x12, 0x58, 0x81, 0x02, 0x09, 0x04, 0x0c, 0x11,
+    0x05, 0x69, 0x02, 0x07, 0x02, 0x04, 0x02, 0x81, 0x05, 0x01, 0x02, 0x05, 0x81, 0x04, 0x06, 0x02,
+    0x0c, 0x02, 0x04, 0x02, 0xd6, 0x14, 0x81, 0x10, 0x08, 0x68, 0xd6, 0xff, 0x21, 0xeb, 0xe9, 0x49,
+    0x99, 0x04, 0x05, 0x02, 0x82, 0x05, 0x81, 0x04, 0x04, 0x07, 0x0c, 0x05, 0x02, 0x2f, 0x81, 0x04,
+    0x04, 0x3c, 0x04, 0x02, 0x12, 0x02, 0x83, 0x04, 0x81, 0x0c, 0x0c, 0xff, 0x3b, 0x31, 0x39, 0x4c,
+    0x2c, 0x18, 0x79, 0xff, 0x32, 0x8e, 0x7f, 0x18, 0x34, 0x12, 0xff, 0x00, 0x82, 0xe7, 0x81, 0x0d,
+    0x0c, 0x4e, 0x27, 0x00, 0xff, 0x93, 0xec, 0xff, 0x39, 0x21, 0xff, 0x83, 0x25, 0x25, 0x0a, 0x54,
+    0xff, 0x59, 0xe1, 0x37, 0xff, 0x62, 0x43, 0x36, 0x82, 0x01, 0x06, 0x00, 0x17, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x86, 0x00, 0x81, 0x01, 0x83, 0x00, 0x00, 0x01, 0x85, 0x00,
+    0x02, 0x01, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x07, 0x17, 0x35, 0x5a, 0x39, 0x34, 0xff, 0x10,
+    0xc3, 0x2b, 0x05, 0x81, 0x04, 0x08, 0x2e, 0x04, 0xd5, 0x1e, 0x43, 0x05, 0x02, 0x0c, 0x05, 0x81,
+    0x04, 0x04, 0x12, 0x02, 0x07, 0x05, 0x12, 0x82, 0x02, 0x02, 0x04, 0x05, 0x3c, 0x81, 0x04, 0x81,
+    0x02, 0x06, 0x04, 0x05, 0x02, 0x21, 0x0c, 0x04, 0x05, 0x81, 0x02, 0x00, 0x07, 0x81, 0x04, 0x15,
+    0x12, 0x04, 0x07, 0x11, 0x05, 0x04, 0x6a, 0x05, 0xb0, 0x56, 0x0e, 0x14, 0x0e, 0x60, 0x8a, 0x14,
+    0x20, 0x56, 0x12, 0x0c, 0x05, 0x04, 0x81, 0x07, 0x04, 0x02, 0x04, 0x02, 0x12, 0x2f, 0x81, 0x02,
+    0x81, 0x05, 0x0d, 0xff, 0x19, 0x06, 0x02, 0x07, 0x12, 0x05, 0x07, 0x0c, 0x05, 0x02, 0x04, 0x05,
+    0xff, 0x3b, 0x30, 0x2c, 0x24, 0x81, 0x39, 0x15, 0x24, 0x18, 0x24, 0x5a, 0x4c, 0x12, 0x76, 0xff,
+    0xbc, 0xab, 0x83, 0x2d, 0x1d, 0x4d, 0x67, 0x01, 0x17, 0xff, 0xac, 0xd0, 0x53, 0x31, 0x3a, 0x53,
+    0x75, 0x5e, 0x82, 0x01, 0x01, 0x00, 0x01, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x82, 0x00, 0x00,
+    0x01, 0x00, 0x01, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x01, 0x00,
+    0x81, 0x01, 0x13, 0x00, 0x01, 0x5d, 0x76, 0x5a, 0x18, 0x43, 0x1c, 0x23, 0x04, 0x02, 0x07, 0x21,
+    0x2f, 0x2b, 0x2f, 0x02, 0x43, 0x02, 0x04, 0x81, 0x02, 0x00, 0x11, 0x81, 0x04, 0x0a, 0x42, 0x0c,
+    0x04, 0x0c, 0x04, 0x05, 0x0c, 0x12, 0x89, 0x04, 0x02, 0x82, 0x05, 0x04, 0x02, 0x46, 0x59, 0x12,
+    0x02, 0x83, 0x04, 0x22, 0x02, 0x05, 0x02, 0x04, 0x02, 0x05, 0x12, 0x04, 0x02, 0xff, 0x3a, 0x2b,
+    0x8a, 0x10, 0x27, 0xff, 0x19, 0xca, 0xe1, 0x14, 0x10, 0xe2, 0xff, 0x2b, 0x52, 0x14, 0xf9, 0x07,
+    0x11, 0x02, 0x05, 0x0c, 0x04, 0x07, 0x04, 0x05, 0x02, 0x04, 0x0c, 0x02, 0x1c, 0x81, 0x05, 0x82,
+    0x02, 0x02, 0x07, 0x04, 0x48, 0x81, 0x04, 0x02, 0x12, 0xff, 0x42, 0xef, 0xff, 0x32, 0x8e, 0x81,
+    0x2c, 0x00, 0x24, 0x81, 0x18, 0x0c, 0x4c, 0x18, 0x4c, 0x18, 0x89, 0x53, 0x15, 0x9d, 0x2d, 0x80,
+    0xff, 0x41, 0x41, 0xa1, 0x17, 0x83, 0x00, 0x04, 0x01, 0x00, 0x01, 0x00, 0x01, 0x89, 0x00, 0x01,
+    0x01, 0x00, 0x87, 0x00, 0x00, 0x01, 0x84, 0x00, 0x81, 0x01, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01,
+    0x81, 0x00, 0x83, 0x01, 0x04, 0xff, 0x08, 0x40, 0x46, 0x34, 0x18, 0x21, 0x82, 0x22, 0x09, 0x02,
+    0x04, 0x21, 0x64, 0x22, 0x07, 0x04, 0x02, 0x3e, 0x2f, 0x83, 0x04, 0x04, 0x05, 0x07, 0x05, 0x0c,
+    0x02, 0x81, 0x0c, 0x04, 0x02, 0x32, 0x02, 0x42, 0x02, 0x81, 0x04, 0x03, 0x05, 0x02, 0x32, 0x42,
+    0x81, 0x04, 0x06, 0x0c, 0x46, 0x02, 0x04, 0x11, 0x04, 0x02, 0x82, 0x05, 0x00, 0x02, 0x81, 0x04,
+    0x03, 0xff, 0x09, 0x06, 0x0e, 0xff, 0x4c, 0x57, 0x7e, 0x81, 0x05, 0x07, 0x04, 0x69, 0x0e, 0x10,
+    0x56, 0x1e, 0x05, 0x07, 0x81, 0x04, 0x03, 0x11, 0x05, 0x04, 0x05, 0x81, 0x04, 0x03, 0x05, 0x07,
+    0x04, 0x21, 0x81, 0x07, 0x00, 0x04, 0x82, 0x07, 0x07, 0x04, 0x05, 0x02, 0x04, 0x48, 0x9f, 0x39,
+    0xff, 0x3a, 0xae, 0x81, 0x18, 0x10, 0x24, 0x4c, 0x24, 0x18, 0x4c, 0x34, 0x88, 0xff, 0x5a, 0x45,
+    0xaa, 0x25, 0xff, 0x59, 0xe0, 0x16, 0xff, 0xbc, 0xca, 0x73, 0x01, 0x00, 0x01, 0x85, 0x00, 0x81,
+    0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x01, 0x01, 0x00, 0x82, 0x01, 0x86, 0x00, 0x82, 0x01,
+    0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x83, 0x00, 0x0d, 0x17, 0x32,
+    0x5a, 0x39, 0x24, 0x63, 0x1c, 0x28, 0xb5, 0x07, 0x6a, 0x35, 0x1e, 0x3d, 0x81, 0x05, 0x11, 0x11,
+    0x02, 0x7e, 0x04, 0x0c, 0x04, 0x05, 0x04, 0x7e, 0x04, 0x02, 0x04, 0x02, 0x11, 0x05, 0x64, 0x0c,
+    0x3e, 0x81, 0x04, 0x05, 0x02, 0x04, 0x05, 0x63, 0x04, 0x02, 0x81, 0x05, 0x04, 0x04, 0x02, 0x04,
+    0x11, 0x07, 0x81, 0x04, 0x25, 0x11, 0x05, 0x04, 0x05, 0x04, 0x61, 0xe2, 0x32, 0x02, 0x05, 0x02,
+    0x05, 0x9a, 0x14, 0x0e, 0xff, 0x4b, 0xf6, 0x05, 0x07, 0x02, 0x0c, 0x04, 0x05, 0x07, 0x2f, 0x11,
+    0x04, 0x02, 0x07, 0x05, 0x11, 0x33, 0x04, 0x11, 0x0c, 0x34, 0x05, 0x02, 0x11, 0x83, 0x02, 0x06,
+    0xe9, 0x24, 0x39, 0x79, 0x39, 0x18, 0x24, 0x81, 0x18, 0x0a, 0x24, 0x12, 0xff, 0x10, 0xc3, 0xff,
+    0xb5, 0x73, 0x86, 0xff, 0x72, 0x83, 0x0d, 0x4f, 0x1d, 0x9b, 0x86, 0x82, 0x00, 0x82, 0x01, 0x83,
+    0x00, 0x81, 0x01, 0x87, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x90, 0x00,
+    0x82, 0x01, 0x14, 0xf8, 0x21, 0x18, 0x4c, 0x4b, 0x1e, 0x22, 0x28, 0x1c, 0x22, 0x28, 0xff, 0x00,
+    0x61, 0x22, 0x59, 0x04, 0x02, 0x05, 0x04, 0x07, 0x04, 0x07, 0x81, 0x02, 0x01, 0x05, 0x0c, 0x81,
+    0x04, 0x04, 0x05, 0x07, 0x12, 0x64, 0x05, 0x81, 0x04, 0x01, 0x02, 0x04, 0x81, 0x02, 0x05, 0x23,
+    0x04, 0x05, 0x04, 0x02, 0x43, 0x81, 0x02, 0x01, 0x0c, 0x11, 0x81, 0x05, 0x01, 0x02, 0x04, 0x81,
+    0x05, 0x06, 0x04, 0x49, 0x56, 0x8a, 0xff, 0x3a, 0x2b, 0x49, 0x33, 0x81, 0x02, 0x81, 0x8a, 0x11,
+    0x55, 0xbe, 0x42, 0x02, 0x7e, 0x5a, 0x07, 0x02, 0x05, 0xff, 0x11, 0x06, 0x11, 0x05, 0x07, 0x0c,
+    0x11, 0x6c, 0x02, 0x04, 0x81, 0x02, 0x1f, 0x05, 0x02, 0x43, 0x04, 0x0c, 0x02, 0x12, 0x42, 0x2e,
+    0x18, 0x24, 0x18, 0x2c, 0x79, 0x2c, 0x18, 0x24, 0x39, 0x05, 0x76, 0xff, 0xa4, 0xd1, 0xf8, 0x7b,
+    0x4f, 0x92, 0x0a, 0x5b, 0xf3, 0x51, 0xff, 0x20, 0xc0, 0x00, 0x17, 0x8a, 0x00, 0x01, 0x01, 0x00,
+    0x81, 0x01, 0x01, 0x00, 0x01, 0x85, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x81, 0x01, 0x83, 0x00,
+    0x00, 0x01, 0x83, 0x00, 0x82, 0x01, 0x00, 0x00, 0x81, 0x01, 0x08, 0x70, 0xf9, 0x34, 0x35, 0x23,
+    0x1c, 0x28, 0x23, 0x1c, 0x81, 0x23, 0x07, 0x6a, 0x04, 0x02, 0x0c, 0x48, 0x07, 0x04, 0x02, 0x81,
+    0x05, 0x81, 0x07, 0x03, 0x48, 0x04, 0x11, 0x05, 0x81, 0x02, 0x00, 0x3c, 0x81, 0x05, 0x21, 0x02,
+    0x04, 0x12, 0x02, 0x07, 0x41, 0x04, 0x02, 0x05, 0x02, 0x07, 0x02, 0x04, 0x05, 0x34, 0x43, 0x04,
+    0x12, 0x04, 0x02, 0x42, 0x04, 0xff, 0x3b, 0x31, 0x14, 0x56, 0x20, 0x65, 0xff, 0x4b, 0xf4, 0xff,
+    0x19, 0xca, 0xea, 0xff, 0x3b, 0xf5, 0x0e, 0x14, 0x33, 0x81, 0x04, 0x81, 0x07, 0x04, 0x04, 0x12,
+    0x02, 0x2b, 0x12, 0x81, 0x04, 0x09, 0x02, 0x04, 0x3c, 0x04, 0x05, 0x02, 0x12, 0x05, 0x07, 0x42,
+    0x81, 0x02, 0x07, 0x05, 0x04, 0x05, 0x32, 0x18, 0x2c, 0xe3, 0x24, 0x83, 0x18, 0x03, 0x34, 0x1e,
+    0x40, 0xff, 0xad, 0x33, 0x81, 0x01, 0x0a, 0x00, 0xca, 0x37, 0xff, 0x72, 0xa3, 0xc9, 0x5b, 0xff,
+    0xac, 0x69, 0xff, 0x51, 0xa1, 0xff, 0x39, 0x01, 0xff, 0xac, 0xcf, 0x01, 0x84, 0x00, 0x81, 0x01,
+    0x82, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x83, 0x00, 0x81,
+    0x01, 0x81, 0x00, 0x00, 0x17, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x82, 0x00, 0x81, 0x01, 0x04,
+    0xc6, 0x3c, 0x12, 0x34, 0x78, 0x81, 0x1c, 0x05, 0x22, 0x1c, 0x23, 0x32, 0x22, 0x12, 0x82, 0x02,
+    0x81, 0x04, 0x03, 0x07, 0x2f, 0x07, 0x11, 0x82, 0x04, 0x04, 0x11, 0x48, 0x04, 0x05, 0x21, 0x81,
+    0x04, 0x0c, 0x34, 0x04, 0x11, 0x07, 0x12, 0x69, 0x46, 0x05, 0x04, 0x11, 0x05, 0x11, 0x05, 0x81,
+    0x04, 0x81, 0x12, 0x81, 0x04, 0x0e, 0x02, 0x04, 0x05, 0x34, 0x20, 0x10, 0x14, 0x60, 0x14, 0x10,
+    0xff, 0x3b, 0xd4, 0x0e, 0x65, 0xe2, 0xff, 0x4c, 0x16, 0x82, 0x05, 0x13, 0x02, 0x04, 0x07, 0x04,
+    0x11, 0x59, 0x04, 0x07, 0x11, 0x02, 0x07, 0x8e, 0x07, 0x48, 0x0c, 0x04, 0x02, 0x11, 0x02, 0x34,
+    0x81, 0x02, 0x06, 0x04, 0x02, 0x3c, 0x24, 0x79, 0x7f, 0x2c, 0x84, 0x18, 0x05, 0x1e, 0x76, 0xff,
+    0xad, 0x53, 0x01, 0x17, 0x01, 0x81, 0x00, 0x02, 0xff, 0xe6, 0xf9, 0x00, 0xba, 0x81, 0x01, 0x00,
+    0x00, 0x81, 0x01, 0x82, 0x00, 0x82, 0x01, 0x83, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x05,
+    0x00, 0x01, 0x00, 0x01, 0xa1, 0x01, 0x82, 0x00, 0x00, 0x01, 0x84, 0x00, 0x81, 0x01, 0x82, 0x00,
+    0x00, 0x01, 0x84, 0x00, 0x03, 0x5e, 0x4b, 0x4c, 0x43, 0x81, 0x1c, 0x06, 0x29, 0x1c, 0x29, 0x35,
+    0x2b, 0x12, 0x04, 0x81, 0x02, 0x01, 0x43, 0x04, 0x81, 0x02, 0x04, 0x0c, 0x02, 0x04, 0x02, 0x04,
+    0x81, 0x02, 0x0b, 0x12, 0x05, 0x02, 0x32, 0x02, 0x12, 0x05, 0x0c, 0x02, 0x11, 0x05, 0x21, 0x81,
+    0x04, 0x04, 0x07, 0x05, 0x04, 0x07, 0x11, 0x83, 0x04, 0x02, 0x11, 0x04, 0x12, 0x81, 0x05, 0x07,
+    0x49, 0xff, 0x00, 0x63, 0x18, 0xff, 0x54, 0x14, 0xfd, 0x0e, 0x20, 0x65, 0x81, 0x10, 0x04, 0x14,
+    0xbf, 0x07, 0x05, 0x02, 0x81, 0x05, 0x23, 0x04, 0x02, 0x07, 0x49, 0x02, 0x04, 0x02, 0x04, 0x6c,
+    0x12, 0x07, 0x3e, 0x07, 0x02, 0x7e, 0x02, 0x05, 0x04, 0x0c, 0x04, 0x02, 0x07, 0x2e, 0x24, 0x2c,
+    0x7f, 0x2c, 0x18, 0x4c, 0x24, 0x18, 0x5a, 0x23, 0x63, 0xff, 0xce, 0x37, 0x00, 0x81, 0x01, 0x01,
+    0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x01, 0x00, 0x01,
+    0x81, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x00, 0x05, 0x01, 0x00, 0x01, 0xa3,
+    0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x81, 0x01, 0x82,
+    0x00, 0x81, 0x01, 0x0c, 0x00, 0xff, 0x7b, 0x8c, 0xff, 0x42, 0xcd, 0x4c, 0x32, 0x23, 0x1c, 0x23,
+    0x1c, 0x2b, 0x58, 0x22, 0x11, 0x81, 0x07, 0x24, 0x11, 0x02, 0x05, 0x04, 0x3e, 0x02, 0x04, 0x02,
+    0x11, 0x05, 0x02, 0x04, 0x05, 0x04, 0x6c, 0x0c, 0x02, 0x04, 0x02, 0x11, 0x05, 0x02, 0x46, 0x63,
+    0x04, 0x05, 0x0c, 0x04, 0x07, 0x02, 0x04, 0x07, 0x05, 0x04, 0x02, 0x11, 0x05, 0x81, 0x02, 0x05,
+    0x34, 0x0c, 0x12, 0x07, 0x3e, 0x04, 0x81, 0x0c, 0x06, 0x1e, 0x32, 0xff, 0x08, 0xc6, 0xd7, 0x6c,
+    0x33, 0x02, 0x81, 0x07, 0x14, 0x04, 0x07, 0x04, 0x02, 0x05, 0x3d, 0x02, 0x04, 0x05, 0x3c, 0x02,
+    0x11, 0x0c, 0x07, 0x1e, 0x3d, 0x04, 0x0c, 0x04, 0x02, 0x04, 0x81, 0x05, 0x04, 0x77, 0x4c, 0x39,
+    0x2c, 0x4c, 0x81, 0x18, 0x05, 0x7f, 0x18, 0x4c, 0x22, 0x64, 0x71, 0x81, 0x01, 0x00, 0x00, 0x86,
+    0x01, 0x84, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x81, 0x01, 0x85, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x81, 0x01, 0x85, 0x00, 0x81, 0x01, 0x83, 0x00, 0x83, 0x01, 0x82, 0x00, 0x81, 0x01, 0x81, 0x00,
+    0x09, 0x27, 0x5a, 0x18, 0x88, 0x2b, 0x29, 0xff, 0x11, 0x26, 0x1c, 0x35, 0x2b, 0x81, 0x04, 0x06,
+    0x0c, 0x05, 0x12, 0x02, 0x2f, 0x05, 0x6a, 0x82, 0x02, 0x81, 0x0c, 0x0d, 0x02, 0x2f, 0x05, 0x0c,
+    0x41, 0x04, 0x07, 0x11, 0x02, 0x07, 0x02, 0x07, 0x32, 0x04, 0x81, 0x02, 0x0b, 0x05, 0x07, 0x05,
+    0x07, 0x04, 0x02, 0x3e, 0x05, 0x02, 0x04, 0x11, 0x12, 0x81, 0x02, 0x01, 0x04, 0x05, 0x81, 0x04,
+    0x81, 0x02, 0x02, 0x6a, 0xa2, 0x07, 0x81, 0x0c, 0x04, 0x02, 0x04, 0x05, 0x11, 0x04, 0x81, 0x02,
+    0x00, 0x04, 0x81, 0x05, 0x00, 0x40, 0x82, 0x04, 0x01, 0x29, 0x0c, 0x81, 0x11, 0x07, 0x9f, 0x3d,
+    0x05, 0x04, 0x2f, 0x04, 0x2f, 0x07, 0x81, 0x02, 0x03, 0x63, 0xa5, 0x24, 0x18, 0x81, 0x24, 0x06,
+    0x39, 0x18, 0x4c, 0x34, 0x22, 0x21, 0x5e, 0x87, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x82,
+    0x00, 0x00, 0x01, 0x84, 0x00, 0x83, 0x01, 0x81, 0x00, 0x86, 0x00, 0x81, 0x01, 0x85, 0x00, 0x00,
+    0x01, 0x87, 0x00, 0x81, 0x01, 0x05, 0x74, 0xff, 0x32, 0x2c, 0xfa, 0x78, 0x1c, 0x29, 0x81, 0xb5,
+    0x01, 0x3c, 0x6a, 0x81, 0x04, 0x01, 0x02, 0x0c, 0x81, 0x02, 0x0f, 0x04, 0x05, 0x04, 0x05, 0x04,
+    0x02, 0x04, 0x02, 0x05, 0x07, 0x0c, 0xff, 0x32, 0x6b, 0x28, 0x12, 0x07, 0x11, 0x81, 0x04, 0x0e,
+    0x0c, 0x05, 0x2e, 0x04, 0x12, 0x11, 0x02, 0x48, 0x05, 0x04, 0x02, 0x42, 0x02, 0x05, 0x0c, 0x81,
+    0x04, 0x82, 0x02, 0x0c, 0x05, 0x04, 0x05, 0x12, 0x04, 0x11, 0x12, 0x07, 0x02, 0x0c, 0x04, 0x07,
+    0x04, 0x81, 0x02, 0x01, 0x04, 0x11, 0x81, 0x04, 0x02, 0x02, 0x05, 0x23, 0x81, 0x04, 0x10, 0x7e,
+    0x02, 0x05, 0x3e, 0x3d, 0x1e, 0x9f, 0x05, 0x12, 0x04, 0x02, 0x42, 0x11, 0x05, 0x02, 0x76, 0x18,
+    0x81, 0x24, 0x08, 0x18, 0x2c, 0x24, 0x18, 0x5a, 0xff, 0x19, 0xa9, 0x2b, 0x2e, 0x45, 0x81, 0x01,
+    0x83, 0x00, 0x02, 0x01, 0x00, 0x01, 0x8b, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00,
+    0x00, 0x01, 0x81, 0x00, 0x83, 0x01, 0x86, 0x00, 0x02, 0x01, 0x00, 0x01, 0x82, 0x00, 0x86, 0x01,
+    0x09, 0x32, 0x18, 0x3c, 0x29, 0x1c, 0x2b, 0x1c, 0x35, 0x2b, 0x02, 0x81, 0x04, 0x00, 0x07, 0x81,
+    0x02, 0x0c, 0x2f, 0x07, 0x05, 0x07, 0x05, 0x48, 0x7e, 0x02, 0x12, 0x04, 0x07, 0x05, 0x32, 0x81,
+    0x04, 0x06, 0x02, 0x04, 0x07, 0x04, 0x05, 0x69, 0x02, 0x81, 0x04, 0x01, 0x02, 0x43, 0x81, 0x04,
+    0x07, 0x02, 0x04, 0x12, 0x05, 0x02, 0x05, 0xa2, 0x04, 0x81, 0x05, 0x05, 0x02, 0x0c, 0x2f, 0x12,
+    0x0c, 0x07, 0x81, 0x04, 0x82, 0x02, 0x06, 0x07, 0x0c, 0x11, 0x04, 0x2f, 0x02, 0x04, 0x81, 0x02,
+    0x81, 0x04, 0x0c, 0x05, 0x2f, 0x04, 0x89, 0x59, 0x1e, 0x3d, 0x22, 0x66, 0x23, 0x3e, 0x7e, 0x04,
+    0x81, 0x07, 0x82, 0x02, 0x03, 0x64, 0xa5, 0x2c, 0x24, 0x81, 0x4c, 0x07, 0xff, 0x32, 0x4d, 0x18,
+    0x4c, 0x22, 0x2b, 0x3c, 0x97, 0x00, 0x82, 0x01, 0x00, 0x00, 0x81, 0x01, 0x84, 0x00, 0x00, 0x01,
+    0x85, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x83, 0x00, 0x81, 0x00, 0x00, 0x01, 0x85, 0x00,
+    0x01, 0x01, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x00, 0x00, 0x81, 0x01, 0x00, 0x00, 0x82,
+    0x01, 0x03, 0x9e, 0x1c, 0x12, 0x35, 0x82, 0x1c, 0x10, 0x2b, 0x62, 0x05, 0x02, 0x04, 0x05, 0x02,
+    0x04, 0x07, 0x04, 0x05, 0x0c, 0x04, 0x02, 0x07, 0x04, 0x0c, 0x81, 0x02, 0x07, 0x04, 0x0c, 0x32,
+    0x02, 0x05, 0x04, 0x33, 0x11, 0x81, 0x02, 0x01, 0x32, 0xff, 0x29, 0xeb, 0x81, 0x11, 0x09, 0x02,
+    0x04, 0x0c, 0x04, 0x12, 0x04, 0x05, 0x02, 0x04, 0x07, 0x82, 0x04, 0x0a, 0x05, 0x07, 0x02, 0x0c,
+    0x02, 0x05, 0x04, 0x05, 0x07, 0x12, 0x07, 0x81, 0x02, 0x82, 0x04, 0x00, 0x6a, 0x84, 0x02, 0x0b,
+    0x04, 0x05, 0x6a, 0x22, 0x21, 0x22, 0x6a, 0xd3, 0x23, 0x28, 0x04, 0x05, 0x82, 0x04, 0x00, 0x11,
+    0x81, 0x02, 0x04, 0x04, 0x63, 0x2c, 0x18, 0x79, 0x81, 0x18, 0x00, 0x4c, 0x81, 0x18, 0x04, 0xb5,
+    0x2b, 0x21, 0xc6, 0x01, 0x81, 0x00, 0x84, 0x01, 0x01, 0x00, 0x01, 0x82, 0x00, 0x01, 0x01, 0x00,
+    0x82, 0x01, 0x82, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00,
+    0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x82, 0x01, 0x83, 0x00,
+    0x00, 0x01, 0x81, 0x00, 0x0c, 0x01, 0x17, 0xff, 0x08, 0x40, 0x43, 0x12, 0x41, 0x4b, 0x1c, 0x2b,
+    0x21, 0x4b, 0x04, 0x07, 0x81, 0x04, 0x02, 0x05, 0x0c, 0x02, 0x82, 0x04, 0x81, 0x02, 0x82, 0x04,
+    0x07, 0x07, 0x02, 0x49, 0x69, 0xa2, 0x0c, 0x04, 0x02, 0x81, 0x05, 0x03, 0x12, 0x07, 0x2e, 0x02,
+    0x82, 0x05, 0x04, 0x2f, 0x04, 0x3e, 0x07, 0x05, 0x81, 0x07, 0x03, 0x02, 0x05, 0x07, 0x0c, 0x81,
+    0x02, 0x04, 0x04, 0x05, 0x0c, 0x02, 0x0c, 0x82, 0x04, 0x03, 0x05, 0x04, 0x02, 0x04, 0x81, 0x02,
+    0x01, 0x04, 0x12, 0x81, 0x05, 0x1a, 0x04, 0x11, 0x07, 0x02, 0x04, 0x1e, 0xff, 0x29, 0xa9, 0xff,
+    0x08, 0xc3, 0x28, 0x22, 0x23, 0x4b, 0x1e, 0x02, 0x11, 0x02, 0x11, 0x05, 0x07, 0x02, 0x07, 0x05,
+    0x64, 0x2c, 0x18, 0x2c, 0x39, 0x81, 0x18, 0x08, 0x7f, 0x12, 0x28, 0x23, 0x21, 0x87, 0x01, 0x00,
+    0x01, 0x84, 0x00, 0x81, 0x01, 0x03, 0x00, 0x01, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x87, 0x00,
 };
-const tImage wink_close = { winkCloseCharacterImage, 160, 160,
-    16 };
 
+const PackedImage winkCloseImage = { 160, 160, winkCloseImagePalette, winkCloseImageRows, winkCloseImageData, 27582 };
+
+const CharacterPose winkClosePose = { &winkCloseImage, NULL, 0 };
+
+#endif
@@ -1,351 +1,1186 @@
-
 /*******************************************************************************
-* generated by lcd-image-converter rev.030b30d from 2019-03-17 01:38:34 +0500
-* image
-* filename: unsaved
-* name: wink_hot
-*
-* preset name: Arduino
-* data block size: 16 bit(s), uint16_t
-* RLE compression enabled: no
-* conversion type: Color, not_used not_used
-* split to rows: yes
-* bits per pixel: 16
-*
-* preprocess:
-*  main scan direction: top_to_bottom
-*  line scan direction: forward
-*  inverse: no
+* generated by tools/pack_character.py
+* source: image/wink_hot.bmp (160x160)
+* format: keyframe, palette + RLE, byte-swapped R5G6B5
 *******************************************************************************/
-
+#ifndef WINK_HOT_H
+#define WINK_HOT_H
 
 #include "../../include/image_types.h"
-#include <stdint.h>
 
+static const uint16_t winkHotImagePalette[255] PROGMEM = {
+    0x5af7, 0x0b2a, 0x2b2a, 0x49dd, 0x3af7, 0xf7fe, 0xc6ab, 0x743b, 0x7433, 0x8821, 0xe6ab, 0x6add,
+    0x0fe5, 0x6719, 0xd6fe, 0xa5a3, 0xb6fe, 0xea29, 0xa921, 0x943b, 0xd7fe, 0xf2fd, 0xc6a3, 0x4619,
+    0x95fe, 0x13fe, 0x6721, 0x4719, 0xc921, 0x54fe, 0x659b, 0x6821, 0x2619, 0x85a3, 0x33fe, 0x4add,
+    0x75fe, 0x2c2a, 0xca21, 0x69dd, 0x2fe5, 0x29d5, 0x0511, 0xa6a3, 0x4593, 0x8819, 0x2c22, 0xc5ab,
+    0x859b, 0x2493, 0xd2fd, 0x6819, 0xc5a3, 0x30f5, 0xa821, 0xa8c4, 0x2611, 0xe8cc, 0x4493, 0x34fe,
+    0x10f5, 0x39f7, 0x67bc, 0x0fdd, 0x06b4, 0x048b, 0xa028, 0x4d2a, 0x3aef, 0xe510, 0x09d5, 0x733b,
+    0xc8cc, 0xdeff, 0xea21, 0x74fe, 0x27b4, 0x8e2a, 0xaf2a, 0x8f2a, 0x258b, 0xa47a, 0x50e5, 0x18ff,
+    0xc8c4, 0x1133, 0x323b, 0x6d2a, 0x8472, 0xc47a, 0x19ef, 0xca29, 0x2c32, 0x533b, 0xe482, 0xf9e6,
+    0x0a2a, 0x47b4, 0x06ac, 0x4c2a, 0x436a, 0xc028, 0xa862, 0xc410, 0x87c4, 0x2362, 0x4621, 0x0519,
+    0x2519, 0x4ad5, 0x6b7b, 0xe9cc, 0x058b, 0x869b, 0x5aff, 0xe410, 0xd8e6, 0xc408, 0x88c4, 0x0362,
+    0x646a, 0x53b5, 0x8add, 0x12ad, 0x57d6, 0xd032, 0xe582, 0xd1a4, 0xeb5a, 0xb8de, 0xe351, 0x2421,
+    0xb543, 0x09cd, 0xaf32, 0x6593, 0x75f6, 0xd1fd, 0xd9e6, 0x16ce, 0x2a73, 0x33ad, 0x9443, 0xf032,
+    0xc9c4, 0x668b, 0x4d22, 0x26b4, 0x2d22, 0x47bc, 0x8721, 0x2593, 0xc482, 0x5bf7, 0x6f9c, 0x7bff,
+    0x8762, 0x1aef, 0xe451, 0xe9c4, 0xf9ee, 0x88bc, 0x77d6, 0x0611, 0xa349, 0x6e2a, 0x49d5, 0xeb21,
+    0xac83, 0x0583, 0xe259, 0x045a, 0xe96a, 0x8249, 0x0f84, 0x2b32, 0xb0a4, 0x675a, 0xa919, 0xb53b,
+    0x245a, 0x465a, 0xe359, 0x8241, 0xeedc, 0xced4, 0xc79b, 0xa76a, 0x8020, 0x0e8c, 0x6662, 0xb4bd,
+    0x4c32, 0xc929, 0xf2a4, 0xaa52, 0x36ce, 0x2c63, 0xe449, 0x73b5, 0x0321, 0xcf32, 0x035a, 0xa308,
+    0x0b22, 0x70e5, 0xf3ed, 0x6372, 0xebab, 0xa69b, 0x55e6, 0x39ff, 0x9cff, 0x07a4, 0xc86a, 0xb2dd,
+    0xed8b, 0x98de, 0xf5c5, 0x10ed, 0x8629, 0x4c6b, 0x6629, 0x083a, 0xd5c5, 0xc349, 0xa472, 0x846a,
+    0x8c7b, 0x9194, 0x4e94, 0x74b5, 0x97de, 0xf1a4, 0x2acd, 0x953b, 0xe7ab, 0xf132, 0x2e94, 0xb5bd,
+    0x523b, 0xeb29, 0x0452, 0x3233, 0x07b4, 0xc351, 0x8919, 0x6472, 0xaaa3, 0x76ee, 0x248b, 0x6693,
+    0x0a6b, 0x8693, 0xf8fe,
+};
 
+static const uint32_t winkHotImageRows[160] PROGMEM = {
+    0, 4, 8, 24, 70, 108, 153, 196, 254, 306, 366, 434,
+    512, 603, 680, 768, 843, 937, 1018, 1105, 1194, 1297, 1397, 1499,
+    1586, 1681, 1763, 1847, 1942, 2052, 2141, 2251, 2363, 2474, 2584, 2699,
+    2800, 2906, 3021, 3154, 3283, 3414, 3539, 3660, 3779, 3904, 4028, 4168,
+    4310, 4454, 4637, 4817, 4976, 5119, 5273, 5428, 5610, 5797, 5941, 6089,
+    6224, 6370, 6525, 6677, 6828, 6991, 7148, 7310, 7484, 7651, 7804, 7985,
+    8129, 8280, 8424, 8571, 8708, 8837, 8973, 9110, 9249, 9379, 9503, 9629,
+    9747, 9846, 9933, 10030, 10145, 10250, 10379, 10529, 10693, 10842, 10977, 11105,
+    11248, 11424, 11589, 11723, 11866, 11990, 12118, 12249, 12357, 12479, 12614, 12762,
+    12894, 13024, 13162, 13297, 13412, 13522, 13633, 13753, 13849, 13946, 14039, 14148,
+    14256, 14355, 14460, 14572, 14683, 14792, 14895, 14996, 15090, 15188, 15291, 15370,
+    15454, 15516, 15583, 15677, 15757, 15855, 15948, 16045, 16159, 16247, 16369, 16483,
+    16580, 16696, 16796, 16904, 17003, 17091, 17186, 17270, 17358, 17440, 17521, 17605,
+    17681, 17771, 17857, 17926,
+};
 
-const uint16_t winkHotCharacterImage[25600] PROGMEM = {
-    // ████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████████
-    // ███████████████████████████████████████████████████████████████████▓▒▒░∙∙∙∙∙∙∙∙∙░░▒▓▓███████████████████████████████████████████████████████████████████████████
-    // ███████████████████████████████████████████████████████████████▓▒∙∙∙░░░░░░░░░░░░░░░∙∙∙░▒▓███████████████████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████████████▓░∙∙░░░░░░░░░░░░░░░░░░░░░░░░∙∙░▒████████████████████████████████████████████████████████████████████
-    // █████████████████████████████████████████████████████████▓▒∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙░▓█████████████████████████████████████████████████████████████████
-    // ███████████████████████████████████████████████████████▓░∙░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙▒███████████████████████████████████████████████████████████████
-    // █████████████████████████████████████████████████████▓░∙░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙▒█████████████████████████████████████████████████████████████
-    // ████████████████████████████████████████████████████░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙▒███████████████████████████████████████████████████████████
-    // ██████████████████████████████████████████████████▓∙░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░▓█████████████████████████████████████████████████████████
-    // █████████████████████████████████████████████████░∙░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░████████▓▒░░░░▒▒████████████████████████████████████████
-    // ███████████████████████████████████████████████▓∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙▓████▓░░▒▓▓▓▓▓▒░▒██████████████████████████████████████
-    // ██████████████████████████████████████████████▓∙░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░██░░▓▓▓▓▓▓▓▓▓▓▒░▓████████████████████████████████████
-    // █████████████████████████████████████████████▒∙░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░▒▓▓▓▓▓▓▓▓▓▓▓▓▓░▒███████████████████████████████████
-    // ████████████████████████████████████████████▒∙░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓░▒██████████████████████████████████
-    // ███████████████████████████████████████████▒∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░∙▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓░▒█████████████████████████████████
-    // ██████████████████████████████████████████▓∙∙░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙▒▓▓▒▒▒▒▒▓▓▓▓▓▓▓░▓████████████████████████████████
-    // ██████████████████████████████████████████∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░∙▓▓▓▓▓▓▓▒▒▓▓▓▓▓▓░████████████████████████████████
-    // █████████████████████████████████████████░∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░∙▓▓▓▓▓▓▓▓▒▒▓▓▓▓▒░███████████████████████████████
-    // ████████████████████████████████████████▒∙∙∙░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░▓▓▓▓▓▓▓▓▓▒▓▓▓▓░▓██████████████████████████████
-    // ███████████████████████████████████████▓∙∙∙∙░░░░░∙∙∙∙░░░▒▒▒▒▒▒▒▒▒▒░░░░∙∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙▒▓▓▓▓▓▓▓▓▓▒▓▓▓▓░██████████████████████████████
-    // ███████████████████████████████████████░∙∙∙░░░∙∙∙░░▒░░░░░░░░░░░░░░░░░░░▒░░░∙∙░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░∙▒▓▓▓▓▓▓▓▓▓▓▓▓▓▒▒█████████████████████████████
-    // ██████████████████████████████████████▓∙∙∙∙░∙∙░▒░░░░░░░░░░░░░░░░░░░░░░░░░░░▒░░∙∙░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░▒▒▓▓▓▓▓▓▓▓▓▓▓▓░█████████████████████████████
-    // ██████████████████████████████████████∙∙∙∙∙∙░▒░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░▒░░∙∙░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░∙▒▒▒▓▓▓▓▓▓▓▒▓▓▓▒▓████████████████████████████
-    // █████████████████████████████████████▒∙∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░▒░░∙░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░▒▒▒▓▓▓▓▓▓▓▒▓▓▓░████████████████████████████
-    // █████████████████████████████████████∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░∙▓▒▒▓▓▓▓▓▓▓▓▓▓▓░▓███████████████████████████
-    // ████████████████████████████████████▒∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░▒░∙░░░░░░░░░░░░░∙░░░░░░░░░░░░░∙▒▓▒▒▓▓▓▓▓▓▓▓▓▓▒▒███████████████████████████
-    // ████████████████████████████████████∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░▒░∙░░░░░░░░░░░∙░░░░░░░░░░░░░∙░▓▓▒▒▓▓▓▓▓▓▓▓▓▓░███████████████████████████
-    // ███████████████████████████████████▒░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░∙░░░░░░░░░░░░░∙∙▒▓▓▒▓▓▓▓▓▓▓▓▓▓░███████████████████████████
-    // ██████████████████████████████████▓∙░░░░░░░░░▒▒░░░░░∙∙∙∙∙∙∙∙░░░░░▒▒░░░░░░░░░░░░░░░░░░░▒░░░░░░∙∙░░░░░░░∙░░░░░░░░░░░░░∙∙░▓▓▓▒▓▓▓▓▓▓▓▓▓▒▓██████████████████████████
-    // ██████████████████████████████████░░░░░░░▒░░░∙∙∙∙░░░░░░░░░░░░░░∙∙∙∙░░░▒▒░░░░░░░░░░░░░░▒▒░░░░░░░∙░░░░░░∙░░░░░░░░░░░░░∙∙░▓▓▓▓▒▓▓▓▓▓▓▓▓▒▒██████████████████████████
-    // █████████████████████████████████▓∙░░░░░░∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙∙░░▒░░░░░░░░░░░▒▒▒░░░░░░░░∙░░░░∙░░░░░░░░░░░░░∙∙∙▒▓▓▓▒▓▓▓▓▓▓▓▓▓░██████████████████████████
-    // █████████████████████████████████░░░░∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙░░▒░░░░░░░░▓▓░░░░░░░░░░∙░░░∙░░░░░░░░░░░░░∙∙∙▒▓▓▓▓▓▓▓▓▓▓▓▓▓░██████████████████████████
-    // █████████████████████████████████∙∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙░░▒░░░░░▒▓░░░░░░░░░░░∙░░∙░░░░░░░░░░░░░∙∙∙▒▒▓▓▓▓▓▓▓▓▓▓▓▓░▓█████████████████████████
-    // ███████████████████████████████▒░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙░▒░░░░░░░░░░░░░░░░▒░∙░░░░░░░░░░░░░░∙∙∙░▒▓▓▓▓▓▓▓▓▓▓▓▒▒▒█████████████████████████
-    // ████████████████████████████▓░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░∙∙∙░▒▓▓▓▓▓▓▓▓▓▓▓▒▓▒█████████████████████████
-    // ██████████████████████████▒∙∙░░░░▒▒░░░░░░▒▒▒░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░∙░∙░░░░░░░░░░░∙∙∙∙░▒▒▓▓▓▓▓▓▓▓▓▓▓▓░█████████████████████████
-    // ████████████████████████▒∙░░▒▒░░░░░░░░░░░░░░░░░░░▒░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░▒░░░░░░░░░░░░░░∙░░░░░░░░░░∙∙∙∙░▒▒▓▓▓▓▓▓▓▓▓▓▓▒░█████████████████████████
-    // ██████████████████████▒∙░▒░░▒▒▒░░░░∙∙∙∙∙∙∙∙░░░░▒░░░░░▒░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░∙░░░░∙░░░░░░░░░∙∙∙∙∙▒▒▓▓▓▓▓▓▓▓▓▓▓▒░▓████████████████████████
-    // ████████████████████▓░░▒▒▒░░∙∙∙∙∙░▒▒▒▒▒▒▒▒▒▒░░░░░░░░░░░░▒░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░▒░░░░░░░∙░░░░░∙∙░░░░░░░∙∙∙∙∙▒▒▒▓▓▓▓▓▓▓▓▓▓▓▒▓████████████████████████
-    // ███████████████████▒∙░░░░∙∙∙∙∙∙∙░▒▒▒▒▒▒▒▒▒▒▒░▓▓▓▓▒░░░▒░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░▒░░░░∙░░░░░░░∙░░░░░░∙∙∙∙∙∙▒▒▒▓▓▓▓▓▓▓▓▓▓▓▒▒████████████████████████
-    // ██████████████████▒∙░░∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒░▒▓▓▓▓▓▓▒░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙░░░░░░░░░░░░░∙░░░░░∙∙∙∙∙∙▒▒▒▓▓▓▓▓▓▓▓▓▓▓▒▒████████████████████████
-    // █████████████████▒∙░∙∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒░▓▓▓▓▓▓▓▒▒▒▒░∙░▒░░░░▒░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░∙░░░░░░░░░░░░░∙░░░∙∙∙∙∙∙∙▒▒▒▒▓▓▓▓▓▓▓▓▓▓▒░████████████████████████
-    // ████████████████▓∙░∙∙∙∙∙∙∙∙∙∙∙░▒▒▒▒▒▒▒▒▒▒▒░▓▓▓▓▓▓▓▓▒▒▒▒▒▒░∙░▒░░░░▒░░░░░░░░░░░░░░░░░░░░░░░∙∙░▒░░▒░∙░░░░░░░░░░░░∙░░∙∙∙∙∙∙░▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓░████████████████████████
-    // ████████████████∙░∙∙∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▒▒▒▒▒▒▒▒░∙░▒░░░░▒░░░░░░░░░░░░░░░░░░∙∙░░▒░░░░░░░∙░░░░░░░░░░░░∙░∙∙∙∙∙∙░▒▒▒▒▓▓▓▓▓▒▓▓▓▓▓░████████████████████████
-    // ███████████████▒∙∙∙∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒░▓▓▓▓▓▓▓▓▓▒▒▒▒▒▒▒▒▒▒░∙░▒░░░░░▒░░░∙∙░░░░░░∙∙░░░▒░░░░░░░░░▒▒░∙░░░░░░░░░░░∙∙∙∙∙∙∙░▒▒▒▒▒▓▓▓▓▒▓▓▓▓▓░████████████████████████
-    // ███████████████░∙∙∙∙∙∙∙∙∙∙∙∙░▒▒▒▒▒▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▒▒▒▒▒▒▒▒▒▒▒▒░∙░░░░░░░░░▒░░░░░░░░▒░░░░░░░░░∙░▒▒▒▒▒░∙░░░░░░░░░░∙∙∙∙∙∙∙░▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓░▓███████████████████████
-    // ███████████████░∙∙∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▓▒▒▒▒░▓▓▓▓▓▓█▓▓▓▒░▒▒▒▒▒▒▒▒▒▒▒▒░∙∙░░▒░░░░░░░░░░░░░░░░▒░░∙░░▒▒▒▒▒▒▒▒▒∙░░░░░░░░∙∙∙∙∙∙∙∙▒▒▒▒▒▒▓▓▓▓▓▒▓▓▓▓▒▓███████████████████████
-    // ███████████████▒∙∙∙∙∙∙∙∙∙∙∙░▒▒▒▒▒▒█▓▒▒▒▒░▓▓▓▓▓██▓▓▓▓░▒▒▒▒▒▒▒▒▒▒▒▒▒░▒▒░∙░░░▒▒▒░░░░▒▒▒░░░∙∙░▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙░░░░░░∙∙∙∙∙∙∙∙▒▒▒▒▒▒▓▓▓▓▓▒▓▓▓▓▒▒███████████████████████
-    // ████████████████░∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒░▒▓▓▓▓▓▓▓▓▓▓▓░▒▒▒▒▒▒▒▒▒▒▒▒▒░▓▓▓▓▒▒░░░∙∙∙∙∙∙∙░░▒▒▓▒░▒▒▒▒▒▒▒▒▒▓▓▓▒▒░∙░░░░∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▓▓▓▓▓▓▒▓▓▓▒▒███████████████████████
-    // █████████████████░∙∙∙∙∙∙∙∙░▒▒▒▒▒▒▒▒▒▒▒▒░▓▓▓▓▓▓▓▓▓▓▓▓░▒▒▒░▒▒▒▒▒▒▒▒▒░▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓░▒▒▒▒▒▒▒▒▒▓▓▓▒▒▒░∙░░░∙∙∙∙∙∙∙∙∙▒▒▒▒▒▓▒▓▓▓▓▓▒▓▓▓▓░███████████████████████
-    // ██████████████████▓∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▒▒░▒░▒▒▒▒▒▒▒▒▒░▓▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓░▒▒▒▒▒▒▓▓▓▓▓▓▒▒▒░∙░∙∙∙∙∙∙∙∙∙░▒▒▒▒▒▓▒▓▓▓▓▓▒▓▓▓▓░███████████████████████
-    // ████████████████████▓░∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒░▒▓▓▓▓▓▓▓▓▓▓▓▓▒░░▒░▒▒▒▒▒▒▒▒▒▒▓▓▒▒░▒▓▓▓▓▓▓▓▓▓▓▓▓██▓▓▓▒▒▒▒▒▒▒▓▓▓▓▓▓▓▒▒░░∙∙∙∙∙∙∙∙∙∙░▒▒▒▒▒▓▒▓▓▓▓▓▓▒▓▓▓░███████████████████████
-    // █████████████████████████░▒▒▒░▒▒▒▒▒▒▒▒░▓▓▓▓▓▓▓▓▓▓▒▒░░░▒▒▒▒▒▒▒▒▒▒▒▒▒▓▓▒▓▒░░░▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓░▒▒▒▓▒▓▓▓█▓▓▓▒▒░▒░∙∙∙∙∙∙∙∙∙░▒▒▒▒▒▓▓▓▓▓▓▓▓▒▓▓▓░███████████████████████
-    // ████████████████████████▓░▒▒░░░▒▒▒▒▒▒▒░▓▒▒▒▒▒▒▒░░░░░░░▓▓░▓▒▒▒▒▒▒▒░▓▓▓▓▒▓▓░░░░░░▒▒▒▒▓▓▓▓▓▓▓▓▒▒▓▓▓▒▓▓▓▓▓▓▓▓▒░▒▒░∙∙∙∙∙∙∙∙░▒▒▒▒▒▓▓▓▓▓▓▓▓▒▓▓▓▒▓██████████████████████
-    // ████████████████████████▒▒▒▒░▒▒▒▒▒▒▒▒▒░▓▓▒▒░░░░░░░░▒▓▓▒▓▒▓▓▓▓▒▒▒▒░▓▓▓▓▓▓▓▓▓▒░░░░░░░░░░▒▓▓▓▓▓░▓▓▓▒▓▓▓▓▓▓▓▓▒░▒▒▒░∙∙∙∙∙∙∙▒▒▒▒▒▒▓▓▓▓▓▓▓▓▒▒▓▓▒▒██████████████████████
-    // ████████████████████████░▒▒▒∙▒▒▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓███▒▓▓▒▓▓▓▓▓▓▒░▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓█████▓▒▓▓▒▓▓▓▓▓▓▓▓▒░▒▒▒░∙∙∙∙∙∙∙▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▒▓▓▒▒██████████████████████
-    // ████████████████████████░▒▒░░▒▒▒▒▒▒▒▒░▒▓▓▓▓▓▓▓▓▓▓█████▓▒▓░▓▓▓▓▓▓▓░▓▓▓▓▓▓▓▓▓▓▓▓▓▓█████████████▒▓▓▒▓▓▓▓▓▓▓▓░▒▒▒▒▒▒∙∙∙∙∙░▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▒▓▓▓░██████████████████████
-    // ████████████████████████░▒▒░▒▒▒▒▒▒▒▒▒░▓▓▓▓▓▓▓▓█████████▒▓▒▓▓▓▓▓▓▓░████████████████████████████░▓▒▓▓▓▓▓▓▓▓░▒▒▒░▒▒░∙∙∙∙░▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▒▒▓▓░██████████████████████
-    // ████████████████████████░▒▒░▒▒▒▒▒▒▒▒▒░▓▓▓▓██████████████▒▒░▓▓▓██▓░████████████████████████████▒▓▒▓▓▓▓▓▓▓▓░▒▒░∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▒▓▓░██████████████████████
-    // ████████████████████████░▒▒▒▓░▒▒▒▒▒▒▒░█████████▓▓▓▒▓▓███▓▒░▒▓▒▓▓▓░█████████████████████████████▒▒▓▓▓▓▓▓▓▓░░∙∙░░░∙∙∙∙░▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▒▒▓▒▓█████████████████████
-    // ████████████████████████░▒▒▓▓░▒▓▓▓▓▓▒░█████▓▒▒▒▓████▒▓███▒▒░▓▓▓▓▓▒███████████████████████▓█████▒░▓▓▓▓▓▓▓▓∙∙░░░░░░░∙∙░▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▒▓▒▒█████████████████████
-    // ████████████████████████░▒▒▓█░▒▓▓▓▓▓▒░████▒∙∙∙∙∙∙░▓██▓████░▓░▓▓▓▓▒█████████████████████████████▓░▓▓▓▓▓▓▓▒∙░░░░░░∙∙∙∙▒▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▒▒▓░█████████████████████
-    // ████████████████████████▒▒░▓█░▒▓▓▓▓▓▒░▓█▓▒∙∙∙░░░∙∙∙∙▒██████▒▓░▓▓▓▒████████▓▒▒▒▒▒▓▓██████████████░▓▓▓▓▓▓▓░░░░░░∙░▒░∙∙▒▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▒▒▓░█████████████████████
-    // ████████████████████████▓▒░▓█▒▒▒▓▓▓▓▒░▓██░∙▒█▓▓▓∙∙∙∙∙░▓█████▓▓░▓▓▓▓██████▓▓█████████████████████░▓▓▒█▓▓▓∙░░░░∙░░░░░∙▒▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▒▒░█████████████████████
-    // █████████████████████████░░▓█▓░▒▓▓▓▓▒▒▒█▓∙░█▓▓▓▒∙∙∙▓░∙░████████▒▒▓▓█████████████████████████████░▓▓▓▓█▓░░░░░∙░░░░▒░░▒▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▒▒▒▓████████████████████
-    // █████████████████████████░▒▓██░▒▓▓▓▓▒▓░▓░∙▒████░∙∙░██∙░▓████████▓▒▒██▓███████▓▒░░░░░▒▒▓████████▓▒▓▓▓▓▓▓∙░░░∙░░░░░▒░░░▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▒▒▒▒████████████████████
-    // █████████████████████████▓░▒██▒░▓▓▓▓▒▓∙▓█∙▒████▒∙∙∙█▓∙▒▓██████████████████▓░∙∙∙∙∙∙∙∙∙∙∙∙∙▒▓▓███▓▒▓▓▓▓▓░░░░░░░░░░∙░░░░▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▒▒░████████████████████
-    // ██████████████████████████░▒███░▓▓▓▓▓▒░▓█░▒████▒∙∙∙∙∙∙▒██████████████████▓░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░████▒▓▓▓▓▓▒∙░░░∙▒░░░░░∙░░░▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▒▒░████████████████████
-    // ██████████████████████████▓░███▒▒▓▓▓▓▒▒▒█▓▒████▓░░∙∙∙░▒██████████████████▓░░▒▓▓████▓▓▒░∙∙∙∙░▓██▒▓▓▓▓▓░░░░∙░░░░░░░∙░░∙▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▒░▓███████████████████
-    // ███████████████████████████░████░▓▓▓▓▓▒░██▒█████░▒∙∙░▒▒██████████████████▓▓█████████████▓▒▓████░▓▓▓▓▒░░░░∙▒▒░∙░░░∙∙░∙▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▒▒▒███████████████████
-    // ████████████████████████████▓███▓▒▓▓▓▓░░▓█▓▓████░▒▒░▒▒▒████████████████████████████████████████░▓▓▓▒∙░░░░░░░░░░░░∙░░∙▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒░███████████████████
-    // █████████████████████████████████░▒▓▓▓▒▒▒███████▓▒▒▒▒▒▓██████▓███████████████▓██▓▓█▓██████████▓▒▓▓▓∙░░░░∙▒░░∙░░░░∙░░∙░▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒░▓██████████████████
-    // ██████████████████████████████████░▓▓▓▒▒░███████▓░▒▒▒▒█████▓▓▓███████▓███▓█▓▓▓▓▓▓▓▓▓▓▓▓███████▒▓▓▓░∙░░░░░░░░░░░░∙∙░░░░▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓░▒██████████████████
-    // ██████████████████████████████████▓░▓▓▓░░▓█████▓▓▓▓▓▓▓████████████▓█▓▓█▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓████████▒▓▒░▒∙░░░░░░░░░░░∙∙∙░░▒░▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒░██████████████████
-    // ███████████████████████████████████▓░▓▓░░▓████▓▓▓▓█▓▓█▓██████████▓█▓▓▓▓▓█▓▓▓▓▓▓▓▓▓▓▓▓▓▓███████▒▒▒▓░░░░░∙▒░▒∙░░░∙∙░░∙▓░▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▒▓▓▓▓▓▓▓░▓█████████████████
-    // ████████████████████████████████████▒░▒▒░▒███▓▓▓▓█▓▓▓▓▓█████████▓██▓█▓▓█▓▓█▓██▓▓█▓▓██▓███████▓▒▒▓▓░░░░░∙▒░░∙░∙∙∙∙░░░█░▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▒▓▓▓▓▓▓▓▒▒█████████████████
-    // ████████████████████████████████████░▒░░░░██▓█▓▓█▓▓▓▓▓██▓█████████████████▓██████▓██▓████████▓▓██▓∙░░░░░░░░∙∙∙∙∙∙░∙▓█░▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▒▓▓▓▒▓▓▓∙█████████████████
-    // ████████████████████████████████████░▒▒▒░░██████▓██▓██████████████████████████████████████████████∙░░░░░░░░∙∙∙∙∙░░∙██░▒▒▒▒▒▒▒▓▓▓▓▒▓▓▓▓▒▓▓▓▓▒▓▓▒▒████████████████
-    // ████████████████████████████████████░▒▒▒▒░██████████████▓▓████████████████████████████████████████∙░░░░░░░∙∙∙∙∙░░░▒██░▒▒▒▒▒▒▒▓▓▓▓▒▓▓▓▓▒▒▓▓▓▒▓▓▓░████████████████
-    // ████████████████████████████████████░▒▒▒▒░█▓█▓██████████▓▒████████████████████████████████████████∙░░░░░░░░∙∙∙∙░░░███░▒▒▒▒▒▒▒▓▓▓▓▒▓▓▓▓▒▒▓▓▓▓▒▓▓▒▓███████████████
-    // ████████████████████████████████████░▒▒▒▒░█▓████████████▓▒████████████████████████████████████████░∙∙∙∙∙░░░∙∙░░░∙▓███░▒▒▒▒▒▒▒▓▓▓▓▒▓▓▓▓▒▒▓▓▓▓▒▓▓▓░███████████████
-    // ████████████████████████████████████░▒▒▒▒░█▓▓████████████▓▓██████████████████████████████▓████████▒∙∙∙∙∙░░░░░░░∙▒████░▒▒▒▒▒▒▒▓▓▓▓▒▓▓▓▓▓▒▒▓▓▓▒▓▓▓░▓██████████████
-    // ████████████████████████████████████░▒▒▒▒░███████████████████████████████████████████████▓▓███▓███▓∙∙∙∙∙∙░░░░░∙░█████░▒▒▒▒▒▒▒▓▓▓▓▒▓▓▓▓▓▒▒▓▓▓▓░▓▓▓▒██████████████
-    // ███████████████████████████████████▓░▒▒▒▒░▓███████████████████████████████████████████████████████▓∙∙∙∙∙∙░░░░∙░██████░▒▒▒▒▒▒▒▓▓▓▓▒▒▓▓▓▓▒▒▒▓▓▓░▓▓▓░▓█████████████
-    // ███████████████████████████████████▓▒▒▒▒▒░▓██████████████████████████████████████████████████████▓∙░∙∙∙∙∙∙∙∙∙░███████░▒▒▒▒▒▒▒▓▓▓▓▒▒▓▓▓▓▒▒▒▓▓▓▒░▓▓▓▒█████████████
-    // ███████████████████████████████████▓▒▒▒▒▒░▓█████████████████████████████████████████████████████▓░∙░∙∙∙∙∙∙∙∙▒████████░▒▒▒▒▒▒▓▓▓▓▓▒▒▓▓▓▓▒▒▒▓▓▓▒∙▓▓▓░█████████████
-    // ███████████████████████████████████▓▒▒▒▒▒∙▒█████████████████████████████████████████████████████░∙░░∙∙∙∙∙∙░▓█████████░▒▒▒▒▒▒▓▓▓▓▒▒▒▓▓▓▓▒▒▒▓▓▓▓░░▓▓▒▒████████████
-    // ███████████████████████████████████▓▒▓▒▒▒▒░█████████████████████████████▓▒░∙░▓█████████████████░░░░∙░█▓▒▓████████████░▒▒▒▒▒▒▓▓▓▓▒▒▒▓▓▓▓▒▒▒▒▓▓▓░░▓▓▓░████████████
-    // ███████████████████████████████████▒▒▓▒▒▒▒░█████████████▓███████████▓▓▒▒▒▓▓▒░░▓██████████████▓∙░░░∙░█████████████████▒▒▒▒▒▒▒▓▓▓▓▒▒▒▓▓▓▓▒▒▒▒▓▓▓░▓▒▓▓▒▓███████████
-    // ███████████████████████████████████▒▒▓▓▒░▓▒▓████████████∙░░▒▓▓▓▓▓▒▒▒▓▓▓▓▓▓▓▓▓░▒█████████████▓∙░░░∙░██████████████████░▒▒▒▒▒▒▓▓▓▓▒▒▒▓▓▓▓▒▒▒▒▓▓▓▒▓░▓▓▓░███████████
-    // ███████████████████████████████████▒▒▓▓▒░██░████████████░░▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓░████████▓███▒∙░░░∙▒███████████████████░▒▒▒▒▒▒▓▓▓▓▒▒▒▓▓▓▓▒▒▒▒▓▓▓▒▒▓▒▓▓░███████████
-    // ███████████████████████████████████▒▒▓▓▒░██░▓███████████░▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓░█████████▓▓░░░░░∙▒████████████████████░▒▒▒▒▒▓▓▓▓▒▒▒▒▓▓▓▓▒▒▒▒▒▓▓▓▒█░▓▓▒▓██████████
-    // ███████████████████████████████████▒▒▓▓▓░██▓░███████████▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓░█████████▒∙░░░░∙▒░████████████████████░▒▒▒▒▒▓▓▓▓▒▒▒▒▓▓▓▒▒▒▒▒▒▓▓▓░█▒▓▓▓▒██████████
-    // ███████████████████████████████████▓▒▓▓▓░███▒▓██████████▓▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒▓███████▓░░░░░∙∙▒▒░▓███████████████████░▒▒▒▒▒▓▓▓▓▒▒▒▒▓▓▓▒▒▒▒▒▒▓▓▓░█▓▒▓▓░██████████
-    // ███████████████████████████████████▓▒▓▓▓░████░███████████▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒░███████░∙░░░░∙∙░▒▒▒░███████████████████░▒▒▒▒▓▓▓▓▒▒▒▒▒▓▓▓▒▒▒▒▒░▓▓▓░██░▓▓░██████████
-    // ███████████████████████████████████▓▒▓▓▓░████▓░███████████▒▒▒▓████████▓▒░░░░▒███████∙░░░░∙∙▒░▓░▒▒▒░▓█████████████████░▒▒▒▒▓▓▓▓▒▒▒▒▓▓▓▓▒▒▒▒▒░▓▓▓░██▒▓▓▒▓█████████
-    // ████████████████████████████████████▒▓▓▓░█████▓░███████████████████████████████████▒░░░░∙░▓▓░██▒░░░░░▒▓█████████████▓░▒▒▒▒▓▓▓▒▒▒▒▒▓▓▓▒▒▒▒▒▒░▓▓▓░██▓▒▓▒▓█████████
-    // ████████████████████████████████████░▓▓▓░██████▓░██████████████████████████████████░░░∙∙▒▓▓▓░████▓▓▒▓███████████████▓░▒▒▒▓▓▓▓▒▒▒▒▒▓▓▓▒▒▒▒▒▒░▓▓▓░███░▓▒▒█████████
-    // ████████████████████████████████████░▓▓▓░███████▓░▓██████████████▓█▓███████████████▒∙∙░▓▓▓▓▓▒███████████████████████▒▒▒▒▒▓▓▓▒▒▒▒▒▒▓▓▓▒▒▒▒▒▒░▒▓▓░███▒▓▓▒█████████
-    // ████████████████████████████████████▒▓▓▓░█████████▒▒████████████████▓██████████▓███▓░▒▓▓▓▓▓▒▒███████████████████████░▒▒▒▓▓▓▓▒▒▒▒▒▒▓▓▒▒▒▒▒▒▒░▒▓▓░███▓▒▓▒█████████
-    // ████████████████████████████████████▓▒▓▓▒▓█████████▓░▓██████████████████████████▓█▒░▒▓▓▓▓▓▓▒∙░▒▓████████████████████░▒▒▒▓▓▓▒▒▒▒▒▒▒▓▓▒▒▒▒▒▒░░▒▓▓░████▒▓▒█████████
-    // █████████████████████████████████████░▓▓▒▓██████████▓░▓██████████████████████████▒░▓▓▓▓▓▓▓▓▒∙∙∙∙░██████████████████▓░▒▒▓▓▓▓▒▒▒▒▒▒▓▓▓▒▒▒▒▒▒░░▒▓▓░████░▓▒█████████
-    // █████████████████████████████████████░▓▓▒▒███████████▒▓▓███████████████████████▓▓▓▓▓▓▓▓▓▓▓▓▒∙∙∙∙∙▒█████████████████▒░▒▒▓▓▓▒▒▒▒▒▒▒▓▓▒▒▒▒▒▒▒░░▒▓▒░████∙▒▒█████████
-    // █████████████████████████████████████▒▒▓▓▒███████████▓█▓░▓███████████████████▓░▓█▓▓▓▓▓▓▓▓▓▓▒∙∙∙∙∙░█████████████████░▒▒▓▓▓▒▒▒▒░▒▒▒▓▒▒▒▒▒▒▒▒▒░▒▓▒░███▓∙▒▒█████████
-    // ██████████████████████████████████████░▓▓░███████████▓▓▓▒░▓████████████████▓░░▒██▒▓▓▓▓▓▓▓▓▓▒∙∙∙∙∙░█████████████████░▒▒▓▓▓▒▒▒▒▒▒▒▒▓▒▒▒▒▒▒▒░▓░▒▓▒▒███▓░▒▒█████████
-    // ██████████████████████████████████████▒▒▓░████████████▒▒▒█▒▒█████████████▓░░░▓▓▒▒▓▓▓▓▓▓▓▓▓░∙░∙∙∙∙░████████████████▒░▒▓▓▓▒▒▒▒░▒▒▒▒▒▒▒▒▒▒▒▒░▓░▒▒░▓███▒░░▓█████████
-    // ███████████████████████████████████████░▓▒▓████████████████▒░██████████▒░░░▒▓▓▓▓▓▓▓▓▓▓▓▓░∙░░░∙∙∙∙░████████████████░▒▓▓▓▒▒▒▒░▒▒▒▒▓▒▒▒▒▒▒▒▒░▓░▒▒░████░░░▓█████████
-    // ███████████████████████████████████████▓░▓░█████████████████▓░▓█████▓▒░░░▒▓▓▓▓▓▓▓▓▓▓▓▓░∙░░░░░∙∙∙∙░███████████████▒░▒▓▓▒▒▒▒░░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓░▒▒░████░░░██████████
-    // ████████████████████████████████████████▓▒░█████████████████▒∙∙░▒▒▒░░░░░▒▓▓▓▓▓▓▓▓▓▓▒░∙∙░░░░░░░∙∙∙░███████████████░▒▓▒▒▒▒▒▒∙▒▒▒▒▒▒▒▒▒▒▒▒▒░█▒▒▒▒▒███▓░░░██████████
-    // █████████████████████████████████████████▒░▒███████████████▓∙∙∙∙∙∙∙░░░░▒▓▓▓▓▓▓▓▓▓▒∙∙░░░░░░░░░░∙∙∙░██████████████░▒▓▒▒▒▒▒▒∙░▒▒▒▒▒▒▒▒▒▒▒▒▒░█░▒▒░▓███░▒░▒██████████
-    // ██████████████████████████████████████████▓∙▓██████████████░∙∙∙∙∙∙∙∙░▒▓▓▓▓▓▓▓▓▒░∙∙∙░░░░░░░░░░░∙∙∙░█████████████░▒▒▒▒▒▒▒░░░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓░▒▒░████░▒░███████████
-    // ████████████████████████████████████████████▒██████████████∙∙∙∙∙∙∙∙∙▓▓▓▓▓▓▒░░∙∙∙∙░░░░░░░░░░░░░∙∙∙∙███████████▓░▒▒▒▒▒▒▒░▒▓░▒▒▒▒▒▒▒▒▒▒▒▒▒░▓▒▒▒▒░███▒▒▒░███████████
-    // ███████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙▒▒▒░░∙∙∙∙∙∙░░░░░░░░░░░░░░░∙∙∙∙▓████████▓▒░▒▒▒▒▒▒░░▓█░▒▒▒▒▒▒▒▒▒▒▒▒▒▒░█░▒▒░▓██▓░▒░▓███████████
-    // ███████████████████████████████████████████████████████████∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░∙∙∙∙∙▒████▒░░░▒▒▒▒▒▒░░▒██▓░▒▒▒▒▒▒▒▒▒▒░▒▒▒▒▓░▒▒░███░▒▒░████████████
-    // ███████████████████████████████████████████████████████████░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░∙∙∙░░░▒████▓░░░░░░░░▒████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓░▒▒░▒██▒▒▒░▓████████████
-    // ███████████████████████████████████████████████████████████░∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░∙∙∙░░░∙▒▓██████▓▓████████░▒▒▒▒▒▒▒▒▒▒▒▒▒▒░▓░▒▒░██▒▒▒▒░█████████████
-    // ███████████████████████████████████████████████████████████░∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░░░∙∙░░░░░░∙░▒█████████████▓░▒▒▒▒▒▒▒▒▒▒▒▒▒▒░░▒▒▒▒█░▒▒▒░██████████████
-    // █████████████████████████████████████████████████████████▒∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░▒▓█████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░░▒▒░▓░▒▒▒░▓██████████████
-    // ██████████████████████████████████████████████████████▓░∙░░∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░▒░░▒░░∙░▒██████░▒▒▒▒▒▒▒▒▒░▒▒▒▒▒░▒▒░░░▒▒▒░▒███████████████
-    // ██████████████████████████████████████████████████▓▒░∙∙░░░░∙∙∙∙∙∙∙∙░░∙░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░▒░░░░▒▓██░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░▒▒▒▒▒░████████████████
-    // █████████████████████████████████████████████▓▒░░∙∙░░░░░░░░∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░░░∙∙∙∙░░░░░░░░░░░░░░░░░░░░▒░░∙░░▒▒▒▒▒▒▒▒▒▒▒▒▒▒░▒▒░▒▒▒▒▒░█████████████████
-    // █████████████████████████████████████████▓▒░∙░░░░░░░░░░░░░░∙∙∙∙∙░░∙░░░∙░░░░░░░░░░░░░░░░∙∙∙∙∙∙∙∙░▒░░░░░░░░░░░░░░░░░░░░▒░∙░▒▒▒▒▒▒▒▒▒▒▒▒░▒▒░▒▒▒░░██████████████████
-    // ██████████████████████████████████████▓░░░░░░░░░░░░░░░░░∙∙∙∙∙∙∙░░░∙░░░∙░░░░░░░░░░░░░∙∙∙░░░░░░░░∙░░▒░░░░░░░░░░░░░░░░░░░░░░∙░▒▒▒▒▒▒▒▒▒▒░▒░▒▒▒░░███████████████████
-    // ████████████████████████████████████▓░∙░░░░░░░░░░░░░░░∙∙∙∙∙∙∙∙∙░░░░░░░∙░░░░░░░░░░░∙∙░░░░░░░░░░░░░░∙░░░▒░░░░░░░░░░░░░░░░░░░░∙░▒▒▒▒▒▒▒▒░░▒▒▒░▒████████████████████
-    // ███████████████████████████████████▒∙░░░░░░░░░░▒▒░░░∙∙░∙∙∙∙∙░░∙∙∙∙░∙░░∙░░░░░░░∙∙∙░░░░░░░░░░░░░░░░░░░░∙∙░░▒░░░░░░░░▒░░░░░░░░░∙░▒▒▒▒▒▒▒░░▒▒░▓█████████████████████
-    // ██████████████████████████████████░∙░∙▒░░░░░▒░░∙∙░░░░░░░░░░░░░░░∙∙∙∙░░∙░░░∙∙∙∙░░░░░∙░░░░░░░░░░░░░░░░░░░░░∙░░▒░░░░░░░░░░░░░░░░∙▒▒▒▒▒▒▒░▒░░███████████████████████
-    // █████████████████████████████████▒∙░░░░░░▒░░∙░░░░░░░░░░░░░░░░░░░░░∙░░∙∙∙∙░░░░░░░∙∙░░░░░░░░░░░░░░░░░░░░░░░░░∙░░▒░░░░░░░░░░░░░░░░▒▒▒▒▒▒∙░▓████████████████████████
-    // ████████████████████████████████▓∙░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░∙░░░∙░░░░░░∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░▒░░░░░░░░░░░░░∙░▒▒▒▒▒░██████████████████████████
-    // ████████████████████████████████░░░░░░░░∙░░░░░░░░░░░░░░░░░░░∙∙░░░░∙░░░∙░░░░∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙▒▒▒░▒░██████████████████████████
-    // ███████████████████████████████▓∙░░░∙▒░░░░░░░░░░░░░░░░░░░░░░░∙∙∙░∙░░░░∙░░∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙▒▒▒░▒░██████████████████████████
-    // ███████████████████████████████░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙∙∙∙░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░∙░▒▒▒▒░██████████████████████████
-    // ██████████████████████████████▓∙░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙∙░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░▒▒▒░░▓█████████████████████████
-    // ██████████████████████████████░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░∙▒▒▒▒░░█████████████████████████
-    // ██████████████████████████████∙░░░░░∙░░░░░░∙░░░░░░░░░░░░░░░░░░░∙░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙▒▒▒▒░░▒████████████████████████
-    // █████████████████████████████▒∙░░░░░∙░░░░░∙∙░░░░░░░░░░░░░░░░░░░∙░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░∙░▒▒▒▒░∙▓███████▓▓██████████████
-    // █████████████████████████████░░░░░░░∙░░░░∙∙░░░░░░░░░░░░░░░░░░░∙░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░▒▒▒▒▒▒∙▒█████▒░███████████████
-    // █████████████████████████████∙░░░░░░∙░░░∙∙∙░░░░░░░░░░░░░░░░░░░∙░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░∙░░░░░░░░░░░░∙░▒▒▒▒▒▒▒░░░▒░░∙▓███████████████
-    // ████████████████████████████▓∙░░░░░░∙░░░∙∙░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░∙∙░░░░░░░░░░░░∙∙░▒▒▒▒▒▒▒▒▒▒▒░▓████████████████
-    // ████████████████████████████▒░░░░░░░∙░░░∙∙░░░░░░░░░░░░░░░░░░░∙░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░∙∙░░░░░░░░░░░░∙░░▒░░▒▒▒▒▒░░▒██████████████████
-    // ████████████████████████████░░░░░∙░░∙░░∙∙∙░░░░░░░░░░░░░░░░░░░∙░░░░∙░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░∙░░░░░∙∙░░░░░░░░░░░░░∙░▒▒█▓▒░░░▒▒████████████████████
-    // ████████████████████████████∙░░░∙∙░░∙░░∙∙░░░░░░░░░░░░░░░░░░░∙░░░░░∙░░░░░░░░░░░░░░░░░░░░▒▒░░░░░░░░░░░░░░░░░░∙░░░░∙∙∙░░░░░░░░░░░░░∙░▒▒▒███████████████████████████
-    // ███████████████████████████▓∙░░░∙∙░░∙░∙∙∙░░░░░░░░░░░░░░░░░░░∙░░░░∙░░░░░░░░░░░░░░░░░░░░▒░░░░▒░░░░░░░░░░░░░░∙░░░░░∙∙∙░░░░░░░░░░░░░∙░▒▒▒░▓█████████████████████████
-    // ███████████████████████████▓∙░░░∙∙░░∙∙∙∙∙░░░░░░░░░░░░░░░░░░∙░░░░░∙░░░░░░░░░░░░░░░░░░∙∙∙░░░░░░░░░░░░░∙░░░░░∙░░░░∙∙∙░░░░░░░░░░░░░░∙░▒▒▒▒░░▒▓▓▓████████████████████
-    // ███████████████████████████▒∙░░░∙∙░░∙∙∙∙░░░░░░░░░░░░░░░░░░░∙░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░▒░░░░░░░░░░∙░░░░░∙░░░░∙∙∙░░░░░░░░░░░░░░∙∙░▒▒▒▒▒░░▓█████████████████████
-    // ███████████████████████████░░░░░∙∙░░∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░▒░░░░░░░░▒░░░░░░░░░∙░░░░░░░░░░∙∙░░░░░░░░░░░░░░░∙░▓▒░░░▒▓███████████████████████
-    // ███████████████████████████░░░░░∙∙∙░∙∙∙░░░░░░░░░░░░░░░░░░░∙░░░░░∙░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░∙∙░░░∙░░░░░∙∙░░░░░░░░░░░░░░░∙▒██████████████████████████████
-    // ███████████████████████████∙░░░░∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙░░░∙░░░░∙∙∙░░░░░░░░░░░░░░∙∙▒██████████████████████████████
-    // ███████████████████████████∙░░░░∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░▒▒▒░▒░░░░░░░░░░∙∙░░░∙░░░░∙∙░░░░░░░░░░░░░░░∙∙▒██████████████████████████████
-    // ██████████████████████████▓∙░░░░∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░∙░░░░░∙░░░░░░░░░░░░░░░░░░░∙∙∙∙░░░░░░░░░░░░░∙∙░░░∙░░░░∙∙░░░░░░░░░░░░░░░∙∙▒██████████████████████████████
-    // ██████████████████████████▓∙∙░░░░∙∙∙░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░∙∙░░░░░░░░░░░░░░░░∙∙▒██████████████████████████████
-    // ██████████████████████████▒∙∙░░░░∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙░∙░░░░∙∙░░░░░░░░░░░░░░░∙∙∙▓██████████████████████████████
-    // ██████████████████████████░∙∙░░░░∙∙∙░░░░░░░░░░░░░░░░░░░░∙░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙░∙░░░∙∙░░░░░░░░░░░░░░░░∙∙∙▓██████████████████████████████
-    // ██████████████████████████∙∙∙░░░░∙∙░░░░░░░░░░░░░░░░░░░░░∙░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙░∙░░░∙░░░░░░░░░░░░░░░░░∙∙∙▓██████████████████████████████
-    // █████████████████████████▓∙∙∙∙░░∙∙∙░░░░░░░░░░░░░░░░░░░░░░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙∙░░∙∙░░░░░░░░░░░░░░░░∙∙∙∙███████████████████████████████
-    // █████████████████████████▒∙∙∙∙░∙∙∙░░░░░░░░░░░░░░░░░░░░░∙░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙∙░░∙░░░░░░░░░░░░░░░░░∙∙∙∙███████████████████████████████
-    // █████████████████████████∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░░∙░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙∙∙░∙∙░░░░░░░░░░░░░░░░░∙∙∙∙███████████████████████████████
-    // █████████████████████████∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░░∙░░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙∙∙∙∙░░░░░░░░░░░░░░░░░∙∙∙∙░███████████████████████████████
-    // ████████████████████████▓∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░░∙░░░░∙░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░∙∙∙∙∙░░░░░░░░░░░░░░░░░░∙∙∙∙░███████████████████████████████
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xf739, 0xf73a, 0xf73a, 0xef3a, 0xef3a, 0xef3a, 0xef3a, 0xef3a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xf75a, 0xe6d9, 0xbd94, 0x8c70, 0x6b6d, 0x4a69, 0x29a7, 0x2146, 0x10e5, 0x10e5, 0x10e5, 0x10e4, 0x1905, 0x2146, 0x2986, 0x4249, 0x5aeb, 0x7bce, 0x9cd2, 0xce16, 0xef1a, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xe6f9, 0xa512, 0x6b4c, 0x2966, 0x1105, 0x2167, 0x21a9, 0x21c9, 0x324c, 0x2a2c, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x324c, 0x2a2b, 0x29c9, 0x2188, 0x1946, 0x10e5, 0x3a08, 0x73ae, 0xb594, 0xef3a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xf75a, 0xef19, 0xa4f2, 0x528a, 0x1905, 0x2188, 0x29ea, 0x324c, 0x2a0b, 0x29ea, 0x29ca, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x322c, 0x21c9, 0x1967, 0x1925, 0x52aa, 0x9cb1, 0xe6d9, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xce36, 0x6b4c, 0x1905, 0x2168, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x21c9, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2188, 0x1925, 0x52aa, 0xb554, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xbdd5, 0x4a8a, 0x1926, 0x29ea, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x21a9, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x1967, 0x2987, 0x8c50, 0xe6f9, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xc5f6, 0x4a6a, 0x1947, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x21a9, 0x29ea, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x322c, 0x21a9, 0x2146, 0x840f, 0xe6f9, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xdeb8, 0x630c, 0x1926, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x21c9, 0x21ca, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x29ea, 0x2a0b, 0x2a0b, 0x2a2b, 0x21a9, 0x2146, 0x8c50, 0xef1a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0x9cf2, 0x2146, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2188, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x29ea, 0x2a0a, 0x2a0b, 0x2a2b, 0x2a2b, 0x21a9, 0x29a7, 0xb554, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xe6d8, 0x52aa, 0x1967, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x1968, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x29ea, 0x29ea, 0x2a0b, 0x2a2b, 0x2a0b, 0x322b, 0x1947, 0x52cb, 0xdeb8, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xc5d5, 0x8c0d, 0x62a8, 0x51e4, 0x49c3, 0x5226, 0x732a, 0xa4b0, 0xe6b8, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xc5f6, 0x2966, 0x29ea, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x21a9, 0x29ea, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21ea, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x29ea, 0x2146, 0xad33, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xb553, 0x5225, 0x72a4, 0xac28, 0xd54a, 0xe5cb, 0xe5ab, 0xe5cb, 0xc4e9, 0x93a7, 0x5203, 0x7b6b, 0xdeb8, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xa513, 0x1105, 0x2a0a, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2188, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2167, 0x632c, 0xeef9, 0xdeb8, 0x62a8, 0x72e5, 0xd54a, 0xdd6a, 0xdd6a, 0xdd6a, 0xdd6a, 0xdd6a, 0xdd6a, 0xdd6a, 0xdd6a, 0xdd8a, 0xac68, 0x51e3, 0xad12, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x9470, 0x10c4, 0x2a0a, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x21a9, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a8, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x29ea, 0x31c7, 0x49e4, 0xb469, 0xdd6a, 0xdd6a, 0xdd6a, 0xdd49, 0xdd6a, 0xdd6a, 0xdd69, 0xdd69, 0xdd6a, 0xdd6a, 0xdd6a, 0xdd6a, 0xd56a, 0x6a84, 0x83cd, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x8c50, 0x10e4, 0x21c9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2188, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x21c9, 0x29ea, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2125, 0xac69, 0xdd6a, 0xdd6a, 0xdd6a, 0xdd6a, 0xdd6a, 0xdd69, 0xdd69, 0xdd69, 0xdd6a, 0xdd6a, 0xdd49, 0xdd69, 0xdd49, 0xdd6a, 0x7b25, 0x7b8c, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x9491, 0x10c4, 0x21a8, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x29ea, 0x29ea, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2188, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x322b, 0x1925, 0xa449, 0xdd6a, 0xdd6a, 0xdd6a, 0xdd6a, 0xdd49, 0xdd49, 0xdd49, 0xdd69, 0xdd6a, 0xdd49, 0xdd49, 0xdd69, 0xdd6a, 0xdd6a, 0x72c5, 0x944e, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xb574, 0x10c4, 0x2168, 0x21ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x21a9, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x1925, 0xac89, 0xdd6a, 0xd529, 0xc4a8, 0xbc88, 0xb447, 0xb447, 0xac06, 0xd529, 0xdd6a, 0xdd69, 0xdd49, 0xdd6a, 0xdd4a, 0xdd6a, 0x5a23, 0xb573, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xd677, 0x1905, 0x1967, 0x2188, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x21a9, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2188, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2124, 0xbcc9, 0xd529, 0xdd4a, 0xdd49, 0xdd4a, 0xdd49, 0xdd6a, 0xb447, 0xac06, 0xd529, 0xdd6a, 0xdd6a, 0xdd49, 0xdd6a, 0xd52a, 0x49c3, 0xde97, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xef3a, 0x39e8, 0x1947, 0x2168, 0x21c9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x29ea, 0x2a2c, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a9, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x3184, 0xd54a, 0xdd4a, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd6a, 0xb427, 0xbca8, 0xdd6a, 0xdd6a, 0xdd6a, 0xdd49, 0xac68, 0x5a67, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x840f, 0x10e5, 0x2167, 0x2168, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x21c9, 0x2188, 0x1947, 0x1106, 0x1106, 0x1105, 0x1106, 0x1946, 0x1946, 0x1126, 0x1126, 0x1126, 0x1126, 0x1946, 0x1967, 0x21a9, 0x29ea, 0x2a2b, 0x2a2c, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x21a9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21c9, 0x5a86, 0xdd6a, 0xdd49, 0xdd69, 0xdd49, 0xdd69, 0xdd49, 0xdd49, 0xdd6a, 0xc4c8, 0xbc88, 0xdd6a, 0xdd6a, 0xdd6a, 0xdd6a, 0x72c4, 0xa4f1, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xce37, 0x10c4, 0x2188, 0x2167, 0x21a9, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x21a9, 0x1926, 0x1126, 0x19a9, 0x222c, 0x2a8f, 0x3311, 0x4394, 0x43b5, 0x3bb5, 0x3b94, 0x3b94, 0x3b94, 0x3b94, 0x3b94, 0x43b5, 0x3bb5, 0x3b53, 0x32f0, 0x2a8e, 0x220c, 0x1988, 0x1106, 0x1926, 0x21a8, 0x2a0b, 0x322c, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x21a9, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x1926, 0x93a7, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xcce9, 0xbca8, 0xdd6a, 0xdd4a, 0xdd6a, 0xcd2a, 0x49a3, 0xef19, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x4229, 0x1947, 0x2168, 0x2167, 0x29ea, 0x2a2b, 0x2a2b, 0x21a9, 0x1126, 0x19a9, 0x2a8e, 0x3b73, 0x3b95, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3374, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x3b94, 0x3b94, 0x3b94, 0x3bb5, 0x3b73, 0x32ae, 0x21ca, 0x1126, 0x1947, 0x21c9, 0x322c, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2188, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2103, 0xabe7, 0xc4a8, 0xdd4a, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd6a, 0xdd4a, 0xcce9, 0xc4c9, 0xdd49, 0xdd49, 0xdd4a, 0x8b66, 0x944f, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xa513, 0x10e4, 0x2168, 0x2167, 0x2168, 0x2a0b, 0x1947, 0x1947, 0x2a6e, 0x3b94, 0x3b94, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3b95, 0x3b32, 0x2a4d, 0x1967, 0x1926, 0x21ca, 0x2a2c, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x21a9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x21a9, 0x5a24, 0xabe6, 0xb427, 0xd549, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd6a, 0xc4c8, 0xd529, 0xdd49, 0xdd49, 0xd54a, 0x49a3, 0xef3a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xef3a, 0x2966, 0x1967, 0x2168, 0x1967, 0x10e5, 0x21a9, 0x3311, 0x3b94, 0x3b94, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3b94, 0x3b53, 0x2a4c, 0x1946, 0x1967, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x21a9, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2c, 0x18e4, 0xa3c6, 0xabe6, 0xb427, 0xdd49, 0xdd49, 0xdd6a, 0xdd49, 0xdd4a, 0xdd4a, 0xdd6a, 0xbc88, 0xdd6a, 0xdd6a, 0xdd6a, 0x8325, 0xa4d0, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x9491, 0x1105, 0x1967, 0x10e5, 0x1126, 0x32cf, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3b94, 0x32f1, 0x21c9, 0x1926, 0x29ea, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x21a8, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x21a9, 0x6285, 0xabe6, 0xabe6, 0xb447, 0xdd6a, 0xdd49, 0xdd6a, 0xdd4a, 0xdd6a, 0xdd6a, 0xdd6a, 0xc4a8, 0xdd49, 0xdd6a, 0xc4e9, 0x5a46, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xef3a, 0x2146, 0x1947, 0x08c4, 0x21ea, 0x2a6e, 0x3b73, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3b94, 0x3374, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x3b73, 0x222c, 0x1926, 0x21c9, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a9, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x29ea, 0x18e3, 0xd54a, 0xa3c6, 0xa3c6, 0xc4a8, 0xdd49, 0xdd49, 0xdd69, 0xdd49, 0xdd49, 0xdd49, 0xcce9, 0xd529, 0xdd6a, 0xdd6a, 0x5a03, 0xd657, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x9cb1, 0x08a3, 0x1147, 0x2a4d, 0x2a4d, 0x2aaf, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x3b94, 0x3374, 0x3b74, 0x3374, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3b74, 0x3374, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x3374, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x3b94, 0x2a4d, 0x1126, 0x21c9, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2188, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x29ea, 0x1926, 0x8b87, 0xdd6a, 0xb427, 0xa3a6, 0xd529, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd6a, 0xc4c8, 0xdd69, 0xdd49, 0x93c6, 0x942e, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x2986, 0x21ea, 0x2a4d, 0x224d, 0x224d, 0x3312, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3b74, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3b74, 0x3374, 0x3374, 0x3b74, 0x3b74, 0x3374, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3b74, 0x3b94, 0x2a2c, 0x1926, 0x29ea, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2188, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x29ea, 0x2188, 0x39a4, 0xdd6a, 0xdd69, 0xb426, 0xb427, 0xdd49, 0xdd4a, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xd529, 0xcd08, 0xdd49, 0xcd2a, 0x5226, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x6b6d, 0x21ca, 0x2a2c, 0x222c, 0x222d, 0x224d, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3b94, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3b74, 0x3b94, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3b74, 0x3374, 0x3b74, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3b74, 0x3374, 0x3b74, 0x220b, 0x1946, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a8, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x29ea, 0x2188, 0x10c3, 0xc488, 0xdd4a, 0xdd49, 0xabe6, 0xcd09, 0xdd6a, 0xdd6a, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xccc8, 0xdd6a, 0xdd6a, 0x5203, 0xe6f9, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xbdb5, 0x1947, 0x2a4c, 0x222d, 0x222d, 0x224d, 0x2aaf, 0x3b74, 0x3b74, 0x3b94, 0x3b94, 0x3b94, 0x4394, 0x3b32, 0x32cf, 0x2a6e, 0x220b, 0x21ca, 0x21a9, 0x2188, 0x1988, 0x1967, 0x1967, 0x1968, 0x1988, 0x21a9, 0x21ca, 0x220b, 0x2a6d, 0x32af, 0x3b32, 0x3b94, 0x3b94, 0x3b74, 0x3374, 0x3b94, 0x3374, 0x3b74, 0x3374, 0x3374, 0x3b74, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x43b5, 0x3b94, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x3b52, 0x1988, 0x2188, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x21a9, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x29ea, 0x2188, 0x1926, 0x7ae5, 0xdd6a, 0xdd49, 0xdd49, 0xac06, 0xdd4a, 0xdd6a, 0xdd69, 0xdd49, 0xdd4a, 0xdd49, 0xdd49, 0xcce9, 0xdd49, 0x8346, 0xad12, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x3a08, 0x2a2c, 0x2a2c, 0x222c, 0x222c, 0x224d, 0x3311, 0x3b94, 0x3b32, 0x2a6d, 0x21ca, 0x1968, 0x1946, 0x1967, 0x21a9, 0x29ca, 0x2a0b, 0x322c, 0x322c, 0x2a2c, 0x2a2c, 0x2a2b, 0x2a2c, 0x2a2c, 0x2a2c, 0x324c, 0x324c, 0x2a2b, 0x21ca, 0x21a9, 0x1968, 0x1926, 0x1946, 0x21c9, 0x2a2c, 0x32f0, 0x4394, 0x3b94, 0x3b74, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x6435, 0x3bb4, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3b94, 0x32af, 0x1126, 0x29ca, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x21a9, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x29eb, 0x2188, 0x2167, 0x5204, 0xc4c8, 0xdd49, 0xdd6a, 0xcd09, 0xc4a8, 0xdd6a, 0xdd6a, 0xdd49, 0xdd69, 0xdd49, 0xdd49, 0xccc8, 0xdd6a, 0xac68, 0x7b8b, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xbdb5, 0x1967, 0x2a2c, 0x222c, 0x222c, 0x2a4d, 0x19ca, 0x21ca, 0x1967, 0x1988, 0x29ea, 0x324c, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x324c, 0x2a0b, 0x2188, 0x1926, 0x2188, 0x2a2c, 0x3b31, 0x3bb5, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3b74, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3374, 0x3374, 0x7cb6, 0x5415, 0x3b94, 0x3374, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3b74, 0x3b74, 0x21ca, 0x1947, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a8, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x29ea, 0x2188, 0x2188, 0x2923, 0xb427, 0xdd6a, 0xdd6a, 0xdd69, 0xc4a8, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xd529, 0xcd09, 0xdd6a, 0x5205, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x5aeb, 0x2a0b, 0x2a2c, 0x21ea, 0x1967, 0x1947, 0x21c9, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2188, 0x1947, 0x21ea, 0x32f0, 0x4394, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3b74, 0x3374, 0x3374, 0x3353, 0x8d37, 0x8d38, 0x3353, 0x3374, 0x3b74, 0x3374, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3b94, 0x32d0, 0x1126, 0x2a0b, 0x2a0b, 0x322c, 0x1968, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x2188, 0x2188, 0x10e4, 0xabe6, 0xd509, 0xdd49, 0xdd49, 0xdd6a, 0xc4c8, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xc4c8, 0xdd6a, 0x51e3, 0xef1a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xef3a, 0x1925, 0x2188, 0x1947, 0x21a8, 0x2a2c, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2c, 0x2a2b, 0x2188, 0x1947, 0x2a0b, 0x3b32, 0x3b94, 0x3b74, 0x3374, 0x3b74, 0x3374, 0x3374, 0x84d6, 0x8cf6, 0x3353, 0x3b74, 0x3374, 0x3374, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3b53, 0x1968, 0x21c9, 0x2a2b, 0x21a9, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x2188, 0x2167, 0x1905, 0x8b25, 0xbc87, 0xdd49, 0xdd49, 0xdd49, 0xcd09, 0xd529, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xc4c8, 0xdd69, 0x7b05, 0xbd94, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xe6d8, 0x9cb1, 0x4a8a, 0x1946, 0x29ea, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x1967, 0x2188, 0x2a8e, 0x4394, 0x3b94, 0x3b74, 0x3374, 0x3353, 0x3332, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3b94, 0x2a2c, 0x1947, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21ca, 0x2188, 0x2167, 0x1926, 0x7284, 0xabe6, 0xdd49, 0xdd49, 0xdd69, 0xdd49, 0xcce8, 0xdd69, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd6a, 0xbc87, 0xa3e7, 0x946f, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0xef3a, 0xad33, 0x4a8a, 0x1925, 0x21a9, 0x2a2b, 0x29ea, 0x2a0b, 0x2a4c, 0x2a4d, 0x326d, 0x326d, 0x324d, 0x2a2c, 0x2a0b, 0x21ea, 0x21c9, 0x29ca, 0x2a0b, 0x2a2c, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x29ca, 0x1947, 0x2a0b, 0x3b53, 0x3b94, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3b53, 0x21a9, 0x1105, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a9, 0x2188, 0x2188, 0x1946, 0x5a24, 0xabe6, 0xccc8, 0xdd49, 0xdd6a, 0xdd49, 0xd529, 0xd549, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xc4a8, 0xc4c9, 0x734a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xe6d9, 0x840f, 0x2146, 0x1967, 0x328d, 0x32cf, 0x32f1, 0x3b53, 0x43b5, 0x3bb5, 0x3b74, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3b94, 0x3b95, 0x3bb5, 0x43b5, 0x3b73, 0x32f0, 0x2a8e, 0x2a6d, 0x2a0b, 0x21a9, 0x29ea, 0x322c, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x1947, 0x21ca, 0x3b32, 0x3b94, 0x3374, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3374, 0x3374, 0x32f1, 0x21a8, 0x2a0b, 0x1105, 0x29ea, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2188, 0x2188, 0x2188, 0x1967, 0x49c3, 0xabe6, 0xbc47, 0xdd49, 0xdd49, 0xdd6a, 0xdd69, 0xcd09, 0xdd69, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xccc8, 0xd54a, 0x4a05, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xe6d9, 0x73ce, 0x1926, 0x222c, 0x3b32, 0x3b94, 0x3b94, 0x3b74, 0x3b74, 0x3b94, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b94, 0x3b74, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x3b95, 0x3332, 0x2a6e, 0x2a2c, 0x21a9, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x322b, 0x1967, 0x21ca, 0x3b52, 0x3b94, 0x3b74, 0x3374, 0x3374, 0x3b74, 0x3b74, 0x3374, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x21eb, 0x2a0b, 0x2a0b, 0x2a0b, 0x1105, 0x21c9, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2188, 0x2168, 0x2168, 0x2187, 0x4183, 0xabc6, 0xabe6, 0xdd49, 0xdd49, 0xdd49, 0xdd69, 0xcd08, 0xdd49, 0xdd49, 0xdd69, 0xdd49, 0xdd49, 0xdd6a, 0xc4a8, 0x49c2, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0x9491, 0x2167, 0x32af, 0x3b94, 0x3b94, 0x3b94, 0x3b94, 0x4394, 0x3b73, 0x32f0, 0x2a6d, 0x2a0a, 0x29c8, 0x2987, 0x2124, 0x2124, 0x2103, 0x2123, 0x2124, 0x2145, 0x2187, 0x29c9, 0x2a2b, 0x2aae, 0x3b32, 0x3b95, 0x3b94, 0x3b74, 0x3374, 0x3374, 0x3b74, 0x3bb5, 0x32d0, 0x2a2c, 0x21a9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x1947, 0x21ea, 0x3b73, 0x3b94, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b94, 0x3b74, 0x3b74, 0x3332, 0x1988, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x1947, 0x21a9, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x2188, 0x2168, 0x2167, 0x2188, 0x3942, 0xabc6, 0xabe6, 0xc4a8, 0xdd6a, 0xdd49, 0xdd49, 0xdd69, 0xcce8, 0xdd49, 0xdd49, 0xdd6a, 0xdd49, 0xdd6a, 0xc4a8, 0x6aa4, 0xd657, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xce36, 0x3a29, 0x2a6d, 0x3b94, 0x3b94, 0x3b94, 0x3b52, 0x2a6d, 0x1988, 0x08c4, 0x0062, 0x08a3, 0x08a3, 0x5203, 0x8b05, 0x9b65, 0xa3a6, 0xabe6, 0xb406, 0xb407, 0xb407, 0xb3e6, 0xabc6, 0x9b66, 0x7aa4, 0x6a66, 0x7ae8, 0x5247, 0x31e9, 0x2a8e, 0x3b73, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x3b74, 0x3b94, 0x32af, 0x2a2b, 0x21ca, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x1946, 0x2a4c, 0x3b94, 0x3b94, 0x3b74, 0x3b74, 0x3b74, 0x3b94, 0x3b74, 0x2a4d, 0x21a9, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2c, 0x1967, 0x21a9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21c9, 0x1967, 0x2168, 0x2167, 0x2188, 0x3102, 0xabe6, 0xabe6, 0xb427, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xcce8, 0xdd6a, 0xdd6a, 0xdd49, 0xdd49, 0xdd69, 0xc4a8, 0x8b66, 0xb553, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x9cd2, 0x1967, 0x3b52, 0x3b74, 0x3b52, 0x2a2c, 0x1126, 0x08a3, 0x10e4, 0x1905, 0x1967, 0x1947, 0x1946, 0x51c3, 0xabe6, 0xabe6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0x6204, 0xe52f, 0xe50f, 0xe50f, 0xe550, 0xb42c, 0x6aa8, 0x31c7, 0x328d, 0x3b94, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b73, 0x2a6d, 0x21c9, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x29ea, 0x1926, 0x328e, 0x3b94, 0x3b94, 0x3b74, 0x3b74, 0x3311, 0x19a9, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2c, 0x2168, 0x21a9, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2188, 0x2167, 0x2188, 0x2187, 0x2188, 0x2902, 0xabe6, 0xabe6, 0xabe6, 0xdd49, 0xdd49, 0xdd49, 0xdd4a, 0xd529, 0xd509, 0xdd49, 0xdd69, 0xdd49, 0xdd49, 0xdd49, 0x8b45, 0x9c8f, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x840f, 0x1989, 0x3b32, 0x32af, 0x1967, 0x08c4, 0x1905, 0x1947, 0x1947, 0x1946, 0x1946, 0x1946, 0x1946, 0x3942, 0xa3c6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0x7264, 0xbc4d, 0xe52f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xbc6d, 0x59e3, 0x3963, 0x320a, 0x3b31, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x2a6e, 0x21c9, 0x2a2b, 0x2a2c, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x322c, 0x1126, 0x1147, 0x3b11, 0x3b94, 0x3b74, 0x2a4d, 0x21a9, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2168, 0x21c9, 0x2a2b, 0x2a2b, 0x2a0b, 0x29ea, 0x2167, 0x2188, 0x1967, 0x2167, 0x2188, 0x28e1, 0xabc6, 0xabe6, 0xabe6, 0xc4c8, 0xdd49, 0xdd49, 0xdd49, 0xdd6a, 0xcce8, 0xdd6a, 0xdd6a, 0xdd49, 0xdd49, 0xdd6a, 0xa3e7, 0x83ac, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0x840f, 0x1988, 0x2a8e, 0x1967, 0x08c4, 0x1926, 0x1946, 0x1947, 0x1946, 0x1947, 0x1946, 0x1946, 0x1946, 0x2102, 0x9345, 0xabc6, 0xabc6, 0xabc5, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xa3c5, 0xabc6, 0xabc6, 0x9b86, 0x7aa6, 0xe52f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xa3aa, 0x9345, 0xabe6, 0x9365, 0x59e3, 0x2986, 0x32cf, 0x3b94, 0x3b74, 0x3374, 0x3374, 0x3b94, 0x3b94, 0x2a8e, 0x21ea, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2c, 0x21a9, 0x1988, 0x32f0, 0x3b53, 0x1947, 0x21eb, 0x2a8e, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x1967, 0x29ca, 0x2a0b, 0x2a2b, 0x21a9, 0x2168, 0x2167, 0x2167, 0x2167, 0x2167, 0x3941, 0xa3a5, 0xabe6, 0xabe6, 0xbc47, 0xdd49, 0xdd49, 0xdd49, 0xdd4a, 0xccc8, 0xdd6a, 0xdd49, 0xdd49, 0xdd49, 0xdd6a, 0xc4a8, 0x62c8, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xad33, 0x1947, 0x220b, 0x08c4, 0x1926, 0x1947, 0x1946, 0x1947, 0x1946, 0x1946, 0x1946, 0x1946, 0x1946, 0x2124, 0x7284, 0xa3c6, 0xabc6, 0xabc6, 0xabc6, 0xa3c5, 0xabc5, 0xabc6, 0xabc5, 0xabc6, 0xabc5, 0xabc6, 0x6203, 0xd50f, 0xe52f, 0xe52f, 0xe52f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xa389, 0x9b65, 0xabc6, 0xabc6, 0xa3c6, 0xa3a6, 0x6243, 0x2965, 0x32cf, 0x3b94, 0x3b94, 0x3374, 0x3b74, 0x3b74, 0x3b94, 0x32af, 0x2a0b, 0x29ea, 0x2a2c, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2188, 0x21a9, 0x32d0, 0x3b94, 0x3374, 0x3b94, 0x3b94, 0x2a4c, 0x1105, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x1967, 0x29ea, 0x2a0b, 0x2188, 0x2168, 0x2188, 0x1967, 0x2167, 0x1967, 0x49a2, 0x9b85, 0xabe6, 0xabe6, 0xabe6, 0xdd6a, 0xdd49, 0xdd49, 0xdd49, 0xd529, 0xcce8, 0xdd49, 0xdd49, 0xdd69, 0xdd49, 0xd529, 0x49e4, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xe6d9, 0x2146, 0x21ea, 0x08c4, 0x1946, 0x1946, 0x1947, 0x1946, 0x1946, 0x1946, 0x1947, 0x1946, 0x1946, 0x1946, 0x4182, 0xabc6, 0xa3a5, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xa3c5, 0xa3c5, 0xa3a5, 0xabc6, 0x9345, 0x9349, 0xe52f, 0xe52f, 0xe52f, 0xe570, 0xe52f, 0xe50f, 0xe50f, 0xe50f, 0x9b89, 0x9345, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xa3c6, 0xa3a6, 0x6a43, 0x2965, 0x32ce, 0x3b94, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b94, 0x3311, 0x2a4d, 0x21c9, 0x29ea, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x21a8, 0x1968, 0x220b, 0x3312, 0x3b94, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b53, 0x29c7, 0x20c2, 0x29e9, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x1947, 0x21a9, 0x2167, 0x2168, 0x2167, 0x1967, 0x2167, 0x1947, 0x5a03, 0x9b65, 0xabe6, 0xabe6, 0xabe6, 0xd509, 0xdd49, 0xdd49, 0xdd49, 0xdd6a, 0xc487, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd6a, 0x49a3, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x840f, 0x21a9, 0x08c4, 0x1967, 0x1947, 0x1946, 0x1946, 0x1946, 0x1946, 0x1946, 0x1946, 0x1946, 0x1946, 0x2902, 0x9365, 0xa3a5, 0xa3a5, 0xa3a5, 0x9b65, 0xb428, 0xa3c5, 0xa3a5, 0xabc6, 0xa3c5, 0xa3a5, 0xabc6, 0x6203, 0xdd2f, 0xe50f, 0xe50f, 0xe550, 0xe592, 0xe52f, 0xe50f, 0xe50f, 0xe50f, 0xa3aa, 0x9325, 0xabc6, 0xabc6, 0xabc6, 0x9b85, 0xabc6, 0xabc6, 0xabc6, 0xa3c6, 0x6a43, 0x3164, 0x32ae, 0x3b94, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b94, 0x3b94, 0x3311, 0x2a2c, 0x21ea, 0x1988, 0x21a9, 0x29ea, 0x2a0b, 0x2a0b, 0x29ea, 0x29ea, 0x21a9, 0x1967, 0x1968, 0x21c9, 0x222c, 0x3311, 0x3b94, 0x3b74, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x3b74, 0x3b10, 0x31c8, 0x49a3, 0x9345, 0xa3c6, 0x49a3, 0x2167, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x1105, 0x2188, 0x2168, 0x1967, 0x1967, 0x2167, 0x1926, 0x6a64, 0xa385, 0xabc6, 0xabe6, 0xabc6, 0xc4a8, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xc4a8, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0x6223, 0xe6f9, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x4228, 0x1947, 0x1947, 0x1947, 0x1947, 0x1946, 0x1946, 0x1946, 0x1946, 0x1946, 0x1946, 0x1946, 0x2125, 0x6203, 0xa3a5, 0xa3a5, 0xa3a5, 0xa3a5, 0x9345, 0xb428, 0xabe7, 0xa3a5, 0xa3c6, 0xa3a5, 0xa3a5, 0x9345, 0x9349, 0xe50f, 0xe50f, 0xe50f, 0xe592, 0xe591, 0xedf3, 0xdcee, 0xe50f, 0xe50f, 0xabea, 0x8b04, 0xabc6, 0xabc6, 0xabc6, 0x9365, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabe6, 0xa3c6, 0x6a64, 0x3143, 0x326c, 0x3b73, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b94, 0x43b5, 0x3b32, 0x32d0, 0x2a8f, 0x2a8e, 0x2a8f, 0x2aaf, 0x32f1, 0x3b74, 0x43b5, 0x3b74, 0x3b94, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3b74, 0x3b73, 0x326c, 0x2944, 0x59e3, 0x9365, 0xabc6, 0xabc6, 0xabc6, 0xabe6, 0x7284, 0x2124, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x29ea, 0x1967, 0x1126, 0x2168, 0x2167, 0x2167, 0x2167, 0x1925, 0x7ac4, 0xabe6, 0x9b65, 0xabe6, 0xabe6, 0xbc67, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xd529, 0xccc8, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0x72e5, 0xc5d5, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x4228, 0x1926, 0x1947, 0x1947, 0x1947, 0x1946, 0x1946, 0x1946, 0x1946, 0x1946, 0x1946, 0x1946, 0x3102, 0xa3a6, 0xa3a5, 0xa3a5, 0x9b65, 0xa385, 0x9bc9, 0xbc69, 0xcd4f, 0xa3c6, 0xa3c5, 0xa3a5, 0xabc6, 0x6223, 0xdd0f, 0xe50f, 0xe50f, 0xe50f, 0xe5b2, 0xe591, 0xee76, 0xdcee, 0xe50f, 0xe50f, 0xbc2c, 0x82c4, 0xabc6, 0xabc6, 0xabe6, 0x8b24, 0xabc6, 0xabc6, 0xabc6, 0xabe6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0x7aa4, 0x4162, 0x29a7, 0x328d, 0x3b73, 0x3b94, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b94, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b94, 0x3b32, 0x326c, 0x2986, 0x4182, 0x7aa4, 0xa3c6, 0x9b65, 0xabc6, 0xabc6, 0xabc6, 0xabe6, 0xabe6, 0xabc6, 0x9366, 0x2922, 0x29c9, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a9, 0x2188, 0x1947, 0x1946, 0x2167, 0x1967, 0x2167, 0x1904, 0x8b25, 0xabc6, 0x9b65, 0xabe6, 0xb406, 0xabe6, 0xdd6a, 0xdd49, 0xdd49, 0xdd49, 0xdd6a, 0xbc67, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0x8b66, 0xa4f1, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x9470, 0x08a3, 0x1967, 0x1947, 0x1946, 0x1947, 0x1946, 0x1946, 0x1946, 0x1946, 0x1946, 0x2125, 0x6a43, 0xa3a6, 0xa3a5, 0xa385, 0x9344, 0xa385, 0x9b88, 0xeeb7, 0xbcad, 0xa3c6, 0xa3a5, 0xa3c5, 0xa3a6, 0x7aa7, 0xe52f, 0xe52f, 0xe50f, 0xe50f, 0xdd0f, 0xee14, 0xee77, 0xdcee, 0xe50f, 0xe52f, 0xd4ee, 0x7263, 0xabc6, 0xabc6, 0xabe6, 0x8b04, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabe6, 0xabc6, 0xabc6, 0xabc5, 0xabe6, 0x8b05, 0x8b28, 0x8308, 0x49c5, 0x2945, 0x2a0a, 0x32ae, 0x3b32, 0x43b4, 0x3bb5, 0x3b94, 0x3b94, 0x3b74, 0x3374, 0x3b74, 0x3b94, 0x43b5, 0x3b93, 0x32f0, 0x326c, 0x31e8, 0x2923, 0x3921, 0x7ac5, 0xa3a6, 0xabe6, 0xabc6, 0xabc6, 0xa3c6, 0x9b65, 0xabc6, 0xabe6, 0xabe6, 0xbc48, 0xc488, 0xabc6, 0xa3a6, 0x3982, 0x2167, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x29ea, 0x2188, 0x2167, 0x2167, 0x1926, 0x1967, 0x1967, 0x2167, 0x18e3, 0xabc6, 0xabc6, 0x9b65, 0xabe6, 0xbc47, 0xabe6, 0xd509, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xc487, 0xd549, 0xdd49, 0xdd49, 0xdd49, 0x9be7, 0x942e, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x5aeb, 0x10e4, 0x1967, 0x1947, 0x1947, 0x1947, 0x1946, 0x1946, 0x1946, 0x1946, 0x2902, 0xa3a6, 0xa3a5, 0xa3a5, 0xa3a5, 0x9324, 0xa385, 0xa385, 0x9b86, 0xa385, 0xa3a5, 0xabc5, 0xabc6, 0x7284, 0xbc6c, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xdcee, 0xccce, 0xcc8d, 0xe52f, 0xe50f, 0xe50f, 0xe550, 0x61e3, 0xabe6, 0xabc6, 0xabe6, 0x8b04, 0xabc6, 0xabc6, 0xabe6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0x9b64, 0xabc6, 0x7263, 0xd4cd, 0xdccd, 0xdcee, 0xe52f, 0xbc4c, 0x936a, 0x72a7, 0x51e5, 0x41a5, 0x3165, 0x3186, 0x2986, 0x3186, 0x3165, 0x2944, 0x3963, 0x51e4, 0x7aa7, 0x9369, 0xbc4c, 0xe52f, 0xabeb, 0x82e5, 0xabe6, 0xabe6, 0xabc6, 0xabc6, 0xabc6, 0x9345, 0xabc6, 0xabe6, 0xb406, 0xcd2c, 0xdd4a, 0xcce8, 0xabe6, 0xabe6, 0x6244, 0x1925, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2188, 0x2168, 0x2188, 0x1967, 0x2167, 0x1105, 0x2167, 0x2168, 0x2102, 0xabe6, 0xabc6, 0x9b65, 0xabe6, 0xbc67, 0xb426, 0xc4c8, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xd509, 0xc4a8, 0xdd49, 0xdd49, 0xdd49, 0xb488, 0x838b, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0x632c, 0x08c4, 0x1947, 0x1946, 0x1946, 0x1946, 0x1946, 0x1946, 0x1946, 0x59e3, 0xa3c6, 0xa3a5, 0xa3a5, 0x9345, 0xa385, 0xa385, 0xa3a5, 0xa3a5, 0xa3a5, 0xa3c5, 0xa3c5, 0xabe6, 0x6204, 0xe550, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xdcee, 0xe50f, 0xe50f, 0xe50f, 0xe52f, 0xe50f, 0x7286, 0xb3e6, 0xabe6, 0x9325, 0x8ae4, 0xabc6, 0xabe6, 0xabe6, 0xabe6, 0xabc6, 0xabe6, 0xabe6, 0x9b65, 0xabe6, 0x6a23, 0xe52f, 0xd4ad, 0xcc8c, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xdd0f, 0xdd0f, 0xe52f, 0xe54f, 0xdd2f, 0xe52f, 0xe54f, 0xe54f, 0xe52f, 0xdd0f, 0xe50f, 0xe5b2, 0xe50f, 0xe52f, 0xe52f, 0x7a85, 0xa3a6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0x9324, 0xabe6, 0xabe6, 0xc488, 0xe5f0, 0xdd4a, 0xdd6a, 0xbc67, 0xabe6, 0xabe6, 0x7ae5, 0x18e4, 0x2a0b, 0x2a2b, 0x21a9, 0x2167, 0x2167, 0x1967, 0x1967, 0x1967, 0x1967, 0x1105, 0x2167, 0x3962, 0xa3c6, 0xabc6, 0xabc6, 0x9b65, 0xb447, 0xccc8, 0xbc67, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd6a, 0xb426, 0xdd69, 0xdd49, 0xdd49, 0xd529, 0x62a8, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xa4f2, 0x2125, 0x10c4, 0x1905, 0x1946, 0x1946, 0x1946, 0x2124, 0x8b05, 0xa3c6, 0xa3a5, 0xa385, 0x8b04, 0xa3a5, 0xa3a5, 0xa3a5, 0xa3a5, 0xa3a5, 0xa3c5, 0xabc6, 0x9b65, 0x8b08, 0xe52f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0x9b69, 0x9b66, 0x7a83, 0x9324, 0x82e4, 0xabe6, 0xabc6, 0xabe6, 0xabc6, 0xabe6, 0xabe6, 0xabc6, 0x9344, 0xabe6, 0x7265, 0xe50f, 0xc46d, 0xc42b, 0xa3aa, 0xd4ee, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xdcad, 0xee14, 0xedd2, 0xe50f, 0xe50f, 0xd4ce, 0x6a23, 0xabe6, 0xabc6, 0xabe6, 0xabc6, 0x9b65, 0xa3c6, 0xccc8, 0xdd4a, 0xde12, 0xdd49, 0xdd8b, 0xdd49, 0xb426, 0xb406, 0xa3a6, 0x4182, 0x18c3, 0x29e9, 0x2168, 0x2167, 0x1967, 0x1967, 0x1967, 0x1967, 0x1967, 0x1105, 0x1946, 0x4182, 0xabc6, 0xabc6, 0xabe6, 0x9344, 0xb406, 0xdd69, 0xb447, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xbc67, 0xd509, 0xdd49, 0xdd49, 0xdd8a, 0x49c4, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xef3a, 0xad33, 0x5aeb, 0x2965, 0x10c3, 0x0062, 0x28e1, 0xabe6, 0xa3c6, 0xa3a5, 0x9b65, 0x8b04, 0xa3a5, 0xa3a5, 0xa3a5, 0xa3a5, 0xa3a5, 0xa3c5, 0xabc6, 0x7aa4, 0xbc2c, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe52f, 0x9b69, 0x59c1, 0x7242, 0xabc6, 0x8b04, 0xabe6, 0xabe6, 0xabe6, 0xa3c5, 0xabe6, 0xabe6, 0xabe6, 0x9324, 0x9b85, 0x8b28, 0xe50f, 0xe52f, 0x9306, 0xc46c, 0x6a02, 0x9327, 0xc46d, 0xe52f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe52f, 0xdcee, 0xf6b7, 0xee76, 0xe50f, 0xe50f, 0xe50f, 0x9369, 0x9345, 0xabe6, 0xabe6, 0xb406, 0xb427, 0xac06, 0xdd4a, 0xdd6a, 0xd591, 0xdd6b, 0xe610, 0xdd6a, 0xc4a8, 0xb406, 0x9b85, 0x7283, 0x7ac5, 0x10a2, 0x1967, 0x2167, 0x1967, 0x1967, 0x1967, 0x1967, 0x1967, 0x1967, 0x08a3, 0x4182, 0xabe6, 0xabc6, 0xabc6, 0x9b65, 0xabe6, 0xdd6a, 0xc487, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xc4c8, 0xc4a8, 0xdd49, 0xdd49, 0xdd6a, 0x49a2, 0xf75b, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0xef1a, 0x5a23, 0xabc6, 0xa3c6, 0xabc6, 0x7284, 0x8b04, 0xa3a5, 0xa3a5, 0xa3a5, 0xa3a5, 0xa3c5, 0xa3a5, 0xabc6, 0x6203, 0xe550, 0xe52f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe52f, 0xdd0f, 0xabeb, 0x9328, 0x6a02, 0x7a62, 0x59a1, 0x8b05, 0xbc67, 0x8b24, 0xabe6, 0xabe6, 0xabe6, 0xabe6, 0xa3a5, 0xabe6, 0xabe6, 0x9324, 0x8b04, 0xa3aa, 0xe50f, 0xe50f, 0xb40b, 0xcc4c, 0xabeb, 0x7222, 0x7a62, 0x7243, 0x9328, 0xb40b, 0xdd2f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe52f, 0xe50f, 0xdcee, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xdd0f, 0x6203, 0xb406, 0xb406, 0xc4a8, 0xdd6a, 0xa3c6, 0xdd49, 0xdd6a, 0xcd70, 0xf6d7, 0xdd6d, 0xdd69, 0xcd08, 0xb427, 0x9b65, 0x7a83, 0xabc6, 0x7ac5, 0x10a3, 0x1967, 0x1967, 0x1967, 0x1967, 0x1967, 0x1967, 0x1967, 0x10e5, 0x6264, 0x9b85, 0xabe6, 0xabe6, 0x9344, 0xabe6, 0xd529, 0xd529, 0xcce8, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd6a, 0xa3c5, 0xdd49, 0xdd49, 0xdd49, 0x6a84, 0xd677, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xb573, 0x7ac4, 0xabc6, 0xabc6, 0x82e5, 0x7ac4, 0x8b04, 0xa3a5, 0xa3a5, 0xa3a5, 0xa3a5, 0xabc6, 0x9b85, 0xabe6, 0x6a24, 0xdd0f, 0xbc4d, 0xbc4c, 0xbc2c, 0xabeb, 0xa3aa, 0x9348, 0x8b07, 0x7a64, 0x69e2, 0x7a62, 0x7a62, 0x7a42, 0x6a02, 0x6223, 0xccc9, 0xdd4a, 0x82e4, 0xdd6a, 0xc487, 0xb426, 0xb406, 0xa3c6, 0xb407, 0xabe6, 0x9b65, 0x7aa3, 0xc46d, 0xe50f, 0xe52f, 0xe52f, 0xbc4c, 0xdd0f, 0xc48d, 0x7265, 0x6a02, 0x8283, 0x7a42, 0x61c1, 0x7a84, 0x8b07, 0x9b69, 0xabeb, 0xbc6c, 0xccae, 0xdcef, 0xd4ce, 0xcc8d, 0xcc8d, 0xe50f, 0xe50f, 0xe50f, 0xa3ca, 0x9345, 0xd509, 0xdd69, 0xdd6a, 0x9b86, 0xdd49, 0xdd49, 0xccc8, 0xc4a9, 0xdd6a, 0xdd49, 0xcce8, 0xc4a8, 0x9365, 0x7aa4, 0xabc6, 0xabc6, 0x6a84, 0x10c4, 0x1967, 0x1967, 0x1967, 0x1967, 0x1967, 0x1967, 0x10e5, 0x8305, 0x9b65, 0xabc6, 0xabe6, 0x9344, 0xabe6, 0xcce8, 0xdd49, 0xcce8, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xb426, 0xd509, 0xdd49, 0xdd49, 0x8345, 0xb553, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x83ed, 0x9b86, 0xabc6, 0xabc6, 0x59e2, 0x8b05, 0x8b04, 0xa3a5, 0xa3a5, 0xa3a5, 0xa3c5, 0xabc6, 0x9344, 0xa3a6, 0x82e7, 0xe52f, 0xccad, 0xa389, 0x8b07, 0x7265, 0x61e2, 0x5981, 0x59c1, 0x59c1, 0x61c1, 0x6a23, 0x7aa6, 0x9b8a, 0xdd70, 0xddd3, 0x9366, 0xdd6a, 0xa3c6, 0xc4e9, 0xdd6a, 0xdd6a, 0xcd08, 0xbc69, 0xbc68, 0xb406, 0x9b85, 0x6a43, 0xe550, 0xe50f, 0xe52f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe52f, 0xc4ae, 0x9328, 0x7a85, 0x6a03, 0x59a1, 0x61e2, 0x61e2, 0x69e2, 0x5981, 0x59a2, 0x6a24, 0x82c7, 0xabcb, 0xdd0f, 0xe50f, 0xe50f, 0xe550, 0xedf3, 0x7286, 0xdd6a, 0xdd49, 0xdd6a, 0x9b85, 0xdd6a, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xcce8, 0xd529, 0x9345, 0x82c4, 0xa3c6, 0xa3c6, 0xa3c6, 0x41a3, 0x1905, 0x1967, 0x1967, 0x1967, 0x1967, 0x1967, 0x10a3, 0xa3a6, 0x9b65, 0xabe6, 0xabc6, 0xa3a5, 0xa385, 0xc4c8, 0xdd49, 0xd509, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xbc88, 0xbc87, 0xdd49, 0xdd49, 0x9bc7, 0x9c6f, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x6b0a, 0xb407, 0xa3a5, 0xa3c6, 0x3942, 0x9365, 0x8b04, 0xa3a5, 0xa3a5, 0xa3a5, 0xabc6, 0xabc6, 0x9324, 0x9325, 0x9b8a, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xdd0f, 0xe550, 0xe590, 0xe570, 0xe54f, 0xe570, 0xe530, 0xe550, 0xf613, 0xfed7, 0xfef7, 0x8328, 0xdd6a, 0xcce9, 0x9386, 0xdd4a, 0xdd49, 0xdd49, 0xd5af, 0xccc8, 0xdd6a, 0xbc88, 0x6203, 0xe570, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xdd0f, 0xdd0f, 0xe550, 0xe570, 0xdd0f, 0xd4ce, 0xd50e, 0xe550, 0xe550, 0xdd0f, 0xe571, 0xedd2, 0xf613, 0xf675, 0xfef7, 0xfef8, 0xfed7, 0xd5b2, 0x8b66, 0xdd49, 0xdd6a, 0x9ba6, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd4a, 0xcce8, 0xdd6a, 0x8b25, 0x82e4, 0xa3c6, 0xa3a5, 0xabc6, 0x82e4, 0x2903, 0x1967, 0x1967, 0x1967, 0x1967, 0x2167, 0x20e2, 0xabe6, 0x9b65, 0xabe6, 0xabc6, 0xabe6, 0x9344, 0xc488, 0xdd49, 0xd549, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd6a, 0x9b85, 0xdd49, 0xdd49, 0xb488, 0x7b6b, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x6aa7, 0xabe6, 0xa3c6, 0x7aa4, 0x6b0a, 0x9345, 0x8b04, 0xa3a5, 0xa3a5, 0xabc6, 0xabc6, 0xabc6, 0x9324, 0x82e4, 0xb42c, 0xe50f, 0xe52f, 0xe52f, 0xe50f, 0xe50f, 0xe50f, 0xdd0f, 0xdd0f, 0xe550, 0xedd2, 0xf675, 0xfed7, 0xfed7, 0xfef7, 0xfef7, 0xcdb2, 0x9bc7, 0xdd4a, 0x7ac4, 0xdd6a, 0xdd49, 0xdd6a, 0xddf1, 0xdd29, 0xdd49, 0xdd8b, 0x6a44, 0xedb2, 0xe550, 0xe50f, 0xdd0f, 0xdd0f, 0xdd0f, 0xdd0f, 0xdd0f, 0xe52f, 0xe530, 0xe570, 0xe591, 0xedb2, 0xedf3, 0xee13, 0xf654, 0xfe95, 0xfed6, 0xfef7, 0xfed7, 0xfed7, 0xfef7, 0xfef7, 0xfef7, 0xff5a, 0xfef7, 0xfef7, 0x8349, 0xcd29, 0xdd6a, 0x9b86, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xcce8, 0xe58a, 0x82e4, 0x9345, 0xa3c6, 0xa3a5, 0x9324, 0x9345, 0x8b26, 0x10c4, 0x1967, 0x1967, 0x1967, 0x1926, 0x5203, 0xa3c5, 0xa3a5, 0x9b85, 0xabc6, 0xabe6, 0x9344, 0xbc67, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xac06, 0xccc8, 0xdd49, 0xd54a, 0x5a67, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x5a24, 0xabc6, 0xabc6, 0x6244, 0x9c90, 0x9345, 0x9324, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabe6, 0x8b04, 0x7a83, 0xccae, 0xdd0f, 0xe530, 0xe50f, 0xe50f, 0xdd0f, 0xe570, 0xedf3, 0xf675, 0xfed7, 0xfed7, 0xfed7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0x8349, 0xdd6a, 0x8b05, 0xcce9, 0xdd4a, 0xdd6a, 0xd5b1, 0xee10, 0xe58c, 0xee0e, 0x7286, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfed7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfed7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xff18, 0xfeb6, 0xfef7, 0xff7b, 0xfef7, 0xfef7, 0xe675, 0x7ae5, 0xdd6a, 0x9386, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd6a, 0xcce8, 0xdd8a, 0x7aa4, 0xa3a6, 0xa3c6, 0xa3c6, 0x7aa3, 0xabe6, 0xabc6, 0x3983, 0x1967, 0x1967, 0x1967, 0x1905, 0x7ac4, 0xa3c6, 0xabc6, 0x9344, 0xabe6, 0xabe6, 0x9344, 0xbc67, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xbc87, 0xb427, 0xdd49, 0xdd8a, 0x51e3, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75b, 0x51e3, 0xabc6, 0xabe6, 0x62c8, 0x9cb0, 0x8b05, 0x8b04, 0xabc6, 0xabe6, 0xb406, 0xabe6, 0xb406, 0x8b04, 0x6a43, 0xde35, 0xe530, 0xe571, 0xedf3, 0xf655, 0xfed7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfed7, 0xfed6, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xe655, 0x8b46, 0xb447, 0x82e4, 0xdd4a, 0xdd6a, 0xcd0c, 0xff5a, 0xf6f7, 0xe5ac, 0x72c7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xff18, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef8, 0xf655, 0xf696, 0xff3a, 0xfef7, 0xfef7, 0xfef7, 0x93cc, 0xc4e9, 0x8b66, 0xdd49, 0xdd49, 0xdd49, 0xdd4a, 0xdd6a, 0xdd6a, 0xcce8, 0xdd6a, 0x6a63, 0xabe6, 0xabc6, 0x6244, 0x3984, 0x2924, 0x3164, 0x2103, 0x1926, 0x1967, 0x1967, 0x10c3, 0xa3c6, 0xabc6, 0xabc6, 0x9b65, 0xabc6, 0xabc6, 0x9b45, 0xb447, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0x9b65, 0xcce8, 0xdd49, 0x6a84, 0xe6d9, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75b, 0x51e3, 0xa3c6, 0xa3a6, 0x83cc, 0xb553, 0x82c4, 0x9324, 0xb406, 0xb426, 0xb406, 0xc487, 0xc488, 0x8b04, 0x6223, 0xe697, 0xee14, 0xee35, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xe613, 0xc530, 0xb4af, 0xa40c, 0xb48e, 0xee13, 0xfef7, 0xfef7, 0xfef7, 0xb4af, 0xb468, 0x59c3, 0xbca9, 0xdd6a, 0xc4a7, 0xd58f, 0xc4ed, 0xdd8a, 0x7b07, 0xfef7, 0xfef7, 0xfef7, 0xff18, 0xff39, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfed7, 0xff9c, 0xff9c, 0xf675, 0xfef7, 0xfef7, 0xfef7, 0xee96, 0x8326, 0x8b46, 0xdd49, 0xdd49, 0xdd49, 0xdd6a, 0xdd6a, 0xdd8b, 0xcce8, 0xe58a, 0x6202, 0x8305, 0x2103, 0x2188, 0x2a2b, 0x322b, 0x2a2b, 0x21a9, 0x08c4, 0x1967, 0x1947, 0x4183, 0xa3a6, 0xabc6, 0xabc5, 0x9344, 0xabe6, 0xabe6, 0x9344, 0xb447, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xac06, 0xbc47, 0xdd49, 0x8345, 0xbd93, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x5a24, 0xabe6, 0x8b45, 0xa4d1, 0xce36, 0x7284, 0x9345, 0xcce8, 0xd529, 0xdd6a, 0xdd49, 0xccc8, 0x9324, 0x6223, 0xee97, 0xff9c, 0xf697, 0xfef7, 0xee75, 0xcd92, 0x9c2d, 0x93cc, 0x9c2d, 0xbd11, 0xee76, 0xfef7, 0xfef7, 0xee76, 0xa48f, 0xc4ce, 0xfef7, 0xfef7, 0xff18, 0x8b8a, 0x8328, 0x7ac6, 0xd54a, 0xdd6a, 0xccc8, 0xd529, 0xdd6a, 0x8328, 0xfef7, 0xfef7, 0xfef7, 0xff5a, 0xff39, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xee34, 0xe5f3, 0xfed7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0x836a, 0x8305, 0xdd49, 0xdd49, 0xdd69, 0xd56c, 0xdd8a, 0xe5cd, 0xd509, 0xd52a, 0x3101, 0x1925, 0x322b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x21c9, 0x10c4, 0x10e4, 0x82e5, 0xabc6, 0xabc6, 0xabc5, 0xa385, 0xa3a5, 0xabc6, 0x9b44, 0xb406, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xc4c8, 0xa3c6, 0xd529, 0xa407, 0x944f, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x6ac8, 0xabe6, 0x8b05, 0xad32, 0xef3a, 0x5a03, 0x9365, 0xdd8a, 0xdd69, 0xdd6a, 0xdd6a, 0xcce9, 0x9345, 0x6a43, 0xe655, 0xee34, 0xf696, 0xfeb6, 0x9c2d, 0x28c0, 0x28c0, 0x28a0, 0x28c0, 0x28a0, 0x28a0, 0x5a26, 0xacaf, 0xfed7, 0xfef7, 0xd593, 0xff17, 0xfef7, 0xfef7, 0xf6d7, 0x7286, 0xc530, 0x72a5, 0xdd6a, 0xdd6a, 0xdd6a, 0xdd4a, 0x8b27, 0xfef8, 0xfef7, 0xfef7, 0xff7b, 0xff18, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfeb6, 0xf675, 0xf675, 0xfeb6, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xcd72, 0x6222, 0xdd49, 0xdd49, 0xd529, 0xddae, 0xe58b, 0xee0f, 0xd509, 0x9bc7, 0x2125, 0x322b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0a, 0x2188, 0x21a9, 0x1926, 0x18e2, 0xabe6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0x9324, 0xabe6, 0x9b85, 0xabc6, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd6a, 0x9ba5, 0xc487, 0xcce9, 0x6b09, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x7b6b, 0xb3e7, 0x7ac4, 0xc5d4, 0xf75a, 0x6288, 0xabc6, 0xd529, 0xdd6a, 0xdd6a, 0xdd6a, 0xd529, 0x9b65, 0x7283, 0xd5b2, 0xfef7, 0xe614, 0x93ed, 0x28a0, 0x28a0, 0x3122, 0x5a88, 0x5a88, 0x4184, 0x2080, 0x2080, 0x28a0, 0x3943, 0xa46e, 0xfed7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xeeb6, 0x93cc, 0xcd92, 0x72a5, 0xdd6a, 0xdd6a, 0xdd6a, 0x9386, 0xfef7, 0xfef7, 0xfef7, 0xff7b, 0xff39, 0xff17, 0xfef7, 0xfef7, 0xedf3, 0xabeb, 0xa3ab, 0xac2c, 0xac6e, 0xb48e, 0xc4ce, 0xd591, 0xf675, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfed7, 0x6a64, 0xdd49, 0xdd4a, 0xccc8, 0xe610, 0xe58b, 0xee31, 0xd529, 0x4a04, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x1968, 0x2a6d, 0x4394, 0x3b32, 0x21a9, 0x18a1, 0xb407, 0xabc6, 0xabc5, 0xabc6, 0xabc5, 0x9344, 0xabe6, 0xabc6, 0x9b85, 0xdd6a, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xb427, 0xb406, 0xdd6a, 0x51e4, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xa4d1, 0x8b25, 0x7ac4, 0xc616, 0xf75a, 0x8c0e, 0x9b86, 0xb447, 0xdd6a, 0xdd6a, 0xdd6a, 0xdd6a, 0x9345, 0x82c4, 0xb4cf, 0xfef7, 0xee96, 0x49a4, 0x28c0, 0x8c0f, 0xde78, 0xd658, 0xd658, 0xc5d6, 0x28e1, 0x28a0, 0x2080, 0x2080, 0x28a0, 0x4183, 0xc552, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xee96, 0xe634, 0xd5d3, 0x6aa6, 0xc4e9, 0xdd6a, 0xc4c9, 0xcd51, 0xfef7, 0xfef7, 0xff5a, 0xff5a, 0xfeb6, 0xfef7, 0xddb2, 0xaccf, 0xee96, 0xfef7, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xff39, 0xfef7, 0xfed7, 0x72a4, 0xdd4a, 0xdd49, 0xc487, 0xee73, 0xe5ad, 0xee32, 0xc4c9, 0x2166, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x1988, 0x3b32, 0x3b74, 0x3b53, 0x3b53, 0x3b53, 0x18e3, 0xa3c6, 0xabc6, 0xabc6, 0xabc6, 0xabc5, 0x9344, 0xabe6, 0xabe6, 0x9344, 0xdd69, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xd529, 0x9b65, 0xc4a8, 0x6264, 0xe6d9, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xdeb8, 0x6a44, 0x82e5, 0xc5d5, 0xf73a, 0xce36, 0x7284, 0xac07, 0xdd69, 0xdd6a, 0xdd6a, 0xdd6a, 0x9ba6, 0x9bc8, 0x9bec, 0xfed7, 0xcd93, 0x28c0, 0x5a47, 0xd658, 0xd658, 0xd638, 0xd658, 0x83ee, 0x28c0, 0x28a0, 0x3122, 0xbdb5, 0x62ea, 0x28c0, 0x4983, 0xee76, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xf6b6, 0x8bab, 0x8305, 0xd52a, 0xb4ad, 0xfef7, 0xfef7, 0xfed7, 0xff18, 0xf695, 0xfef7, 0xfef7, 0xfef7, 0xfed7, 0xfef7, 0xfef7, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xff17, 0xff9c, 0xff17, 0xeeb6, 0x7b05, 0xdd4a, 0xdd49, 0xd508, 0xde34, 0xf6b5, 0xddaf, 0x7306, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x1968, 0x3b73, 0x3b74, 0x3b32, 0x3b53, 0x3b94, 0x2a8e, 0x21c9, 0x8b05, 0xabc6, 0xabc5, 0xabc5, 0xabc5, 0x9b65, 0xabc6, 0xabe6, 0x9344, 0xdd6a, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xabe6, 0xb427, 0x8b46, 0xad33, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x6aa8, 0x9346, 0xad32, 0xf75a, 0xf75a, 0x6266, 0xabe7, 0xdd69, 0xdd6a, 0xdd6a, 0xdd6a, 0xb427, 0xb4cd, 0x6aa7, 0xde35, 0x49e5, 0x28c0, 0x83ad, 0xd658, 0xef3b, 0xff9d, 0xef3b, 0x6b0a, 0x30c0, 0x28a0, 0x6b2b, 0xffde, 0xe6fa, 0x28c0, 0x49a4, 0xbd31, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfed6, 0xe635, 0x93cb, 0xb428, 0xf6b6, 0xfef7, 0xedf3, 0xf654, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xee76, 0xb4f0, 0x8bcc, 0x7309, 0x6aa7, 0x6266, 0x6266, 0x6ac8, 0x836a, 0xa44e, 0xcd92, 0xf6d7, 0xfef7, 0xff18, 0xfed6, 0xfef7, 0xfef7, 0xffbd, 0xfef7, 0xddd3, 0x9386, 0xdd49, 0xdd4a, 0xdd6a, 0xc4ca, 0xc50d, 0xcd09, 0x2187, 0x2a2b, 0x2a2b, 0x2a2b, 0x1967, 0x3b32, 0x3b74, 0x3332, 0x3b53, 0x3b74, 0x4394, 0x2a8f, 0x2a6d, 0x6a84, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0x9344, 0xabe6, 0x9344, 0xdd6a, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xc4a8, 0xabe6, 0x9bc6, 0x83ac, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xa4f1, 0x72a5, 0xa4b0, 0xf75a, 0xf75a, 0x9c90, 0x8305, 0xd549, 0xdd6a, 0xdd6a, 0xdd6a, 0xbc88, 0xbcef, 0x4961, 0xe635, 0xee96, 0x28a0, 0x83ad, 0xff9d, 0xffde, 0xffde, 0xffde, 0x6b2b, 0x38e0, 0x30c0, 0x3963, 0xe71b, 0xbdb5, 0x30c0, 0x944f, 0xde36, 0xfef7, 0xfed7, 0xfed7, 0xfed6, 0xff18, 0xfef7, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfef7, 0xfed6, 0xfed6, 0xfeb6, 0xfed6, 0xfed6, 0xfed6, 0xfef7, 0xb4f0, 0x5a25, 0x28a0, 0x28c0, 0x28a0, 0x28a0, 0x28a0, 0x28a0, 0x2880, 0x2880, 0x28a0, 0x28a0, 0x28a0, 0x28a0, 0x3942, 0x7b29, 0xd5d3, 0xd5b3, 0xfef7, 0xff18, 0xfef7, 0xbd10, 0xa407, 0xdd49, 0xdd4a, 0xdd49, 0xdd6a, 0xdd6a, 0x72e6, 0x2a0b, 0x2a2b, 0x2a2b, 0x21c9, 0x2a6d, 0x3b74, 0x3b53, 0x3b52, 0x2a4c, 0x2188, 0x21ca, 0x2a8f, 0x32af, 0x5a04, 0xabc6, 0xabc6, 0xabc5, 0xabc6, 0xabc6, 0x9344, 0xabe6, 0x9344, 0xdd6a, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0x9b85, 0xb447, 0x5226, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xef3a, 0x6245, 0x7b8c, 0xf73a, 0xf73a, 0xe6f9, 0x59e3, 0xc4a8, 0xdd6a, 0xdd6a, 0xdd6a, 0xdd4a, 0xa46e, 0x5180, 0xc531, 0xfed7, 0x4183, 0x9c6f, 0xffde, 0xffde, 0xffde, 0xffde, 0x8bed, 0x4940, 0x38e0, 0x28c0, 0x28c0, 0x28a0, 0x3900, 0x7b4a, 0xff9c, 0xfed7, 0xfed7, 0xfed6, 0xfed6, 0xff5a, 0xfed7, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe96, 0xfeb6, 0xfeb6, 0xd5d3, 0x49a4, 0x28a0, 0x28a0, 0x28c0, 0x28a0, 0x20a0, 0x20a0, 0x20a0, 0x2080, 0x28a0, 0x28a0, 0x2080, 0x2080, 0x2080, 0x28a0, 0x30c0, 0x49e5, 0xe676, 0xfed7, 0xfed7, 0xfed7, 0x9c2d, 0xc4c9, 0xdd49, 0xdd49, 0xdd49, 0xdd4a, 0xbcc9, 0x21a8, 0x2a2b, 0x2a2b, 0x2a2b, 0x1967, 0x3b94, 0x3b94, 0x3311, 0x21eb, 0x29ea, 0x2a2b, 0x1988, 0x2a4d, 0x2aaf, 0x49e4, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0x9344, 0xabe6, 0x9344, 0xdd69, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xd549, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xb427, 0xac06, 0x51e3, 0xe6f9, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xacf1, 0x5a46, 0xf75a, 0xf75a, 0xf73a, 0x8c0e, 0xa3e7, 0xdd6a, 0xdd6a, 0xdd6a, 0xdd6a, 0xa409, 0x93ec, 0x8349, 0xfed6, 0xacaf, 0x944f, 0xffde, 0xffde, 0xffde, 0xffde, 0xa4d1, 0x8283, 0x59a1, 0x28c0, 0x28c0, 0x30c0, 0x6a02, 0x8baa, 0xff7b, 0xfed7, 0xfed6, 0xfeb6, 0xfeb6, 0xff7b, 0xfed6, 0xfe95, 0xfe95, 0xfe75, 0xfe75, 0xfe75, 0xfe74, 0xfe74, 0xfe75, 0xfe75, 0xfe95, 0xfe75, 0xddb2, 0x5a47, 0x6267, 0x9c0d, 0xc531, 0xe5f3, 0xfe95, 0xfe96, 0xfe95, 0xfe95, 0xe5f3, 0xc4f0, 0x9bec, 0x6aa7, 0x3101, 0x28a0, 0x20a0, 0x30e1, 0x5206, 0xd5f3, 0xfed6, 0xfed6, 0x834a, 0xdd8a, 0xdd49, 0xdd49, 0xdd49, 0xdd6a, 0x4a25, 0x2a2c, 0x2a0b, 0x2a2b, 0x21a9, 0x32cf, 0x3b94, 0x3311, 0x328e, 0x29ea, 0x2a0b, 0x2a2b, 0x21a9, 0x19ca, 0x2aaf, 0x3984, 0xabc6, 0xabc6, 0xabc5, 0xabc6, 0xabc6, 0x9324, 0xabe6, 0x9345, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xd529, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0x9b65, 0x7aa4, 0xad12, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x62a8, 0xdeb8, 0xf75a, 0xf73a, 0xeef9, 0x5a24, 0xdd6a, 0xdd6a, 0xdd6a, 0xdd6a, 0xc4c8, 0x8b05, 0x51a2, 0xfeb6, 0xfeb6, 0x7b8c, 0xffde, 0xffde, 0xffde, 0xffde, 0xde98, 0x8ae4, 0xbbc5, 0x3921, 0x28c0, 0x61e2, 0xb3c6, 0x93cb, 0xff5a, 0xfeb6, 0xfeb6, 0xfeb6, 0xfed6, 0xff7b, 0xfed7, 0xfe74, 0xfe74, 0xfe54, 0xfe54, 0xfe34, 0xfe34, 0xfe34, 0xfe54, 0xfe54, 0xfe54, 0xfe54, 0xdd91, 0xe5d3, 0xfe54, 0xfe34, 0xfe34, 0xfe33, 0xfe33, 0xfe33, 0xfe13, 0xfe13, 0xfe13, 0xfe13, 0xfe13, 0xfe33, 0xfe54, 0xbcef, 0x7b09, 0xc572, 0xfed7, 0xfeb6, 0xfed6, 0xfed7, 0x72e7, 0xdd6a, 0xdd49, 0xdd49, 0xdd4a, 0x8b86, 0x29c9, 0x2a2b, 0x2a2b, 0x2a2b, 0x1988, 0x3b94, 0x3b94, 0x3b32, 0x1968, 0x2a0b, 0x2a2b, 0x2a0b, 0x21a9, 0x19a9, 0x2aaf, 0x18c2, 0xb406, 0xabc6, 0xabc6, 0xabc6, 0xabe6, 0x9b65, 0xabe6, 0x9344, 0xdd69, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xd508, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xac06, 0xa3a6, 0x734b, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xe6d8, 0xad12, 0xf73a, 0xf73a, 0xf73a, 0xacf1, 0x8b66, 0xdd6a, 0xdd6a, 0xdd6a, 0xe5aa, 0x8b04, 0x7264, 0xbcf0, 0xfe95, 0xe634, 0xce16, 0xffde, 0xffde, 0xffde, 0xffde, 0x7aa5, 0xbbe6, 0xa365, 0x6202, 0xaba5, 0xbc06, 0x8bcc, 0xfef7, 0xfe95, 0xfe95, 0xfe95, 0xfeb6, 0xff5a, 0xf696, 0xfe54, 0xfe34, 0xfe33, 0xfe33, 0xfe33, 0xfe33, 0xfe13, 0xfe33, 0xfe33, 0xfe13, 0xfe33, 0xfe33, 0xfe33, 0xfe13, 0xfe13, 0xfe13, 0xfe13, 0xfe13, 0xfe13, 0xfdf2, 0xfe12, 0xfe13, 0xfdf2, 0xfe12, 0xfe13, 0xfe13, 0xfe33, 0xfe54, 0xfe75, 0xfe95, 0xfe95, 0xfeb6, 0xfed7, 0x72a4, 0xdd4a, 0xdd49, 0xdd49, 0xb489, 0x3165, 0x2a2b, 0x2a0b, 0x2a2b, 0x29ea, 0x2a8e, 0x3b74, 0x3b74, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x1947, 0x19ca, 0x2aaf, 0x10a1, 0x9b86, 0xa3a5, 0xabc5, 0xabc6, 0xabc6, 0xabc6, 0x9b65, 0x9324, 0xdd69, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xd509, 0xd529, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xd529, 0x9b85, 0x51e4, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xe6d8, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0x6ae9, 0xbcc9, 0xdd6a, 0xdd6a, 0xdd6a, 0x9ba6, 0x8b25, 0x834a, 0xfe75, 0xfe75, 0xf655, 0xff9c, 0xffde, 0xffde, 0xffde, 0xacaf, 0xa365, 0xbbe5, 0xbbe5, 0xbbe6, 0xaba5, 0xacd1, 0xfe75, 0xfe74, 0xfe74, 0xfe74, 0xf655, 0xff5a, 0xe5b2, 0xfe33, 0xfe13, 0xfe13, 0xfe13, 0xfe13, 0xfdf2, 0xfdf3, 0xfe13, 0xfe13, 0xfe13, 0xfe13, 0xfe13, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdd2, 0xfdd2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfe13, 0xfe13, 0xfe34, 0xfe54, 0xfe54, 0xfe75, 0xfe95, 0xddb2, 0x9ba6, 0xdd4a, 0xdd4a, 0xc4c9, 0x4141, 0x29ea, 0x2a2b, 0x2a2b, 0x2a0b, 0x1988, 0x4394, 0x3b94, 0x3b73, 0x1967, 0x2a2b, 0x2a2b, 0x2a0b, 0x21ca, 0x1126, 0x222c, 0x2aaf, 0x1081, 0x8b04, 0xa3c5, 0xabc5, 0xabc5, 0xabc6, 0xabe6, 0x9324, 0x9324, 0xdd69, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xccc8, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xa3e6, 0x6a64, 0xce15, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0xf73a, 0xf73a, 0xe6d8, 0x5a45, 0xcd2a, 0xdd6a, 0xdd6a, 0xac07, 0xabe7, 0x49a3, 0xfe75, 0xfe54, 0xfe54, 0xfe54, 0xfed7, 0xff19, 0xe676, 0xcdf5, 0x51c3, 0x8b05, 0x9b46, 0x9b87, 0x9388, 0xf654, 0xfe34, 0xfe33, 0xfe34, 0xfe54, 0xf5f2, 0xd4cd, 0xf5f3, 0xfe13, 0xfdf2, 0xfe13, 0xfe13, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdd2, 0xfdf2, 0xfdf2, 0xfdd2, 0xfdf2, 0xfdd1, 0xfdd2, 0xfdf2, 0xfdf2, 0xfdd2, 0xfdf2, 0xfdd2, 0xfdd2, 0xfdf2, 0xfdf2, 0xfe13, 0xfe33, 0xfe34, 0xfe34, 0xfe54, 0xfe75, 0xac6e, 0xc4c9, 0xdd49, 0xc4c9, 0x5a04, 0x3122, 0x322b, 0x2a2b, 0x2a2b, 0x2a2b, 0x21eb, 0x3b74, 0x3b74, 0x2a6d, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2188, 0x10e5, 0x2aaf, 0x2a4d, 0x39a5, 0x7ac4, 0xabc5, 0xabc6, 0xabc5, 0xabc6, 0xabe6, 0x9324, 0x9324, 0xdd69, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xc4c8, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xcd09, 0x7ac4, 0x8bed, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xd657, 0x6265, 0xd52a, 0xdd6a, 0xd54a, 0x82e4, 0x4982, 0xee33, 0xfe34, 0xfe34, 0xfe33, 0xfe33, 0xfe13, 0xf5d2, 0xed90, 0xe550, 0xe550, 0xe550, 0xed70, 0xf5f2, 0xfe13, 0xfe13, 0xfe13, 0xfe13, 0xfe13, 0xfe13, 0xfe13, 0xfe13, 0xfdf2, 0xfe13, 0xfdf2, 0xfdf2, 0xfdd2, 0xfdf2, 0xfdd2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdd1, 0xfdf2, 0xfdd2, 0xfdd1, 0xfdf2, 0xfdd1, 0xfdd2, 0xfdd2, 0xfdd2, 0xfdd2, 0xfdf2, 0xfdd2, 0xfdd1, 0xfdf2, 0xfdf2, 0xfdf2, 0xfe13, 0xfe33, 0xfe54, 0xfe34, 0xfe54, 0xfe54, 0x93ab, 0xdd6a, 0xbc88, 0x72c7, 0x9beb, 0x2965, 0x2a0b, 0x2a2b, 0x2a2b, 0x29ea, 0x2a8e, 0x3b74, 0x3b74, 0x21ca, 0x2a2b, 0x2a2b, 0x2a0b, 0x21a8, 0x2167, 0x1126, 0x2aaf, 0x21ca, 0x7bad, 0x7283, 0xabc6, 0xabc5, 0xabc5, 0xabc6, 0xabc6, 0x9345, 0x9324, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xd509, 0xc4a8, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xa3e7, 0x49e4, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xd657, 0x5a45, 0xc4e9, 0xdd6a, 0x8305, 0x6a23, 0xb4ae, 0xfe33, 0xfe33, 0xfe13, 0xfdf2, 0xfdd2, 0xfdd2, 0xfdd2, 0xfdd2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfe13, 0xfdf2, 0xfe13, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdd1, 0xfdf2, 0xfdd2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdd1, 0xfdf2, 0xfdd2, 0xfdd2, 0xfdf2, 0xfdd1, 0xfdd2, 0xfdf2, 0xfdd2, 0xfdd2, 0xfdf2, 0xfdd2, 0xfdb1, 0xfdf2, 0xfdf2, 0xfdf2, 0xfe13, 0xfe13, 0xfe33, 0xfe75, 0xfe33, 0xfe34, 0xfe54, 0x93a7, 0xac07, 0x8329, 0xe550, 0x7ae8, 0x29a8, 0x2a0b, 0x2a2b, 0x2a0b, 0x2188, 0x3b73, 0x3b94, 0x4394, 0x1947, 0x2a2b, 0x2a0b, 0x21a9, 0x2167, 0x1926, 0x21eb, 0x2a8f, 0x2187, 0xce37, 0x6a43, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0x9345, 0x9324, 0xdd6a, 0xdd49, 0xdd49, 0xdd49, 0xd529, 0xdd49, 0xdd49, 0xdd49, 0xb447, 0xdd4a, 0xdd49, 0xdd49, 0xd529, 0xdd6a, 0xdd49, 0xcd09, 0x59e2, 0xbdb4, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x7b6c, 0x6223, 0x9bc7, 0xac48, 0x59e2, 0x93cb, 0xfe33, 0xfe13, 0xfe13, 0xf5b1, 0xfdf2, 0xfdd2, 0xfdd1, 0xfdf2, 0xfdd2, 0xfdd2, 0xfdf2, 0xfdd2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfe13, 0xfe13, 0xfe13, 0xfdf2, 0xfe13, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdd2, 0xfdf2, 0xfdf2, 0xfdd2, 0xfdf2, 0xfdd1, 0xfdf2, 0xfdf2, 0xfdd2, 0xfdd2, 0xfdf2, 0xfdf2, 0xfdd1, 0xfdf2, 0xfdf2, 0xfdf2, 0xfe13, 0xfe13, 0xfe13, 0xfe34, 0xfeb6, 0xfe34, 0xfe54, 0xd551, 0x8b47, 0xac2c, 0xed70, 0xe52f, 0x5a04, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x21a9, 0x43b5, 0x3b74, 0x32f1, 0x2188, 0x2a0b, 0x21a8, 0x2167, 0x1967, 0x10e5, 0x2aaf, 0x2a8e, 0x52ca, 0xdeb8, 0x59e3, 0xabc5, 0xabc6, 0xabc5, 0xabc5, 0xabc6, 0x9344, 0x9324, 0xdd6a, 0xdd49, 0xdd49, 0xdd6a, 0xcce8, 0xdd49, 0xdd49, 0xdd49, 0xc487, 0xcce8, 0xdd49, 0xdd49, 0xdd49, 0xcce8, 0xdd6a, 0xdd6a, 0x8b45, 0x734a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x62a8, 0xb407, 0x8b04, 0x6a84, 0x4961, 0x7b08, 0xfe34, 0xfe33, 0xfdf2, 0xfe13, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdd2, 0xfdf2, 0xfdf2, 0xfdd2, 0xfdf2, 0xfe12, 0xfdf2, 0xfdf2, 0xfe13, 0xfe13, 0xfe13, 0xfe13, 0xfe13, 0xfe13, 0xfdf2, 0xfe13, 0xfe13, 0xfe13, 0xfe13, 0xfe13, 0xfdf2, 0xfe13, 0xfdf3, 0xfdf2, 0xfe12, 0xfdf2, 0xfe13, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdf2, 0xfdd2, 0xfe13, 0xfdf2, 0xfdf2, 0xfe13, 0xfe33, 0xfe13, 0xfe34, 0xfe54, 0xfed7, 0xfe54, 0xfe75, 0xd570, 0xee14, 0xfe34, 0xfe34, 0xedb1, 0x3943, 0x322c, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x3b74, 0x3b74, 0x2a6e, 0x2188, 0x2188, 0x2167, 0x1967, 0x1946, 0x19a9, 0x2aaf, 0x21a9, 0xad33, 0xf73a, 0x4982, 0xabc6, 0xabc5, 0xabc5, 0xabc6, 0xabc6, 0x9324, 0x9344, 0xdd6a, 0xdd49, 0xdd49, 0xdd49, 0xccc8, 0xdd49, 0xdd49, 0xdd49, 0xcce8, 0xbc47, 0xdd49, 0xdd49, 0xdd49, 0xbca8, 0xdd6a, 0xdd49, 0xcd29, 0x4142, 0xef19, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x62a8, 0xb3e6, 0xabc6, 0xabc6, 0x8ae4, 0x6a86, 0xfe54, 0xfe34, 0xfed7, 0xfdf2, 0xfe12, 0xfe13, 0xfdf2, 0xfe13, 0xfe13, 0xfdf2, 0xfe13, 0xfe13, 0xfdf2, 0xfdf2, 0xfe13, 0xfe13, 0xfe33, 0xfe33, 0xfe34, 0xfe33, 0xfe13, 0xfe33, 0xfe33, 0xfe33, 0xfe33, 0xfe33, 0xfe13, 0xfe33, 0xfe33, 0xfe13, 0xfe33, 0xfe13, 0xfe33, 0xfe33, 0xfe13, 0xfe13, 0xfe13, 0xfe13, 0xfdf2, 0xfe13, 0xfe13, 0xfdf3, 0xfe33, 0xfe33, 0xfe13, 0xfe34, 0xfe54, 0xfe96, 0xfed7, 0xfe75, 0xfe95, 0xfe75, 0xfe95, 0xfe95, 0xfe95, 0xf634, 0x2902, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a4c, 0x3b74, 0x3b94, 0x2a2c, 0x1967, 0x2167, 0x2167, 0x2167, 0x10e5, 0x2aaf, 0x2aaf, 0x2166, 0xf73a, 0xf75a, 0x4982, 0xabc6, 0xabc6, 0xabc6, 0xabc5, 0xabc6, 0x9344, 0x9345, 0xdd6a, 0xdd49, 0xdd49, 0xdd49, 0xc488, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xabe6, 0xd509, 0xdd49, 0xdd49, 0xd549, 0xb468, 0xdd69, 0xdd4a, 0x8325, 0xa4b0, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x5225, 0xabc6, 0xabc6, 0xabc6, 0xa3a6, 0x5a04, 0xfe54, 0xee55, 0xfed7, 0xfe13, 0xfe33, 0xfdf2, 0xfe33, 0xfe33, 0xfdf2, 0xfe33, 0xfe33, 0xfe13, 0xfe13, 0xfe34, 0xf5f3, 0xd52f, 0xfe54, 0xfe54, 0xfe54, 0xfe54, 0xfe54, 0xfe54, 0xfe54, 0xfe54, 0xfe54, 0xfe54, 0xfe54, 0xfe54, 0xfe34, 0xfe54, 0xfe33, 0xfe34, 0xfe34, 0xfe33, 0xfe33, 0xfe33, 0xfe33, 0xfe13, 0xfe33, 0xfe33, 0xfe13, 0xfe34, 0xfe34, 0xfe33, 0xfe34, 0xfe54, 0xfe54, 0xfed7, 0xfe96, 0xfe95, 0xfe95, 0xfe95, 0xfeb6, 0xfeb6, 0xfe95, 0xf675, 0x28e2, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a4c, 0x3b74, 0x3332, 0x19ca, 0x1967, 0x2167, 0x2167, 0x1105, 0x222c, 0x2aaf, 0x21c9, 0x9470, 0xf73a, 0xf75a, 0x5225, 0xabe6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0x9b65, 0x9b65, 0xdd69, 0xdd49, 0xdd49, 0xdd49, 0xb447, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xb406, 0xbc67, 0xdd49, 0xdd49, 0xdd49, 0xac27, 0xdd6a, 0xdd6a, 0xd54a, 0x6266, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x49c3, 0xabc6, 0xabc6, 0xabc6, 0xabe6, 0x51c4, 0xfeb6, 0xe5f4, 0xff18, 0xf613, 0xfe34, 0xfe54, 0xfe54, 0xfe33, 0xfe54, 0xfe54, 0xfe33, 0xfe54, 0xfe54, 0xfe54, 0xdd0f, 0xa3ec, 0xfe75, 0xfe75, 0xfe74, 0xfe75, 0xfe75, 0xfe75, 0xfe75, 0xfe75, 0xfe75, 0xfe74, 0xfe74, 0xfe54, 0xfe74, 0xfe54, 0xfe54, 0xfe54, 0xfe54, 0xfe54, 0xfe54, 0xfe54, 0xfe54, 0xfe54, 0xfe54, 0xfe54, 0xfe54, 0xfe54, 0xfe54, 0xfe54, 0xfe54, 0xfe74, 0xfe75, 0xfef8, 0xfed6, 0xfed7, 0xfe74, 0xfed7, 0xff19, 0xfeb6, 0xfeb6, 0xfed7, 0x3143, 0x29c9, 0x29ea, 0x2a0b, 0x29eb, 0x21ca, 0x2aaf, 0x2a8f, 0x21eb, 0x1126, 0x2167, 0x1105, 0x19ca, 0x2a8f, 0x2a8e, 0x31a6, 0xf73a, 0xf73a, 0xf73a, 0x5206, 0xabe6, 0xabc6, 0xabc6, 0xabc5, 0xabc6, 0x9b85, 0x9b65, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xb406, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xbc67, 0xac06, 0xdd49, 0xdd49, 0xdd49, 0xc4e9, 0xbc88, 0xdd49, 0xdd49, 0x8326, 0xcdf5, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xef3a, 0x51e3, 0xabc6, 0xabc5, 0xabc5, 0xabc6, 0x6a44, 0xfed7, 0xddb2, 0xeeb7, 0xfe54, 0xfe75, 0xfe75, 0xfe54, 0xfe75, 0xfe74, 0xfe54, 0xfe54, 0xfe74, 0xfe75, 0xfe75, 0xdd0f, 0x8b08, 0xee34, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe75, 0xfe75, 0xfe75, 0xfe75, 0xfe75, 0xfe75, 0xfe74, 0xfe75, 0xfe75, 0xfe74, 0xfe74, 0xfe74, 0xfe74, 0xfe74, 0xfe74, 0xfe75, 0xfe75, 0xfe75, 0xfe95, 0xf6b8, 0xff18, 0xfe75, 0xfe95, 0xff19, 0xff5a, 0xfed6, 0xfed6, 0xfed6, 0x5206, 0x2188, 0x2188, 0x2188, 0x2187, 0x1967, 0x2a8f, 0x2a8f, 0x2a8f, 0x1989, 0x1147, 0x220c, 0x2a8f, 0x2a8e, 0x1126, 0xbdb4, 0xf73a, 0xf73a, 0xf739, 0x5a87, 0xabe6, 0xabc5, 0xabc5, 0xabc6, 0xabc6, 0x9b85, 0x9b85, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xb406, 0xd509, 0xdd49, 0xdd49, 0xdd49, 0xc4a8, 0xabe6, 0xc4c8, 0xdd49, 0xdd49, 0xdd69, 0xa407, 0xdd49, 0xdd49, 0xcd2a, 0x6ae9, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xe6f9, 0x5a03, 0xabc6, 0xabc6, 0xa3a5, 0xabc6, 0x6a43, 0xfed7, 0xdd70, 0xdd91, 0xfe95, 0xfe95, 0xfe75, 0xfe75, 0xfe95, 0xfe75, 0xfe75, 0xfe75, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xe571, 0xccee, 0xfeb6, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe75, 0xfe75, 0xfe75, 0xfe75, 0xfe75, 0xfe75, 0xfe95, 0xfe95, 0xfe96, 0xe614, 0xf6b8, 0xfe95, 0xfeb6, 0xff19, 0xff19, 0xfed7, 0xfed6, 0xfed6, 0x93ec, 0x2146, 0x2168, 0x2187, 0x2167, 0x1926, 0x2a8e, 0x2a8f, 0x2a8f, 0x2a8f, 0x2a8f, 0x2a8f, 0x2a6e, 0x1989, 0x738d, 0xf73a, 0xf73a, 0xf73a, 0xf739, 0x6ae9, 0xabc6, 0xabc6, 0xabc5, 0xabc6, 0xabc6, 0xa3a5, 0xa3a5, 0xdd49, 0xdd49, 0xdd49, 0xdd6a, 0xabe6, 0xcce8, 0xdd49, 0xdd49, 0xdd49, 0xccc8, 0xabe6, 0xbc47, 0xdd49, 0xdd49, 0xdd49, 0xa407, 0xd509, 0xdd49, 0xdd6a, 0x7b06, 0xce36, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xde77, 0x6a64, 0xabc6, 0xa3a5, 0xa3a5, 0xa3a5, 0x6203, 0xfeb6, 0xfeb6, 0xfeb6, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfeb6, 0xfeb6, 0xedf2, 0xee13, 0xfeb6, 0xfed6, 0xee55, 0xee14, 0xfed7, 0xfed6, 0xfed6, 0xddb2, 0x3164, 0x1967, 0x2167, 0x2167, 0x1967, 0x1989, 0x2aaf, 0x2a8f, 0x2a8f, 0x2aaf, 0x2a6d, 0x1988, 0x4a69, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf739, 0x730a, 0xa3c6, 0xabc6, 0xa3a5, 0xabc6, 0xabc6, 0xabc6, 0xa3c6, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xabc6, 0xccc8, 0xdd49, 0xdd49, 0xdd49, 0xd509, 0xabe6, 0xabe6, 0xdd49, 0xdd49, 0xdd49, 0xd54a, 0x82e5, 0xdd6a, 0xdd6a, 0xcd2a, 0x732a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xc5f5, 0x7ac4, 0xabc6, 0xabc5, 0xa3a5, 0xa3a5, 0x6203, 0xee34, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb5, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfed6, 0xfed6, 0xfed7, 0xfed7, 0xfed7, 0xfef7, 0xfed7, 0xfed7, 0xf675, 0xccef, 0x2124, 0x1926, 0x1926, 0x1967, 0x1967, 0x1105, 0x222c, 0x2aaf, 0x2aaf, 0x222c, 0x1126, 0x3a08, 0xeef9, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf739, 0x6b0a, 0xa3a6, 0xabc6, 0xa385, 0xabe6, 0xabc6, 0xabc6, 0xb427, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xabc6, 0xc4a8, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xabc6, 0xa3c5, 0xc4a8, 0xdd49, 0xdd49, 0xdd49, 0x72a4, 0xcce9, 0xdd49, 0xdd4a, 0x7b06, 0xd657, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xbdb4, 0x9386, 0xabc6, 0xabc6, 0xa3a5, 0xa3a6, 0x6223, 0xcd92, 0xfed6, 0xfeb6, 0xfed6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfed6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfeb6, 0xfed6, 0xfed6, 0xfed6, 0xfed7, 0xfed7, 0xfed7, 0xfed7, 0xfed7, 0xfef7, 0xfed7, 0xdd30, 0x3165, 0x29a9, 0x2188, 0x1946, 0x10e5, 0x1967, 0x1967, 0x1926, 0x1105, 0x1105, 0x10c4, 0x52aa, 0xef19, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf739, 0x6b0a, 0x9b86, 0xabc6, 0x9b85, 0xabc6, 0xabc6, 0xa3a5, 0xc488, 0xdd49, 0xdd49, 0xdd49, 0xd509, 0xa3c5, 0xc487, 0xdd49, 0xdd49, 0xdd49, 0xdd69, 0xabc6, 0xabe6, 0xabe6, 0xdd49, 0xdd49, 0xdd49, 0x9386, 0x82e4, 0xdd6a, 0xdd6a, 0xcd09, 0x734b, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xad32, 0x9bc7, 0xb406, 0xabc6, 0xa3a5, 0xabc6, 0x51a2, 0xb4af, 0xfed6, 0xfed6, 0xfed7, 0xfef8, 0xfeb6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfeb6, 0xfed6, 0xfed6, 0xfeb6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfeb6, 0xfeb6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfeb6, 0xfeb6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfeb6, 0xfed6, 0xfed7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfed7, 0xfed7, 0xfef7, 0xe5d2, 0x3985, 0x2188, 0x29ea, 0x21a8, 0x10e5, 0x1105, 0x1967, 0x1967, 0x1967, 0x1947, 0x1905, 0x842f, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf739, 0x732a, 0x9b86, 0xabc6, 0x9b65, 0xabe6, 0xabc6, 0x9b65, 0xd529, 0xdd49, 0xdd49, 0xdd49, 0xccc8, 0xabc6, 0xc487, 0xdd49, 0xdd49, 0xdd49, 0xdd6a, 0xabc6, 0xabc6, 0x9325, 0xdd6a, 0xdd49, 0xdd49, 0xbc88, 0x4120, 0xcce9, 0xdd6a, 0xdd6a, 0x72c5, 0xe6d8, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xa4d1, 0xa407, 0xc488, 0xabc6, 0xabc6, 0xabc6, 0x3921, 0x93cc, 0xfed6, 0xfed6, 0xfed7, 0xff39, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfeb6, 0xfed6, 0xfeb6, 0xfed7, 0xfef7, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfef7, 0xff18, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xee75, 0x39a6, 0x21a9, 0x2a0a, 0x29ea, 0x1105, 0x0862, 0x1105, 0x1926, 0x1926, 0x10e4, 0x52aa, 0xd657, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf739, 0x6b2a, 0x9ba6, 0xabc6, 0x9b65, 0xabe6, 0xabc6, 0x9b65, 0xdd6a, 0xdd49, 0xdd49, 0xdd49, 0xc488, 0xabe6, 0xbc67, 0xdd49, 0xdd49, 0xdd49, 0xdd4a, 0xabc6, 0xabc6, 0x9b65, 0xccc8, 0xdd49, 0xdd49, 0xdd6a, 0x49c4, 0x72e5, 0xdd49, 0xdd49, 0xb489, 0x8c0e, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xa4f1, 0xac48, 0xd509, 0xabe6, 0xabc6, 0x9b86, 0x732b, 0x6aa8, 0xfed7, 0xfed6, 0xfeb6, 0xff5a, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed7, 0xfed7, 0xfed7, 0xfed7, 0xfed7, 0xfed6, 0xfed7, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed7, 0xbd10, 0x7b2a, 0x51a3, 0x4121, 0x6aa7, 0xd5b3, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed7, 0xfed7, 0xfed7, 0xfed7, 0xfef7, 0xff5a, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xe655, 0x31c7, 0x29ea, 0x2a0b, 0x2a0b, 0x1926, 0x5aeb, 0xde98, 0xa4f2, 0x9470, 0xa4f2, 0xdeb8, 0xf73a, 0xf75a, 0xf73a, 0xf73a, 0xf75a, 0xf73a, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0xf739, 0x732a, 0xa3a6, 0xabc6, 0x9b65, 0xabc6, 0xabc6, 0xa3a5, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xb426, 0xabe6, 0xbc67, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xabc6, 0xabc6, 0xabe6, 0xa3c6, 0xdd49, 0xdd49, 0xdd4a, 0x6285, 0x6b09, 0xd52a, 0xdd49, 0xdd6a, 0x6265, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x9c8f, 0xb468, 0xdd49, 0xb426, 0xabc6, 0x8b25, 0xa4b0, 0x5a47, 0xfed7, 0xfed7, 0xfe95, 0xff7b, 0xfed7, 0xfed6, 0xfed6, 0xfed6, 0xfed7, 0xfef7, 0xfed7, 0xfed7, 0xfef7, 0xc531, 0xe655, 0xfef7, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed6, 0xfed7, 0xfef7, 0xf696, 0xde14, 0xbd11, 0xac6e, 0x936a, 0xbc2d, 0xe4cf, 0xcc8e, 0x9349, 0x5182, 0x4961, 0xde14, 0xfed6, 0xfed6, 0xfed7, 0xfed7, 0xfed7, 0xfef7, 0xfed7, 0xfef7, 0xfed7, 0xff3a, 0xff5a, 0xfef7, 0xfef7, 0xfef7, 0xcdd4, 0x29a7, 0x2a0b, 0x2a0b, 0x2a0b, 0x1946, 0x5aca, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf73a, 0xf739, 0x732a, 0xa3c6, 0xabc6, 0x9345, 0xabc6, 0xabc6, 0xac06, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xa3a6, 0xac06, 0xbc67, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xabc6, 0xabc6, 0xabc5, 0x9ba6, 0xdd49, 0xdd49, 0xdd49, 0x7b05, 0xad33, 0x8326, 0xdd49, 0xdd4a, 0x9bc7, 0xb573, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x9c6f, 0xb488, 0xdd49, 0xccc8, 0xabe6, 0x82c4, 0xbd94, 0x8c2e, 0xbd11, 0xfed7, 0xfe95, 0xff7b, 0xff18, 0xfed7, 0xfed7, 0xfed7, 0xfed7, 0xfed7, 0xfef7, 0xfef7, 0xf6b7, 0x4920, 0x5181, 0x6a66, 0xa42d, 0xbcd0, 0xd5b3, 0xde14, 0xcd72, 0xb4af, 0xac4d, 0xa3ab, 0xc44d, 0xe530, 0xf551, 0xf530, 0xf530, 0xf530, 0xf510, 0xf510, 0xf510, 0xe510, 0x6204, 0x8b6a, 0xfed6, 0xfed7, 0xfed7, 0xfed7, 0xfef7, 0xfef7, 0xfed7, 0xfef7, 0xf676, 0xff5a, 0xff7b, 0xfef7, 0xfef7, 0xacf1, 0x2166, 0x2a0b, 0x2a0b, 0x2a0b, 0x1105, 0x632c, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf73a, 0xf739, 0x6b09, 0xabe6, 0xb406, 0x9324, 0xabc6, 0xabe6, 0xb427, 0xdd49, 0xdd49, 0xdd49, 0xd529, 0xa3a5, 0xabe6, 0xbc67, 0xdd49, 0xdd49, 0xdd49, 0xd549, 0xa3c6, 0xabc6, 0xabc6, 0x9324, 0xdd6a, 0xdd49, 0xdd49, 0x93a6, 0xb553, 0x5a67, 0xdd6a, 0xdd49, 0xd56a, 0x732a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x944e, 0xbc89, 0xdd49, 0xdd4a, 0xabe6, 0x7264, 0xde97, 0xde77, 0x6aa7, 0xfed7, 0xfe95, 0xff7b, 0xff7a, 0xfed7, 0xfef7, 0xfed7, 0xfed7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0x5182, 0x7a25, 0xd42d, 0xdc2d, 0xdc4d, 0xdc6d, 0xcc4d, 0xdccf, 0xf551, 0xf530, 0xf530, 0xf530, 0xf530, 0xf530, 0xf530, 0xf530, 0xf530, 0xf530, 0xf530, 0xf510, 0xed10, 0xd4af, 0x6245, 0xfef7, 0xfef7, 0xfed7, 0xfef7, 0xfef7, 0xfef7, 0xfed7, 0xfef7, 0xe5f2, 0xf73a, 0xf696, 0xfef7, 0x83ad, 0x2188, 0x2a2b, 0x2a0b, 0x2a0b, 0x1105, 0x7bad, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xf73a, 0x62c8, 0xabe6, 0xabc6, 0x9344, 0xabc6, 0xabe6, 0xc4a8, 0xdd49, 0xdd49, 0xdd49, 0xc4c8, 0xa3a5, 0xabe6, 0xbc67, 0xdd49, 0xdd49, 0xdd49, 0xcd09, 0xabc6, 0xabc6, 0xabc5, 0x9324, 0xd529, 0xdd49, 0xdd49, 0xac27, 0x9c6f, 0xa4d1, 0xa407, 0xdd49, 0xdd4a, 0x72e6, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x9c4e, 0xbc89, 0xd529, 0xdd6a, 0xc488, 0x6223, 0xef19, 0xf73a, 0x732a, 0xd5d4, 0xfed7, 0xff19, 0xff9c, 0xfeb6, 0xfed7, 0xfef7, 0xfed7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0x72c7, 0xbbcb, 0xdc2d, 0xecaf, 0xf510, 0xf510, 0xf510, 0xf510, 0xf510, 0xf510, 0xf530, 0xf530, 0xf530, 0xf530, 0xf530, 0xf530, 0xf510, 0xf530, 0xf510, 0xf510, 0xf530, 0xf531, 0x6a87, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfed7, 0xee13, 0xde35, 0x4a48, 0x29ca, 0x2a0b, 0x2a0b, 0x2a0a, 0x2103, 0x732b, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0x5246, 0xb3e6, 0x9b85, 0xa385, 0xabe6, 0x9b65, 0xdd69, 0xdd49, 0xdd49, 0xdd49, 0xbc67, 0xa3a5, 0xabe6, 0xbc67, 0xdd49, 0xdd49, 0xdd49, 0xccc8, 0xabc6, 0xabc6, 0xabc6, 0x9b85, 0xbc47, 0xdd49, 0xdd49, 0xc4c9, 0x7b6b, 0xef19, 0x6285, 0xdd6a, 0xdd49, 0xa407, 0xb573, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x9c6f, 0xb489, 0xd509, 0xdd6a, 0xd509, 0x6244, 0xf75a, 0xf73a, 0xd636, 0x6287, 0xfef7, 0xee75, 0xe635, 0xfeb6, 0xfed7, 0xfed7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0x836a, 0xd48e, 0xf510, 0xed10, 0xf510, 0xf510, 0xf510, 0xf510, 0xf510, 0xf510, 0xf530, 0xf530, 0xf510, 0xf530, 0xf530, 0xf510, 0xf530, 0xf530, 0xf530, 0xf510, 0xf530, 0xed51, 0x7309, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfed7, 0x8bee, 0x2167, 0x2a0b, 0x2a0b, 0x2a0b, 0x29c9, 0x28e2, 0x8b05, 0x62a8, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0xf73a, 0xf75a, 0x5205, 0xabe6, 0x9324, 0xabe6, 0xabe6, 0xa3c6, 0xdd49, 0xdd49, 0xdd49, 0xdd49, 0xabe6, 0xa385, 0xabe6, 0xbc67, 0xdd49, 0xdd49, 0xdd49, 0xc487, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0x9ba6, 0xdd49, 0xdd49, 0xdd4a, 0x6288, 0xf73a, 0x83ac, 0xcd0a, 0xdd6a, 0xcd2a, 0x7b8c, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xa4d1, 0xac68, 0xcd08, 0xdd6a, 0xdd6a, 0x6245, 0xf75b, 0xf73a, 0xf73a, 0x7b6b, 0xb4f0, 0xfef7, 0xfed6, 0xfed7, 0xfef7, 0xfed7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xbd10, 0xb3ec, 0xed10, 0xed10, 0xf510, 0xf510, 0xf510, 0xf510, 0xf510, 0xf510, 0xf510, 0xf530, 0xf530, 0xf530, 0xf530, 0xf510, 0xf530, 0xf530, 0xf530, 0xf530, 0xf510, 0xabcc, 0xb4f0, 0xfef7, 0xff17, 0xff18, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xb511, 0x39c7, 0x29ca, 0x2a0b, 0x2a0b, 0x2a2b, 0x2166, 0x3942, 0x9366, 0xa3c6, 0x6a43, 0xd636, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf73a, 0xf73a, 0xf75a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0xf73a, 0xf75a, 0x4982, 0xabe6, 0x9324, 0xabe6, 0xabe6, 0xb427, 0xdd49, 0xdd49, 0xdd49, 0xcce8, 0xac06, 0x9b65, 0xabe6, 0xc487, 0xdd49, 0xdd49, 0xdd49, 0xb447, 0xabc6, 0xabc6, 0xa3c5, 0xabe6, 0x8b25, 0xdd49, 0xdd49, 0xdd6a, 0x5225, 0xf73a, 0xc5f5, 0x8b66, 0xdd4a, 0xdd8a, 0x6ac8, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xad11, 0xa428, 0xcce9, 0xdd6a, 0xdd6a, 0x6aa6, 0xf75b, 0xf73a, 0xf73a, 0xe6f9, 0x5205, 0xe655, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0x7b29, 0xe510, 0xed10, 0xed10, 0xe510, 0xed10, 0xf571, 0xf572, 0xf571, 0xf551, 0xed30, 0xdcce, 0xd48e, 0xdcef, 0xf551, 0xf571, 0xed30, 0xed30, 0xed31, 0xabcc, 0x72e8, 0xfef7, 0xfef7, 0xff18, 0xff39, 0xfef7, 0xfef7, 0xe655, 0x5269, 0x2188, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x18e3, 0x4142, 0x59c2, 0xa3c6, 0xabc6, 0xa3a6, 0x6267, 0xef19, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0x51a2, 0xabc6, 0x9324, 0xabe6, 0xa3a5, 0xcce8, 0xdd49, 0xdd49, 0xdd49, 0xbc67, 0xabe6, 0xa385, 0xabe6, 0xc4a8, 0xdd49, 0xdd49, 0xdd49, 0xabc6, 0xa3c6, 0xa3c6, 0xa3c5, 0xabe6, 0x7ac4, 0xdd69, 0xdd49, 0xdd4a, 0x51e3, 0xf75a, 0xf73a, 0x6286, 0xdd6a, 0xdd6a, 0x6ac5, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xbdb4, 0x9bc7, 0xcce8, 0xdd6a, 0xdd4a, 0x6aa6, 0xf75b, 0xf75a, 0xf73a, 0xf73a, 0xce15, 0x5a26, 0xf6d7, 0xfef7, 0xfef7, 0xfef7, 0xfed7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xee96, 0x8b6b, 0x93ab, 0xac4e, 0xcd92, 0xfef7, 0xfed7, 0xfed7, 0xfef7, 0xfef7, 0xfef7, 0xff18, 0xf696, 0xbd31, 0x93cc, 0x72e9, 0x72a7, 0x6a66, 0x6a87, 0xa46e, 0xfef7, 0xfef7, 0xfef7, 0xff18, 0xff3a, 0xff17, 0xe676, 0x2966, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x21a8, 0x3102, 0xac0b, 0x6a46, 0xbd73, 0x5a04, 0x8b25, 0xabe6, 0x9345, 0x6287, 0xd657, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0xf73a, 0xde98, 0x6203, 0xabe6, 0x9324, 0xabe6, 0xa3c6, 0xdd49, 0xdd49, 0xdd49, 0xd529, 0xabe6, 0x9b65, 0xabe6, 0xabc6, 0xccc8, 0xdd49, 0xdd49, 0xcce8, 0xabc6, 0xabc6, 0xabc6, 0xa3c5, 0xabe6, 0x7263, 0xdd49, 0xdd49, 0xdd49, 0x51e2, 0xf73a, 0xf73a, 0x8bed, 0xc4e9, 0xdd6a, 0x8b66, 0xce36, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xde97, 0x8325, 0xcce9, 0xdd6a, 0xdd6a, 0x6aa6, 0xf75b, 0xf75a, 0xf73a, 0xf73a, 0xf739, 0xb553, 0x6287, 0xf6d7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfed7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfed7, 0xfef7, 0xfef8, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xff39, 0xf719, 0xff18, 0x83ad, 0x21a9, 0x2a0b, 0x2a0b, 0x2a0b, 0x1904, 0x5205, 0xd4ee, 0xe550, 0x5a05, 0xf73a, 0xe6f9, 0x8c0e, 0x5a04, 0x7284, 0x8305, 0x49a2, 0x6287, 0x83ac, 0xb553, 0xf739, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0xbdb4, 0x7283, 0xa3c6, 0x9344, 0xabe6, 0xb427, 0xdd49, 0xdd49, 0xdd49, 0xc487, 0xabe6, 0x9b65, 0xabe6, 0xabe6, 0xcce8, 0xdd49, 0xdd49, 0xc487, 0xabc6, 0xa3a5, 0xa3c6, 0xabc6, 0xabe6, 0x6a43, 0xcd09, 0xdd49, 0xdd49, 0x51e2, 0xef5a, 0xf73a, 0xce15, 0x8b66, 0xdd4a, 0xa427, 0xb533, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xef3a, 0x6285, 0xc4c9, 0xdd8c, 0xe5ce, 0x72c6, 0xf77b, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf739, 0xb553, 0x5a66, 0xe655, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfed6, 0xfeb6, 0xfef7, 0xfeb6, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xff18, 0xff59, 0xf6d8, 0xff38, 0x5aa9, 0x2a0b, 0x2a0b, 0x2167, 0x20c2, 0x9369, 0xe52f, 0xe50f, 0xdd0f, 0x62a8, 0xf739, 0xf73a, 0xf73a, 0xf73a, 0xc5d5, 0xa4d0, 0xa48f, 0xad12, 0xde98, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xa4d0, 0x82e4, 0x9344, 0xabc6, 0xa385, 0xd529, 0xdd49, 0xdd49, 0xd529, 0xabe6, 0xabe6, 0x9b65, 0xabe6, 0xabc6, 0xd529, 0xdd49, 0xdd49, 0xb406, 0xabc6, 0xa3a5, 0xabc6, 0xabc5, 0xabe6, 0x6202, 0xccc8, 0xdd49, 0xdd49, 0x59e2, 0xf73a, 0xf73a, 0xf73a, 0x6265, 0xdd6a, 0xb488, 0x9c8f, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x62a7, 0xd54a, 0xcd4e, 0xe633, 0x72c5, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xd636, 0x5a67, 0xbd51, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xf654, 0xee13, 0xfef7, 0xe591, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfed8, 0xff7a, 0xee97, 0xfef7, 0x944e, 0x2145, 0x18a2, 0x49a3, 0xc48d, 0xe50f, 0xe50f, 0xe50f, 0xc48d, 0x8bcc, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0x83ac, 0x9365, 0x9324, 0xabc6, 0xac06, 0xdd49, 0xdd49, 0xdd49, 0xc488, 0xabe6, 0xac06, 0x9345, 0xabc6, 0xabc6, 0xdd69, 0xdd49, 0xd509, 0xabc6, 0xabe6, 0xa3a5, 0xabc5, 0xa3c5, 0xa385, 0x59e2, 0xc4a8, 0xdd49, 0xdd4a, 0x51c2, 0xf75a, 0xf75a, 0xf73a, 0x734b, 0xd56a, 0xc4e9, 0x8c0e, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x734a, 0xdd6a, 0xd529, 0xd509, 0x72e5, 0xef1a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xef19, 0x7b6b, 0x8bcb, 0xfed7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xf675, 0xee34, 0xfef7, 0xf675, 0xe5d2, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xe5f3, 0xeed8, 0xee34, 0xfef7, 0xe635, 0x6a66, 0x8b08, 0xdd0f, 0xe50f, 0xe50f, 0xe50f, 0xe52f, 0xb40c, 0x9c4f, 0xf73a, 0xf739, 0xf73a, 0xf73a, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0x5a87, 0xb427, 0x8b04, 0xa3a5, 0xcce8, 0xdd49, 0xdd49, 0xd529, 0xabe6, 0xabe6, 0x9365, 0xabe6, 0xabc6, 0xb427, 0xdd49, 0xdd49, 0xbc67, 0xabc6, 0xabc6, 0x9b65, 0xa3c6, 0xabc6, 0x9345, 0x59e2, 0xc487, 0xdd49, 0xd529, 0x51c2, 0xf73a, 0xf73a, 0xf73a, 0xa4d1, 0xac28, 0xd54a, 0x7b6b, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xa4d1, 0xac48, 0xdd6a, 0xdd6a, 0x8b66, 0xd656, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xacd0, 0x6266, 0xd5d3, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfeb6, 0xfed6, 0xfef7, 0xfef7, 0xfed7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfed6, 0xee13, 0xfef7, 0xacaf, 0x59e4, 0xbc6d, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xa3cb, 0x2123, 0x31a6, 0x6b4c, 0xc5f5, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xf75a, 0xf73a, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xef3a, 0x49a2, 0x9b85, 0xa3a5, 0xa3c6, 0xdd49, 0xdd49, 0xdd49, 0xbc67, 0xabe6, 0xabe6, 0x9345, 0xabe6, 0xabe6, 0xbc67, 0xdd49, 0xd549, 0xabe6, 0xabc6, 0xabe6, 0x9b65, 0xa3c6, 0xa3c5, 0x7ac4, 0x51c2, 0xbc67, 0xdd49, 0xcce8, 0x51e3, 0xf75a, 0xf75a, 0xf73a, 0xd677, 0x8325, 0xdd8a, 0x732b, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xd677, 0x7b26, 0xdd6a, 0xdd6a, 0x9be7, 0xb553, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf739, 0xf739, 0xd656, 0x59c3, 0xddb2, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xf6b6, 0xa42c, 0x7ac6, 0xdd0f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xa3aa, 0x2146, 0x2188, 0x1967, 0x10c4, 0x632c, 0xf73a, 0xf73a, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xce15, 0x6a43, 0x9325, 0x9b85, 0xcce8, 0xdd49, 0xdd49, 0xd509, 0xabe6, 0xabe6, 0xb406, 0x8b04, 0xabe6, 0xabc6, 0xc4a8, 0xdd49, 0xc4a8, 0xabc6, 0xabc6, 0xa3a5, 0xa385, 0xa3c6, 0xabc6, 0x6223, 0x6aa7, 0xbc67, 0xdd49, 0xc4c8, 0x51e4, 0xf75a, 0xf75a, 0xf73a, 0xef3a, 0x59e2, 0xdd6a, 0x734b, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x6287, 0xdd8a, 0xdd6a, 0xb488, 0x9c6f, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf739, 0xf739, 0xf739, 0x9c6e, 0xddf4, 0xc4ef, 0xf6b6, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfed7, 0xe5f3, 0xddb2, 0xc511, 0xe52f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0x9baa, 0x2146, 0x2167, 0x1105, 0x1926, 0x1926, 0x9491, 0xf73a, 0xf75a, 0xf73a, 0xf75a, 0xf73a, 0xf75a, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0x9c6f, 0x8b05, 0x9325, 0xa3a6, 0xdd49, 0xdd49, 0xdd49, 0xb426, 0xabe6, 0xabe6, 0x9325, 0xabe6, 0xabe6, 0xabc6, 0xd509, 0xdd49, 0xac06, 0xabc6, 0xabc6, 0x9344, 0xabc6, 0xa3c5, 0xabc6, 0x5a25, 0x6aa7, 0xbc67, 0xdd49, 0xc488, 0x5a47, 0xf73a, 0xf73a, 0xf75a, 0xe6b8, 0x4161, 0xc488, 0x732b, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x9c6f, 0xac68, 0xdd6a, 0xd54a, 0x7b6b, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf739, 0xf739, 0xf739, 0xacd1, 0xe677, 0xddb3, 0x7ae7, 0xde14, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xb4cf, 0x6a45, 0xe5f3, 0xf6b7, 0xb4d0, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xabca, 0x2145, 0x1105, 0x1105, 0x2167, 0x2167, 0x632c, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0xf73a, 0xf73a, 0x6287, 0x9b65, 0x9b65, 0xd509, 0xdd49, 0xdd49, 0xbc87, 0xabe6, 0xabe6, 0xabe6, 0x8b04, 0xabe6, 0xabe6, 0xabe6, 0xdd49, 0xc4a8, 0xabc6, 0xa3c6, 0xa3c6, 0x9b45, 0xabc6, 0xa3c5, 0xa3c6, 0x734b, 0x6245, 0xbc47, 0xdd49, 0xabe6, 0x732a, 0xf73a, 0xf75a, 0xf75a, 0xc5f5, 0x3900, 0xac07, 0x83ac, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xe6d9, 0x6285, 0xdd6a, 0xdd8a, 0x6287, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf739, 0xd636, 0xb4f2, 0xde35, 0x93ab, 0x5a25, 0xc551, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xbd31, 0x6224, 0x61a2, 0x9b8a, 0xee56, 0xf6d9, 0xa3ab, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50e, 0xe50f, 0xe50e, 0xe50f, 0xdd0e, 0xabeb, 0x18c2, 0x1926, 0x1967, 0x2167, 0x2167, 0x5aeb, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf73a, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0xf73a, 0xf75a, 0xf75a, 0xdeb8, 0x51c2, 0x9325, 0xac07, 0xdd49, 0xdd49, 0xccc8, 0xabe6, 0xabe6, 0xabe6, 0x9345, 0x9b85, 0xabe6, 0xabe6, 0xb447, 0xd529, 0xac06, 0xabc6, 0xabc6, 0xa3c5, 0x9345, 0xa3a5, 0xa3c6, 0x82e5, 0xa4f2, 0x51e3, 0xb447, 0xd529, 0x8b25, 0x940e, 0xf75a, 0xf75a, 0xf75a, 0xad12, 0x4981, 0x9366, 0x944e, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x942e, 0xb469, 0xdd6a, 0x6ac5, 0xef1a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0x8c0e, 0x83ad, 0x942e, 0xeef9, 0x732a, 0x9c0d, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xbd11, 0x6a45, 0x61e2, 0x82e6, 0xd4ce, 0xd4ce, 0xac2d, 0x9bcb, 0xd4ae, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50e, 0xd4ee, 0x7ac8, 0x2104, 0x21a9, 0x2168, 0x2167, 0x2167, 0x2167, 0x5aeb, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0x944e, 0x7ac4, 0x9345, 0xd529, 0xdd49, 0xcce8, 0xabe6, 0xabe6, 0xabe6, 0xabe6, 0x7283, 0xabe6, 0xabe6, 0xabe6, 0xc4a8, 0xbc67, 0xabe6, 0xabc6, 0xabc6, 0xa3c6, 0x9324, 0xa3c5, 0xa3c6, 0x6223, 0xd657, 0x6203, 0xbc47, 0xc4a8, 0x7aa4, 0xad32, 0xf75a, 0xf75a, 0xf75a, 0x8bed, 0x6a64, 0x7aa4, 0xad12, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xef19, 0x6266, 0xdd6a, 0x9be7, 0xad32, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf739, 0xf75a, 0xf739, 0xf739, 0xf73a, 0xa4b0, 0x72c8, 0xf6b6, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xfef7, 0xf6b6, 0xac8f, 0x6204, 0x59a2, 0x82a5, 0xa3ca, 0xe52f, 0xe50f, 0xe50f, 0xe52f, 0xe52f, 0xe50f, 0xe50f, 0xe50f, 0xe50e, 0xe50f, 0xdd0e, 0xd4ce, 0x7ae8, 0x2124, 0x21a9, 0x2a0b, 0x2a0b, 0x2168, 0x2168, 0x2167, 0x2167, 0x5b0b, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xef19, 0x49c3, 0x8b25, 0xcce9, 0xdd49, 0xcce8, 0xabe6, 0xabe6, 0xabe6, 0xabe6, 0x7263, 0xa385, 0xabc6, 0xabe6, 0xabe6, 0xcce8, 0xabe6, 0xabc6, 0xabc6, 0xa3c6, 0x9b65, 0xa3a5, 0xabc6, 0xabe6, 0x5a67, 0xce16, 0x7284, 0xbc67, 0xb406, 0x6203, 0xe6d8, 0xf75a, 0xf75a, 0xf73a, 0x6ac8, 0x82c4, 0x5a03, 0xce16, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xce15, 0x72e5, 0xd56b, 0x732a, 0xf73a, 0xf73a, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xc5d4, 0x5a26, 0xd5b3, 0xfef7, 0xfef7, 0xfef7, 0xfed7, 0xfef7, 0xcd72, 0x836a, 0x5182, 0x69e3, 0x7a85, 0x8b06, 0xc48d, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50e, 0xdd0e, 0xccad, 0x72c8, 0x2104, 0x29c9, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2188, 0x2168, 0x2167, 0x2167, 0x5aeb, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0x9c6f, 0x7264, 0xbc67, 0xdd49, 0xc4c8, 0xabe6, 0xabe6, 0xabe6, 0xabc6, 0x8304, 0x7263, 0xabc6, 0xabe6, 0xabc6, 0xb427, 0xabe6, 0xabe6, 0xabc6, 0xabc6, 0xabc6, 0x9324, 0xabc6, 0xabc6, 0x8b25, 0x946f, 0xa4d1, 0x82e4, 0xb406, 0xb406, 0x51e4, 0xf75a, 0xf75a, 0xf73a, 0xeef9, 0x5a03, 0x7aa4, 0x4982, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xacf1, 0x8ba7, 0x7b06, 0xde98, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0x8c2f, 0x10e5, 0x2903, 0x6267, 0x93cc, 0x9c0d, 0x7b29, 0x4982, 0x5161, 0x6a03, 0x7a64, 0x82c5, 0x9368, 0xd4ce, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50e, 0xe50f, 0xac0b, 0x5a26, 0x18e4, 0x21a8, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21c9, 0x2168, 0x1967, 0x2168, 0x5acb, 0xf73a, 0xf75a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xd677, 0x4982, 0xbc68, 0xd529, 0xbc67, 0xabe6, 0xabe6, 0xabe6, 0xabc6, 0x9325, 0x4961, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabe6, 0xabe6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0x8b24, 0xabc6, 0xabc6, 0x6a43, 0xde97, 0x736b, 0xa3c6, 0xabe6, 0x9b86, 0x7b6b, 0xf73a, 0xf75a, 0xf73a, 0xad32, 0x82e5, 0x7aa4, 0x6ac8, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x9c90, 0x7b06, 0x83ac, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xb574, 0x1105, 0x2188, 0x1967, 0x2167, 0x2146, 0x2146, 0x2966, 0x5161, 0x7223, 0x8284, 0x82c6, 0xb40b, 0xe52f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xdd0e, 0xccad, 0x8308, 0x3143, 0x1904, 0x21a9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x2188, 0x1967, 0x2188, 0x52aa, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xeef9, 0x5a46, 0xb468, 0xcce9, 0xb406, 0xabe6, 0xabe6, 0xabe6, 0xabe6, 0x8b25, 0x3920, 0x82e4, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0x9b65, 0xa385, 0xa3c6, 0xabe6, 0x5a46, 0xf75a, 0x5a45, 0xabc6, 0xabe6, 0x72a4, 0xb553, 0xf73a, 0xf73a, 0xf73a, 0x6ae9, 0xabe7, 0x7263, 0x9c6f, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xad12, 0x4162, 0xce16, 0xf73a, 0xf73a, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0x39e7, 0x2188, 0x1967, 0x1967, 0x2167, 0x2188, 0x2188, 0x2188, 0x4121, 0x7224, 0xa3a9, 0xd4ee, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xd4ce, 0x9349, 0x49c5, 0x18e4, 0x1946, 0x21a8, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0a, 0x2168, 0x2188, 0x2188, 0x39c7, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0xeef9, 0x6287, 0x9bc7, 0xbc47, 0xabe6, 0xabe6, 0xabe6, 0xabc6, 0xabe6, 0x7ac4, 0x62a8, 0x5204, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0x9324, 0xa3c6, 0xa3c5, 0x9b65, 0x8c0e, 0xd657, 0x6a64, 0xa3c6, 0xabe6, 0x49c3, 0xef3a, 0xf73a, 0xf73a, 0xd677, 0x6a44, 0xabc6, 0x6203, 0xdeb8, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0xf73a, 0xde77, 0x9c70, 0xde97, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0x10e4, 0x2167, 0x2188, 0x1105, 0x1105, 0x2167, 0x2188, 0x2188, 0x3123, 0xdd30, 0xe50f, 0xe50f, 0xe50f, 0xe50f, 0xdd0f, 0xb42c, 0x7ae8, 0x41a4, 0x18e3, 0x1946, 0x2188, 0x21a8, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2188, 0x2188, 0x2188, 0x10c4, 0xef3a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xd657, 0x5a46, 0x9365, 0xabe6, 0xabe6, 0xabe6, 0xabc6, 0xabc6, 0xa3c6, 0x6203, 0x83ac, 0xa4d1, 0x7aa4, 0xa3c6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xa3a5, 0x9324, 0xa3a5, 0xa3a5, 0x7284, 0xce37, 0x944f, 0x9345, 0xabc6, 0x9b86, 0x7309, 0xf73a, 0xf73a, 0xf73a, 0x7b8b, 0xa3a6, 0xabc6, 0x62a8, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xe6d8, 0xef19, 0xf73a, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf75b, 0x10e4, 0x2168, 0x2167, 0x2168, 0x1967, 0x10e5, 0x10e4, 0x1105, 0x2103, 0x8b6a, 0xa3cb, 0x9369, 0x72a8, 0x49c5, 0x18c3, 0x1925, 0x1946, 0x2188, 0x2188, 0x21a8, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x1968, 0x2188, 0x2168, 0x10e5, 0xb554, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf73a, 0xf73a, 0xf75a, 0xd656, 0x838c, 0x59e3, 0xa3a6, 0xabc6, 0xabc6, 0xabc6, 0xabe6, 0xabe6, 0x82e5, 0x51e4, 0xb573, 0xf73a, 0x5205, 0xa3c6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xa3a5, 0xa3a5, 0x8b24, 0xa3c6, 0xa3a5, 0xa3c6, 0x6265, 0xf75a, 0x5a46, 0xabe6, 0xabc6, 0x7284, 0xb553, 0xf73a, 0xf73a, 0xce16, 0x6a64, 0xabc6, 0x82e5, 0xad12, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0x2966, 0x2188, 0x2167, 0x2188, 0x2188, 0x2188, 0x2188, 0x1946, 0x1105, 0x1926, 0x1926, 0x1105, 0x1947, 0x2188, 0x2188, 0x2188, 0x2188, 0x2188, 0x29ca, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2188, 0x2168, 0x2188, 0x1946, 0x2167, 0x8430, 0xf73a, 0xf75a, 0xf75a, 0xf73a, 0x9c90, 0x6ae9, 0x5a45, 0x7264, 0x9345, 0xabe6, 0xabc6, 0xabc6, 0xabe6, 0xa3a6, 0x82c4, 0x51c3, 0x8c0e, 0xef19, 0xf73a, 0xc5d5, 0x6223, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xa3c5, 0xa3a5, 0xa3a6, 0x8b04, 0xa3a5, 0xa3a5, 0xabe6, 0x7b6b, 0xbdb4, 0x7284, 0xabc6, 0xabe6, 0x51e4, 0xf73a, 0xf73a, 0xef19, 0x6266, 0xa3c6, 0xabc6, 0x5a45, 0xef3a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0x3a08, 0x2188, 0x2168, 0x1967, 0x2188, 0x2168, 0x2168, 0x1105, 0x2167, 0x2167, 0x1105, 0x2188, 0x2188, 0x2188, 0x2188, 0x2188, 0x21c9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2188, 0x2188, 0x1946, 0x21ca, 0x2a2c, 0x21ca, 0x6b6d, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xbd94, 0x7309, 0x51c3, 0x6223, 0x6a43, 0x6a43, 0x6223, 0x51c3, 0x6ac8, 0xa4b0, 0xef19, 0xf73a, 0xf73a, 0xf73a, 0x7b6b, 0x9325, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xa3c6, 0xabc6, 0xabc6, 0xa3c5, 0xa3c6, 0x9324, 0xa3a5, 0xa3a5, 0xa3a5, 0x9345, 0xa4d1, 0x6ae9, 0xa3c6, 0xabc6, 0x82e5, 0x944e, 0xf73a, 0xf73a, 0x7b4b, 0x9365, 0xabc6, 0x7ac4, 0xad11, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xf75a, 0xf73a, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf739, 0x52cb, 0x2188, 0x2168, 0x2168, 0x2168, 0x2167, 0x2188, 0x10e5, 0x2168, 0x1967, 0x1105, 0x2188, 0x2188, 0x2188, 0x21a9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2188, 0x1967, 0x1989, 0x2a2c, 0x222c, 0x222c, 0x21a9, 0x632c, 0xc5f5, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xde97, 0xce16, 0xce16, 0xe6b8, 0xf75b, 0xf739, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xef19, 0x4182, 0xabe6, 0xabc6, 0xa3c6, 0xabc6, 0xabc6, 0xabc6, 0xa3c6, 0xa3c5, 0xa3a5, 0xa3c5, 0x8b04, 0xa3a5, 0xa3a5, 0xa3a5, 0x7aa4, 0xad12, 0x6a64, 0xabc6, 0xabe6, 0x51e3, 0xe6f9, 0xf73a, 0x7b8c, 0x8b05, 0xabc6, 0xa3a6, 0x62a8, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0xe6d8, 0x31a7, 0x2188, 0x2167, 0x1967, 0x2168, 0x2168, 0x2188, 0x10e5, 0x1968, 0x2168, 0x1126, 0x2188, 0x2188, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x29ea, 0x2188, 0x1988, 0x2a2c, 0x222c, 0x222c, 0x222c, 0x2a2c, 0x2a2c, 0x1968, 0x39e8, 0x8c70, 0xde98, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xb553, 0x7284, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xa3c5, 0xabc6, 0xa3c6, 0xa3a5, 0xa3c6, 0x8b04, 0xa3a5, 0xa3a5, 0xa3a5, 0xa3a5, 0x6a85, 0x6b09, 0xa3a6, 0xa3c6, 0x8b25, 0x8c2e, 0xe6f9, 0x7309, 0x8b25, 0xabc6, 0xabc6, 0x5a04, 0xd677, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xe6f9, 0x8c30, 0x2187, 0x1126, 0x2188, 0x2167, 0x1967, 0x2168, 0x2168, 0x2188, 0x10e5, 0x2168, 0x2188, 0x1126, 0x21a9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a9, 0x19a9, 0x2a4c, 0x222c, 0x222c, 0x222c, 0x222c, 0x222c, 0x222c, 0x222c, 0x224c, 0x2a4d, 0x21ea, 0x424a, 0x840f, 0xc5d5, 0xf75a, 0xf73a, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x7b6b, 0x9345, 0xabc6, 0xabc6, 0xabc6, 0xabc6, 0xa3c6, 0xa3c6, 0xa3a5, 0xa3a5, 0x9b85, 0x9324, 0xa385, 0xa385, 0xa3a5, 0xa3a5, 0x6a64, 0x7aa4, 0xa3a6, 0xabc6, 0x5a04, 0xb594, 0x5a25, 0x9b65, 0xa3a6, 0xabc6, 0x6a64, 0xa4f1, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xe6f9, 0xad33, 0x5aec, 0x1967, 0x21eb, 0x2a4c, 0x1947, 0x2188, 0x1967, 0x1967, 0x1967, 0x2168, 0x2168, 0x1105, 0x2188, 0x2188, 0x1947, 0x322c, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a8, 0x21ea, 0x222c, 0x222c, 0x222c, 0x222c, 0x222c, 0x222c, 0x222d, 0x2aaf, 0x3332, 0x3b94, 0x3b74, 0x3b74, 0x3b94, 0x3b11, 0x2a2c, 0x2187, 0x52cb, 0x9491, 0xd677, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0xf73a, 0x49e4, 0xabe6, 0xabc6, 0xa3c6, 0xa3c6, 0xa3a5, 0xa3c5, 0xa3a5, 0xa3a5, 0xa3a5, 0x82e4, 0xa3a5, 0x9b85, 0xa385, 0xa385, 0xa3c6, 0x51a2, 0xabc6, 0xa3a5, 0x7ac4, 0x49a3, 0x6a64, 0xa3a6, 0xa3a6, 0xabc6, 0x82e4, 0x7b8c, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xf75a, 0xe6f9, 0xb574, 0x7bce, 0x3a08, 0x1126, 0x19a9, 0x2a4d, 0x2a4c, 0x2a2d, 0x2a4c, 0x1967, 0x2167, 0x1967, 0x1967, 0x1967, 0x1967, 0x2188, 0x1105, 0x21c9, 0x2a0b, 0x2188, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x29ca, 0x1967, 0x2a2c, 0x222c, 0x222c, 0x222c, 0x222c, 0x222c, 0x224d, 0x32d0, 0x3b73, 0x3374, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3b74, 0x3b94, 0x3b73, 0x2a8e, 0x21c9, 0x31c7, 0x738e, 0xb574, 0xeef9, 0xdeb8, 0x59e2, 0xabc6, 0xabc6, 0xa3c6, 0xa3c6, 0xa3c5, 0xa3a6, 0xa3a5, 0xa3a5, 0x8b04, 0xa385, 0xa385, 0x9b85, 0xa385, 0xa385, 0x9b65, 0x8b25, 0xa3a5, 0xa3a6, 0x59e2, 0xa3a6, 0xa3a5, 0xa3a5, 0xa3c6, 0x8b25, 0x6ae9, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xf75a, 0xe6d9, 0xb574, 0x8430, 0x5aeb, 0x29a7, 0x1126, 0x1989, 0x21eb, 0x2a4d, 0x2a4d, 0x222d, 0x222d, 0x222c, 0x2a4d, 0x2a4d, 0x1947, 0x1968, 0x1968, 0x2168, 0x1967, 0x2168, 0x2188, 0x1947, 0x2a2b, 0x2a2b, 0x21c9, 0x21ca, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x1967, 0x1967, 0x1988, 0x1967, 0x222c, 0x222c, 0x222c, 0x2a6e, 0x3311, 0x3b74, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3b74, 0x3b74, 0x3b94, 0x3311, 0x2a4c, 0x1988, 0x39e8, 0x5204, 0xabe6, 0xa3c6, 0xa3c6, 0xa3c6, 0xa3a5, 0xa3a5, 0xa3a5, 0x9344, 0x9345, 0xa385, 0xa385, 0x9b65, 0xa385, 0xa385, 0x8b04, 0xabc6, 0xa3c6, 0x6223, 0x9b86, 0xa3a5, 0xa3a5, 0xa3c6, 0x8b25, 0x6288, 0xef3a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xeef9, 0xad33, 0x6b4c, 0x31e8, 0x21a9, 0x2a2c, 0x32d0, 0x3b73, 0x3311, 0x224d, 0x224d, 0x222d, 0x222d, 0x2a4d, 0x222d, 0x222d, 0x2a4d, 0x2a4d, 0x21ca, 0x1926, 0x1926, 0x2188, 0x1988, 0x2188, 0x21c9, 0x2a0b, 0x1967, 0x322c, 0x2a0b, 0x2a0b, 0x21a9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x21ca, 0x1967, 0x1967, 0x2188, 0x2188, 0x2188, 0x2188, 0x1126, 0x1988, 0x3b11, 0x3b94, 0x3374, 0x3b74, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3374, 0x3b74, 0x3b74, 0x3b94, 0x3b94, 0x328e, 0x2987, 0x49e4, 0x9345, 0xa3c6, 0xa3a5, 0xa3a5, 0x9344, 0x9324, 0xa3a5, 0x9b85, 0xa385, 0x9b65, 0xa385, 0xa385, 0x82e4, 0xabe6, 0x8b25, 0x7aa4, 0xa3a6, 0xa3a5, 0xa3c6, 0x82e4, 0x62a8, 0xef19, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xb574, 0x5acb, 0x21c9, 0x2a8e, 0x3b53, 0x3b74, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3374, 0x3b74, 0x2ad0, 0x224d, 0x224d, 0x2a4d, 0x2a4d, 0x2a4d, 0x19a9, 0x1126, 0x1947, 0x1968, 0x1947, 0x1926, 0x21a9, 0x2a0b, 0x2a2b, 0x2a0b, 0x1988, 0x2a0b, 0x2a0b, 0x2a2c, 0x1967, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a8, 0x1967, 0x2188, 0x21c9, 0x29ea, 0x29ea, 0x29ea, 0x29ea, 0x29eb, 0x2a2b, 0x2a0b, 0x1968, 0x21ea, 0x32af, 0x3b94, 0x3b74, 0x3b74, 0x3b74, 0x3b94, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x32d0, 0x21ea, 0x21a9, 0x29ca, 0x1925, 0x41a3, 0x9366, 0x9345, 0x9324, 0xa385, 0x9b85, 0x9b65, 0x9b85, 0x9b65, 0xa385, 0xa3a5, 0x82c4, 0xabc6, 0x6223, 0xa3c6, 0xa3c6, 0xa3a6, 0x7aa4, 0x62c9, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xad33, 0x31c8, 0x1947, 0x3b73, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x3b53, 0x32af, 0x21ea, 0x1967, 0x1106, 0x1967, 0x2188, 0x2188, 0x2188, 0x2188, 0x1967, 0x1946, 0x21a9, 0x2a2b, 0x2a0b, 0x21c9, 0x21ca, 0x2a0b, 0x2a2b, 0x1967, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21c9, 0x2188, 0x2188, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x21ca, 0x1967, 0x21eb, 0x2a8e, 0x3b73, 0x3b94, 0x3b74, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x3374, 0x3b74, 0x3374, 0x3374, 0x3374, 0x3b74, 0x3374, 0x3b74, 0x2a6d, 0x21ea, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x29ea, 0x2103, 0x7aa4, 0xa3a5, 0x9b85, 0x9b85, 0x9b85, 0x9b85, 0x9345, 0xa385, 0xa385, 0x7ac4, 0x7284, 0x9b65, 0xa3c6, 0xa3c6, 0x6a43, 0x83ac, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xef3a, 0x6b4c, 0x2167, 0x2a0b, 0x2a8f, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3374, 0x3b74, 0x3b74, 0x3b74, 0x3b94, 0x3b94, 0x32d0, 0x222c, 0x21c9, 0x1967, 0x21a9, 0x21a9, 0x21a8, 0x2188, 0x2188, 0x2188, 0x21a8, 0x21ca, 0x21c9, 0x2188, 0x1967, 0x1926, 0x1967, 0x21c9, 0x21a8, 0x2a0b, 0x2a0b, 0x1967, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x21a9, 0x2188, 0x1988, 0x29ea, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0a, 0x1988, 0x21a9, 0x2a2c, 0x32f0, 0x3b94, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x3b74, 0x3b74, 0x3b94, 0x2a6d, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2104, 0x82e5, 0x9b85, 0x9b85, 0x9b85, 0x9b85, 0x9324, 0xa385, 0x9b65, 0x7263, 0x7284, 0xa3a6, 0x9b65, 0x51c3, 0xad12, 0xf75a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x5aeb, 0x21a8, 0x2a0b, 0x21a9, 0x3b94, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3b74, 0x3b94, 0x32af, 0x220b, 0x21a9, 0x1967, 0x21ca, 0x322c, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21c9, 0x2188, 0x2188, 0x1126, 0x1106, 0x21a9, 0x2a0b, 0x2188, 0x29ea, 0x29ea, 0x21a9, 0x1988, 0x1968, 0x1968, 0x1988, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x21c9, 0x21a9, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x322c, 0x21c9, 0x1968, 0x2a0b, 0x3311, 0x3b94, 0x3b94, 0x3374, 0x3b74, 0x3374, 0x3b74, 0x32af, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2903, 0x9345, 0xa385, 0xa385, 0x9b85, 0x8b04, 0xa3a5, 0x9b65, 0x51c2, 0xa3a6, 0x6a43, 0x6287, 0xd677, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x840f, 0x2167, 0x2a0b, 0x2a2b, 0x2a2c, 0x3b74, 0x3b74, 0x3b74, 0x3b94, 0x32d0, 0x21ea, 0x1968, 0x29ea, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x1926, 0x21c9, 0x21ca, 0x2188, 0x1105, 0x1947, 0x2188, 0x21ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0a, 0x21c9, 0x2188, 0x2188, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x21a9, 0x21a9, 0x32cf, 0x3b94, 0x3b74, 0x3b94, 0x3311, 0x21ca, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x29ea, 0x4982, 0xa3a6, 0xa385, 0x9b85, 0x9324, 0xa3a5, 0x9b65, 0x4161, 0x62a8, 0xb573, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xc5f6, 0x1905, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a8e, 0x3b74, 0x3b74, 0x3b11, 0x21a9, 0x29ea, 0x322c, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29eb, 0x21c9, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x1967, 0x2a0b, 0x2a0b, 0x2a0b, 0x1946, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x29ea, 0x2188, 0x2188, 0x2188, 0x21c9, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x29ea, 0x21a9, 0x32f1, 0x3b94, 0x21ca, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2945, 0x8305, 0xa385, 0x9b85, 0xa385, 0x8b24, 0xa3a6, 0x7309, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x3a08, 0x2a0b, 0x2a2b, 0x2a2b, 0x21ca, 0x3311, 0x3b94, 0x2a4d, 0x21a9, 0x322c, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x2188, 0x21a9, 0x29ea, 0x2a0b, 0x2a0b, 0x21c9, 0x21a9, 0x2a0b, 0x2a0b, 0x2a2b, 0x1947, 0x2a0b, 0x2a2b, 0x29ea, 0x21c9, 0x2188, 0x2188, 0x2188, 0x21c9, 0x29eb, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x21c9, 0x21c9, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0a, 0x4182, 0xa3a5, 0xa385, 0xa385, 0x8ae4, 0xabc6, 0x5a67, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xa512, 0x1967, 0x2a0b, 0x2a2b, 0x2a0b, 0x2188, 0x3b74, 0x220b, 0x2a0a, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x2188, 0x2188, 0x2188, 0x21a9, 0x1947, 0x29ea, 0x2a0b, 0x2a0b, 0x21ca, 0x2188, 0x2a0b, 0x29ea, 0x2188, 0x2188, 0x21c9, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x21c9, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2124, 0x9366, 0xa385, 0xa385, 0x82c4, 0xa3c6, 0x5204, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x39e7, 0x322b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21c9, 0x2a2c, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a9, 0x2188, 0x2188, 0x1126, 0x21a9, 0x29ea, 0x2a0b, 0x1968, 0x29ca, 0x2a0b, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2188, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x29a8, 0x6a64, 0xa385, 0xa385, 0x9b45, 0x8b24, 0x5a03, 0xe6d8, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xbdb5, 0x1947, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2188, 0x21c9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x29ea, 0x1946, 0x1988, 0x2188, 0x21c9, 0x2a0b, 0x1947, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x21c9, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x4182, 0xa385, 0xa385, 0xa3a5, 0x7a83, 0x7aa4, 0xad12, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x5aeb, 0x2a0a, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x1967, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x1967, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x1968, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2188, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2902, 0xabc6, 0xa385, 0xa3a5, 0x9b65, 0x72a4, 0x5a46, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xe6f9, 0x1925, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x1967, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x21a9, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2188, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2188, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21c9, 0x29ea, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2124, 0x9b65, 0xa385, 0xa3a5, 0xa3a5, 0x82e4, 0x59c2, 0xa4b0, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xe6d8, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x9cd1, 0x2188, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x1947, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x29ea, 0x2188, 0x21a9, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x1967, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x1967, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2188, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2166, 0x8305, 0xa3a5, 0xa385, 0xa3a5, 0xa3c6, 0x82c4, 0x4141, 0xb573, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0xc5f5, 0xa4f1, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x52aa, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x1947, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2188, 0x2188, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x21a9, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x29ea, 0x21a9, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x21a9, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x21c9, 0x21c9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2187, 0x7ac4, 0xa3a5, 0xa3a5, 0xa3a5, 0xa3c6, 0xa3c6, 0x8b25, 0x4141, 0x8bed, 0xe6d9, 0xf73a, 0xf75a, 0xf73a, 0xef19, 0x942e, 0x49e5, 0xef1a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xef1a, 0x1905, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x1967, 0x2a2b, 0x2a0b, 0x2a0b, 0x21a9, 0x2188, 0x2188, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2188, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x1968, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2188, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x21ea, 0x2188, 0x21ca, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2188, 0x5a24, 0xa3c6, 0xa3c6, 0xa3c6, 0xa3c6, 0xa3a5, 0xa3c6, 0xabc6, 0x7284, 0x4982, 0x5a67, 0x7b6b, 0x6ae9, 0x49a3, 0x4162, 0xd657, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xb554, 0x2167, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x322c, 0x1947, 0x2a0b, 0x2a0b, 0x2a0b, 0x2188, 0x2188, 0x21c9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21ca, 0x29ea, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x1967, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x1988, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2188, 0x2188, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2188, 0x30e0, 0x5204, 0x8b25, 0xabe6, 0xa3c6, 0xa3c6, 0xa3a5, 0xa3c6, 0xa3c6, 0xabe6, 0xabe7, 0xabc6, 0x9b86, 0x5a04, 0xcdf5, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x73ae, 0x21a9, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x2a0b, 0x2a2b, 0x1947, 0x2a0b, 0x2a0b, 0x21c9, 0x2188, 0x1947, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2188, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a9, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x21a9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a9, 0x2188, 0x21a8, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2188, 0x5a24, 0x6b0a, 0x942f, 0x51e4, 0x7284, 0x9345, 0xa3c6, 0xabe6, 0xabe6, 0xa3a6, 0x82e5, 0x59e3, 0x7b6b, 0xe6d8, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x4228, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a8, 0x2a0b, 0x2a2b, 0x1947, 0x2a2b, 0x2a0b, 0x2188, 0x2188, 0x1967, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a9, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x1988, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x2a2c, 0x2a2c, 0x2a0b, 0x21ea, 0x21c9, 0x21a9, 0x21a9, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x1988, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x29ea, 0x2188, 0x2188, 0x21c9, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2188, 0x5a24, 0x9345, 0x7bac, 0xef3a, 0xb532, 0x838c, 0x62a8, 0x5a67, 0x6288, 0x734a, 0xa4b0, 0xe6d8, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x1905, 0x2a0b, 0x2a0b, 0x2a2b, 0x21a8, 0x2188, 0x2a2b, 0x2a0b, 0x1947, 0x2a0b, 0x21c9, 0x2188, 0x1947, 0x21a9, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2188, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2188, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a6d, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3b95, 0x43b5, 0x3b73, 0x32d0, 0x2a6e, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21c9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x1988, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x21a8, 0x2188, 0x2188, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2188, 0x5204, 0xa3c6, 0x9345, 0x7b4b, 0xef1a, 0xf73a, 0xf73a, 0xf739, 0xf73a, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xce36, 0x1926, 0x2a0b, 0x2a0b, 0x2a0b, 0x1967, 0x2188, 0x2a2b, 0x2a0b, 0x1946, 0x29ea, 0x2188, 0x2188, 0x1105, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2188, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2188, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a9, 0x3b73, 0x3b74, 0x3311, 0x3b73, 0x3b94, 0x3b74, 0x3374, 0x3b74, 0x3b74, 0x3b94, 0x21ca, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21c9, 0x21c9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a8, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x2188, 0x2188, 0x2188, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2167, 0x49e4, 0xabc6, 0xa3c6, 0x9b66, 0x6266, 0xbdb4, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xa4f2, 0x1967, 0x2a0b, 0x2a0b, 0x2a0b, 0x1947, 0x2188, 0x2a0b, 0x2a0b, 0x1926, 0x21a8, 0x2188, 0x1947, 0x2188, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2188, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x1968, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x3374, 0x3b74, 0x2188, 0x21a9, 0x1988, 0x2a2c, 0x2a4d, 0x3b74, 0x3b74, 0x32f0, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21ca, 0x2188, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2188, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a9, 0x2188, 0x2188, 0x21ca, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x1947, 0x49c4, 0xabc6, 0xabc6, 0xabc6, 0xabe6, 0x7aa4, 0x6287, 0x8bed, 0xacf1, 0xa4d1, 0xd657, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x7bce, 0x21a8, 0x2a0b, 0x2a0b, 0x2a0b, 0x1946, 0x2188, 0x29ea, 0x2a0b, 0x1946, 0x2188, 0x2188, 0x1105, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2188, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x29ea, 0x21a9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x32f0, 0x3b74, 0x32d0, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21ca, 0x3b94, 0x3b74, 0x2a4c, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21ca, 0x2188, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x1968, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2188, 0x2188, 0x1988, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x1947, 0x2102, 0x7264, 0x9345, 0xa3c6, 0xabe6, 0xabc6, 0x9b66, 0x7284, 0x5a46, 0xc5b4, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x52cb, 0x29ca, 0x2a0b, 0x2a0b, 0x2a0b, 0x1946, 0x2188, 0x21c9, 0x2a0b, 0x1947, 0x1967, 0x1926, 0x21c9, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x21a9, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x1988, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21ca, 0x3b94, 0x3b74, 0x2a2c, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a6d, 0x3b74, 0x3b94, 0x21a9, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x2188, 0x21c9, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x21a9, 0x2a0b, 0x2a2b, 0x2a0b, 0x29ea, 0x2188, 0x2188, 0x21a9, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x29ea, 0x1947, 0x5b0b, 0xc5f5, 0x942e, 0x6ae9, 0x62a8, 0x6ac8, 0x8bed, 0xbdb4, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x31c7, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x1946, 0x2188, 0x2188, 0x2a0b, 0x1967, 0x1926, 0x1926, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x1988, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x1967, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a6d, 0x3374, 0x3374, 0x3311, 0x2a8e, 0x2a2c, 0x2a2b, 0x21a9, 0x3b73, 0x3374, 0x32d0, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x2188, 0x21a9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2188, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a9, 0x2188, 0x1967, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x29ca, 0x1947, 0x6b4c, 0xf73a, 0xf75a, 0xf75a, 0xf73a, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75b, 0x10c4, 0x29ea, 0x2a0b, 0x2a0b, 0x2a2b, 0x1926, 0x2188, 0x2188, 0x21a8, 0x1967, 0x08a3, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x1988, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x21c9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x21a9, 0x3b53, 0x3374, 0x3374, 0x3b74, 0x3b74, 0x3b74, 0x3374, 0x3b94, 0x3374, 0x3374, 0x2a4d, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x1968, 0x2188, 0x2a0b, 0x2a0b, 0x2a0b, 0x1968, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2188, 0x2188, 0x2188, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a9, 0x1946, 0x73ae, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xe6b8, 0x10c4, 0x29ca, 0x2a0b, 0x2a0b, 0x2a0b, 0x1947, 0x2188, 0x2188, 0x2188, 0x1106, 0x1967, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x21c9, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x1988, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21c9, 0x2a6d, 0x2acf, 0x3311, 0x3b32, 0x3b73, 0x3b94, 0x43b5, 0x3b94, 0x3374, 0x3b94, 0x21ca, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x1968, 0x1967, 0x2a2c, 0x2a2b, 0x2a2b, 0x1988, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x2188, 0x1947, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2188, 0x1946, 0x7bce, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xce16, 0x1105, 0x21c9, 0x2a0b, 0x2a0b, 0x2a0b, 0x1988, 0x1967, 0x1968, 0x1967, 0x08c4, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x1988, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x1968, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x21ca, 0x21a9, 0x2188, 0x2188, 0x21a9, 0x2a0a, 0x2a4c, 0x2a4c, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a8, 0x1947, 0x2a0b, 0x2a0b, 0x2a2b, 0x1988, 0x2a2b, 0x2a0b, 0x2a0b, 0x21c9, 0x2188, 0x1967, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x29ea, 0x2188, 0x1926, 0x842f, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xad53, 0x1926, 0x21a9, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a9, 0x1926, 0x2168, 0x10e4, 0x21a9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x1968, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x21c9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x21a9, 0x1947, 0x29ea, 0x2a0b, 0x21c9, 0x21ca, 0x2a0b, 0x2a0b, 0x2a0b, 0x2188, 0x1946, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x29ca, 0x2188, 0x1926, 0x9491, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x8c50, 0x1946, 0x2188, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x10e5, 0x1947, 0x10e5, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a9, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x1988, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x1926, 0x21a9, 0x2a0b, 0x1968, 0x2a2b, 0x2a0b, 0x2a0b, 0x21ca, 0x2188, 0x2188, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a8, 0x2188, 0x1126, 0xa4f2, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x5acb, 0x2188, 0x2188, 0x29ea, 0x2a0b, 0x2a0b, 0x21ca, 0x10e5, 0x08c4, 0x21a9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x1988, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x1967, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x1947, 0x1967, 0x2a0b, 0x1968, 0x2a2b, 0x2a0b, 0x2a0b, 0x2188, 0x1926, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2188, 0x2188, 0x1105, 0xbd94, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf73a, 0x1925, 0x2188, 0x2188, 0x21c9, 0x2a0b, 0x2a0b, 0x21c9, 0x1105, 0x10e5, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x1967, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2188, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2188, 0x1947, 0x21ca, 0x2188, 0x2a0b, 0x2a0b, 0x29ea, 0x1967, 0x21c9, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x2168, 0x2188, 0x10e5, 0xce16, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xbdb5, 0x1105, 0x2168, 0x2188, 0x2188, 0x2a0b, 0x2a0a, 0x2188, 0x10c4, 0x2188, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x21ea, 0x21c9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2188, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x1105, 0x2188, 0x1946, 0x2a0b, 0x2a0b, 0x21a8, 0x1946, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a9, 0x2188, 0x2188, 0x10e4, 0xef3a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x738d, 0x1947, 0x1967, 0x2188, 0x2188, 0x21c9, 0x21a8, 0x1967, 0x08c4, 0x21a9, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x1968, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x1968, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x21a9, 0x1126, 0x2188, 0x1126, 0x2a0b, 0x21ca, 0x1926, 0x29ea, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2188, 0x2188, 0x2188, 0x1925, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0x2987, 0x2188, 0x2168, 0x2188, 0x2188, 0x2188, 0x2188, 0x1105, 0x1926, 0x29ea, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x1967, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x1967, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2188, 0x1967, 0x1947, 0x1106, 0x21c9, 0x1967, 0x1967, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x21ca, 0x2188, 0x2188, 0x2188, 0x2986, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xde98, 0x10e5, 0x2188, 0x2167, 0x2188, 0x2188, 0x2188, 0x2168, 0x08c4, 0x2188, 0x29eb, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x1947, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x21a9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2188, 0x2188, 0x1126, 0x1106, 0x2188, 0x1126, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2188, 0x2188, 0x2168, 0x2188, 0x4249, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 
-    0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xa512, 0x1926, 0x2167, 0x2188, 0x2167, 0x2188, 0x2167, 0x2188, 0x10c4, 0x2188, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x1988, 0x29ca, 0x2a0b, 0x2a0b, 0x2a0b, 0x2188, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a2b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a2b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x2188, 0x2188, 0x1946, 0x1126, 0x1947, 0x21c9, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x2a0b, 0x29ea, 0x2188, 0x2188, 0x2188, 0x2167, 0x632c, 0xf73a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a, 0xf75a
+static const uint8_t winkHotImageData[18013] PROGMEM = {
+    0xff, 0x00, 0x9f, 0x00, 0xff, 0x00, 0x9f, 0x00, 0xc3, 0x00, 0x81, 0x04, 0x00, 0x3d, 0x81, 0x04,
+    0x84, 0x44, 0x81, 0x00, 0x81, 0x04, 0xcd, 0x00, 0xbe, 0x00, 0x81, 0x04, 0x07, 0x00, 0x8a, 0xff,
+    0xbd, 0x94, 0xff, 0x8c, 0x70, 0xff, 0x6b, 0x6d, 0xff, 0x4a, 0x69, 0xff, 0x29, 0xa7, 0x6a, 0x82,
+    0x45, 0x09, 0x73, 0x6b, 0x6a, 0xdc, 0xff, 0x42, 0x49, 0x80, 0xff, 0x7b, 0xce, 0xff, 0x9c, 0xd2,
+    0x8b, 0x9d, 0x81, 0x04, 0xc7, 0x00, 0xbc, 0x00, 0x0a, 0x04, 0x5f, 0xff, 0xa5, 0x12, 0xdd, 0xde,
+    0x2a, 0x1a, 0x12, 0x1c, 0xc0, 0x25, 0x81, 0x01, 0x85, 0x02, 0x0a, 0xc0, 0x02, 0xc1, 0x09, 0x17,
+    0x45, 0xdf, 0xff, 0x73, 0xae, 0xff, 0xb5, 0x94, 0x44, 0x04, 0xc4, 0x00, 0xb7, 0x00, 0x81, 0x04,
+    0x0b, 0x00, 0x5a, 0xc2, 0xff, 0x52, 0x8a, 0x6b, 0x09, 0x11, 0xc0, 0x01, 0x11, 0x5b, 0x02, 0x83,
+    0x01, 0x81, 0x02, 0x81, 0x01, 0x81, 0x02, 0x00, 0x01, 0x84, 0x02, 0x06, 0x5c, 0x1c, 0x0d, 0x6c,
+    0xc3, 0xff, 0x9c, 0xb1, 0x8a, 0x83, 0x04, 0xbe, 0x00, 0xb6, 0x00, 0x81, 0x04, 0x04, 0xc4, 0xdd,
+    0x6b, 0x1f, 0x01, 0x83, 0x02, 0x01, 0x1c, 0x11, 0x83, 0x01, 0x00, 0x02, 0x83, 0x01, 0x01, 0x02,
+    0x01, 0x81, 0x02, 0x02, 0x01, 0x02, 0x01, 0x86, 0x02, 0x03, 0x09, 0x6c, 0xc3, 0xff, 0xb5, 0x54,
+    0x82, 0x04, 0xbd, 0x00, 0xb4, 0x00, 0x81, 0x04, 0x04, 0xff, 0xbd, 0xd5, 0xff, 0x4a, 0x8a, 0x20,
+    0x11, 0x02, 0x81, 0x01, 0x04, 0x02, 0x01, 0x02, 0x12, 0x11, 0x82, 0x01, 0x00, 0x02, 0x81, 0x01,
+    0x83, 0x02, 0x06, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x82, 0x02, 0x82, 0x01, 0x08, 0x02,
+    0x01, 0x02, 0x01, 0x0d, 0xff, 0x29, 0x87, 0xff, 0x8c, 0x50, 0x5f, 0x04, 0xbc, 0x00, 0xb3, 0x00,
+    0x04, 0x04, 0xff, 0xc5, 0xf6, 0xff, 0x4a, 0x6a, 0x1b, 0x01, 0x81, 0x02, 0x82, 0x01, 0x81, 0x02,
+    0x04, 0x12, 0x11, 0x02, 0x01, 0x02, 0x81, 0x01, 0x81, 0x02, 0x86, 0x01, 0x84, 0x02, 0x81, 0x01,
+    0x00, 0x02, 0x81, 0x01, 0x00, 0x02, 0x82, 0x01, 0x06, 0x02, 0x5c, 0x12, 0x6a, 0xae, 0x5f, 0x04,
+    0xba, 0x00, 0xb1, 0x00, 0x07, 0x04, 0x81, 0xff, 0x63, 0x0c, 0x20, 0x01, 0x02, 0x01, 0x02, 0x83,
+    0x01, 0x02, 0x02, 0x1c, 0x26, 0x81, 0x01, 0x00, 0x02, 0x81, 0x01, 0x01, 0x02, 0x01, 0x85, 0x02,
+    0x05, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x82, 0x01, 0x81, 0x02, 0x81, 0x01, 0x81, 0x02, 0x01,
+    0x01, 0x11, 0x81, 0x01, 0x04, 0x02, 0x12, 0x6a, 0xff, 0x8c, 0x50, 0x9d, 0xb9, 0x00, 0xaf, 0x00,
+    0x81, 0x04, 0x02, 0xff, 0x9c, 0xf2, 0x6a, 0x11, 0x86, 0x01, 0x00, 0x02, 0x81, 0x01, 0x00, 0x09,
+    0x81, 0x01, 0x00, 0x02, 0x82, 0x01, 0x81, 0x02, 0x00, 0x01, 0x84, 0x02, 0x01, 0x01, 0x02, 0x83,
+    0x01, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x81, 0x01, 0x81, 0x02, 0x04, 0x01, 0x02, 0x11, 0x60,
+    0x01, 0x81, 0x02, 0x03, 0x12, 0xff, 0x29, 0xa7, 0xff, 0xb5, 0x54, 0x04, 0x8c, 0x00, 0x00, 0x04,
+    0xa9, 0x00, 0xae, 0x00, 0x04, 0x04, 0x74, 0xc3, 0x0d, 0x02, 0x81, 0x01, 0x83, 0x02, 0x82, 0x01,
+    0x02, 0x02, 0x33, 0x02, 0x84, 0x01, 0x81, 0x02, 0x00, 0x01, 0x82, 0x02, 0x82, 0x01, 0x00, 0x02,
+    0x82, 0x01, 0x00, 0x02, 0x81, 0x01, 0x01, 0x02, 0x01, 0x81, 0x02, 0x84, 0x01, 0x01, 0x02, 0x01,
+    0x81, 0x11, 0x06, 0x01, 0x02, 0x01, 0xaf, 0x1b, 0xff, 0x52, 0xcb, 0x81, 0x86, 0x00, 0x08, 0xe0,
+    0xff, 0x8c, 0x0d, 0x66, 0x9e, 0xe1, 0xff, 0x52, 0x26, 0x8c, 0xb0, 0xff, 0xe6, 0xb8, 0xa6, 0x00,
+    0xad, 0x00, 0x03, 0x04, 0xff, 0xc5, 0xf6, 0xde, 0x11, 0x81, 0x02, 0x02, 0x01, 0x02, 0x01, 0x82,
+    0x02, 0x81, 0x01, 0x02, 0x02, 0x12, 0x11, 0x81, 0x02, 0x85, 0x01, 0x86, 0x02, 0x01, 0x01, 0x02,
+    0x81, 0x01, 0x01, 0x02, 0x01, 0x81, 0x02, 0x02, 0x01, 0x02, 0x01, 0x81, 0x02, 0x85, 0x01, 0x01,
+    0x4a, 0x11, 0x82, 0x01, 0x03, 0x02, 0x11, 0x6a, 0x8d, 0x81, 0x04, 0x81, 0x00, 0x0c, 0x79, 0xff,
+    0x52, 0x25, 0xe2, 0xff, 0xac, 0x28, 0x6d, 0xff, 0xe5, 0xcb, 0xff, 0xe5, 0xab, 0xff, 0xe5, 0xcb,
+    0x9f, 0xff, 0x93, 0xa7, 0xff, 0x52, 0x03, 0x6e, 0x81, 0xa4, 0x00, 0xad, 0x00, 0x02, 0xff, 0xa5,
+    0x13, 0x2a, 0x60, 0x82, 0x01, 0x81, 0x02, 0x81, 0x01, 0x00, 0x02, 0x81, 0x01, 0x81, 0x02, 0x00,
+    0x09, 0x81, 0x02, 0x81, 0x01, 0x00, 0x02, 0x82, 0x01, 0x01, 0x02, 0x01, 0x86, 0x02, 0x00, 0x01,
+    0x82, 0x02, 0x81, 0x01, 0x00, 0x02, 0x82, 0x01, 0x82, 0x02, 0x85, 0x01, 0x00, 0x12, 0x82, 0x01,
+    0x09, 0x02, 0x01, 0x02, 0x1a, 0xc5, 0xa0, 0x81, 0x66, 0xff, 0x72, 0xe5, 0x6d, 0x87, 0x0b, 0x03,
+    0x7a, 0xff, 0xac, 0x68, 0x82, 0x7b, 0xa3, 0x00, 0xab, 0x00, 0x03, 0x04, 0xff, 0x94, 0x70, 0x67,
+    0x60, 0x84, 0x01, 0x83, 0x02, 0x81, 0x01, 0x09, 0x02, 0x12, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+    0x01, 0x02, 0x81, 0x01, 0x84, 0x02, 0x00, 0x01, 0x81, 0x02, 0x00, 0x01, 0x83, 0x02, 0x81, 0x01,
+    0x81, 0x02, 0x82, 0x01, 0x01, 0x02, 0x01, 0x81, 0x02, 0x83, 0x01, 0x03, 0x36, 0x02, 0x01, 0x02,
+    0x81, 0x01, 0x04, 0x02, 0x11, 0xff, 0x31, 0xc7, 0xc6, 0xff, 0xb4, 0x69, 0x82, 0x0b, 0x00, 0x03,
+    0x81, 0x0b, 0x81, 0x27, 0x83, 0x0b, 0x02, 0xff, 0xd5, 0x6a, 0xe3, 0xff, 0x83, 0xcd, 0xa2, 0x00,
+    0xab, 0x00, 0x02, 0xff, 0x8c, 0x50, 0x73, 0x1c, 0x8b, 0x01, 0x01, 0x02, 0x09, 0x82, 0x01, 0x81,
+    0x02, 0x82, 0x01, 0x81, 0x02, 0x00, 0x01, 0x83, 0x02, 0x81, 0x01, 0x81, 0x02, 0x82, 0x01, 0x01,
+    0x02, 0x01, 0x81, 0x02, 0x82, 0x01, 0x81, 0x02, 0x85, 0x01, 0x02, 0x02, 0x1c, 0x11, 0x81, 0x01,
+    0x83, 0x02, 0x02, 0x01, 0xff, 0x21, 0x25, 0xff, 0xac, 0x69, 0x84, 0x0b, 0x82, 0x27, 0x81, 0x0b,
+    0x05, 0x03, 0x27, 0x03, 0x0b, 0xff, 0x7b, 0x25, 0xe4, 0xa1, 0x00, 0xa9, 0x00, 0x03, 0x04, 0xe5,
+    0x67, 0x36, 0x82, 0x01, 0x00, 0x02, 0x81, 0x01, 0x01, 0x02, 0x01, 0x81, 0x02, 0x81, 0x01, 0x00,
+    0x02, 0x81, 0x11, 0x81, 0x02, 0x81, 0x01, 0x83, 0x02, 0x82, 0x01, 0x82, 0x02, 0x81, 0x01, 0x02,
+    0x02, 0x01, 0x02, 0x82, 0x01, 0x05, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x81, 0x02, 0x00, 0x01,
+    0x82, 0x02, 0x01, 0x01, 0x02, 0x81, 0x01, 0x02, 0x02, 0x09, 0x02, 0x83, 0x01, 0x04, 0x02, 0x01,
+    0xaf, 0x6c, 0xff, 0xa4, 0x49, 0x83, 0x0b, 0x82, 0x03, 0x01, 0x27, 0x0b, 0x81, 0x03, 0x00, 0x27,
+    0x81, 0x0b, 0x01, 0xff, 0x72, 0xc5, 0xe6, 0xa0, 0x00, 0xa8, 0x00, 0x04, 0x04, 0xe7, 0x67, 0x1f,
+    0x4a, 0x87, 0x01, 0x02, 0x02, 0x01, 0x02, 0x81, 0x01, 0x00, 0x12, 0x84, 0x02, 0x82, 0x01, 0x87,
+    0x02, 0x00, 0x01, 0x82, 0x02, 0x81, 0x01, 0x81, 0x02, 0x00, 0x01, 0x85, 0x02, 0x00, 0x01, 0x81,
+    0x02, 0x01, 0x01, 0x02, 0x83, 0x01, 0x00, 0x12, 0x83, 0x01, 0x0a, 0x02, 0x01, 0x02, 0x01, 0x02,
+    0x6c, 0xff, 0xac, 0x89, 0x0b, 0x29, 0x37, 0xa1, 0x81, 0x61, 0x0a, 0x62, 0x29, 0x0b, 0x27, 0x03,
+    0x0b, 0x23, 0x0b, 0xff, 0x5a, 0x23, 0xc7, 0x04, 0x9e, 0x00, 0xa7, 0x00, 0x06, 0x04, 0xa2, 0x6b,
+    0x0d, 0x09, 0x01, 0x02, 0x83, 0x01, 0x00, 0x02, 0x83, 0x01, 0x82, 0x02, 0x01, 0x12, 0x01, 0x85,
+    0x02, 0x81, 0x01, 0x82, 0x02, 0x81, 0x01, 0x84, 0x02, 0x00, 0x01, 0x81, 0x02, 0x01, 0x01, 0x02,
+    0x84, 0x01, 0x02, 0x02, 0x01, 0x02, 0x81, 0x01, 0x00, 0x02, 0x84, 0x01, 0x03, 0x02, 0x09, 0x02,
+    0x01, 0x81, 0x02, 0x81, 0x01, 0x82, 0x02, 0x0a, 0x83, 0xff, 0xbc, 0xc9, 0x29, 0x23, 0x03, 0x23,
+    0x03, 0x0b, 0x61, 0x62, 0x29, 0x81, 0x0b, 0x04, 0x03, 0x0b, 0xff, 0xd5, 0x2a, 0xe1, 0xe8, 0x9e,
+    0x00, 0xa7, 0x00, 0x04, 0x44, 0xff, 0x39, 0xe8, 0x1b, 0x1f, 0x1c, 0x85, 0x01, 0x85, 0x02, 0x81,
+    0x01, 0x01, 0x11, 0x25, 0x81, 0x02, 0x02, 0x01, 0x02, 0x01, 0x82, 0x02, 0x00, 0x01, 0x84, 0x02,
+    0x00, 0x01, 0x81, 0x02, 0x81, 0x01, 0x81, 0x02, 0x81, 0x01, 0x00, 0x02, 0x84, 0x01, 0x01, 0x02,
+    0x01, 0x81, 0x02, 0x86, 0x01, 0x00, 0x12, 0x81, 0x01, 0x00, 0x02, 0x82, 0x01, 0x06, 0x02, 0x01,
+    0x02, 0x01, 0xff, 0x31, 0x84, 0x6d, 0x23, 0x84, 0x03, 0x02, 0x0b, 0x4c, 0xff, 0xbc, 0xa8, 0x82,
+    0x0b, 0x03, 0x03, 0xff, 0xac, 0x68, 0xb1, 0x04, 0x9d, 0x00, 0xa7, 0x00, 0x05, 0xae, 0x45, 0x1a,
+    0x1f, 0x01, 0x02, 0x81, 0x01, 0x00, 0x02, 0x81, 0x01, 0x04, 0x02, 0x01, 0x1c, 0x09, 0x1b, 0x81,
+    0xa3, 0x01, 0x2a, 0xa3, 0x81, 0x17, 0x83, 0x38, 0x05, 0x17, 0x0d, 0x12, 0x11, 0x02, 0x25, 0x81,
+    0x02, 0x02, 0x01, 0x02, 0x01, 0x81, 0x02, 0x00, 0x01, 0x82, 0x02, 0x03, 0x01, 0x02, 0x01, 0x02,
+    0x81, 0x01, 0x00, 0x02, 0x82, 0x01, 0x02, 0x02, 0x01, 0x02, 0x81, 0x01, 0x00, 0x02, 0x81, 0x01,
+    0x00, 0x12, 0x84, 0x01, 0x81, 0x02, 0x82, 0x01, 0x06, 0x1c, 0xff, 0x5a, 0x86, 0x0b, 0x03, 0x27,
+    0x03, 0x27, 0x81, 0x03, 0x02, 0x0b, 0x54, 0xa1, 0x83, 0x0b, 0x01, 0xff, 0x72, 0xc4, 0xe9, 0x9d,
+    0x00, 0xa6, 0x00, 0x07, 0xff, 0xce, 0x37, 0x67, 0x09, 0x1a, 0x12, 0x01, 0x02, 0x01, 0x81, 0x02,
+    0x09, 0x12, 0x20, 0x38, 0xb2, 0x2e, 0x4f, 0x55, 0x8e, 0x84, 0xb3, 0x84, 0x13, 0x0b, 0x84, 0xb3,
+    0x5d, 0x8f, 0x4d, 0xff, 0x22, 0x0c, 0x2d, 0xa3, 0x20, 0x36, 0x01, 0x5c, 0x82, 0x02, 0x00, 0x01,
+    0x81, 0x02, 0x03, 0x01, 0x02, 0x01, 0x02, 0x81, 0x01, 0x00, 0x02, 0x81, 0x01, 0x00, 0x02, 0x83,
+    0x01, 0x01, 0x02, 0x01, 0x82, 0x02, 0x05, 0x01, 0x12, 0x01, 0x02, 0x01, 0x02, 0x81, 0x01, 0x83,
+    0x02, 0x01, 0x20, 0xff, 0x93, 0xa7, 0x87, 0x03, 0x07, 0x6f, 0xff, 0xbc, 0xa8, 0x0b, 0x23, 0x0b,
+    0xea, 0xa4, 0x5a, 0x9c, 0x00, 0xa5, 0x00, 0x05, 0x04, 0xff, 0x42, 0x29, 0x1b, 0x1f, 0x1a, 0x11,
+    0x81, 0x02, 0x05, 0x12, 0x38, 0xb2, 0x4d, 0x47, 0xeb, 0x83, 0x07, 0x00, 0x08, 0x82, 0x07, 0x81,
+    0x08, 0x82, 0x07, 0x00, 0x08, 0x81, 0x07, 0x82, 0x13, 0x07, 0xb3, 0x47, 0xff, 0x32, 0xae, 0x26,
+    0x38, 0x1b, 0x1c, 0x5c, 0x82, 0x02, 0x00, 0x01, 0x81, 0x02, 0x00, 0x01, 0x81, 0x02, 0x01, 0x01,
+    0x02, 0x81, 0x01, 0x83, 0x02, 0x81, 0x01, 0x81, 0x02, 0x06, 0x01, 0x02, 0x09, 0x02, 0x01, 0x02,
+    0x01, 0x82, 0x02, 0x83, 0x01, 0x03, 0xc8, 0xec, 0x37, 0x23, 0x83, 0x03, 0x03, 0x0b, 0x23, 0x6f,
+    0x90, 0x81, 0x03, 0x02, 0x23, 0x91, 0xff, 0x94, 0x4f, 0x9c, 0x00, 0xa5, 0x00, 0x05, 0xff, 0xa5,
+    0x13, 0x73, 0x1f, 0x1a, 0x1f, 0x01, 0x81, 0x1b, 0x00, 0xa5, 0x81, 0x13, 0x00, 0x07, 0x83, 0x08,
+    0x00, 0x07, 0x82, 0x08, 0x00, 0x07, 0x82, 0x08, 0x81, 0x07, 0x00, 0x08, 0x82, 0x07, 0x85, 0x08,
+    0x09, 0x07, 0xeb, 0x56, 0x43, 0x0d, 0x20, 0x26, 0x25, 0x02, 0x01, 0x82, 0x02, 0x02, 0x01, 0x02,
+    0x01, 0x89, 0x02, 0x81, 0x01, 0x00, 0x12, 0x82, 0x01, 0x00, 0x02, 0x85, 0x01, 0x05, 0x02, 0x12,
+    0xb4, 0x0a, 0x4c, 0xa6, 0x84, 0x03, 0x02, 0x0b, 0x54, 0x29, 0x81, 0x03, 0x02, 0x6d, 0xa4, 0x44,
+    0x9b, 0x00, 0xa4, 0x00, 0x07, 0x44, 0xde, 0x0d, 0x1f, 0x0d, 0x45, 0x12, 0x55, 0x81, 0x13, 0x81,
+    0x08, 0x02, 0x07, 0x08, 0x07, 0x8a, 0x08, 0x00, 0x07, 0x86, 0x08, 0x00, 0x07, 0x85, 0x08, 0x05,
+    0x13, 0x5d, 0x63, 0x17, 0x0d, 0x01, 0x81, 0x02, 0x00, 0x01, 0x81, 0x02, 0x00, 0x01, 0x83, 0x02,
+    0x00, 0x01, 0x81, 0x02, 0x82, 0x01, 0x05, 0x02, 0x01, 0x12, 0x01, 0x02, 0x01, 0x83, 0x02, 0x81,
+    0x01, 0x81, 0x02, 0x04, 0x25, 0xff, 0x18, 0xe4, 0x16, 0x0a, 0x4c, 0x81, 0x03, 0x01, 0x0b, 0x03,
+    0x81, 0x23, 0x01, 0x0b, 0xa1, 0x82, 0x0b, 0x02, 0xff, 0x83, 0x25, 0xff, 0xa4, 0xd0, 0x04, 0x9a,
+    0x00, 0xa3, 0x00, 0x06, 0x04, 0xe5, 0x2a, 0x0d, 0x45, 0x38, 0xc9, 0x84, 0x07, 0x90, 0x08, 0x81,
+    0x07, 0x84, 0x08, 0x00, 0x07, 0x86, 0x08, 0x08, 0x07, 0x13, 0xed, 0x1c, 0x20, 0x11, 0x02, 0x01,
+    0x02, 0x81, 0x01, 0x81, 0x02, 0x01, 0x01, 0x02, 0x81, 0x01, 0x02, 0x02, 0x01, 0x02, 0x81, 0x01,
+    0x00, 0x36, 0x82, 0x01, 0x83, 0x02, 0x02, 0x01, 0x02, 0x01, 0x81, 0x02, 0x01, 0x12, 0xff, 0x62,
+    0x85, 0x81, 0x0a, 0x04, 0x61, 0x0b, 0x03, 0x0b, 0x23, 0x82, 0x0b, 0x04, 0x37, 0x03, 0x0b, 0x9f,
+    0xb5, 0x9b, 0x00, 0xa3, 0x00, 0x06, 0x44, 0x6a, 0x1b, 0x75, 0x4a, 0xa5, 0x47, 0x84, 0x07, 0x8d,
+    0x08, 0x00, 0x07, 0x83, 0x08, 0x00, 0x07, 0x87, 0x08, 0x01, 0x13, 0x08, 0x82, 0x07, 0x00, 0x08,
+    0x81, 0x07, 0x03, 0x47, 0x2e, 0x20, 0x1c, 0x85, 0x02, 0x83, 0x01, 0x00, 0x02, 0x82, 0x01, 0x00,
+    0x12, 0x81, 0x02, 0x81, 0x01, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x81, 0x01, 0x02, 0x11, 0xff,
+    0x18, 0xe3, 0x6d, 0x81, 0x16, 0x00, 0x37, 0x81, 0x03, 0x00, 0x27, 0x82, 0x03, 0x01, 0x6f, 0x29,
+    0x81, 0x0b, 0x01, 0xca, 0x7c, 0x9a, 0x00, 0xa2, 0x00, 0x03, 0x04, 0xff, 0x9c, 0xb1, 0xcb, 0xff,
+    0x11, 0x47, 0x81, 0x43, 0x02, 0x4e, 0x07, 0x08, 0x81, 0x07, 0x04, 0x13, 0x08, 0x07, 0x08, 0x07,
+    0x82, 0x08, 0x05, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x81, 0x07, 0x01, 0x08, 0x07, 0x83, 0x08,
+    0x00, 0x07, 0x8a, 0x08, 0x03, 0x07, 0x08, 0x07, 0x08, 0x81, 0x07, 0x03, 0x13, 0x43, 0x38, 0x1c,
+    0x83, 0x02, 0x81, 0x01, 0x85, 0x02, 0x02, 0x09, 0x02, 0x01, 0x86, 0x02, 0x81, 0x01, 0x07, 0x02,
+    0x11, 0x20, 0xff, 0x8b, 0x87, 0x0b, 0x4c, 0x2b, 0x29, 0x84, 0x03, 0x05, 0x0b, 0x54, 0x27, 0x03,
+    0xff, 0x93, 0xc6, 0xee, 0x9a, 0x00, 0xa2, 0x00, 0x03, 0x04, 0xdc, 0x4a, 0x43, 0x81, 0x92, 0x00,
+    0xff, 0x33, 0x12, 0x83, 0x07, 0x00, 0x08, 0x83, 0x07, 0x82, 0x08, 0x00, 0x07, 0x82, 0x08, 0x81,
+    0x07, 0x81, 0x08, 0x01, 0x07, 0x08, 0x81, 0x07, 0x82, 0x08, 0x81, 0x07, 0x81, 0x08, 0x81, 0x07,
+    0x02, 0x08, 0x07, 0x08, 0x81, 0x07, 0x00, 0x08, 0x81, 0x07, 0x81, 0x08, 0x06, 0x07, 0x08, 0x07,
+    0x13, 0x25, 0x20, 0x11, 0x82, 0x02, 0x09, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x09, 0x02,
+    0x01, 0x81, 0x02, 0x00, 0x01, 0x81, 0x02, 0x83, 0x01, 0x09, 0x02, 0x11, 0x09, 0xff, 0x39, 0xa4,
+    0x0b, 0x27, 0x93, 0x4c, 0x03, 0x23, 0x83, 0x03, 0x04, 0x29, 0xff, 0xcd, 0x08, 0x03, 0xea, 0xff,
+    0x52, 0x26, 0x9a, 0x00, 0xa2, 0x00, 0x05, 0xff, 0x6b, 0x6d, 0x26, 0x25, 0x2e, 0x94, 0x92, 0x82,
+    0x07, 0x01, 0x08, 0x13, 0x8e, 0x07, 0x00, 0x08, 0x84, 0x07, 0x03, 0x08, 0x07, 0x13, 0x07, 0x83,
+    0x08, 0x81, 0x07, 0x01, 0x08, 0x07, 0x81, 0x08, 0x00, 0x07, 0x84, 0x08, 0x81, 0x07, 0x04, 0x08,
+    0x07, 0xcc, 0x17, 0x01, 0x84, 0x02, 0x82, 0x01, 0x02, 0x36, 0x02, 0x01, 0x81, 0x02, 0x81, 0x01,
+    0x84, 0x02, 0x08, 0x01, 0x11, 0x09, 0xff, 0x10, 0xc3, 0x76, 0x23, 0x03, 0x0a, 0x85, 0x81, 0x0b,
+    0x83, 0x03, 0x00, 0x48, 0x81, 0x0b, 0x01, 0xff, 0x52, 0x03, 0x5f, 0x99, 0x00, 0xa1, 0x00, 0x02,
+    0xef, 0x1b, 0x63, 0x81, 0x94, 0x01, 0x92, 0x4e, 0x81, 0x07, 0x82, 0x13, 0x08, 0x8e, 0x56, 0xc9,
+    0xa5, 0xcc, 0x26, 0x12, 0x09, 0x2d, 0x81, 0x0d, 0x07, 0x33, 0x2d, 0x12, 0x26, 0xcc, 0x57, 0x86,
+    0x56, 0x81, 0x13, 0x04, 0x07, 0x08, 0x13, 0x08, 0x07, 0x81, 0x08, 0x81, 0x07, 0x82, 0x08, 0x00,
+    0x07, 0x85, 0x08, 0x03, 0x84, 0x13, 0x07, 0x08, 0x81, 0x07, 0x02, 0xf0, 0x2d, 0x09, 0x82, 0x02,
+    0x01, 0x01, 0x02, 0x81, 0x01, 0x00, 0x12, 0x83, 0x02, 0x82, 0x01, 0x82, 0x02, 0x81, 0x01, 0x04,
+    0x11, 0x09, 0x20, 0xff, 0x7a, 0xe5, 0x0b, 0x81, 0x03, 0x05, 0x62, 0x23, 0x0b, 0x27, 0x03, 0x23,
+    0x81, 0x03, 0x03, 0x6f, 0x03, 0xff, 0x83, 0x46, 0x7b, 0x99, 0x00, 0xa1, 0x00, 0x00, 0xdf, 0x81,
+    0x25, 0x81, 0x2e, 0x0b, 0x92, 0x55, 0x13, 0x56, 0x57, 0x26, 0x33, 0x17, 0x0d, 0x12, 0x5b, 0x01,
+    0x81, 0x5c, 0x81, 0x25, 0x00, 0x02, 0x82, 0x25, 0x81, 0xc0, 0x0a, 0x02, 0x26, 0x12, 0x33, 0x20,
+    0x17, 0x1c, 0x25, 0x8f, 0x8e, 0x13, 0x81, 0x07, 0x82, 0x08, 0x81, 0x07, 0x86, 0x08, 0x01, 0xff,
+    0x64, 0x35, 0xff, 0x3b, 0xb4, 0x84, 0x08, 0x03, 0x13, 0x86, 0x38, 0x5b, 0x82, 0x02, 0x81, 0x01,
+    0x01, 0x12, 0x02, 0x81, 0x01, 0x01, 0x02, 0x01, 0x81, 0x02, 0x0d, 0x01, 0x02, 0x01, 0x02, 0x01,
+    0xf1, 0x09, 0x1a, 0xf2, 0x54, 0x03, 0x0b, 0x85, 0x37, 0x81, 0x0b, 0x01, 0x03, 0x27, 0x81, 0x03,
+    0x03, 0x48, 0x0b, 0xff, 0xac, 0x68, 0xff, 0x7b, 0x8b, 0x99, 0x00, 0xa0, 0x00, 0x02, 0xef, 0x0d,
+    0x25, 0x81, 0x2e, 0x06, 0x43, 0xff, 0x19, 0xca, 0x26, 0x0d, 0x2d, 0x11, 0xc0, 0x81, 0x01, 0x00,
+    0x02, 0x8a, 0x01, 0x00, 0x02, 0x82, 0x01, 0x0b, 0x02, 0x01, 0x02, 0x01, 0xc0, 0x01, 0x09, 0x20,
+    0x09, 0x25, 0xff, 0x3b, 0x31, 0xb3, 0x82, 0x07, 0x01, 0x08, 0x07, 0x81, 0x08, 0x00, 0x07, 0x82,
+    0x08, 0x02, 0xff, 0x7c, 0xb6, 0xff, 0x54, 0x15, 0x13, 0x83, 0x08, 0x82, 0x07, 0x02, 0x26, 0x1b,
+    0x02, 0x82, 0x01, 0x00, 0x36, 0x82, 0x01, 0x82, 0x02, 0x01, 0x01, 0x02, 0x81, 0x01, 0x02, 0x02,
+    0x01, 0x11, 0x81, 0x09, 0x01, 0xff, 0x29, 0x23, 0x4c, 0x81, 0x0b, 0x01, 0x27, 0x37, 0x85, 0x03,
+    0x04, 0x29, 0x85, 0x0b, 0xff, 0x52, 0x05, 0x04, 0x98, 0x00, 0x9f, 0x00, 0x08, 0x04, 0x80, 0x01,
+    0x25, 0x4a, 0x0d, 0x1b, 0x1c, 0x02, 0x83, 0x01, 0x83, 0x02, 0x01, 0x01, 0x02, 0x85, 0x01, 0x83,
+    0x02, 0x01, 0x01, 0x02, 0x82, 0x01, 0x82, 0x02, 0x81, 0x01, 0x06, 0x02, 0x01, 0x09, 0x1b, 0x4a,
+    0x8f, 0x8e, 0x82, 0x07, 0x01, 0x08, 0x07, 0x81, 0x08, 0x07, 0xff, 0x33, 0x53, 0xff, 0x8d, 0x37,
+    0xff, 0x8d, 0x38, 0xff, 0x33, 0x53, 0x08, 0x07, 0x08, 0x07, 0x82, 0x08, 0x02, 0x13, 0x7d, 0x38,
+    0x81, 0x01, 0x01, 0x5c, 0x33, 0x81, 0x01, 0x81, 0x02, 0x00, 0x01, 0x81, 0x02, 0x01, 0x01, 0x02,
+    0x82, 0x01, 0x00, 0x11, 0x81, 0x09, 0x02, 0x73, 0x0a, 0x46, 0x81, 0x03, 0x01, 0x0b, 0x54, 0x85,
+    0x03, 0x03, 0x54, 0x0b, 0x82, 0x9d, 0x98, 0x00, 0x9e, 0x00, 0x06, 0x04, 0x44, 0x6c, 0x09, 0x1b,
+    0x36, 0x25, 0x81, 0x02, 0x81, 0x01, 0x03, 0x02, 0x01, 0x02, 0x01, 0x81, 0x02, 0x02, 0x01, 0x02,
+    0x01, 0x81, 0x02, 0x85, 0x01, 0x81, 0x02, 0x82, 0x01, 0x00, 0x02, 0x84, 0x01, 0x83, 0x02, 0x09,
+    0x25, 0x02, 0x09, 0x1b, 0x01, 0x56, 0x13, 0x07, 0x08, 0x07, 0x81, 0x08, 0x03, 0xff, 0x84, 0xd6,
+    0xff, 0x8c, 0xf6, 0xff, 0x33, 0x53, 0x07, 0x81, 0x08, 0x82, 0x07, 0x82, 0x08, 0x05, 0x5d, 0x33,
+    0x1c, 0x02, 0x12, 0x02, 0x81, 0x01, 0x00, 0x02, 0x81, 0x01, 0x02, 0x02, 0x01, 0x02, 0x82, 0x01,
+    0x05, 0x11, 0x09, 0x1a, 0x6b, 0x50, 0xff, 0xbc, 0x87, 0x82, 0x03, 0x01, 0x85, 0x29, 0x84, 0x03,
+    0x03, 0x54, 0x27, 0xff, 0x7b, 0x05, 0xff, 0xbd, 0x94, 0x98, 0x00, 0x9b, 0x00, 0x81, 0x04, 0x04,
+    0x74, 0xff, 0x9c, 0xb1, 0xff, 0x4a, 0x8a, 0x17, 0x11, 0x81, 0x02, 0x00, 0x01, 0x85, 0x02, 0x01,
+    0x01, 0x02, 0x85, 0x01, 0x81, 0x02, 0x81, 0x01, 0x01, 0x02, 0x01, 0x84, 0x02, 0x82, 0x01, 0x00,
+    0x02, 0x82, 0x01, 0x85, 0x02, 0x0b, 0x01, 0x02, 0x01, 0x0d, 0x09, 0x4d, 0x8e, 0x13, 0x07, 0x08,
+    0xff, 0x33, 0x53, 0xf3, 0x8a, 0x08, 0x03, 0x13, 0x25, 0x1b, 0x01, 0x82, 0x02, 0x00, 0x01, 0x82,
+    0x02, 0x84, 0x01, 0x05, 0x26, 0x09, 0x1a, 0x20, 0x58, 0x0a, 0x81, 0x03, 0x03, 0x27, 0x03, 0x39,
+    0x27, 0x83, 0x03, 0x03, 0x0b, 0xff, 0xbc, 0x87, 0xff, 0xa3, 0xe7, 0xff, 0x94, 0x6f, 0x98, 0x00,
+    0x97, 0x00, 0x82, 0x04, 0x09, 0x44, 0x8d, 0xff, 0x4a, 0x8a, 0x6c, 0x12, 0x02, 0x11, 0x01, 0x63,
+    0x43, 0x81, 0xff, 0x32, 0x6d, 0x08, 0xff, 0x32, 0x4d, 0x25, 0x01, 0x4a, 0x1c, 0x5b, 0x01, 0x25,
+    0x02, 0x81, 0x01, 0x81, 0x02, 0x81, 0x01, 0x81, 0x02, 0x00, 0x01, 0x81, 0x02, 0x83, 0x01, 0x81,
+    0x02, 0x83, 0x01, 0x86, 0x02, 0x00, 0x01, 0x83, 0x02, 0x05, 0x5b, 0x1b, 0x01, 0x5d, 0x13, 0x07,
+    0x84, 0x08, 0x01, 0x07, 0x08, 0x81, 0x07, 0x81, 0x08, 0x04, 0x07, 0x08, 0x5d, 0x12, 0x2a, 0x8b,
+    0x01, 0x00, 0x12, 0x81, 0x09, 0x08, 0x17, 0xb4, 0x0a, 0x48, 0x03, 0x0b, 0x03, 0x29, 0xa6, 0x84,
+    0x03, 0x03, 0x37, 0x90, 0xff, 0x73, 0x4a, 0x04, 0x97, 0x00, 0x97, 0x00, 0x0b, 0x04, 0x8a, 0xae,
+    0x6a, 0x0d, 0xff, 0x32, 0x8d, 0xc9, 0xed, 0x5d, 0x84, 0xb3, 0x07, 0x81, 0x08, 0x0d, 0x07, 0x08,
+    0x13, 0xeb, 0xb3, 0x84, 0x47, 0x8f, 0x4d, 0x57, 0x01, 0x12, 0x11, 0x5c, 0x83, 0x02, 0x00, 0x01,
+    0x81, 0x02, 0x00, 0x01, 0x81, 0x02, 0x81, 0x01, 0x00, 0x02, 0x83, 0x01, 0x81, 0x02, 0x81, 0x01,
+    0x03, 0x02, 0x01, 0x02, 0x01, 0x85, 0x02, 0x05, 0x01, 0x1b, 0x26, 0x56, 0x13, 0x08, 0x83, 0x07,
+    0x82, 0x08, 0x00, 0x07, 0x82, 0x08, 0x05, 0xed, 0x36, 0x01, 0x2a, 0x11, 0x02, 0x82, 0x01, 0x00,
+    0x02, 0x81, 0x01, 0x82, 0x02, 0x82, 0x09, 0x03, 0x0d, 0xe1, 0x0a, 0x95, 0x81, 0x03, 0x03, 0x0b,
+    0x27, 0x85, 0x27, 0x83, 0x03, 0x02, 0x48, 0x6d, 0xff, 0x4a, 0x05, 0x98, 0x00, 0x94, 0x00, 0x81,
+    0x04, 0x04, 0x8a, 0xff, 0x73, 0xce, 0x20, 0x2e, 0x56, 0x81, 0x13, 0x81, 0x07, 0x00, 0x13, 0x84,
+    0x07, 0x00, 0x13, 0x81, 0x07, 0x82, 0x08, 0x81, 0x07, 0x00, 0x08, 0x81, 0x07, 0x05, 0xeb, 0xf3,
+    0xa5, 0x25, 0x12, 0x01, 0x82, 0x02, 0x81, 0x01, 0x01, 0x02, 0x01, 0x81, 0x02, 0x81, 0x01, 0x81,
+    0x02, 0x82, 0x01, 0x05, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x81, 0x02, 0x00, 0x01, 0x82, 0x02,
+    0x81, 0x01, 0x05, 0xaf, 0x0d, 0x26, 0xf0, 0x13, 0x07, 0x81, 0x08, 0x81, 0x07, 0x02, 0x08, 0x07,
+    0x08, 0x81, 0x07, 0x00, 0xa7, 0x82, 0x01, 0x03, 0x2a, 0x1c, 0x01, 0x02, 0x81, 0x01, 0x00, 0x02,
+    0x83, 0x01, 0x00, 0x09, 0x81, 0x1f, 0x03, 0x96, 0xff, 0x41, 0x83, 0x06, 0x0a, 0x82, 0x03, 0x01,
+    0x27, 0xff, 0xcd, 0x08, 0x81, 0x03, 0x00, 0x27, 0x81, 0x03, 0x02, 0x0b, 0x37, 0xff, 0x49, 0xc2,
+    0x98, 0x00, 0x93, 0x00, 0x81, 0x04, 0x02, 0xe5, 0x1a, 0x86, 0x83, 0x13, 0x06, 0x8e, 0x47, 0x8f,
+    0x57, 0x60, 0xff, 0x29, 0xc8, 0xff, 0x29, 0x87, 0x81, 0x83, 0x0b, 0xc8, 0xff, 0x21, 0x23, 0x83,
+    0xff, 0x21, 0x45, 0x96, 0xc1, 0x02, 0xff, 0x2a, 0xae, 0x56, 0xeb, 0x13, 0x07, 0x81, 0x08, 0x04,
+    0x07, 0xb3, 0x7d, 0x25, 0x12, 0x83, 0x01, 0x82, 0x02, 0x84, 0x01, 0x00, 0x02, 0x81, 0x01, 0x01,
+    0x02, 0x01, 0x83, 0x02, 0x00, 0x01, 0x83, 0x02, 0x81, 0x01, 0x81, 0x02, 0x04, 0x01, 0x1b, 0x4a,
+    0x47, 0x13, 0x83, 0x07, 0x00, 0x13, 0x81, 0x07, 0x01, 0xf3, 0x2d, 0x82, 0x01, 0x03, 0x02, 0x1b,
+    0x12, 0x02, 0x85, 0x01, 0x09, 0x11, 0x09, 0x1f, 0x1a, 0x09, 0xff, 0x39, 0x42, 0x06, 0x0a, 0x37,
+    0x0b, 0x81, 0x03, 0x01, 0x27, 0x39, 0x81, 0x03, 0x05, 0x0b, 0x03, 0x0b, 0x37, 0xff, 0x6a, 0xa4,
+    0x7c, 0x97, 0x00, 0x92, 0x00, 0x03, 0x04, 0xc4, 0xff, 0x3a, 0x29, 0x57, 0x82, 0x13, 0x04, 0xf0,
+    0x57, 0x2d, 0x75, 0xff, 0x00, 0x62, 0x81, 0xcb, 0x05, 0xff, 0x52, 0x03, 0x70, 0x1e, 0x2b, 0x0a,
+    0x40, 0x81, 0xf4, 0x0b, 0xff, 0xb3, 0xe6, 0x06, 0xff, 0x9b, 0x66, 0x51, 0xff, 0x6a, 0x66, 0xff,
+    0x7a, 0xe8, 0xff, 0x52, 0x47, 0xff, 0x31, 0xe9, 0x4d, 0x47, 0x07, 0x08, 0x82, 0x07, 0x03, 0x13,
+    0x86, 0x02, 0x26, 0x85, 0x02, 0x02, 0x01, 0x02, 0x01, 0x82, 0x02, 0x81, 0x01, 0x86, 0x02, 0x00,
+    0x01, 0x86, 0x02, 0x02, 0x01, 0x17, 0x63, 0x81, 0x13, 0x82, 0x07, 0x05, 0x13, 0x07, 0x43, 0x12,
+    0x02, 0x01, 0x81, 0x02, 0x02, 0x25, 0x0d, 0x12, 0x85, 0x01, 0x05, 0x1c, 0x0d, 0x1f, 0x1a, 0x09,
+    0xff, 0x31, 0x02, 0x81, 0x0a, 0x00, 0x4c, 0x83, 0x03, 0x00, 0x39, 0x81, 0x0b, 0x81, 0x03, 0x03,
+    0x27, 0x37, 0x91, 0x79, 0x97, 0x00, 0x92, 0x00, 0x0d, 0xff, 0x9c, 0xd2, 0x0d, 0xf0, 0x07, 0xf0,
+    0x25, 0x38, 0xcb, 0x73, 0x6b, 0x0d, 0x1b, 0x17, 0xf5, 0x81, 0x0a, 0x88, 0x06, 0x01, 0xff, 0x62,
+    0x04, 0x28, 0x81, 0x0c, 0x05, 0x52, 0xff, 0xb4, 0x2c, 0xff, 0x6a, 0xa8, 0xff, 0x31, 0xc7, 0xff,
+    0x32, 0x8d, 0x13, 0x84, 0x07, 0x02, 0x47, 0x57, 0x1c, 0x83, 0x02, 0x00, 0x01, 0x86, 0x02, 0x00,
+    0x01, 0x83, 0x02, 0x81, 0x01, 0x81, 0x02, 0x02, 0x01, 0x02, 0x01, 0x84, 0x02, 0x02, 0x11, 0x20,
+    0xff, 0x32, 0x8e, 0x81, 0x13, 0x81, 0x07, 0x01, 0x55, 0xb2, 0x85, 0x02, 0x02, 0x25, 0x1f, 0x12,
+    0x81, 0x01, 0x81, 0x02, 0x06, 0x01, 0x09, 0x1a, 0x09, 0x96, 0x09, 0xff, 0x29, 0x02, 0x82, 0x0a,
+    0x82, 0x03, 0x04, 0x23, 0x29, 0x46, 0x03, 0x27, 0x82, 0x03, 0x01, 0xff, 0x8b, 0x45, 0xff, 0x9c,
+    0x8f, 0x97, 0x00, 0x91, 0x00, 0x06, 0xae, 0xf6, 0x56, 0x86, 0x0d, 0x75, 0x6b, 0x81, 0x1b, 0x83,
+    0x17, 0x01, 0xff, 0x39, 0x42, 0x16, 0x89, 0x06, 0x02, 0xf7, 0xff, 0xbc, 0x4d, 0x28, 0x84, 0x0c,
+    0x04, 0xff, 0xbc, 0x6d, 0xb6, 0xff, 0x39, 0x63, 0xff, 0x32, 0x0a, 0xff, 0x3b, 0x31, 0x85, 0x07,
+    0x03, 0xa5, 0x1c, 0x02, 0x25, 0x87, 0x02, 0x00, 0x01, 0x82, 0x02, 0x00, 0x01, 0x85, 0x02, 0x00,
+    0x01, 0x81, 0x02, 0x00, 0x01, 0x82, 0x02, 0x07, 0x5c, 0x38, 0xff, 0x11, 0x47, 0xff, 0x3b, 0x11,
+    0x13, 0x07, 0x43, 0x12, 0x87, 0x02, 0x01, 0x1f, 0x1c, 0x81, 0x02, 0x08, 0x01, 0x11, 0x1a, 0x09,
+    0x0d, 0x1a, 0x09, 0xff, 0x28, 0xe1, 0x06, 0x81, 0x0a, 0x00, 0x54, 0x82, 0x03, 0x01, 0x0b, 0x39,
+    0x81, 0x0b, 0x81, 0x03, 0x02, 0x0b, 0xff, 0xa3, 0xe7, 0xa8, 0x97, 0x00, 0x8e, 0x00, 0x0b, 0x04,
+    0x00, 0xae, 0x2d, 0x4d, 0x0d, 0x75, 0x20, 0x17, 0x1b, 0x17, 0x1b, 0x82, 0x17, 0x01, 0xff, 0x21,
+    0x02, 0x2c, 0x81, 0x06, 0x00, 0x2f, 0x83, 0x06, 0x00, 0x34, 0x81, 0x06, 0x02, 0x71, 0xff, 0x7a,
+    0xa6, 0x28, 0x85, 0x0c, 0x08, 0xf8, 0x2c, 0x0a, 0x87, 0xb6, 0xdc, 0xc9, 0x13, 0x07, 0x81, 0x08,
+    0x81, 0x13, 0x02, 0x4d, 0x4a, 0x01, 0x87, 0x02, 0x83, 0x01, 0x01, 0x02, 0x01, 0x88, 0x02, 0x07,
+    0x25, 0x12, 0x2d, 0x8f, 0x5d, 0x1b, 0xa7, 0x4d, 0x81, 0x01, 0x84, 0x02, 0x00, 0x01, 0x82, 0x02,
+    0x05, 0x0d, 0x5b, 0x01, 0x02, 0x12, 0x1f, 0x83, 0x1a, 0x01, 0xff, 0x39, 0x41, 0x0f, 0x81, 0x0a,
+    0x00, 0x95, 0x82, 0x03, 0x02, 0x23, 0x48, 0x0b, 0x82, 0x03, 0x03, 0x0b, 0x37, 0xff, 0x62, 0xc8,
+    0x04, 0x96, 0x00, 0x8f, 0x00, 0x07, 0x8d, 0x1b, 0xcc, 0x75, 0x20, 0x1b, 0x17, 0x1b, 0x84, 0x17,
+    0x02, 0x83, 0x58, 0x16, 0x82, 0x06, 0x08, 0x34, 0x2f, 0x06, 0x2f, 0x06, 0x2f, 0x06, 0x77, 0xff,
+    0xd5, 0x0f, 0x82, 0x28, 0x83, 0x0c, 0x01, 0xff, 0xa3, 0x89, 0x1e, 0x81, 0x06, 0x04, 0x16, 0x2b,
+    0xff, 0x62, 0x43, 0xff, 0x29, 0x65, 0xc9, 0x81, 0x13, 0x00, 0x08, 0x81, 0x07, 0x06, 0x13, 0x86,
+    0x01, 0x11, 0x25, 0x02, 0x01, 0x88, 0x02, 0x00, 0x01, 0x84, 0x02, 0x06, 0x01, 0x02, 0x09, 0x12,
+    0x7d, 0x13, 0x08, 0x81, 0x13, 0x01, 0x63, 0x2a, 0x81, 0x01, 0x01, 0x02, 0x01, 0x87, 0x02, 0x0a,
+    0x0d, 0x11, 0x01, 0x09, 0x1f, 0x09, 0x0d, 0x1a, 0x0d, 0xff, 0x49, 0xa2, 0x30, 0x82, 0x0a, 0x00,
+    0x0b, 0x82, 0x03, 0x01, 0x29, 0x39, 0x81, 0x03, 0x04, 0x27, 0x03, 0x29, 0xc6, 0x04, 0x96, 0x00,
+    0x8e, 0x00, 0x03, 0x8a, 0x6a, 0x4a, 0x75, 0x81, 0x17, 0x00, 0x1b, 0x82, 0x17, 0x00, 0x1b, 0x82,
+    0x17, 0x02, 0xb7, 0x06, 0x0f, 0x84, 0x06, 0x81, 0x34, 0x03, 0x0f, 0x06, 0x2c, 0xff, 0x93, 0x49,
+    0x82, 0x28, 0x01, 0xcd, 0x28, 0x82, 0x0c, 0x01, 0xff, 0x9b, 0x89, 0x2c, 0x83, 0x06, 0x05, 0x16,
+    0x2b, 0x64, 0xff, 0x29, 0x65, 0xff, 0x32, 0xce, 0x13, 0x83, 0x07, 0x06, 0x13, 0x55, 0x43, 0x1c,
+    0x11, 0x02, 0x01, 0x8a, 0x02, 0x05, 0x01, 0x36, 0x33, 0xcc, 0xff, 0x33, 0x12, 0x13, 0x84, 0x07,
+    0x03, 0x5d, 0xff, 0x29, 0xc7, 0xff, 0x20, 0xc2, 0xff, 0x29, 0xe9, 0x87, 0x02, 0x00, 0x01, 0x81,
+    0x02, 0x09, 0x1b, 0x12, 0x1a, 0x1f, 0x1a, 0x0d, 0x1a, 0x1b, 0xca, 0x1e, 0x82, 0x0a, 0x00, 0x46,
+    0x82, 0x03, 0x01, 0x0b, 0x68, 0x83, 0x03, 0x01, 0x0b, 0xa4, 0x97, 0x00, 0x8e, 0x00, 0x04, 0xae,
+    0x12, 0x75, 0x0d, 0x1b, 0x87, 0x17, 0x01, 0xff, 0x29, 0x02, 0x87, 0x82, 0x0f, 0x09, 0x1e, 0xff,
+    0xb4, 0x28, 0x34, 0x0f, 0x06, 0x34, 0x0f, 0x06, 0x77, 0xff, 0xdd, 0x2f, 0x81, 0x0c, 0x02, 0x52,
+    0xff, 0xe5, 0x92, 0x28, 0x82, 0x0c, 0x01, 0xf8, 0x97, 0x82, 0x06, 0x00, 0x30, 0x82, 0x06, 0x04,
+    0x16, 0x64, 0xff, 0x31, 0x64, 0xff, 0x32, 0xae, 0x13, 0x83, 0x07, 0x81, 0x13, 0x05, 0x55, 0x25,
+    0x4a, 0x2d, 0x12, 0x11, 0x81, 0x01, 0x81, 0x11, 0x06, 0x12, 0x0d, 0x33, 0x1c, 0x2e, 0x55, 0x13,
+    0x81, 0x07, 0x00, 0x08, 0x82, 0x07, 0x06, 0xff, 0x3b, 0x10, 0xff, 0x31, 0xc8, 0xa4, 0x2c, 0x16,
+    0xa4, 0x1a, 0x81, 0x02, 0x02, 0x01, 0x02, 0x01, 0x82, 0x02, 0x00, 0x01, 0x81, 0x02, 0x02, 0x2a,
+    0x09, 0x1f, 0x81, 0x0d, 0x07, 0x1a, 0x20, 0x78, 0x21, 0x06, 0x0a, 0x06, 0x37, 0x83, 0x03, 0x00,
+    0x37, 0x84, 0x03, 0x01, 0x69, 0x5f, 0x96, 0x00, 0x8d, 0x00, 0x01, 0x04, 0xff, 0x42, 0x28, 0x83,
+    0x1b, 0x86, 0x17, 0x01, 0xff, 0x21, 0x25, 0x77, 0x83, 0x0f, 0x04, 0x2c, 0xff, 0xb4, 0x28, 0xec,
+    0x0f, 0x16, 0x81, 0x0f, 0x01, 0x2c, 0xff, 0x93, 0x49, 0x82, 0x0c, 0x03, 0xff, 0xe5, 0x92, 0xff,
+    0xe5, 0x91, 0xce, 0xb8, 0x81, 0x0c, 0x01, 0xff, 0xab, 0xea, 0x41, 0x82, 0x06, 0x00, 0x87, 0x83,
+    0x06, 0x05, 0x0a, 0x16, 0x78, 0xff, 0x31, 0x43, 0xff, 0x32, 0x6c, 0x47, 0x85, 0x07, 0x0c, 0x13,
+    0x84, 0x56, 0x7d, 0x4f, 0x4d, 0x4f, 0x4e, 0xed, 0x07, 0x84, 0x07, 0x13, 0x82, 0x07, 0x06, 0x08,
+    0x07, 0x47, 0xff, 0x32, 0x6c, 0xff, 0x29, 0x44, 0xb6, 0x87, 0x82, 0x06, 0x02, 0x0a, 0x58, 0x83,
+    0x82, 0x01, 0x81, 0x02, 0x81, 0x01, 0x05, 0x02, 0x01, 0x11, 0x0d, 0x38, 0x1f, 0x82, 0x1a, 0x03,
+    0x6c, 0x59, 0x0a, 0x1e, 0x81, 0x0a, 0x00, 0x3e, 0x83, 0x03, 0x01, 0x29, 0x48, 0x83, 0x03, 0x01,
+    0xff, 0x72, 0xe5, 0xe0, 0x96, 0x00, 0x8d, 0x00, 0x02, 0x04, 0xff, 0x42, 0x28, 0x20, 0x82, 0x1b,
+    0x86, 0x17, 0x01, 0xff, 0x31, 0x02, 0x2b, 0x81, 0x0f, 0x0a, 0x1e, 0x21, 0xff, 0x9b, 0xc9, 0xff,
+    0xbc, 0x69, 0xff, 0xcd, 0x4f, 0x16, 0x34, 0x0f, 0x06, 0x69, 0x3f, 0x82, 0x0c, 0x03, 0xff, 0xe5,
+    0xb2, 0xff, 0xe5, 0x91, 0xf9, 0xb8, 0x81, 0x0c, 0x01, 0xff, 0xbc, 0x2c, 0x98, 0x81, 0x06, 0x01,
+    0x0a, 0xfa, 0x82, 0x06, 0x00, 0x0a, 0x83, 0x06, 0x05, 0x51, 0xff, 0x41, 0x62, 0xff, 0x29, 0xa7,
+    0xff, 0x32, 0x8d, 0x47, 0x13, 0x83, 0x07, 0x00, 0x13, 0x83, 0x07, 0x82, 0x08, 0x83, 0x07, 0x07,
+    0x13, 0x56, 0xff, 0x32, 0x6c, 0xdc, 0xb7, 0x51, 0x16, 0x1e, 0x82, 0x06, 0x81, 0x0a, 0x04, 0x06,
+    0xfb, 0xff, 0x29, 0x22, 0xc1, 0x02, 0x85, 0x01, 0x0e, 0x12, 0x09, 0x1b, 0x17, 0x1a, 0x0d, 0x1a,
+    0xff, 0x19, 0x04, 0x50, 0x06, 0x1e, 0x0a, 0x40, 0x0a, 0x0b, 0x82, 0x03, 0x01, 0x0b, 0x3e, 0x83,
+    0x03, 0x01, 0x91, 0xe9, 0x96, 0x00, 0x8e, 0x00, 0x05, 0xff, 0x94, 0x70, 0xcb, 0x0d, 0x1b, 0x17,
+    0x1b, 0x84, 0x17, 0x0e, 0xff, 0x21, 0x25, 0x64, 0x2b, 0x0f, 0x21, 0x3a, 0x21, 0xff, 0x9b, 0x88,
+    0xff, 0xee, 0xb7, 0xff, 0xbc, 0xad, 0x16, 0x0f, 0x34, 0x2b, 0xff, 0x7a, 0xa7, 0x81, 0x28, 0x81,
+    0x0c, 0x07, 0x3f, 0xff, 0xee, 0x14, 0xff, 0xee, 0x77, 0xb8, 0x0c, 0x28, 0xff, 0xd4, 0xee, 0xcf,
+    0x81, 0x06, 0x01, 0x0a, 0x41, 0x83, 0x06, 0x00, 0x0a, 0x81, 0x06, 0x0b, 0x2f, 0x0a, 0x70, 0xff,
+    0x8b, 0x28, 0xff, 0x83, 0x08, 0xff, 0x49, 0xc5, 0xff, 0x29, 0x45, 0x60, 0xff, 0x32, 0xae, 0x56,
+    0xff, 0x43, 0xb4, 0xb3, 0x81, 0x13, 0x0d, 0x07, 0x08, 0x07, 0x13, 0x84, 0xff, 0x3b, 0x93, 0x8f,
+    0xff, 0x32, 0x6c, 0xff, 0x31, 0xe8, 0xff, 0x29, 0x23, 0xff, 0x39, 0x21, 0xff, 0x7a, 0xc5, 0x2b,
+    0x0a, 0x81, 0x06, 0x02, 0x16, 0x1e, 0x06, 0x81, 0x0a, 0x06, 0xff, 0xbc, 0x48, 0x76, 0x06, 0x2b,
+    0xff, 0x39, 0x82, 0x1a, 0x02, 0x81, 0x01, 0x03, 0x02, 0x01, 0x11, 0x09, 0x81, 0x1a, 0x00, 0x20,
+    0x81, 0x0d, 0x01, 0x1a, 0xff, 0x18, 0xe3, 0x81, 0x06, 0x04, 0x1e, 0x0a, 0x95, 0x0a, 0x46, 0x83,
+    0x03, 0x01, 0x68, 0xa6, 0x82, 0x03, 0x01, 0xff, 0x9b, 0xe7, 0xee, 0x96, 0x00, 0x8e, 0x00, 0x03,
+    0x04, 0x80, 0x73, 0x0d, 0x82, 0x1b, 0x83, 0x17, 0x01, 0xff, 0x29, 0x02, 0x2b, 0x82, 0x0f, 0x00,
+    0x31, 0x81, 0x21, 0x06, 0x71, 0x21, 0x0f, 0x2f, 0x06, 0x58, 0xff, 0xbc, 0x6c, 0x83, 0x0c, 0x03,
+    0xb8, 0xff, 0xcc, 0xce, 0xff, 0xcc, 0x8d, 0x28, 0x81, 0x0c, 0x05, 0x52, 0xff, 0x61, 0xe3, 0x0a,
+    0x06, 0x0a, 0x41, 0x81, 0x06, 0x00, 0x0a, 0x83, 0x06, 0x19, 0xff, 0x9b, 0x64, 0x06, 0xcf, 0xff,
+    0xd4, 0xcd, 0xff, 0xdc, 0xcd, 0xb8, 0x28, 0xff, 0xbc, 0x4c, 0xff, 0x93, 0x6a, 0xff, 0x72, 0xa7,
+    0xff, 0x51, 0xe5, 0xff, 0x41, 0xa5, 0xff, 0x31, 0x65, 0xff, 0x31, 0x86, 0xdc, 0xff, 0x31, 0x86,
+    0xff, 0x31, 0x65, 0xff, 0x29, 0x44, 0xff, 0x39, 0x63, 0x9e, 0xff, 0x7a, 0xa7, 0xff, 0x93, 0x69,
+    0xff, 0xbc, 0x4c, 0x28, 0xd0, 0x7e, 0x81, 0x0a, 0x82, 0x06, 0x06, 0x2c, 0x06, 0x0a, 0x40, 0xff,
+    0xcd, 0x2c, 0x23, 0x39, 0x81, 0x0a, 0x15, 0xff, 0x62, 0x44, 0x6c, 0x02, 0x01, 0x02, 0x01, 0x09,
+    0x1f, 0x09, 0x0d, 0x1a, 0x2a, 0x1a, 0x1f, 0xff, 0x21, 0x02, 0x0a, 0x06, 0x1e, 0x0a, 0x3e, 0x93,
+    0x54, 0x83, 0x03, 0x01, 0x46, 0x37, 0x82, 0x03, 0x01, 0xff, 0xb4, 0x88, 0xff, 0x83, 0x8b, 0x96,
+    0x00, 0x8e, 0x00, 0x81, 0x04, 0x02, 0xc5, 0x75, 0x1b, 0x85, 0x17, 0x01, 0xb6, 0x16, 0x81, 0x0f,
+    0x00, 0x2c, 0x81, 0x21, 0x82, 0x0f, 0x81, 0x34, 0x02, 0x0a, 0xff, 0x62, 0x04, 0x52, 0x84, 0x0c,
+    0x00, 0xb8, 0x82, 0x0c, 0x07, 0x28, 0x0c, 0xff, 0x72, 0x86, 0xff, 0xb3, 0xe6, 0x0a, 0x97, 0xff,
+    0x8a, 0xe4, 0x06, 0x82, 0x0a, 0x00, 0x06, 0x81, 0x0a, 0x05, 0x1e, 0x0a, 0xff, 0x6a, 0x23, 0x28,
+    0xff, 0xd4, 0xad, 0xff, 0xcc, 0x8c, 0x83, 0x0c, 0x81, 0x3f, 0x03, 0x28, 0xff, 0xe5, 0x4f, 0xff,
+    0xdd, 0x2f, 0x28, 0x81, 0xff, 0xe5, 0x4f, 0x04, 0x28, 0x3f, 0x0c, 0xff, 0xe5, 0xb2, 0x0c, 0x81,
+    0x28, 0x01, 0xff, 0x7a, 0x85, 0x2b, 0x83, 0x06, 0x00, 0x31, 0x81, 0x0a, 0x04, 0x76, 0xff, 0xe5,
+    0xf0, 0x23, 0x0b, 0x3e, 0x81, 0x0a, 0x04, 0xff, 0x7a, 0xe5, 0xff, 0x18, 0xe4, 0x01, 0x02, 0x12,
+    0x81, 0x1a, 0x83, 0x0d, 0x03, 0x2a, 0x1a, 0xff, 0x39, 0x62, 0x16, 0x81, 0x06, 0x03, 0x1e, 0x61,
+    0x48, 0x3e, 0x83, 0x03, 0x02, 0x0b, 0x93, 0x27, 0x81, 0x03, 0x02, 0x29, 0x66, 0x04, 0x95, 0x00,
+    0x8f, 0x00, 0x81, 0x04, 0x03, 0xc2, 0xff, 0x21, 0x25, 0x67, 0x6b, 0x82, 0x17, 0x05, 0x83, 0x70,
+    0x16, 0x0f, 0x21, 0x41, 0x84, 0x0f, 0x04, 0x34, 0x06, 0x1e, 0xff, 0x8b, 0x08, 0x28, 0x8a, 0x0c,
+    0x08, 0xff, 0x9b, 0x69, 0xff, 0x9b, 0x66, 0xff, 0x7a, 0x83, 0x31, 0x5e, 0x0a, 0x06, 0x0a, 0x06,
+    0x81, 0x0a, 0x08, 0x06, 0x3a, 0x0a, 0xff, 0x72, 0x65, 0x0c, 0xff, 0xc4, 0x6d, 0xff, 0xc4, 0x2b,
+    0xf8, 0xff, 0xd4, 0xee, 0x8b, 0x0c, 0x02, 0xff, 0xdc, 0xad, 0xff, 0xee, 0x14, 0xff, 0xed, 0xd2,
+    0x81, 0x0c, 0x15, 0xb9, 0xff, 0x6a, 0x23, 0x0a, 0x06, 0x0a, 0x06, 0x1e, 0x16, 0x48, 0x23, 0xff,
+    0xde, 0x12, 0x03, 0xff, 0xdd, 0x8b, 0x03, 0x93, 0x40, 0x2b, 0xb7, 0xff, 0x18, 0xc3, 0xff, 0x29,
+    0xe9, 0x1f, 0x1a, 0x84, 0x0d, 0x02, 0x2a, 0x17, 0xb7, 0x81, 0x06, 0x04, 0x0a, 0x3a, 0x40, 0x27,
+    0x61, 0x84, 0x03, 0x01, 0x3e, 0x46, 0x81, 0x03, 0x01, 0x7a, 0xff, 0x49, 0xc4, 0x96, 0x00, 0x91,
+    0x00, 0x0c, 0x04, 0x44, 0x8d, 0x80, 0xff, 0x29, 0x65, 0xff, 0x10, 0xc3, 0xff, 0x00, 0x62, 0xff,
+    0x28, 0xe1, 0x0a, 0x16, 0x0f, 0x1e, 0x41, 0x84, 0x0f, 0x03, 0x34, 0x06, 0x51, 0xff, 0xbc, 0x2c,
+    0x8a, 0x0c, 0x05, 0x28, 0xff, 0x9b, 0x69, 0xff, 0x59, 0xc1, 0xff, 0x72, 0x42, 0x06, 0x41, 0x82,
+    0x0a, 0x00, 0x34, 0x82, 0x0a, 0x0a, 0x31, 0x30, 0xff, 0x8b, 0x28, 0x0c, 0x28, 0xff, 0x93, 0x06,
+    0xff, 0xc4, 0x6c, 0xff, 0x6a, 0x02, 0xff, 0x93, 0x27, 0xff, 0xc4, 0x6d, 0x28, 0x87, 0x0c, 0x03,
+    0x28, 0xb8, 0xff, 0xf6, 0xb7, 0xf9, 0x82, 0x0c, 0x01, 0xff, 0x93, 0x69, 0x2c, 0x81, 0x0a, 0x10,
+    0x40, 0x4c, 0x62, 0x23, 0x0b, 0xff, 0xd5, 0x91, 0xff, 0xdd, 0x6b, 0xff, 0xe6, 0x10, 0x0b, 0x37,
+    0x40, 0x30, 0xff, 0x72, 0x83, 0xff, 0x7a, 0xc5, 0xff, 0x10, 0xa2, 0x0d, 0x1a, 0x85, 0x0d, 0x02,
+    0xcb, 0xb7, 0x0a, 0x81, 0x06, 0x03, 0x1e, 0x0a, 0x0b, 0x68, 0x84, 0x03, 0x01, 0x54, 0x37, 0x81,
+    0x03, 0x02, 0x0b, 0xff, 0x49, 0xa2, 0x99, 0x95, 0x00, 0x94, 0x00, 0x82, 0x04, 0x06, 0x9d, 0xff,
+    0x5a, 0x23, 0x06, 0x16, 0x06, 0x58, 0x41, 0x83, 0x0f, 0x05, 0x34, 0x0f, 0x06, 0x77, 0x52, 0x28,
+    0x85, 0x0c, 0x09, 0x28, 0x3f, 0xd0, 0xff, 0x93, 0x28, 0xff, 0x6a, 0x02, 0xff, 0x7a, 0x62, 0xff,
+    0x59, 0xa1, 0x70, 0x3e, 0xfa, 0x83, 0x0a, 0x00, 0x0f, 0x81, 0x0a, 0x02, 0x31, 0x41, 0xf8, 0x81,
+    0x0c, 0x08, 0xff, 0xb4, 0x0b, 0xff, 0xcc, 0x4c, 0xd0, 0xff, 0x72, 0x22, 0xff, 0x7a, 0x62, 0xff,
+    0x72, 0x43, 0xff, 0x93, 0x28, 0xff, 0xb4, 0x0b, 0xff, 0xdd, 0x2f, 0x84, 0x0c, 0x02, 0x28, 0x0c,
+    0xb8, 0x83, 0x0c, 0x01, 0x3f, 0x77, 0x81, 0x40, 0x0f, 0x37, 0x0b, 0x16, 0x03, 0x0b, 0xff, 0xcd,
+    0x70, 0xff, 0xf6, 0xd7, 0xff, 0xdd, 0x6d, 0x27, 0xff, 0xcd, 0x08, 0x4c, 0x1e, 0xff, 0x7a, 0x83,
+    0x06, 0xff, 0x7a, 0xc5, 0xff, 0x10, 0xa3, 0x86, 0x0d, 0x02, 0x45, 0xff, 0x62, 0x64, 0x30, 0x81,
+    0x0a, 0x01, 0x3a, 0x0a, 0x81, 0x29, 0x00, 0x39, 0x83, 0x03, 0x01, 0x0b, 0x34, 0x82, 0x03, 0x01,
+    0xe3, 0xa2, 0x95, 0x00, 0x96, 0x00, 0x02, 0x04, 0xc7, 0x59, 0x81, 0x06, 0x02, 0x7e, 0x59, 0x41,
+    0x83, 0x0f, 0x0d, 0x06, 0x30, 0x0a, 0xff, 0x6a, 0x24, 0x3f, 0xff, 0xbc, 0x4d, 0xff, 0xbc, 0x4c,
+    0xff, 0xbc, 0x2c, 0xd0, 0xf8, 0xff, 0x93, 0x48, 0xff, 0x8b, 0x07, 0xff, 0x7a, 0x64, 0xff, 0x69,
+    0xe2, 0x81, 0xff, 0x7a, 0x62, 0x10, 0xff, 0x7a, 0x42, 0xff, 0x6a, 0x02, 0x69, 0xff, 0xcc, 0xc9,
+    0x23, 0x5e, 0x0b, 0x68, 0x93, 0x40, 0x16, 0xf4, 0x0a, 0x1e, 0xff, 0x7a, 0xa3, 0xff, 0xc4, 0x6d,
+    0x0c, 0x81, 0x28, 0x0f, 0xff, 0xbc, 0x4c, 0x3f, 0xff, 0xc4, 0x8d, 0xff, 0x72, 0x65, 0xff, 0x6a,
+    0x02, 0xff, 0x82, 0x83, 0xff, 0x7a, 0x42, 0xff, 0x61, 0xc1, 0xff, 0x7a, 0x84, 0xff, 0x8b, 0x07,
+    0xff, 0x9b, 0x69, 0xd0, 0xff, 0xbc, 0x6c, 0xff, 0xcc, 0xae, 0xff, 0xdc, 0xef, 0xb9, 0x81, 0xff,
+    0xcc, 0x8d, 0x82, 0x0c, 0x05, 0xff, 0xa3, 0xca, 0x2c, 0x46, 0x27, 0x0b, 0x71, 0x81, 0x03, 0x07,
+    0x48, 0xff, 0xc4, 0xa9, 0x0b, 0x03, 0x39, 0x37, 0x87, 0x51, 0x81, 0x06, 0x01, 0xe3, 0x67, 0x85,
+    0x0d, 0x09, 0x45, 0xa9, 0x1e, 0x06, 0x0a, 0x3a, 0x0a, 0x39, 0x03, 0x39, 0x84, 0x03, 0x01, 0x93,
+    0x46, 0x81, 0x03, 0x01, 0xff, 0x83, 0x45, 0x79, 0x95, 0x00, 0x96, 0x00, 0x02, 0x04, 0xff, 0x83,
+    0xed, 0x71, 0x81, 0x06, 0x02, 0xaa, 0x70, 0x41, 0x82, 0x0f, 0x0b, 0x34, 0x06, 0x3a, 0x2b, 0xff,
+    0x82, 0xe7, 0x28, 0xff, 0xcc, 0xad, 0xff, 0xa3, 0x89, 0xff, 0x8b, 0x07, 0xff, 0x72, 0x65, 0xff,
+    0x61, 0xe2, 0xff, 0x59, 0x81, 0x81, 0xff, 0x59, 0xc1, 0x09, 0xff, 0x61, 0xc1, 0xff, 0x6a, 0x23,
+    0xff, 0x7a, 0xa6, 0xff, 0x9b, 0x8a, 0xff, 0xdd, 0x70, 0xff, 0xdd, 0xd3, 0xfb, 0x0b, 0x16, 0x9f,
+    0x81, 0x0b, 0x08, 0xff, 0xcd, 0x08, 0xff, 0xbc, 0x69, 0xff, 0xbc, 0x68, 0x40, 0x30, 0x64, 0x52,
+    0x0c, 0x28, 0x83, 0x0c, 0x05, 0x28, 0xff, 0xc4, 0xae, 0xff, 0x93, 0x28, 0xff, 0x7a, 0x85, 0xff,
+    0x6a, 0x03, 0xff, 0x59, 0xa1, 0x81, 0xff, 0x61, 0xe2, 0x06, 0xff, 0x69, 0xe2, 0xff, 0x59, 0x81,
+    0xff, 0x59, 0xa2, 0xff, 0x6a, 0x24, 0xff, 0x82, 0xc7, 0xff, 0xab, 0xcb, 0x3f, 0x81, 0x0c, 0x07,
+    0x52, 0xce, 0xff, 0x72, 0x86, 0x0b, 0x03, 0x0b, 0x30, 0x0b, 0x84, 0x03, 0x03, 0x39, 0x29, 0x2c,
+    0x98, 0x82, 0x16, 0x01, 0xff, 0x41, 0xa3, 0x6b, 0x84, 0x0d, 0x09, 0xff, 0x10, 0xa3, 0x2b, 0x1e,
+    0x0a, 0x06, 0x0f, 0x21, 0x54, 0x03, 0x46, 0x84, 0x03, 0x01, 0xa1, 0xff, 0xbc, 0x87, 0x81, 0x03,
+    0x01, 0xba, 0x9a, 0x95, 0x00, 0x96, 0x00, 0x07, 0x04, 0xfc, 0xf4, 0x0f, 0x16, 0xff, 0x39, 0x42,
+    0x87, 0x41, 0x82, 0x0f, 0x81, 0x06, 0x02, 0x31, 0x97, 0xff, 0x9b, 0x8a, 0x83, 0x0c, 0x0f, 0x3f,
+    0x52, 0xff, 0xe5, 0x90, 0xcd, 0xff, 0xe5, 0x4f, 0xcd, 0xff, 0xe5, 0x30, 0x52, 0xff, 0xf6, 0x13,
+    0x14, 0x05, 0xff, 0x83, 0x28, 0x0b, 0x6f, 0xfd, 0x23, 0x81, 0x03, 0x05, 0xff, 0xd5, 0xaf, 0x48,
+    0x0b, 0xa1, 0x77, 0xcd, 0x87, 0x0c, 0x81, 0x3f, 0x04, 0x52, 0xcd, 0x3f, 0xb9, 0xff, 0xd5, 0x0e,
+    0x81, 0x52, 0x0c, 0x3f, 0xff, 0xe5, 0x71, 0xff, 0xed, 0xd2, 0xff, 0xf6, 0x13, 0x88, 0x05, 0xfe,
+    0x14, 0xff, 0xd5, 0xb2, 0x91, 0x03, 0x0b, 0xd1, 0x84, 0x03, 0x09, 0x23, 0x39, 0x0b, 0x50, 0x5e,
+    0x16, 0x0f, 0x06, 0x5e, 0xff, 0x29, 0x03, 0x83, 0x0d, 0x0a, 0x1a, 0xff, 0x20, 0xe2, 0x0a, 0x1e,
+    0x0a, 0x06, 0x0a, 0x3a, 0x76, 0x03, 0xa6, 0x84, 0x03, 0x01, 0x0b, 0x30, 0x81, 0x03, 0x01, 0xff,
+    0xb4, 0x88, 0x6e, 0x95, 0x00, 0x96, 0x00, 0x07, 0x04, 0xbb, 0x0a, 0x16, 0x51, 0xfc, 0x2c, 0x41,
+    0x81, 0x0f, 0x82, 0x06, 0x03, 0x31, 0x5e, 0xff, 0xb4, 0x2c, 0x0c, 0x81, 0x28, 0x82, 0x0c, 0x81,
+    0x3f, 0x02, 0x52, 0xff, 0xed, 0xd2, 0x88, 0x81, 0x14, 0x81, 0x05, 0x0e, 0xff, 0xcd, 0xb2, 0xba,
+    0x23, 0x59, 0x0b, 0x03, 0x0b, 0xff, 0xdd, 0xf1, 0xff, 0xdd, 0x29, 0x03, 0xff, 0xdd, 0x8b, 0xff,
+    0x6a, 0x44, 0xff, 0xed, 0xb2, 0x52, 0x0c, 0x84, 0x3f, 0x0a, 0x28, 0xff, 0xe5, 0x30, 0xcd, 0xff,
+    0xe5, 0x91, 0xff, 0xed, 0xb2, 0xce, 0xff, 0xee, 0x13, 0xff, 0xf6, 0x54, 0x18, 0x0e, 0x05, 0x81,
+    0x14, 0x82, 0x05, 0x00, 0x72, 0x81, 0x05, 0x03, 0xff, 0x83, 0x49, 0xff, 0xcd, 0x29, 0x0b, 0x71,
+    0x85, 0x03, 0x09, 0x39, 0xff, 0xe5, 0x8a, 0x5e, 0x2c, 0x16, 0x0f, 0x31, 0x2c, 0xff, 0x8b, 0x26,
+    0x67, 0x82, 0x0d, 0x08, 0x20, 0xff, 0x52, 0x03, 0x34, 0x0f, 0x30, 0x06, 0x0a, 0x3a, 0x3e, 0x87,
+    0x03, 0x04, 0x62, 0x48, 0x03, 0x6d, 0xb1, 0x95, 0x00, 0x97, 0x00, 0x00, 0xb4, 0x81, 0x06, 0x03,
+    0xff, 0x62, 0x44, 0xff, 0x9c, 0x90, 0x2c, 0x31, 0x83, 0x06, 0x05, 0x0a, 0x41, 0xff, 0x7a, 0x83,
+    0xff, 0xcc, 0xae, 0x3f, 0xff, 0xe5, 0x30, 0x81, 0x0c, 0x03, 0x3f, 0xcd, 0xce, 0x88, 0x82, 0x14,
+    0x84, 0x05, 0x0a, 0xff, 0x83, 0x49, 0x0b, 0x70, 0x6f, 0x23, 0x0b, 0xff, 0xd5, 0xb1, 0xff, 0xee,
+    0x10, 0xff, 0xe5, 0x8c, 0xff, 0xee, 0x0e, 0xff, 0x72, 0x86, 0x88, 0x05, 0x00, 0x14, 0x83, 0x05,
+    0x00, 0x14, 0x85, 0x05, 0x03, 0x53, 0x10, 0x05, 0x9b, 0x81, 0x05, 0x03, 0xff, 0xe6, 0x75, 0xff,
+    0x7a, 0xe5, 0x0b, 0xfd, 0x84, 0x03, 0x04, 0x0b, 0x39, 0x7a, 0x51, 0x2b, 0x81, 0x16, 0x03, 0xff,
+    0x7a, 0xa3, 0x0a, 0x06, 0xff, 0x39, 0x83, 0x82, 0x0d, 0x04, 0x6b, 0x59, 0x16, 0x06, 0x3a, 0x81,
+    0x0a, 0x01, 0x3a, 0x3e, 0x87, 0x03, 0x04, 0xff, 0xbc, 0x87, 0x4c, 0x03, 0x7a, 0x82, 0x95, 0x00,
+    0x96, 0x00, 0x14, 0x99, 0x82, 0x06, 0x0a, 0xff, 0x62, 0xc8, 0xff, 0x9c, 0xb0, 0x70, 0x41, 0x06,
+    0x0a, 0x40, 0x0a, 0x40, 0x41, 0x64, 0xff, 0xde, 0x35, 0xff, 0xe5, 0x30, 0xff, 0xe5, 0x71, 0xce,
+    0xff, 0xf6, 0x55, 0x14, 0x83, 0x05, 0x01, 0x14, 0x0e, 0x84, 0x05, 0x0a, 0xd2, 0xff, 0x8b, 0x46,
+    0x61, 0x5e, 0x23, 0x0b, 0xff, 0xcd, 0x0c, 0x72, 0xff, 0xf6, 0xf7, 0xff, 0xe5, 0xac, 0xff, 0x72,
+    0xc7, 0x83, 0x05, 0x00, 0x53, 0x8f, 0x05, 0x03, 0xfe, 0xff, 0xf6, 0x55, 0xff, 0xf6, 0x96, 0xff,
+    0xff, 0x3a, 0x82, 0x05, 0x02, 0xff, 0x93, 0xcc, 0x9f, 0x91, 0x82, 0x03, 0x00, 0x23, 0x81, 0x0b,
+    0x0a, 0x39, 0x0b, 0xff, 0x6a, 0x63, 0x0a, 0x06, 0xff, 0x62, 0x44, 0xff, 0x39, 0x84, 0xff, 0x29,
+    0x24, 0xff, 0x31, 0x64, 0xc8, 0x20, 0x81, 0x0d, 0x01, 0xff, 0x10, 0xc3, 0x16, 0x81, 0x06, 0x00,
+    0x1e, 0x81, 0x06, 0x01, 0xff, 0x9b, 0x45, 0x61, 0x88, 0x03, 0x04, 0x1e, 0x39, 0x03, 0xe3, 0x8a,
+    0x94, 0x00, 0x96, 0x00, 0x11, 0x99, 0x82, 0x16, 0x2b, 0xff, 0x83, 0xcc, 0x79, 0x98, 0x31, 0x40,
+    0x93, 0x40, 0x68, 0x76, 0x41, 0x69, 0xff, 0xe6, 0x97, 0xff, 0xee, 0x14, 0xff, 0xee, 0x35, 0x85,
+    0x05, 0x05, 0xff, 0xe6, 0x13, 0xff, 0xc5, 0x30, 0xff, 0xb4, 0xaf, 0xff, 0xa4, 0x0c, 0xff, 0xb4,
+    0x8e, 0xff, 0xee, 0x13, 0x82, 0x05, 0x09, 0xff, 0xb4, 0xaf, 0xff, 0xb4, 0x68, 0xff, 0x59, 0xc3,
+    0xff, 0xbc, 0xa9, 0x0b, 0xff, 0xc4, 0xa7, 0xff, 0xd5, 0x8f, 0xff, 0xc4, 0xed, 0x7a, 0xff, 0x7b,
+    0x07, 0x82, 0x05, 0x01, 0x53, 0xd3, 0x8f, 0x05, 0x00, 0x14, 0x81, 0xd4, 0x00, 0x88, 0x82, 0x05,
+    0x02, 0xff, 0xee, 0x96, 0xff, 0x83, 0x26, 0xff, 0x8b, 0x46, 0x82, 0x03, 0x81, 0x0b, 0x12, 0xff,
+    0xdd, 0x8b, 0x39, 0xff, 0xe5, 0x8a, 0xff, 0x62, 0x02, 0xa9, 0xc8, 0x09, 0x02, 0xaf, 0x02, 0x12,
+    0x75, 0x0d, 0x1b, 0xff, 0x41, 0x83, 0x2b, 0x06, 0x2f, 0x3a, 0x81, 0x0a, 0x01, 0x3a, 0x61, 0x88,
+    0x03, 0x04, 0x62, 0x95, 0x03, 0xff, 0x83, 0x45, 0xff, 0xbd, 0x93, 0x94, 0x00, 0x97, 0x00, 0x18,
+    0xb4, 0x0a, 0xff, 0x8b, 0x45, 0x7f, 0xc4, 0x58, 0x2c, 0x39, 0x29, 0x0b, 0x03, 0x48, 0x31, 0x69,
+    0xff, 0xee, 0x97, 0xd4, 0xff, 0xf6, 0x97, 0x05, 0xff, 0xee, 0x75, 0xff, 0xcd, 0x92, 0xff, 0x9c,
+    0x2d, 0xff, 0x93, 0xcc, 0xff, 0x9c, 0x2d, 0xff, 0xbd, 0x11, 0xf9, 0x81, 0x05, 0x02, 0xf9, 0xff,
+    0xa4, 0x8f, 0xff, 0xc4, 0xce, 0x81, 0x05, 0x09, 0x53, 0xff, 0x8b, 0x8a, 0xff, 0x83, 0x28, 0xff,
+    0x7a, 0xc6, 0x6d, 0x0b, 0x48, 0x29, 0x0b, 0xff, 0x83, 0x28, 0x82, 0x05, 0x01, 0x72, 0xd3, 0x90,
+    0x05, 0x02, 0xff, 0xee, 0x34, 0xff, 0xe5, 0xf3, 0x14, 0x83, 0x05, 0x01, 0xff, 0x83, 0x6a, 0xa9,
+    0x81, 0x03, 0x09, 0x27, 0xff, 0xd5, 0x6c, 0x7a, 0xff, 0xe5, 0xcd, 0x46, 0xff, 0xd5, 0x2a, 0xff,
+    0x31, 0x01, 0x6c, 0xaf, 0x02, 0x81, 0x01, 0x81, 0x02, 0x03, 0x1c, 0x67, 0x73, 0x7e, 0x81, 0x06,
+    0x05, 0x2f, 0x21, 0x0f, 0x06, 0xff, 0x9b, 0x44, 0x40, 0x88, 0x03, 0x04, 0x54, 0x16, 0x29, 0xd5,
+    0xff, 0x94, 0x4f, 0x94, 0x00, 0x97, 0x00, 0x08, 0xd6, 0x0a, 0x70, 0xff, 0xad, 0x32, 0x44, 0xca,
+    0x87, 0x7a, 0x27, 0x81, 0x0b, 0x07, 0x6f, 0x2c, 0x64, 0xd2, 0xff, 0xee, 0x34, 0xff, 0xf6, 0x96,
+    0x10, 0xff, 0x9c, 0x2d, 0x81, 0x65, 0x01, 0x42, 0x65, 0x81, 0x42, 0x05, 0xff, 0x5a, 0x26, 0xff,
+    0xac, 0xaf, 0x14, 0x05, 0xff, 0xd5, 0x93, 0xff, 0xff, 0x17, 0x81, 0x05, 0x03, 0xff, 0xf6, 0xd7,
+    0xff, 0x72, 0x86, 0xff, 0xc5, 0x30, 0xff, 0x72, 0xa5, 0x82, 0x0b, 0x02, 0x23, 0xff, 0x8b, 0x27,
+    0xfe, 0x81, 0x05, 0x01, 0x9b, 0x53, 0x84, 0x05, 0x00, 0x10, 0x81, 0x88, 0x00, 0x10, 0x8e, 0x05,
+    0x01, 0xff, 0xcd, 0x72, 0xff, 0x62, 0x22, 0x81, 0x03, 0x08, 0x29, 0xff, 0xdd, 0xae, 0xff, 0xe5,
+    0x8b, 0xff, 0xee, 0x0f, 0x46, 0xba, 0xff, 0x21, 0x25, 0xaf, 0x01, 0x82, 0x02, 0x05, 0x60, 0x09,
+    0x12, 0x20, 0xff, 0x18, 0xe2, 0x0a, 0x83, 0x06, 0x03, 0x31, 0x0a, 0x30, 0x06, 0x88, 0x03, 0x05,
+    0x0b, 0xff, 0x9b, 0xa5, 0x68, 0x6f, 0xff, 0x6b, 0x09, 0x04, 0x93, 0x00, 0x97, 0x00, 0x07, 0x6e,
+    0xff, 0xb3, 0xe7, 0x59, 0xff, 0xc5, 0xd4, 0x00, 0xff, 0x62, 0x88, 0x06, 0x29, 0x82, 0x0b, 0x06,
+    0x29, 0x1e, 0xff, 0x72, 0x83, 0xff, 0xd5, 0xb2, 0x05, 0xff, 0xe6, 0x14, 0xff, 0x93, 0xed, 0x81,
+    0x42, 0x00, 0xff, 0x31, 0x22, 0x81, 0xff, 0x5a, 0x88, 0x00, 0xff, 0x41, 0x84, 0x81, 0xbc, 0x03,
+    0x42, 0xff, 0x39, 0x43, 0xff, 0xa4, 0x6e, 0x14, 0x83, 0x05, 0x03, 0xff, 0xee, 0xb6, 0xff, 0x93,
+    0xcc, 0xff, 0xcd, 0x92, 0xff, 0x72, 0xa5, 0x82, 0x0b, 0x00, 0xfd, 0x82, 0x05, 0x02, 0x9b, 0xd3,
+    0xff, 0xff, 0x17, 0x81, 0x05, 0x08, 0xce, 0xd0, 0xff, 0xa3, 0xab, 0xff, 0xac, 0x2c, 0xff, 0xac,
+    0x6e, 0xff, 0xb4, 0x8e, 0xff, 0xc4, 0xce, 0xff, 0xd5, 0x91, 0x88, 0x8b, 0x05, 0x0a, 0x14, 0x78,
+    0x03, 0x23, 0x48, 0xff, 0xe6, 0x10, 0xff, 0xe5, 0x8b, 0xff, 0xee, 0x31, 0x29, 0xff, 0x4a, 0x04,
+    0x01, 0x83, 0x02, 0x0f, 0x33, 0x57, 0x8e, 0x56, 0x12, 0xff, 0x18, 0xa1, 0xf4, 0x06, 0x2f, 0x06,
+    0x2f, 0x3a, 0x0a, 0x06, 0x30, 0x0b, 0x88, 0x03, 0x03, 0x4c, 0x40, 0x0b, 0x9e, 0x94, 0x00, 0x97,
+    0x00, 0x07, 0x7f, 0x50, 0x59, 0xff, 0xc6, 0x16, 0x00, 0xbd, 0x71, 0x61, 0x83, 0x0b, 0x08, 0x2c,
+    0x98, 0xff, 0xb4, 0xcf, 0x05, 0xff, 0xee, 0x96, 0xff, 0x49, 0xa4, 0x65, 0xff, 0x8c, 0x0f, 0xff,
+    0xde, 0x78, 0x81, 0xff, 0xd6, 0x58, 0x02, 0xff, 0xc5, 0xd6, 0xff, 0x28, 0xe1, 0x42, 0x81, 0xbc,
+    0x02, 0x42, 0xff, 0x41, 0x83, 0xff, 0xc5, 0x52, 0x83, 0x05, 0x07, 0xff, 0xee, 0x96, 0xff, 0xe6,
+    0x34, 0xff, 0xd5, 0xd3, 0xff, 0x6a, 0xa6, 0x9f, 0x0b, 0x90, 0xff, 0xcd, 0x51, 0x81, 0x05, 0x81,
+    0x72, 0x05, 0x10, 0x05, 0xd7, 0xff, 0xac, 0xcf, 0xff, 0xee, 0x96, 0x05, 0x83, 0x0e, 0x00, 0x14,
+    0x8a, 0x05, 0x0c, 0xd3, 0x05, 0x14, 0xe2, 0x23, 0x03, 0x68, 0xff, 0xee, 0x73, 0xff, 0xe5, 0xad,
+    0xff, 0xee, 0x32, 0x90, 0xff, 0x21, 0x66, 0x01, 0x81, 0x02, 0x03, 0x01, 0x2d, 0x56, 0x07, 0x82,
+    0x5d, 0x01, 0xff, 0x18, 0xe3, 0x16, 0x82, 0x06, 0x01, 0x2f, 0x3a, 0x81, 0x0a, 0x01, 0x3a, 0x27,
+    0x88, 0x03, 0x04, 0x29, 0x1e, 0x37, 0xff, 0x62, 0x64, 0x8a, 0x93, 0x00, 0x97, 0x00, 0x08, 0x81,
+    0xff, 0x6a, 0x44, 0x7e, 0xe0, 0x04, 0xc4, 0x58, 0xff, 0xac, 0x07, 0x27, 0x82, 0x0b, 0x06, 0xd1,
+    0xff, 0x9b, 0xc8, 0xff, 0x9b, 0xec, 0x14, 0xff, 0xcd, 0x93, 0x65, 0xff, 0x5a, 0x47, 0x81, 0xff,
+    0xd6, 0x58, 0x0a, 0xff, 0xd6, 0x38, 0xff, 0xd6, 0x58, 0xff, 0x83, 0xee, 0x65, 0x42, 0xff, 0x31,
+    0x22, 0xef, 0xff, 0x62, 0xea, 0x65, 0xff, 0x49, 0x83, 0xf9, 0x85, 0x05, 0x04, 0xff, 0xf6, 0xb6,
+    0xff, 0x8b, 0xab, 0xa9, 0xff, 0xd5, 0x2a, 0xff, 0xb4, 0xad, 0x81, 0x05, 0x02, 0x14, 0x53, 0xff,
+    0xf6, 0x95, 0x82, 0x05, 0x00, 0x14, 0x81, 0x05, 0x85, 0x0e, 0x00, 0x14, 0x86, 0x05, 0x19, 0xff,
+    0xff, 0x17, 0xd4, 0xff, 0xff, 0x17, 0xff, 0xee, 0xb6, 0xff, 0x7b, 0x05, 0x23, 0x03, 0xff, 0xd5,
+    0x08, 0xff, 0xde, 0x34, 0xff, 0xf6, 0xb5, 0xff, 0xdd, 0xaf, 0xff, 0x73, 0x06, 0x01, 0x02, 0x01,
+    0x02, 0x33, 0x47, 0x07, 0x56, 0x5d, 0x13, 0x4d, 0x1c, 0x70, 0x06, 0x82, 0x2f, 0x04, 0x1e, 0x06,
+    0x0a, 0x3a, 0x0b, 0x89, 0x03, 0x03, 0x0a, 0x4c, 0xff, 0x8b, 0x46, 0x8d, 0x93, 0x00, 0x98, 0x00,
+    0x02, 0xff, 0x6a, 0xa8, 0xff, 0x93, 0x46, 0xff, 0xad, 0x32, 0x81, 0x00, 0x02, 0xbe, 0xec, 0x27,
+    0x82, 0x0b, 0x13, 0x4c, 0xff, 0xb4, 0xcd, 0xbb, 0xff, 0xde, 0x35, 0xff, 0x49, 0xe5, 0x65, 0xff,
+    0x83, 0xad, 0xff, 0xd6, 0x58, 0xff, 0xef, 0x3b, 0xff, 0xff, 0x9d, 0xff, 0xef, 0x3b, 0xfc, 0xff,
+    0x30, 0xc0, 0x42, 0xff, 0x6b, 0x2b, 0x49, 0xff, 0xe6, 0xfa, 0x65, 0xff, 0x49, 0xa4, 0xff, 0xbd,
+    0x31, 0x86, 0x05, 0x07, 0x0e, 0xff, 0xe6, 0x35, 0xff, 0x93, 0xcb, 0xff, 0xb4, 0x28, 0xff, 0xf6,
+    0xb6, 0x05, 0xce, 0xff, 0xf6, 0x54, 0x84, 0x05, 0x04, 0xf9, 0xff, 0xb4, 0xf0, 0xff, 0x8b, 0xcc,
+    0xff, 0x73, 0x09, 0xbb, 0x81, 0xbe, 0x07, 0xd6, 0xff, 0x83, 0x6a, 0xff, 0xa4, 0x4e, 0xff, 0xcd,
+    0x92, 0xff, 0xf6, 0xd7, 0x05, 0x53, 0x0e, 0x81, 0x05, 0x0a, 0xff, 0xff, 0xbd, 0x05, 0xff, 0xdd,
+    0xd3, 0xfd, 0x03, 0x23, 0x0b, 0xff, 0xc4, 0xca, 0xff, 0xc5, 0x0d, 0x85, 0x96, 0x82, 0x02, 0x09,
+    0x0d, 0x56, 0x07, 0xf3, 0x5d, 0x07, 0x8e, 0x4f, 0x57, 0xe3, 0x84, 0x06, 0x03, 0x3a, 0x0a, 0x3a,
+    0x0b, 0x89, 0x03, 0x03, 0x37, 0x0a, 0xff, 0x9b, 0xc6, 0xa8, 0x93, 0x00, 0x98, 0x00, 0x02, 0xe9,
+    0xff, 0x72, 0xa5, 0xb0, 0x81, 0x00, 0x02, 0xff, 0x9c, 0x90, 0xa9, 0xa6, 0x82, 0x0b, 0x07, 0xa1,
+    0xff, 0xbc, 0xef, 0xff, 0x49, 0x61, 0xff, 0xe6, 0x35, 0xff, 0xee, 0x96, 0x42, 0xff, 0x83, 0xad,
+    0xff, 0xff, 0x9d, 0x82, 0x49, 0x09, 0xff, 0x6b, 0x2b, 0xff, 0x38, 0xe0, 0xff, 0x30, 0xc0, 0xff,
+    0x39, 0x63, 0xff, 0xe7, 0x1b, 0xef, 0xff, 0x30, 0xc0, 0xff, 0x94, 0x4f, 0xff, 0xde, 0x36, 0x05,
+    0x81, 0x14, 0x02, 0x0e, 0x53, 0x05, 0x83, 0x0e, 0x00, 0x05, 0x81, 0x0e, 0x00, 0x10, 0x82, 0x0e,
+    0x04, 0x05, 0xff, 0xb4, 0xf0, 0xff, 0x5a, 0x25, 0x42, 0x65, 0x83, 0x42, 0x81, 0xff, 0x28, 0x80,
+    0x83, 0x42, 0x0b, 0xff, 0x39, 0x42, 0xff, 0x7b, 0x29, 0xff, 0xd5, 0xd3, 0xff, 0xd5, 0xb3, 0x05,
+    0x53, 0x05, 0xff, 0xbd, 0x10, 0xd5, 0x03, 0x23, 0x03, 0x81, 0x0b, 0x01, 0xff, 0x72, 0xe6, 0x01,
+    0x81, 0x02, 0x0a, 0x1c, 0x57, 0x07, 0x5d, 0xf0, 0x63, 0x09, 0x26, 0x4f, 0x86, 0xab, 0x81, 0x06,
+    0x00, 0x2f, 0x81, 0x06, 0x03, 0x3a, 0x0a, 0x3a, 0x0b, 0x8a, 0x03, 0x02, 0x30, 0x61, 0xff, 0x52,
+    0x26, 0x93, 0x00, 0x98, 0x00, 0x02, 0x44, 0xff, 0x62, 0x45, 0xe4, 0x81, 0x04, 0x02, 0x5f, 0xb6,
+    0x37, 0x82, 0x0b, 0x06, 0x23, 0xff, 0xa4, 0x6e, 0xff, 0x51, 0x80, 0xff, 0xc5, 0x31, 0x14, 0xff,
+    0x41, 0x83, 0x9a, 0x83, 0x49, 0x02, 0xd8, 0xff, 0x49, 0x40, 0xff, 0x38, 0xe0, 0x81, 0x65, 0x03,
+    0x42, 0xff, 0x39, 0x00, 0xff, 0x7b, 0x4a, 0xd4, 0x81, 0x14, 0x81, 0x0e, 0x01, 0x72, 0x14, 0x83,
+    0x10, 0x83, 0x18, 0x00, 0xff, 0xfe, 0x96, 0x81, 0x10, 0x01, 0xff, 0xd5, 0xd3, 0xff, 0x49, 0xa4,
+    0x81, 0x42, 0x01, 0x65, 0x42, 0x82, 0xff, 0x20, 0xa0, 0x00, 0xbc, 0x81, 0x42, 0x82, 0xbc, 0x03,
+    0x42, 0xff, 0x30, 0xc0, 0xff, 0x49, 0xe5, 0xff, 0xe6, 0x76, 0x82, 0x14, 0x01, 0xff, 0x9c, 0x2d,
+    0x90, 0x82, 0x03, 0x02, 0x23, 0xff, 0xbc, 0xc9, 0x36, 0x82, 0x02, 0x00, 0x0d, 0x81, 0x13, 0x07,
+    0x55, 0xa7, 0x11, 0x02, 0x2d, 0x43, 0x4e, 0xc6, 0x84, 0x06, 0x03, 0x3a, 0x0a, 0x3a, 0x27, 0x83,
+    0x03, 0x00, 0xa6, 0x85, 0x03, 0x03, 0x4c, 0x62, 0x82, 0x5f, 0x92, 0x00, 0x99, 0x00, 0x01, 0xff,
+    0xac, 0xf1, 0xb5, 0x81, 0x00, 0x02, 0x04, 0xbd, 0xff, 0xa3, 0xe7, 0x83, 0x0b, 0x05, 0xff, 0xa4,
+    0x09, 0xff, 0x93, 0xec, 0xff, 0x83, 0x49, 0x0e, 0xff, 0xac, 0xaf, 0xff, 0x94, 0x4f, 0x83, 0x49,
+    0x02, 0x7f, 0xff, 0x82, 0x83, 0xff, 0x59, 0xa1, 0x81, 0x65, 0x05, 0xff, 0x30, 0xc0, 0xff, 0x6a,
+    0x02, 0xff, 0x8b, 0xaa, 0x9b, 0x14, 0x0e, 0x81, 0x10, 0x01, 0x9b, 0x0e, 0x81, 0x18, 0x82, 0x24,
+    0x81, 0x4b, 0x81, 0x24, 0x09, 0x18, 0x24, 0xd7, 0xff, 0x5a, 0x47, 0xff, 0x62, 0x67, 0xff, 0x9c,
+    0x0d, 0xff, 0xc5, 0x31, 0xff, 0xe5, 0xf3, 0x18, 0xff, 0xfe, 0x96, 0x81, 0x18, 0x09, 0xff, 0xe5,
+    0xf3, 0xff, 0xc4, 0xf0, 0xff, 0x9b, 0xec, 0xbb, 0xff, 0x31, 0x01, 0x42, 0xff, 0x20, 0xa0, 0xff,
+    0x30, 0xe1, 0xff, 0x52, 0x06, 0xff, 0xd5, 0xf3, 0x81, 0x0e, 0x01, 0xff, 0x83, 0x4a, 0x7a, 0x82,
+    0x03, 0x10, 0x0b, 0xff, 0x4a, 0x25, 0x25, 0x01, 0x02, 0x12, 0xc9, 0x13, 0x55, 0xff, 0x32, 0x8e,
+    0x11, 0x01, 0x02, 0x12, 0xff, 0x19, 0xca, 0x4e, 0xff, 0x39, 0x84, 0x81, 0x06, 0x00, 0x2f, 0x81,
+    0x06, 0x02, 0x31, 0x0a, 0x2c, 0x85, 0x03, 0x00, 0x29, 0x85, 0x03, 0x02, 0x1e, 0x51, 0x7b, 0x92,
+    0x00, 0x9a, 0x00, 0x05, 0x66, 0x81, 0x00, 0x04, 0xa0, 0xb4, 0x83, 0x0b, 0x02, 0x54, 0x70, 0xff,
+    0x51, 0xa2, 0x81, 0x10, 0x00, 0xe4, 0x83, 0x49, 0x08, 0xd9, 0xff, 0x8a, 0xe4, 0xff, 0xbb, 0xc5,
+    0xff, 0x39, 0x21, 0x65, 0xff, 0x61, 0xe2, 0xff, 0xb3, 0xc6, 0xff, 0x93, 0xcb, 0x72, 0x82, 0x10,
+    0x02, 0x0e, 0x9b, 0x14, 0x81, 0x4b, 0x81, 0x1d, 0x82, 0x3b, 0x83, 0x1d, 0x02, 0xff, 0xdd, 0x91,
+    0xff, 0xe5, 0xd3, 0x1d, 0x81, 0x3b, 0x82, 0x22, 0x84, 0x19, 0x0a, 0x22, 0x1d, 0xff, 0xbc, 0xef,
+    0xff, 0x7b, 0x09, 0xff, 0xc5, 0x72, 0x14, 0x10, 0x0e, 0x14, 0xff, 0x72, 0xe7, 0x0b, 0x81, 0x03,
+    0x02, 0x23, 0xff, 0x8b, 0x86, 0xc1, 0x82, 0x02, 0x00, 0x2d, 0x81, 0x13, 0x09, 0x56, 0x33, 0x01,
+    0x02, 0x01, 0x12, 0xb2, 0x4e, 0xff, 0x18, 0xc2, 0x40, 0x82, 0x06, 0x04, 0x0a, 0x1e, 0x0a, 0x3a,
+    0x27, 0x84, 0x03, 0x00, 0xff, 0xd5, 0x08, 0x85, 0x03, 0x02, 0x62, 0x2b, 0xff, 0x73, 0x4b, 0x92,
+    0x00, 0x99, 0x00, 0x02, 0x04, 0x74, 0x7b, 0x82, 0x04, 0x01, 0xff, 0xac, 0xf1, 0x91, 0x82, 0x0b,
+    0x06, 0xff, 0xe5, 0xaa, 0x41, 0xf7, 0xff, 0xbc, 0xf0, 0x18, 0xff, 0xe6, 0x34, 0x8b, 0x83, 0x49,
+    0x07, 0xff, 0x7a, 0xa5, 0xff, 0xbb, 0xe6, 0xff, 0xa3, 0x65, 0xff, 0x62, 0x02, 0xff, 0xab, 0xa5,
+    0xff, 0xbc, 0x06, 0xff, 0x8b, 0xcc, 0x05, 0x82, 0x18, 0x04, 0x10, 0x72, 0xff, 0xf6, 0x96, 0x1d,
+    0x3b, 0x83, 0x22, 0x00, 0x19, 0x81, 0x22, 0x00, 0x19, 0x82, 0x22, 0x85, 0x19, 0x04, 0x15, 0xff,
+    0xfe, 0x12, 0x19, 0x15, 0xff, 0xfe, 0x12, 0x81, 0x19, 0x02, 0x22, 0x1d, 0x24, 0x81, 0x18, 0x03,
+    0x10, 0x14, 0xe2, 0x23, 0x81, 0x03, 0x06, 0xff, 0xb4, 0x89, 0xff, 0x31, 0x65, 0x02, 0x01, 0x02,
+    0x11, 0x4d, 0x81, 0x07, 0x01, 0x01, 0x02, 0x82, 0x01, 0x06, 0x1b, 0xff, 0x19, 0xca, 0x4e, 0xff,
+    0x10, 0xa1, 0x71, 0x0f, 0x2f, 0x82, 0x06, 0x02, 0x1e, 0x31, 0x27, 0x84, 0x03, 0x01, 0x46, 0x29,
+    0x84, 0x03, 0x02, 0x29, 0x30, 0x9e, 0x92, 0x00, 0x9a, 0x00, 0x02, 0x04, 0x74, 0x00, 0x82, 0x04,
+    0x01, 0xac, 0xff, 0xbc, 0xc9, 0x82, 0x0b, 0x02, 0xd1, 0x50, 0xff, 0x83, 0x4a, 0x81, 0x24, 0x01,
+    0xff, 0xf6, 0x55, 0xd4, 0x82, 0x49, 0x01, 0xff, 0xac, 0xaf, 0xff, 0xa3, 0x65, 0x81, 0xff, 0xbb,
+    0xe5, 0x03, 0xff, 0xbb, 0xe6, 0xff, 0xab, 0xa5, 0xff, 0xac, 0xd1, 0x24, 0x82, 0x4b, 0x03, 0xff,
+    0xf6, 0x55, 0x72, 0xff, 0xe5, 0xb2, 0x22, 0x83, 0x19, 0x01, 0x15, 0xff, 0xfd, 0xf3, 0x84, 0x19,
+    0x85, 0x15, 0x81, 0x32, 0x84, 0x15, 0x81, 0x19, 0x00, 0x3b, 0x81, 0x1d, 0x03, 0x24, 0x18, 0xd7,
+    0xd1, 0x81, 0x23, 0x02, 0x90, 0xff, 0x41, 0x41, 0x11, 0x81, 0x02, 0x05, 0x01, 0x2d, 0x8e, 0x13,
+    0x47, 0x0d, 0x81, 0x02, 0x07, 0x01, 0x26, 0x38, 0x2e, 0x4e, 0xff, 0x10, 0x81, 0x41, 0x34, 0x81,
+    0x2f, 0x01, 0x06, 0x0a, 0x81, 0x31, 0x00, 0x27, 0x85, 0x03, 0x00, 0x48, 0x85, 0x03, 0x02, 0xff,
+    0xa3, 0xe6, 0x78, 0xff, 0xce, 0x15, 0x91, 0x00, 0x9c, 0x00, 0x01, 0x04, 0x00, 0x81, 0x04, 0x02,
+    0x74, 0xff, 0x5a, 0x45, 0xea, 0x81, 0x0b, 0x03, 0xff, 0xac, 0x07, 0xec, 0xa4, 0x24, 0x82, 0x1d,
+    0x12, 0x14, 0xff, 0xff, 0x19, 0xff, 0xe6, 0x76, 0xff, 0xcd, 0xf5, 0xf5, 0x70, 0xff, 0x9b, 0x46,
+    0xff, 0x9b, 0x87, 0xff, 0x93, 0x88, 0xff, 0xf6, 0x54, 0x3b, 0x22, 0x3b, 0x1d, 0xff, 0xf5, 0xf2,
+    0xff, 0xd4, 0xcd, 0xff, 0xf5, 0xf3, 0x19, 0x15, 0x81, 0x19, 0x86, 0x15, 0x00, 0x32, 0x81, 0x15,
+    0x03, 0x32, 0x15, 0x89, 0x32, 0x81, 0x15, 0x01, 0x32, 0x15, 0x81, 0x32, 0x81, 0x15, 0x01, 0x19,
+    0x22, 0x81, 0x3b, 0x08, 0x1d, 0x24, 0xff, 0xac, 0x6e, 0x90, 0x03, 0x90, 0xab, 0xff, 0x31, 0x22,
+    0xaf, 0x82, 0x02, 0x00, 0xa7, 0x81, 0x07, 0x00, 0x57, 0x81, 0x01, 0x0c, 0x02, 0x01, 0x09, 0x45,
+    0x4e, 0x43, 0xff, 0x39, 0xa5, 0x59, 0x2f, 0x06, 0x2f, 0x06, 0x0a, 0x81, 0x31, 0x00, 0x27, 0x85,
+    0x03, 0x00, 0x54, 0x85, 0x03, 0x02, 0x85, 0x59, 0xd8, 0x91, 0x00, 0x9f, 0x00, 0x81, 0x04, 0x07,
+    0x7c, 0xff, 0x62, 0x65, 0xff, 0xd5, 0x2a, 0x0b, 0x6d, 0x5e, 0xad, 0xff, 0xee, 0x33, 0x81, 0x3b,
+    0x81, 0x22, 0x02, 0x19, 0xff, 0xf5, 0xd2, 0xff, 0xed, 0x90, 0x82, 0x52, 0x01, 0xff, 0xed, 0x70,
+    0xff, 0xf5, 0xf2, 0x87, 0x19, 0x01, 0x15, 0x19, 0x81, 0x15, 0x02, 0x32, 0x15, 0x32, 0x82, 0x15,
+    0x05, 0x89, 0x15, 0x32, 0x89, 0x15, 0x89, 0x83, 0x32, 0x02, 0x15, 0x32, 0x89, 0x82, 0x15, 0x03,
+    0x19, 0x22, 0x1d, 0x3b, 0x81, 0x1d, 0x06, 0xff, 0x93, 0xab, 0x0b, 0xa1, 0xff, 0x72, 0xc7, 0xff,
+    0x9b, 0xeb, 0xff, 0x29, 0x65, 0x01, 0x81, 0x02, 0x01, 0x11, 0x4d, 0x81, 0x07, 0x00, 0x26, 0x81,
+    0x02, 0x08, 0x01, 0x36, 0x1a, 0x38, 0x4e, 0x26, 0xff, 0x7b, 0xad, 0xff, 0x72, 0x83, 0x06, 0x81,
+    0x2f, 0x81, 0x06, 0x01, 0x2c, 0x31, 0x86, 0x03, 0x01, 0x46, 0x37, 0x85, 0x03, 0x01, 0xff, 0xa3,
+    0xe7, 0xc6, 0x91, 0x00, 0xa1, 0x00, 0x07, 0x04, 0x7c, 0xff, 0x5a, 0x45, 0x9f, 0x0b, 0xa9, 0xff,
+    0x6a, 0x23, 0xff, 0xb4, 0xae, 0x81, 0x22, 0x01, 0x19, 0x15, 0x83, 0x32, 0x86, 0x15, 0x02, 0x19,
+    0x15, 0x19, 0x84, 0x15, 0x02, 0x89, 0x15, 0x32, 0x82, 0x15, 0x01, 0x89, 0x15, 0x81, 0x32, 0x03,
+    0x15, 0x89, 0x32, 0x15, 0x81, 0x32, 0x02, 0x15, 0x32, 0xff, 0xfd, 0xb1, 0x82, 0x15, 0x81, 0x19,
+    0x1c, 0x22, 0x24, 0x22, 0x3b, 0x1d, 0xff, 0x93, 0xa7, 0xff, 0xac, 0x07, 0xff, 0x83, 0x29, 0x52,
+    0xff, 0x7a, 0xe8, 0xff, 0x29, 0xa8, 0x01, 0x02, 0x01, 0x09, 0x47, 0x13, 0x8e, 0x1b, 0x02, 0x01,
+    0x12, 0x1a, 0x20, 0xa7, 0x4f, 0x96, 0xff, 0xce, 0x37, 0x64, 0x84, 0x06, 0x02, 0x2c, 0x31, 0x0b,
+    0x82, 0x03, 0x00, 0x29, 0x82, 0x03, 0x01, 0x61, 0x23, 0x81, 0x03, 0x06, 0x29, 0x0b, 0x03, 0x85,
+    0xaa, 0xbf, 0x04, 0x8f, 0x00, 0xa2, 0x00, 0x07, 0x04, 0xff, 0x7b, 0x6c, 0x69, 0xba, 0xff, 0xac,
+    0x48, 0xaa, 0xff, 0x93, 0xcb, 0x22, 0x81, 0x19, 0x04, 0xff, 0xf5, 0xb1, 0x15, 0x32, 0x89, 0x15,
+    0x81, 0x32, 0x01, 0x15, 0x32, 0x83, 0x15, 0x82, 0x19, 0x01, 0x15, 0x19, 0x86, 0x15, 0x00, 0x32,
+    0x81, 0x15, 0x02, 0x32, 0x15, 0x89, 0x81, 0x15, 0x81, 0x32, 0x81, 0x15, 0x00, 0x89, 0x82, 0x15,
+    0x82, 0x19, 0x0a, 0x3b, 0x10, 0x3b, 0x1d, 0xff, 0xd5, 0x51, 0xff, 0x8b, 0x47, 0xff, 0xac, 0x2c,
+    0xff, 0xed, 0x70, 0x28, 0xab, 0x01, 0x82, 0x02, 0x10, 0x12, 0x84, 0x07, 0xed, 0x09, 0x01, 0x36,
+    0x1a, 0x0d, 0x45, 0x4e, 0x4d, 0xff, 0x52, 0xca, 0x81, 0xb6, 0x2f, 0x06, 0x81, 0x2f, 0x03, 0x06,
+    0x3a, 0x31, 0x0b, 0x81, 0x03, 0x01, 0x0b, 0x39, 0x82, 0x03, 0x01, 0x68, 0x39, 0x82, 0x03, 0x00,
+    0x39, 0x81, 0x0b, 0x02, 0xff, 0x8b, 0x45, 0xff, 0x73, 0x4a, 0x04, 0x8f, 0x00, 0xa2, 0x00, 0x0a,
+    0x04, 0x66, 0xf4, 0x41, 0xe3, 0xff, 0x49, 0x61, 0xff, 0x7b, 0x08, 0x3b, 0x22, 0x15, 0x19, 0x82,
+    0x15, 0x00, 0x32, 0x81, 0x15, 0x02, 0x32, 0x15, 0xff, 0xfe, 0x12, 0x81, 0x15, 0x85, 0x19, 0x00,
+    0x15, 0x84, 0x19, 0x06, 0x15, 0x19, 0xff, 0xfd, 0xf3, 0x15, 0xff, 0xfe, 0x12, 0x15, 0x19, 0x84,
+    0x15, 0x01, 0x32, 0x19, 0x81, 0x15, 0x09, 0x19, 0x22, 0x19, 0x3b, 0x1d, 0x14, 0x1d, 0x24, 0xff,
+    0xd5, 0x70, 0xff, 0xee, 0x14, 0x81, 0x3b, 0x02, 0xff, 0xed, 0xb1, 0xff, 0x39, 0x43, 0x5c, 0x82,
+    0x02, 0x00, 0x01, 0x81, 0x07, 0x00, 0xa5, 0x81, 0x09, 0x09, 0x1a, 0x0d, 0x17, 0xb2, 0x4e, 0x12,
+    0x8d, 0x04, 0xad, 0x06, 0x81, 0x2f, 0x81, 0x06, 0x02, 0x31, 0x3a, 0x0b, 0x82, 0x03, 0x00, 0x48,
+    0x82, 0x03, 0x01, 0x39, 0x95, 0x82, 0x03, 0x05, 0xff, 0xbc, 0xa8, 0x0b, 0x03, 0xff, 0xcd, 0x29,
+    0xff, 0x41, 0x42, 0x5a, 0x8f, 0x00, 0xa3, 0x00, 0x01, 0x66, 0xff, 0xb3, 0xe6, 0x81, 0x06, 0x08,
+    0xff, 0x8a, 0xe4, 0xff, 0x6a, 0x86, 0x1d, 0x3b, 0x14, 0x15, 0xff, 0xfe, 0x12, 0x19, 0x15, 0x81,
+    0x19, 0x00, 0x15, 0x81, 0x19, 0x81, 0x15, 0x81, 0x19, 0x81, 0x22, 0x02, 0x3b, 0x22, 0x19, 0x84,
+    0x22, 0x00, 0x19, 0x81, 0x22, 0x02, 0x19, 0x22, 0x19, 0x81, 0x22, 0x83, 0x19, 0x00, 0x15, 0x81,
+    0x19, 0x00, 0xff, 0xfd, 0xf3, 0x81, 0x22, 0x07, 0x19, 0x3b, 0x1d, 0xff, 0xfe, 0x96, 0x14, 0x24,
+    0x18, 0x24, 0x82, 0x18, 0x01, 0xff, 0xf6, 0x34, 0xff, 0x29, 0x02, 0x82, 0x02, 0x05, 0x01, 0x63,
+    0x07, 0x13, 0x25, 0x0d, 0x82, 0x1a, 0x00, 0x45, 0x81, 0x4e, 0x03, 0xff, 0x21, 0x66, 0x04, 0x00,
+    0xad, 0x82, 0x06, 0x04, 0x2f, 0x06, 0x3a, 0x2c, 0x0b, 0x82, 0x03, 0x00, 0x76, 0x83, 0x03, 0x01,
+    0x0a, 0x46, 0x81, 0x03, 0x05, 0xa6, 0xff, 0xb4, 0x68, 0x27, 0x23, 0xff, 0x83, 0x25, 0xb0, 0x8f,
+    0x00, 0xa2, 0x00, 0x01, 0x04, 0xff, 0x52, 0x25, 0x82, 0x06, 0x07, 0x2b, 0xab, 0x1d, 0xff, 0xee,
+    0x55, 0x14, 0x19, 0x22, 0x15, 0x81, 0x22, 0x00, 0x15, 0x81, 0x22, 0x81, 0x19, 0x02, 0x3b, 0xff,
+    0xf5, 0xf3, 0xff, 0xd5, 0x2f, 0x8b, 0x1d, 0x02, 0x3b, 0x1d, 0x22, 0x81, 0x3b, 0x83, 0x22, 0x00,
+    0x19, 0x81, 0x22, 0x00, 0x19, 0x81, 0x3b, 0x01, 0x22, 0x3b, 0x81, 0x1d, 0x01, 0x14, 0xff, 0xfe,
+    0x96, 0x82, 0x18, 0x81, 0x10, 0x03, 0x18, 0x88, 0xff, 0x28, 0xe2, 0x01, 0x82, 0x02, 0x04, 0x63,
+    0x07, 0xf3, 0xff, 0x19, 0xca, 0x0d, 0x81, 0x1a, 0x08, 0x2a, 0x2e, 0x4e, 0x1c, 0xff, 0x94, 0x70,
+    0x04, 0x00, 0xff, 0x52, 0x25, 0x0a, 0x83, 0x06, 0x81, 0x1e, 0x00, 0x27, 0x82, 0x03, 0x00, 0x61,
+    0x83, 0x03, 0x01, 0x40, 0x3e, 0x82, 0x03, 0x00, 0xff, 0xac, 0x27, 0x81, 0x0b, 0x02, 0x6d, 0xbe,
+    0x04, 0x8e, 0x00, 0xa3, 0x00, 0x00, 0xe1, 0x82, 0x06, 0x06, 0x0a, 0xff, 0x51, 0xc4, 0x10, 0xff,
+    0xe5, 0xf4, 0x53, 0xff, 0xf6, 0x13, 0x3b, 0x81, 0x1d, 0x00, 0x22, 0x81, 0x1d, 0x00, 0x22, 0x82,
+    0x1d, 0x01, 0x3f, 0xff, 0xa3, 0xec, 0x81, 0x24, 0x00, 0x4b, 0x85, 0x24, 0x81, 0x4b, 0x01, 0x1d,
+    0x4b, 0x8f, 0x1d, 0x07, 0x4b, 0x24, 0xfe, 0x0e, 0x14, 0x4b, 0x14, 0xff, 0xff, 0x19, 0x81, 0x10,
+    0x10, 0x14, 0xff, 0x31, 0x43, 0xc1, 0x11, 0x01, 0xf1, 0x26, 0x4e, 0x4f, 0xa7, 0x38, 0x1a, 0x2a,
+    0xff, 0x19, 0xca, 0x4f, 0x4d, 0xff, 0x31, 0xa6, 0x82, 0x04, 0x01, 0xff, 0x52, 0x06, 0x0a, 0x81,
+    0x06, 0x03, 0x2f, 0x06, 0x30, 0x1e, 0x83, 0x03, 0x00, 0x40, 0x83, 0x03, 0x01, 0x3e, 0x62, 0x82,
+    0x03, 0x01, 0x9f, 0xa1, 0x81, 0x03, 0x01, 0xff, 0x83, 0x26, 0xff, 0xcd, 0xf5, 0x8e, 0x00, 0xa2,
+    0x00, 0x02, 0x44, 0x82, 0x06, 0x81, 0x2f, 0x05, 0x06, 0xff, 0x6a, 0x44, 0x14, 0xd7, 0xff, 0xee,
+    0xb7, 0x1d, 0x81, 0x24, 0x02, 0x1d, 0x24, 0x4b, 0x81, 0x1d, 0x00, 0x4b, 0x81, 0x24, 0x02, 0x3f,
+    0xff, 0x8b, 0x08, 0xff, 0xee, 0x34, 0x8a, 0x18, 0x85, 0x24, 0x00, 0x4b, 0x81, 0x24, 0x85, 0x4b,
+    0x82, 0x24, 0x06, 0x18, 0xff, 0xf6, 0xb8, 0x53, 0x24, 0x18, 0xff, 0xff, 0x19, 0x72, 0x82, 0x0e,
+    0x00, 0xff, 0x52, 0x06, 0x82, 0x09, 0x01, 0x96, 0x0d, 0x82, 0x4f, 0x06, 0xf6, 0xff, 0x11, 0x47,
+    0xff, 0x22, 0x0c, 0x4f, 0x4d, 0x38, 0xbf, 0x81, 0x04, 0x02, 0x3d, 0xff, 0x5a, 0x87, 0x0a, 0x81,
+    0x2f, 0x81, 0x06, 0x81, 0x30, 0x83, 0x03, 0x01, 0x40, 0x46, 0x82, 0x03, 0x02, 0x37, 0x0a, 0x54,
+    0x81, 0x03, 0x01, 0x27, 0xd5, 0x81, 0x03, 0x02, 0xea, 0xac, 0x04, 0x8d, 0x00, 0xa2, 0x00, 0x01,
+    0x5f, 0xca, 0x81, 0x06, 0x05, 0x0f, 0x06, 0x64, 0x14, 0xff, 0xdd, 0x70, 0xff, 0xdd, 0x91, 0x81,
+    0x18, 0x81, 0x24, 0x00, 0x18, 0x82, 0x24, 0x83, 0x18, 0x02, 0xff, 0xe5, 0x71, 0xff, 0xcc, 0xee,
+    0x10, 0x93, 0x18, 0x85, 0x24, 0x81, 0x18, 0x04, 0xff, 0xfe, 0x96, 0xff, 0xe6, 0x14, 0xff, 0xf6,
+    0xb8, 0x18, 0x10, 0x81, 0xff, 0xff, 0x19, 0x00, 0x14, 0x81, 0x0e, 0x06, 0xff, 0x93, 0xec, 0x6a,
+    0x1f, 0x96, 0x1a, 0x20, 0x4d, 0x84, 0x4f, 0x02, 0xa5, 0xf6, 0xff, 0x73, 0x8d, 0x82, 0x04, 0x01,
+    0x3d, 0xac, 0x81, 0x06, 0x00, 0x2f, 0x81, 0x06, 0x81, 0x0f, 0x82, 0x03, 0x02, 0x0b, 0x0a, 0x39,
+    0x82, 0x03, 0x02, 0x48, 0x0a, 0x95, 0x82, 0x03, 0x05, 0xd5, 0x46, 0x03, 0x0b, 0xff, 0x7b, 0x06,
+    0xc4, 0x8d, 0x00, 0xa2, 0x00, 0x02, 0xff, 0xde, 0x77, 0x78, 0x06, 0x82, 0x0f, 0x00, 0x77, 0x82,
+    0x10, 0x89, 0x18, 0x8f, 0x10, 0x8f, 0x18, 0x81, 0x10, 0x06, 0xff, 0xed, 0xf2, 0xff, 0xee, 0x13,
+    0x10, 0x0e, 0xff, 0xee, 0x55, 0xff, 0xee, 0x14, 0x14, 0x81, 0x0e, 0x02, 0xd7, 0xff, 0x31, 0x64,
+    0x0d, 0x81, 0x1a, 0x02, 0x0d, 0xf6, 0x4e, 0x81, 0x4f, 0x03, 0x4e, 0x57, 0x2d, 0xff, 0x4a, 0x69,
+    0x83, 0x04, 0x04, 0x3d, 0xff, 0x73, 0x0a, 0x16, 0x06, 0x0f, 0x82, 0x06, 0x00, 0x16, 0x83, 0x03,
+    0x01, 0x06, 0x48, 0x82, 0x03, 0x00, 0x46, 0x81, 0x0a, 0x82, 0x03, 0x01, 0x6d, 0x7e, 0x81, 0x0b,
+    0x02, 0xea, 0x8c, 0x04, 0x8c, 0x00, 0xa2, 0x00, 0x03, 0xda, 0x59, 0x06, 0x2f, 0x81, 0x0f, 0x01,
+    0x77, 0xff, 0xee, 0x34, 0x83, 0x10, 0x00, 0xff, 0xfe, 0xb5, 0xa8, 0x10, 0x81, 0x0e, 0x82, 0x14,
+    0x00, 0x05, 0x81, 0x14, 0x02, 0x88, 0xff, 0xcc, 0xef, 0x83, 0x81, 0x20, 0x81, 0x0d, 0x01, 0x2a,
+    0x2e, 0x81, 0x4e, 0x03, 0x2e, 0x38, 0xdf, 0xa0, 0x83, 0x04, 0x05, 0x3d, 0xfc, 0x2b, 0x06, 0x21,
+    0x0a, 0x81, 0x06, 0x00, 0x4c, 0x83, 0x03, 0x01, 0x06, 0x37, 0x83, 0x03, 0x02, 0x06, 0x34, 0x37,
+    0x82, 0x03, 0x05, 0xe2, 0x6f, 0x03, 0x23, 0xff, 0x7b, 0x06, 0x7c, 0x8c, 0x00, 0xa2, 0x00, 0x01,
+    0xbf, 0xfd, 0x81, 0x06, 0x06, 0x0f, 0x2b, 0x69, 0xff, 0xcd, 0x92, 0x0e, 0x10, 0x0e, 0x88, 0x10,
+    0x84, 0x0e, 0x85, 0x10, 0x00, 0x0e, 0x93, 0x10, 0x82, 0x0e, 0x84, 0x14, 0x07, 0x05, 0x14, 0xff,
+    0xdd, 0x30, 0xff, 0x31, 0x65, 0xff, 0x29, 0xa9, 0x09, 0x17, 0x45, 0x81, 0x0d, 0x00, 0x20, 0x81,
+    0x2a, 0x02, 0x67, 0xc3, 0x5a, 0x84, 0x04, 0x04, 0x3d, 0xfc, 0x71, 0x06, 0x30, 0x81, 0x06, 0x01,
+    0x0f, 0x76, 0x82, 0x03, 0x02, 0x46, 0x34, 0x68, 0x82, 0x03, 0x01, 0x27, 0x06, 0x81, 0x0a, 0x82,
+    0x03, 0x01, 0xfd, 0x5e, 0x81, 0x0b, 0x02, 0x85, 0xff, 0x73, 0x4b, 0x04, 0x8b, 0x00, 0xa2, 0x00,
+    0x07, 0xff, 0xad, 0x32, 0xba, 0x40, 0x06, 0x0f, 0x06, 0xff, 0x51, 0xa2, 0xff, 0xb4, 0xaf, 0x81,
+    0x0e, 0x02, 0x14, 0xfe, 0x10, 0x8d, 0x0e, 0x00, 0x10, 0x81, 0x0e, 0x00, 0x10, 0x86, 0x0e, 0x81,
+    0x10, 0x83, 0x0e, 0x81, 0x10, 0x83, 0x0e, 0x02, 0x10, 0x0e, 0x14, 0x84, 0x05, 0x81, 0x14, 0x07,
+    0x05, 0xff, 0xe5, 0xd2, 0xff, 0x39, 0x85, 0x09, 0x11, 0x36, 0x45, 0x2a, 0x82, 0x0d, 0x03, 0x1b,
+    0x6b, 0xff, 0x84, 0x2f, 0x00, 0x85, 0x04, 0x08, 0x3d, 0x8c, 0x71, 0x06, 0x1e, 0x0a, 0x06, 0x1e,
+    0x29, 0x82, 0x03, 0x02, 0x48, 0x06, 0x68, 0x82, 0x03, 0x00, 0x0b, 0x81, 0x06, 0x01, 0x97, 0x0b,
+    0x81, 0x03, 0x02, 0xa1, 0xff, 0x41, 0x20, 0x6f, 0x81, 0x0b, 0x01, 0xff, 0x72, 0xc5, 0x74, 0x8b,
+    0x00, 0xa2, 0x00, 0x02, 0x7f, 0xd5, 0x76, 0x82, 0x06, 0x01, 0xff, 0x39, 0x21, 0xff, 0x93, 0xcc,
+    0x81, 0x0e, 0x01, 0x14, 0xd3, 0x97, 0x0e, 0x04, 0x10, 0x0e, 0x10, 0x14, 0x05, 0x8a, 0x0e, 0x01,
+    0x05, 0x53, 0x85, 0x05, 0x07, 0xff, 0xee, 0x75, 0xff, 0x39, 0xa6, 0x12, 0x60, 0x11, 0x2a, 0xff,
+    0x08, 0x62, 0x2a, 0x81, 0x20, 0x02, 0x73, 0xc3, 0x7c, 0x87, 0x04, 0x08, 0x3d, 0xff, 0x6b, 0x2a,
+    0xd1, 0x06, 0x1e, 0x0a, 0x06, 0x1e, 0x0b, 0x82, 0x03, 0x02, 0x76, 0x0a, 0x3e, 0x82, 0x03, 0x00,
+    0x23, 0x81, 0x06, 0x01, 0x1e, 0x48, 0x81, 0x03, 0x02, 0x0b, 0xff, 0x49, 0xc4, 0xff, 0x72, 0xe5,
+    0x81, 0x03, 0x02, 0xff, 0xb4, 0x89, 0xbd, 0x04, 0x8a, 0x00, 0xa2, 0x00, 0x0b, 0xe9, 0xff, 0xac,
+    0x48, 0x46, 0x0a, 0x06, 0x71, 0xff, 0x73, 0x2b, 0xff, 0x6a, 0xa8, 0x14, 0x0e, 0x10, 0x72, 0x84,
+    0x0e, 0x84, 0x14, 0x01, 0x0e, 0x14, 0x8b, 0x0e, 0x06, 0x14, 0xff, 0xbd, 0x10, 0xff, 0x7b, 0x2a,
+    0xff, 0x51, 0xa3, 0xff, 0x41, 0x21, 0xbb, 0xff, 0xd5, 0xb3, 0x84, 0x0e, 0x83, 0x14, 0x01, 0x05,
+    0x72, 0x84, 0x05, 0x02, 0xd2, 0xff, 0x31, 0xc7, 0x11, 0x81, 0x01, 0x08, 0x20, 0x80, 0xd9, 0xc2,
+    0xff, 0x94, 0x70, 0xc2, 0x81, 0x04, 0x00, 0x81, 0x04, 0x02, 0x00, 0x04, 0x00, 0x82, 0x04, 0x04,
+    0x3d, 0x8c, 0x2b, 0x06, 0x1e, 0x81, 0x06, 0x00, 0x0f, 0x83, 0x03, 0x02, 0x93, 0x0a, 0x3e, 0x83,
+    0x03, 0x81, 0x06, 0x01, 0x0a, 0x16, 0x81, 0x03, 0x07, 0x23, 0xff, 0x62, 0x85, 0xff, 0x6b, 0x09,
+    0xff, 0xd5, 0x2a, 0x03, 0x0b, 0xff, 0x62, 0x65, 0x04, 0x8a, 0x00, 0xa2, 0x00, 0x07, 0xff, 0x9c,
+    0x8f, 0xff, 0xb4, 0x68, 0x03, 0x93, 0x06, 0x50, 0xb0, 0xff, 0x5a, 0x47, 0x81, 0x14, 0x02, 0x18,
+    0x9b, 0x14, 0x82, 0x0e, 0x01, 0x14, 0x05, 0x81, 0x14, 0x03, 0x05, 0xff, 0xc5, 0x31, 0xd2, 0x05,
+    0x85, 0x0e, 0x0d, 0x14, 0x05, 0xff, 0xf6, 0x96, 0xff, 0xde, 0x14, 0xff, 0xbd, 0x11, 0xff, 0xac,
+    0x6e, 0xff, 0x93, 0x6a, 0xff, 0xbc, 0x2d, 0xff, 0xe4, 0xcf, 0xff, 0xcc, 0x8e, 0xff, 0x93, 0x49,
+    0xff, 0x51, 0x82, 0xff, 0x49, 0x61, 0xff, 0xde, 0x14, 0x81, 0x0e, 0x82, 0x14, 0x05, 0x05, 0x14,
+    0x05, 0x14, 0xff, 0xff, 0x3a, 0x72, 0x82, 0x05, 0x01, 0xff, 0xcd, 0xd4, 0xff, 0x29, 0xa7, 0x82,
+    0x01, 0x01, 0x17, 0xff, 0x5a, 0xca, 0x8d, 0x04, 0x06, 0x00, 0x04, 0x3d, 0x8c, 0x16, 0x06, 0x2c,
+    0x81, 0x06, 0x00, 0x62, 0x83, 0x03, 0x02, 0x2b, 0x62, 0x3e, 0x83, 0x03, 0x81, 0x06, 0x01, 0x2f,
+    0xd1, 0x82, 0x03, 0x06, 0xff, 0x7b, 0x05, 0x8d, 0xff, 0x83, 0x26, 0x03, 0x23, 0xba, 0xc7, 0x8a,
+    0x00, 0xa2, 0x00, 0x0c, 0x9a, 0xff, 0xb4, 0x88, 0x03, 0x48, 0x0a, 0x98, 0xff, 0xbd, 0x94, 0xff,
+    0x8c, 0x2e, 0xff, 0xbd, 0x11, 0x14, 0x18, 0x9b, 0x53, 0x84, 0x14, 0x81, 0x05, 0x0e, 0xff, 0xf6,
+    0xb7, 0xff, 0x49, 0x20, 0xff, 0x51, 0x81, 0xff, 0x6a, 0x66, 0xff, 0xa4, 0x2d, 0xff, 0xbc, 0xd0,
+    0xff, 0xd5, 0xb3, 0xff, 0xde, 0x14, 0xff, 0xcd, 0x72, 0xff, 0xb4, 0xaf, 0xff, 0xac, 0x4d, 0xff,
+    0xa3, 0xab, 0xff, 0xc4, 0x4d, 0xff, 0xe5, 0x30, 0xff, 0xf5, 0x51, 0x82, 0x35, 0x82, 0x3c, 0x03,
+    0xff, 0xe5, 0x10, 0xff, 0x62, 0x04, 0xff, 0x8b, 0x6a, 0x0e, 0x82, 0x14, 0x81, 0x05, 0x04, 0x14,
+    0x05, 0xff, 0xf6, 0x76, 0x72, 0x9b, 0x81, 0x05, 0x01, 0xff, 0xac, 0xf1, 0xff, 0x21, 0x66, 0x82,
+    0x01, 0x01, 0x2a, 0xc5, 0x8e, 0x04, 0x09, 0x00, 0x04, 0x3d, 0xff, 0x6b, 0x09, 0x0a, 0x40, 0x31,
+    0x06, 0x0a, 0x4c, 0x82, 0x03, 0x03, 0x29, 0x0f, 0x0a, 0x3e, 0x82, 0x03, 0x01, 0xa6, 0x16, 0x81,
+    0x06, 0x01, 0x31, 0x0b, 0x81, 0x03, 0x07, 0xff, 0x93, 0xa6, 0x79, 0xb1, 0x0b, 0x03, 0xff, 0xd5,
+    0x6a, 0x8c, 0x04, 0x89, 0x00, 0xa2, 0x00, 0x0e, 0xe6, 0xff, 0xbc, 0x89, 0x03, 0x23, 0x0a, 0xf7,
+    0xe8, 0xff, 0xde, 0x77, 0xbb, 0x14, 0x18, 0x9b, 0xff, 0xff, 0x7a, 0x14, 0x05, 0x81, 0x14, 0x83,
+    0x05, 0x08, 0xff, 0x51, 0x82, 0xff, 0x7a, 0x25, 0xff, 0xd4, 0x2d, 0xff, 0xdc, 0x2d, 0xff, 0xdc,
+    0x4d, 0xff, 0xdc, 0x6d, 0xff, 0xcc, 0x4d, 0xff, 0xdc, 0xcf, 0xff, 0xf5, 0x51, 0x89, 0x35, 0x03,
+    0x3c, 0xdb, 0xff, 0xd4, 0xaf, 0xff, 0x62, 0x45, 0x81, 0x05, 0x00, 0x14, 0x82, 0x05, 0x08, 0x14,
+    0x05, 0xff, 0xe5, 0xf2, 0x04, 0xff, 0xf6, 0x96, 0x05, 0xff, 0x83, 0xad, 0x09, 0x02, 0x81, 0x01,
+    0x01, 0x2a, 0xff, 0x7b, 0xad, 0x8c, 0x04, 0x00, 0x00, 0x81, 0x04, 0x81, 0x00, 0x07, 0x04, 0xff,
+    0x62, 0xc8, 0x0a, 0x06, 0x3a, 0x06, 0x0a, 0x37, 0x82, 0x03, 0x03, 0x54, 0x0f, 0x0a, 0x3e, 0x82,
+    0x03, 0x00, 0x85, 0x81, 0x06, 0x02, 0x2f, 0x31, 0x29, 0x81, 0x03, 0x07, 0xff, 0xac, 0x27, 0x9a,
+    0x7f, 0xd5, 0x03, 0x23, 0xff, 0x72, 0xe6, 0x04, 0x89, 0x00, 0xa2, 0x00, 0x10, 0xff, 0x9c, 0x4e,
+    0xff, 0xbc, 0x89, 0x29, 0x0b, 0x76, 0x69, 0x5a, 0x04, 0x8c, 0xff, 0xd5, 0xd4, 0x14, 0xff, 0xff,
+    0x19, 0xd4, 0x10, 0x14, 0x05, 0x14, 0x83, 0x05, 0x03, 0xff, 0x72, 0xc7, 0xff, 0xbb, 0xcb, 0xff,
+    0xdc, 0x2d, 0xff, 0xec, 0xaf, 0x85, 0x3c, 0x85, 0x35, 0x01, 0x3c, 0x35, 0x81, 0x3c, 0x02, 0x35,
+    0xff, 0xf5, 0x31, 0xff, 0x6a, 0x87, 0x87, 0x05, 0x04, 0x14, 0xff, 0xee, 0x13, 0xff, 0xde, 0x35,
+    0xff, 0x4a, 0x48, 0x5b, 0x81, 0x01, 0x02, 0x60, 0xc8, 0xff, 0x73, 0x2b, 0x8a, 0x04, 0x00, 0x00,
+    0x82, 0x04, 0x00, 0x00, 0x83, 0x04, 0x06, 0xff, 0x52, 0x46, 0xff, 0xb3, 0xe6, 0x30, 0x21, 0x0a,
+    0x1e, 0x27, 0x82, 0x03, 0x03, 0x3e, 0x0f, 0x0a, 0x3e, 0x82, 0x03, 0x00, 0x48, 0x82, 0x06, 0x01,
+    0x30, 0x95, 0x81, 0x03, 0x07, 0x90, 0x6e, 0x5a, 0xff, 0x62, 0x85, 0x0b, 0x03, 0xd5, 0xc7, 0x89,
+    0x00, 0xa2, 0x00, 0x0d, 0x9a, 0xff, 0xb4, 0x89, 0x46, 0x0b, 0x46, 0xff, 0x62, 0x44, 0x00, 0x04,
+    0xff, 0xd6, 0x36, 0x9c, 0x05, 0xff, 0xee, 0x75, 0xff, 0xe6, 0x35, 0x10, 0x81, 0x14, 0x84, 0x05,
+    0x03, 0xff, 0x83, 0x6a, 0xff, 0xd4, 0x8e, 0x3c, 0xdb, 0x85, 0x3c, 0x81, 0x35, 0x00, 0x3c, 0x81,
+    0x35, 0x00, 0x3c, 0x82, 0x35, 0x03, 0x3c, 0x35, 0xff, 0xed, 0x51, 0xff, 0x73, 0x09, 0x87, 0x05,
+    0x02, 0x14, 0xff, 0x8b, 0xee, 0x1a, 0x82, 0x01, 0x03, 0xc1, 0xff, 0x28, 0xe2, 0x70, 0x66, 0x8b,
+    0x04, 0x83, 0x00, 0x06, 0x04, 0x00, 0x04, 0x00, 0xff, 0x52, 0x05, 0x0a, 0x31, 0x81, 0x0a, 0x00,
+    0x16, 0x83, 0x03, 0x03, 0x0a, 0x21, 0x0a, 0x3e, 0x82, 0x03, 0x00, 0x68, 0x83, 0x06, 0x00, 0xd1,
+    0x81, 0x03, 0x07, 0x23, 0xff, 0x62, 0x88, 0x04, 0xa8, 0xff, 0xcd, 0x0a, 0x0b, 0xea, 0xe4, 0x89,
+    0x00, 0xa2, 0x00, 0x02, 0x7f, 0xff, 0xac, 0x68, 0xff, 0xcd, 0x08, 0x81, 0x0b, 0x01, 0xff, 0x62,
+    0x45, 0x99, 0x81, 0x04, 0x06, 0x6e, 0xff, 0xb4, 0xf0, 0x05, 0x0e, 0x14, 0x05, 0x14, 0x84, 0x05,
+    0x01, 0xff, 0xbd, 0x10, 0xff, 0xb3, 0xec, 0x81, 0xdb, 0x86, 0x3c, 0x83, 0x35, 0x00, 0x3c, 0x83,
+    0x35, 0x05, 0x3c, 0xff, 0xab, 0xcc, 0xff, 0xb4, 0xf0, 0x05, 0xff, 0xff, 0x17, 0x53, 0x83, 0x05,
+    0x02, 0xff, 0xb5, 0x11, 0xff, 0x39, 0xc7, 0x5b, 0x81, 0x01, 0x06, 0x02, 0xff, 0x21, 0x66, 0xff,
+    0x39, 0x42, 0xfb, 0x16, 0x64, 0xff, 0xd6, 0x36, 0x84, 0x04, 0x00, 0x00, 0x81, 0x04, 0x01, 0x00,
+    0x04, 0x84, 0x00, 0x06, 0x04, 0x00, 0x04, 0x00, 0xad, 0x0a, 0x31, 0x81, 0x0a, 0x00, 0x4c, 0x82,
+    0x03, 0x04, 0x39, 0x62, 0x1e, 0x0a, 0x68, 0x82, 0x03, 0x00, 0x61, 0x81, 0x06, 0x02, 0x34, 0x0a,
+    0x50, 0x81, 0x03, 0x07, 0x0b, 0xff, 0x52, 0x25, 0x04, 0xda, 0x91, 0x23, 0x7a, 0xd6, 0x89, 0x00,
+    0xa2, 0x00, 0x02, 0xff, 0xad, 0x11, 0xff, 0xa4, 0x28, 0x6f, 0x81, 0x0b, 0x01, 0xff, 0x6a, 0xa6,
+    0x99, 0x81, 0x04, 0x02, 0x5f, 0xff, 0x52, 0x05, 0xd2, 0x89, 0x05, 0x01, 0xff, 0x7b, 0x29, 0xff,
+    0xe5, 0x10, 0x81, 0xdb, 0x0b, 0xff, 0xe5, 0x10, 0xdb, 0xff, 0xf5, 0x71, 0xff, 0xf5, 0x72, 0xff,
+    0xf5, 0x71, 0xff, 0xf5, 0x51, 0xff, 0xed, 0x30, 0xff, 0xdc, 0xce, 0xff, 0xd4, 0x8e, 0xff, 0xdc,
+    0xef, 0xff, 0xf5, 0x51, 0xff, 0xf5, 0x71, 0x81, 0xff, 0xed, 0x30, 0x02, 0xff, 0xed, 0x31, 0xff,
+    0xab, 0xcc, 0xff, 0x72, 0xe8, 0x81, 0x05, 0x01, 0x53, 0xd3, 0x81, 0x05, 0x02, 0xd2, 0xff, 0x52,
+    0x69, 0x09, 0x82, 0x01, 0x08, 0x11, 0xff, 0x18, 0xe3, 0xff, 0x41, 0x42, 0xff, 0x59, 0xc2, 0x16,
+    0x06, 0x2b, 0xff, 0x62, 0x67, 0x5a, 0x84, 0x04, 0x81, 0x00, 0x00, 0x04, 0x84, 0x00, 0x00, 0x04,
+    0x81, 0x00, 0x81, 0x04, 0x05, 0xff, 0x51, 0xa2, 0x06, 0x31, 0x0a, 0x0f, 0x39, 0x82, 0x03, 0x04,
+    0x3e, 0x0a, 0x21, 0x0a, 0x37, 0x82, 0x03, 0x00, 0x06, 0x81, 0x16, 0x09, 0x34, 0x0a, 0x59, 0x27,
+    0x03, 0x23, 0x82, 0x00, 0x04, 0xff, 0x62, 0x86, 0x81, 0x0b, 0x00, 0xff, 0x6a, 0xc5, 0x89, 0x00,
+    0xa2, 0x00, 0x07, 0xbf, 0xba, 0x39, 0x0b, 0x23, 0xff, 0x6a, 0xa6, 0x99, 0x00, 0x81, 0x04, 0x02,
+    0xff, 0xce, 0x15, 0xff, 0x5a, 0x26, 0xff, 0xf6, 0xd7, 0x82, 0x05, 0x00, 0x14, 0x84, 0x05, 0x05,
+    0xff, 0xee, 0x96, 0xff, 0x8b, 0x6b, 0xff, 0x93, 0xab, 0xff, 0xac, 0x4e, 0xff, 0xcd, 0x92, 0x05,
+    0x81, 0x14, 0x82, 0x05, 0x08, 0x53, 0xff, 0xf6, 0x96, 0xff, 0xbd, 0x31, 0xff, 0x93, 0xcc, 0xff,
+    0x72, 0xe9, 0xff, 0x72, 0xa7, 0xff, 0x6a, 0x66, 0xff, 0x6a, 0x87, 0xff, 0xa4, 0x6e, 0x82, 0x05,
+    0x04, 0x53, 0xff, 0xff, 0x3a, 0xff, 0xff, 0x17, 0xff, 0xe6, 0x76, 0xde, 0x82, 0x01, 0x0c, 0x02,
+    0x36, 0xff, 0x31, 0x02, 0xff, 0xac, 0x0b, 0xff, 0x6a, 0x46, 0xff, 0xbd, 0x73, 0xab, 0x50, 0x0a,
+    0x2c, 0x9c, 0x7c, 0x00, 0x82, 0x04, 0x88, 0x00, 0x08, 0x04, 0x00, 0x04, 0xd9, 0x77, 0x0a, 0x31,
+    0x0a, 0x16, 0x82, 0x03, 0x05, 0x29, 0x0a, 0x1e, 0x0a, 0x06, 0x48, 0x81, 0x03, 0x00, 0x39, 0x82,
+    0x06, 0x02, 0x34, 0x0a, 0xcf, 0x82, 0x03, 0x00, 0xff, 0x51, 0xe2, 0x81, 0x04, 0x04, 0xd8, 0x9f,
+    0x0b, 0x91, 0xc4, 0x88, 0x00, 0xa2, 0x00, 0x02, 0xe8, 0xff, 0x83, 0x25, 0x6f, 0x81, 0x0b, 0x02,
+    0xff, 0x6a, 0xa6, 0x99, 0x00, 0x81, 0x04, 0x03, 0x3d, 0x79, 0x9c, 0xff, 0xf6, 0xd7, 0x8a, 0x05,
+    0x00, 0x14, 0x8a, 0x05, 0x02, 0x14, 0x05, 0xfe, 0x84, 0x05, 0x04, 0xd3, 0xff, 0xf7, 0x19, 0x53,
+    0xff, 0x83, 0xad, 0x12, 0x82, 0x01, 0x10, 0xff, 0x19, 0x04, 0xff, 0x52, 0x05, 0xff, 0xd4, 0xee,
+    0x52, 0xff, 0x5a, 0x05, 0x04, 0x5f, 0xbd, 0xab, 0x58, 0xa9, 0xff, 0x49, 0xa2, 0x9c, 0xa8, 0x79,
+    0x3d, 0x04, 0x87, 0x00, 0x82, 0x04, 0x05, 0xbf, 0xff, 0x72, 0x83, 0x16, 0x3a, 0x0a, 0x4c, 0x82,
+    0x03, 0x02, 0x68, 0x0a, 0x1e, 0x81, 0x0a, 0x00, 0x39, 0x81, 0x03, 0x07, 0x68, 0x06, 0x0f, 0x16,
+    0x06, 0x0a, 0x64, 0x85, 0x81, 0x03, 0x07, 0xff, 0x51, 0xe2, 0xff, 0xef, 0x5a, 0x04, 0xff, 0xce,
+    0x15, 0x91, 0x23, 0xff, 0xa4, 0x27, 0xff, 0xb5, 0x33, 0x88, 0x00, 0xa2, 0x00, 0x06, 0x44, 0xff,
+    0x62, 0x85, 0x90, 0xff, 0xdd, 0x8c, 0xff, 0xe5, 0xce, 0xff, 0x72, 0xc6, 0xff, 0xf7, 0x7b, 0x83,
+    0x04, 0x03, 0x3d, 0x79, 0xff, 0x5a, 0x66, 0xd2, 0x8d, 0x05, 0x03, 0x0e, 0x10, 0x05, 0x10, 0x8a,
+    0x05, 0x04, 0x53, 0xff, 0xff, 0x59, 0xff, 0xf6, 0xd8, 0xff, 0xff, 0x38, 0xff, 0x5a, 0xa9, 0x81,
+    0x01, 0x07, 0x1a, 0xff, 0x20, 0xc2, 0xff, 0x93, 0x69, 0x28, 0x0c, 0x3f, 0x66, 0x3d, 0x82, 0x04,
+    0x04, 0xe0, 0xff, 0xa4, 0xd0, 0xff, 0xa4, 0x8f, 0x7b, 0xd9, 0x81, 0x00, 0x00, 0x04, 0x82, 0x00,
+    0x00, 0x04, 0x84, 0x00, 0x81, 0x04, 0x05, 0xff, 0xa4, 0xd0, 0x5e, 0x3a, 0x06, 0x21, 0x29, 0x81,
+    0x03, 0x00, 0x29, 0x81, 0x0a, 0x03, 0x1e, 0x0a, 0x06, 0x29, 0x81, 0x03, 0x07, 0x40, 0x06, 0x0f,
+    0x06, 0x2f, 0x0a, 0xff, 0x62, 0x02, 0x48, 0x81, 0x03, 0x00, 0xaa, 0x82, 0x04, 0x03, 0xff, 0x62,
+    0x65, 0x0b, 0xff, 0xb4, 0x88, 0xff, 0x9c, 0x8f, 0x88, 0x00, 0xa3, 0x00, 0x04, 0xff, 0x62, 0xa7,
+    0x6d, 0xff, 0xcd, 0x4e, 0xff, 0xe6, 0x33, 0xff, 0x72, 0xc5, 0x86, 0x04, 0x02, 0xff, 0xd6, 0x36,
+    0xb1, 0xff, 0xbd, 0x51, 0x8c, 0x05, 0x03, 0xff, 0xf6, 0x54, 0xff, 0xee, 0x13, 0x05, 0xff, 0xe5,
+    0x91, 0x8a, 0x05, 0x08, 0xff, 0xfe, 0xd8, 0xff, 0xff, 0x7a, 0xff, 0xee, 0x97, 0x05, 0xe6, 0xff,
+    0x21, 0x45, 0xff, 0x18, 0xa2, 0xa4, 0xff, 0xc4, 0x8d, 0x82, 0x0c, 0x01, 0xff, 0xc4, 0x8d, 0xff,
+    0x8b, 0xcc, 0x87, 0x04, 0x8c, 0x00, 0x81, 0x04, 0x04, 0xa8, 0x87, 0x31, 0x06, 0x62, 0x82, 0x03,
+    0x03, 0x76, 0x0a, 0x62, 0x2c, 0x81, 0x06, 0x0d, 0x27, 0x03, 0x46, 0x06, 0x0a, 0x0f, 0x2f, 0x34,
+    0x21, 0xaa, 0x37, 0x03, 0x23, 0xff, 0x51, 0xc2, 0x81, 0x00, 0x04, 0x04, 0xff, 0x73, 0x4b, 0xff,
+    0xd5, 0x6a, 0x9f, 0xbd, 0x88, 0x00, 0xa2, 0x00, 0x06, 0x04, 0xff, 0x73, 0x4a, 0x0b, 0x29, 0x46,
+    0xff, 0x72, 0xe5, 0x9d, 0x86, 0x04, 0x03, 0x5a, 0x6e, 0xff, 0x8b, 0xcb, 0x14, 0x8a, 0x05, 0x04,
+    0x88, 0xff, 0xee, 0x34, 0x05, 0x88, 0xff, 0xe5, 0xd2, 0x89, 0x05, 0x07, 0xff, 0xe5, 0xf3, 0xff,
+    0xee, 0xd8, 0xff, 0xee, 0x34, 0x05, 0xff, 0xe6, 0x35, 0xff, 0x6a, 0x66, 0xff, 0x8b, 0x08, 0x3f,
+    0x82, 0x0c, 0x04, 0x28, 0xff, 0xb4, 0x0c, 0xff, 0x9c, 0x4f, 0x04, 0x3d, 0x81, 0x04, 0x00, 0x00,
+    0x82, 0x04, 0x8c, 0x00, 0x81, 0x04, 0x04, 0xff, 0x5a, 0x87, 0x4c, 0x41, 0x0f, 0x39, 0x81, 0x03,
+    0x00, 0x29, 0x81, 0x0a, 0x03, 0x87, 0x0a, 0x06, 0x4c, 0x81, 0x03, 0x00, 0x3e, 0x81, 0x06, 0x08,
+    0x1e, 0x16, 0x06, 0x2c, 0xaa, 0x68, 0x03, 0x29, 0xff, 0x51, 0xc2, 0x82, 0x04, 0x03, 0x7f, 0xff,
+    0xac, 0x28, 0x6d, 0x6e, 0x88, 0x00, 0xa3, 0x00, 0x01, 0x7f, 0xff, 0xac, 0x48, 0x81, 0x0b, 0x01,
+    0x91, 0xff, 0xd6, 0x56, 0x88, 0x04, 0x02, 0xff, 0xac, 0xd0, 0xbe, 0xff, 0xd5, 0xd3, 0x89, 0x05,
+    0x01, 0x10, 0x0e, 0x81, 0x05, 0x00, 0x14, 0x89, 0x05, 0x05, 0x0e, 0xff, 0xee, 0x13, 0x05, 0xff,
+    0xac, 0xaf, 0xff, 0x59, 0xe4, 0xff, 0xbc, 0x6d, 0x85, 0x0c, 0x04, 0xff, 0xa3, 0xcb, 0xff, 0x21,
+    0x23, 0xff, 0x31, 0xa6, 0xdd, 0xda, 0x81, 0x00, 0x81, 0x04, 0x01, 0x00, 0x04, 0x81, 0x00, 0x02,
+    0x04, 0x00, 0x04, 0x85, 0x00, 0x81, 0x04, 0x04, 0x44, 0xff, 0x49, 0xa2, 0x30, 0x0f, 0x16, 0x82,
+    0x03, 0x00, 0x3e, 0x81, 0x0a, 0x00, 0x2c, 0x81, 0x0a, 0x0e, 0x3e, 0x03, 0xa6, 0x0a, 0x06, 0x0a,
+    0x1e, 0x16, 0x34, 0x59, 0xff, 0x51, 0xc2, 0x3e, 0x03, 0x39, 0x82, 0x81, 0x00, 0x04, 0x04, 0xa2,
+    0xff, 0x83, 0x25, 0x7a, 0xff, 0x73, 0x2b, 0x88, 0x00, 0xa3, 0x00, 0x01, 0xa2, 0xff, 0x7b, 0x26,
+    0x81, 0x0b, 0x01, 0xff, 0x9b, 0xe7, 0x79, 0x87, 0x04, 0x81, 0x3d, 0x02, 0xff, 0xd6, 0x56, 0xff,
+    0x59, 0xc3, 0xd7, 0x98, 0x05, 0x03, 0xff, 0xf6, 0xb6, 0xff, 0xa4, 0x2c, 0xff, 0x7a, 0xc6, 0x3f,
+    0x86, 0x0c, 0x05, 0xf8, 0x6a, 0x09, 0x0d, 0x67, 0xc5, 0x81, 0x04, 0x00, 0x00, 0x82, 0x04, 0x01,
+    0x00, 0x04, 0x88, 0x00, 0x05, 0x04, 0xff, 0xce, 0x15, 0x64, 0x97, 0x30, 0x39, 0x81, 0x03, 0x00,
+    0x46, 0x81, 0x0a, 0x06, 0x40, 0x41, 0x0a, 0x06, 0x37, 0x03, 0x37, 0x81, 0x06, 0x09, 0x0f, 0x21,
+    0x16, 0x06, 0x69, 0xbb, 0x3e, 0x03, 0x54, 0x9e, 0x81, 0x00, 0x05, 0x04, 0x44, 0xaa, 0x0b, 0xff,
+    0x73, 0x4b, 0x04, 0x87, 0x00, 0xa4, 0x00, 0x04, 0x9c, 0x7a, 0x0b, 0xff, 0xb4, 0x88, 0x9a, 0x87,
+    0x04, 0x82, 0x3d, 0x03, 0xff, 0x9c, 0x6e, 0xff, 0xdd, 0xf4, 0xff, 0xc4, 0xef, 0xff, 0xf6, 0xb6,
+    0x94, 0x05, 0x04, 0x14, 0xff, 0xe5, 0xf3, 0xd7, 0xff, 0xc5, 0x11, 0x28, 0x87, 0x0c, 0x03, 0xff,
+    0x9b, 0xaa, 0x6a, 0x1a, 0x2a, 0x81, 0x20, 0x06, 0xe5, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x81,
+    0x04, 0x81, 0x00, 0x00, 0x04, 0x83, 0x00, 0x05, 0x04, 0x00, 0x9a, 0x70, 0x97, 0x2b, 0x82, 0x03,
+    0x00, 0x93, 0x81, 0x0a, 0x00, 0x97, 0x81, 0x0a, 0x03, 0x06, 0x46, 0x03, 0x62, 0x81, 0x06, 0x09,
+    0x3a, 0x06, 0x34, 0x06, 0xff, 0x5a, 0x25, 0xbb, 0x3e, 0x03, 0x76, 0xff, 0x5a, 0x47, 0x81, 0x04,
+    0x05, 0x00, 0xff, 0xe6, 0xb8, 0xff, 0x41, 0x61, 0x76, 0xff, 0x73, 0x2b, 0x04, 0x87, 0x00, 0xa4,
+    0x00, 0x04, 0x9a, 0xff, 0xac, 0x68, 0x0b, 0x6d, 0x6e, 0x87, 0x04, 0x82, 0x3d, 0x04, 0xff, 0xac,
+    0xd1, 0xff, 0xe6, 0x77, 0xff, 0xdd, 0xb3, 0xff, 0x7a, 0xe7, 0xff, 0xde, 0x14, 0x92, 0x05, 0x04,
+    0xff, 0xb4, 0xcf, 0xff, 0x6a, 0x45, 0xff, 0xe5, 0xf3, 0xff, 0xf6, 0xb7, 0xff, 0xb4, 0xd0, 0x88,
+    0x0c, 0x01, 0xff, 0xab, 0xca, 0xff, 0x21, 0x45, 0x81, 0x2a, 0x81, 0x1a, 0x00, 0xc5, 0x81, 0x04,
+    0x83, 0x00, 0x00, 0x04, 0x82, 0x00, 0x00, 0x04, 0x81, 0x00, 0x01, 0x04, 0x00, 0x81, 0x04, 0x00,
+    0x9c, 0x81, 0x1e, 0x00, 0x46, 0x81, 0x03, 0x00, 0xff, 0xbc, 0x87, 0x82, 0x0a, 0x00, 0x41, 0x82,
+    0x0a, 0x02, 0x03, 0x37, 0x06, 0x81, 0x16, 0x0a, 0xff, 0x9b, 0x45, 0x06, 0x34, 0x16, 0xff, 0x73,
+    0x4b, 0xff, 0x62, 0x45, 0x95, 0x03, 0x0a, 0x8c, 0x04, 0x81, 0x00, 0x03, 0xda, 0xff, 0x39, 0x00,
+    0xff, 0xac, 0x07, 0xa8, 0x88, 0x00, 0xa4, 0x00, 0x04, 0x8a, 0xff, 0x62, 0x85, 0x0b, 0x7a, 0x9c,
+    0x89, 0x04, 0x06, 0x3d, 0xff, 0xd6, 0x36, 0xff, 0xb4, 0xf2, 0xff, 0xde, 0x35, 0xff, 0x93, 0xab,
+    0xff, 0x5a, 0x25, 0xff, 0xc5, 0x51, 0x8f, 0x05, 0x06, 0xff, 0xbd, 0x31, 0xff, 0x62, 0x24, 0xff,
+    0x61, 0xa2, 0xff, 0x9b, 0x8a, 0xff, 0xee, 0x56, 0xff, 0xf6, 0xd9, 0xff, 0xa3, 0xab, 0x83, 0x0c,
+    0x08, 0xff, 0xe5, 0x0e, 0x0c, 0xff, 0xe5, 0x0e, 0x0c, 0xff, 0xdd, 0x0e, 0xd0, 0xff, 0x18, 0xc2,
+    0x20, 0x0d, 0x81, 0x1a, 0x00, 0x80, 0x82, 0x04, 0x00, 0x00, 0x82, 0x04, 0x01, 0x00, 0x04, 0x81,
+    0x00, 0x02, 0x04, 0x00, 0x04, 0x81, 0x00, 0x03, 0x81, 0xff, 0x51, 0xc2, 0x97, 0xff, 0xac, 0x07,
+    0x81, 0x03, 0x00, 0x48, 0x82, 0x0a, 0x01, 0x2c, 0x30, 0x81, 0x0a, 0x02, 0x61, 0x29, 0x62, 0x81,
+    0x06, 0x0a, 0x34, 0x2c, 0x0f, 0x16, 0x7e, 0xc2, 0x82, 0x61, 0x29, 0x50, 0xff, 0x94, 0x0e, 0x82,
+    0x00, 0x03, 0x7b, 0xff, 0x49, 0x81, 0xfb, 0xe6, 0x88, 0x00, 0xa4, 0x00, 0x05, 0x04, 0xee, 0xff,
+    0xb4, 0x69, 0x0b, 0xff, 0x6a, 0xc5, 0x9d, 0x8a, 0x04, 0x05, 0xbd, 0xff, 0x83, 0xad, 0xee, 0xa0,
+    0x8c, 0xff, 0x9c, 0x0d, 0x8c, 0x05, 0x03, 0xff, 0xbd, 0x11, 0xff, 0x6a, 0x45, 0xff, 0x61, 0xe2,
+    0xff, 0x82, 0xe6, 0x81, 0xb9, 0x02, 0xff, 0xac, 0x2d, 0xff, 0x9b, 0xcb, 0xff, 0xd4, 0xae, 0x85,
+    0x0c, 0x05, 0xff, 0xe5, 0x0e, 0xff, 0xd4, 0xee, 0xff, 0x7a, 0xc8, 0xff, 0x21, 0x04, 0x12, 0x1f,
+    0x82, 0x1a, 0x00, 0x80, 0x82, 0x04, 0x84, 0x00, 0x00, 0x04, 0x81, 0x00, 0x00, 0x04, 0x81, 0x00,
+    0x81, 0x04, 0x05, 0xe6, 0x59, 0x2c, 0x29, 0x03, 0x39, 0x83, 0x0a, 0x00, 0xff, 0x72, 0x83, 0x82,
+    0x0a, 0x02, 0x37, 0x3e, 0x0a, 0x81, 0x06, 0x0a, 0x16, 0x31, 0x34, 0x16, 0x69, 0x7c, 0x77, 0x95,
+    0x37, 0x51, 0xff, 0xad, 0x32, 0x82, 0x00, 0x03, 0xd8, 0x78, 0x51, 0x7b, 0x88, 0x00, 0xa4, 0x00,
+    0x05, 0x04, 0x5a, 0xbe, 0x0b, 0xff, 0x9b, 0xe7, 0xff, 0xad, 0x32, 0x8a, 0x04, 0x01, 0x3d, 0x00,
+    0x81, 0x3d, 0x03, 0x04, 0xb0, 0xff, 0x72, 0xc8, 0xff, 0xf6, 0xb6, 0x87, 0x05, 0x06, 0xff, 0xf6,
+    0xb6, 0xff, 0xac, 0x8f, 0xff, 0x62, 0x04, 0xff, 0x59, 0xa2, 0xff, 0x82, 0xa5, 0xff, 0xa3, 0xca,
+    0x28, 0x81, 0x0c, 0x81, 0x28, 0x82, 0x0c, 0x06, 0xff, 0xe5, 0x0e, 0x0c, 0xff, 0xdd, 0x0e, 0xb9,
+    0xff, 0x7a, 0xe8, 0x83, 0x12, 0x81, 0x01, 0x81, 0x1f, 0x81, 0x1a, 0x00, 0xff, 0x5b, 0x0b, 0x84,
+    0x04, 0x87, 0x00, 0x81, 0x04, 0x05, 0x5a, 0xe1, 0x50, 0x6f, 0x03, 0x39, 0x83, 0x0a, 0x02, 0xcf,
+    0x21, 0x06, 0x81, 0x0a, 0x01, 0x39, 0x0a, 0x81, 0x06, 0x0b, 0x16, 0x1e, 0x0f, 0x06, 0x0a, 0xb1,
+    0x8b, 0x58, 0x3e, 0x40, 0x77, 0x74, 0x81, 0x00, 0x04, 0x04, 0xd6, 0x98, 0xca, 0x8b, 0x88, 0x00,
+    0xa4, 0x00, 0x81, 0x04, 0x03, 0xff, 0xce, 0x15, 0xff, 0x72, 0xe5, 0xff, 0xd5, 0x6b, 0x8c, 0x81,
+    0x04, 0x00, 0x00, 0x8d, 0x04, 0x02, 0xff, 0xc5, 0xd4, 0xff, 0x5a, 0x26, 0xff, 0xd5, 0xb3, 0x82,
+    0x05, 0x08, 0x14, 0x05, 0xff, 0xcd, 0x72, 0xff, 0x83, 0x6a, 0xff, 0x51, 0x82, 0xff, 0x69, 0xe3,
+    0xff, 0x7a, 0x85, 0xff, 0x8b, 0x06, 0xff, 0xc4, 0x8d, 0x87, 0x0c, 0x06, 0xff, 0xe5, 0x0e, 0xff,
+    0xdd, 0x0e, 0xff, 0xcc, 0xad, 0xff, 0x72, 0xc8, 0xff, 0x21, 0x04, 0xc1, 0x02, 0x82, 0x01, 0x01,
+    0x09, 0x1f, 0x81, 0x1a, 0x01, 0x80, 0x04, 0x8a, 0x00, 0x82, 0x04, 0x04, 0x9a, 0xf7, 0x3e, 0x03,
+    0x54, 0x82, 0x0a, 0x06, 0x06, 0xff, 0x83, 0x04, 0xcf, 0x06, 0x0a, 0x06, 0x4c, 0x81, 0x0a, 0x82,
+    0x06, 0x00, 0x31, 0x81, 0x06, 0x03, 0x50, 0xff, 0x94, 0x6f, 0x7f, 0x5e, 0x81, 0x40, 0x00, 0x9e,
+    0x81, 0x00, 0x04, 0x04, 0xa0, 0xca, 0x51, 0xad, 0x89, 0x00, 0xa6, 0x00, 0x04, 0x04, 0xff, 0xac,
+    0xf1, 0xff, 0x8b, 0xa7, 0xff, 0x7b, 0x06, 0xd9, 0x8f, 0x04, 0x0d, 0xff, 0x8c, 0x2f, 0x45, 0xff,
+    0x29, 0x03, 0xff, 0x62, 0x67, 0xff, 0x93, 0xcc, 0xff, 0x9c, 0x0d, 0xff, 0x7b, 0x29, 0xad, 0xff,
+    0x51, 0x61, 0xff, 0x6a, 0x03, 0xff, 0x7a, 0x64, 0xff, 0x82, 0xc5, 0xff, 0x93, 0x68, 0xb9, 0x86,
+    0x0c, 0x05, 0xff, 0xe5, 0x0e, 0x0c, 0xff, 0xac, 0x0b, 0xff, 0x5a, 0x26, 0xff, 0x18, 0xe4, 0x36,
+    0x85, 0x01, 0x07, 0x1c, 0x1f, 0x0d, 0x1f, 0xff, 0x5a, 0xcb, 0x04, 0x00, 0x04, 0x88, 0x00, 0x81,
+    0x04, 0x04, 0xa2, 0xad, 0xff, 0xbc, 0x68, 0x29, 0x3e, 0x82, 0x0a, 0x02, 0x06, 0x97, 0xff, 0x49,
+    0x61, 0x83, 0x06, 0x81, 0x0a, 0x83, 0x06, 0x00, 0xfa, 0x81, 0x06, 0x0e, 0x64, 0xe8, 0xff, 0x73,
+    0x6b, 0x16, 0x0a, 0x71, 0x6e, 0x04, 0x00, 0x04, 0xff, 0xad, 0x32, 0x7e, 0x51, 0xd6, 0x04, 0x88,
+    0x00, 0xa8, 0x00, 0x02, 0xff, 0x9c, 0x90, 0xff, 0x7b, 0x06, 0xa8, 0x8e, 0x04, 0x04, 0xe7, 0x2a,
+    0x09, 0x0d, 0x1a, 0x81, 0x6a, 0x06, 0xde, 0xff, 0x51, 0x61, 0xff, 0x72, 0x23, 0xff, 0x82, 0x84,
+    0xff, 0x82, 0xc6, 0xff, 0xb4, 0x0b, 0x28, 0x85, 0x0c, 0x05, 0xff, 0xdd, 0x0e, 0xff, 0xcc, 0xad,
+    0xff, 0x83, 0x08, 0xff, 0x31, 0x43, 0xff, 0x19, 0x04, 0x12, 0x82, 0x01, 0x00, 0x02, 0x83, 0x01,
+    0x05, 0x11, 0x09, 0x0d, 0x09, 0xc3, 0x04, 0x89, 0x00, 0x81, 0x04, 0x04, 0xa0, 0xb5, 0xff, 0xb4,
+    0x68, 0x6f, 0x40, 0x83, 0x0a, 0x02, 0x50, 0xff, 0x39, 0x20, 0x5e, 0x88, 0x06, 0x0a, 0x1e, 0x21,
+    0x16, 0x0a, 0xb5, 0x00, 0xff, 0x5a, 0x45, 0x06, 0x0a, 0xe2, 0x79, 0x82, 0x04, 0x03, 0xac, 0xec,
+    0xcf, 0x9a, 0x89, 0x00, 0xa8, 0x00, 0x03, 0x04, 0x7b, 0xff, 0x41, 0x62, 0x8b, 0x81, 0x04, 0x00,
+    0x00, 0x89, 0x04, 0x02, 0x00, 0xff, 0x39, 0xe7, 0x09, 0x81, 0x0d, 0x00, 0x1a, 0x82, 0x09, 0x03,
+    0xff, 0x41, 0x21, 0xff, 0x72, 0x24, 0xff, 0xa3, 0xa9, 0xff, 0xd4, 0xee, 0x85, 0x0c, 0x05, 0xb9,
+    0xff, 0x93, 0x49, 0xff, 0x49, 0xc5, 0xff, 0x18, 0xe4, 0x17, 0x36, 0x89, 0x01, 0x01, 0x60, 0x1f,
+    0x81, 0x09, 0x01, 0xff, 0x39, 0xc7, 0x04, 0x88, 0x00, 0x05, 0x04, 0x00, 0xa0, 0x9c, 0xba, 0x95,
+    0x82, 0x0a, 0x04, 0x06, 0x0a, 0x59, 0x66, 0xf2, 0x89, 0x06, 0x0a, 0x31, 0x16, 0x34, 0x1e, 0xbd,
+    0x7c, 0x78, 0x16, 0x0a, 0xe1, 0x44, 0x81, 0x04, 0x04, 0xa2, 0xff, 0x6a, 0x44, 0x06, 0x77, 0x81,
+    0x89, 0x00, 0xa7, 0x00, 0x05, 0x04, 0x00, 0x04, 0xff, 0xde, 0x77, 0xff, 0x9c, 0x70, 0xe8, 0x8c,
+    0x04, 0x02, 0x73, 0x1a, 0x09, 0x81, 0x2a, 0x00, 0x1a, 0x81, 0x09, 0x01, 0xff, 0x31, 0x23, 0xff,
+    0xdd, 0x30, 0x83, 0x0c, 0x08, 0x3f, 0xff, 0xb4, 0x2c, 0xff, 0x7a, 0xe8, 0xff, 0x41, 0xa4, 0xff,
+    0x18, 0xe3, 0x17, 0x09, 0x36, 0x11, 0x8b, 0x01, 0x82, 0x09, 0x02, 0x67, 0x44, 0x04, 0x86, 0x00,
+    0x81, 0x04, 0x02, 0x7c, 0xb5, 0x87, 0x82, 0x0a, 0x81, 0x06, 0x05, 0x16, 0x77, 0xa8, 0x7f, 0x51,
+    0x16, 0x87, 0x06, 0x01, 0x0f, 0x31, 0x81, 0x0f, 0x06, 0x58, 0xff, 0xce, 0x37, 0xff, 0x94, 0x4f,
+    0x2c, 0x06, 0x71, 0xff, 0x73, 0x09, 0x82, 0x04, 0x03, 0xff, 0x7b, 0x8b, 0x2b, 0x06, 0x66, 0x8a,
+    0x00, 0xaa, 0x00, 0x81, 0x04, 0x03, 0x74, 0x5a, 0x04, 0x00, 0x88, 0x04, 0x11, 0x99, 0x73, 0x1f,
+    0x1a, 0x1f, 0x0d, 0x45, 0x73, 0x2a, 0xc8, 0xff, 0x8b, 0x6a, 0xff, 0xa3, 0xcb, 0xff, 0x93, 0x69,
+    0xff, 0x72, 0xa8, 0xff, 0x49, 0xc5, 0xff, 0x18, 0xc3, 0x6c, 0x17, 0x81, 0x09, 0x01, 0x36, 0x11,
+    0x84, 0x01, 0x00, 0x02, 0x86, 0x01, 0x06, 0x02, 0x33, 0x09, 0x1f, 0x45, 0xff, 0xb5, 0x54, 0x00,
+    0x82, 0x04, 0x00, 0x00, 0x81, 0x04, 0x04, 0x00, 0xff, 0xd6, 0x56, 0xff, 0x83, 0x8c, 0xb6, 0x2b,
+    0x82, 0x06, 0x81, 0x0a, 0x05, 0x7e, 0x9e, 0xc7, 0x04, 0xff, 0x52, 0x05, 0x16, 0x86, 0x06, 0x81,
+    0x0f, 0x0a, 0xfa, 0x16, 0x0f, 0x16, 0xff, 0x62, 0x65, 0x00, 0xb5, 0x0a, 0x06, 0x58, 0x79, 0x81,
+    0x04, 0x04, 0x8b, 0x78, 0x06, 0x7e, 0x7b, 0x8a, 0x00, 0xa7, 0x00, 0x82, 0x04, 0x83, 0x00, 0x8a,
+    0x04, 0x03, 0x00, 0xde, 0x09, 0x1a, 0x83, 0x09, 0x01, 0x17, 0x2a, 0x81, 0x20, 0x01, 0x2a, 0x1b,
+    0x84, 0x09, 0x00, 0x5b, 0x8e, 0x01, 0x07, 0x02, 0x09, 0x1f, 0x09, 0x17, 0x1a, 0xff, 0x84, 0x30,
+    0x04, 0x81, 0x00, 0x06, 0x04, 0xff, 0x9c, 0x90, 0xac, 0xff, 0x5a, 0x45, 0xf7, 0x2c, 0x0a, 0x81,
+    0x06, 0x08, 0x0a, 0x2b, 0x98, 0xf5, 0xbd, 0x5a, 0x04, 0xe0, 0x69, 0x86, 0x06, 0x03, 0x34, 0x0f,
+    0x2b, 0x41, 0x81, 0x0f, 0x06, 0x0a, 0x6e, 0xbf, 0x58, 0x06, 0x0a, 0x9e, 0x81, 0x04, 0x05, 0x5a,
+    0xbe, 0x16, 0x06, 0xff, 0x5a, 0x45, 0x44, 0x8a, 0x00, 0xa8, 0x00, 0x84, 0x04, 0x81, 0x00, 0x8a,
+    0x04, 0x04, 0xdf, 0x09, 0x1f, 0x0d, 0x09, 0x81, 0x1f, 0x00, 0x2a, 0x81, 0x1a, 0x00, 0x2a, 0x84,
+    0x09, 0x00, 0x1c, 0x91, 0x01, 0x81, 0x09, 0x04, 0x17, 0x26, 0x25, 0x26, 0xff, 0x6b, 0x6d, 0x82,
+    0x04, 0x04, 0x00, 0xff, 0xbd, 0x94, 0xff, 0x73, 0x09, 0xf5, 0x69, 0x81, 0x64, 0x04, 0x69, 0xf5,
+    0xd6, 0xb0, 0x5a, 0x82, 0x04, 0x01, 0x6e, 0x97, 0x83, 0x06, 0x00, 0x16, 0x81, 0x06, 0x02, 0x34,
+    0x16, 0x31, 0x82, 0x0f, 0x06, 0x2c, 0x7f, 0xac, 0x16, 0x06, 0x7e, 0xe6, 0x81, 0x04, 0x04, 0xff,
+    0x7b, 0x4b, 0x87, 0x06, 0x59, 0xff, 0xad, 0x11, 0x8b, 0x00, 0xa7, 0x00, 0x81, 0x04, 0x02, 0x00,
+    0x04, 0x00, 0x8c, 0x04, 0x02, 0x3d, 0xff, 0x52, 0xcb, 0x09, 0x82, 0x1f, 0x05, 0x1a, 0x09, 0x45,
+    0x1f, 0x0d, 0x2a, 0x82, 0x09, 0x00, 0x12, 0x8a, 0x01, 0x00, 0x02, 0x87, 0x01, 0x03, 0x09, 0x0d,
+    0xf6, 0x25, 0x81, 0x2e, 0x02, 0x12, 0xc5, 0xda, 0x83, 0x04, 0x01, 0x00, 0xe8, 0x81, 0x8b, 0x02,
+    0xff, 0xe6, 0xb8, 0x99, 0x3d, 0x83, 0x04, 0x04, 0x5a, 0xb7, 0x0a, 0x06, 0x16, 0x82, 0x06, 0x04,
+    0x16, 0x34, 0x0f, 0x34, 0x41, 0x82, 0x0f, 0x0c, 0x51, 0x7b, 0x78, 0x06, 0x0a, 0x82, 0x5f, 0x04,
+    0xe4, 0x70, 0x06, 0x2b, 0x66, 0x8c, 0x00, 0xa8, 0x00, 0x81, 0x04, 0x83, 0x00, 0x81, 0x04, 0x00,
+    0x00, 0x83, 0x04, 0x00, 0x00, 0x82, 0x04, 0x04, 0x74, 0xff, 0x31, 0xa7, 0x09, 0x1a, 0x0d, 0x81,
+    0x1f, 0x04, 0x09, 0x45, 0x33, 0x1f, 0x38, 0x81, 0x09, 0x00, 0x11, 0x86, 0x01, 0x00, 0x02, 0x87,
+    0x01, 0x81, 0x02, 0x81, 0x01, 0x03, 0x11, 0x09, 0x2d, 0x25, 0x82, 0x2e, 0x81, 0x25, 0x03, 0x33,
+    0xff, 0x39, 0xe8, 0xff, 0x8c, 0x70, 0xd9, 0x85, 0x04, 0x00, 0x00, 0x84, 0x04, 0x01, 0x79, 0x58,
+    0x83, 0x06, 0x05, 0x34, 0x06, 0x16, 0x0f, 0x16, 0x41, 0x83, 0x0f, 0x08, 0xff, 0x6a, 0x85, 0xff,
+    0x6b, 0x09, 0x2b, 0x16, 0x50, 0xff, 0x8c, 0x2e, 0x5f, 0xff, 0x73, 0x09, 0x50, 0x81, 0x06, 0x01,
+    0xab, 0xa2, 0x8c, 0x00, 0xa8, 0x00, 0x00, 0x04, 0x84, 0x00, 0x81, 0x04, 0x81, 0x00, 0x82, 0x04,
+    0x81, 0x00, 0x06, 0x5f, 0xff, 0x8c, 0x30, 0x96, 0x38, 0x09, 0x1a, 0x0d, 0x81, 0x1f, 0x05, 0x09,
+    0x45, 0x1f, 0x09, 0x38, 0x12, 0x83, 0x01, 0x00, 0x02, 0x84, 0x01, 0x00, 0x02, 0x86, 0x01, 0x00,
+    0x02, 0x82, 0x01, 0x02, 0x12, 0xb2, 0x63, 0x86, 0x2e, 0x07, 0xff, 0x22, 0x4c, 0x43, 0x4a, 0xff,
+    0x42, 0x4a, 0xae, 0xe0, 0x00, 0x04, 0x81, 0x00, 0x00, 0x04, 0x82, 0x00, 0x02, 0x04, 0x6e, 0x2c,
+    0x83, 0x06, 0x81, 0x16, 0x81, 0x0f, 0x01, 0x30, 0x31, 0x81, 0x21, 0x81, 0x0f, 0x0b, 0x78, 0x51,
+    0x2b, 0x06, 0xab, 0xff, 0xb5, 0x94, 0xff, 0x5a, 0x25, 0x1e, 0x2b, 0x06, 0x78, 0xe9, 0x8d, 0x00,
+    0xb0, 0x00, 0x00, 0x04, 0x82, 0x00, 0x07, 0x5f, 0x8d, 0xff, 0x5a, 0xec, 0x0d, 0xa7, 0x63, 0x1b,
+    0x09, 0x82, 0x0d, 0x81, 0x1f, 0x00, 0x2a, 0x81, 0x09, 0x01, 0x1b, 0x5c, 0x84, 0x01, 0x00, 0x02,
+    0x88, 0x01, 0x00, 0x02, 0x84, 0x01, 0x01, 0x36, 0x4a, 0x85, 0x2e, 0x03, 0x94, 0x4e, 0xf3, 0x13,
+    0x81, 0x07, 0x06, 0x13, 0xff, 0x3b, 0x11, 0x25, 0x96, 0xff, 0x52, 0xcb, 0xe5, 0xa2, 0x84, 0x04,
+    0x02, 0xc6, 0x0a, 0x06, 0x81, 0x16, 0x01, 0x0f, 0x34, 0x82, 0x0f, 0x02, 0x5e, 0x0f, 0x30, 0x81,
+    0x21, 0x06, 0x16, 0xff, 0x51, 0xa2, 0x06, 0x0f, 0x59, 0xa4, 0x78, 0x81, 0x2b, 0x02, 0x06, 0x5e,
+    0xe4, 0x8e, 0x00, 0xa9, 0x00, 0x00, 0x04, 0x82, 0x00, 0x81, 0x04, 0x0c, 0x00, 0x5f, 0xe7, 0xff,
+    0x7b, 0xce, 0xdf, 0x38, 0xb2, 0x43, 0x63, 0xff, 0x2a, 0x2d, 0x63, 0x0d, 0x1a, 0x83, 0x0d, 0x04,
+    0x09, 0x2a, 0x1c, 0x01, 0x09, 0x82, 0x01, 0x00, 0x02, 0x8e, 0x01, 0x03, 0x02, 0x5b, 0x0d, 0x25,
+    0x84, 0x2e, 0x04, 0x92, 0x7d, 0x47, 0x08, 0x07, 0x83, 0x08, 0x81, 0x07, 0x09, 0x13, 0x47, 0x4d,
+    0x1c, 0xff, 0x31, 0xc7, 0xff, 0x73, 0x8e, 0xe7, 0xa0, 0x81, 0xaa, 0x81, 0x06, 0x81, 0x16, 0x01,
+    0x34, 0x2b, 0x81, 0x0f, 0x00, 0x41, 0x81, 0x21, 0x00, 0x30, 0x81, 0x21, 0x05, 0x1e, 0x50, 0x0f,
+    0x2b, 0xaa, 0x2b, 0x81, 0x0f, 0x03, 0x16, 0x50, 0xac, 0x04, 0x8e, 0x00, 0xa8, 0x00, 0x81, 0x04,
+    0x08, 0x00, 0x8a, 0xe7, 0xff, 0x84, 0x30, 0x80, 0xff, 0x29, 0xa7, 0x38, 0xf6, 0xa7, 0x81, 0x43,
+    0x81, 0x94, 0x00, 0x2e, 0x81, 0x43, 0x00, 0x1b, 0x81, 0x33, 0x04, 0x1f, 0x0d, 0x1f, 0x09, 0x1b,
+    0x81, 0x02, 0x02, 0x1c, 0x26, 0x01, 0x81, 0x02, 0x84, 0x01, 0x00, 0x02, 0x87, 0x01, 0x00, 0x11,
+    0x81, 0x0d, 0x01, 0x2d, 0x0d, 0x82, 0x2e, 0x01, 0xa5, 0x55, 0x81, 0x07, 0x84, 0x08, 0x00, 0x07,
+    0x83, 0x08, 0x82, 0x07, 0x06, 0x13, 0x55, 0x63, 0x2d, 0xff, 0x39, 0xe8, 0xf2, 0x0a, 0x82, 0x16,
+    0x82, 0x0f, 0x01, 0x3a, 0x2c, 0x81, 0x21, 0x00, 0x1e, 0x81, 0x21, 0x04, 0x41, 0x06, 0x16, 0x69,
+    0x71, 0x81, 0x0f, 0x03, 0x16, 0x50, 0xff, 0x62, 0x88, 0x44, 0x8f, 0x00, 0xa6, 0x00, 0x09, 0x04,
+    0xa0, 0x8d, 0xdd, 0xff, 0x31, 0xe8, 0x12, 0x25, 0x7d, 0x47, 0x55, 0x81, 0x92, 0x81, 0x94, 0x00,
+    0x43, 0x81, 0x94, 0x81, 0x43, 0x00, 0x26, 0x81, 0x20, 0x06, 0x09, 0x2d, 0x09, 0x1c, 0x01, 0x0d,
+    0x5c, 0x81, 0x01, 0x00, 0x12, 0x86, 0x01, 0x00, 0x02, 0x85, 0x01, 0x01, 0x02, 0x26, 0x81, 0x0d,
+    0x83, 0x09, 0x04, 0x38, 0x2d, 0xff, 0x3b, 0x11, 0x13, 0x08, 0x81, 0x07, 0x85, 0x08, 0x01, 0x07,
+    0x08, 0x83, 0x07, 0x81, 0x08, 0x81, 0x07, 0x81, 0x13, 0x04, 0xff, 0x32, 0x8e, 0xff, 0x29, 0x87,
+    0xc6, 0x2c, 0x16, 0x81, 0x0f, 0x05, 0x3a, 0x31, 0x0f, 0x30, 0x21, 0x1e, 0x81, 0x21, 0x09, 0x5e,
+    0x0a, 0x50, 0x51, 0x2b, 0x0f, 0x16, 0x5e, 0x66, 0x5a, 0x90, 0x00, 0xa5, 0x00, 0x04, 0xe7, 0xff,
+    0x5a, 0xcb, 0x1c, 0x4d, 0x5d, 0x81, 0x07, 0x83, 0x08, 0x01, 0x07, 0xff, 0x2a, 0xd0, 0x81, 0x92,
+    0x82, 0x43, 0x0a, 0xb2, 0x38, 0x1b, 0x33, 0x1b, 0x20, 0x12, 0x01, 0x02, 0x01, 0x2d, 0x81, 0x01,
+    0x01, 0x25, 0x0d, 0x8c, 0x01, 0x03, 0x36, 0x0d, 0x09, 0x1c, 0x83, 0x11, 0x06, 0xf1, 0x02, 0x01,
+    0x33, 0x4a, 0x86, 0x13, 0x82, 0x07, 0x00, 0x13, 0x81, 0x08, 0x01, 0x07, 0x08, 0x81, 0x07, 0x82,
+    0x08, 0x81, 0x07, 0x00, 0x08, 0x81, 0x07, 0x12, 0x7d, 0x4a, 0x12, 0x5b, 0x6c, 0xff, 0x41, 0xa3,
+    0xfb, 0x2c, 0x31, 0x21, 0x30, 0x1e, 0x30, 0x1e, 0x21, 0x0f, 0x98, 0x06, 0x69, 0x81, 0x16, 0x03,
+    0x2b, 0x51, 0xff, 0x62, 0xc9, 0x04, 0x91, 0x00, 0xa3, 0x00, 0x03, 0x8d, 0xff, 0x31, 0xc8, 0x1b,
+    0x47, 0x82, 0x08, 0x01, 0x07, 0x08, 0x82, 0x07, 0x00, 0x08, 0x81, 0x07, 0x05, 0x5d, 0x86, 0x4a,
+    0x0d, 0xa3, 0x0d, 0x83, 0x09, 0x09, 0x0d, 0x17, 0x12, 0x02, 0x01, 0x1c, 0x26, 0x01, 0x02, 0x0d,
+    0x89, 0x01, 0x00, 0x1c, 0x81, 0x09, 0x01, 0x01, 0x02, 0x89, 0x01, 0x06, 0x02, 0x26, 0x0d, 0xa7,
+    0x4d, 0x47, 0x13, 0x81, 0x07, 0x00, 0x08, 0x81, 0x07, 0x01, 0x08, 0x07, 0x82, 0x08, 0x04, 0x07,
+    0x08, 0x07, 0x57, 0x4a, 0x81, 0x02, 0x81, 0x01, 0x03, 0x11, 0xc8, 0x51, 0x0f, 0x83, 0x30, 0x00,
+    0x2c, 0x81, 0x21, 0x02, 0x59, 0x58, 0x1e, 0x81, 0x16, 0x02, 0x64, 0xa8, 0x04, 0x92, 0x00, 0xa1,
+    0x00, 0x04, 0x44, 0xdd, 0x1a, 0x01, 0x4f, 0x82, 0x07, 0x81, 0x08, 0x82, 0x07, 0x81, 0x13, 0x03,
+    0x7d, 0x2e, 0x1c, 0x0d, 0x81, 0x12, 0x00, 0x36, 0x82, 0x09, 0x08, 0x36, 0x26, 0x1c, 0x09, 0x0d,
+    0x20, 0x0d, 0x1c, 0x36, 0x81, 0x01, 0x00, 0x0d, 0x84, 0x01, 0x06, 0x02, 0x01, 0x12, 0x09, 0x2d,
+    0x11, 0x02, 0x8c, 0x01, 0x01, 0x02, 0x01, 0x81, 0x02, 0x05, 0x60, 0x2d, 0x12, 0x25, 0x8f, 0x13,
+    0x82, 0x07, 0x00, 0x08, 0x83, 0x07, 0x01, 0x13, 0x57, 0x84, 0x01, 0x00, 0x02, 0x81, 0x01, 0x01,
+    0xff, 0x21, 0x04, 0x7e, 0x83, 0x30, 0x0a, 0x31, 0x21, 0x1e, 0xcf, 0x58, 0x2b, 0x1e, 0xf5, 0x7b,
+    0x00, 0x04, 0x92, 0x00, 0xa0, 0x00, 0x05, 0x04, 0x80, 0x36, 0x01, 0x12, 0x13, 0x82, 0x07, 0x08,
+    0x08, 0x07, 0x13, 0x86, 0xcc, 0x12, 0x0d, 0x26, 0x5c, 0x8b, 0x01, 0x00, 0x1c, 0x81, 0x09, 0x04,
+    0x38, 0xa3, 0x12, 0x01, 0x09, 0x81, 0x11, 0x01, 0x12, 0x2d, 0x81, 0x33, 0x00, 0x2d, 0x82, 0x01,
+    0x03, 0x11, 0x1c, 0x12, 0x11, 0x8c, 0x01, 0x81, 0x02, 0x07, 0x01, 0x02, 0x01, 0x5c, 0x1c, 0x33,
+    0x01, 0x55, 0x81, 0x13, 0x05, 0x08, 0x07, 0x08, 0x07, 0x86, 0x11, 0x88, 0x01, 0x01, 0xff, 0x29,
+    0x03, 0x2c, 0x81, 0x21, 0x08, 0x30, 0x41, 0x0f, 0x1e, 0xff, 0x51, 0xc2, 0x2b, 0x64, 0x9c, 0xa2,
+    0x95, 0x00, 0x9f, 0x00, 0x05, 0x04, 0xae, 0x1a, 0x01, 0x02, 0x25, 0x82, 0x07, 0x04, 0x13, 0x7d,
+    0x4a, 0x33, 0x11, 0x81, 0x02, 0x81, 0x01, 0x00, 0x02, 0x89, 0x01, 0x00, 0x02, 0x82, 0x01, 0x08,
+    0x11, 0x20, 0x1c, 0x26, 0x09, 0x2a, 0x1b, 0x09, 0x4a, 0x83, 0x01, 0x01, 0x60, 0x1c, 0x81, 0x09,
+    0x00, 0x11, 0x83, 0x01, 0x00, 0x02, 0x81, 0x01, 0x00, 0x02, 0x87, 0x01, 0x00, 0x02, 0x84, 0x01,
+    0x81, 0x02, 0x81, 0x12, 0x06, 0xc9, 0x13, 0x07, 0x13, 0x55, 0x26, 0x02, 0x84, 0x01, 0x0e, 0x02,
+    0x01, 0x02, 0x01, 0x11, 0xad, 0x2b, 0x21, 0x30, 0x31, 0x0f, 0x1e, 0xff, 0x41, 0x61, 0x66, 0xc7,
+    0x81, 0x04, 0x95, 0x00, 0x9f, 0x00, 0x02, 0xff, 0xc5, 0xf6, 0x6b, 0x02, 0x81, 0x01, 0x00, 0x4d,
+    0x81, 0x07, 0x03, 0xff, 0x3b, 0x11, 0x12, 0x11, 0x5c, 0x82, 0x01, 0x00, 0x02, 0x82, 0x01, 0x00,
+    0x02, 0x85, 0x01, 0x02, 0xf1, 0x1c, 0x11, 0x83, 0x01, 0x01, 0x11, 0x0d, 0x82, 0x01, 0x00, 0x17,
+    0x82, 0x01, 0x02, 0x02, 0x01, 0x11, 0x82, 0x09, 0x04, 0x1c, 0x01, 0x02, 0x01, 0x02, 0x86, 0x01,
+    0x00, 0x02, 0x82, 0x01, 0x81, 0x02, 0x89, 0x01, 0x08, 0x02, 0x11, 0x12, 0xed, 0x13, 0x26, 0x02,
+    0x01, 0x02, 0x81, 0x01, 0x00, 0x02, 0x83, 0x01, 0x09, 0x02, 0x01, 0xff, 0x29, 0x45, 0xa9, 0x21,
+    0x30, 0x21, 0xfa, 0x2b, 0xff, 0x73, 0x09, 0x81, 0x04, 0x97, 0x00, 0x9e, 0x00, 0x02, 0x04, 0xdf,
+    0x01, 0x81, 0x02, 0x07, 0x26, 0x55, 0x13, 0x43, 0x12, 0x5c, 0x01, 0x02, 0x8e, 0x01, 0x03, 0x11,
+    0x09, 0x12, 0x11, 0x81, 0x01, 0x01, 0x1c, 0x12, 0x81, 0x01, 0x05, 0x02, 0x1b, 0x01, 0x02, 0x11,
+    0x1c, 0x82, 0x09, 0x02, 0x1c, 0xf1, 0x02, 0x91, 0x01, 0x81, 0x02, 0x01, 0x01, 0x02, 0x84, 0x01,
+    0x02, 0x02, 0x01, 0x02, 0x81, 0x1c, 0x82, 0x02, 0x89, 0x01, 0x02, 0x60, 0xb7, 0x0f, 0x81, 0x21,
+    0x02, 0xff, 0x8a, 0xe4, 0x06, 0xb1, 0x81, 0x04, 0x97, 0x00, 0x9e, 0x00, 0x09, 0xff, 0xa5, 0x12,
+    0x0d, 0x01, 0x02, 0x01, 0x09, 0x07, 0xcc, 0x60, 0x02, 0x85, 0x01, 0x00, 0x02, 0x82, 0x01, 0x00,
+    0x02, 0x87, 0x01, 0x00, 0x11, 0x82, 0x09, 0x02, 0x12, 0x1b, 0x11, 0x81, 0x01, 0x03, 0x26, 0x09,
+    0x01, 0x11, 0x81, 0x09, 0x01, 0x1c, 0x11, 0x87, 0x01, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02, 0x83,
+    0x01, 0x81, 0x02, 0x8e, 0x01, 0x03, 0x11, 0x1c, 0x01, 0x02, 0x85, 0x01, 0x00, 0x02, 0x81, 0x01,
+    0x81, 0x02, 0x02, 0x01, 0x83, 0xfb, 0x81, 0x21, 0x02, 0x98, 0x16, 0xf2, 0x99, 0x00, 0x9e, 0x00,
+    0x01, 0xff, 0x39, 0xe7, 0xaf, 0x82, 0x01, 0x01, 0x1c, 0x25, 0x97, 0x01, 0x00, 0x12, 0x81, 0x09,
+    0x07, 0x38, 0x12, 0x11, 0x01, 0x33, 0x5b, 0x01, 0x11, 0xa3, 0x01, 0x81, 0x02, 0x00, 0x09, 0x81,
+    0x01, 0x81, 0x02, 0x81, 0x01, 0x00, 0x02, 0x85, 0x01, 0x03, 0x02, 0x01, 0xff, 0x29, 0xa8, 0x78,
+    0x81, 0x21, 0x04, 0xff, 0x9b, 0x45, 0xfa, 0xca, 0x74, 0x04, 0x97, 0x00, 0x9d, 0x00, 0x02, 0xef,
+    0x1b, 0x02, 0x81, 0x01, 0x02, 0x02, 0x09, 0x1c, 0x97, 0x01, 0x08, 0x02, 0x11, 0x17, 0x2d, 0x09,
+    0x1c, 0x01, 0x1b, 0x11, 0x90, 0x01, 0x00, 0x02, 0x8b, 0x01, 0x00, 0x02, 0x85, 0x01, 0x03, 0x02,
+    0x01, 0x1c, 0x11, 0x82, 0x01, 0x02, 0x02, 0x01, 0x02, 0x83, 0x01, 0x81, 0x02, 0x01, 0x01, 0x02,
+    0x81, 0x01, 0x00, 0xb7, 0x81, 0x21, 0x03, 0x0f, 0xff, 0x7a, 0x83, 0x51, 0x7b, 0x98, 0x00, 0x9c,
+    0x00, 0x02, 0x04, 0x80, 0x60, 0x82, 0x01, 0x02, 0x02, 0x0d, 0x02, 0x87, 0x01, 0x02, 0x02, 0x01,
+    0x02, 0x86, 0x01, 0x01, 0x02, 0x01, 0x82, 0x02, 0x81, 0x01, 0x01, 0x02, 0x0d, 0x83, 0x01, 0x00,
+    0x33, 0x84, 0x01, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02, 0x8a, 0x01, 0x00,
+    0x02, 0x81, 0x01, 0x00, 0x02, 0x81, 0x01, 0x00, 0x02, 0x82, 0x01, 0x05, 0x02, 0x01, 0x02, 0x01,
+    0x02, 0x09, 0x83, 0x01, 0x81, 0x02, 0x01, 0x01, 0x02, 0x82, 0x01, 0x02, 0x02, 0x01, 0x02, 0x82,
+    0x01, 0x06, 0xff, 0x29, 0x02, 0x06, 0x21, 0x0f, 0x1e, 0xe2, 0xb5, 0x98, 0x00, 0x9c, 0x00, 0x02,
+    0x5f, 0x6c, 0x02, 0x82, 0x01, 0x02, 0x02, 0x0d, 0x02, 0x82, 0x01, 0x04, 0x02, 0x01, 0x12, 0x01,
+    0x02, 0x86, 0x01, 0x00, 0x02, 0x84, 0x01, 0x00, 0x02, 0x82, 0x01, 0x00, 0x09, 0x83, 0x01, 0x00,
+    0x09, 0x85, 0x01, 0x00, 0x02, 0x9c, 0x01, 0x00, 0x02, 0x82, 0x01, 0x01, 0x1c, 0x11, 0x81, 0x01,
+    0x81, 0x02, 0x86, 0x01, 0x00, 0x02, 0x82, 0x01, 0x04, 0x02, 0x01, 0x83, 0x1e, 0x21, 0x81, 0x0f,
+    0x03, 0x5e, 0xff, 0x59, 0xc2, 0xb0, 0x04, 0x87, 0x00, 0x00, 0x74, 0x8d, 0x00, 0x9c, 0x00, 0x08,
+    0xff, 0x9c, 0xd1, 0x09, 0x02, 0x01, 0x02, 0x01, 0x02, 0x1b, 0x02, 0x81, 0x01, 0x05, 0x02, 0x11,
+    0x09, 0x12, 0x01, 0x02, 0x84, 0x01, 0x00, 0x02, 0x84, 0x01, 0x00, 0x02, 0x81, 0x01, 0x05, 0x02,
+    0x01, 0x02, 0x0d, 0x02, 0x01, 0x81, 0x02, 0x00, 0x0d, 0x87, 0x01, 0x00, 0x02, 0x91, 0x01, 0x02,
+    0x02, 0x01, 0x02, 0x86, 0x01, 0x04, 0x02, 0x01, 0x02, 0x09, 0x02, 0x84, 0x01, 0x00, 0x11, 0x83,
+    0x01, 0x01, 0x02, 0x01, 0x81, 0x02, 0x82, 0x01, 0x09, 0xff, 0x21, 0x66, 0xa9, 0x0f, 0x21, 0x0f,
+    0x16, 0x98, 0xff, 0x41, 0x41, 0xc7, 0x04, 0x84, 0x00, 0x02, 0x04, 0xda, 0xe9, 0x8d, 0x00, 0x9b,
+    0x00, 0x01, 0x04, 0xc3, 0x84, 0x01, 0x01, 0x02, 0x1b, 0x83, 0x01, 0x81, 0x09, 0x00, 0x11, 0x82,
+    0x01, 0x00, 0x02, 0x8b, 0x01, 0x04, 0x02, 0x01, 0x12, 0x01, 0x02, 0x81, 0x01, 0x01, 0x11, 0x12,
+    0x81, 0x01, 0x00, 0x02, 0x98, 0x01, 0x02, 0x02, 0x01, 0x02, 0x87, 0x01, 0x01, 0x11, 0x12, 0x81,
+    0x01, 0x00, 0x02, 0x81, 0x01, 0x81, 0x1c, 0x82, 0x01, 0x00, 0x02, 0x81, 0x01, 0x00, 0x02, 0x81,
+    0x01, 0x03, 0x02, 0x01, 0x96, 0x59, 0x82, 0x0f, 0x81, 0x16, 0x0a, 0x50, 0xff, 0x41, 0x41, 0xd8,
+    0x8a, 0x04, 0x00, 0x04, 0x5a, 0xee, 0xff, 0x49, 0xe5, 0x9d, 0x8d, 0x00, 0x9b, 0x00, 0x01, 0x9d,
+    0x6b, 0x84, 0x01, 0x02, 0x02, 0x0d, 0x02, 0x81, 0x01, 0x00, 0x12, 0x81, 0x09, 0x00, 0x01, 0x82,
+    0x02, 0x01, 0x01, 0x02, 0x83, 0x01, 0x00, 0x02, 0x84, 0x01, 0x82, 0x02, 0x00, 0x09, 0x81, 0x02,
+    0x81, 0x01, 0x00, 0x33, 0x81, 0x02, 0x81, 0x01, 0x02, 0x02, 0x01, 0x02, 0x8f, 0x01, 0x00, 0x02,
+    0x85, 0x01, 0x00, 0x02, 0x86, 0x01, 0x81, 0x02, 0x01, 0x09, 0x02, 0x82, 0x01, 0x03, 0x02, 0x4a,
+    0x09, 0x26, 0x84, 0x01, 0x81, 0x02, 0x83, 0x01, 0x01, 0x09, 0xb4, 0x83, 0x16, 0x0a, 0x0f, 0x16,
+    0x06, 0x58, 0xad, 0xb1, 0x6e, 0xac, 0xa4, 0xff, 0x41, 0x62, 0x7c, 0x8e, 0x00, 0x9b, 0x00, 0x01,
+    0xff, 0xb5, 0x54, 0x1a, 0x83, 0x01, 0x02, 0x02, 0x5c, 0x1b, 0x82, 0x01, 0x81, 0x09, 0x00, 0x1c,
+    0x82, 0x01, 0x00, 0x02, 0x81, 0x01, 0x00, 0x02, 0x82, 0x01, 0x81, 0x02, 0x85, 0x01, 0x03, 0x26,
+    0x11, 0x02, 0x01, 0x81, 0x02, 0x00, 0x0d, 0x86, 0x01, 0x00, 0x02, 0x81, 0x01, 0x00, 0x02, 0x86,
+    0x01, 0x00, 0x02, 0x81, 0x01, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02, 0x86,
+    0x01, 0x81, 0x02, 0x01, 0x2d, 0x01, 0x82, 0x02, 0x00, 0x01, 0x81, 0x09, 0x84, 0x01, 0x81, 0x02,
+    0x81, 0x01, 0x00, 0x02, 0x81, 0x01, 0x04, 0x09, 0xff, 0x30, 0xe0, 0xf2, 0x50, 0x0a, 0x81, 0x16,
+    0x00, 0x0f, 0x81, 0x16, 0x05, 0x0a, 0xec, 0x06, 0x71, 0xab, 0xff, 0xcd, 0xf5, 0x8f, 0x00, 0x9b,
+    0x00, 0x01, 0xff, 0x73, 0xae, 0x12, 0x82, 0x01, 0x03, 0x11, 0x01, 0x02, 0x1b, 0x81, 0x01, 0x03,
+    0x1c, 0x09, 0x1b, 0x11, 0x8c, 0x01, 0x00, 0x02, 0x82, 0x01, 0x02, 0x02, 0x09, 0x02, 0x82, 0x01,
+    0x01, 0x12, 0x11, 0x82, 0x01, 0x02, 0x02, 0x01, 0x02, 0x85, 0x01, 0x00, 0x02, 0x98, 0x01, 0x01,
+    0x02, 0x12, 0x84, 0x01, 0x03, 0x12, 0x09, 0x36, 0x02, 0x83, 0x01, 0x01, 0x02, 0x01, 0x81, 0x02,
+    0x82, 0x01, 0x07, 0x09, 0xb4, 0xfc, 0xff, 0x94, 0x2f, 0x9e, 0x58, 0x2c, 0x16, 0x81, 0x0a, 0x04,
+    0x2b, 0x7e, 0xb6, 0x6e, 0x74, 0x90, 0x00, 0x9b, 0x00, 0x01, 0xff, 0x42, 0x28, 0x02, 0x82, 0x01,
+    0x05, 0x36, 0x01, 0x02, 0x1b, 0x02, 0x01, 0x81, 0x09, 0x01, 0x0d, 0x02, 0x86, 0x01, 0x00, 0x02,
+    0x81, 0x01, 0x81, 0x02, 0x81, 0x01, 0x00, 0x02, 0x82, 0x01, 0x00, 0x12, 0x81, 0x01, 0x81, 0x02,
+    0x01, 0x2d, 0x02, 0x83, 0x01, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02, 0x84, 0x01, 0x00, 0x11, 0x81,
+    0x25, 0x02, 0x01, 0x4a, 0x1c, 0x81, 0x12, 0x00, 0x01, 0x81, 0x02, 0x8c, 0x01, 0x02, 0x02, 0x2d,
+    0x01, 0x82, 0x02, 0x00, 0x11, 0x81, 0x09, 0x01, 0x1c, 0x02, 0x82, 0x01, 0x02, 0x02, 0x01, 0x02,
+    0x81, 0x01, 0x00, 0x02, 0x81, 0x01, 0x0d, 0x09, 0xb4, 0x2c, 0xff, 0x7b, 0xac, 0x44, 0xff, 0xb5,
+    0x32, 0xff, 0x83, 0x8c, 0x66, 0xb1, 0xff, 0x62, 0x88, 0xff, 0x73, 0x4a, 0xb0, 0x74, 0x04, 0x91,
+    0x00, 0x9a, 0x00, 0x01, 0x04, 0x6b, 0x81, 0x01, 0x0b, 0x02, 0x36, 0x09, 0x02, 0x01, 0x1b, 0x01,
+    0x1c, 0x09, 0x1b, 0x12, 0x02, 0x84, 0x01, 0x00, 0x02, 0x85, 0x01, 0x00, 0x02, 0x82, 0x01, 0x01,
+    0x02, 0x09, 0x81, 0x02, 0x03, 0x01, 0x02, 0x01, 0x09, 0x84, 0x01, 0x00, 0x02, 0x83, 0x01, 0x05,
+    0x02, 0x01, 0x02, 0x01, 0x02, 0x57, 0x82, 0x07, 0x07, 0x08, 0xeb, 0x84, 0x47, 0x7d, 0xa5, 0x01,
+    0x02, 0x84, 0x01, 0x00, 0x1c, 0x82, 0x01, 0x00, 0x02, 0x82, 0x01, 0x00, 0x2d, 0x81, 0x01, 0x02,
+    0x02, 0x01, 0x36, 0x81, 0x09, 0x81, 0x01, 0x81, 0x02, 0x81, 0x01, 0x0c, 0x02, 0x01, 0x02, 0x01,
+    0x02, 0x01, 0x02, 0x09, 0xf2, 0x16, 0x2c, 0xff, 0x7b, 0x4b, 0x9d, 0x81, 0x04, 0x00, 0x3d, 0x82,
+    0x04, 0x93, 0x00, 0x9a, 0x00, 0x01, 0xc4, 0x20, 0x82, 0x01, 0x05, 0x0d, 0x09, 0x02, 0x01, 0x17,
+    0x11, 0x81, 0x09, 0x00, 0x2a, 0x81, 0x02, 0x82, 0x01, 0x00, 0x02, 0x87, 0x01, 0x00, 0x02, 0x82,
+    0x01, 0x01, 0x02, 0x09, 0x81, 0x02, 0x81, 0x01, 0x00, 0x09, 0x85, 0x01, 0x00, 0x02, 0x87, 0x01,
+    0x07, 0x12, 0x47, 0x07, 0x55, 0x47, 0x13, 0x07, 0x08, 0x81, 0x07, 0x01, 0x13, 0x26, 0x81, 0x02,
+    0x83, 0x01, 0x81, 0x1c, 0x84, 0x01, 0x00, 0x36, 0x83, 0x01, 0x00, 0x11, 0x82, 0x09, 0x00, 0x02,
+    0x86, 0x01, 0x00, 0x02, 0x81, 0x01, 0x81, 0x02, 0x06, 0x1a, 0xc6, 0x06, 0x16, 0xff, 0x9b, 0x66,
+    0xbe, 0xbf, 0x98, 0x00, 0x9a, 0x00, 0x01, 0xc2, 0x0d, 0x82, 0x01, 0x01, 0x1b, 0x09, 0x81, 0x01,
+    0x04, 0x20, 0x36, 0x09, 0x1b, 0x09, 0x81, 0x01, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02, 0x83, 0x01,
+    0x0a, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x09, 0x01, 0x02, 0x01, 0x81, 0x02, 0x00, 0x33,
+    0x84, 0x01, 0x00, 0x02, 0x84, 0x01, 0x81, 0x02, 0x81, 0x01, 0x07, 0x02, 0x08, 0x07, 0x09, 0x12,
+    0x2d, 0x25, 0x43, 0x81, 0x07, 0x02, 0x8f, 0x01, 0x02, 0x84, 0x01, 0x01, 0x26, 0x09, 0x81, 0x02,
+    0x82, 0x01, 0x01, 0x09, 0x02, 0x82, 0x01, 0x00, 0x12, 0x81, 0x09, 0x00, 0x26, 0x86, 0x01, 0x01,
+    0x02, 0x01, 0x82, 0x02, 0x02, 0x01, 0x1b, 0xff, 0x49, 0xc4, 0x82, 0x06, 0x06, 0x0a, 0x51, 0x9c,
+    0xd8, 0xff, 0xac, 0xf1, 0x7f, 0x7c, 0x93, 0x00, 0x9a, 0x00, 0x01, 0xff, 0x7b, 0xce, 0x36, 0x82,
+    0x01, 0x04, 0x17, 0x09, 0x11, 0x01, 0x17, 0x81, 0x09, 0x03, 0x2a, 0x02, 0x01, 0x02, 0x85, 0x01,
+    0x00, 0x02, 0x88, 0x01, 0x06, 0x09, 0x02, 0x01, 0x02, 0x01, 0x11, 0x12, 0x83, 0x01, 0x00, 0x02,
+    0x88, 0x01, 0x03, 0x11, 0x8f, 0x07, 0x7d, 0x83, 0x01, 0x03, 0x26, 0x13, 0x07, 0x63, 0x81, 0x02,
+    0x84, 0x01, 0x02, 0x26, 0x09, 0x11, 0x82, 0x01, 0x01, 0x02, 0x33, 0x83, 0x01, 0x81, 0x09, 0x01,
+    0x2d, 0x02, 0x81, 0x01, 0x81, 0x02, 0x88, 0x01, 0x0a, 0x1b, 0xff, 0x21, 0x02, 0xf7, 0x2c, 0x16,
+    0x0a, 0x06, 0xff, 0x9b, 0x66, 0x58, 0xb5, 0xff, 0xc5, 0xb4, 0x94, 0x00, 0x99, 0x00, 0x02, 0x04,
+    0xff, 0x52, 0xcb, 0x5b, 0x82, 0x01, 0x07, 0x17, 0x09, 0x1c, 0x01, 0x1b, 0x0d, 0x20, 0x1c, 0x81,
+    0x01, 0x00, 0x02, 0x82, 0x01, 0x02, 0x02, 0x01, 0x02, 0x82, 0x01, 0x00, 0x02, 0x84, 0x01, 0x01,
+    0x11, 0x12, 0x81, 0x01, 0x02, 0x02, 0x01, 0x2d, 0x81, 0x02, 0x8c, 0x01, 0x03, 0x26, 0x13, 0x07,
+    0x25, 0x83, 0x02, 0x04, 0x57, 0x07, 0x13, 0x12, 0x02, 0x85, 0x01, 0x02, 0x11, 0x09, 0x1c, 0x82,
+    0x01, 0x05, 0x11, 0x12, 0x01, 0x02, 0x01, 0x11, 0x81, 0x09, 0x00, 0x12, 0x81, 0x01, 0x00, 0x02,
+    0x83, 0x01, 0x01, 0x02, 0x01, 0x81, 0x02, 0x81, 0x01, 0x09, 0x11, 0x1b, 0xff, 0x5b, 0x0b, 0xda,
+    0xee, 0xac, 0x66, 0xd6, 0xd8, 0xbf, 0x96, 0x00, 0x9a, 0x00, 0x01, 0xff, 0x31, 0xc7, 0x11, 0x82,
+    0x01, 0x00, 0x17, 0x81, 0x09, 0x01, 0x01, 0x0d, 0x81, 0x20, 0x83, 0x01, 0x81, 0x02, 0x82, 0x01,
+    0x00, 0x02, 0x85, 0x01, 0x82, 0x02, 0x06, 0x2d, 0x02, 0x01, 0x02, 0x01, 0x02, 0x0d, 0x83, 0x01,
+    0x00, 0x02, 0x82, 0x01, 0x00, 0x02, 0x84, 0x01, 0x01, 0x02, 0x57, 0x81, 0x08, 0x07, 0x55, 0x4d,
+    0x25, 0x02, 0x12, 0x47, 0x08, 0x7d, 0x87, 0x01, 0x02, 0x11, 0x09, 0x12, 0x82, 0x01, 0x01, 0x09,
+    0x02, 0x82, 0x01, 0x04, 0x12, 0x09, 0x0d, 0x01, 0x02, 0x82, 0x01, 0x00, 0x02, 0x86, 0x01, 0x04,
+    0x02, 0x5b, 0x1b, 0xdd, 0x04, 0x81, 0x00, 0x81, 0x04, 0x98, 0x00, 0x99, 0x00, 0x02, 0x99, 0x67,
+    0x11, 0x81, 0x01, 0x01, 0x02, 0x20, 0x81, 0x09, 0x02, 0x36, 0x0d, 0xcb, 0x86, 0x01, 0x00, 0x02,
+    0x85, 0x01, 0x00, 0x02, 0x83, 0x01, 0x01, 0x02, 0x2d, 0x83, 0x01, 0x01, 0x11, 0x1c, 0x85, 0x01,
+    0x02, 0x02, 0x01, 0x02, 0x82, 0x01, 0x03, 0x02, 0x01, 0x12, 0x5d, 0x81, 0x08, 0x82, 0x07, 0x01,
+    0x08, 0x13, 0x81, 0x08, 0x00, 0x43, 0x84, 0x01, 0x00, 0x02, 0x82, 0x01, 0x01, 0x33, 0x09, 0x82,
+    0x01, 0x00, 0x33, 0x82, 0x01, 0x00, 0x02, 0x82, 0x09, 0x8d, 0x01, 0x02, 0x12, 0x17, 0xff, 0x73,
+    0xae, 0x9d, 0x00, 0x99, 0x00, 0x02, 0xff, 0xe6, 0xb8, 0x67, 0x5b, 0x82, 0x01, 0x00, 0x1b, 0x82,
+    0x09, 0x02, 0xa3, 0x0d, 0x02, 0x82, 0x01, 0x81, 0x02, 0x00, 0x01, 0x82, 0x02, 0x05, 0x01, 0x02,
+    0x01, 0x02, 0x01, 0x02, 0x81, 0x01, 0x02, 0x02, 0x1c, 0x11, 0x82, 0x01, 0x02, 0x02, 0x2d, 0x02,
+    0x8d, 0x01, 0x0b, 0x1c, 0x57, 0xff, 0x2a, 0xcf, 0x55, 0x56, 0x47, 0x13, 0x84, 0x13, 0x08, 0x13,
+    0x26, 0x84, 0x01, 0x00, 0x02, 0x81, 0x01, 0x03, 0x02, 0x33, 0x0d, 0x25, 0x81, 0x02, 0x00, 0x2d,
+    0x82, 0x01, 0x02, 0x11, 0x09, 0x1b, 0x8c, 0x01, 0x04, 0x02, 0x01, 0x09, 0x17, 0xff, 0x7b, 0xce,
+    0x9d, 0x00, 0x99, 0x00, 0x02, 0x8b, 0x2a, 0x1c, 0x82, 0x01, 0x04, 0x2d, 0x0d, 0x33, 0x0d, 0x75,
+    0x86, 0x01, 0x81, 0x02, 0x01, 0x01, 0x02, 0x88, 0x01, 0x01, 0x2d, 0x02, 0x82, 0x01, 0x01, 0x02,
+    0x33, 0x88, 0x01, 0x00, 0x02, 0x86, 0x01, 0x02, 0x11, 0x26, 0x12, 0x81, 0x09, 0x01, 0x12, 0x60,
+    0x81, 0x63, 0x89, 0x01, 0x01, 0x36, 0x1b, 0x81, 0x01, 0x02, 0x02, 0x2d, 0x02, 0x81, 0x01, 0x03,
+    0x1c, 0x09, 0x0d, 0x02, 0x81, 0x01, 0x02, 0x02, 0x01, 0x02, 0x86, 0x01, 0x04, 0x02, 0x11, 0x09,
+    0x20, 0xff, 0x84, 0x2f, 0x9d, 0x00, 0x99, 0x00, 0x02, 0xff, 0xad, 0x53, 0x20, 0x12, 0x82, 0x01,
+    0x04, 0x12, 0x20, 0x1f, 0x73, 0x12, 0x83, 0x01, 0x00, 0x02, 0x86, 0x01, 0x00, 0x02, 0x85, 0x01,
+    0x01, 0x02, 0x33, 0x83, 0x01, 0x01, 0x11, 0x1c, 0x88, 0x01, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02,
+    0x83, 0x01, 0x03, 0x02, 0x01, 0x02, 0x01, 0x81, 0x02, 0x01, 0x01, 0x02, 0x85, 0x01, 0x81, 0x02,
+    0x81, 0x01, 0x05, 0x12, 0x1b, 0x11, 0x01, 0x1c, 0x26, 0x82, 0x01, 0x02, 0x09, 0x17, 0x01, 0x83,
+    0x02, 0x86, 0x01, 0x00, 0x02, 0x81, 0x01, 0x03, 0x5b, 0x09, 0x20, 0xe5, 0x9d, 0x00, 0x99, 0x00,
+    0x02, 0xff, 0x8c, 0x50, 0x17, 0x09, 0x82, 0x01, 0x03, 0x11, 0x45, 0x1b, 0x45, 0x82, 0x01, 0x02,
+    0x02, 0x01, 0x02, 0x84, 0x01, 0x02, 0x02, 0x01, 0x02, 0x85, 0x01, 0x01, 0x12, 0x11, 0x83, 0x01,
+    0x01, 0x2d, 0x02, 0x83, 0x01, 0x00, 0x02, 0x83, 0x01, 0x02, 0x02, 0x01, 0x02, 0x85, 0x01, 0x00,
+    0x02, 0x8d, 0x01, 0x00, 0x02, 0x82, 0x01, 0x04, 0x20, 0x12, 0x01, 0x33, 0x02, 0x81, 0x01, 0x00,
+    0x26, 0x81, 0x09, 0x02, 0x02, 0x01, 0x02, 0x8b, 0x01, 0x03, 0x36, 0x09, 0x38, 0xc2, 0x9d, 0x00,
+    0x99, 0x00, 0x00, 0xff, 0x5a, 0xcb, 0x81, 0x09, 0x00, 0x11, 0x81, 0x01, 0x03, 0x26, 0x45, 0x75,
+    0x12, 0x8a, 0x01, 0x00, 0x02, 0x87, 0x01, 0x01, 0x2d, 0x02, 0x82, 0x01, 0x01, 0x02, 0x0d, 0x83,
+    0x01, 0x81, 0x02, 0x81, 0x01, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x84, 0x01, 0x00, 0x02, 0x8e,
+    0x01, 0x00, 0x02, 0x81, 0x01, 0x04, 0x1b, 0x0d, 0x01, 0x33, 0x02, 0x81, 0x01, 0x01, 0x09, 0x20,
+    0x83, 0x02, 0x83, 0x01, 0x00, 0x02, 0x86, 0x01, 0x81, 0x09, 0x01, 0x2a, 0xff, 0xbd, 0x94, 0x9d,
+    0x00, 0x98, 0x00, 0x01, 0x04, 0x6c, 0x81, 0x09, 0x00, 0x1c, 0x81, 0x01, 0x03, 0x1c, 0x2a, 0x45,
+    0x11, 0x82, 0x01, 0x81, 0x02, 0x83, 0x01, 0x00, 0x02, 0x88, 0x01, 0x01, 0x02, 0x0d, 0x84, 0x01,
+    0x00, 0x09, 0x8c, 0x01, 0x03, 0x02, 0x01, 0x02, 0x01, 0x81, 0x02, 0x84, 0x01, 0x02, 0x02, 0x01,
+    0x02, 0x8a, 0x01, 0x03, 0x09, 0x1b, 0x26, 0x09, 0x81, 0x01, 0x04, 0x11, 0x0d, 0x1c, 0x01, 0x02,
+    0x81, 0x01, 0x00, 0x02, 0x82, 0x01, 0x01, 0x02, 0x01, 0x81, 0x02, 0x82, 0x01, 0x04, 0x11, 0x1f,
+    0x09, 0x45, 0x8b, 0x9d, 0x00, 0x98, 0x00, 0x02, 0xef, 0x2a, 0x1f, 0x81, 0x09, 0x04, 0x01, 0x60,
+    0x09, 0x67, 0x09, 0x87, 0x01, 0x00, 0x02, 0x81, 0x01, 0x02, 0x02, 0x01, 0x02, 0x84, 0x01, 0x02,
+    0x02, 0x4a, 0x1c, 0x83, 0x01, 0x00, 0x09, 0x8e, 0x01, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02, 0x81,
+    0x01, 0x00, 0x02, 0x8f, 0x01, 0x03, 0x11, 0x2a, 0x09, 0x17, 0x81, 0x01, 0x02, 0x36, 0x17, 0x02,
+    0x86, 0x01, 0x02, 0x02, 0x01, 0x02, 0x84, 0x01, 0x00, 0x12, 0x81, 0x09, 0x01, 0x73, 0x44, 0x9d,
+    0x00, 0x98, 0x00, 0x02, 0xff, 0x73, 0x8d, 0x1b, 0x0d, 0x81, 0x09, 0x07, 0x1c, 0x36, 0x0d, 0x75,
+    0x12, 0x02, 0x01, 0x02, 0x87, 0x01, 0x01, 0x02, 0x01, 0x81, 0x02, 0x00, 0x01, 0x81, 0x02, 0x81,
+    0x01, 0x01, 0x33, 0x02, 0x83, 0x01, 0x02, 0x33, 0x01, 0x02, 0x81, 0x01, 0x00, 0x02, 0x8d, 0x01,
+    0x00, 0x02, 0x81, 0x01, 0x00, 0x02, 0x81, 0x01, 0x02, 0x02, 0x01, 0x02, 0x81, 0x01, 0x00, 0x02,
+    0x87, 0x01, 0x08, 0x12, 0x38, 0x09, 0x38, 0x01, 0x26, 0x20, 0x11, 0x02, 0x81, 0x01, 0x01, 0x02,
+    0x01, 0x81, 0x02, 0x88, 0x01, 0x82, 0x09, 0x00, 0x6c, 0x9e, 0x00, 0x98, 0x00, 0x02, 0xff, 0x29,
+    0x87, 0x09, 0x1f, 0x83, 0x09, 0x02, 0x2a, 0x20, 0x11, 0x85, 0x01, 0x00, 0x02, 0x86, 0x01, 0x00,
+    0x02, 0x81, 0x01, 0x81, 0x02, 0x01, 0x01, 0x0d, 0x83, 0x01, 0x04, 0x02, 0x0d, 0x02, 0x01, 0x02,
+    0x86, 0x01, 0x81, 0x02, 0x8d, 0x01, 0x00, 0x02, 0x81, 0x01, 0x00, 0x02, 0x82, 0x01, 0x81, 0x02,
+    0x82, 0x01, 0x05, 0x02, 0x09, 0x0d, 0x1b, 0xa3, 0x1c, 0x81, 0x0d, 0x84, 0x01, 0x04, 0x02, 0x01,
+    0x02, 0x01, 0x02, 0x81, 0x01, 0x04, 0x02, 0x01, 0x02, 0x01, 0x26, 0x82, 0x09, 0x00, 0xdc, 0x9e,
+    0x00, 0x97, 0x00, 0x03, 0xd9, 0x45, 0x09, 0x1a, 0x82, 0x09, 0x03, 0x1f, 0x75, 0x09, 0xf1, 0x92,
+    0x01, 0x01, 0x02, 0x1b, 0x83, 0x01, 0x01, 0x11, 0x12, 0x88, 0x01, 0x81, 0x02, 0x85, 0x01, 0x00,
+    0x02, 0x88, 0x01, 0x00, 0x02, 0x81, 0x01, 0x00, 0x02, 0x87, 0x01, 0x81, 0x09, 0x04, 0x38, 0xa3,
+    0x09, 0x38, 0x02, 0x84, 0x01, 0x02, 0x02, 0x01, 0x02, 0x87, 0x01, 0x81, 0x09, 0x03, 0x1f, 0x09,
+    0xff, 0x42, 0x49, 0x04, 0x9d, 0x00, 0x97, 0x00, 0x0b, 0xff, 0xa5, 0x12, 0x20, 0x1a, 0x09, 0x1a,
+    0x09, 0x1a, 0x09, 0x67, 0x09, 0x01, 0x02, 0x89, 0x01, 0x00, 0x02, 0x81, 0x01, 0x00, 0x02, 0x83,
+    0x01, 0x02, 0x11, 0x2d, 0x5b, 0x82, 0x01, 0x02, 0x09, 0x01, 0x02, 0x85, 0x01, 0x05, 0x02, 0x01,
+    0x02, 0x01, 0x02, 0x01, 0x81, 0x02, 0x00, 0x01, 0x81, 0x02, 0x82, 0x01, 0x00, 0x02, 0x81, 0x01,
+    0x00, 0x02, 0x86, 0x01, 0x00, 0x02, 0x84, 0x01, 0x00, 0x11, 0x81, 0x09, 0x03, 0x17, 0x38, 0x1b,
+    0x1c, 0x8f, 0x01, 0x00, 0x11, 0x82, 0x09, 0x02, 0x1a, 0xc5, 0x04, 0x9d, 0x00,
 };
-const tImage wink_hot = { winkHotCharacterImage, 160, 160,
-    16 };
 
+const PackedImage winkHotImage = { 160, 160, winkHotImagePalette, winkHotImageRows, winkHotImageData, 19163 };
+
+const CharacterPose winkHotPose = { &winkHotImage, NULL, 0 };
+
+#endif
@@ -1,8 +1,12 @@
 #include <Arduino.h>
 #include <TFT_eSPI.h>
-#include <math.h>
+#include <esp_timer.h>
+#include <sys/time.h>
 #include "../include/clock.hpp"
 #include "../include/time.hpp"
+#include "../include/ui/ui_framebuffer.hpp"
+#include "../include/ui/ui_blit.hpp"
+#include "../include/ui/ui_temperature.hpp"
 
 extern TFT_eSPI tft;
 
@@ -18,128 +22,425 @@ void initAnalogClock() {
     clockVisible = false;
 }
 
-// ===== 角度からX,Y座標を計算 =====
-void polarToCartesian(int centerX, int centerY, int radius, float angleDegrees, int* x, int* y) {
-    float angleRadians = (angleDegrees - 90) * PI / 180.0;  // 12時を0度とする
-    *x = centerX + (int)(radius * cos(angleRadians));
-    *y = centerY + (int)(radius * sin(angleRadians));
+// ===== 三角関数テーブル =====
+// 12時を0として時計回りに6度刻み（60分割）のsin値、Q14固定小数点。cosは15目盛り先のsin
+#define CLOCK_TRIG_SHIFT 14
+static const int16_t clockSin[60] = {
+         0,   1713,   3406,   5063,   6664,   8192,   9630,  10963,  12176,  13255,
+     14189,  14968,  15582,  16026,  16294,  16384,  16294,  16026,  15582,  14968,
+     14189,  13255,  12176,  10963,   9630,   8192,   6664,   5063,   3406,   1713,
+         0,  -1713,  -3406,  -5063,  -6664,  -8192,  -9630, -10963, -12176, -13255,
+    -14189, -14968, -15582, -16026, -16294, -16384, -16294, -16026, -15582, -14968,
+    -14189, -13255, -12176, -10963,  -9630,  -8192,  -6664,  -5063,  -3406,  -1713,
+};
+
+// ===== 目盛り位置からX,Y座標を計算 =====
+static void clockPoint(int centerX, int centerY, int radius, int index, int* x, int* y) {
+    const int round = 1 << (CLOCK_TRIG_SHIFT - 1);
+    index %= 60;
+    *x = centerX + ((radius * clockSin[index] + round) >> CLOCK_TRIG_SHIFT);
+    *y = centerY - ((radius * clockSin[(index + 15) % 60] + round) >> CLOCK_TRIG_SHIFT);
 }
 
 // ===== 時計の文字盤を描画 =====
-void drawClockFace() {
+// 描画先と中心座標を受け取り、画面にもキャッシュ用スプライトにも描けるようにする
+static void drawClockFace(TFT_eSPI& g, int centerX, int centerY) {
     // 文字盤の背景（不透明な円）を描画してキャラクター画像を隠す
-    uint16_t faceColor = tft.color565(40, 40, 40);  // 濃いグレー
-    tft.fillCircle(clockCenterX, clockCenterY, clockRadius - 2, faceColor);
+    uint16_t faceColor = g.color565(40, 40, 40);  // 濃いグレー
+    g.fillCircle(centerX, centerY, clockRadius - 2, faceColor);
     
     // 外枠の円（半透明感を出すため、少し薄めの白色を使用）
-    uint16_t frameColor = tft.color565(200, 200, 200);  // 薄い白
-    tft.drawCircle(clockCenterX, clockCenterY, clockRadius, frameColor);
-    tft.drawCircle(clockCenterX, clockCenterY, clockRadius - 1, frameColor);
+    uint16_t frameColor = g.color565(200, 200, 200);  // 薄い白
+    g.drawCircle(centerX, centerY, clockRadius, frameColor);
+    g.drawCircle(centerX, centerY, clockRadius - 1, frameColor);
     
-    // 12時間の目盛りを描画
-    for (int hour = 1; hour <= 12; hour++) {
-        float angle = hour * 30.0;  // 30度 × 時間
+    for (int tick = 0; tick < 60; tick++) {
         int outerX, outerY, innerX, innerY;
+        clockPoint(centerX, centerY, clockRadius - 3, tick, &outerX, &outerY);
         
-        // 外側の点
-        polarToCartesian(clockCenterX, clockCenterY, clockRadius - 3, angle, &outerX, &outerY);
-        // 内側の点
-        polarToCartesian(clockCenterX, clockCenterY, clockRadius - 12, angle, &innerX, &innerY);
-        
-        // 時間の目盛り線（太め）
-        tft.drawLine(outerX, outerY, innerX, innerY, TFT_WHITE);
-        tft.drawLine(outerX + 1, outerY, innerX + 1, innerY, TFT_WHITE);
+        if (tick % 5 == 0) {
+            // 時間の目盛り線（太め）
+            clockPoint(centerX, centerY, clockRadius - 12, tick, &innerX, &innerY);
+            g.drawLine(outerX, outerY, innerX, innerY, TFT_WHITE);
+            g.drawLine(outerX + 1, outerY, innerX + 1, innerY, TFT_WHITE);
+        } else {
+            // 5分刻み以外の細かい目盛り
+            clockPoint(centerX, centerY, clockRadius - 8, tick, &innerX, &innerY);
+            g.drawLine(outerX, outerY, innerX, innerY, TFT_LIGHTGREY);
+        }
     }
     
-    // 5分刻みの細かい目盛り
-    for (int minute = 1; minute <= 60; minute++) {
-        if (minute % 5 != 0) {  // 5分刻み以外
-            float angle = minute * 6.0;  // 6度 × 分
-            int outerX, outerY, innerX, innerY;
+    // 中央の点（背景と調和するため輪郭を薄く）
+    g.fillCircle(centerX, centerY, 4, TFT_WHITE);
+    g.drawCircle(centerX, centerY, 4, frameColor);
+}
+
+// ===== 文字盤キャッシュ =====
+// 文字盤（四隅の背景グラデーションを含む正方形）をスプライトに描いておき、
+// 全体描画や針の消去はここから画素をコピーする。
+// 四隅の色はグラデーションの上下端の色だけで決まるので、温度そのものではなく
+// その6色で照合する（センサーの揺らぎでは作り直さない）
+static TFT_eSprite faceSprite(&tft);
+static uint16_t* facePixels = NULL;
+static int faceOriginX = 0, faceOriginY = 0, faceSize = 0;
+static uint8_t faceEndpointColors[6];
+static bool faceValid = false;
+
+static void getBackgroundEndpointColors(uint8_t c[6]) {
+    getTemperatureColors(getCurrentBackgroundTemp(), &c[0], &c[1], &c[2], &c[3], &c[4], &c[5]);
+}
+
+static bool isFaceCacheCurrent() {
+    uint8_t c[6];
+    getBackgroundEndpointColors(c);
+    return faceValid &&
+           memcmp(faceEndpointColors, c, sizeof(c)) == 0 &&
+           faceSize == clockRadius * 2 + 3 &&
+           faceOriginX == clockCenterX - clockRadius - 1 &&
+           faceOriginY == clockCenterY - clockRadius - 1;
+}
+
+static bool ensureFaceCache() {
+    if (isFaceCacheCurrent()) return true;
+    
+    int size = clockRadius * 2 + 3;
+    if (facePixels == NULL || faceSize != size) {
+        if (facePixels != NULL) faceSprite.deleteSprite();
+        faceSprite.setColorDepth(16);
+        faceSprite.setAttribute(PSRAM_ENABLE, true);
+        facePixels = (uint16_t*)faceSprite.createSprite(size, size);
+        if (facePixels == NULL) {
+            Serial.println("時計の文字盤キャッシュを確保できません（毎回直接描画します）");
+            faceValid = false;
+            return false;
+        }
+    }
+    
+    faceSize = size;
+    faceOriginX = clockCenterX - clockRadius - 1;
+    faceOriginY = clockCenterY - clockRadius - 1;
+    getBackgroundEndpointColors(faceEndpointColors);
+    
+    // 四隅は画面と同じ背景グラデーション
+    const uint16_t* rowColors = getGradientRowTable(getCurrentBackgroundTemp());
+    for (int row = 0; row < size; row++) {
+        faceSprite.drawFastHLine(0, row, size, rowColors[constrain(faceOriginY + row, 0, 239)]);
+    }
+    drawClockFace(faceSprite, clockRadius + 1, clockRadius + 1);
+    
+    faceValid = true;
+    return true;
+}
+
+struct FaceRowContext {
+    int srcX, srcY;
+};
+
+static void faceRow(int row, uint16_t* out, int width, void* ctx) {
+    FaceRowContext* c = (FaceRowContext*)ctx;
+    memcpy(out, &facePixels[(c->srcY + row) * faceSize + c->srcX], width * sizeof(uint16_t));
+}
+
+// 画面上の矩形（右下は含まない）を文字盤キャッシュから復元する
+static void restoreFace(int x0, int y0, int x1, int y1) {
+    x0 = max(x0, faceOriginX);
+    y0 = max(y0, faceOriginY);
+    x1 = min(x1, faceOriginX + faceSize);
+    y1 = min(y1, faceOriginY + faceSize);
+    if (x1 <= x0 || y1 <= y0) return;
+    
+    FaceRowContext ctx = { x0 - faceOriginX, y0 - faceOriginY };
+    blitRows(x0, y0, x1 - x0, y1 - y0, faceRow, &ctx);
+}
+
+// ===== 針 =====
+enum ClockHand { HAND_HOUR, HAND_MINUTE, HAND_SECOND, HAND_COUNT };
+
+struct HandRect {
+    int16_t x0, y0, x1, y1;  // 右下は含まない
+};
+
+static HandRect lastHandRects[HAND_COUNT];
+static int lastHandIndex[HAND_COUNT] = { -1, -1, -1 };
+
+// 針の占める矩形（太さ分と中央の点を含む）
+static HandRect handFootprint(int tipX, int tipY, int thickness) {
+    HandRect r;
+    r.x0 = min(clockCenterX, tipX) - 4;
+    r.y0 = min(clockCenterY, tipY) - 4;
+    r.x1 = max(clockCenterX, tipX) + thickness + 4;
+    r.y1 = max(clockCenterY, tipY) + thickness + 4;
+    return r;
+}
+
+static HandRect drawHand(ClockHand hand, int index) {
+    TFT_eSPI& canvas = uiCanvas();
+    int handX, handY;
+    
+    switch (hand) {
+        case HAND_HOUR:
+            // 時針を描画（太い線）
+            clockPoint(clockCenterX, clockCenterY, clockRadius - 25, index, &handX, &handY);
+            canvas.drawLine(clockCenterX, clockCenterY, handX, handY, TFT_WHITE);
+            canvas.drawLine(clockCenterX + 1, clockCenterY, handX + 1, handY, TFT_WHITE);
+            canvas.drawLine(clockCenterX, clockCenterY + 1, handX, handY + 1, TFT_WHITE);
+            canvas.drawLine(clockCenterX + 1, clockCenterY + 1, handX + 1, handY + 1, TFT_WHITE);
+            return handFootprint(handX, handY, 1);
             
-            polarToCartesian(clockCenterX, clockCenterY, clockRadius - 3, angle, &outerX, &outerY);
-            polarToCartesian(clockCenterX, clockCenterY, clockRadius - 8, angle, &innerX, &innerY);
+        case HAND_MINUTE:
+            clockPoint(clockCenterX, clockCenterY, clockRadius - 15, index, &handX, &handY);
+            canvas.drawLine(clockCenterX, clockCenterY, handX, handY, TFT_YELLOW);
+            canvas.drawLine(clockCenterX + 1, clockCenterY, handX + 1, handY, TFT_YELLOW);
+            return handFootprint(handX, handY, 1);
             
-            tft.drawLine(outerX, outerY, innerX, innerY, TFT_LIGHTGREY);
+        default:
+            // 秒針を描画（細い線、赤色）
+            clockPoint(clockCenterX, clockCenterY, clockRadius - 10, index, &handX, &handY);
+            canvas.drawLine(clockCenterX, clockCenterY, handX, handY, TFT_RED);
+            return handFootprint(handX, handY, 0);
+    }
+}
+
+// 全ての針と中央の点を描き、変化した針の範囲を差分として登録する
+static void drawHands(const int* indices, const bool* changed) {
+    TFT_eSPI& canvas = uiCanvas();
+    
+    // 針を描画（重なる順序に注意：時針が一番下、秒針が一番上）
+    for (int hand = 0; hand < HAND_COUNT; hand++) {
+        HandRect r = drawHand((ClockHand)hand, indices[hand]);
+        if (changed[hand]) {
+            markDirty(r.x0, r.y0, r.x1 - r.x0, r.y1 - r.y0);
         }
+        lastHandRects[hand] = r;
+        lastHandIndex[hand] = indices[hand];
     }
     
-    // 中央の点（背景と調和するため輪郭を薄く）
-    tft.fillCircle(clockCenterX, clockCenterY, 4, TFT_WHITE);
-    tft.drawCircle(clockCenterX, clockCenterY, 4, frameColor);
+    // 中央の点を再描画（針の上に）
+    canvas.fillCircle(clockCenterX, clockCenterY, 3, TFT_WHITE);
 }
 
-// ===== 時針を描画 =====
-void drawHourHand(int hour, int minute) {
-    // 時針の角度計算 (12時間表示、分も考慮)
-    float hourAngle = (hour % 12) * 30.0 + (minute * 0.5);
-    int handX, handY;
+static void currentHandIndices(int* indices, int* hour, int* minute, int* second) {
+    if (!getCurrentClockTime(hour, minute, second)) {
+        // タイムアウト等でデフォルト時刻の場合
+        *hour = 12;
+        *minute = 0;
+        *second = 0;
+    }
+    indices[HAND_HOUR] = (*hour % 12) * 5 + *minute / 12;  // 12分ごとに1目盛り進む
+    indices[HAND_MINUTE] = *minute;
+    indices[HAND_SECOND] = *second;
+}
+
+// ===== スムーズスイープ時計 =====
+// 秒針が連続して回る30fps表示。esp_timerのマイクロ秒時刻から針の角度を求め、
+// 文字盤キャッシュをコピーしたスプライトにアンチエイリアスの針を描いてDMA転送する。
+// ループが遅れてフレーム間隔が予算を超え続けた場合は1秒ごとの更新に落とす
+#define SWEEP_FRAME_US 33333LL          // 30fps
+#define SWEEP_LATE_LIMIT 8              // 連続してこの回数遅れたら1Hz表示に切り替え
+#define SWEEP_RECOVER_US 5000000LL      // 1Hz表示から30fpsへの復帰を試すまでの時間
+#define SWEEP_RESYNC_US 10000000LL      // 壁時計との再同期間隔
+#define SWEEP_DAY_US 86400000000LL
+
+static ClockStyle clockStyle = CLOCK_STYLE_TICK;
+static TFT_eSprite sweepSprite(&tft);
+static uint16_t* sweepPixels = NULL;
+static int64_t sweepBaseUs = 0;          // 0時0分0秒に対応するesp_timer時刻
+static int64_t sweepLastSyncUs = 0;
+static bool sweepSynced = false;
+static int64_t lastSweepFrameUs = 0;
+static int64_t lastSweepSecond = -1;
+static int lateSweepFrames = 0;
+static bool sweepDegraded = false;
+static int64_t sweepDegradedSinceUs = 0;
+static uint32_t lastSweepRenderUs = 0;
+static uint32_t sweepFrameCount = 0;
+static int64_t sweepFpsWindowUs = 0;
+static float sweepFps = 0.0;
+
+// 壁時計（マイクロ秒まで）とesp_timerの対応を取り直す
+static void syncSweepTime(int64_t nowUs) {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    struct tm timeinfo;
+    localtime_r(&tv.tv_sec, &timeinfo);
     
-    polarToCartesian(clockCenterX, clockCenterY, clockRadius - 25, hourAngle, &handX, &handY);
+    int64_t secondsOfDay = timeinfo.tm_hour * 3600 + timeinfo.tm_min * 60 + timeinfo.tm_sec;
+    sweepBaseUs = nowUs - secondsOfDay * 1000000LL - tv.tv_usec;
+    sweepLastSyncUs = nowUs;
+    sweepSynced = true;
+}
+
+static bool ensureSweepSprite() {
+    if (!ensureFaceCache()) return false;
+    if (sweepPixels != NULL && sweepSprite.width() == faceSize) return true;
     
-    // 時針を描画（太い線）
-    tft.drawLine(clockCenterX, clockCenterY, handX, handY, TFT_WHITE);
-    tft.drawLine(clockCenterX + 1, clockCenterY, handX + 1, handY, TFT_WHITE);
-    tft.drawLine(clockCenterX, clockCenterY + 1, handX, handY + 1, TFT_WHITE);
-    tft.drawLine(clockCenterX + 1, clockCenterY + 1, handX + 1, handY + 1, TFT_WHITE);
+    if (sweepPixels != NULL) sweepSprite.deleteSprite();
+    sweepSprite.setColorDepth(16);
+    sweepSprite.setAttribute(PSRAM_ENABLE, true);
+    sweepPixels = (uint16_t*)sweepSprite.createSprite(faceSize, faceSize);
+    if (sweepPixels == NULL) {
+        Serial.println("スイープ時計のスプライトを確保できません（1秒更新で表示します）");
+        return false;
+    }
+    return true;
 }
 
-// ===== 分針を描画 =====
-void drawMinuteHand(int minute) {
-    float minuteAngle = minute * 6.0;  // 6度 × 分
-    int handX, handY;
+static void sweepRow(int row, uint16_t* out, int width, void* ctx) {
+    memcpy(out, &sweepPixels[row * faceSize], width * sizeof(uint16_t));
+}
+
+// 針の角度（12時を0とするラジアン）から先端座標を求めて描く
+static void drawSweepHand(float center, float angle, int length, float baseWidth, float tipWidth, uint16_t color) {
+    float tipX = center + length * sinf(angle);
+    float tipY = center - length * cosf(angle);
+    sweepSprite.drawWedgeLine(center, center, tipX, tipY, baseWidth, tipWidth, color);
+}
+
+static void renderSweepFrame(int64_t dayUs) {
+    int64_t startUs = esp_timer_get_time();
     
-    polarToCartesian(clockCenterX, clockCenterY, clockRadius - 15, minuteAngle, &handX, &handY);
+    // 文字盤をコピーしてから針を描く（背景はスプライト上の画素とブレンドされる）
+    memcpy(sweepPixels, facePixels, faceSize * faceSize * sizeof(uint16_t));
     
-    // 分針を描画
-    tft.drawLine(clockCenterX, clockCenterY, handX, handY, TFT_YELLOW);
-    tft.drawLine(clockCenterX + 1, clockCenterY, handX + 1, handY, TFT_YELLOW);
+    const float twoPi = 2.0f * PI;
+    float secondAngle = (float)(dayUs % 60000000LL) / 60000000.0f * twoPi;
+    float minuteAngle = (float)(dayUs % 3600000000LL) / 3600000000.0f * twoPi;
+    float hourAngle = (float)(dayUs % 43200000000LL) / 43200000000.0f * twoPi;
+    float center = clockRadius + 1;
+    
+    drawSweepHand(center, hourAngle, clockRadius - 25, 3.0f, 1.5f, TFT_WHITE);
+    drawSweepHand(center, minuteAngle, clockRadius - 15, 2.5f, 1.0f, TFT_YELLOW);
+    drawSweepHand(center, secondAngle, clockRadius - 10, 1.0f, 0.5f, TFT_RED);
+    sweepSprite.fillSmoothCircle(clockRadius + 1, clockRadius + 1, 3, TFT_WHITE);
+    
+    blitRows(faceOriginX, faceOriginY, faceSize, faceSize, sweepRow, NULL);
+    
+    lastSweepRenderUs = (uint32_t)(esp_timer_get_time() - startUs);
+    sweepFrameCount++;
 }
 
-// ===== 秒針を描画 =====
-void drawSecondHand(int second) {
-    float secondAngle = second * 6.0;  // 6度 × 秒
-    int handX, handY;
+static int64_t sweepDayUs(int64_t nowUs) {
+    if (!sweepSynced || nowUs - sweepLastSyncUs >= SWEEP_RESYNC_US) {
+        syncSweepTime(nowUs);
+    }
+    int64_t dayUs = (nowUs - sweepBaseUs) % SWEEP_DAY_US;
+    return dayUs < 0 ? dayUs + SWEEP_DAY_US : dayUs;
+}
+
+static void updateSweepFps(int64_t nowUs) {
+    if (sweepFpsWindowUs == 0) {
+        sweepFpsWindowUs = nowUs;
+        sweepFrameCount = 0;
+        return;
+    }
+    if (nowUs - sweepFpsWindowUs >= 1000000LL) {
+        sweepFps = sweepFrameCount * 1000000.0f / (float)(nowUs - sweepFpsWindowUs);
+        sweepFpsWindowUs = nowUs;
+        sweepFrameCount = 0;
+    }
+}
+
+// 1フレーム描画（全体描画時にも使用）。スプライトが使えなければfalse
+static bool drawSweepClock(int64_t nowUs) {
+    if (!ensureSweepSprite()) return false;
     
-    polarToCartesian(clockCenterX, clockCenterY, clockRadius - 10, secondAngle, &handX, &handY);
+    int64_t dayUs = sweepDayUs(nowUs);
+    if (sweepDegraded) {
+        dayUs -= dayUs % 1000000LL;  // 1Hz表示中は秒単位で止める
+    }
+    renderSweepFrame(dayUs);
+    lastSweepFrameUs = nowUs;
+    lastSweepSecond = dayUs / 1000000LL;
+    return true;
+}
+
+void updateSmoothClock() {
+    if (!clockVisible || clockStyle != CLOCK_STYLE_SWEEP) return;
     
-    // 秒針を描画（細い線、赤色）
-    tft.drawLine(clockCenterX, clockCenterY, handX, handY, TFT_RED);
+    int64_t nowUs = esp_timer_get_time();
+    updateSweepFps(nowUs);
+    
+    if (sweepDegraded) {
+        // 1Hz表示：秒が変わった時だけ描画
+        if (sweepDayUs(nowUs) / 1000000LL == lastSweepSecond) return;
+        
+        // 一定時間経過し、描画自体が予算内なら30fpsへの復帰を試す
+        if (nowUs - sweepDegradedSinceUs >= SWEEP_RECOVER_US && lastSweepRenderUs < SWEEP_FRAME_US / 2) {
+            sweepDegraded = false;
+            lateSweepFrames = 0;
+            Serial.println("スイープ時計: 30fps表示に復帰");
+        }
+    } else {
+        int64_t elapsed = nowUs - lastSweepFrameUs;
+        if (elapsed < SWEEP_FRAME_US) return;
+        
+        // フレーム間隔が予算の1.5倍を超えたら遅れとして数える
+        if (elapsed > SWEEP_FRAME_US * 3 / 2 || lastSweepRenderUs > SWEEP_FRAME_US) {
+            lateSweepFrames++;
+        } else {
+            lateSweepFrames = 0;
+        }
+        
+        if (lateSweepFrames >= SWEEP_LATE_LIMIT) {
+            sweepDegraded = true;
+            sweepDegradedSinceUs = nowUs;
+            Serial.print("スイープ時計: フレーム予算超過のため1Hz表示に切り替え (描画 ");
+            Serial.print(lastSweepRenderUs);
+            Serial.println(" us)");
+        }
+    }
+    
+    if (!drawSweepClock(nowUs)) {
+        // スプライトが確保できない場合は通常の差分更新で代用
+        updateAnalogClock();
+    }
+}
+
+float getSmoothClockFps() {
+    return sweepFps;
+}
+
+bool isSmoothClockDegraded() {
+    return sweepDegraded;
+}
+
+void setClockStyle(ClockStyle style) {
+    if (clockStyle == style) return;
+    clockStyle = style;
+    lastHandIndex[HAND_SECOND] = -1;  // 画面上の針の位置が変わるので差分更新をやめて全体描画から
+    lateSweepFrames = 0;
+    sweepDegraded = false;
+    sweepFpsWindowUs = 0;
+    sweepFps = 0.0;
+}
+
+ClockStyle getClockStyle() {
+    return clockStyle;
 }
 
 // ===== アナログ時計全体を描画 =====
 void drawAnalogClock() {
     if (!clockVisible) return;
     
-    // 現在時刻を取得
-    String timeStr = getCurrentTimeString();
+    // スムーズスイープ表示中は現在時刻の1フレームを描く
+    if (clockStyle == CLOCK_STYLE_SWEEP && drawSweepClock(esp_timer_get_time())) return;
+    
+    TFT_eSPI& canvas = uiCanvas();
+    int indices[HAND_COUNT];
+    int hour, minute, second;
+    currentHandIndices(indices, &hour, &minute, &second);
     
-    // 時刻解析
-    int hour = 0, minute = 0, second = 0;
-    if (timeStr.length() >= 19) {  // "2024-06-29 14:30:25" 形式
-        hour = timeStr.substring(11, 13).toInt();
-        minute = timeStr.substring(14, 16).toInt();
-        second = timeStr.substring(17, 19).toInt();
+    // 文字盤を描画（キャッシュがあれば画素コピー）
+    if (ensureFaceCache()) {
+        restoreFace(faceOriginX, faceOriginY, faceOriginX + faceSize, faceOriginY + faceSize);
     } else {
-        // タイムアウト等でデフォルト時刻の場合
-        hour = 12;
-        minute = 0;
-        second = 0;
+        drawClockFace(canvas, clockCenterX, clockCenterY);
+        markDirty(clockCenterX - clockRadius - 1, clockCenterY - clockRadius - 1,
+                  clockRadius * 2 + 3, clockRadius * 2 + 3);
     }
     
-    // 背景をクリアしない（透明背景）
-    // tft.fillCircle(clockCenterX, clockCenterY, clockRadius + 5, TFT_BLACK);
-    
-    // 文字盤を描画
-    drawClockFace();
-    
-    // 針を描画（重なる順序に注意）
-    drawHourHand(hour, minute);   // 時針（一番下）
-    drawMinuteHand(minute);       // 分針（中間）
-    drawSecondHand(second);       // 秒針（一番上）
-    
-    // 中央の点を再描画（針の上に）
-    tft.fillCircle(clockCenterX, clockCenterY, 3, TFT_WHITE);
+    bool changed[HAND_COUNT] = { true, true, true };
+    drawHands(indices, changed);
     
     // デバッグ情報
     Serial.print("アナログ時計更新: ");
@@ -150,11 +451,49 @@ void drawAnalogClock() {
     Serial.println(second);
 }
 
+// ===== 1秒ごとの差分更新 =====
+// 動いた針の旧位置だけを文字盤キャッシュから消し、針を描き直す
+void updateAnalogClock() {
+    if (!clockVisible) return;
+    
+    // 背景温度や位置が変わってキャッシュが古い場合は全体描画
+    if (!isFaceCacheCurrent() || lastHandIndex[HAND_SECOND] < 0) {
+        drawAnalogClock();
+        return;
+    }
+    
+    int indices[HAND_COUNT];
+    int hour, minute, second;
+    currentHandIndices(indices, &hour, &minute, &second);
+    
+    bool changed[HAND_COUNT];
+    bool anyChanged = false;
+    for (int hand = 0; hand < HAND_COUNT; hand++) {
+        changed[hand] = (indices[hand] != lastHandIndex[hand]);
+        anyChanged |= changed[hand];
+    }
+    if (!anyChanged) return;
+    
+    for (int hand = 0; hand < HAND_COUNT; hand++) {
+        if (changed[hand]) {
+            const HandRect& r = lastHandRects[hand];
+            restoreFace(r.x0, r.y0, r.x1, r.y1);
+        }
+    }
+    
+    // 消去範囲に掛かった他の針も含めて描き直す（描画済みの画素と同じなので転送は変化分のみ）
+    drawHands(indices, changed);
+}
+
 // ===== 時計エリアをクリア =====
 void clearClockArea() {
+    TFT_eSPI& canvas = uiCanvas();
+    
     // キャラクター描画エリアと同じ領域をクリア
-    tft.fillRect(clockCenterX - clockRadius - 5, clockCenterY - clockRadius - 5, 
+    canvas.fillRect(clockCenterX - clockRadius - 5, clockCenterY - clockRadius - 5, 
                  (clockRadius + 5) * 2, (clockRadius + 5) * 2, TFT_BLACK);
+    markDirty(clockCenterX - clockRadius - 5, clockCenterY - clockRadius - 5,
+              (clockRadius + 5) * 2, (clockRadius + 5) * 2);
 }
 
 // ===== 時計の位置設定 =====
@@ -175,6 +514,9 @@ bool isClockVisible() {
 
 void setClockVisible(bool visible) {
     clockVisible = visible;
+    if (!visible) {
+        lastHandIndex[HAND_SECOND] = -1;  // 再表示時は全体描画から始める
+    }
     Serial.print("アナログ時計表示状態: ");
     Serial.println(visible ? "ON" : "OFF");
 }
\ No newline at end of file
@@ -0,0 +1,61 @@
+#include <Arduino.h>
+#include "history.hpp"
+#include "temperature.hpp"
+#include "speed.hpp"
+
+static HistorySample samples[HISTORY_SIZE];
+static uint32_t historyEnd = 0;   // 次に書き込む通し番号
+static portMUX_TYPE historyLock = portMUX_INITIALIZER_UNLOCKED;
+static unsigned long lastRecord = 0;
+
+static int16_t toCentiUnits(float value) {
+    return (int16_t)constrain(lroundf(value * 100.0f), INT16_MIN + 1, INT16_MAX);
+}
+
+void updateHistory() {
+    unsigned long now = millis();
+    if (now - lastRecord < HISTORY_INTERVAL) return;
+    lastRecord = now;
+    recordHistorySample();
+}
+
+void recordHistorySample() {
+    // ロック外で組み立て、書き込みだけを排他する
+    HistorySample sample;
+    sample.uptimeSec = millis() / 1000;
+    for (int i = 0; i < PROBE_COUNT; i++) {
+        TempProbe probe = (TempProbe)i;
+        sample.temperature[i] = isProbeValid(probe) ? toCentiUnits(getProbeTemperature(probe))
+                                                    : HISTORY_INVALID;
+    }
+    sample.speed = toCentiUnits(getCachedSpeed());  // /api/statusと同じ値（I2Cに触れない）
+
+    portENTER_CRITICAL(&historyLock);
+    samples[historyEnd % HISTORY_SIZE] = sample;
+    historyEnd++;
+    portEXIT_CRITICAL(&historyLock);
+}
+
+void clearHistory() {
+    portENTER_CRITICAL(&historyLock);
+    historyEnd = 0;
+    portEXIT_CRITICAL(&historyLock);
+}
+
+void getHistoryRange(uint32_t* first, uint32_t* end) {
+    portENTER_CRITICAL(&historyLock);
+    *end = historyEnd;
+    *first = (historyEnd > HISTORY_SIZE) ? historyEnd - HISTORY_SIZE : 0;
+    portEXIT_CRITICAL(&historyLock);
+}
+
+bool getHistorySample(uint32_t index, HistorySample* out) {
+    bool available;
+    portENTER_CRITICAL(&historyLock);
+    available = (index < historyEnd) && (historyEnd - index <= HISTORY_SIZE);
+    if (available) {
+        *out = samples[index % HISTORY_SIZE];
+    }
+    portEXIT_CRITICAL(&historyLock);
+    return available;
+}
\ No newline at end of file
@@ -0,0 +1,240 @@
+#include <Wire.h>
+#include <Adafruit_Sensor.h>
+#include <Adafruit_MPU6050.h>
+#include <MPU9250.h>
+#include "imu_driver.hpp"
+
+// 生値の感度（±8g / ±500dps 設定時）
+#define ACCEL_LSB_PER_G 4096.0
+#define GYRO_LSB_PER_DPS 65.5
+
+static Adafruit_MPU6050 mpu6050;
+static MPU9250 mpu9250;
+
+// 束縛済みの読み取り関数（検出後は分岐なしで呼び出す）
+typedef bool (*ImuReadFn)(ImuReading& r);
+static ImuReadFn boundRead = NULL;
+static ImuChip boundChip = IMU_NONE;
+
+// ===== レジスタ直接アクセス =====
+
+// WHO_AM_Iレジスタを直接読み取る関数
+uint8_t readWhoAmI(uint8_t address) {
+  Wire.beginTransmission(address);
+  Wire.write(0x75); // WHO_AM_Iレジスタのアドレス
+  if (Wire.endTransmission() != 0) {
+    return 0xFF; // エラー
+  }
+  
+  Wire.requestFrom((uint8_t)address, (uint8_t)1);
+  if (Wire.available()) {
+    return Wire.read();
+  }
+  return 0xFF;
+}
+
+bool imuWriteRegister(uint8_t reg, uint8_t value) {
+  Wire.beginTransmission(MPU_ADDR);
+  Wire.write(reg);
+  Wire.write(value);
+  return (Wire.endTransmission() == 0);
+}
+
+bool imuReadRegisters(uint8_t reg, uint8_t* buf, size_t len) {
+  Wire.beginTransmission(MPU_ADDR);
+  Wire.write(reg);
+  if (Wire.endTransmission(false) != 0) {
+    return false;
+  }
+  if (Wire.requestFrom((uint8_t)MPU_ADDR, (uint8_t)len) != len) {
+    return false;
+  }
+  for (size_t i = 0; i < len; i++) {
+    buf[i] = Wire.read();
+  }
+  return true;
+}
+
+// ===== MPU6050（Adafruitライブラリ） =====
+
+const char* ImuDriver<IMU_MPU6050>::name() {
+  return "MPU6050";
+}
+
+bool ImuDriver<IMU_MPU6050>::begin() {
+  Serial.println("Attempting standard MPU6050 initialization...");
+  if (!mpu6050.begin(MPU_ADDR, &Wire)) {
+    return false;
+  }
+  
+  // センサー設定
+  mpu6050.setAccelerometerRange(MPU6050_RANGE_8_G);
+  mpu6050.setGyroRange(MPU6050_RANGE_500_DEG);
+  mpu6050.setFilterBandwidth(MPU6050_BAND_21_HZ);
+  return true;
+}
+
+bool ImuDriver<IMU_MPU6050>::read(ImuReading& r) {
+  sensors_event_t a, g, temp;
+  if (!mpu6050.getEvent(&a, &g, &temp)) {
+    return false;
+  }
+  
+  // ライブラリはm/s²・rad/sで返すため、g・dpsに揃える
+  r.ax = a.acceleration.x / 9.80665;
+  r.ay = a.acceleration.y / 9.80665;
+  r.az = a.acceleration.z / 9.80665;
+  r.gx = g.gyro.x * 57.29578;
+  r.gy = g.gyro.y * 57.29578;
+  r.gz = g.gyro.z * 57.29578;
+  return true;
+}
+
+// ===== MPU6500（レジスタ直接アクセス） =====
+
+const char* ImuDriver<IMU_MPU6500>::name() {
+  return "MPU6500";
+}
+
+// MPU6500用の手動初期化
+bool ImuDriver<IMU_MPU6500>::begin() {
+  Serial.println("Attempting MPU6500 manual initialization...");
+  
+  imuWriteRegister(0x6B, 0x80); // PWR_MGMT_1: デバイスリセット
+  delay(100);
+  imuWriteRegister(0x6B, 0x00); // PWR_MGMT_1: スリープ解除、内部クロック使用
+  delay(100);
+  
+  imuWriteRegister(0x1C, 0x10); // ACCEL_CONFIG: ±8g range
+  imuWriteRegister(0x1B, 0x08); // GYRO_CONFIG: ±500度/秒 range
+  imuWriteRegister(0x1A, 0x03); // CONFIG: DLPF_CFG = 3 (44Hz)
+  
+  delay(100);
+  
+  // WHO_AM_Iレジスタで確認
+  uint8_t whoAmI = readWhoAmI(MPU_ADDR);
+  Serial.print("After manual init, WHO_AM_I: 0x");
+  Serial.println(whoAmI, HEX);
+  
+  return (whoAmI == 0x70);
+}
+
+// 加速度・温度・ジャイロを1回の転送で読み取る（ACCEL_XOUT_H〜GYRO_ZOUT_L）
+bool ImuDriver<IMU_MPU6500>::read(ImuReading& r) {
+  uint8_t buf[14];
+  if (!imuReadRegisters(0x3B, buf, sizeof(buf))) {
+    return false;
+  }
+  
+  r.ax = (int16_t)((buf[0] << 8) | buf[1]) / ACCEL_LSB_PER_G;
+  r.ay = (int16_t)((buf[2] << 8) | buf[3]) / ACCEL_LSB_PER_G;
+  r.az = (int16_t)((buf[4] << 8) | buf[5]) / ACCEL_LSB_PER_G;
+  // buf[6..7]は温度（未使用）
+  r.gx = (int16_t)((buf[8] << 8) | buf[9]) / GYRO_LSB_PER_DPS;
+  r.gy = (int16_t)((buf[10] << 8) | buf[11]) / GYRO_LSB_PER_DPS;
+  r.gz = (int16_t)((buf[12] << 8) | buf[13]) / GYRO_LSB_PER_DPS;
+  return true;
+}
+
+// ===== MPU9250（hideakitaiライブラリ） =====
+
+const char* ImuDriver<IMU_MPU9250>::name() {
+  return "MPU9250";
+}
+
+bool ImuDriver<IMU_MPU9250>::begin() {
+  Serial.println("Attempting MPU9250 initialization...");
+  
+  // 他チップと同じレンジに揃える（FIFO生値の換算を共通化するため）
+  MPU9250Setting setting;
+  setting.accel_fs_sel = ACCEL_FS_SEL::A8G;
+  setting.gyro_fs_sel = GYRO_FS_SEL::G500DPS;
+  setting.fifo_sample_rate = FIFO_SAMPLE_RATE::SMPL_1000HZ;
+  setting.gyro_dlpf_cfg = GYRO_DLPF_CFG::DLPF_41HZ;
+  setting.accel_dlpf_cfg = ACCEL_DLPF_CFG::DLPF_45HZ;
+  
+  return mpu9250.setup(MPU_ADDR, setting, Wire);
+}
+
+bool ImuDriver<IMU_MPU9250>::read(ImuReading& r) {
+  if (!mpu9250.update()) {
+    return false;
+  }
+  
+  r.ax = mpu9250.getAccX();
+  r.ay = mpu9250.getAccY();
+  r.az = mpu9250.getAccZ();
+  r.gx = mpu9250.getGyroX();
+  r.gy = mpu9250.getGyroY();
+  r.gz = mpu9250.getGyroZ();
+  return true;
+}
+
+// ===== 検出と束縛 =====
+
+ImuChip detectImuChip() {
+  uint8_t whoAmI = readWhoAmI(MPU_ADDR);
+  Serial.print("WHO_AM_I register: 0x");
+  Serial.println(whoAmI, HEX);
+  
+  switch (whoAmI) {
+    case 0x70:
+      return IMU_MPU6500;
+    case 0x71:  // MPU9250
+    case 0x73:  // MPU9255
+      return IMU_MPU9250;
+    case 0xFF:
+      return IMU_NONE;  // 応答なし
+    default:
+      return IMU_MPU6050;  // 0x68および互換品
+  }
+}
+
+// チップ型を関数ポインタに落とし込むヘルパー（特殊化ごとに実体化される）
+template <ImuChip CHIP>
+static bool bindDriver() {
+  if (!ImuDriver<CHIP>::begin()) {
+    return false;
+  }
+  boundRead = &ImuDriver<CHIP>::read;
+  boundChip = CHIP;
+  return true;
+}
+
+bool bindImuDriver(ImuChip chip) {
+  boundRead = NULL;
+  boundChip = IMU_NONE;
+  
+  switch (chip) {
+    case IMU_MPU6050:
+      return bindDriver<IMU_MPU6050>();
+    case IMU_MPU6500:
+      return bindDriver<IMU_MPU6500>();
+    case IMU_MPU9250:
+      return bindDriver<IMU_MPU9250>();
+    default:
+      return false;
+  }
+}
+
+bool readImu(ImuReading& r) {
+  if (boundRead == NULL) return false;
+  return boundRead(r);
+}
+
+ImuChip getImuChip() {
+  return boundChip;
+}
+
+const char* getImuChipName() {
+  switch (boundChip) {
+    case IMU_MPU6050:
+      return ImuDriver<IMU_MPU6050>::name();
+    case IMU_MPU6500:
+      return ImuDriver<IMU_MPU6500>::name();
+    case IMU_MPU9250:
+      return ImuDriver<IMU_MPU9250>::name();
+    default:
+      return "None";
+  }
+}
\ No newline at end of file
@@ -0,0 +1,163 @@
+#include <Arduino.h>
+#include <Preferences.h>
+#include <rom/crc.h>
+#include <time.h>
+#include "journal.hpp"
+
+#define JOURNAL_NVS_NAMESPACE "journal"
+#define JOURNAL_MAGIC 0x4A524E31  // "JRN1"（レコード形式を変えたら更新する）
+
+// 1レコード分（CRCはcrcより前の全フィールドに対して計算）
+struct JournalRecord {
+    uint32_t magic;
+    uint32_t sequence;     // 書き込みごとに+1（最大のものが最新）
+    int64_t epoch;         // 時刻（未設定なら0）
+    uint32_t odometer;     // 累計走行距離（m）
+    uint32_t trip;         // トリップ距離（m）
+    uint32_t crc;
+};
+
+static uint32_t journalSequence = 0;   // 最後に書いたレコードの通し番号
+static time_t restoredTime = 0;
+static double odometerMeters = 0.0;    // 1m未満の端数も積算する（floatでは長距離で桁落ちする）
+static double tripMeters = 0.0;
+static uint32_t savedOdometer = 0;     // 最後に書いた値（変化がなければ書かない）
+static uint32_t savedTrip = 0;
+static unsigned long lastCheckpoint = 0;
+static volatile bool checkpointRequested = false;
+static volatile bool tripResetRequested = false;
+
+static uint32_t recordCrc(const JournalRecord& record) {
+    return crc32_le(0, (const uint8_t*)&record, offsetof(JournalRecord, crc));
+}
+
+static void slotKey(uint32_t sequence, char* key) {
+    snprintf(key, 4, "s%u", (unsigned)(sequence % JOURNAL_SLOTS));
+}
+
+void initJournal() {
+    Preferences prefs;
+    prefs.begin(JOURNAL_NVS_NAMESPACE, true);
+    
+    // 全スロットから、CRCが正しく通し番号が最大のレコードを探す
+    JournalRecord newest;
+    bool found = false;
+    int validCount = 0;
+    for (uint32_t slot = 0; slot < JOURNAL_SLOTS; slot++) {
+        char key[4];
+        slotKey(slot, key);
+        JournalRecord record;
+        if (prefs.getBytesLength(key) != sizeof(record)) continue;
+        prefs.getBytes(key, &record, sizeof(record));
+        if (record.magic != JOURNAL_MAGIC || record.crc != recordCrc(record)) continue;
+        
+        validCount++;
+        if (!found || (int32_t)(record.sequence - newest.sequence) > 0) {
+            newest = record;
+            found = true;
+        }
+    }
+    prefs.end();
+    
+    if (!found) {
+        Serial.println("Journal: no valid record");
+        return;
+    }
+    
+    journalSequence = newest.sequence;
+    restoredTime = (time_t)newest.epoch;
+    odometerMeters = savedOdometer = newest.odometer;
+    tripMeters = savedTrip = newest.trip;
+    
+    Serial.print("Journal restored: seq ");
+    Serial.print(newest.sequence);
+    Serial.print(", odometer ");
+    Serial.print(newest.odometer);
+    Serial.print(" m, trip ");
+    Serial.print(newest.trip);
+    Serial.print(" m (");
+    Serial.print(validCount);
+    Serial.println(" valid slots)");
+}
+
+time_t getJournalTime() {
+    return restoredTime;
+}
+
+void checkpointJournal() {
+    time_t now;
+    time(&now);
+    bool timeValid = (now > 1700000000);
+    
+    JournalRecord record;
+    record.magic = JOURNAL_MAGIC;
+    record.sequence = journalSequence + 1;
+    record.epoch = timeValid ? now : 0;
+    record.odometer = (uint32_t)odometerMeters;
+    record.trip = (uint32_t)tripMeters;
+    record.crc = recordCrc(record);
+    
+    // 次のスロットに追記する（最新以外のスロットは残るので、書き込み中の電源断でも1つ前に戻れる）
+    char key[4];
+    slotKey(record.sequence, key);
+    Preferences prefs;
+    prefs.begin(JOURNAL_NVS_NAMESPACE, false);
+    size_t written = prefs.putBytes(key, &record, sizeof(record));
+    prefs.end();
+    
+    if (written != sizeof(record)) {
+        Serial.println("Journal write failed");
+        return;
+    }
+    journalSequence = record.sequence;
+    savedOdometer = record.odometer;
+    savedTrip = record.trip;
+    lastCheckpoint = millis();
+}
+
+void requestJournalCheckpoint() {
+    checkpointRequested = true;
+}
+
+void updateJournal() {
+    if (tripResetRequested) {
+        // 走行距離の積算と同じメインループで0に戻し、すぐに保存する
+        tripResetRequested = false;
+        tripMeters = 0.0;
+        checkpointRequested = true;
+    }
+    if (checkpointRequested) {
+        checkpointRequested = false;
+        checkpointJournal();
+        return;
+    }
+    if (millis() - lastCheckpoint < JOURNAL_INTERVAL) return;
+    lastCheckpoint = millis();
+    
+    // 時刻が未設定で走行距離も変わっていなければ書く内容がない
+    time_t now;
+    time(&now);
+    bool timeValid = (now > 1700000000);
+    bool distanceChanged = ((uint32_t)odometerMeters != savedOdometer || (uint32_t)tripMeters != savedTrip);
+    if (!timeValid && !distanceChanged) return;
+    
+    checkpointJournal();
+}
+
+void addTravelDistance(float meters) {
+    if (meters <= 0.0) return;
+    odometerMeters += meters;
+    tripMeters += meters;
+}
+
+uint32_t getOdometerMeters() {
+    return (uint32_t)odometerMeters;
+}
+
+uint32_t getTripMeters() {
+    return (uint32_t)tripMeters;
+}
+
+void resetTrip() {
+    tripResetRequested = true;
+}
\ No newline at end of file
@@ -0,0 +1,157 @@
+#include <Arduino.h>
+#include <math.h>
+#include "json_writer.hpp"
+
+static const uint32_t powersOf10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+#define JSON_MAX_DECIMALS 6
+
+static void put(JsonWriter& w, char c) {
+    if (w.length < w.capacity) {
+        w.out[w.length++] = c;
+    } else {
+        w.overflow = true;
+    }
+}
+
+static void putRaw(JsonWriter& w, const char* s) {
+    while (*s) put(w, *s++);
+}
+
+static void putUnsigned(JsonWriter& w, uint32_t value) {
+    char digits[10];
+    int n = 0;
+    do {
+        digits[n++] = '0' + value % 10;
+        value /= 10;
+    } while (value > 0);
+    while (n > 0) put(w, digits[--n]);
+}
+
+static void putQuoted(JsonWriter& w, const char* s) {
+    static const char hex[] = "0123456789abcdef";
+    put(w, '"');
+    for (; *s; s++) {
+        uint8_t c = (uint8_t)*s;
+        if (c == '"' || c == '\\') {
+            put(w, '\\');
+            put(w, c);
+        } else if (c == '\n') {
+            putRaw(w, "\\n");
+        } else if (c < 0x20) {
+            putRaw(w, "\\u00");
+            put(w, hex[c >> 4]);
+            put(w, hex[c & 0x0F]);
+        } else {
+            put(w, c);  // UTF-8はそのまま
+        }
+    }
+    put(w, '"');
+}
+
+// 値の前に必要なカンマを出す
+static void beginValue(JsonWriter& w) {
+    if (w.afterKey) {
+        w.afterKey = false;
+        return;
+    }
+    uint32_t bit = 1u << w.depth;
+    if (w.hasItems & bit) put(w, ',');
+    w.hasItems |= bit;
+}
+
+static void openContainer(JsonWriter& w, char c) {
+    beginValue(w);
+    put(w, c);
+    if (w.depth < JSON_MAX_DEPTH) w.depth++;
+    w.hasItems &= ~(1u << w.depth);
+}
+
+static void closeContainer(JsonWriter& w, char c) {
+    if (w.depth > 0) w.depth--;
+    put(w, c);
+}
+
+void jsonInit(JsonWriter& w) {
+    w.hasItems = 0;
+    w.depth = 0;
+    w.afterKey = false;
+    w.overflow = false;
+}
+
+void jsonSetOutput(JsonWriter& w, char* out, size_t capacity) {
+    w.out = out;
+    w.capacity = capacity;
+    w.length = 0;
+}
+
+void jsonBeginObject(JsonWriter& w) { openContainer(w, '{'); }
+void jsonEndObject(JsonWriter& w)   { closeContainer(w, '}'); }
+void jsonBeginArray(JsonWriter& w)  { openContainer(w, '['); }
+void jsonEndArray(JsonWriter& w)    { closeContainer(w, ']'); }
+
+void jsonKey(JsonWriter& w, const char* key) {
+    beginValue(w);
+    putQuoted(w, key);
+    put(w, ':');
+    w.afterKey = true;
+}
+
+void jsonString(JsonWriter& w, const char* value) {
+    beginValue(w);
+    putQuoted(w, value);
+}
+
+void jsonInt(JsonWriter& w, int32_t value) {
+    beginValue(w);
+    if (value < 0) {
+        put(w, '-');
+        putUnsigned(w, 0u - (uint32_t)value);
+    } else {
+        putUnsigned(w, (uint32_t)value);
+    }
+}
+
+void jsonUInt(JsonWriter& w, uint32_t value) {
+    beginValue(w);
+    putUnsigned(w, value);
+}
+
+void jsonFixed(JsonWriter& w, int32_t value, uint8_t decimals) {
+    if (decimals > JSON_MAX_DECIMALS) decimals = JSON_MAX_DECIMALS;
+    beginValue(w);
+    uint32_t magnitude = (uint32_t)value;
+    if (value < 0) {
+        put(w, '-');
+        magnitude = 0u - magnitude;
+    }
+    uint32_t divisor = powersOf10[decimals];
+    putUnsigned(w, magnitude / divisor);
+    if (decimals == 0) return;
+
+    // 小数部は先頭の0も含めて桁数分出す
+    put(w, '.');
+    uint32_t fraction = magnitude % divisor;
+    for (uint32_t digit = divisor / 10; digit > 0; digit /= 10) {
+        put(w, '0' + (fraction / digit) % 10);
+    }
+}
+
+void jsonFloat(JsonWriter& w, float value, uint8_t decimals) {
+    if (decimals > JSON_MAX_DECIMALS) decimals = JSON_MAX_DECIMALS;
+    float scaled = value * (float)powersOf10[decimals];
+    if (isnan(scaled) || fabsf(scaled) >= 2147483520.0f) {  // int32に収まらない値も含む
+        jsonNull(w);
+        return;
+    }
+    jsonFixed(w, (int32_t)lroundf(scaled), decimals);
+}
+
+void jsonBool(JsonWriter& w, bool value) {
+    beginValue(w);
+    putRaw(w, value ? "true" : "false");
+}
+
+void jsonNull(JsonWriter& w) {
+    beginValue(w);
+    putRaw(w, "null");
+}
\ No newline at end of file
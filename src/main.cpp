@@ -3,10 +3,22 @@
 #include "ui.hpp"
 #include "../include/temperature.hpp"
 #include "../include/speed.hpp"
+#include "../include/speed_estimator.hpp"
 #include "../include/time.hpp"
+#include "../include/journal.hpp"
 #include "webserver.hpp"
+#include "../include/telemetry.hpp"
+#include "../include/history.hpp"
+#include "../include/status_api.hpp"
 #include "../include/mode_manager.hpp"
 #include "../include/clock.hpp"
+#include "../include/ui/ui_temperature.hpp"
+#include "../include/ui/ui_state.hpp"
+#include "../include/ui/ui_framebuffer.hpp"
+#include "../include/ui/ui_widgets.hpp"
+#include "../include/ui/ui_character.hpp"
+#include "../include/ui/ui_animation.hpp"
+#include "../include/ui/ui_backlight.hpp"
 
 TFT_eSPI tft = TFT_eSPI();
 
@@ -29,38 +41,72 @@ unsigned long lastBackgroundUpdate = 0;
 // 温度連動背景色用の変数
 static float lastDisplayedBackgroundTemp = 20.0;
 
+// ===== 起動パイプライン =====
+// WiFi（Core 0）、IMU初期化（Core 0）、温度プローブ探索と初回変換（setup、Core 1）を並行して進め、
+// その間スプラッシュは専用タスクで動かす。各フェーズの経過時間をシリアルに出力する
+#define BOOT_SAMPLE_TIMEOUT 3000  // 初回サンプル待ちの上限（ms）
+
+static unsigned long bootStartTime = 0;
+static volatile bool wifiReady = false;
+static volatile bool imuBootDone = false;
+
+static void bootMark(const char* phase) {
+    Serial.print("[boot] +");
+    Serial.print(millis() - bootStartTime);
+    Serial.print(" ms ");
+    Serial.println(phase);
+}
+
+// IMU初期化タスク（I2C初期化とチップ判定の待ち時間をsetupから切り離す）
+static void ImuBootTaskCode(void* pvParameters) {
+    initSpeedSensor();
+    bootMark("IMU ready");
+    imuBootDone = true;
+    vTaskDelete(NULL);
+}
+
 // WiFi専用タスク（Core 0で実行）
 void WiFiTaskCode(void * pvParameters) {
     Serial.println("WiFi Task started on Core 0");
     
+    // Webサーバー初期化（WiFiスタック含む、AP安定化待ちはこのタスク内で行う）
+    initWebServer();
+    wifiReady = true;
+    bootMark("WiFi AP up");
+    
+    // リクエストはAsyncTCPのタスクがソケットイベントで処理するので、
+    // ここではポーリングせずに接続数の定期ログだけを行う
     for(;;) {
-        // Webサーバー処理
-        handleWebServerClient();
-        
-        // WiFi接続クライアント数を定期チェック
-        static unsigned long lastClientCheck = 0;
-        if (millis() - lastClientCheck > 10000) {  // 10秒ごと
-            int clients = getConnectedClientCount();
-            if (clients > 0) {
-                Serial.print("WiFi clients connected: ");
-                Serial.println(clients);
-            }
-            lastClientCheck = millis();
+        int clients = getConnectedClientCount();
+        if (clients > 0) {
+            Serial.print("WiFi clients connected: ");
+            Serial.println(clients);
         }
-        
-        vTaskDelay(1);  // 1ms待機（他タスクにCPU譲る）
+        vTaskDelay(pdMS_TO_TICKS(10000));  // 10秒ごと
     }
 }
 
 void setup() {
+    bootStartTime = millis();
     Serial.begin(115200);
-    delay(1000);
     Serial.println("=== Starting CarBuddy - Temperature Reactive Version with Title ===");
-
-    // Webサーバー初期化（WiFiスタック含む）
-    initWebServer();
     
-    // WiFi専用タスクをCore 0で起動
+    // TFT初期化（スプラッシュタスクより先に行う）
+    tft.init();
+    tft.setRotation(1);
+    initCharacterBlitter();  // DMAラインバッファ転送の準備
+    initFrameBuffer();       // PSRAMシャドウフレームバッファ
+    initBacklight();         // LEDC PWM（TFT_BL指定時、消灯から開始）
+    Serial.print("TFT size: ");
+    Serial.print(tft.width());
+    Serial.print(" x ");
+    Serial.println(tft.height());
+    bootMark("display ready");
+    
+    // スプラッシュ画面（専用タスクで表示し、ここでは待たない）
+    startSplashScreen();
+    
+    // WiFi専用タスクをCore 0で起動（AP立ち上げもタスク内で行う）
     xTaskCreatePinnedToCore(
         WiFiTaskCode,   // タスク関数
         "WiFiTask",     // タスク名
@@ -72,29 +118,49 @@ void setup() {
     );
     
     Serial.println("WiFi task created on Core 0");
-    delay(500);  // WiFiタスク起動待機
-
-    // TFT初期化
-    tft.init();
-    tft.setRotation(1);
-    Serial.print("TFT size: ");
-    Serial.print(tft.width());
-    Serial.print(" x ");
-    Serial.println(tft.height());
+    
+    // IMU初期化をCore 0で並行実行
+    xTaskCreatePinnedToCore(ImuBootTaskCode, "ImuBoot", 4096, NULL, 1, NULL, 0);
 
-    // 各種センサー初期化
+    // 温度プローブ探索と初回変換開始、その他の初期化（いずれも短時間）
     initTemperatureSensor();
-    initSpeedSensor();
+    bootMark("temperature probes");
+    initJournal();       // 時刻・走行距離の最新レコードを復元
     initTimeSystem();
     initModeManager();
+    
+    // 初回サンプルが揃うまで変換ステートマシンを回す（センサーがない場合は待たない）
+    unsigned long waitStart = millis();
+    while (millis() - waitStart < BOOT_SAMPLE_TIMEOUT) {
+        updateTemperatureSensor();
+        bool tempReady = (getProbeCount() == 0) || isProbeValid(PROBE_CABIN);
+        if (tempReady && imuBootDone) break;
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
+    bootMark(imuBootDone ? "first samples" : "first samples (IMU timeout)");
 
     Serial.println("=== Sensors initialized ===");
 
-    // スプラッシュ画面表示
-    showSplashScreen();
+    // スプラッシュを閉じてメイン画面へ
+    finishSplashScreen();
+    bootMark("splash done");
     
     // メイン画面初期化
     drawUI();
+    bootMark("first frame");
+    Serial.print("[boot] time to first frame: ");
+    Serial.print(millis() - bootStartTime);
+    Serial.print(" ms (WiFi ");
+    Serial.print(wifiReady ? "up" : "starting");
+    Serial.println(")");
+    
+#ifdef CARBUDDY_BENCHMARK
+    // 描画ベンチマーク（platformio.iniで-DCARBUDDY_BENCHMARK=1を指定した時のみ）
+    benchmarkGradientFill();
+    benchmarkCharacterAssets();
+    benchmarkStatusApi();
+    forceFullRedrawWithMode(getCurrentBackgroundTemp());
+#endif
     
     Serial.println("=== Setup completed - Starting main loop ===");
 }
@@ -106,6 +172,19 @@ void loop() {
     // === モード切り替え処理（最優先） ===
     updateModeManager();  // ロータリーエンコーダーの状態をチェック
     
+    // === 温度センサー変換処理（ノンブロッキング） ===
+    updateTemperatureSensor();
+    
+    // === スムーズ時計（30fps、フレーム間隔は内部で管理） ===
+    if (getCurrentMode() == MODE_SMOOTH_CLOCK) {
+        updateSmoothClock();
+    }
+    
+    // === キャラクターアニメーション（1ループの転送量は予算内に制限） ===
+    if (getCurrentMode() == MODE_CHARACTER) {
+        updateCharacterAnimation();
+    }
+    
     // === 温度更新 ===
     if (currentTime - lastTempUpdate >= TEMP_UPDATE_INTERVAL) {
         float currentTemp = getTemperature();
@@ -129,59 +208,8 @@ void loop() {
             Serial.print("°C → ");
             Serial.println(colorMode);
             
-            // === 背景とすべての要素を同期描画（モード考慮版） ===
-            
-            // 1. 現在値を事前に取得（タイムアウト設定済みで高速）
-            float currentSpeed = getSpeed();
-            String currentTimeStr = getCurrentTime();  // 50msタイムアウトで高速取得
-            String currentDateStr = getCurrentDate();  // 50msタイムアウトで高速取得
-            
-            // 2. 全画面背景を更新
-            drawTemperatureGradientBackground(currentTemp);
-            
-            // 3. すぐに全ての要素を描画（ラグなし）
-            
-            // CarBuddyタイトル（キャラクター上部空白に）
-            tft.setTextColor(TFT_WHITE);
-            tft.setTextSize(2);
-            tft.drawString("CarBuddy", 25, 8);
-            
-            // UI固定ラベル（元の位置に戻す）
-            tft.setTextSize(3);
-            tft.drawString("Temp:", 200, 10);
-            tft.drawString("Speed:", 200, 130);
-            tft.drawString("km/h", 240, 180);
-            
-            // 温度表示（文字色判定付き）
-            uint16_t tempTextColor = TFT_WHITE;
-            if (currentTemp >= 32.0) {
-                tempTextColor = TFT_YELLOW;
-            }
-            tft.setTextSize(3);
-            tft.setTextColor(tempTextColor);
-            tft.drawString(String(currentTemp, 1) + " C", 200, 35);
-            
-            // 速度表示
-            tft.setTextSize(3);
-            tft.setTextColor(TFT_WHITE);
-            tft.drawString(String(abs(currentSpeed), 1), 200, 155);
-            
-            // 時刻表示（通常色）
-            tft.setTextSize(2);
-            tft.setTextColor(TFT_YELLOW);
-            tft.drawString(currentTimeStr, 10, 220);
-            
-            // 日付表示（通常色）
-            tft.setTextSize(2);
-            tft.setTextColor(TFT_CYAN);
-            tft.drawString(currentDateStr, 95, 220);
-            
-            // 🔧 修正: モードに応じた表示切り替え（キャラクター直接描画を削除）
-            updateDisplay();  // モードに応じてキャラクターまたは時計を描画
-            
-            // 4. 前回値を更新
-            forceUpdateAllDisplayValues();
-            setLastDisplayValues(currentTemp, currentSpeed, currentTimeStr, currentDateStr);
+            // === 背景とすべての要素を無効化（描画はループ末尾の描画パスで1回） ===
+            forceFullRedrawWithMode(currentTemp);
             
             lastDisplayedBackgroundTemp = currentTemp;
         } else {
@@ -211,19 +239,34 @@ void loop() {
 
     // === 速度更新 ===
     if (currentTime - lastSpeedUpdate >= SPEED_UPDATE_INTERVAL) {
-        drawSpeed(getSpeed());
+        float speed = getSpeed();
+        // 推定車速（km/h）を積分して走行距離に加算（FIFO未使用時の値は加速度なので除外）
+        if (isImuFifoActive() && lastSpeedUpdate != 0) {
+            addTravelDistance(speed / 3.6 * (currentTime - lastSpeedUpdate) / 1000.0);
+        }
+        drawSpeed(speed);
         lastSpeedUpdate = currentTime;
     }
+    
+    // === 状態ジャーナル（時刻・走行距離を定期的にNVSへ記録） ===
+    updateJournal();
+    
+    // === テレメトリー配信（WebSocket、クライアントごとのレートで送信） ===
+    updateTelemetry();
+    
+    // === センサー履歴（/api/history用、10秒ごとに記録） ===
+    updateHistory();
 
     // === 時刻更新 ===
     if (currentTime - lastTimeUpdate >= TIME_UPDATE_INTERVAL) {
         drawTime(getCurrentTime());
         drawDate(getCurrentDate());
+        updateBacklightSchedule();  // 夜間減光（時間帯が変わった時だけフェード）
         lastTimeUpdate = currentTime;
         
         // アナログ時計モードの場合、時計も更新
         if (getCurrentMode() == MODE_ANALOG_CLOCK) {
-            drawAnalogClock();  // 1秒ごとに時計を更新（秒針のため）
+            updateAnalogClock();  // 1秒ごとに動いた針だけを更新（秒針のため）
         }
     }
 
@@ -231,24 +274,50 @@ void loop() {
     if (currentTime - lastSerialUpdate >= SERIAL_UPDATE_INTERVAL) {
         float temp = getTemperature();
         float speed = getSpeed();
-        String timeStr = getCurrentTime();
-        String dateStr = getCurrentDate();
+        const char* timeStr = getCurrentTime();
+        const char* dateStr = getCurrentDate();
         
         Serial.print("Temp: ");
         Serial.print(temp, 1);
         Serial.print("°C, Speed: ");
         Serial.print(speed, 1);
-        Serial.print(" km/h, Time: ");
+        Serial.print(" km/h, ODO: ");
+        Serial.print(getOdometerMeters() / 1000.0, 1);
+        Serial.print(" km, Trip: ");
+        Serial.print(getTripMeters() / 1000.0, 1);
+        Serial.print(" km, Time: ");
         Serial.print(timeStr);
         Serial.print(", Date: ");
         Serial.print(dateStr);
         Serial.print(", WiFi clients: ");
         Serial.print(getConnectedClientCount());
+        Serial.print(" (WS ");
+        Serial.print(getTelemetryClientCount());
+        Serial.print(", dropped ");
+        Serial.print(getTelemetryDroppedFrames());
+        Serial.print(")");
         Serial.print(", 現在モード: ");
-        Serial.println(getCurrentModeString());
+        Serial.print(getCurrentModeString());
+        Serial.print(", 車速推定: ");
+        Serial.print(getSpeedEstimatorCyclesPerSample());
+        Serial.print(" cycles/sample, SPI: ");
+        Serial.print(getLastFlushBytes());
+        Serial.print(" bytes/frame (");
+        Serial.print(getLastFlushRectCount());
+        Serial.print(" rects)");
+        if (getCurrentMode() == MODE_SMOOTH_CLOCK) {
+            Serial.print(", 時計: ");
+            Serial.print(getSmoothClockFps(), 1);
+            Serial.print(isSmoothClockDegraded() ? " fps (1Hz)" : " fps");
+        }
+        Serial.println();
         
         lastSerialUpdate = currentTime;
     }
+    
+    // === dirtyなウィジェットを描画し、フレームバッファの差分をパネルへ転送 ===
+    renderWidgets();
+    flushFrameBuffer();
 
     delay(10);
 }
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include "../include/ui.hpp"
 #include "../include/ui/ui_temperature.hpp"
 #include "../include/temperature.hpp"
+#include "../include/ui/ui_framebuffer.hpp"
+#include "../include/ui/ui_widgets.hpp"
 
 extern TFT_eSPI tft;
 
@@ -110,6 +112,8 @@ String getCurrentModeString() {
             return "キャラクター画像モード";
         case MODE_ANALOG_CLOCK:
             return "アナログ時計モード";
+        case MODE_SMOOTH_CLOCK:
+            return "スムーズ時計モード";
         default:
             return "不明なモード";
     }
@@ -146,30 +150,31 @@ void switchToMode(DisplayMode mode) {
     Serial.print((int)currentMode);
     Serial.println(")");
     
-    // 確実にクリアしてから表示
-    clearDisplayArea();
-    delay(20);  // 表示クリアの確実な完了を待つ
+    // 旧モードの要素は背景パッチで消え、新モードの要素と合わせて1回の描画パスで描き直される
     updateDisplay();
 }
 
 // ===== 表示エリアクリア =====
 void clearDisplayArea() {
+    TFT_eSPI& canvas = uiCanvas();
+    
     // キャラクター/時計表示エリアをクリア（5, 25から190x195の領域）
     // キャラクター画像の下部が見えないよう、デジタル時計との間まで確実にクリア
-    tft.fillRect(5, 25, 190, 195, TFT_BLACK);
+    canvas.fillRect(5, 25, 190, 195, TFT_BLACK);
+    markDirty(5, 25, 190, 195);
     Serial.println("📺 表示エリアをクリアしました");
 }
 
 // ===== 表示更新 =====
+// キャラクターと時計は同じ領域のウィジェット。表示を切り替えて再描画対象にするだけで、
+// 背景パッチと描画は renderWidgets() が行う
 void updateDisplay() {
     switch (currentMode) {
         case MODE_CHARACTER:
             // アナログ時計を非表示に設定
             setClockVisible(false);
-            // 時計の描画要素を完全にクリアするため、温度連動グラデーション背景で上書き
-            drawTemperatureGradientArea(5, 25, 190, 195, getTemperature());
-            // 少し遅延を入れて確実にクリア
-            delay(10);
+            setWidgetVisible(WIDGET_CLOCK, false);
+            setWidgetVisible(WIDGET_CHARACTER, true);
             // 温度連動キャラクター描画
             drawCharacter();
             Serial.println("👤 温度連動キャラクター画像を表示しました");
@@ -178,17 +183,27 @@ void updateDisplay() {
         case MODE_ANALOG_CLOCK:
             // アナログ時計を表示状態に設定
             setClockVisible(true);
+            setClockStyle(CLOCK_STYLE_TICK);
             setClockPosition(95, 120);  // 時計の中心位置設定
             setClockSize(80);           // 時計のサイズ設定
-            // 時計表示エリアに温度連動グラデーション背景を描画（キャラクター画像領域全体をカバー）
-            drawTemperatureGradientArea(5, 25, 190, 195, getTemperature());
-            // 少し遅延を入れて確実にクリア
-            delay(10);
-            // アナログ時計描画
-            drawAnalogClock();
+            setWidgetVisible(WIDGET_CHARACTER, false);
+            setWidgetVisible(WIDGET_CLOCK, true);
+            invalidateWidget(WIDGET_CLOCK);
             Serial.println("🕐 アナログ時計を表示しました");
             break;
             
+        case MODE_SMOOTH_CLOCK:
+            // 同じ時計ウィジェットをスイープ表示で使う
+            setClockVisible(true);
+            setClockStyle(CLOCK_STYLE_SWEEP);
+            setClockPosition(95, 120);
+            setClockSize(80);
+            setWidgetVisible(WIDGET_CHARACTER, false);
+            setWidgetVisible(WIDGET_CLOCK, true);
+            invalidateWidget(WIDGET_CLOCK);
+            Serial.println("🕐 スムーズ時計を表示しました");
+            break;
+            
         default:
             Serial.println("❌ エラー: 不明な表示モードです");
             break;
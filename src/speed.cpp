@@ -1,14 +1,32 @@
 #include <Wire.h>
-#include <Adafruit_Sensor.h>
-#include <Adafruit_MPU6050.h>
 #include <TFT_eSPI.h>
+#include <atomic>
 #include "speed.hpp"
+#include "imu_driver.hpp"
+#include "speed_estimator.hpp"
 
 extern TFT_eSPI tft;
 
-static Adafruit_MPU6050 mpu;
 static bool sensorReady = false;
 
+// ===== FIFO取得モード用の設定 =====
+#define IMU_FIFO_SAMPLE_BYTES 12  // 加速度XYZ + ジャイロXYZ（各2バイト）
+#define IMU_FIFO_MAX_BATCH 10     // 1回のI2C転送で読むサンプル数（Wireバッファ128バイト以内）
+#define IMU_FIFO_OVERFLOW_BYTES 500  // これ以上溜まっていたらあふれとみなしてリセット（MPU6500は512バイト）
+#define IMU_NOTIFY_EVERY 10       // 割り込みN回ごとにタスクを起こす（=10ms周期のバッチ読み出し）
+#define IMU_DECIMATION 100        // UI向け間引き（1kHz → 10Hz）
+#define IMU_RING_GUARD 64         // 書き込み中スロットとの安全距離
+
+static TaskHandle_t imuTask = NULL;
+static bool fifoActive = false;
+static ImuSample imuRing[IMU_RING_SIZE];
+static std::atomic<uint32_t> imuWriteIndex(0);   // 単調増加、スロットは & (IMU_RING_SIZE - 1)
+static std::atomic<uint32_t> imuOverruns(0);
+static volatile uint32_t imuIntCount = 0;
+static volatile int64_t lastImuIntTimeUs = 0;   // 最新のデータレディ割り込み時刻
+static volatile float decimatedAx = 0.0;          // UI向け間引き済みX軸加速度（g）
+static volatile float lastPolledSpeed = 0.0;      // ポーリング時にgetSpeed()が最後に返した値
+
 // I2Cデバイススキャン関数
 void scanI2C() {
   Serial.println("Scanning I2C devices...");
@@ -33,127 +51,188 @@ void scanI2C() {
   }
 }
 
-// WHO_AM_Iレジスタを直接読み取る関数
-uint8_t readWhoAmI(uint8_t address) {
-  Wire.beginTransmission(address);
-  Wire.write(0x75); // WHO_AM_Iレジスタのアドレス
-  if (Wire.endTransmission() != 0) {
-    return 0xFF; // エラー
+// ===== FIFO取得モード（1kHz、データレディ割り込み駆動） =====
+
+static void resetImuFifo() {
+  imuWriteRegister(0x6A, 0x04);  // USER_CTRL: FIFO_RST
+  imuWriteRegister(0x6A, 0x40);  // USER_CTRL: FIFO_EN
+}
+
+// データレディ割り込み：時刻を記録し、バッチ単位でタスクを起こす
+static void IRAM_ATTR handleImuDataReady() {
+  lastImuIntTimeUs = esp_timer_get_time();
+  if (++imuIntCount % IMU_NOTIFY_EVERY == 0 && imuTask != NULL) {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(imuTask, &woken);
+    portYIELD_FROM_ISR(woken);
+  }
+}
+
+// FIFOに溜まった分をバースト読み出ししてリングバッファへ積む
+static void drainImuFifo() {
+  uint8_t countBuf[2];
+  if (!imuReadRegisters(0x72, countBuf, 2)) {  // FIFO_COUNTH/L
+    return;
   }
+  uint16_t fifoBytes = ((uint16_t)countBuf[0] << 8) | countBuf[1];
   
-  Wire.requestFrom((uint8_t)address, (uint8_t)1);
-  if (Wire.available()) {
-    return Wire.read();
+  if (fifoBytes >= IMU_FIFO_OVERFLOW_BYTES) {
+    // あふれるとサンプル境界がずれるため、捨てて取り直す
+    resetImuFifo();
+    imuOverruns++;
+    return;
+  }
+  
+  size_t pending = fifoBytes / IMU_FIFO_SAMPLE_BYTES;
+  if (pending == 0) return;
+  
+  // FIFO末尾のサンプルを最新割り込み時刻とし、ODR間隔で遡って時刻を付ける
+  const uint32_t periodUs = 1000000 / IMU_SAMPLE_RATE_HZ;
+  uint32_t newestUs = (uint32_t)lastImuIntTimeUs;
+  if (newestUs == 0) newestUs = (uint32_t)esp_timer_get_time();  // 割り込み未配線時
+  uint32_t firstUs = newestUs - (uint32_t)(pending - 1) * periodUs;
+  
+  static uint8_t burst[IMU_FIFO_MAX_BATCH * IMU_FIFO_SAMPLE_BYTES];
+  static int32_t decimationSum = 0;
+  static int decimationCount = 0;
+  size_t done = 0;
+  
+  while (done < pending) {
+    size_t batch = min((size_t)IMU_FIFO_MAX_BATCH, pending - done);
+    if (!imuReadRegisters(0x74, burst, batch * IMU_FIFO_SAMPLE_BYTES)) {  // FIFO_R_W
+      return;
+    }
+    
+    uint32_t w = imuWriteIndex.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < batch; i++) {
+      const uint8_t* p = &burst[i * IMU_FIFO_SAMPLE_BYTES];
+      ImuSample& s = imuRing[(w + i) & (IMU_RING_SIZE - 1)];
+      s.timestampUs = firstUs + (uint32_t)(done + i) * periodUs;
+      s.ax = (int16_t)((p[0] << 8) | p[1]);
+      s.ay = (int16_t)((p[2] << 8) | p[3]);
+      s.az = (int16_t)((p[4] << 8) | p[5]);
+      s.gx = (int16_t)((p[6] << 8) | p[7]);
+      s.gy = (int16_t)((p[8] << 8) | p[9]);
+      s.gz = (int16_t)((p[10] << 8) | p[11]);
+      
+      // UI向けの間引き（ボックス平均）
+      decimationSum += s.ax;
+      if (++decimationCount >= IMU_DECIMATION) {
+        decimatedAx = (decimationSum / (float)decimationCount) / 4096.0;
+        decimationSum = 0;
+        decimationCount = 0;
+      }
+    }
+    imuWriteIndex.store(w + batch, std::memory_order_release);
+    done += batch;
   }
-  return 0xFF;
 }
 
-// MPU6500用の手動初期化
-bool initMPU6500() {
-  Serial.println("Attempting MPU6500 manual initialization...");
-  
-  // PWR_MGMT_1レジスタ(0x6B)をリセット
-  Wire.beginTransmission(0x68);
-  Wire.write(0x6B);
-  Wire.write(0x80); // デバイスリセット
-  Wire.endTransmission();
-  delay(100);
-  
-  // PWR_MGMT_1レジスタでスリープ解除
-  Wire.beginTransmission(0x68);
-  Wire.write(0x6B);
-  Wire.write(0x00); // スリープ解除、内部クロック使用
-  Wire.endTransmission();
-  delay(100);
-  
-  // 加速度センサー設定 (ACCEL_CONFIG: 0x1C)
-  Wire.beginTransmission(0x68);
-  Wire.write(0x1C);
-  Wire.write(0x10); // ±8g range
-  Wire.endTransmission();
-  
-  // ジャイロ設定 (GYRO_CONFIG: 0x1B)
-  Wire.beginTransmission(0x68);
-  Wire.write(0x1B);
-  Wire.write(0x08); // ±500度/秒 range
-  Wire.endTransmission();
-  
-  // CONFIG レジスタ (0x1A) - ローパスフィルタ設定
-  Wire.beginTransmission(0x68);
-  Wire.write(0x1A);
-  Wire.write(0x03); // DLPF_CFG = 3 (44Hz)
-  Wire.endTransmission();
-  
-  delay(100);
-  
-  // WHO_AM_Iレジスタで確認
-  uint8_t whoAmI = readWhoAmI(0x68);
-  Serial.print("After manual init, WHO_AM_I: 0x");
-  Serial.println(whoAmI, HEX);
-  
-  return (whoAmI == 0x70);
+// IMU専用タスク（Core 0で実行）
+static void ImuTaskCode(void* pvParameters) {
+  Serial.println("IMU Task started on Core 0");
+  
+  for (;;) {
+    // 割り込みからの通知を待つ。INT未配線でも20msごとにFIFOを読みに行く
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(20));
+    drainImuFifo();
+    
+    // 車速推定は全サンプルを同じコアで処理する（UIループを止めない）
+    processSpeedEstimator();
+  }
 }
 
-// 手動でセンサーデータを読み取る
-bool readMPU6500Data(float &ax, float &ay, float &az) {
-  Wire.beginTransmission(0x68);
-  Wire.write(0x3B); // ACCEL_XOUT_H レジスタから開始
-  if (Wire.endTransmission() != 0) {
+bool startImuFifoAcquisition() {
+  if (!sensorReady || fifoActive) return fifoActive;
+  
+  Serial.println("Starting IMU FIFO acquisition (1kHz)...");
+  
+  // SMPLRT_DIV=0：DLPF有効時は内部1kHz → 1kHz出力
+  imuWriteRegister(0x19, 0x00);
+  imuWriteRegister(0x38, 0x00);  // INT_ENABLE: 設定中は無効
+  imuWriteRegister(0x6A, 0x00);  // USER_CTRL: FIFO停止
+  imuWriteRegister(0x23, 0x78);  // FIFO_EN: ACCEL + XG/YG/ZG
+  resetImuFifo();
+  imuWriteRegister(0x37, 0x00);  // INT_PIN_CFG: アクティブHigh、50usパルス
+  if (!imuWriteRegister(0x38, 0x01)) {  // INT_ENABLE: DATA_RDY_EN
+    Serial.println("IMU FIFO configuration failed");
     return false;
   }
   
-  Wire.requestFrom((uint8_t)0x68, (uint8_t)6); // 6バイト読み取り（X,Y,Z各2バイト）
+  // リーダーがいつでも読めるよう、タスク起動前にフラグを立てる
+  fifoActive = true;
+  initSpeedEstimator();
+  xTaskCreatePinnedToCore(
+    ImuTaskCode,    // タスク関数
+    "ImuTask",      // タスク名
+    4096,           // スタックサイズ
+    NULL,           // パラメータ
+    3,              // 優先度（WiFiタスクより高め）
+    &imuTask,       // タスクハンドル
+    0               // Core 0で実行（UIループはCore 1）
+  );
   
-  if (Wire.available() >= 6) {
-    int16_t rawAX = (Wire.read() << 8) | Wire.read();
-    int16_t rawAY = (Wire.read() << 8) | Wire.read();
-    int16_t rawAZ = (Wire.read() << 8) | Wire.read();
-    
-    // ±8g設定での変換 (LSB感度: 4096 LSB/g)
-    ax = rawAX / 4096.0;
-    ay = rawAY / 4096.0;
-    az = rawAZ / 4096.0;
-    
-    return true;
+  pinMode(IMU_INT_PIN, INPUT);
+  attachInterrupt(digitalPinToInterrupt(IMU_INT_PIN), handleImuDataReady, RISING);
+  
+  Serial.println("IMU FIFO acquisition started");
+  return true;
+}
+
+bool isImuFifoActive() {
+  return fifoActive;
+}
+
+uint32_t getImuWriteIndex() {
+  return imuWriteIndex.load(std::memory_order_acquire);
+}
+
+float getDecimatedAccelX() {
+  return decimatedAx;
+}
+
+uint32_t getImuOverrunCount() {
+  return imuOverruns.load(std::memory_order_relaxed);
+}
+
+size_t readImuSamples(uint32_t* cursor, ImuSample* out, size_t maxCount) {
+  uint32_t w = imuWriteIndex.load(std::memory_order_acquire);
+  uint32_t backlog = w - *cursor;
+  
+  // 読み出しが遅れすぎた場合は古いサンプルを捨てて追いつく
+  if (backlog > IMU_RING_SIZE - IMU_RING_GUARD) {
+    *cursor = w - (IMU_RING_SIZE - IMU_RING_GUARD);
+    backlog = IMU_RING_SIZE - IMU_RING_GUARD;
+    imuOverruns++;
   }
   
-  return false;
+  size_t count = min((size_t)backlog, maxCount);
+  for (size_t i = 0; i < count; i++) {
+    out[i] = imuRing[(*cursor + i) & (IMU_RING_SIZE - 1)];
+  }
+  *cursor += count;
+  return count;
 }
 
 bool initSpeedSensor() {
   Wire.begin(21, 22); // SDA, SCLピンを指定（ESP32の例）
   Serial.println("Trying to initialize accelerometer...");
   
-  // I2Cデバイススキャンを実行
+#ifdef CARBUDDY_I2C_SCAN
+  // I2Cデバイススキャン（126アドレスを順に叩くため配線確認時のみ）
   scanI2C();
+#endif
   
-  // WHO_AM_Iチェック
-  uint8_t whoAmI = readWhoAmI(0x68);
-  Serial.print("WHO_AM_I register: 0x");
-  Serial.println(whoAmI, HEX);
+  // チップ判定は起動時の1回だけ。以降は束縛済みドライバで読み取る
+  ImuChip chip = detectImuChip();
   
-  if (whoAmI == 0x70) {
-    Serial.println("Device is MPU6500! Using manual initialization...");
-    
-    if (initMPU6500()) {
-      sensorReady = true;
-      Serial.println("MPU6500 manual initialization successful!");
-      return true;
-    }
-  } else {
-    Serial.println("Attempting standard MPU6050 initialization...");
+  if (bindImuDriver(chip)) {
+    sensorReady = true;
+    Serial.print(getImuChipName());
+    Serial.println(" initialization successful!");
     
-    if (mpu.begin(0x68, &Wire)) {
-      sensorReady = true;
-      Serial.println("Standard MPU6050 initialization successful!");
-      
-      // センサー設定
-      mpu.setAccelerometerRange(MPU6050_RANGE_8_G);
-      mpu.setGyroRange(MPU6050_RANGE_500_DEG);
-      mpu.setFilterBandwidth(MPU6050_BAND_21_HZ);
-      
-      return true;
-    }
+    startImuFifoAcquisition();
+    return true;
   }
   
   Serial.println("All initialization attempts failed!");
@@ -164,26 +243,23 @@ bool initSpeedSensor() {
 float getSpeed() {
   if (!sensorReady) return 0.0;
   
-  // WHO_AM_Iに基づいて適切な読み取り方法を選択
-  uint8_t whoAmI = readWhoAmI(0x68);
-  
-  if (whoAmI == 0x70) {
-    // MPU6500の場合、手動でデータ読み取り
-    float ax, ay, az;
-    if (readMPU6500Data(ax, ay, az)) {
-      return ax; // X軸加速度を返す
-    } else {
-      Serial.println("Failed to read MPU6500 data");
-      return 0.0;
-    }
+  // FIFO取得中はI2Cに触れず、IMUタスクが推定した車速を返す
+  if (fifoActive) {
+    return getEstimatedSpeedKmh();
+  }
+  
+  // ポーリング時も束縛済みドライバで1回の読み取りのみ（WHO_AM_I確認なし）
+  ImuReading r;
+  if (readImu(r)) {
+    lastPolledSpeed = r.ax;
+    return r.ax; // X軸加速度を返す（g）
   } else {
-    // 標準のAdafruitライブラリを使用
-    sensors_event_t a, g, temp;
-    if (mpu.getEvent(&a, &g, &temp)) {
-      return a.acceleration.x;
-    } else {
-      Serial.println("Failed to read sensor data");
-      return 0.0;
-    }
+    Serial.println("Failed to read sensor data");
+    return 0.0;
   }
+}
+
+float getCachedSpeed() {
+  if (!sensorReady) return 0.0;
+  return fifoActive ? getEstimatedSpeedKmh() : lastPolledSpeed;
 }
\ No newline at end of file
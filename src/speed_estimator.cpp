@@ -0,0 +1,219 @@
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+#include "speed_estimator.hpp"
+
+// ===== 固定小数点の単位 =====
+// 加速度: 生値(4096 LSB/g) × 2^8 (Q8)
+// 重力ベクトル: 生値 × 2^20 (Q20)。補正のシフトで端数を捨てても偏らないよう、
+//              加速度より12ビット多く保持する（演算にはQ8に丸めた値を使う）
+// 回転角: ラジアン × 2^30 (Q30)
+// 速度積算値: 加速度Q8 × マイクロ秒（丸めなしで積算し、読み出し時に換算）
+#define ACCEL_Q 8
+#define GRAVITY_FRAC_BITS 12
+#define ACCEL_LSB_PER_G 4096
+#define GYRO_RAD_Q30_PER_LSB_US_Q16 18751  // (π/180 / 65.5 / 1e6) × 2^30 × 2^16
+// 走行中は加速度計だけでは傾きと前後加速度を区別できないため、加速度による補正は
+// ジャイロのドリフトを抑える程度にとどめる（速いと加減速が重力推定に吸収される）
+#define GRAVITY_TRACK_SHIFT 18   // 重力ベクトルの加速度補正時定数（2^18サンプル ≒ 4.4分）
+#define STATIONARY_TRACK_SHIFT 5 // 停車中は速めに重力ベクトルを合わせ込む
+#define GYRO_BIAS_SHIFT 7        // 停車中のジャイロバイアス学習の時定数
+#define MAX_STEP_US 5000         // 欠落時の積分ステップ上限
+
+// 停車判定（ゼロ速度検出）
+// 1サンプルごとの閾値だけでは滑らかな路面での定速走行と区別できないため、
+// 条件が続いた区間の加速度の分散（路面振動の有無）も確かめてから停車とみなす
+#define STATIONARY_ACCEL_TOL 123   // 重力推定との差（生値、約0.03g）
+#define STATIONARY_GYRO_TOL 131    // 各軸の角速度（生値、約2dps）
+#define STATIONARY_HOLD_SAMPLES 200  // 条件が続いたら停車とみなすサンプル数（200ms）
+#define STATIONARY_VAR_TOL 400     // 区間内の加速度の分散（生値²、標準偏差で約0.005g）
+
+// 公開値は速度積算値を2^16で割った32ビット整数（1サンプルごとの浮動小数点演算を避ける）
+// 公開値 → km/h の換算係数：2^16 × 9.80665 / (2^8 × 4096 × 1e6) × 3.6
+#define PUBLISH_SHIFT 16
+static const float PUBLISHED_TO_KMH =
+    (float)(65536.0 * 9.80665 / ((double)(1 << ACCEL_Q) * ACCEL_LSB_PER_G * 1e6) * 3.6);
+
+static int64_t gravityFine[3];      // 重力ベクトル推定（Q20、センサー座標）
+static int32_t gravity[3];          // 同（Q8に丸めた値）
+static int32_t gyroBias[3];         // ジャイロバイアス（生値 × 2^8）
+static int64_t velocityAccum = 0;   // 前後加速度 × 時間の積算値
+static uint32_t lastTimestampUs = 0;
+static bool hasLastSample = false;
+static bool gravityInitialized = false;
+static uint32_t stationaryCount = 0;
+static bool stationary = false;
+static int32_t stillSum[3];         // 停車候補区間の重力推定との差の合計（生値）
+static int32_t stillSumSq[3];       // 同、二乗の合計
+
+// 他コアから読むための公開値（32ビット書き込みはアトミック）
+static volatile int32_t publishedVelocity = 0;
+static volatile bool publishedStationary = true;
+
+static inline int32_t absInt(int32_t v) {
+  return v < 0 ? -v : v;
+}
+
+// Q20 → Q8（四捨五入）
+static inline void updateGravityQ8() {
+  for (int i = 0; i < 3; i++) {
+    gravity[i] = (int32_t)((gravityFine[i] + (1 << (GRAVITY_FRAC_BITS - 1))) >> GRAVITY_FRAC_BITS);
+  }
+}
+
+void resetSpeedEstimator() {
+  for (int i = 0; i < 3; i++) {
+    gravityFine[i] = 0;
+    gravity[i] = 0;
+    gyroBias[i] = 0;
+  }
+  velocityAccum = 0;
+  hasLastSample = false;
+  gravityInitialized = false;
+  stationaryCount = 0;
+  stationary = false;
+  for (int i = 0; i < 3; i++) {
+    stillSum[i] = 0;
+    stillSumSq[i] = 0;
+  }
+  publishedVelocity = 0;
+  publishedStationary = true;
+}
+
+void stepSpeedEstimator(const ImuSample& s) {
+  const int32_t accel[3] = {
+    (int32_t)s.ax << ACCEL_Q,
+    (int32_t)s.ay << ACCEL_Q,
+    (int32_t)s.az << ACCEL_Q
+  };
+  
+  // 最初のサンプルで重力ベクトルを初期化（起動時は停車中とみなす）
+  if (!gravityInitialized) {
+    for (int i = 0; i < 3; i++) gravityFine[i] = (int64_t)accel[i] << GRAVITY_FRAC_BITS;
+    updateGravityQ8();
+    gravityInitialized = true;
+  }
+  
+  uint32_t dtUs = hasLastSample ? (s.timestampUs - lastTimestampUs) : 0;
+  if (dtUs > MAX_STEP_US) dtUs = MAX_STEP_US;
+  lastTimestampUs = s.timestampUs;
+  hasLastSample = true;
+  
+  // 1. ジャイロで重力ベクトルを回転させる：dG = -(ω × G)·dt
+  int64_t theta[3];  // このステップの回転角（Q30）
+  const int16_t gyro[3] = { s.gx, s.gy, s.gz };
+  for (int i = 0; i < 3; i++) {
+    int32_t rate = ((int32_t)gyro[i] << 8) - gyroBias[i];  // バイアス補正済み（×2^8）
+    theta[i] = ((int64_t)rate * dtUs * GYRO_RAD_Q30_PER_LSB_US_Q16) >> 24;
+  }
+  const int rotateShift = 30 - GRAVITY_FRAC_BITS;  // Q30 × Q8 → Q20
+  gravityFine[0] -= (theta[1] * gravity[2] - theta[2] * gravity[1]) >> rotateShift;
+  gravityFine[1] -= (theta[2] * gravity[0] - theta[0] * gravity[2]) >> rotateShift;
+  gravityFine[2] -= (theta[0] * gravity[1] - theta[1] * gravity[0]) >> rotateShift;
+  updateGravityQ8();
+  
+  // 2. 停車判定：加速度が重力推定と一致し、回転もほぼない状態が続き、
+  //    その区間の加速度に路面振動がない（分散が小さい）
+  int32_t diff[3];
+  bool still = true;
+  for (int i = 0; i < 3; i++) {
+    diff[i] = (accel[i] - gravity[i]) >> ACCEL_Q;
+    if (absInt(diff[i]) > STATIONARY_ACCEL_TOL) still = false;
+    if (absInt(gyro[i] - (gyroBias[i] >> 8)) > STATIONARY_GYRO_TOL) still = false;
+  }
+  if (!still) {
+    stationaryCount = 0;
+    stationary = false;  // 動き出しは即座に反映する
+  } else if (!stationary) {
+    if (stationaryCount == 0) {
+      for (int i = 0; i < 3; i++) {
+        stillSum[i] = 0;
+        stillSumSq[i] = 0;
+      }
+    }
+    for (int i = 0; i < 3; i++) {
+      stillSum[i] += diff[i];
+      stillSumSq[i] += diff[i] * diff[i];  // 最大 123² × 200 なので32ビットに収まる
+    }
+    if (++stationaryCount >= STATIONARY_HOLD_SAMPLES) {
+      // 分散 × n² = n·Σd² − (Σd)²
+      const int64_t n = stationaryCount;
+      bool quiet = true;
+      for (int i = 0; i < 3; i++) {
+        int64_t varN2 = n * stillSumSq[i] - (int64_t)stillSum[i] * stillSum[i];
+        if (varN2 > STATIONARY_VAR_TOL * n * n) quiet = false;
+      }
+      stationary = quiet;
+      stationaryCount = 0;  // 振動があれば次の区間で判定し直す
+    }
+  }
+  
+  // 3. 加速度による重力ベクトルの補正（相補フィルタ）
+  int shift = stationary ? STATIONARY_TRACK_SHIFT : GRAVITY_TRACK_SHIFT;
+  for (int i = 0; i < 3; i++) {
+    int64_t d = ((int64_t)accel[i] << GRAVITY_FRAC_BITS) - gravityFine[i];
+    gravityFine[i] += (d + ((int64_t)1 << (shift - 1))) >> shift;  // 四捨五入（符号で偏らない）
+  }
+  updateGravityQ8();
+  
+  if (stationary) {
+    // ゼロ速度補正：積分ドリフトを捨て、ジャイロバイアスを学習する
+    velocityAccum = 0;
+    for (int i = 0; i < 3; i++) {
+      gyroBias[i] += (((int32_t)gyro[i] << 8) - gyroBias[i]) >> GYRO_BIAS_SHIFT;
+    }
+  } else {
+    // 4. 重力を除いた前後加速度を積分
+    int32_t forward = accel[0] - gravity[0];
+    velocityAccum += (int64_t)forward * dtUs;
+  }
+  
+  publishedVelocity = (int32_t)(velocityAccum >> PUBLISH_SHIFT);
+  publishedStationary = stationary;
+}
+
+float getEstimatedSpeedKmh() {
+  return publishedVelocity * PUBLISHED_TO_KMH;
+}
+
+bool isVehicleStationary() {
+  return publishedStationary;
+}
+
+// ===== IMUタスク側（ネイティブビルドのテストでは使わない） =====
+#ifdef ARDUINO
+static volatile uint32_t cyclesPerSample = 0;
+static uint32_t estimatorCursor = 0;
+
+void initSpeedEstimator() {
+  resetSpeedEstimator();
+  estimatorCursor = getImuWriteIndex();
+  Serial.println("Speed estimator ready (fixed-point, full IMU rate)");
+}
+
+void processSpeedEstimator() {
+  static ImuSample batch[32];
+  uint32_t cycles = 0;
+  uint32_t processed = 0;
+  
+  size_t n;
+  while ((n = readImuSamples(&estimatorCursor, batch, 32)) > 0) {
+    uint32_t start = ESP.getCycleCount();
+    for (size_t i = 0; i < n; i++) {
+      stepSpeedEstimator(batch[i]);
+    }
+    cycles += ESP.getCycleCount() - start;
+    processed += n;
+  }
+  
+  if (processed > 0) {
+    // 移動平均（1/8）でサンプルあたりのコストを公開
+    uint32_t perSample = cycles / processed;
+    cyclesPerSample = cyclesPerSample + (((int32_t)perSample - (int32_t)cyclesPerSample) >> 3);
+  }
+}
+
+uint32_t getSpeedEstimatorCyclesPerSample() {
+  return cyclesPerSample;
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,368 @@
+#include <Arduino.h>
+#include <WiFi.h>
+#include <AsyncTCP.h>
+#include <ESPAsyncWebServer.h>
+#include <esp_heap_caps.h>
+#include "status_api.hpp"
+#include "json_writer.hpp"
+#include "history.hpp"
+#include "temperature.hpp"
+#include "speed.hpp"
+#include "mode_manager.hpp"
+#include "journal.hpp"
+#include "telemetry.hpp"
+#include "time.hpp"
+
+enum ApiDocument {
+    DOC_STATUS,
+    DOC_HISTORY
+};
+
+// /api/status の単位（この順に1つずつ書く）
+enum StatusStep {
+    STATUS_SYSTEM,   // 稼働時間・モード・ヒープ
+    STATUS_REQUESTS, // API応答のヒープ使用量（実際のリクエストで計測）
+    STATUS_PROBES,   // 車速と probes 配列の開始
+    STATUS_PROBE,    // プローブ1個（PROBE_COUNT回）
+    STATUS_CLIENTS,  // probes の終了と接続数・走行距離・時刻
+    STATUS_DONE
+};
+
+// 送信中の応答1つ分（コールバックはAsyncTCPタスクからのみ呼ばれる）
+struct ApiStream {
+    uint32_t ticket;         // 0なら空き。解放後の古いコールバックを見分ける
+    uint8_t document;
+    uint8_t step;
+    uint8_t probe;
+    bool done;
+    uint32_t historyNext;    // 次に書く履歴の通し番号
+    uint32_t historyEnd;     // 応答開始時点の末尾（送信中に増えた分は含めない）
+    JsonWriter json;
+    uint16_t pendingLength;  // 送信バッファに収まらなかった単位
+    uint16_t pendingPos;
+    uint32_t heapBefore;     // 応答オブジェクト作成前の空きヒープ
+    uint32_t heapLowest;     // 送信中に観測した最小の空きヒープ
+    char pending[STATUS_API_UNIT_MAX];
+};
+
+static ApiStream streams[STATUS_API_STREAMS];
+static uint32_t nextTicket = 1;
+static uint32_t unitOverflows = 0;
+
+// 完了した応答ごとのヒープ使用量（作成前の空き - 送信中の最小値）。ライブラリが確保する
+// 応答オブジェクトと送信バッファを含む。他タスクの確保も重なり得るので上限値として扱う
+static uint32_t measuredRequests = 0;
+static uint32_t requestHeapPeakLast = 0;
+static uint32_t requestHeapPeakMax = 0;
+
+static const char* const modeNames[MODE_COUNT] = { "character", "analog_clock", "smooth_clock" };
+
+static void beginStream(ApiStream& s, uint8_t document) {
+    s.document = document;
+    s.step = 0;
+    s.probe = 0;
+    s.done = false;
+    s.pendingLength = 0;
+    s.pendingPos = 0;
+    jsonInit(s.json);
+    if (document == DOC_HISTORY) {
+        getHistoryRange(&s.historyNext, &s.historyEnd);
+    }
+}
+
+// ===== /api/status =====
+static bool writeStatusUnit(ApiStream& s) {
+    JsonWriter& w = s.json;
+    switch (s.step) {
+        case STATUS_SYSTEM: {
+            DisplayMode mode = getCurrentMode();
+            jsonBeginObject(w);
+            jsonKey(w, "uptime_ms");
+            jsonUInt(w, millis());
+            jsonKey(w, "mode");
+            jsonString(w, mode < MODE_COUNT ? modeNames[mode] : "unknown");
+            jsonKey(w, "heap");
+            jsonBeginObject(w);
+            jsonKey(w, "free");
+            jsonUInt(w, ESP.getFreeHeap());
+            jsonKey(w, "min_free");
+            jsonUInt(w, ESP.getMinFreeHeap());
+            jsonKey(w, "max_alloc");
+            jsonUInt(w, ESP.getMaxAllocHeap());
+            jsonKey(w, "psram_free");
+            jsonUInt(w, ESP.getFreePsram());
+            jsonEndObject(w);
+            s.step = STATUS_REQUESTS;
+            return true;
+        }
+        case STATUS_REQUESTS:
+            jsonKey(w, "api");
+            jsonBeginObject(w);
+            jsonKey(w, "requests");
+            jsonUInt(w, measuredRequests);
+            jsonKey(w, "heap_peak_last");
+            jsonUInt(w, requestHeapPeakLast);
+            jsonKey(w, "heap_peak_max");
+            jsonUInt(w, requestHeapPeakMax);
+            jsonEndObject(w);
+            s.step = STATUS_PROBES;
+            return true;
+        case STATUS_PROBES:
+            jsonKey(w, "speed_kmh");
+            jsonFloat(w, getCachedSpeed(), 2);  // AsyncTCPタスクからI2Cに触れない
+            jsonKey(w, "imu_fifo");
+            jsonBool(w, isImuFifoActive());
+            jsonKey(w, "imu_overruns");
+            jsonUInt(w, getImuOverrunCount());
+            jsonKey(w, "probes");
+            jsonBeginArray(w);
+            s.step = STATUS_PROBE;
+            return true;
+        case STATUS_PROBE: {
+            TempProbe probe = (TempProbe)s.probe;
+            bool valid = isProbeValid(probe);
+            jsonBeginObject(w);
+            jsonKey(w, "name");
+            jsonString(w, getProbeName(probe));
+            jsonKey(w, "valid");
+            jsonBool(w, valid);
+            jsonKey(w, "temp_c");
+            if (valid) {
+                jsonFloat(w, getProbeTemperature(probe), 2);
+                jsonKey(w, "age_ms");
+                jsonUInt(w, millis() - getProbeLastUpdate(probe));
+            } else {
+                jsonNull(w);
+            }
+            jsonEndObject(w);
+            if (++s.probe >= PROBE_COUNT) s.step = STATUS_CLIENTS;
+            return true;
+        }
+        case STATUS_CLIENTS: {
+            // getCurrentDate()/getCurrentTime()はUIループ専用の固定バッファなので、
+            // キャッシュのスナップショットをこのタスクの領域にコピーして使う
+            TimeSnapshot now;
+            getTimeSnapshot(&now);
+            jsonEndArray(w);
+            jsonKey(w, "clients");
+            jsonBeginObject(w);
+            jsonKey(w, "wifi");
+            jsonUInt(w, WiFi.softAPgetStationNum());
+            jsonKey(w, "ws");
+            jsonUInt(w, getTelemetryClientCount());
+            jsonKey(w, "ws_dropped");
+            jsonUInt(w, getTelemetryDroppedFrames());
+            jsonEndObject(w);
+            jsonKey(w, "odometer_m");
+            jsonUInt(w, getOdometerMeters());
+            jsonKey(w, "trip_m");
+            jsonUInt(w, getTripMeters());
+            jsonKey(w, "date");
+            jsonString(w, now.date);
+            jsonKey(w, "time");
+            jsonString(w, now.time);
+            jsonEndObject(w);
+            s.step = STATUS_DONE;
+            return false;
+        }
+        default:
+            return false;
+    }
+}
+
+// ===== /api/history =====
+static void writeCentiValue(JsonWriter& w, int16_t value) {
+    if (value == HISTORY_INVALID) {
+        jsonNull(w);
+    } else {
+        jsonFixed(w, value, 2);
+    }
+}
+
+static bool writeHistoryUnit(ApiStream& s) {
+    JsonWriter& w = s.json;
+    if (s.step == 0) {
+        jsonBeginObject(w);
+        jsonKey(w, "interval_ms");
+        jsonUInt(w, HISTORY_INTERVAL);
+        jsonKey(w, "uptime_s");
+        jsonUInt(w, millis() / 1000);
+        jsonKey(w, "samples");
+        jsonBeginArray(w);
+        s.step = 1;
+        return true;
+    }
+
+    // 送信中に上書きされたサンプルは飛ばす
+    HistorySample sample;
+    while (s.historyNext < s.historyEnd) {
+        if (!getHistorySample(s.historyNext++, &sample)) continue;
+        jsonBeginObject(w);
+        jsonKey(w, "t");
+        jsonUInt(w, sample.uptimeSec);
+        jsonKey(w, "temp_c");
+        jsonBeginArray(w);
+        for (int i = 0; i < PROBE_COUNT; i++) {
+            writeCentiValue(w, sample.temperature[i]);
+        }
+        jsonEndArray(w);
+        jsonKey(w, "speed_kmh");
+        writeCentiValue(w, sample.speed);
+        jsonEndObject(w);
+        return true;
+    }
+
+    jsonEndArray(w);
+    jsonEndObject(w);
+    return false;
+}
+
+// 送信バッファを埋める。単位が残り容量に収まる間は直接書き、収まらない時は退避バッファに
+// 書いて次回以降に続きをコピーする。文書の終わりで0を返す
+static size_t fillApiStream(ApiStream& s, uint8_t* buffer, size_t maxLen) {
+    size_t written = 0;
+    while (written < maxLen) {
+        if (s.pendingPos < s.pendingLength) {
+            size_t n = min(maxLen - written, (size_t)(s.pendingLength - s.pendingPos));
+            memcpy(buffer + written, s.pending + s.pendingPos, n);
+            s.pendingPos += n;
+            written += n;
+            continue;
+        }
+        if (s.done) break;
+
+        bool direct = (maxLen - written >= STATUS_API_UNIT_MAX);
+        jsonSetOutput(s.json, direct ? (char*)buffer + written : s.pending, STATUS_API_UNIT_MAX);
+        bool more = (s.document == DOC_STATUS) ? writeStatusUnit(s) : writeHistoryUnit(s);
+        s.done = !more;
+        if (s.json.overflow) {
+            unitOverflows++;  // 単位の上限を超えた（STATUS_API_UNIT_MAXを見直す）
+            s.json.overflow = false;
+        }
+        if (direct) {
+            written += s.json.length;
+        } else {
+            s.pendingLength = s.json.length;
+            s.pendingPos = 0;
+        }
+    }
+    return written;
+}
+
+static ApiStream* acquireStream(uint8_t document) {
+    for (int i = 0; i < STATUS_API_STREAMS; i++) {
+        if (streams[i].ticket != 0) continue;
+        streams[i].ticket = nextTicket++;
+        if (nextTicket == 0) nextTicket = 1;
+        beginStream(streams[i], document);
+        return &streams[i];
+    }
+    return NULL;
+}
+
+static void sampleRequestHeap(ApiStream& s) {
+    uint32_t freeNow = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    if (freeNow < s.heapLowest) s.heapLowest = freeNow;
+}
+
+static void finishRequestHeap(ApiStream& s) {
+    uint32_t peak = (s.heapBefore > s.heapLowest) ? s.heapBefore - s.heapLowest : 0;
+    requestHeapPeakLast = peak;
+    if (peak > requestHeapPeakMax) requestHeapPeakMax = peak;
+    measuredRequests++;
+}
+
+static void handleApiRequest(AsyncWebServerRequest* request, uint8_t document) {
+    ApiStream* stream = acquireStream(document);
+    if (stream == NULL) {
+        request->send(503, "application/json", "{\"error\":\"busy\"}");
+        return;
+    }
+
+    // キャプチャはポインタと番号だけ（std::functionの内部領域に収まり、確保が起きない）。
+    // 送信バッファはライブラリがコールバックの前に確保するので、コールバック内で空きを測る
+    uint32_t ticket = stream->ticket;
+    stream->heapBefore = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    stream->heapLowest = stream->heapBefore;
+    AsyncWebServerResponse* response = request->beginChunkedResponse("application/json",
+        [stream, ticket](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+            if (stream->ticket != ticket) return 0;
+            sampleRequestHeap(*stream);
+            size_t n = fillApiStream(*stream, buffer, maxLen);
+            if (n == 0) {
+                finishRequestHeap(*stream);
+                stream->ticket = 0;  // 送信完了
+            }
+            return n;
+        });
+    response->addHeader("Cache-Control", "no-store");
+    // 途中で切断された場合もスロットを返す
+    request->onDisconnect([stream, ticket]() {
+        if (stream->ticket == ticket) stream->ticket = 0;
+    });
+    request->send(response);
+}
+
+void initStatusApi(AsyncWebServer& server) {
+    memset(streams, 0, sizeof(streams));
+    server.on("/api/status", HTTP_GET, [](AsyncWebServerRequest* request) {
+        handleApiRequest(request, DOC_STATUS);
+    });
+    server.on("/api/history", HTTP_GET, [](AsyncWebServerRequest* request) {
+        handleApiRequest(request, DOC_HISTORY);
+    });
+}
+
+// ===== ベンチマーク =====
+// 応答と同じ経路（fillApiStream）でTCPの1セグメント分のバッファに繰り返し書き出し、
+// 文書あたりの時間・スループットを出力する（シリアライズ単体の速度）。
+// リクエストあたりのヒープ使用量はライブラリの確保を含めて実際の応答で計測し、
+// /api/status の api.heap_peak_* で返す（tools/http_load_test.py --heap で負荷をかけて確認）。
+// 履歴が空の場合は現在値で満杯まで埋めて計測し、終わったら消す
+static void benchmarkDocument(uint8_t document, const char* label) {
+    static ApiStream stream;
+    static uint8_t chunk[1436];  // TCP MSS相当
+    const int iterations = 20;
+
+    uint32_t bytes = 0;
+    uint32_t chunks = 0;
+
+    unsigned long start = micros();
+    for (int i = 0; i < iterations; i++) {
+        beginStream(stream, document);
+        size_t n;
+        while ((n = fillApiStream(stream, chunk, sizeof(chunk))) > 0) {
+            bytes += n;
+            chunks++;
+        }
+    }
+    unsigned long elapsed = micros() - start;
+
+    Serial.print(label);
+    Serial.print(": ");
+    Serial.print(bytes / iterations);
+    Serial.print(" bytes/doc in ");
+    Serial.print(chunks / iterations);
+    Serial.print(" chunks, ");
+    Serial.print(elapsed / iterations);
+    Serial.print(" us/doc, ");
+    Serial.print(elapsed > 0 ? (float)bytes / elapsed * 1000.0 : 0.0, 0);
+    Serial.println(" KB/s");
+}
+
+void benchmarkStatusApi() {
+    uint32_t first, end;
+    getHistoryRange(&first, &end);
+    bool synthetic = (end == first);
+    if (synthetic) {
+        for (int i = 0; i < HISTORY_SIZE; i++) recordHistorySample();
+    }
+
+    Serial.println("=== Status API benchmark ===");
+    benchmarkDocument(DOC_STATUS, "/api/status");
+    benchmarkDocument(DOC_HISTORY, "/api/history");
+    Serial.print("Unit overflows so far: ");
+    Serial.println(unitOverflows);
+
+    if (synthetic) clearHistory();
+}
\ No newline at end of file
@@ -0,0 +1,192 @@
+#include <Arduino.h>
+#include <AsyncTCP.h>
+#include <ESPAsyncWebServer.h>
+#include "telemetry.hpp"
+#include "temperature.hpp"
+#include "speed.hpp"
+
+struct __attribute__((packed)) TelemetryFrame {
+    uint8_t version;
+    uint8_t probeMask;
+    uint16_t sequence;
+    uint32_t timestampMs;
+    int16_t temperature[PROBE_COUNT];
+    int16_t speed;
+    int16_t accel[3];
+    int16_t gyro[3];
+};
+
+// クライアントごとの配信設定（イベントはAsyncTCPタスク、配信はメインループから触る）
+struct TelemetryClient {
+    uint32_t id;           // 0なら空き
+    uint16_t intervalMs;
+    uint32_t nextDue;
+};
+
+static AsyncWebSocket telemetrySocket("/ws");
+static TelemetryClient clients[TELEMETRY_MAX_CLIENTS];
+static portMUX_TYPE clientsLock = portMUX_INITIALIZER_UNLOCKED;
+static uint16_t frameSequence = 0;
+static uint32_t droppedFrames = 0;
+
+static void addClient(uint32_t id) {
+    portENTER_CRITICAL(&clientsLock);
+    for (int i = 0; i < TELEMETRY_MAX_CLIENTS; i++) {
+        if (clients[i].id == 0) {
+            clients[i].id = id;
+            clients[i].intervalMs = 1000 / TELEMETRY_DEFAULT_HZ;
+            clients[i].nextDue = millis();
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&clientsLock);
+}
+
+static void removeClient(uint32_t id) {
+    portENTER_CRITICAL(&clientsLock);
+    for (int i = 0; i < TELEMETRY_MAX_CLIENTS; i++) {
+        if (clients[i].id == id) {
+            clients[i].id = 0;
+        }
+    }
+    portEXIT_CRITICAL(&clientsLock);
+}
+
+static void setClientRate(uint32_t id, int hz) {
+    hz = constrain(hz, 1, TELEMETRY_MAX_HZ);
+    portENTER_CRITICAL(&clientsLock);
+    for (int i = 0; i < TELEMETRY_MAX_CLIENTS; i++) {
+        if (clients[i].id == id) {
+            clients[i].intervalMs = 1000 / hz;
+        }
+    }
+    portEXIT_CRITICAL(&clientsLock);
+}
+
+// "rate=<Hz>" を解釈する（1フレームに収まる短いテキストのみ）
+static void handleClientMessage(AsyncWebSocketClient* client, void* arg, uint8_t* data, size_t len) {
+    AwsFrameInfo* info = (AwsFrameInfo*)arg;
+    if (!info->final || info->index != 0 || info->len != len || info->opcode != WS_TEXT) return;
+    
+    char text[16];
+    size_t n = min(len, sizeof(text) - 1);
+    memcpy(text, data, n);
+    text[n] = '\0';
+    
+    int hz;
+    if (sscanf(text, "rate=%d", &hz) == 1) {
+        setClientRate(client->id(), hz);
+        Serial.print("Telemetry client ");
+        Serial.print(client->id());
+        Serial.print(" rate: ");
+        Serial.print(constrain(hz, 1, TELEMETRY_MAX_HZ));
+        Serial.println(" Hz");
+    }
+}
+
+static void onTelemetryEvent(AsyncWebSocket* socket, AsyncWebSocketClient* client,
+                             AwsEventType type, void* arg, uint8_t* data, size_t len) {
+    switch (type) {
+        case WS_EVT_CONNECT:
+            if (socket->count() > TELEMETRY_MAX_CLIENTS) {
+                client->close();  // 上限を超えた接続は受け付けない
+                return;
+            }
+            addClient(client->id());
+            Serial.print("Telemetry client connected: ");
+            Serial.println(client->id());
+            break;
+        case WS_EVT_DISCONNECT:
+            removeClient(client->id());
+            Serial.print("Telemetry client disconnected: ");
+            Serial.println(client->id());
+            break;
+        case WS_EVT_DATA:
+            handleClientMessage(client, arg, data, len);
+            break;
+        default:
+            break;
+    }
+}
+
+void initTelemetry(AsyncWebServer& server) {
+    memset(clients, 0, sizeof(clients));
+    telemetrySocket.onEvent(onTelemetryEvent);
+    server.addHandler(&telemetrySocket);
+}
+
+static int16_t toCenti(float value) {
+    return (int16_t)constrain(lroundf(value * 100.0f), -32768L, 32767L);
+}
+
+// 最新の値から1フレームを組み立てる（キャッシュ値の読み出しのみ、バス通信なし）
+static void buildFrame(TelemetryFrame* frame) {
+    frame->version = TELEMETRY_VERSION;
+    frame->probeMask = 0;
+    frame->sequence = frameSequence++;
+    frame->timestampMs = millis();
+    for (int probe = 0; probe < PROBE_COUNT; probe++) {
+        bool valid = isProbeValid((TempProbe)probe);
+        if (valid) frame->probeMask |= (1 << probe);
+        frame->temperature[probe] = valid ? toCenti(getProbeTemperature((TempProbe)probe)) : 0;
+    }
+    frame->speed = toCenti(getCachedSpeed());
+    
+    ImuSample sample;
+    memset(&sample, 0, sizeof(sample));
+    uint32_t cursor = getImuWriteIndex() - 1;  // 直近の1サンプルだけを読む
+    if (isImuFifoActive() && getImuWriteIndex() > 0) {
+        readImuSamples(&cursor, &sample, 1);
+    }
+    frame->accel[0] = sample.ax;
+    frame->accel[1] = sample.ay;
+    frame->accel[2] = sample.az;
+    frame->gyro[0] = sample.gx;
+    frame->gyro[1] = sample.gy;
+    frame->gyro[2] = sample.gz;
+}
+
+// 送信はメインループ（Core 1）から行う。ESP32Async版ライブラリはクライアント一覧と
+// 送信キューを内部のmutexで保護しているので、ここではIDで指定するAPIだけを使い、
+// クライアントのポインターは保持しない（切断でAsyncTCPタスクが解放するため）
+void updateTelemetry() {
+    uint32_t now = millis();
+    uint32_t due[TELEMETRY_MAX_CLIENTS];
+    int dueCount = 0;
+    
+    // 配信時刻の来たクライアントを集める
+    portENTER_CRITICAL(&clientsLock);
+    for (int i = 0; i < TELEMETRY_MAX_CLIENTS; i++) {
+        TelemetryClient& c = clients[i];
+        if (c.id == 0 || (int32_t)(now - c.nextDue) < 0) continue;
+        due[dueCount++] = c.id;
+        // 遅れても追いつこうとせず、次の周期から数え直す
+        c.nextDue = now + c.intervalMs;
+    }
+    portEXIT_CRITICAL(&clientsLock);
+    
+    if (dueCount == 0) {
+        telemetrySocket.cleanupClients();
+        return;
+    }
+    
+    // 共有バッファを1回だけ作り、各クライアントのキューには参照（shared_ptr）を積む
+    AsyncWebSocketSharedBuffer buffer = std::make_shared<std::vector<uint8_t>>(sizeof(TelemetryFrame));
+    buildFrame((TelemetryFrame*)buffer->data());
+    
+    for (int i = 0; i < dueCount; i++) {
+        if (!telemetrySocket.availableForWrite(due[i])) {
+            droppedFrames++;  // 送信キューが詰まっている。このクライアントは次の周期まで飛ばす
+            continue;
+        }
+        telemetrySocket.binary(due[i], buffer);  // 切断済みなら何もしない
+    }
+}
+
+int getTelemetryClientCount() {
+    return telemetrySocket.count();
+}
+
+uint32_t getTelemetryDroppedFrames() {
+    return droppedFrames;
+}
\ No newline at end of file
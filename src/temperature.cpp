@@ -1,16 +1,178 @@
 #include <OneWire.h>
 #include <DallasTemperature.h>
+#include <Preferences.h>
 #include "temperature.hpp"
 
 #define ONE_WIRE_BUS 25
 #define TEMP_PRECISION 12  // 12ビット精度（0.0625℃単位）
+#define TEMP_SAMPLE_INTERVAL 1000  // 全プローブの更新周期（ms）
+#define PROBE_NVS_NAMESPACE "tprobe"  // ROM割り当てを保存するNVS名前空間
+#define PROBE_NVS_KEY "roms"
+
+// 変換ステートマシンの状態
+enum ConversionState {
+  CONV_IDLE,     // 次の変換開始待ち
+  CONV_PENDING,  // 全プローブ一斉変換中（結果待ち）
+  CONV_READOUT   // 1周回に1プローブずつスクラッチパッドを回収中
+};
+
+// プローブ1本分の状態
+struct ProbeSlot {
+  DeviceAddress rom;          // 割り当て済みROMアドレス
+  bool assigned;              // バス上に存在し役割に割り当て済み
+  bool valid;                 // 有効なサンプルを保持しているか
+  float temp;                 // 最新の有効値
+  unsigned long lastUpdate;   // 最新値の取得時刻
+};
+
+// プローブ名（役割順、フラッシュ上の定数）
+static const char* const probeNames[PROBE_COUNT] = {
+  "Cabin",
+  "Engine",
+  "Outside",
+  "Battery"
+};
 
 // staticインスタンスでメモリリーク回避
 static OneWire oneWire(ONE_WIRE_BUS);
 static DallasTemperature sensors(&oneWire);
 static bool sensorReady = false;
-static unsigned long lastReadTime = 0;
-static float lastValidTemp = 20.0;  // デフォルト値
+static ProbeSlot probes[PROBE_COUNT];
+static int assignedCount = 0;
+static ConversionState convState = CONV_IDLE;
+static unsigned long conversionStartTime = 0;
+static unsigned long conversionTime = 750;  // 解像度から算出した変換待ち時間
+static int readoutIndex = 0;                // 次に回収するプローブ
+
+static bool isSameRom(const uint8_t* a, const uint8_t* b) {
+  return memcmp(a, b, sizeof(DeviceAddress)) == 0;
+}
+
+static void printRom(const uint8_t* rom) {
+  for (int i = 0; i < 8; i++) {
+    if (rom[i] < 16) Serial.print("0");
+    Serial.print(rom[i], HEX);
+  }
+}
+
+// ===== プローブレジストリ =====
+// バス検索は起動時の1回だけ行い、NVSに保存済みの役割割り当てと照合する
+static void buildProbeRegistry() {
+  DeviceAddress saved[PROBE_COUNT];
+  memset(saved, 0, sizeof(saved));
+  
+  Preferences prefs;
+  prefs.begin(PROBE_NVS_NAMESPACE, true);
+  bool hasSaved = (prefs.getBytesLength(PROBE_NVS_KEY) == sizeof(saved));
+  if (hasSaved) {
+    prefs.getBytes(PROBE_NVS_KEY, saved, sizeof(saved));
+  }
+  prefs.end();
+  
+  // バス上のデバイスを列挙
+  int deviceCount = sensors.getDeviceCount();
+  DeviceAddress found[PROBE_COUNT];
+  int foundCount = 0;
+  for (int i = 0; i < deviceCount && foundCount < PROBE_COUNT; i++) {
+    if (sensors.getAddress(found[foundCount], i)) {
+      foundCount++;
+    }
+  }
+  if (deviceCount > PROBE_COUNT) {
+    Serial.println("Too many probes on bus - extra probes ignored");
+  }
+  
+  bool used[PROBE_COUNT] = { false };
+  
+  // 1. 保存済みの割り当てを優先（配線を差し替えても役割が変わらない）
+  for (int role = 0; role < PROBE_COUNT && hasSaved; role++) {
+    for (int j = 0; j < foundCount; j++) {
+      if (!used[j] && isSameRom(saved[role], found[j])) {
+        memcpy(probes[role].rom, found[j], sizeof(DeviceAddress));
+        probes[role].assigned = true;
+        used[j] = true;
+        break;
+      }
+    }
+  }
+  
+  // 2. 新しいプローブは空いている役割に検出順で割り当て。
+  //    車室内（UI全体が使う値）は保存済みのプローブが見つからなければ最初に埋める
+  //    （1本構成でプローブを交換した場合も車室内として扱う）
+  bool changed = false;
+  for (int j = 0; j < foundCount; j++) {
+    if (used[j]) continue;
+    for (int role = 0; role < PROBE_COUNT; role++) {
+      bool reserved = hasSaved && saved[role][0] != 0 && role != PROBE_CABIN;
+      if (!probes[role].assigned && !reserved) {
+        memcpy(probes[role].rom, found[j], sizeof(DeviceAddress));
+        probes[role].assigned = true;
+        used[j] = true;
+        changed = true;
+        break;
+      }
+    }
+  }
+  
+  // 3. 保存済みの役割が埋まっていて割り当て先がない場合は、欠品中の役割を上書き
+  for (int j = 0; j < foundCount; j++) {
+    if (used[j]) continue;
+    for (int role = 0; role < PROBE_COUNT; role++) {
+      if (!probes[role].assigned) {
+        memcpy(probes[role].rom, found[j], sizeof(DeviceAddress));
+        probes[role].assigned = true;
+        used[j] = true;
+        changed = true;
+        break;
+      }
+    }
+  }
+  
+  // 割り当てに変更があった時だけNVSへ書き込む（フラッシュ摩耗防止）
+  if (changed || !hasSaved) {
+    DeviceAddress table[PROBE_COUNT];
+    for (int role = 0; role < PROBE_COUNT; role++) {
+      if (probes[role].assigned) {
+        memcpy(table[role], probes[role].rom, sizeof(DeviceAddress));
+      } else {
+        memcpy(table[role], saved[role], sizeof(DeviceAddress));  // 欠品中の役割は保持
+      }
+    }
+    prefs.begin(PROBE_NVS_NAMESPACE, false);
+    prefs.putBytes(PROBE_NVS_KEY, table, sizeof(table));
+    prefs.end();
+    Serial.println("Probe registry saved to NVS");
+  }
+  
+  assignedCount = 0;
+  for (int role = 0; role < PROBE_COUNT; role++) {
+    Serial.print("Probe ");
+    Serial.print(probeNames[role]);
+    Serial.print(": ");
+    if (probes[role].assigned) {
+      printRom(probes[role].rom);
+      Serial.println();
+      assignedCount++;
+    } else {
+      Serial.println("not connected");
+    }
+  }
+}
+
+// 全プローブの変換を一斉に開始してすぐに戻る（Skip ROMコマンド）
+static void startConversion(unsigned long now) {
+  sensors.requestTemperatures();
+  conversionStartTime = now;
+  convState = CONV_PENDING;
+}
+
+// 割り当て済みの次のプローブを探す（なければPROBE_COUNT）
+static int nextAssignedProbe(int from) {
+  for (int role = from; role < PROBE_COUNT; role++) {
+    if (probes[role].assigned) return role;
+  }
+  return PROBE_COUNT;
+}
 
 void initTemperatureSensor() {
   Serial.println("Initializing temperature sensor...");
@@ -23,10 +185,31 @@ void initTemperatureSensor() {
   Serial.print(deviceCount);
   Serial.println(" temperature sensor(s)");
   
+  for (int role = 0; role < PROBE_COUNT; role++) {
+    probes[role].assigned = false;
+    probes[role].valid = false;
+    probes[role].temp = 20.0;  // デフォルト値
+    probes[role].lastUpdate = 0;
+  }
+  
   if (deviceCount > 0) {
-    // 精度設定
-    sensors.setResolution(TEMP_PRECISION);
+    buildProbeRegistry();
+  }
+  
+  if (assignedCount > 0) {
+    // 精度設定（アドレス指定）
+    for (int role = 0; role < PROBE_COUNT; role++) {
+      if (probes[role].assigned) {
+        sensors.setResolution(probes[role].rom, TEMP_PRECISION);
+      }
+    }
+    // requestTemperatures系を非ブロッキングにする（750ms待ちをしない）
+    sensors.setWaitForConversion(false);
+    conversionTime = sensors.millisToWaitForConversion(TEMP_PRECISION);
     sensorReady = true;
+    
+    // 初回変換を開始しておく
+    startConversion(millis());
     Serial.println("Temperature sensor ready!");
   } else {
     Serial.println("No temperature sensor found!");
@@ -34,32 +217,78 @@ void initTemperatureSensor() {
   }
 }
 
-float readTemperatureC() {
-  if (!sensorReady) {
-    Serial.println("Temperature sensor not ready");
-    return lastValidTemp;
-  }
+// メインループから毎周回呼び出す。1回の呼び出しでバス通信は最大1トランザクション
+void updateTemperatureSensor() {
+  if (!sensorReady) return;
   
-  // 750ms以内の連続読み取りを防ぐ（DS18B20の変換時間）
   unsigned long currentTime = millis();
-  if (currentTime - lastReadTime < 750) {
-    return lastValidTemp;
-  }
   
-  sensors.requestTemperatures();
-  float temp = sensors.getTempCByIndex(0);
-  
-  // 有効な値かチェック
-  if (temp != DEVICE_DISCONNECTED_C && temp > -55.0 && temp < 125.0) {
-    lastValidTemp = temp;
-    lastReadTime = currentTime;
-    return temp;
-  } else {
-    Serial.println("Invalid temperature reading");
-    return lastValidTemp;  // 前回の有効値を返す
+  switch (convState) {
+    case CONV_IDLE:
+      if (currentTime - conversionStartTime >= TEMP_SAMPLE_INTERVAL) {
+        startConversion(currentTime);
+      }
+      break;
+      
+    case CONV_PENDING:
+      // DS18B20の変換時間が経過するまでは何もしない
+      if (currentTime - conversionStartTime >= conversionTime) {
+        readoutIndex = nextAssignedProbe(0);
+        convState = CONV_READOUT;
+      }
+      break;
+      
+    case CONV_READOUT: {
+      if (readoutIndex >= PROBE_COUNT) {
+        convState = CONV_IDLE;
+        break;
+      }
+      
+      ProbeSlot& probe = probes[readoutIndex];
+      float temp = sensors.getTempC(probe.rom);
+      
+      // 有効な値かチェック
+      if (temp != DEVICE_DISCONNECTED_C && temp > -55.0 && temp < 125.0) {
+        probe.temp = temp;
+        probe.valid = true;
+        probe.lastUpdate = currentTime;
+      } else {
+        Serial.print("Invalid temperature reading: ");
+        Serial.println(probeNames[readoutIndex]);  // 前回の有効値を保持
+      }
+      
+      readoutIndex = nextAssignedProbe(readoutIndex + 1);
+      break;
+    }
   }
 }
 
 float getTemperature() {
-  return readTemperatureC();
+  // 他の役割のプローブ（エンジンルーム等）では代用しない。
+  // 車室内の値がない間はデフォルト値のまま（isProbeValid(PROBE_CABIN)で判別できる）
+  return probes[PROBE_CABIN].temp;
+}
+
+float getProbeTemperature(TempProbe probe) {
+  if (probe < 0 || probe >= PROBE_COUNT) return 20.0;
+  return probes[probe].temp;
+}
+
+bool isProbeValid(TempProbe probe) {
+  if (probe < 0 || probe >= PROBE_COUNT) return false;
+  return probes[probe].valid;
+}
+
+unsigned long getProbeLastUpdate(TempProbe probe) {
+  if (probe < 0 || probe >= PROBE_COUNT) return 0;
+  return probes[probe].lastUpdate;
+}
+
+const char* getProbeName(TempProbe probe) {
+  if (probe < 0 || probe >= PROBE_COUNT) return "Unknown";
+  return probeNames[probe];
+}
+
+int getProbeCount() {
+  return assignedCount;
 }
\ No newline at end of file
@@ -1,84 +1,160 @@
 #include "time.hpp"
 #include <time.h>
-#include <EEPROM.h>
+#include <sys/time.h>
+#include <atomic>
+#include <esp_timer.h>
+#include "journal.hpp"
 
-#define TIME_EEPROM_ADDRESS 100  // 温度センサー用と重複しないアドレス
+#define TIME_VALID_YEAR 116      // getLocalTime()と同じ判定（2016年以降なら設定済み）
+#define TIME_TICK_MARGIN_US 1000 // 秒の境界を確実に越えてから更新する
+
+// ===== 時刻キャッシュ =====
+// esp_timerタスクが毎秒（壁時計の秒の境界）に1回だけ変換・整形し、読み出し側は
+// シーケンスカウンタで整合性を確認してコピーする（書き込み側はesp_timerタスクのみ）
+static TimeSnapshot timeCache;
+static std::atomic<uint32_t> timeSequence(0);  // 奇数の間は書き込み中
+static esp_timer_handle_t timeTimer = NULL;
+
+static void updateTimeCache() {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    time_t now = tv.tv_sec;
+    struct tm local;
+    localtime_r(&now, &local);
+    
+    timeSequence.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    
+    timeCache.epoch = now;
+    timeCache.local = local;
+    timeCache.valid = (local.tm_year > TIME_VALID_YEAR);
+    if (timeCache.valid) {
+        snprintf(timeCache.time, sizeof(timeCache.time), "%02d:%02d", local.tm_hour, local.tm_min);
+        snprintf(timeCache.date, sizeof(timeCache.date), "%04d/%02d/%02d",
+                 local.tm_year + 1900, local.tm_mon + 1, local.tm_mday);
+        snprintf(timeCache.dateTime, sizeof(timeCache.dateTime), "%04d-%02d-%02d %02d:%02d:%02d",
+                 local.tm_year + 1900, local.tm_mon + 1, local.tm_mday,
+                 local.tm_hour, local.tm_min, local.tm_sec);
+    } else {
+        strcpy(timeCache.time, "--:--");
+        strcpy(timeCache.date, "----/--/--");
+        strcpy(timeCache.dateTime, "1970-01-01 00:00:00");
+    }
+    
+    std::atomic_thread_fence(std::memory_order_release);
+    timeSequence.fetch_add(1, std::memory_order_relaxed);
+}
+
+// 次の秒の境界まで待つワンショットタイマー（毎回張り直すので時刻設定にも追従する）
+static void timeTickCallback(void* arg) {
+    updateTimeCache();
+    
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    esp_timer_start_once(timeTimer, 1000000 - tv.tv_usec + TIME_TICK_MARGIN_US);
+}
+
+void getTimeSnapshot(TimeSnapshot* out) {
+    uint32_t before, after;
+    do {
+        before = timeSequence.load(std::memory_order_acquire);
+        *out = timeCache;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        after = timeSequence.load(std::memory_order_relaxed);
+    } while ((before & 1) || before != after);
+}
+
+void refreshTimeCache() {
+    if (timeTimer == NULL) {
+        updateTimeCache();  // タイマー起動前（setup中）は直接更新
+        return;
+    }
+    // 書き込みをesp_timerタスクに集約するため、タイマーを即時に張り直す
+    esp_timer_stop(timeTimer);
+    esp_timer_start_once(timeTimer, 1);
+}
 
 void initTimeSystem() {
     Serial.println("Initializing time system...");
     
-    // EEPROMから時刻復元を試行
-    restoreTimeFromEEPROM();
+    // ジャーナル（initJournalで読み込み済み）から時刻復元を試行
+    restoreTimeFromJournal();
+    
+    updateTimeCache();
+    esp_timer_create_args_t args = {};
+    args.callback = timeTickCallback;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "time_tick";
+    esp_timer_create(&args, &timeTimer);
+    esp_timer_start_once(timeTimer, 1);
     
     Serial.println("Time system ready");
 }
 
 void saveCurrentTime() {
-    time_t now;
-    time(&now);
-    
-    // EEPROMに現在時刻を保存
-    EEPROM.put(TIME_EEPROM_ADDRESS, now);
-    EEPROM.commit();
+    // ジャーナルへの記録を要求（NVS書き込みはメインループのupdateJournalで行い、
+    // 呼び出し元のWebサーバータスクを待たせない）
+    requestJournalCheckpoint();
     
-    Serial.print("Time saved to EEPROM: ");
-    Serial.println(now);
+    Serial.println("Time save to journal requested");
 }
 
-void restoreTimeFromEEPROM() {
-    time_t savedTime;
-    EEPROM.get(TIME_EEPROM_ADDRESS, savedTime);
+void restoreTimeFromJournal() {
+    time_t savedTime = getJournalTime();
     
     // 有効な時刻かチェック（2024年以降）
     if (savedTime > 1700000000) {
         struct timeval tv = { savedTime, 0 };
         settimeofday(&tv, NULL);
+        refreshTimeCache();
         
-        Serial.print("Time restored from EEPROM: ");
+        Serial.print("Time restored from journal: ");
         Serial.println(getCurrentTimeString());
     } else {
-        Serial.println("No valid time found in EEPROM");
+        Serial.println("No valid time found in journal");
     }
 }
 
-String getCurrentTimeString() {
-    struct tm timeinfo;
-    // 重要: 短いタイムアウト（100ms）を設定してブロッキングを防止
-    if (!getLocalTime(&timeinfo, 100)) {
-        return "1970-01-01 00:00:00";
-    }
-    
-    char buffer[20];
-    strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", &timeinfo);
-    return String(buffer);
+// 以下はUIループ用（呼び出し元ごとの固定バッファを返す、ヒープ確保・待ちなし）
+const char* getCurrentTimeString() {
+    static char buffer[20];
+    TimeSnapshot snapshot;
+    getTimeSnapshot(&snapshot);
+    memcpy(buffer, snapshot.dateTime, sizeof(buffer));
+    return buffer;
 }
 
-String getCurrentTime() {
-    struct tm timeinfo;
-    // 重要: 短いタイムアウト（50ms）を設定してメインループの遅延を防止
-    if (!getLocalTime(&timeinfo, 50)) {
-        return "--:--";
-    }
-    
-    char timeStr[6];
-    strftime(timeStr, sizeof(timeStr), "%H:%M", &timeinfo);
-    return String(timeStr);
+const char* getCurrentTime() {
+    static char timeStr[6];
+    TimeSnapshot snapshot;
+    getTimeSnapshot(&snapshot);
+    memcpy(timeStr, snapshot.time, sizeof(timeStr));
+    return timeStr;
+}
+
+const char* getCurrentDate() {
+    static char dateStr[11];
+    TimeSnapshot snapshot;
+    getTimeSnapshot(&snapshot);
+    memcpy(dateStr, snapshot.date, sizeof(dateStr));
+    return dateStr;
 }
 
-String getCurrentDate() {
-    struct tm timeinfo;
-    // 重要: 短いタイムアウト（50ms）を設定してメインループの遅延を防止
-    if (!getLocalTime(&timeinfo, 50)) {
-        return "----/--/--";
+bool getCurrentClockTime(int* hour, int* minute, int* second) {
+    TimeSnapshot snapshot;
+    getTimeSnapshot(&snapshot);
+    if (!snapshot.valid) {
+        return false;
     }
     
-    char dateStr[11];
-    strftime(dateStr, sizeof(dateStr), "%Y/%m/%d", &timeinfo);
-    return String(dateStr);
+    *hour = snapshot.local.tm_hour;
+    *minute = snapshot.local.tm_min;
+    *second = snapshot.local.tm_sec;
+    return true;
 }
 
 bool isTimeValid() {
-    struct tm timeinfo;
-    // 短いタイムアウトで同期状態をチェック
-    return getLocalTime(&timeinfo, 100);
+    TimeSnapshot snapshot;
+    getTimeSnapshot(&snapshot);
+    return snapshot.valid;
 }
\ No newline at end of file
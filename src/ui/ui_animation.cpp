@@ -0,0 +1,106 @@
+#include <Arduino.h>
+#include "../../include/ui/ui_animation.hpp"
+#include "../../include/ui/ui_character.hpp"
+#include "../../include/temperature.hpp"
+
+#define HOT_TEMP_THRESHOLD 32.0   // キャラクターを高温用に切り替える温度
+#define HOT_TEMP_HYSTERESIS 0.3   // 閾値付近でクリップを繰り返さないための幅
+
+// ===== クリップ定義 =====
+
+// 高温域に入った時：じわっと暑くなり、二度見する
+static const AnimationFrame heatReactionFrames[] = {
+    { POSE_HOT,    300, ANIM_CROSSFADE },
+    { POSE_NORMAL, 150, ANIM_CUT },
+    { POSE_HOT,      0, ANIM_CUT },
+};
+static const AnimationClip heatReactionClip = { "heat", heatReactionFrames, 3 };
+
+// 高温域から戻った時
+static const AnimationFrame coolDownFrames[] = {
+    { POSE_NORMAL, 0, ANIM_CROSSFADE },
+};
+static const AnimationClip coolDownClip = { "cool", coolDownFrames, 1 };
+
+// ===== 再生状態 =====
+static const AnimationClip* currentClip = NULL;
+static uint8_t frameIndex = 0;
+static bool frameShown = false;        // 現在のフレームのポーズが画面に出きったか
+static unsigned long frameStart = 0;
+static bool hotBand = false;
+
+static CharacterPoseId restPose() {
+    return hotBand ? POSE_HOT : POSE_NORMAL;
+}
+
+static void showFrame(const AnimationFrame& frame) {
+    const CharacterPose* pose = getCharacterPoseById(frame.pose);
+    if (frame.transition == ANIM_CROSSFADE) {
+        crossfadeCharacterPose(pose);
+    } else {
+        setCharacterPose(pose);
+    }
+}
+
+void initCharacterAnimation() {
+    hotBand = (getTemperature() >= HOT_TEMP_THRESHOLD);
+    currentClip = NULL;
+    setCharacterPose(getCharacterPoseById(restPose()));
+    Serial.println("Character animation initialized");
+}
+
+void playCharacterClip(const AnimationClip* clip) {
+    if (clip == NULL || clip->frameCount == 0) return;
+    
+    currentClip = clip;
+    frameIndex = 0;
+    frameShown = false;
+    showFrame(clip->frames[0]);
+    
+    Serial.print("Character clip: ");
+    Serial.println(clip->name);
+}
+
+// フレームの表示時間を管理し、必要ならクリップを次のフレームへ進める
+static void advanceClip(unsigned long now) {
+    if (!frameShown) {
+        if (!isCharacterPoseSettled()) return;  // 転送中（表示時間はまだ数えない）
+        frameShown = true;
+        frameStart = now;
+    }
+    
+    const AnimationFrame& frame = currentClip->frames[frameIndex];
+    bool last = (frameIndex + 1 >= currentClip->frameCount);
+    if (frame.durationMs == 0 || (last && now - frameStart >= frame.durationMs)) {
+        // 最終ポーズを保持して終了し、現在の温度域のポーズへ戻す
+        currentClip = NULL;
+        setCharacterPose(getCharacterPoseById(restPose()));
+        return;
+    }
+    if (now - frameStart < frame.durationMs) return;
+    
+    frameIndex++;
+    frameShown = false;
+    showFrame(currentClip->frames[frameIndex]);
+}
+
+void updateCharacterAnimation() {
+    unsigned long now = millis();
+    float temp = getTemperature();
+    
+    // 温度域の変化でリアクションを再生（再生中のクリップより優先）
+    if (!hotBand && temp >= HOT_TEMP_THRESHOLD) {
+        hotBand = true;
+        playCharacterClip(&heatReactionClip);
+    } else if (hotBand && temp < HOT_TEMP_THRESHOLD - HOT_TEMP_HYSTERESIS) {
+        hotBand = false;
+        playCharacterClip(&coolDownClip);
+    }
+    
+    if (currentClip != NULL) {
+        advanceClip(now);
+    }
+    
+    // 転送は予算内で行い、残りは次のループへ持ち越す
+    updateCharacterPose(ANIMATION_SPI_BUDGET);
+}
\ No newline at end of file
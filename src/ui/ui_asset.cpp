@@ -0,0 +1,52 @@
+#include <Arduino.h>
+#include "../../include/ui/ui_asset.hpp"
+
+#define PACKED_ESCAPE 0xFF
+
+// シンボル1つを読み出す（パレット番号、またはエスケープ後の画素値そのもの）
+static inline uint16_t readPackedSymbol(const uint8_t*& p, const uint16_t* palette) {
+    uint8_t s = pgm_read_byte(p++);
+    if (s != PACKED_ESCAPE) {
+        return pgm_read_word(&palette[s]);
+    }
+    uint16_t value = pgm_read_byte(p) | (pgm_read_byte(p + 1) << 8);
+    p += 2;
+    return value;
+}
+
+int decodePackedRow(const PackedImage* image, int row, uint16_t* out, const uint8_t* repeat) {
+    const uint8_t* p = image->data + pgm_read_dword(&image->rows[row]);
+    const uint16_t* palette = image->palette;
+    uint16_t* o = out;
+    int x = 0;
+    
+    while (x < image->width) {
+        uint8_t token = pgm_read_byte(p++);
+        int count = (token & 0x7F) + 1;
+        
+        if (token & 0x80) {
+            // 同じ色の連続
+            uint16_t value = readPackedSymbol(p, palette);
+            if (repeat == NULL) {
+                for (int n = 0; n < count; n++) *o++ = value;
+            } else {
+                int total = 0;
+                for (int n = 0; n < count; n++) total += repeat[x + n];
+                for (int n = 0; n < total; n++) *o++ = value;
+            }
+            x += count;
+        } else {
+            // 非圧縮の並び
+            for (int n = 0; n < count; n++, x++) {
+                uint16_t value = readPackedSymbol(p, palette);
+                if (repeat == NULL) {
+                    *o++ = value;
+                } else {
+                    for (int r = repeat[x]; r > 0; r--) *o++ = value;
+                }
+            }
+        }
+    }
+    
+    return o - out;
+}
\ No newline at end of file
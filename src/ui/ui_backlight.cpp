@@ -0,0 +1,78 @@
+#include <Arduino.h>
+#include "../../include/ui/ui_backlight.hpp"
+#include "../../include/time.hpp"
+
+#ifdef TFT_BL
+#include <driver/ledc.h>
+#endif
+
+#define BACKLIGHT_RESOLUTION 8           // PWM分解能（ビット）
+#define BACKLIGHT_SCHEDULE_FADE_MS 2000  // 昼夜切り替えのフェード時間
+
+static uint8_t backlightLevel = 0;
+static bool backlightReady = false;
+
+void initBacklight() {
+#ifdef TFT_BL
+    // TFT_eSPIのinit()がピンをHIGHにしているので、LEDCに付け替えて消灯から始める
+    ledcSetup(BACKLIGHT_CHANNEL, BACKLIGHT_FREQUENCY, BACKLIGHT_RESOLUTION);
+    ledcAttachPin(TFT_BL, BACKLIGHT_CHANNEL);
+    ledcWrite(BACKLIGHT_CHANNEL, 0);
+    ledc_fade_func_install(0);
+    backlightLevel = 0;
+    backlightReady = true;
+    
+    Serial.print("Backlight PWM on GPIO");
+    Serial.println(TFT_BL);
+#else
+    Serial.println("Backlight control unavailable (TFT_BL not defined)");
+#endif
+}
+
+bool isBacklightAvailable() {
+    return backlightReady;
+}
+
+void setBacklight(uint8_t level) {
+    backlightLevel = level;
+    if (!backlightReady) return;
+#ifdef TFT_BL
+    ledcWrite(BACKLIGHT_CHANNEL, level);
+#endif
+}
+
+void fadeBacklight(uint8_t level, uint16_t durationMs) {
+    backlightLevel = level;
+    if (!backlightReady) return;
+#ifdef TFT_BL
+    // 高速グループのチャンネル（Arduinoのチャンネル0〜7）をハードウェアでフェード
+    ledc_set_fade_time_and_start(LEDC_HIGH_SPEED_MODE, (ledc_channel_t)BACKLIGHT_CHANNEL,
+                                 level, durationMs, LEDC_FADE_NO_WAIT);
+#endif
+}
+
+uint8_t getBacklightLevel() {
+    return backlightLevel;
+}
+
+uint8_t getScheduledBacklightLevel() {
+    TimeSnapshot now;
+    getTimeSnapshot(&now);
+    if (!now.valid) {
+        return BACKLIGHT_DAY;  // 時刻未設定
+    }
+    
+    bool night = (now.local.tm_hour >= BACKLIGHT_NIGHT_START || now.local.tm_hour < BACKLIGHT_NIGHT_END);
+    return night ? BACKLIGHT_NIGHT : BACKLIGHT_DAY;
+}
+
+void updateBacklightSchedule() {
+    if (!backlightReady || backlightLevel == 0) return;  // 起動演出中・消灯中は触らない
+    
+    uint8_t level = getScheduledBacklightLevel();
+    if (level == backlightLevel) return;
+    
+    Serial.print("Backlight: ");
+    Serial.println(level == BACKLIGHT_NIGHT ? "night dimming" : "day");
+    fadeBacklight(level, BACKLIGHT_SCHEDULE_FADE_MS);
+}
\ No newline at end of file
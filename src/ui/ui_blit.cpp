@@ -0,0 +1,373 @@
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "../../include/ui/ui_blit.hpp"
+#include "../../include/ui/ui_temperature.hpp"
+#include "../../include/ui/ui_framebuffer.hpp"
+#include "../../include/ui/ui_asset.hpp"
+
+extern TFT_eSPI tft;
+
+#define EDGE_FADE_WIDTH 8  // 縁ぼかし幅
+
+// ダブルバッファ（内部RAM上に確保、DMA転送可能）
+static uint16_t lineBuffers[2][BLIT_BUFFER_PIXELS];
+static uint8_t scaleTable[CHAR_DST_SIZE];  // 表示座標 → 元画像座標
+static uint8_t columnRepeat[CHAR_SRC_SIZE]; // 元画像の各列を表示で何画素に広げるか（デコーダー用）
+static uint8_t columnStart[CHAR_SRC_SIZE + 1]; // 元画像の各列が始まる表示座標（パッチの配置用）
+static uint16_t edgeAlpha[CHAR_DST_SIZE];  // 縁ぼかしマスク（縁からの距離で決まる重み、0〜256）
+static bool dmaEnabled = false;
+static bool blitterReady = false;
+
+void initCharacterBlitter() {
+    // 拡大率160/180を整数テーブルで解決（描画時の浮動小数点除算をなくす）
+    for (int i = 0; i < CHAR_DST_SIZE; i++) {
+        int src = (i * CHAR_SRC_SIZE) / CHAR_DST_SIZE;
+        if (src >= CHAR_SRC_SIZE) src = CHAR_SRC_SIZE - 1;
+        scaleTable[i] = (uint8_t)src;
+    }
+    memset(columnRepeat, 0, sizeof(columnRepeat));
+    for (int i = 0; i < CHAR_DST_SIZE; i++) {
+        columnRepeat[scaleTable[i]]++;
+    }
+    columnStart[0] = 0;
+    for (int i = 0; i < CHAR_SRC_SIZE; i++) {
+        columnStart[i + 1] = columnStart[i] + columnRepeat[i];
+    }
+    
+    // 縁ぼかしマスク：画素の重みは min(行方向, 列方向) で決まるため、
+    // 180x180の全マスクではなく1辺分（縁から EDGE_FADE_WIDTH 画素の帯）だけを持つ
+    for (int i = 0; i < CHAR_DST_SIZE; i++) {
+        int distance = min(i, CHAR_DST_SIZE - 1 - i);
+        if (distance < EDGE_FADE_WIDTH) {
+            // alpha = 0.3 + 0.7 × distance / fadeWidth を8ビット整数重みに
+            edgeAlpha[i] = (uint16_t)((77 * EDGE_FADE_WIDTH + 179 * distance + EDGE_FADE_WIDTH / 2) / EDGE_FADE_WIDTH);
+        } else {
+            edgeAlpha[i] = 256;
+        }
+    }
+    
+    // ラインバッファはスワップ済みで用意するため、ライブラリ側のスワップは無効にする
+    tft.setSwapBytes(false);
+    dmaEnabled = tft.initDMA();
+    blitterReady = true;
+    
+    Serial.print("Character blitter ready (DMA: ");
+    Serial.print(dmaEnabled ? "enabled" : "unavailable");
+    Serial.println(")");
+}
+
+bool isBlitterDMAEnabled() {
+    return dmaEnabled;
+}
+
+const uint8_t* getCharacterScaleTable() {
+    return scaleTable;
+}
+
+const uint8_t* getCharacterColumnRepeat() {
+    return columnRepeat;
+}
+
+// ポーズの1行（元画像の行）を180画素に拡大して展開する。ベース行の上にパッチ行を重ねる
+void decodeCharacterPoseRow(const CharacterPose* pose, int srcRow, uint16_t* out) {
+    decodePackedRow(pose->base, srcRow, out, columnRepeat);
+    
+    for (int i = 0; i < pose->patchCount; i++) {
+        const PosePatch& patch = pose->patches[i];
+        int patchRow = srcRow - patch.y;
+        if (patchRow < 0 || patchRow >= patch.image->height) continue;
+        decodePackedRow(patch.image, patchRow, out + columnStart[patch.x], columnRepeat + patch.x);
+    }
+}
+
+void blitRowsToPanel(int x, int y, int width, int height, BlitRowFn rowFn, void* ctx) {
+    if (!blitterReady) initCharacterBlitter();
+    if (width <= 0 || height <= 0 || width > BLIT_BUFFER_PIXELS) return;
+    
+    const int rowsPerChunk = BLIT_BUFFER_PIXELS / width;
+    int bufferIndex = 0;
+    
+    tft.startWrite();
+    for (int row = 0; row < height; row += rowsPerChunk) {
+        int rows = min(rowsPerChunk, height - row);
+        uint16_t* buf = lineBuffers[bufferIndex];
+        
+        // 直前に投げたDMAがもう一方のバッファを送っている間にこちらを生成する
+        for (int r = 0; r < rows; r++) {
+            rowFn(row + r, buf + r * width, width, ctx);
+        }
+        
+        if (dmaEnabled) {
+            // pushImageDMAは内部で前回の転送完了を待ってから次を投げる
+            tft.pushImageDMA(x, y + row, width, rows, buf);
+        } else {
+            tft.pushImage(x, y + row, width, rows, buf);
+        }
+        bufferIndex ^= 1;
+    }
+    if (dmaEnabled) {
+        tft.dmaWait();
+    }
+    tft.endWrite();
+}
+
+void blitRows(int x, int y, int width, int height, BlitRowFn rowFn, void* ctx) {
+    if (!isFrameBufferActive()) {
+        blitRowsToPanel(x, y, width, height, rowFn, ctx);
+        return;
+    }
+    
+    // フレームバッファ有効時は行を直接書き込み、転送はflushに任せる
+    if (x < 0 || x + width > FB_WIDTH || width <= 0) return;
+    uint16_t* fb = getFrameBufferPixels();
+    for (int row = 0; row < height; row++) {
+        int screenY = y + row;
+        if (screenY < 0 || screenY >= FB_HEIGHT) continue;
+        rowFn(row, &fb[screenY * FB_WIDTH + x], width, ctx);
+    }
+    markDirty(x, y, width, height);
+}
+
+// === キャラクター画像の拡大転送 ===
+
+struct CharacterBlitContext {
+    const CharacterPose* pose;
+    int lastSrcRow;        // 直前に生成した元画像の行
+    const uint16_t* lastOut;
+};
+
+// 圧縮データを列方向に拡大しながらラインバッファへ直接展開する
+static void characterRow(int row, uint16_t* out, int width, void* ctx) {
+    CharacterBlitContext* c = (CharacterBlitContext*)ctx;
+    int srcRow = scaleTable[row];
+    
+    // 拡大で同じ元行が続く場合は直前の行をコピーするだけ
+    if (srcRow == c->lastSrcRow && c->lastOut != NULL) {
+        memcpy(out, c->lastOut, width * sizeof(uint16_t));
+    } else {
+        decodeCharacterPoseRow(c->pose, srcRow, out);
+    }
+    c->lastSrcRow = srcRow;
+    c->lastOut = out;
+}
+
+void blitCharacterImage(int x, int y, const CharacterPose* pose) {
+    CharacterBlitContext ctx = { pose, -1, NULL };
+    blitRows(x, y, CHAR_DST_SIZE, CHAR_DST_SIZE, characterRow, &ctx);
+}
+
+// === 縁ぼかし付きキャラクター転送 ===
+
+struct EdgeFadeBlitContext {
+    const CharacterPose* pose;
+    int y;                 // 描画先の画面Y座標（背景行カラー参照用）
+    const uint16_t* rowColors;  // 背景グラデーションの行カラーテーブル
+    int decodedRow;        // decodedに展開済みの元画像の行
+    uint16_t decoded[CHAR_DST_SIZE];  // ブレンド前の拡大済み1行（スワップ済み）
+    int regionX, regionY;  // 部分転送時の切り出し位置（キャラクター内の表示座標）
+    uint16_t regionRow[CHAR_DST_SIZE];
+    const CharacterPose* fromPose;  // クロスフェード元（NULLならフェードなし）
+    uint32_t crossAlpha;            // 新ポーズの重み（0〜256）
+    uint16_t fromDecoded[CHAR_DST_SIZE];  // decodedと同じく4バイト境界（2画素ずつ読む）
+};
+
+// スワップ済み2画素のペアをネイティブ順に変換する（各16ビットレーン内でバイト交換）
+static inline uint32_t swapRGB565Pair(uint32_t v) {
+    return ((v & 0x00FF00FF) << 8) | ((v >> 8) & 0x00FF00FF);
+}
+
+// 2つのポーズの拡大済み行を2画素ずつブレンドしてtoへ書き戻す（スワップ済みのまま入出力）
+static void crossfadeRow(uint16_t* to, const uint16_t* from, int width, uint32_t alpha) {
+    uint32_t* dst = (uint32_t*)to;
+    const uint32_t* src = (const uint32_t*)from;
+    for (int i = 0; i < width / 2; i++) {
+        uint32_t blended = blendRGB565Pair(swapRGB565Pair(dst[i]), swapRGB565Pair(src[i]), alpha);
+        dst[i] = swapRGB565Pair(blended);
+    }
+}
+
+// 縁ぼかし用：拡大済みの行をコピーし、縁の帯だけ左右対称の2画素をまとめてブレンドする
+// （列 c と列 width-1-c はマスク値が常に等しいため、同じ重みで1回のSWAR演算にできる）
+static void edgeFadeRow(int row, uint16_t* out, int width, void* ctx) {
+    EdgeFadeBlitContext* c = (EdgeFadeBlitContext*)ctx;
+    int srcRow = scaleTable[row];
+    uint16_t rowAlpha = edgeAlpha[row];
+    
+    // 1. 元画像の行が変わった時だけデコードし、ブレンド前の行として保持
+    if (srcRow != c->decodedRow) {
+        decodeCharacterPoseRow(c->pose, srcRow, c->decoded);
+        if (c->fromPose != NULL) {
+            decodeCharacterPoseRow(c->fromPose, srcRow, c->fromDecoded);
+            crossfadeRow(c->decoded, c->fromDecoded, CHAR_DST_SIZE, c->crossAlpha);
+        }
+        c->decodedRow = srcRow;
+    }
+    memcpy(out, c->decoded, width * sizeof(uint16_t));
+    
+    // 2. ブレンド対象の列（帯の行なら全列、それ以外は左右の帯のみ）
+    uint16_t bg = c->rowColors[min(c->y + row, 239)];
+    uint32_t bgPair = ((uint32_t)bg << 16) | bg;
+    int blendCols = (rowAlpha == 256) ? EDGE_FADE_WIDTH : width / 2;
+    
+    for (int col = 0; col < blendCols; col++) {
+        int mirror = width - 1 - col;
+        uint16_t alpha = min(rowAlpha, edgeAlpha[col]);
+        if (alpha == 256) continue;
+        
+        uint16_t left = swapRGB565(c->decoded[col]);
+        uint16_t right = swapRGB565(c->decoded[mirror]);
+        uint32_t blended = blendRGB565Pair(((uint32_t)right << 16) | left, bgPair, alpha);
+        out[col] = swapRGB565((uint16_t)blended);
+        out[mirror] = swapRGB565((uint16_t)(blended >> 16));
+    }
+}
+
+static EdgeFadeBlitContext edgeFadeContext;  // 行バッファを含むためスタックに置かない
+
+static void prepareEdgeFade(int y, const CharacterPose* pose) {
+    edgeFadeContext.pose = pose;
+    edgeFadeContext.y = y;
+    edgeFadeContext.rowColors = getGradientRowTable(getCurrentBackgroundTemp());
+    edgeFadeContext.decodedRow = -1;
+    edgeFadeContext.fromPose = NULL;
+}
+
+void blitCharacterImageEdgeFade(int x, int y, const CharacterPose* pose) {
+    prepareEdgeFade(y, pose);
+    blitRows(x, y, CHAR_DST_SIZE, CHAR_DST_SIZE, edgeFadeRow, &edgeFadeContext);
+}
+
+// 部分転送用：縁ぼかし済みの1行を作り、矩形の範囲だけを切り出す
+static void edgeFadeRegionRow(int row, uint16_t* out, int width, void* ctx) {
+    EdgeFadeBlitContext* c = (EdgeFadeBlitContext*)ctx;
+    edgeFadeRow(c->regionY + row, c->regionRow, CHAR_DST_SIZE, ctx);
+    memcpy(out, &c->regionRow[c->regionX], width * sizeof(uint16_t));
+}
+
+// キャラクター内の表示座標の矩形（rx, ry, rw, rh）だけを転送する
+static void blitCharacterRegion(int x, int y, const CharacterPose* pose, int rx, int ry, int rw, int rh) {
+    if (rw <= 0 || rh <= 0) return;
+    prepareEdgeFade(y, pose);
+    edgeFadeContext.regionX = rx;
+    edgeFadeContext.regionY = ry;
+    blitRows(x + rx, y + ry, rw, rh, edgeFadeRegionRow, &edgeFadeContext);
+}
+
+// パッチの元画像座標の矩形を表示座標に変換して転送する（blit=falseなら転送量の計算のみ）
+static uint32_t blitPatchRegion(int x, int y, const CharacterPose* pose, const PosePatch& patch, bool blit) {
+    int rx0 = columnStart[patch.x];
+    int rx1 = columnStart[min(patch.x + patch.image->width, CHAR_SRC_SIZE)];
+    int ry0 = columnStart[patch.y];  // 縦横の拡大率は同じ
+    int ry1 = columnStart[min(patch.y + patch.image->height, CHAR_SRC_SIZE)];
+    if (blit) {
+        blitCharacterRegion(x, y, pose, rx0, ry0, rx1 - rx0, ry1 - ry0);
+    }
+    return (uint32_t)(rx1 - rx0) * (ry1 - ry0) * 2;
+}
+
+static uint32_t switchPose(int x, int y, const CharacterPose* from, const CharacterPose* to, bool blit) {
+    // ベースが異なる（キーフレーム同士など）場合は全体を転送
+    if (from == NULL || from->base != to->base) {
+        if (blit) {
+            blitCharacterImageEdgeFade(x, y, to);
+        }
+        return (uint32_t)CHAR_DST_SIZE * CHAR_DST_SIZE * 2;
+    }
+    
+    // 旧ポーズのパッチ範囲は新ポーズ（ベース+新パッチ）で描き直して消し、
+    // 新ポーズのパッチ範囲を描く。同じ矩形のパッチは1回だけ転送する
+    uint32_t bytes = 0;
+    for (int i = 0; i < from->patchCount; i++) {
+        const PosePatch& patch = from->patches[i];
+        bool sameRect = false;
+        for (int j = 0; j < to->patchCount; j++) {
+            const PosePatch& other = to->patches[j];
+            if (other.x == patch.x && other.y == patch.y &&
+                other.image->width == patch.image->width && other.image->height == patch.image->height) {
+                sameRect = true;
+                break;
+            }
+        }
+        if (sameRect) continue;
+        bytes += blitPatchRegion(x, y, to, patch, blit);
+    }
+    for (int i = 0; i < to->patchCount; i++) {
+        bytes += blitPatchRegion(x, y, to, to->patches[i], blit);
+    }
+    return bytes;
+}
+
+uint32_t blitCharacterPoseSwitch(int x, int y, const CharacterPose* from, const CharacterPose* to) {
+    return switchPose(x, y, from, to, true);
+}
+
+uint32_t getPoseSwitchBytes(const CharacterPose* from, const CharacterPose* to) {
+    return switchPose(0, 0, from, to, false);
+}
+
+void blitCharacterRows(int x, int y, const CharacterPose* pose, int row, int rows) {
+    rows = min(rows, CHAR_DST_SIZE - row);
+    blitCharacterRegion(x, y, pose, 0, row, CHAR_DST_SIZE, rows);
+}
+
+void blitCharacterCrossfadeRows(int x, int y, const CharacterPose* from, const CharacterPose* to,
+                                uint16_t alpha, int row, int rows) {
+    rows = min(rows, CHAR_DST_SIZE - row);
+    if (rows <= 0) return;
+    prepareEdgeFade(y, to);
+    edgeFadeContext.fromPose = from;
+    edgeFadeContext.crossAlpha = alpha;
+    edgeFadeContext.regionX = 0;
+    edgeFadeContext.regionY = row;
+    blitRows(x, y + row, CHAR_DST_SIZE, rows, edgeFadeRegionRow, &edgeFadeContext);
+}
+
+// === 展開速度の比較（シリアル出力） ===
+// 圧縮前と同じ非圧縮配列からの拡大（旧方式）と、圧縮データからの直接展開で
+// 180x180の行生成にかかる時間を比べる。SPI転送は同じなので含めない
+void benchmarkCharacterDecode(const CharacterPose* pose) {
+    const PackedImage* image = pose->base;
+    if (!blitterReady) initCharacterBlitter();
+    
+    uint16_t* raw = (uint16_t*)malloc(CHAR_SRC_SIZE * CHAR_SRC_SIZE * sizeof(uint16_t));
+    if (raw == NULL) {
+        Serial.println("Decode benchmark skipped (no memory)");
+        return;
+    }
+    for (int row = 0; row < CHAR_SRC_SIZE; row++) {
+        decodePackedRow(image, row, &raw[row * CHAR_SRC_SIZE], NULL);
+    }
+    
+    const int passes = 10;
+    uint16_t* out = lineBuffers[0];
+    
+    unsigned long start = micros();
+    for (int pass = 0; pass < passes; pass++) {
+        for (int row = 0; row < CHAR_DST_SIZE; row++) {
+            const uint16_t* src = &raw[scaleTable[row] * CHAR_SRC_SIZE];
+            for (int col = 0; col < CHAR_DST_SIZE; col++) {
+                out[col] = swapRGB565(src[scaleTable[col]]);
+            }
+        }
+    }
+    unsigned long rawTime = micros() - start;
+    
+    start = micros();
+    for (int pass = 0; pass < passes; pass++) {
+        for (int row = 0; row < CHAR_DST_SIZE; row++) {
+            decodePackedRow(image, scaleTable[row], out, columnRepeat);
+        }
+    }
+    unsigned long packedTime = micros() - start;
+    free(raw);
+    
+    Serial.print("Character decode: raw ");
+    Serial.print(rawTime / passes);
+    Serial.print(" us/frame, packed ");
+    Serial.print(packedTime / passes);
+    Serial.print(" us/frame, ");
+    Serial.print(image->bytes);
+    Serial.print(" bytes (raw ");
+    Serial.print(CHAR_SRC_SIZE * CHAR_SRC_SIZE * 2);
+    Serial.println(" bytes)");
+}
\ No newline at end of file
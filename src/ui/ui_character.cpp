@@ -2,6 +2,10 @@
 #include <TFT_eSPI.h>
 #include "../../include/ui/ui_character.hpp"
 #include "../../include/ui/ui_temperature.hpp"
+#include "../../include/ui/ui_blit.hpp"
+#include "../../include/ui/ui_asset.hpp"
+#include "../../include/ui/ui_framebuffer.hpp"
+#include "../../include/ui/ui_widgets.hpp"
 #include "../characters/wink_close.h"
 #include "../characters/wink_hot.h"
 
@@ -29,148 +33,46 @@ void debugCharacterState() {
 
 // === 温度連動キャラクター画像表示関数 ===
 
-// 温度に応じて適切なキャラクター画像配列を選択
-const uint16_t* getCharacterImageArray(float temp) {
+// 温度に応じて適切なキャラクターのポーズを選択（tools/pack_character.py で圧縮済み）
+const CharacterPose* getCharacterPose(float temp) {
     if (temp >= 32.0) {
-        return winkHotCharacterImage;    // 32℃以上は高温用画像
+        return &winkHotPose;    // 32℃以上は高温用画像
     } else {
-        return winkCloseCharacterImage;  // 32℃未満は通常画像
+        return &winkClosePose;  // 32℃未満は通常画像
     }
 }
 
-// キャラクター画像をフェードインで表示（温度連動版）
-void drawCharacterImageWithFade(int x, int y) {
-    const int originalSize = 160;
-    const int newSize = 180;
-    const float scale = (float)newSize / originalSize;
-    
-    // 最新の温度に応じた画像配列を取得
-    float currentTemp = getTemperature();
-    const uint16_t* characterImage = getCharacterImageArray(currentTemp);
-    
-    // フェードイン（8段階）
-    for (int fade = 0; fade <= 7; fade++) {
-        tft.startWrite();
-        tft.setAddrWindow(x, y, newSize, newSize);
-        
-        for (int row = 0; row < newSize; row++) {
-            for (int col = 0; col < newSize; col++) {
-                int srcRow = (int)(row / scale);
-                int srcCol = (int)(col / scale);
-                
-                if (srcRow >= originalSize) srcRow = originalSize - 1;
-                if (srcCol >= originalSize) srcCol = originalSize - 1;
-                
-                int srcIndex = srcRow * originalSize + srcCol;
-                uint16_t originalColor = pgm_read_word(&characterImage[srcIndex]);
-                
-                // 色をフェード処理
-                uint8_t r = ((originalColor >> 11) & 0x1F) * fade / 7;
-                uint8_t g = ((originalColor >> 5) & 0x3F) * fade / 7;
-                uint8_t b = (originalColor & 0x1F) * fade / 7;
-                uint16_t fadeColor = tft.color565(r << 3, g << 2, b << 3);
-                
-                tft.pushColor(fadeColor);
-            }
-        }
-        
-        tft.endWrite();
-        delay(60);
-    }
+const CharacterPose* getCharacterPoseById(CharacterPoseId id) {
+    return (id == POSE_HOT) ? &winkHotPose : &winkClosePose;
+}
+
+// 表示するポーズと、画面に出ているポーズ
+static const CharacterPose* activePose = NULL;  // NULLなら温度で選択
+static const CharacterPose* shownPose = NULL;
+static int shownX = 0, shownY = 0;
+static int sliceRow = 0;  // キーフレーム切り替えの分割転送で次に送る表示行
+
+// クロスフェード（fadeFrom → activePose を CROSSFADE_STEPS 段階で合成）
+#define CROSSFADE_STEPS 8
+static const CharacterPose* fadeFrom = NULL;  // NULLならフェード中でない
+static int fadeStep = 0;                      // 描画中の段階（1〜CROSSFADE_STEPS）
+
+static uint16_t crossfadeAlpha() {
+    return (uint16_t)(fadeStep * 256 / CROSSFADE_STEPS);
 }
 
 // 通常のキャラクター画像表示（温度連動版）
 void drawCharacterImage(int x, int y) {
-    const int originalSize = 160;
-    const int newSize = 180;
-    const float scale = (float)newSize / originalSize;
-    
     // 最新の温度に応じた画像配列を取得
     float currentTemp = getTemperature();
-    const uint16_t* characterImage = getCharacterImageArray(currentTemp);
-    
-    tft.startWrite();
-    tft.setAddrWindow(x, y, newSize, newSize);
-    
-    for (int row = 0; row < newSize; row++) {
-        for (int col = 0; col < newSize; col++) {
-            int srcRow = (int)(row / scale);
-            int srcCol = (int)(col / scale);
-            
-            if (srcRow >= originalSize) srcRow = originalSize - 1;
-            if (srcCol >= originalSize) srcCol = originalSize - 1;
-            
-            int srcIndex = srcRow * originalSize + srcCol;
-            uint16_t color = pgm_read_word(&characterImage[srcIndex]);
-            
-            tft.pushColor(color);
-        }
-    }
-    
-    tft.endWrite();
+    blitCharacterImage(x, y, getCharacterPose(currentTemp));
 }
 
 // キャラクター画像を縁ぼかし効果付きで表示（温度連動版）
 void drawCharacterImageWithEdgeFade(int x, int y) {
-    const int originalSize = 160;
-    const int newSize = 180;
-    const float scale = (float)newSize / originalSize;
-    const int fadeWidth = 8;
-    
     // 最新の温度に応じた画像配列を取得
     float currentTemp = getTemperature();
-    const uint16_t* characterImage = getCharacterImageArray(currentTemp);
-    
-    tft.startWrite();
-    tft.setAddrWindow(x, y, newSize, newSize);
-    
-    for (int row = 0; row < newSize; row++) {
-        for (int col = 0; col < newSize; col++) {
-            int srcRow = (int)(row / scale);
-            int srcCol = (int)(col / scale);
-            
-            if (srcRow >= originalSize) srcRow = originalSize - 1;
-            if (srcCol >= originalSize) srcCol = originalSize - 1;
-            
-            int srcIndex = srcRow * originalSize + srcCol;
-            uint16_t originalColor = pgm_read_word(&characterImage[srcIndex]);
-            
-            // 縁からの距離を計算
-            int distanceFromEdge = min(min(row, newSize - row - 1), min(col, newSize - col - 1));
-            
-            if (distanceFromEdge < fadeWidth) {
-                // フェード処理
-                float alpha = 0.3 + 0.7 * ((float)distanceFromEdge / fadeWidth);
-                
-                // 背景色を取得（温度連動グラデーション）
-                float backgroundRatio = (float)(y + row) / 240.0;
-                uint8_t topR, topG, topB, bottomR, bottomG, bottomB;
-                getTemperatureColors(currentBackgroundTemp, &topR, &topG, &topB, &bottomR, &bottomG, &bottomB);
-                
-                uint8_t bgR = (uint8_t)(topR + ((bottomR - topR) * backgroundRatio));
-                uint8_t bgG = (uint8_t)(topG + ((bottomG - topG) * backgroundRatio));
-                uint8_t bgB = (uint8_t)(topB + ((bottomB - topB) * backgroundRatio));
-                
-                // 色の分解と合成
-                uint8_t charR = (originalColor >> 11) & 0x1F;
-                uint8_t charG = (originalColor >> 5) & 0x3F;
-                uint8_t charB = originalColor & 0x1F;
-                
-                // アルファブレンド
-                uint8_t finalR = (uint8_t)((charR << 3) * alpha + bgR * (1.0 - alpha)) >> 3;
-                uint8_t finalG = (uint8_t)((charG << 2) * alpha + bgG * (1.0 - alpha)) >> 2;
-                uint8_t finalB = (uint8_t)((charB << 3) * alpha + bgB * (1.0 - alpha)) >> 3;
-                
-                uint16_t finalColor = tft.color565(finalR << 3, finalG << 2, finalB << 3);
-                tft.pushColor(finalColor);
-            } else {
-                // フェードなし
-                tft.pushColor(originalColor);
-            }
-        }
-    }
-    
-    tft.endWrite();
+    blitCharacterImageEdgeFade(x, y, getCharacterPose(currentTemp));
 }
 
 // キャラクター領域をクリア
@@ -197,13 +99,6 @@ void drawCharacter() {
         Serial.print("Character mode switched to: ");
         Serial.println(isHotCharacterMode ? "HOT mode (wink_hot)" : "NORMAL mode (wink_close)");
         
-        // 温度変化時のみ領域をクリア
-        clearCharacterArea();
-        delay(5);  // 確実にクリアが完了するまで待機
-        
-        // キャラクター画像を縁ぼかし効果付きで表示
-        drawCharacterImageWithEdgeFade(10, 40);
-        
         Serial.println("Character redrawn due to temperature change");
     } else {
         // 初回描画または状態変化なしの場合
@@ -214,9 +109,109 @@ void drawCharacter() {
             // 高温モードの確認表示
             Serial.println("Character drawn (hot mode)");
         }
-        
-        // mode_manager.cpp側でクリアしているので、ここでは不要
-        delay(5);  // 確実にクリアが完了するまで待機
-        drawCharacterImageWithEdgeFade(10, 40);
     }
+    
+    // 背景パッチと画像の描画はウィジェットの描画パスで1回だけ行う
+    invalidateWidget(WIDGET_CHARACTER);
+}
+
+// ウィジェット描画パスから呼ばれる（背景は塗り済み）
+void renderCharacter(int x, int y) {
+    shownX = x;
+    shownY = y;
+    sliceRow = 0;
+    
+    // クロスフェード中は現在の段階の合成画像を描き、フェードは続ける
+    if (fadeFrom != NULL) {
+        blitCharacterCrossfadeRows(x, y, fadeFrom, activePose, crossfadeAlpha(), 0, CHAR_DST_SIZE);
+        return;
+    }
+    
+    const CharacterPose* pose = activePose ? activePose : getCharacterPose(getTemperature());
+    blitCharacterImageEdgeFade(x, y, pose);
+    shownPose = pose;
+}
+
+// === ポーズ切り替え（アニメーション用） ===
+
+// 表示するポーズを設定する（転送は updateCharacterPose で行う）
+void setCharacterPose(const CharacterPose* pose) {
+    if (pose == activePose && fadeFrom == NULL) return;
+    if (fadeFrom != NULL) {
+        // フェード途中の画面は差分パッチで直せないので、描画パスで全体を描き直す
+        fadeFrom = NULL;
+        invalidateWidget(WIDGET_CHARACTER);
+    }
+    activePose = pose;
+    sliceRow = 0;  // 分割転送の途中で目標が変わった場合は先頭から送り直す
+}
+
+// 表示中のポーズからposeへクロスフェードする（転送は updateCharacterPose で1ループ1スライス）
+void crossfadeCharacterPose(const CharacterPose* pose) {
+    if (pose == activePose && fadeFrom == NULL) return;
+    
+    // 画面が1つのポーズで確定していない場合はフェードせずに切り替える
+    if (shownPose == NULL || fadeFrom != NULL || !isCharacterPoseSettled() || pose == shownPose) {
+        setCharacterPose(pose);
+        return;
+    }
+    fadeFrom = shownPose;
+    activePose = pose;
+    fadeStep = 1;
+    sliceRow = 0;
+}
+
+bool isCharacterPoseSettled() {
+    return activePose == NULL || (activePose == shownPose && fadeFrom == NULL);
+}
+
+// 設定されたポーズへ、budgetバイト以内で画面を近づける。転送したバイト数を返す。
+// 同じベースのポーズ間は差分パッチの矩形だけ、キーフレーム間は行単位で分割して送る
+uint32_t updateCharacterPose(uint32_t budget) {
+    if (isCharacterPoseSettled() || shownPose == NULL) return 0;
+    
+    // 非表示中や全体再描画の予定がある場合は描画パスに任せる
+    if (!isWidgetVisible(WIDGET_CHARACTER) || isWidgetDirty(WIDGET_CHARACTER)) return 0;
+    
+    const uint32_t rowBytes = CHAR_DST_SIZE * 2;
+    int rows = max(1, (int)(budget / rowBytes));
+    rows = min(rows, CHAR_DST_SIZE - sliceRow);
+    
+    // クロスフェード：各段階を行スライスに分けて描き、全行を描いたら次の段階へ
+    if (fadeFrom != NULL) {
+        blitCharacterCrossfadeRows(shownX, shownY, fadeFrom, activePose, crossfadeAlpha(), sliceRow, rows);
+        sliceRow += rows;
+        if (sliceRow >= CHAR_DST_SIZE) {
+            sliceRow = 0;
+            if (++fadeStep > CROSSFADE_STEPS) {
+                shownPose = activePose;
+                fadeFrom = NULL;
+            }
+        }
+        return rows * rowBytes;
+    }
+    
+    if (sliceRow == 0 && shownPose->base == activePose->base) {
+        uint32_t bytes = getPoseSwitchBytes(shownPose, activePose);
+        if (bytes <= budget) {
+            blitCharacterPoseSwitch(shownX, shownY, shownPose, activePose);
+            shownPose = activePose;
+            return bytes;
+        }
+        // パッチが予算を超える場合は行分割で送る
+    }
+    
+    blitCharacterRows(shownX, shownY, activePose, sliceRow, rows);
+    sliceRow += rows;
+    if (sliceRow >= CHAR_DST_SIZE) {
+        shownPose = activePose;
+        sliceRow = 0;
+    }
+    return rows * rowBytes;
+}
+
+// 圧縮キャラクター画像の展開速度（シリアル出力、ベンチマーク用）
+void benchmarkCharacterAssets() {
+    benchmarkCharacterDecode(&winkClosePose);
+    benchmarkCharacterDecode(&winkHotPose);
 }
\ No newline at end of file
@@ -1,98 +1,155 @@
 #include <Arduino.h>
 #include <TFT_eSPI.h>
 #include "../../include/ui/ui_display.hpp"
+#include "../../include/ui/ui_framebuffer.hpp"
 #include "../../include/ui/ui_temperature.hpp"
 #include "../../include/ui/ui_character.hpp"
 #include "../../include/ui/ui_state.hpp"
+#include "../../include/ui/ui_widgets.hpp"
+#include "../../include/ui/ui_animation.hpp"
+#include "../../include/ui/ui_backlight.hpp"
 
 extern TFT_eSPI tft;
 
-// スプラッシュ画面表示
-void showSplashScreen() {
+// ===== スプラッシュ画面（専用タスク） =====
+// 起動処理（WiFi・センサー初期化）と並行して描画する。finishSplashScreen() が
+// 呼ばれるまでロゴを表示し続け、呼ばれたらフェードアウトして終了する
+#define SPLASH_MIN_HOLD_MS 300   // フェードイン後の最低表示時間
+#define SPLASH_FADE_IN_MS 500     // バックライトフェードの時間
+#define SPLASH_FADE_OUT_MS 300
+#define MAIN_FADE_IN_MS 500
+
+static TaskHandle_t splashTask = NULL;
+static volatile bool splashReleased = false;
+static volatile bool splashDone = true;
+
+static void drawSplashLogo(int level) {
+    tft.fillRect(50, 100, 220, 32, TFT_BLACK);
+    uint8_t gray = min(level * 32, 255);
+    tft.setTextColor(tft.color565(gray, gray, gray));
+    tft.setTextSize(4);
+    tft.drawString("car-buddy", 50, 100);
+}
+
+static void SplashTaskCode(void* pvParameters) {
+    bool hardwareFade = isBacklightAvailable();
     tft.fillScreen(TFT_BLACK);
     
-    for (int fade = 0; fade <= 8; fade++) {
-        tft.setTextColor(tft.color565(fade * 32, fade * 32, fade * 32));
-        tft.setTextSize(4);
-        tft.drawString("car-buddy", 50, 100);
-        delay(300);
-        
-        if (fade < 8) {
-            tft.fillRect(50, 100, 220, 32, TFT_BLACK);
+    if (hardwareFade) {
+        // ロゴは最終の明るさで1回だけ描き、バックライトで明るくする
+        drawSplashLogo(8);
+        fadeBacklight(getScheduledBacklightLevel(), SPLASH_FADE_IN_MS);
+        vTaskDelay(pdMS_TO_TICKS(SPLASH_FADE_IN_MS));
+    } else {
+        for (int fade = 0; fade <= 8; fade++) {
+            drawSplashLogo(fade);
+            vTaskDelay(pdMS_TO_TICKS(60));
         }
     }
     
-    delay(1000);
-    
-    for (int fade = 8; fade >= 0; fade--) {
-        tft.fillRect(50, 100, 220, 32, TFT_BLACK);
-        tft.setTextColor(tft.color565(fade * 32, fade * 32, fade * 32));
-        tft.setTextSize(4);
-        tft.drawString("car-buddy", 50, 100);
-        delay(200);
+    // 起動処理の完了を待つ（最低表示時間は確保）
+    vTaskDelay(pdMS_TO_TICKS(SPLASH_MIN_HOLD_MS));
+    while (!splashReleased) {
+        vTaskDelay(pdMS_TO_TICKS(20));
     }
     
-    delay(500);
+    if (hardwareFade) {
+        fadeBacklight(0, SPLASH_FADE_OUT_MS);
+        vTaskDelay(pdMS_TO_TICKS(SPLASH_FADE_OUT_MS));
+    } else {
+        for (int fade = 8; fade >= 0; fade--) {
+            drawSplashLogo(fade);
+            vTaskDelay(pdMS_TO_TICKS(30));
+        }
+    }
     tft.fillScreen(TFT_BLACK);
+    
+    splashDone = true;
+    splashTask = NULL;
+    vTaskDelete(NULL);
+}
+
+// スプラッシュ画面を専用タスクで開始する（すぐに戻る）
+void startSplashScreen() {
+    if (splashTask != NULL) return;
+    splashReleased = false;
+    splashDone = false;
+    xTaskCreatePinnedToCore(
+        SplashTaskCode, // タスク関数
+        "SplashTask",   // タスク名
+        4096,           // スタックサイズ
+        NULL,           // パラメータ
+        1,              // 優先度（setupと同じ、遅延中に交互に動く）
+        &splashTask,    // タスクハンドル
+        1               // Core 1で実行（パネルを使うのはこのコアだけ）
+    );
+}
+
+// スプラッシュを終了させ、フェードアウトが終わるまで待つ
+void finishSplashScreen() {
+    splashReleased = true;
+    while (!splashDone) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+}
+
+// スプラッシュ画面表示（完了まで待つ）
+void showSplashScreen() {
+    startSplashScreen();
+    finishSplashScreen();
 }
 
 // メイン画面フェードイン
 void fadeInMainScreen() {
+    // バックライト制御がある場合は、描画済みの最終フレームのまま輝度だけを上げる
+    if (isBacklightAvailable()) {
+        fadeBacklight(getScheduledBacklightLevel(), MAIN_FADE_IN_MS);
+        return;
+    }
+    
+    // バックライト常時点灯の基板では、描き直しで明るさを表現する
+    TFT_eSPI& canvas = uiCanvas();
+    
     for (int fade = 0; fade <= 7; fade++) {
-        tft.fillScreen(TFT_BLACK);
+        canvas.fillScreen(TFT_BLACK);
+        markFullDirty();
         
         if (fade >= 2) {
-            uint16_t fadeOverlay = tft.color565(fade * 8, fade * 8, fade * 8);
+            uint16_t fadeOverlay = canvas.color565(fade * 8, fade * 8, fade * 8);
             for (int y = 0; y < 240; y += 4) {
                 for (int x = 0; x < 320; x += 3) {
                     if ((x + y) % 6 == 0) {
-                        tft.drawPixel(x, y, fadeOverlay);
+                        canvas.drawPixel(x, y, fadeOverlay);
                     }
                 }
             }
         }
         
-        uint16_t textColor = tft.color565(fade * 32, fade * 32, fade * 32);
-        tft.setTextColor(textColor);
+        uint16_t textColor = canvas.color565(fade * 32, fade * 32, fade * 32);
         
         if (fade >= 3) {
-            tft.setTextSize(2);
-            tft.drawString("CarBuddy", 25, 8);
+            drawWidgetForeground(WIDGET_TITLE, textColor);
         }
+        drawWidgetForeground(WIDGET_TEMP_LABEL, textColor);
+        drawWidgetForeground(WIDGET_SPEED_LABEL, textColor);
+        drawWidgetForeground(WIDGET_SPEED_UNIT, textColor);
         
-        tft.setTextSize(3);
-        tft.drawString("Temp:", 200, 10);
-        tft.drawString("Speed:", 200, 130);
-        tft.drawString("km/h", 240, 180);
-        
+        flushFrameBuffer();  // 1段階ごとにパネルへ反映
         delay(80);
     }
     
-    // 温度連動背景を描画
-    drawTemperatureGradientBackground(getCurrentBackgroundTemp());
-    
-    tft.setTextColor(TFT_WHITE);
-    
-    tft.setTextSize(2);
-    tft.drawString("CarBuddy", 25, 8);
-    
-    tft.setTextSize(3);
-    tft.drawString("Temp:", 200, 10);
-    tft.drawString("Speed:", 200, 130);
-    tft.drawString("km/h", 240, 180);
+    // 温度連動背景と全要素は次の描画パスで1回だけ描く
+    invalidateAllWidgets();
 }
 
 // CarBuddyタイトル描画
 void drawCarBuddyTitle() {
-    tft.setTextSize(2);
-    tft.setTextColor(TFT_WHITE);
-    tft.drawString("CarBuddy", 25, 8);
+    drawWidgetForeground(WIDGET_TITLE, TFT_WHITE);
 }
 
 // CarBuddyタイトル更新
 void updateCarBuddyTitle() {
-    drawTemperatureGradientArea(25, 8, 120, 16, getCurrentBackgroundTemp());
-    drawCarBuddyTitle();
+    invalidateWidget(WIDGET_TITLE);
 }
 
 // UI全体初期化
@@ -101,9 +158,19 @@ void drawUI() {
     
     updateBackgroundTemperature(20.0);
     
-    fadeInMainScreen();
+    initWidgets();
+    initCharacterAnimation();
+    if (!isBacklightAvailable()) {
+        fadeInMainScreen();  // 描き直しによるフェード（全要素は次の描画パスで描く）
+    }
     
     drawCharacter();  // 温度連動キャラクター表示
+    renderWidgets();
+    flushFrameBuffer();
+    
+    if (isBacklightAvailable()) {
+        fadeInMainScreen();  // 最終フレームを1回描いてからバックライトを上げる
+    }
     
     setUIInitialized(true);
     Serial.println("UI initialization completed");
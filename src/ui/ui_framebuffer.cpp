@@ -0,0 +1,168 @@
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "../../include/ui/ui_framebuffer.hpp"
+#include "../../include/ui/ui_blit.hpp"
+
+extern TFT_eSPI tft;
+
+struct DirtyRect {
+    int16_t x0, y0, x1, y1;  // 右下は含まない
+};
+
+static TFT_eSprite frameSprite(&tft);
+static uint16_t* framePixels = NULL;
+static bool frameBufferActive = false;
+
+static DirtyRect dirtyRects[FB_MAX_DIRTY_RECTS];
+static int dirtyCount = 0;
+static uint32_t lastFlushBytes = 0;
+static uint32_t lastFlushRects = 0;
+
+void initFrameBuffer() {
+    if (!psramFound()) {
+        Serial.println("PSRAM not found - drawing directly to the panel");
+        frameBufferActive = false;
+        return;
+    }
+    
+    frameSprite.setColorDepth(16);
+    frameSprite.setAttribute(PSRAM_ENABLE, true);
+    framePixels = (uint16_t*)frameSprite.createSprite(FB_WIDTH, FB_HEIGHT);
+    frameBufferActive = (framePixels != NULL);
+    
+    if (frameBufferActive) {
+        frameSprite.fillSprite(TFT_BLACK);
+        Serial.println("Frame buffer allocated in PSRAM (320x240 RGB565)");
+    } else {
+        Serial.println("Frame buffer allocation failed - drawing directly to the panel");
+    }
+}
+
+bool isFrameBufferActive() {
+    return frameBufferActive;
+}
+
+TFT_eSPI& uiCanvas() {
+    if (frameBufferActive) return frameSprite;
+    return tft;
+}
+
+uint16_t* getFrameBufferPixels() {
+    return framePixels;
+}
+
+// === 差分矩形の管理 ===
+
+static int rectArea(const DirtyRect& r) {
+    return (r.x1 - r.x0) * (r.y1 - r.y0);
+}
+
+static DirtyRect rectUnion(const DirtyRect& a, const DirtyRect& b) {
+    DirtyRect u;
+    u.x0 = min(a.x0, b.x0);
+    u.y0 = min(a.y0, b.y0);
+    u.x1 = max(a.x1, b.x1);
+    u.y1 = max(a.y1, b.y1);
+    return u;
+}
+
+// 重なる・接する矩形は統合する（送信回数を減らし、二重転送を防ぐ）
+static bool shouldMerge(const DirtyRect& a, const DirtyRect& b) {
+    if (a.x0 > b.x1 || b.x0 > a.x1 || a.y0 > b.y1 || b.y0 > a.y1) return false;
+    return true;
+}
+
+void markDirty(int x, int y, int width, int height) {
+    if (!frameBufferActive) return;
+    
+    DirtyRect r;
+    r.x0 = max(x, 0);
+    r.y0 = max(y, 0);
+    r.x1 = min(x + width, FB_WIDTH);
+    r.y1 = min(y + height, FB_HEIGHT);
+    if (r.x0 >= r.x1 || r.y0 >= r.y1) return;
+    
+    // 既存の矩形と統合できる間は統合を繰り返す
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (int i = 0; i < dirtyCount; i++) {
+            if (shouldMerge(r, dirtyRects[i])) {
+                r = rectUnion(r, dirtyRects[i]);
+                dirtyRects[i] = dirtyRects[--dirtyCount];
+                merged = true;
+                break;
+            }
+        }
+    }
+    
+    if (dirtyCount < FB_MAX_DIRTY_RECTS) {
+        dirtyRects[dirtyCount++] = r;
+        return;
+    }
+    
+    // 上限に達したら、統合による面積増加が最小の矩形とまとめる
+    int best = 0;
+    int bestGrowth = INT32_MAX;
+    for (int i = 0; i < dirtyCount; i++) {
+        int growth = rectArea(rectUnion(r, dirtyRects[i])) - rectArea(dirtyRects[i]);
+        if (growth < bestGrowth) {
+            bestGrowth = growth;
+            best = i;
+        }
+    }
+    DirtyRect u = rectUnion(r, dirtyRects[best]);
+    dirtyRects[best] = dirtyRects[--dirtyCount];
+    markDirty(u.x0, u.y0, u.x1 - u.x0, u.y1 - u.y0);
+}
+
+void markFullDirty() {
+    if (!frameBufferActive) return;
+    dirtyCount = 1;
+    dirtyRects[0] = { 0, 0, FB_WIDTH, FB_HEIGHT };
+}
+
+// === パネルへの転送 ===
+
+struct FlushContext {
+    int x, y;
+};
+
+// PSRAMの行をDMA可能な内部RAMのラインバッファへコピーする（スプライトは送出順で保持済み）
+static void frameRow(int row, uint16_t* out, int width, void* ctx) {
+    FlushContext* c = (FlushContext*)ctx;
+    memcpy(out, &framePixels[(c->y + row) * FB_WIDTH + c->x], width * sizeof(uint16_t));
+}
+
+void flushFrameBuffer() {
+    if (!frameBufferActive) return;
+    
+    uint32_t bytes = 0;
+    for (int i = 0; i < dirtyCount; i++) {
+        const DirtyRect& r = dirtyRects[i];
+        FlushContext ctx = { r.x0, r.y0 };
+        blitRowsToPanel(r.x0, r.y0, r.x1 - r.x0, r.y1 - r.y0, frameRow, &ctx);
+        bytes += (uint32_t)rectArea(r) * sizeof(uint16_t);
+    }
+    
+    // 何も描かなかったフレームは統計を更新しない
+    if (dirtyCount > 0) {
+        lastFlushBytes = bytes;
+        lastFlushRects = dirtyCount;
+    }
+    dirtyCount = 0;
+}
+
+void uiDrawString(const String& text, int x, int y) {
+    TFT_eSPI& canvas = uiCanvas();
+    canvas.drawString(text, x, y);
+    markDirty(x, y, canvas.textWidth(text), canvas.fontHeight());
+}
+
+uint32_t getLastFlushBytes() {
+    return lastFlushBytes;
+}
+
+uint32_t getLastFlushRectCount() {
+    return lastFlushRects;
+}
\ No newline at end of file
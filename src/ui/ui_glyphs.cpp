@@ -0,0 +1,124 @@
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "../../include/ui/ui_glyphs.hpp"
+#include "../../include/ui/ui_blit.hpp"
+#include "../../include/ui/ui_temperature.hpp"
+
+// GLCDフォント（TFT_eSPIのFont 1と同じ5x8、列ごとのビット列・bit0が上端）
+static const uint8_t glyphFont[GLYPH_COUNT][5] PROGMEM = {
+    { 0x3E, 0x51, 0x49, 0x45, 0x3E },  // 0
+    { 0x00, 0x42, 0x7F, 0x40, 0x00 },  // 1
+    { 0x72, 0x49, 0x49, 0x49, 0x46 },  // 2
+    { 0x21, 0x41, 0x49, 0x4D, 0x33 },  // 3
+    { 0x18, 0x14, 0x12, 0x7F, 0x10 },  // 4
+    { 0x27, 0x45, 0x45, 0x45, 0x39 },  // 5
+    { 0x3C, 0x4A, 0x49, 0x49, 0x31 },  // 6
+    { 0x41, 0x21, 0x11, 0x09, 0x07 },  // 7
+    { 0x36, 0x49, 0x49, 0x49, 0x36 },  // 8
+    { 0x46, 0x49, 0x49, 0x29, 0x1E },  // 9
+    { 0x00, 0x60, 0x60, 0x00, 0x00 },  // .
+    { 0x08, 0x08, 0x08, 0x08, 0x08 },  // -
+    { 0x00, 0x00, 0x00, 0x00, 0x00 },  // 空白
+    { 0x3E, 0x41, 0x41, 0x41, 0x22 },  // C
+};
+
+#define GLYPH_SPACE 12
+
+// アトラスの画素は文字色と欄の高さ分のグラデーション行色だけで決まる。
+// 温度そのものではなく実際に使う行色で照合し、背景が変わらない温度変化では作り直さない
+struct GlyphAtlasKey {
+    uint16_t color;
+    uint16_t rowColors[GLYPH_HEIGHT];
+    bool valid;
+};
+
+// バイトスワップ済みRGB565（フレームバッファ・DMA転送と同じ並び）
+static uint16_t glyphAtlas[GLYPH_ATLAS_SLOTS][GLYPH_COUNT][GLYPH_HEIGHT][GLYPH_WIDTH];
+static GlyphAtlasKey atlasKeys[GLYPH_ATLAS_SLOTS];
+
+static int glyphIndex(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    switch (c) {
+        case '.': return 10;
+        case '-': return 11;
+        case 'C': return 13;
+        default:  return GLYPH_SPACE;  // 未対応の文字は空白として扱う
+    }
+}
+
+static void buildGlyphAtlas(int slot, int y, uint16_t color) {
+    const uint16_t* gradientRows = getGradientRowTable(getCurrentBackgroundTemp());
+    uint16_t rowColors[GLYPH_HEIGHT];
+    for (int row = 0; row < GLYPH_HEIGHT; row++) {
+        rowColors[row] = gradientRows[min(y + row, 239)];
+    }
+    
+    GlyphAtlasKey& key = atlasKeys[slot];
+    if (key.valid && key.color == color && memcmp(key.rowColors, rowColors, sizeof(rowColors)) == 0) return;
+    
+    uint16_t fg = swapRGB565(color);
+    
+    for (int g = 0; g < GLYPH_COUNT; g++) {
+        for (int row = 0; row < GLYPH_HEIGHT; row++) {
+            uint16_t bg = swapRGB565(rowColors[row]);
+            int fontRow = row / GLYPH_SCALE;
+            uint16_t* out = glyphAtlas[slot][g][row];
+            
+            for (int col = 0; col < GLYPH_WIDTH; col++) {
+                int fontCol = col / GLYPH_SCALE;  // 6列目は文字間の空き
+                bool on = fontCol < 5 && ((pgm_read_byte(&glyphFont[g][fontCol]) >> fontRow) & 1);
+                out[col] = on ? fg : bg;
+            }
+        }
+    }
+    
+    key.color = color;
+    memcpy(key.rowColors, rowColors, sizeof(rowColors));
+    key.valid = true;
+}
+
+struct GlyphRowContext {
+    const uint16_t (*glyphs)[GLYPH_HEIGHT][GLYPH_WIDTH];
+    uint8_t indices[GLYPH_FIELD_MAX_CELLS];
+    int count;
+};
+
+static void glyphRow(int row, uint16_t* out, int width, void* ctx) {
+    GlyphRowContext* c = (GlyphRowContext*)ctx;
+    for (int i = 0; i < c->count; i++) {
+        memcpy(&out[i * GLYPH_WIDTH], c->glyphs[c->indices[i]][row], GLYPH_WIDTH * sizeof(uint16_t));
+    }
+}
+
+void drawGlyphField(int slot, int x, int y, int cells, uint16_t color,
+                    const char* text, char* shown, bool full) {
+    if (slot < 0 || slot >= GLYPH_ATLAS_SLOTS) return;
+    cells = min(cells, GLYPH_FIELD_MAX_CELLS);
+    buildGlyphAtlas(slot, y, color);
+    
+    // 欄の幅に合わせて空白で埋める（短くなった値の残りを消すため）
+    char padded[GLYPH_FIELD_MAX_CELLS];
+    bool ended = false;
+    int first = -1, last = -1;
+    for (int i = 0; i < cells; i++) {
+        if (!ended && text[i] == '\0') ended = true;
+        padded[i] = ended ? ' ' : text[i];
+        if (full || padded[i] != shown[i]) {
+            if (first < 0) first = i;
+            last = i;
+        }
+    }
+    if (first < 0) return;  // 変化なし
+    
+    // 変化した最初と最後のセルの間を1つの矩形として転送する
+    GlyphRowContext ctx;
+    ctx.glyphs = glyphAtlas[slot];
+    ctx.count = last - first + 1;
+    for (int i = 0; i < ctx.count; i++) {
+        ctx.indices[i] = glyphIndex(padded[first + i]);
+    }
+    blitRows(x + first * GLYPH_WIDTH, y, ctx.count * GLYPH_WIDTH, GLYPH_HEIGHT, glyphRow, &ctx);
+    
+    memcpy(shown, padded, cells);
+    shown[cells] = '\0';
+}
\ No newline at end of file
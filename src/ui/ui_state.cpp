@@ -1,17 +1,17 @@
 #include <Arduino.h>
 #include <TFT_eSPI.h>
 #include "../../include/ui/ui_state.hpp"
+#include "../../include/ui/ui_widgets.hpp"
+#include "../../include/ui/ui_temperature.hpp"
 #include "../../include/mode_manager.hpp"  // 🆕 追加: DisplayMode定義用
 
 // 他のモジュールから参照する関数の宣言（暫定）
-extern void drawTemperatureGradientBackground(float temp);
 extern void drawTemperature(float temp);
 extern void drawSpeed(float speed);
-extern void drawTime(String timeStr);
-extern void drawDate(String dateStr);
-extern void drawCharacter();
-extern String getCurrentTime();
-extern String getCurrentDate();
+extern void drawTime(const char* timeStr);
+extern void drawDate(const char* dateStr);
+extern const char* getCurrentTime();
+extern const char* getCurrentDate();
 extern float getSpeed();
 
 // モード管理関数の宣言（mode_manager.hppから）
@@ -39,6 +39,7 @@ void forceUpdateAllDisplayValues() {
     lastTime = "";
     lastDate = "";
     characterDisplayed = false;
+    invalidateAllWidgets();
 }
 
 // 前回値を設定（強制再描画後に使用）
@@ -50,79 +51,37 @@ void setLastDisplayValues(float temp, float speed, String timeStr, String dateSt
     characterDisplayed = true;
 }
 
+// 背景と全ウィジェットを無効化して最新値を設定する（描画は次のrenderWidgets()で1回）
+static void invalidateWithCurrentValues(float temp) {
+    updateBackgroundTemperature(temp);
+    lastBackgroundUpdateTemp = temp;
+    
+    forceUpdateAllDisplayValues();
+    
+    drawTemperature(temp);
+    drawSpeed(getSpeed());
+    drawTime(getCurrentTime());
+    drawDate(getCurrentDate());
+    
+    // モードに応じてキャラクターまたはアナログ時計のウィジェットを切り替え
+    updateDisplay();
+    characterDisplayed = true;
+}
+
 // 既存のforceFullRedraw関数（モード考慮版に更新）
 void forceFullRedraw(float temp) {
-    extern float currentBackgroundTemp;
-    
     if (abs(temp - lastBackgroundUpdateTemp) > 1.0) {
         Serial.println("Background temperature change detected - forcing full redraw");
-        
-        float currentSpeed = getSpeed();
-        String currentTimeStr = getCurrentTime();
-        String currentDateStr = getCurrentDate();
-        
-        drawTemperatureGradientBackground(temp);
-        lastBackgroundUpdateTemp = temp;
-        
-        // 固定UI要素を再描画
-        tft.setTextColor(TFT_WHITE);
-        tft.setTextSize(2);
-        tft.drawString("CarBuddy", 25, 8);
-        
-        tft.setTextSize(3);
-        tft.drawString("Temp:", 200, 10);
-        tft.drawString("Speed:", 200, 130);
-        tft.drawString("km/h", 240, 180);
-        
-        forceUpdateAllDisplayValues();
-        
-        drawTemperature(temp);
-        drawSpeed(currentSpeed);
-        drawTime(currentTimeStr);
-        drawDate(currentDateStr);
-        
-        // 🔧 修正: モードを考慮したキャラクター/時計描画
-        updateDisplay();  // キャラクターまたはアナログ時計をモードに応じて描画
-        
-        setLastDisplayValues(temp, currentSpeed, currentTimeStr, currentDateStr);
+        invalidateWithCurrentValues(temp);
     }
 }
 
 // 🆕 新規追加: モード考慮版の全体再描画関数
 void forceFullRedrawWithMode(float temp) {
-    extern float currentBackgroundTemp;
-    
     Serial.print("🔄 モード考慮版全体再描画開始 - 現在モード: ");
     Serial.println(getCurrentModeString());
     
-    float currentSpeed = getSpeed();
-    String currentTimeStr = getCurrentTime();
-    String currentDateStr = getCurrentDate();
-    
-    drawTemperatureGradientBackground(temp);
-    lastBackgroundUpdateTemp = temp;
-    
-    // 固定UI要素を再描画
-    tft.setTextColor(TFT_WHITE);
-    tft.setTextSize(2);
-    tft.drawString("CarBuddy", 25, 8);
-    
-    tft.setTextSize(3);
-    tft.drawString("Temp:", 200, 10);
-    tft.drawString("Speed:", 200, 130);
-    tft.drawString("km/h", 240, 180);
-    
-    forceUpdateAllDisplayValues();
-    
-    drawTemperature(temp);
-    drawSpeed(currentSpeed);
-    drawTime(currentTimeStr);
-    drawDate(currentDateStr);
-    
-    // モードに応じた表示切り替え
-    updateDisplay();  // キャラクターまたはアナログ時計をモードに応じて描画
-    
-    setLastDisplayValues(temp, currentSpeed, currentTimeStr, currentDateStr);
+    invalidateWithCurrentValues(temp);
     
     Serial.println("✅ モード考慮版全体再描画完了");
 }
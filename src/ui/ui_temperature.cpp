@@ -1,6 +1,8 @@
 #include <Arduino.h>
 #include <TFT_eSPI.h>
 #include "../../include/ui/ui_temperature.hpp"
+#include "../../include/ui/ui_framebuffer.hpp"
+#include "../../include/ui/ui_blit.hpp"
 
 extern TFT_eSPI tft;
 
@@ -39,30 +41,98 @@ void getTemperatureColors(float temp, uint8_t* topR, uint8_t* topG, uint8_t* top
     }
 }
 
-// 温度連動グラデーション背景を描画
-void drawTemperatureGradientBackground(float temp) {
-    uint8_t topR, topG, topB, bottomR, bottomG, bottomB;
-    getTemperatureColors(temp, &topR, &topG, &topB, &bottomR, &bottomG, &bottomB);
+// === グラデーション行カラーキャッシュ ===
+// 背景は行ごとに単色なので、240行分のRGB565を保持し、上下端の色が変わった時だけ再計算する
+#define GRADIENT_ROWS 240
+
+static uint16_t gradientRowColors[GRADIENT_ROWS];
+static uint8_t cachedEndpointColors[6];
+static bool gradientCacheValid = false;
+static uint32_t gradientCacheRebuilds = 0;
+
+// 行カラーテーブルを温度に合わせて更新（色帯が変わらなければ何もしない）
+static void ensureGradientRows(float temp) {
+    uint8_t c[6];
+    getTemperatureColors(temp, &c[0], &c[1], &c[2], &c[3], &c[4], &c[5]);
+    
+    if (gradientCacheValid && memcmp(c, cachedEndpointColors, sizeof(c)) == 0) {
+        return;
+    }
     
-    for (int y = 0; y < 240; y++) {
+    for (int y = 0; y < GRADIENT_ROWS; y++) {
         // グラデーション計算（0.0から1.0の範囲）
         float ratio = (float)y / 240.0;
         
         // 上部色から下部色への補間
-        uint8_t r = (uint8_t)(topR + ((bottomR - topR) * ratio));
-        uint8_t g = (uint8_t)(topG + ((bottomG - topG) * ratio));
-        uint8_t b = (uint8_t)(topB + ((bottomB - topB) * ratio));
+        uint8_t r = (uint8_t)(c[0] + ((c[3] - c[0]) * ratio));
+        uint8_t g = (uint8_t)(c[1] + ((c[4] - c[1]) * ratio));
+        uint8_t b = (uint8_t)(c[2] + ((c[5] - c[2]) * ratio));
         
         // RGB565色に変換
-        uint16_t color = tft.color565(r, g, b);
-        
-        // 1行分を描画
-        tft.drawFastHLine(0, y, 320, color);
+        gradientRowColors[y] = tft.color565(r, g, b);
     }
+    
+    memcpy(cachedEndpointColors, c, sizeof(c));
+    gradientCacheValid = true;
+    gradientCacheRebuilds++;
+}
+
+// 行カラーテーブルを取得（ui_characterの縁ぼかし等から参照）
+const uint16_t* getGradientRowTable(float temp) {
+    ensureGradientRows(temp);
+    return gradientRowColors;
+}
+
+uint16_t getGradientRowColor(int y) {
+    ensureGradientRows(currentBackgroundTemp);
+    if (y < 0) y = 0;
+    if (y >= GRADIENT_ROWS) y = GRADIENT_ROWS - 1;
+    return gradientRowColors[y];
+}
+
+// 温度連動グラデーション背景を描画
+void drawTemperatureGradientBackground(float temp) {
+    drawTemperatureGradientArea(0, 0, 320, 240, temp);
 }
 
 // 指定領域のみ温度連動グラデーション背景を描画
+// 矩形ごとに1回だけアドレスウィンドウを設定し、行カラーをテーブルから連続送信する
 void drawTemperatureGradientArea(int x, int y, int width, int height, float temp) {
+    // 画面外をクリップ
+    if (x < 0) { width += x; x = 0; }
+    if (y < 0) { height += y; y = 0; }
+    if (x + width > 320) width = 320 - x;
+    if (y + height > GRADIENT_ROWS) height = GRADIENT_ROWS - y;
+    if (width <= 0 || height <= 0) return;
+    
+    ensureGradientRows(temp);
+    
+    // フレームバッファ有効時はPSRAM上の行を塗りつぶし、転送はflushに任せる
+    if (isFrameBufferActive()) {
+        uint16_t* fb = getFrameBufferPixels();
+        for (int row = 0; row < height; row++) {
+            uint16_t color = swapRGB565(gradientRowColors[y + row]);
+            uint16_t* p = &fb[(y + row) * FB_WIDTH + x];
+            for (int col = 0; col < width; col++) {
+                p[col] = color;
+            }
+        }
+        markDirty(x, y, width, height);
+        return;
+    }
+    
+    tft.startWrite();
+    tft.setAddrWindow(x, y, width, height);
+    for (int row = 0; row < height; row++) {
+        tft.pushBlock(gradientRowColors[y + row], width);
+    }
+    tft.endWrite();
+}
+
+// === マイクロベンチマーク ===
+
+// 旧実装（行ごとに補間とcolor565、drawFastHLineで1行ずつ送信）
+static void drawTemperatureGradientAreaLegacy(int x, int y, int width, int height, float temp) {
     uint8_t topR, topG, topB, bottomR, bottomG, bottomB;
     getTemperatureColors(temp, &topR, &topG, &topB, &bottomR, &bottomG, &bottomB);
     
@@ -78,6 +148,47 @@ void drawTemperatureGradientArea(int x, int y, int width, int height, float temp
     }
 }
 
+// 旧実装と行キャッシュ版の描画速度（rows/s）をシリアルに出力する
+// 典型的な呼び出し（数値欄の130x25）とキャラクター領域（190x195）の2種類を計測。
+// フレームバッファ有効時はPSRAMへの塗りつぶしだけで終わるため、毎回flushして
+// 両方ともパネルへの転送までを含めた時間で比べる
+void benchmarkGradientFill() {
+    struct BenchArea { int x, y, w, h; const char* label; };
+    const BenchArea areas[] = {
+        { 195, 150, 130, 25, "value field 130x25" },
+        { 5, 25, 190, 195, "character area 190x195" }
+    };
+    const int iterations = 20;
+    float temp = currentBackgroundTemp;
+    
+    Serial.println("=== Gradient fill benchmark ===");
+    if (isFrameBufferActive()) flushFrameBuffer();  // 計測前に保留中の差分を送っておく
+    for (const BenchArea& a : areas) {
+        unsigned long start = micros();
+        for (int i = 0; i < iterations; i++) {
+            drawTemperatureGradientAreaLegacy(a.x, a.y, a.w, a.h, temp);
+        }
+        unsigned long legacyUs = micros() - start;
+        
+        start = micros();
+        for (int i = 0; i < iterations; i++) {
+            drawTemperatureGradientArea(a.x, a.y, a.w, a.h, temp);
+            if (isFrameBufferActive()) flushFrameBuffer();
+        }
+        unsigned long cachedUs = micros() - start;
+        
+        float rows = (float)a.h * iterations;
+        Serial.print(a.label);
+        Serial.print(": before ");
+        Serial.print(rows * 1000000.0 / legacyUs, 0);
+        Serial.print(" rows/s, after ");
+        Serial.print(rows * 1000000.0 / cachedUs, 0);
+        Serial.println(isFrameBufferActive() ? " rows/s (PSRAM fill + flush)" : " rows/s (direct SPI)");
+    }
+    Serial.print("Gradient cache rebuilds so far: ");
+    Serial.println(gradientCacheRebuilds);
+}
+
 // 温度連動背景色更新
 void updateBackgroundTemperature(float temp) {
     currentBackgroundTemp = temp;
@@ -0,0 +1,205 @@
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "../../include/ui/ui_widgets.hpp"
+#include "../../include/ui/ui_framebuffer.hpp"
+#include "../../include/ui/ui_temperature.hpp"
+#include "../../include/ui/ui_character.hpp"
+#include "../../include/ui/ui_glyphs.hpp"
+#include "../../include/clock.hpp"
+
+#define WIDGET_TEXT_MAX 24
+
+enum WidgetKind {
+    KIND_CHARACTER,
+    KIND_CLOCK,
+    KIND_LABEL,    // 固定文字列
+    KIND_NUMBER,   // formatで整形する数値（グリフアトラスで描画、矩形全体を不透明に塗る）
+    KIND_TEXT      // 外部から渡される文字列
+};
+
+struct Widget {
+    WidgetKind kind;
+    int16_t x, y, width, height;  // 背景パッチを含む固定矩形
+    int16_t textX, textY;
+    uint8_t textSize;
+    uint16_t color;
+    const char* format;
+    int8_t glyphSlot;             // KIND_NUMBERのアトラススロット
+    char text[WIDGET_TEXT_MAX];
+    char shown[WIDGET_TEXT_MAX];  // KIND_NUMBERで画面に出ている文字列
+    bool visible;
+    bool dirty;                   // 全体の再描画が必要
+    bool valueDirty;              // 値だけ変化（変化したセルのみ転送）
+};
+
+// 列挙順がz順（後ろほど手前）。矩形はsize 2/3の文字高さに合わせて隣と重ならないようにしている
+// 数値欄は幅/GLYPH_WIDTH文字（108px = 6文字）で、あふれた文字は切り捨てられる。温度は
+// DS18B20の範囲（-55〜125℃）が単位込みで収まるよう空白を入れない（"-10.5C", "125.0C"）
+static Widget widgets[WIDGET_COUNT] = {
+    { KIND_CHARACTER, 5, 25, 190, 195,  10,  40, 0, TFT_WHITE,  NULL,     -1, "",         "", true,  true, false },
+    { KIND_CLOCK,     5, 25, 190, 195,   0,   0, 0, TFT_WHITE,  NULL,     -1, "",         "", false, true, false },
+    { KIND_LABEL,    25,  8,  96,  16,  25,   8, 2, TFT_WHITE,  NULL,     -1, "CarBuddy", "", true,  true, false },
+    { KIND_LABEL,   200, 10,  90,  24, 200,  10, 3, TFT_WHITE,  NULL,     -1, "Temp:",    "", true,  true, false },
+    { KIND_LABEL,   200, 130, 108, 24, 200, 130, 3, TFT_WHITE,  NULL,     -1, "Speed:",   "", true,  true, false },
+    { KIND_LABEL,   240, 180,  72, 24, 240, 180, 3, TFT_WHITE,  NULL,     -1, "km/h",     "", true,  true, false },
+    { KIND_NUMBER,  200, 35,  108, 24, 200,  35, 3, TFT_WHITE,  "%.1fC",   0, "",         "", true,  true, false },
+    { KIND_NUMBER,  200, 155, 108, 24, 200, 155, 3, TFT_WHITE,  "%.1f",    1, "",         "", true,  true, false },
+    { KIND_TEXT,      5, 220,  85, 16,  10, 220, 2, TFT_YELLOW, NULL,     -1, "",         "", true,  true, false },
+    { KIND_TEXT,     90, 220, 130, 16,  95, 220, 2, TFT_CYAN,   NULL,     -1, "",         "", true,  true, false },
+};
+
+static bool backgroundDirty = true;
+static int lastRenderedCount = 0;
+
+static bool rectsOverlap(const Widget& a, const Widget& b) {
+    return a.x < b.x + b.width && b.x < a.x + a.width &&
+           a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+static bool rectContains(const Widget& outer, const Widget& inner) {
+    return inner.x >= outer.x && inner.y >= outer.y &&
+           inner.x + inner.width <= outer.x + outer.width &&
+           inner.y + inner.height <= outer.y + outer.height;
+}
+
+static void drawWidgetContent(Widget& w, uint16_t color) {
+    TFT_eSPI& canvas = uiCanvas();
+
+    switch (w.kind) {
+        case KIND_CHARACTER:
+            renderCharacter(w.textX, w.textY);
+            break;
+        case KIND_CLOCK:
+            drawAnalogClock();
+            break;
+        case KIND_NUMBER:
+            drawGlyphField(w.glyphSlot, w.textX, w.textY, w.width / GLYPH_WIDTH, color,
+                           w.text, w.shown, true);
+            break;
+        default:
+            canvas.setTextSize(w.textSize);
+            canvas.setTextColor(color);
+            canvas.drawString(w.text, w.textX, w.textY);
+            markDirty(w.x, w.y, w.width, w.height);
+            break;
+    }
+}
+
+void initWidgets() {
+    invalidateAllWidgets();
+    Serial.println("Widget tree initialized");
+}
+
+bool setWidgetNumber(WidgetId id, float value) {
+    char buf[WIDGET_TEXT_MAX];
+    snprintf(buf, sizeof(buf), widgets[id].format ? widgets[id].format : "%.1f", value);
+    return setWidgetText(id, buf);
+}
+
+bool setWidgetText(WidgetId id, const char* text) {
+    Widget& w = widgets[id];
+    if (strncmp(w.text, text, WIDGET_TEXT_MAX) == 0) return false;
+
+    strncpy(w.text, text, WIDGET_TEXT_MAX - 1);
+    w.text[WIDGET_TEXT_MAX - 1] = '\0';
+    if (w.kind == KIND_NUMBER) {
+        w.valueDirty = true;
+    } else {
+        w.dirty = true;
+    }
+    return true;
+}
+
+void setWidgetColor(WidgetId id, uint16_t color) {
+    if (widgets[id].color == color) return;
+    widgets[id].color = color;
+    widgets[id].dirty = true;
+}
+
+void setWidgetVisible(WidgetId id, bool visible) {
+    if (widgets[id].visible == visible) return;
+    widgets[id].visible = visible;
+    widgets[id].dirty = true;  // 非表示になった場合も背景パッチで消す
+}
+
+bool isWidgetVisible(WidgetId id) {
+    return widgets[id].visible;
+}
+
+bool isWidgetDirty(WidgetId id) {
+    return widgets[id].dirty;
+}
+
+void invalidateWidget(WidgetId id) {
+    widgets[id].dirty = true;
+}
+
+void invalidateAllWidgets() {
+    backgroundDirty = true;
+    for (int i = 0; i < WIDGET_COUNT; i++) {
+        widgets[i].dirty = true;
+    }
+}
+
+void renderWidgets() {
+    bool backgroundFresh[WIDGET_COUNT];
+    int rendered = 0;
+
+    // 背景変化時は全画面を1回だけ塗り、各要素のパッチは省略する
+    bool fullBackground = backgroundDirty;
+    if (backgroundDirty) {
+        drawTemperatureGradientBackground(getCurrentBackgroundTemp());
+        backgroundDirty = false;
+    }
+    for (int i = 0; i < WIDGET_COUNT; i++) {
+        backgroundFresh[i] = fullBackground;
+    }
+
+    for (int i = 0; i < WIDGET_COUNT; i++) {
+        Widget& w = widgets[i];
+        if (!w.dirty) {
+            // 数値欄は変化した文字セルだけをアトラスから転送する
+            if (w.valueDirty && w.visible) {
+                drawGlyphField(w.glyphSlot, w.textX, w.textY, w.width / GLYPH_WIDTH, w.color,
+                               w.text, w.shown, false);
+                rendered++;
+            }
+            w.valueDirty = false;
+            continue;
+        }
+        w.dirty = false;
+        w.valueDirty = false;
+
+        // 数値欄は矩形全体を不透明に描くので、表示中ならパッチは不要
+        bool opaque = (w.kind == KIND_NUMBER && w.visible);
+        if (!backgroundFresh[i]) {
+            if (!opaque) {
+                drawTemperatureGradientArea(w.x, w.y, w.width, w.height, getCurrentBackgroundTemp());
+            }
+
+            // 塗り直した範囲に重なる手前の要素も同じパスで描き直す。
+            // 背景パッチに完全に含まれる要素はパッチを省く
+            for (int j = i + 1; j < WIDGET_COUNT; j++) {
+                if (!rectsOverlap(w, widgets[j])) continue;
+                widgets[j].dirty = true;
+                if (!opaque && rectContains(w, widgets[j])) backgroundFresh[j] = true;
+            }
+        }
+
+        if (!w.visible) continue;
+        drawWidgetContent(w, w.color);
+        rendered++;
+    }
+
+    lastRenderedCount = rendered;
+}
+
+void drawWidgetForeground(WidgetId id, uint16_t color) {
+    Widget& w = widgets[id];
+    if (w.kind == KIND_CHARACTER || w.kind == KIND_CLOCK) return;
+    drawWidgetContent(w, color);
+}
+
+int getLastRenderedWidgetCount() {
+    return lastRenderedCount;
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+/*******************************************************************************
+* generated by tools/build_web_assets.py (source: web/)
+* format: minified + gzip, served as-is with Content-Encoding: gzip
+* index.html: 1915 -> 1434 -> 600 bytes
+*******************************************************************************/
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include "../../include/web_asset_types.h"
+
+static const uint8_t indexHtmlGz[600] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x54, 0xc9, 0x6e, 0xdb, 0x30,
+    0x10, 0xbd, 0xeb, 0x2b, 0xa6, 0xba, 0x50, 0x46, 0x2c, 0x2f, 0x3d, 0x3a, 0x92, 0x0e, 0x71, 0x5c,
+    0x34, 0x40, 0x8b, 0x04, 0xb1, 0x2f, 0x39, 0xb2, 0xe2, 0x24, 0x26, 0x2a, 0x93, 0x02, 0x35, 0xb2,
+    0x62, 0x04, 0xfe, 0xf7, 0x0e, 0x25, 0x39, 0x89, 0x1b, 0x27, 0x40, 0x97, 0x8b, 0x2d, 0x0e, 0xdf,
+    0xbc, 0xd9, 0x1e, 0x27, 0xf9, 0x74, 0x79, 0x3d, 0x5f, 0xdd, 0xdd, 0x2c, 0x60, 0x4d, 0x9b, 0x22,
+    0x4b, 0xfa, 0x5f, 0x94, 0x2a, 0x4b, 0x48, 0x53, 0x81, 0xd9, 0x5c, 0xba, 0x8b, 0x5a, 0xa9, 0x1d,
+    0xac, 0xf4, 0x06, 0x93, 0x71, 0x67, 0x4c, 0x36, 0x48, 0x12, 0x8c, 0xdc, 0x60, 0x1a, 0x6e, 0x35,
+    0x36, 0xa5, 0x75, 0x14, 0x42, 0x6e, 0x0d, 0xa1, 0xa1, 0x34, 0x6c, 0xb4, 0xa2, 0x75, 0xaa, 0x70,
+    0xab, 0x73, 0x8c, 0xdb, 0xc3, 0x10, 0xb4, 0xd1, 0xa4, 0x65, 0x11, 0x57, 0xb9, 0x2c, 0x30, 0x9d,
+    0x86, 0x59, 0x32, 0xee, 0xc2, 0xfc, 0xb0, 0x6a, 0xc7, 0x21, 0xa7, 0xc7, 0x91, 0x60, 0xb9, 0x33,
+    0x39, 0x43, 0xa6, 0x59, 0x52, 0x66, 0xf3, 0xda, 0x39, 0x26, 0x6e, 0x2f, 0x66, 0x90, 0x54, 0xa5,
+    0x34, 0xa0, 0x55, 0x1a, 0x12, 0x9f, 0x3d, 0x91, 0x37, 0xf0, 0x5f, 0xc9, 0x64, 0x35, 0x91, 0x35,
+    0x60, 0x4d, 0x5e, 0xe8, 0xfc, 0x67, 0x1a, 0x56, 0xcc, 0x12, 0x0d, 0xc2, 0xcc, 0xb3, 0xf5, 0x15,
+    0x74, 0x10, 0xa6, 0x6d, 0x29, 0x1c, 0x56, 0x75, 0x41, 0xe1, 0x69, 0x6f, 0xbe, 0x44, 0x5a, 0x39,
+    0x5d, 0x7a, 0x8a, 0x5b, 0x7f, 0x00, 0x7f, 0xfa, 0x9d, 0x83, 0xd8, 0x76, 0xfb, 0x9a, 0xa7, 0xca,
+    0xd9, 0x42, 0xd9, 0x7d, 0x6d, 0x72, 0xd2, 0x4c, 0x58, 0x97, 0x4a, 0x12, 0xfa, 0xf0, 0xd1, 0x00,
+    0x9e, 0x02, 0xee, 0x53, 0x45, 0x60, 0x6c, 0x03, 0x29, 0x18, 0x6c, 0xe0, 0x92, 0x2f, 0xa3, 0xc1,
+    0x79, 0xa0, 0x6c, 0x5e, 0x6f, 0xb8, 0xce, 0xd1, 0x03, 0xd2, 0xa2, 0x40, 0xff, 0x79, 0xb1, 0xbb,
+    0x52, 0x91, 0xf0, 0x75, 0x8a, 0xc1, 0x88, 0xf0, 0x91, 0xe6, 0x5d, 0x8f, 0xbd, 0xa7, 0x6d, 0x46,
+    0x64, 0xbf, 0x59, 0xdf, 0xcf, 0x25, 0xa7, 0x60, 0x1e, 0x3c, 0xc7, 0x3e, 0x78, 0x8e, 0xda, 0xd5,
+    0xfe, 0x41, 0xbc, 0xce, 0xee, 0xc9, 0xd9, 0xbf, 0x67, 0xe4, 0xd0, 0x5f, 0xea, 0xa2, 0xb8, 0x43,
+    0xe9, 0xd8, 0xf7, 0x0c, 0x44, 0x2c, 0xe0, 0x2c, 0xe8, 0xf9, 0x7b, 0xc0, 0x77, 0xce, 0x61, 0xdd,
+    0xde, 0x4e, 0x07, 0xa3, 0x52, 0xaa, 0x25, 0x49, 0x47, 0xd1, 0xe7, 0x21, 0x88, 0x89, 0x78, 0xcf,
+    0xa7, 0x8b, 0x79, 0x1a, 0x0e, 0x6f, 0xe1, 0x5f, 0x6d, 0xed, 0xaa, 0xf7, 0xf0, 0xb3, 0x13, 0x29,
+    0x69, 0x53, 0x13, 0xfe, 0x89, 0xc7, 0x12, 0xb9, 0x7c, 0x75, 0xd2, 0xe3, 0x3c, 0xb8, 0x47, 0xca,
+    0xd7, 0x91, 0x18, 0xf3, 0xc4, 0xdb, 0xde, 0x0f, 0xb9, 0x8b, 0x2c, 0xf9, 0xb5, 0x55, 0x33, 0x10,
+    0x37, 0xd7, 0xcb, 0x95, 0x18, 0x06, 0x5e, 0xbd, 0xe8, 0xaa, 0x19, 0x3c, 0x89, 0x7e, 0x28, 0xf1,
+    0x6a, 0x57, 0xa2, 0x60, 0x84, 0x2c, 0x4b, 0x16, 0x90, 0xf4, 0x53, 0x18, 0x3f, 0xc6, 0x4d, 0xd3,
+    0xc4, 0xf7, 0xd6, 0x6d, 0xe2, 0xda, 0x15, 0x68, 0x72, 0xab, 0x50, 0x89, 0xfd, 0x30, 0xf0, 0xba,
+    0x67, 0xac, 0xe7, 0x4f, 0x39, 0xbd, 0xc3, 0x1c, 0x82, 0xfd, 0x20, 0x18, 0xd1, 0x1a, 0x4d, 0xc4,
+    0xea, 0x2b, 0x79, 0x42, 0x08, 0x69, 0x06, 0x87, 0xef, 0x56, 0x03, 0x9c, 0x73, 0x0f, 0x61, 0x59,
+    0x49, 0x7f, 0xfd, 0xae, 0x72, 0x3a, 0x79, 0xbf, 0xd1, 0x8e, 0xf7, 0x63, 0x0e, 0x4e, 0x91, 0xcb,
+    0x44, 0xe7, 0xac, 0xfb, 0x1b, 0x16, 0xb1, 0xf0, 0x9e, 0x33, 0x3f, 0x3e, 0x68, 0x49, 0x8e, 0xf5,
+    0xf7, 0xea, 0xf5, 0x70, 0xfb, 0x0e, 0x2d, 0x6d, 0xad, 0xfe, 0xc5, 0xf8, 0xa6, 0xc2, 0x71, 0x53,
+    0xe1, 0xbf, 0xd6, 0xfe, 0xf2, 0x2c, 0xff, 0xb5, 0xfe, 0x0f, 0x98, 0x4e, 0xf7, 0x80, 0x4b, 0xbc,
+    0x62, 0x84, 0xdb, 0xca, 0x22, 0x7a, 0x79, 0xfc, 0x43, 0x98, 0x4e, 0x26, 0x13, 0x06, 0xbc, 0xde,
+    0x07, 0xe7, 0xbc, 0xbe, 0xba, 0x75, 0xc1, 0x6b, 0xa5, 0x5d, 0x85, 0xe3, 0x76, 0x09, 0xff, 0x02,
+    0x6d, 0x1c, 0xb9, 0x5f, 0x9a, 0x05, 0x00, 0x00,
+};
+
+#define WEB_ASSET_COUNT 1
+
+static const WebAsset webAssets[WEB_ASSET_COUNT] = {
+    { "/", "text/html", indexHtmlGz, 600, "\"c0eccfd2adf1cde0\"" },
+};
+
+#endif
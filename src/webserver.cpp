@@ -1,18 +1,24 @@
 #include <Arduino.h>
 #include <WiFi.h>
-#include <WebServer.h>
+#include <AsyncTCP.h>
+#include <ESPAsyncWebServer.h>
 #include "webserver.hpp"
 #include "time.hpp"
+#include "telemetry.hpp"
+#include "status_api.hpp"
+#include "journal.hpp"
+#include "web/web_assets.h"
 #include <time.h>
 
-// 内部インスタンス
-static WebServer server(80);
+// 内部インスタンス（AsyncTCPのタスクがソケットイベントでハンドラーを呼ぶ）
+static AsyncWebServer server(80);
 static bool serverRunning = false;
 
 // HTTPハンドラー関数の前方宣言
-void handleRoot();
-void handleSetTime();
-bool parseAndSetTime(String timeStr);
+void handleStaticAsset(AsyncWebServerRequest* request, const WebAsset& asset);
+void handleSetTime(AsyncWebServerRequest* request);
+void handleResetTrip(AsyncWebServerRequest* request);
+bool parseAndSetTime(const String& timeStr);
 
 int getConnectedClientCount() {
     return WiFi.softAPgetStationNum();
@@ -39,25 +45,30 @@ void initWebServer() {
     Serial.print("AP IP address: ");
     Serial.println(IP);
 
-    // Webサーバー設定
-    server.on("/", handleRoot);
+    // Webサーバー設定（ハンドラーは非ブロッキングで、複数接続を同時に扱う）
+    for (int i = 0; i < WEB_ASSET_COUNT; i++) {
+        const WebAsset& asset = webAssets[i];
+        server.on(asset.path, HTTP_GET, [&asset](AsyncWebServerRequest* request) {
+            handleStaticAsset(request, asset);
+        });
+    }
     server.on("/settime", HTTP_POST, handleSetTime);
-    server.enableCORS(true);
+    server.on("/resettrip", HTTP_POST, handleResetTrip);
+    server.onNotFound([](AsyncWebServerRequest* request) {
+        request->send(404, "text/plain", "Not Found");
+    });
+    initTelemetry(server);  // WebSocket /ws（バイナリのテレメトリー配信）
+    initStatusApi(server);  // /api/status, /api/history（JSON）
+    DefaultHeaders::Instance().addHeader("Access-Control-Allow-Origin", "*");
     server.begin();
     
     serverRunning = true;
     Serial.println("Web server started successfully");
 }
 
-void handleWebServerClient() {
-    if (serverRunning) {
-        server.handleClient();
-    }
-}
-
 void stopWebServer() {
     if (serverRunning) {
-        server.stop();
+        server.end();
         WiFi.softAPdisconnect(true);
         serverRunning = false;
         Serial.println("Web server stopped");
@@ -65,71 +76,51 @@ void stopWebServer() {
 }
 
 // HTTPハンドラー実装 - 簡素化版
-void handleRoot() {
-    String html = "<!DOCTYPE html>";
-    html += "<html><head><title>CarBuddy Time</title>";
-    html += "<meta name='viewport' content='width=device-width, initial-scale=1'>";
-    html += "</head><body>";
-    html += "<h1>CarBuddy Time Sync</h1>";
-    html += "<p>Current Time: <span id='time'></span></p>";
-    html += "<button onclick='sync()'>Sync Time</button>";
-    html += "<p id='result'></p>";
-    html += "<script>";
-    
-    // 時刻表示用のシンプルなJavaScript
-    html += "function updateTime() {";
-    html += "const now = new Date();";
-    html += "document.getElementById('time').textContent = now.toLocaleString();";
-    html += "}";
-    
-    // 時刻同期用のシンプルなJavaScript
-    html += "function sync() {";
-    html += "const now = new Date();";
-    html += "const timeStr = now.getFullYear() + '-' + ";
-    html += "String(now.getMonth() + 1).padStart(2, '0') + '-' + ";
-    html += "String(now.getDate()).padStart(2, '0') + ' ' + ";
-    html += "String(now.getHours()).padStart(2, '0') + ':' + ";
-    html += "String(now.getMinutes()).padStart(2, '0') + ':' + ";
-    html += "String(now.getSeconds()).padStart(2, '0');";
-    html += "fetch('/settime', {";
-    html += "method: 'POST',";
-    html += "headers: {'Content-Type': 'application/x-www-form-urlencoded'},";
-    html += "body: 'time=' + timeStr";
-    html += "})";
-    html += ".then(response => response.text())";
-    html += ".then(data => document.getElementById('result').textContent = data)";
-    html += ".catch(error => document.getElementById('result').textContent = 'Error: ' + error);";
-    html += "}";
-    
-    html += "setInterval(updateTime, 1000);";
-    html += "updateTime();";
-    html += "</script></body></html>";
-    
-    server.send(200, "text/html", html);
+// 静的ファイルはビルド時にgzip済みのフラッシュ上の定数をそのまま送る（リクエストごとの
+// 文字列連結・圧縮・ヒープ確保なし）。ETagが一致すれば本文なしの304だけを返す
+void handleStaticAsset(AsyncWebServerRequest* request, const WebAsset& asset) {
+    AsyncWebServerResponse* response;
+    if (request->hasHeader("If-None-Match") &&
+        request->getHeader("If-None-Match")->value() == asset.etag) {
+        response = request->beginResponse(304);
+    } else {
+        response = request->beginResponse(200, asset.contentType, asset.data, asset.length);
+        response->addHeader("Content-Encoding", "gzip");
+    }
+    response->addHeader("ETag", asset.etag);
+    response->addHeader("Cache-Control", "no-cache");  // 毎回ETagで再検証させる（更新後すぐ反映）
+    request->send(response);
 }
 
-void handleSetTime() {
-    if (server.hasArg("time")) {
-        String timeStr = server.arg("time");
+void handleSetTime(AsyncWebServerRequest* request) {
+    if (request->hasParam("time", true)) {
+        const String& timeStr = request->getParam("time", true)->value();
         Serial.print("Time sync: ");
         Serial.println(timeStr);
         
         if (parseAndSetTime(timeStr)) {
-            // 時刻をEEPROMに保存
+            // 時刻をジャーナルに保存（書き込みはメインループで行う）
             saveCurrentTime();
-            server.send(200, "text/plain", "OK");
+            request->send(200, "text/plain", "OK");
             Serial.println("Time sync OK");
         } else {
-            server.send(400, "text/plain", "Format Error");
+            request->send(400, "text/plain", "Format Error");
             Serial.println("Time format error");
         }
     } else {
-        server.send(400, "text/plain", "No Data");
+        request->send(400, "text/plain", "No Data");
         Serial.println("No time data");
     }
 }
 
-bool parseAndSetTime(String timeStr) {
+void handleResetTrip(AsyncWebServerRequest* request) {
+    // 値の書き換えとジャーナルへの保存はメインループで行う
+    resetTrip();
+    request->send(200, "text/plain", "OK");
+    Serial.println("Trip reset requested");
+}
+
+bool parseAndSetTime(const String& timeStr) {
     struct tm timeinfo;
     int year, month, day, hour, minute, second;
     
@@ -150,6 +141,7 @@ bool parseAndSetTime(String timeStr) {
     time_t timestamp = mktime(&timeinfo);
     struct timeval tv = { timestamp, 0 };
     settimeofday(&tv, NULL);
+    refreshTimeCache();
     
     return true;
 }
\ No newline at end of file
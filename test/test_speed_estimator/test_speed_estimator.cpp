@@ -0,0 +1,129 @@
+// 車速推定の再生テスト（ネイティブビルド: pio test -e native）
+// 既知の真値を持つ合成IMUトレース（停車→加速→巡航→滑らかな路面での巡航→減速→停車）を1kHzで
+// stepSpeedEstimator() に流し、速度誤差・停車時のゼロ速度復帰・1サンプルあたりの処理時間を確認する
+#include <unity.h>
+#include <math.h>
+#include <stdio.h>
+#include <chrono>
+#include "speed_estimator.hpp"
+
+#define SAMPLE_US 1000
+#define LSB_PER_G 4096.0
+#define GRAVITY_MS2 9.80665
+
+// 取り付け角（X軸前方、Z軸上向きから前に5度傾けた状態）
+static const double MOUNT_PITCH = 5.0 * M_PI / 180.0;
+
+// 区間ごとの前後加速度（m/s²）
+struct Phase {
+    double seconds;
+    double accel;
+    double vibration;  // 走行振動の振幅（g、0なら停車）
+};
+
+static const Phase trace[] = {
+    { 2.0,  0.0,  0.0   },  // 停車（重力とバイアスの初期化）
+    { 8.0,  1.5,  0.04  },  // 加速: 0 → 12 m/s（43.2 km/h）
+    { 10.0, 0.0,  0.04  },  // 巡航
+    { 10.0, 0.0,  0.015 },  // 滑らかな路面での巡航（停車と誤判定しないこと）
+    { 8.0, -1.5,  0.04  },  // 減速: 12 → 0 m/s
+    { 3.0,  0.0,  0.0   },  // 停車
+};
+
+static uint32_t noiseState = 12345;
+
+// 決定的な疑似乱数（-range〜+range）
+static int noise(int range) {
+    noiseState = noiseState * 1664525u + 1013904223u;
+    return (int)((noiseState >> 16) % (2 * range + 1)) - range;
+}
+
+static int16_t toRaw(double g) {
+    return (int16_t)lround(g * LSB_PER_G);
+}
+
+static ImuSample makeSample(uint32_t t, double accelMs2, double vibrationG) {
+    // 走行中は路面振動（12Hz）を前後・上下に加える
+    bool moving = vibrationG > 0.0;
+    double vibration = vibrationG * sin(2.0 * M_PI * 12.0 * t / 1e6);
+    double forwardG = accelMs2 / GRAVITY_MS2 + vibration;
+    double upG = 1.0 + vibration;
+
+    ImuSample s;
+    s.timestampUs = t;
+    s.ax = toRaw(forwardG * cos(MOUNT_PITCH) + upG * sin(MOUNT_PITCH)) + noise(6);
+    s.ay = noise(6);
+    s.az = toRaw(upG * cos(MOUNT_PITCH) - forwardG * sin(MOUNT_PITCH)) + noise(6);
+    // ジャイロ: 0.5dps相当のバイアスと雑音、走行中は小さな揺れ
+    s.gx = 33 + noise(moving ? 40 : 3);
+    s.gy = -20 + noise(moving ? 40 : 3);
+    s.gz = 10 + noise(moving ? 40 : 3);
+    return s;
+}
+
+void setUp() {
+    resetSpeedEstimator();
+    noiseState = 12345;
+}
+
+void tearDown() {}
+
+void test_replay_stop_accelerate_cruise_stop() {
+    uint32_t t = 0;
+    double trueSpeed = 0.0;        // m/s
+    double peakSpeed = 0.0;
+    double maxErrorKmh = 0.0;
+    double sumErrorKmh = 0.0;
+    uint32_t movingSamples = 0;
+    uint32_t totalSamples = 0;
+    double totalNs = 0.0;
+
+    for (const Phase& phase : trace) {
+        uint32_t count = (uint32_t)(phase.seconds * 1e6 / SAMPLE_US);
+        for (uint32_t i = 0; i < count; i++) {
+            ImuSample s = makeSample(t, phase.accel, phase.vibration);
+
+            auto start = std::chrono::steady_clock::now();
+            stepSpeedEstimator(s);
+            totalNs += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            totalSamples++;
+
+            trueSpeed += phase.accel * SAMPLE_US / 1e6;
+            if (trueSpeed > peakSpeed) peakSpeed = trueSpeed;
+            if (phase.vibration > 0.0) {
+                double error = fabs(getEstimatedSpeedKmh() - trueSpeed * 3.6);
+                if (error > maxErrorKmh) maxErrorKmh = error;
+                sumErrorKmh += error;
+                movingSamples++;
+            }
+            t += SAMPLE_US;
+        }
+    }
+
+    char message[160];
+    snprintf(message, sizeof(message),
+             "peak %.1f km/h, max error %.2f km/h, mean error %.2f km/h, %.1f ns/sample",
+             peakSpeed * 3.6, maxErrorKmh, sumErrorKmh / movingSamples, totalNs / totalSamples);
+    TEST_MESSAGE(message);
+
+    TEST_ASSERT_TRUE_MESSAGE(maxErrorKmh < 3.0, "speed error during the trip");
+    // 最後の停車区間（3秒）でゼロ速度に戻っていること
+    TEST_ASSERT_TRUE(isVehicleStationary());
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, getEstimatedSpeedKmh());
+}
+
+void test_stationary_drift_stays_zero() {
+    // 停車中の傾き・バイアス・雑音だけでは速度が出ない
+    for (uint32_t i = 0; i < 60000; i++) {
+        stepSpeedEstimator(makeSample(i * SAMPLE_US, 0.0, 0.0));
+    }
+    TEST_ASSERT_TRUE(isVehicleStationary());
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, getEstimatedSpeedKmh());
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_replay_stop_accelerate_cruise_stop);
+    RUN_TEST(test_stationary_drift_stays_zero);
+    return UNITY_END();
+}
\ No newline at end of file
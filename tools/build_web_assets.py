@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+"""web/ 以下のWeb UIを圧縮してフラッシュ埋め込み用ヘッダーを生成する
+
+使い方:
+    python3 tools/build_web_assets.py
+    （platformio.ini の extra_scripts = pre:tools/build_web_assets.py でビルド毎に自動実行）
+
+出力:
+    src/web/web_assets.h  webAssets[]（WebAsset、形式は include/web_asset_types.h）
+
+各ファイルを最小化してからgzip（最大圧縮、タイムスタンプ0）し、圧縮後のバイト列を
+PROGMEM配列として格納する。ETagは圧縮後データのハッシュなので、内容が変わらない限り
+ビルドし直しても同じ値になる。出力内容が変わらない場合はファイルを書き換えない
+（不要な再コンパイルを避ける）。
+
+パスの対応:
+    web/index.html -> /
+    web/<name>     -> /<name>
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+CONTENT_TYPES = {
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".json": "application/json",
+    ".svg": "image/svg+xml",
+    ".ico": "image/x-icon",
+    ".png": "image/png",
+}
+OUTPUT = os.path.join("src", "web", "web_assets.h")
+
+
+def minify_code(text):
+    # 行単位の保守的な最小化（インデント・空行・行コメント・ブロックコメントを削除）。
+    # 改行は残すので、JavaScriptの自動セミコロン挿入に依存したコードも壊さない
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    lines = []
+    for line in text.splitlines():
+        line = line.strip()
+        if not line or line.startswith("//"):
+            continue
+        lines.append(line)
+    return "\n".join(lines)
+
+
+def minify_html(text):
+    text = re.sub(r"<!--.*?-->", "", text, flags=re.S)
+    out = []
+    pos = 0
+    # <script>/<style> の中身はコードとして、それ以外はタグ間の空白を詰める
+    for m in re.finditer(r"(<(script|style)[^>]*>)(.*?)(</\2>)", text, flags=re.S | re.I):
+        out.append(collapse_markup(text[pos:m.start()]))
+        out.append(m.group(1) + minify_code(m.group(3)) + m.group(4))
+        pos = m.end()
+    out.append(collapse_markup(text[pos:]))
+    return "".join(out)
+
+
+def collapse_markup(text):
+    text = re.sub(r">\s+<", "><", text)
+    return re.sub(r"\s+", " ", text).strip()
+
+
+def minify(path, data):
+    ext = os.path.splitext(path)[1].lower()
+    if ext == ".html":
+        return minify_html(data.decode("utf-8")).encode("utf-8")
+    if ext in (".css", ".js"):
+        return minify_code(data.decode("utf-8")).encode("utf-8")
+    return data
+
+
+def url_path(rel):
+    rel = rel.replace(os.sep, "/")
+    return "/" if rel == "index.html" else "/" + rel
+
+
+def symbol_name(rel):
+    parts = re.split(r"[^0-9A-Za-z]+", rel)
+    return parts[0].lower() + "".join(p[:1].upper() + p[1:] for p in parts[1:] if p)
+
+
+def format_array(values, per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join("0x%02x" % v for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def collect(web_dir):
+    assets = []
+    for root, _, files in os.walk(web_dir):
+        for name in sorted(files):
+            path = os.path.join(root, name)
+            ext = os.path.splitext(name)[1].lower()
+            if ext not in CONTENT_TYPES:
+                print("build_web_assets: %s は未対応の形式のため除外します" % path)
+                continue
+            rel = os.path.relpath(path, web_dir)
+            with open(path, "rb") as f:
+                raw = f.read()
+            small = minify(path, raw)
+            packed = gzip.compress(small, compresslevel=9, mtime=0)
+            etag = '"%s"' % hashlib.sha1(packed).hexdigest()[:16]
+            assets.append((rel, CONTENT_TYPES[ext], raw, small, packed, etag))
+    assets.sort(key=lambda a: (a[0] != "index.html", a[0]))
+    return assets
+
+
+def render(assets):
+    lines = []
+    lines.append("/*******************************************************************************")
+    lines.append("* generated by tools/build_web_assets.py (source: web/)")
+    lines.append("* format: minified + gzip, served as-is with Content-Encoding: gzip")
+    for rel, _, raw, small, packed, _ in assets:
+        lines.append("* %s: %d -> %d -> %d bytes" % (rel, len(raw), len(small), len(packed)))
+    lines.append("*******************************************************************************/")
+    lines.append("#ifndef WEB_ASSETS_H")
+    lines.append("#define WEB_ASSETS_H")
+    lines.append("")
+    lines.append('#include "../../include/web_asset_types.h"')
+    lines.append("")
+    for rel, _, _, _, packed, _ in assets:
+        lines.append("static const uint8_t %sGz[%d] PROGMEM = {" % (symbol_name(rel), len(packed)))
+        lines.append(format_array(list(packed)))
+        lines.append("};")
+        lines.append("")
+    lines.append("#define WEB_ASSET_COUNT %d" % len(assets))
+    lines.append("")
+    lines.append("static const WebAsset webAssets[WEB_ASSET_COUNT] = {")
+    for rel, content_type, _, _, packed, etag in assets:
+        lines.append('    { "%s", "%s", %sGz, %d, "%s" },'
+                     % (url_path(rel), content_type, symbol_name(rel), len(packed), etag.replace('"', '\\"')))
+    lines.append("};")
+    lines.append("")
+    lines.append("#endif")
+    return "\n".join(lines) + "\n"
+
+
+def build(project_dir):
+    web_dir = os.path.join(project_dir, "web")
+    output = os.path.join(project_dir, OUTPUT)
+    assets = collect(web_dir)
+    if not assets:
+        raise RuntimeError("%s にWebアセットがありません" % web_dir)
+
+    text = render(assets)
+    if os.path.exists(output):
+        with open(output, "r", encoding="utf-8") as f:
+            if f.read() == text:
+                return
+    os.makedirs(os.path.dirname(output), exist_ok=True)
+    with open(output, "w", encoding="utf-8", newline="\n") as f:
+        f.write(text)
+    for rel, _, raw, _, packed, etag in assets:
+        print("%s: %d -> %d bytes (ETag %s)" % (rel, len(raw), len(packed), etag))
+    print("%s を更新しました" % output)
+
+
+if __name__ == "__main__":
+    if len(sys.argv) > 1:
+        print(__doc__)
+        sys.exit(1)
+    build(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+else:
+    # PlatformIO（SCons）から extra_scripts として読み込まれた場合
+    Import("env")  # noqa: F821
+    build(env["PROJECT_DIR"])  # noqa: F821
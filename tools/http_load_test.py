@@ -0,0 +1,160 @@
+#!/usr/bin/env python3
+"""CarBuddyのWebサーバーにPCから負荷をかけ、スループットとレイテンシーを測る
+
+使い方（PCをCarBuddy-WiFiに接続した状態で）:
+    python3 tools/http_load_test.py
+    python3 tools/http_load_test.py --concurrency 8 --duration 20 --path /
+    python3 tools/http_load_test.py --save async.json
+    python3 tools/http_load_test.py --compare sync.json   # 以前の結果と比較
+    python3 tools/http_load_test.py --path /api/history --heap  # デバイス側のヒープ使用量も表示
+
+出力:
+    リクエスト数、エラー数、リクエスト/秒、レイテンシーの p50 / p90 / p99 / 最大（ms）
+
+各ワーカーは1リクエストごとに新しい接続を張る（ESPAsyncWebServerは応答後に接続を閉じる）。
+--save で結果をJSONに保存し、ファームウェアを変えた後に --compare で比較できる。
+--heap を付けると測定の前後に /api/status を読み、空きヒープの最小値（起動後の最低値）と
+APIの応答1回あたりのヒープ使用量（ライブラリの確保を含む、デバイス側で計測）を表示する。
+"""
+
+import argparse
+import http.client
+import json
+import threading
+import time
+from urllib.parse import urlparse
+
+
+def percentile(sorted_values, p):
+    if not sorted_values:
+        return 0.0
+    k = (len(sorted_values) - 1) * p / 100.0
+    lo = int(k)
+    hi = min(lo + 1, len(sorted_values) - 1)
+    return sorted_values[lo] + (sorted_values[hi] - sorted_values[lo]) * (k - lo)
+
+
+def worker(host, port, paths, deadline, timeout, latencies, errors, lock):
+    i = 0
+    while time.monotonic() < deadline:
+        path = paths[i % len(paths)]
+        i += 1
+        start = time.monotonic()
+        try:
+            conn = http.client.HTTPConnection(host, port, timeout=timeout)
+            conn.request("GET", path, headers={"Connection": "close"})
+            response = conn.getresponse()
+            response.read()
+            conn.close()
+            ok = 200 <= response.status < 400
+        except (OSError, http.client.HTTPException):
+            ok = False
+        elapsed = (time.monotonic() - start) * 1000.0
+        with lock:
+            if ok:
+                latencies.append(elapsed)
+            else:
+                errors[0] += 1
+
+
+def fetch_status(url, timeout):
+    conn = http.client.HTTPConnection(url.hostname, url.port or 80, timeout=timeout)
+    try:
+        conn.request("GET", "/api/status", headers={"Connection": "close"})
+        response = conn.getresponse()
+        return json.loads(response.read().decode("utf-8"))
+    finally:
+        conn.close()
+
+
+def heap_report(before, after):
+    heap_before, heap_after = before["heap"], after["heap"]
+    api_before, api_after = before.get("api", {}), after.get("api", {})
+    return {
+        "heap_free": heap_after["free"],
+        "heap_min_free": heap_after["min_free"],
+        "heap_min_free_drop": heap_before["min_free"] - heap_after["min_free"],
+        "api_requests": api_after.get("requests", 0) - api_before.get("requests", 0),
+        "api_heap_peak_max": api_after.get("heap_peak_max", 0),
+    }
+
+
+def run(args):
+    url = urlparse(args.url)
+    host = url.hostname
+    port = url.port or 80
+    paths = args.path or ["/"]
+
+    latencies = []
+    errors = [0]
+    lock = threading.Lock()
+    deadline = time.monotonic() + args.duration
+    threads = [threading.Thread(target=worker,
+                                args=(host, port, paths, deadline, args.timeout, latencies, errors, lock))
+               for _ in range(args.concurrency)]
+    started = time.monotonic()
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    wall = time.monotonic() - started
+
+    latencies.sort()
+    return {
+        "url": args.url,
+        "paths": paths,
+        "concurrency": args.concurrency,
+        "duration_s": round(wall, 2),
+        "requests": len(latencies),
+        "errors": errors[0],
+        "rps": round(len(latencies) / wall, 1) if wall > 0 else 0.0,
+        "p50_ms": round(percentile(latencies, 50), 1),
+        "p90_ms": round(percentile(latencies, 90), 1),
+        "p99_ms": round(percentile(latencies, 99), 1),
+        "max_ms": round(latencies[-1], 1) if latencies else 0.0,
+    }
+
+
+def print_result(result, baseline=None):
+    keys = ["requests", "errors", "rps", "p50_ms", "p90_ms", "p99_ms", "max_ms"]
+    keys += [k for k in ("heap_free", "heap_min_free", "heap_min_free_drop",
+                         "api_requests", "api_heap_peak_max") if k in result]
+    print("%s  concurrency=%d  %.1fs" % (result["url"], result["concurrency"], result["duration_s"]))
+    for key in keys:
+        line = "  %-18s %10s" % (key, result[key])
+        if baseline is not None and key in baseline:
+            before = baseline[key]
+            if isinstance(before, (int, float)) and before:
+                line += "   (before %s, %+.0f%%)" % (before, (result[key] - before) * 100.0 / before)
+        print(line)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--url", default="http://192.168.4.1", help="デバイスのURL（既定: APのアドレス）")
+    parser.add_argument("--path", action="append", help="リクエストするパス（複数指定で順番に使う）")
+    parser.add_argument("--concurrency", type=int, default=4, help="同時接続数")
+    parser.add_argument("--duration", type=float, default=10.0, help="測定時間（秒）")
+    parser.add_argument("--timeout", type=float, default=5.0, help="1リクエストのタイムアウト（秒）")
+    parser.add_argument("--save", help="結果をJSONで保存する")
+    parser.add_argument("--compare", help="以前に保存した結果と比較する")
+    parser.add_argument("--heap", action="store_true", help="測定の前後に /api/status でヒープ使用量を確認する")
+    args = parser.parse_args()
+
+    status_before = fetch_status(urlparse(args.url), args.timeout) if args.heap else None
+    result = run(args)
+    if args.heap:
+        result.update(heap_report(status_before, fetch_status(urlparse(args.url), args.timeout)))
+    baseline = None
+    if args.compare:
+        with open(args.compare) as f:
+            baseline = json.load(f)
+    print_result(result, baseline)
+
+    if args.save:
+        with open(args.save, "w") as f:
+            json.dump(result, f, indent=2)
+
+
+if __name__ == "__main__":
+    main()
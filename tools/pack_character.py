@@ -0,0 +1,275 @@
+#!/usr/bin/env python3
+"""キャラクター画像（24bit BMP）をパレット+RLE形式のポーズヘッダーに変換する
+
+使い方:
+    python3 tools/pack_character.py image/wink_close.bmp winkClose src/characters/wink_close.h
+    python3 tools/pack_character.py image/blink.bmp blink src/characters/blink.h \
+        --base image/wink_close.bmp winkClose
+
+出力:
+    <name>Image  PackedImage（キーフレームの場合）
+    <name>Pose   CharacterPose（ベース画像 + 差分パッチ）
+
+--base を指定すると、ベース画像と異なる画素を含む8x8タイルを矩形にまとめ、
+その矩形だけを差分パッチとして格納する（ベース側のヘッダーを先にincludeすること）。
+差分が画像の半分を超える場合はパッチにせずキーフレームとして格納する。
+
+形式（行ごとに独立して符号化）:
+    トークン t:
+        t & 0x80 -> 次の1シンボルを (t & 0x7F) + 1 回繰り返す
+        それ以外 -> 続く t + 1 個のシンボルをそのまま出力
+    シンボル:
+        0x00〜0xFE -> パレット番号
+        0xFF       -> 続く2バイトが画素値そのもの（バイトスワップ済みRGB565、メモリ順）
+パレットと画素値はバイトスワップ済み（SPI送出順）で格納するので、デコーダーは
+そのままラインバッファに書き込める。
+"""
+
+import os
+import struct
+import sys
+from collections import Counter
+
+ESCAPE = 0xFF
+MAX_PALETTE = 255
+MAX_CHUNK = 128
+TILE = 8
+KEYFRAME_RATIO = 0.5
+
+
+def read_bmp_rgb565(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:2] != b"BM":
+        raise ValueError("%s: BMPではありません" % path)
+    offset, = struct.unpack_from("<I", data, 10)
+    width, height = struct.unpack_from("<ii", data, 18)
+    bpp, = struct.unpack_from("<H", data, 28)
+    if bpp != 24:
+        raise ValueError("%s: 24bit BMPのみ対応しています" % path)
+
+    row_size = (width * 3 + 3) // 4 * 4
+    rows = abs(height)
+    pixels = []
+    for y in range(rows):
+        src_y = rows - 1 - y if height > 0 else y  # BMPは通常下から上
+        base = offset + src_y * row_size
+        for x in range(width):
+            b, g, r = data[base + 3 * x:base + 3 * x + 3]
+            pixels.append(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3))
+    return width, rows, pixels
+
+
+def swap16(c):
+    return ((c << 8) | (c >> 8)) & 0xFFFF
+
+
+def build_palette(pixels):
+    # 出現頻度の高い順に最大255色。残りはエスケープで直接格納する
+    return [c for c, _ in Counter(pixels).most_common(MAX_PALETTE)]
+
+
+def encode_symbol(color, index):
+    if color in index:
+        return [index[color]]
+    s = swap16(color)
+    return [ESCAPE, s & 0xFF, s >> 8]
+
+
+def encode_row(row, index):
+    out = []
+    literal = []
+
+    def flush_literal():
+        for i in range(0, len(literal), MAX_CHUNK):
+            chunk = literal[i:i + MAX_CHUNK]
+            out.append(len(chunk) - 1)
+            for c in chunk:
+                out.extend(encode_symbol(c, index))
+        del literal[:]
+
+    i = 0
+    while i < len(row):
+        j = i
+        while j < len(row) and row[j] == row[i] and j - i < MAX_CHUNK:
+            j += 1
+        if j - i >= 2:
+            flush_literal()
+            out.append(0x80 | (j - i - 1))
+            out.extend(encode_symbol(row[i], index))
+            i = j
+        else:
+            literal.append(row[i])
+            i += 1
+    flush_literal()
+    return out
+
+
+def decode_row(data, pos, width, palette):
+    # 検証用（src/ui/ui_asset.cpp のデコーダーと同じ手順）
+    out = []
+    while len(out) < width:
+        t = data[pos]
+        pos += 1
+        count = (t & 0x7F) + 1
+        repeat = bool(t & 0x80)
+        for n in range(count):
+            if n == 0 or not repeat:
+                s = data[pos]
+                pos += 1
+                if s == ESCAPE:
+                    value = data[pos] | (data[pos + 1] << 8)
+                    pos += 2
+                else:
+                    value = swap16(palette[s])
+            out.append(value)
+    return out
+
+
+def pack(width, height, pixels):
+    palette = build_palette(pixels)
+    index = {c: i for i, c in enumerate(palette)}
+    data = []
+    offsets = []
+    for y in range(height):
+        offsets.append(len(data))
+        data.extend(encode_row(pixels[y * width:(y + 1) * width], index))
+
+    # 復号して元画像と一致することを確認
+    for y in range(height):
+        row = decode_row(data, offsets[y], width, palette)
+        expected = [swap16(c) for c in pixels[y * width:(y + 1) * width]]
+        if row != expected:
+            raise RuntimeError("行%dの復号結果が一致しません" % y)
+    return palette, offsets, data
+
+
+def format_array(values, fmt, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt % v for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def diff_rects(width, height, pixels, base):
+    """ベースと異なる画素を含むタイルを、行方向の連続→同じ横幅の縦連続の順にまとめる"""
+    tiles_x = (width + TILE - 1) // TILE
+    tiles_y = (height + TILE - 1) // TILE
+    dirty = [[False] * tiles_x for _ in range(tiles_y)]
+    for i, (a, b) in enumerate(zip(pixels, base)):
+        if a != b:
+            dirty[(i // width) // TILE][(i % width) // TILE] = True
+
+    spans = []  # (tx0, tx1, ty0, ty1)
+    for ty in range(tiles_y):
+        tx = 0
+        while tx < tiles_x:
+            if not dirty[ty][tx]:
+                tx += 1
+                continue
+            start = tx
+            while tx < tiles_x and dirty[ty][tx]:
+                tx += 1
+            for span in spans:
+                if span[0] == start and span[1] == tx and span[3] == ty:
+                    span[3] = ty + 1
+                    break
+            else:
+                spans.append([start, tx, ty, ty + 1])
+
+    rects = []
+    for tx0, tx1, ty0, ty1 in spans:
+        x0, y0 = tx0 * TILE, ty0 * TILE
+        rects.append((x0, y0, min(tx1 * TILE, width) - x0, min(ty1 * TILE, height) - y0))
+    return rects
+
+
+def crop(width, pixels, rect):
+    x, y, w, h = rect
+    return [pixels[(y + r) * width + x + c] for r in range(h) for c in range(w)]
+
+
+def write_image(f, name, width, height, palette, offsets, data):
+    total_bytes = len(data) + len(palette) * 2 + len(offsets) * 4
+    f.write("static const uint16_t %sPalette[%d] PROGMEM = {\n" % (name, len(palette)))
+    f.write(format_array([swap16(c) for c in palette], "0x%04x", 12) + "\n};\n\n")
+    f.write("static const uint32_t %sRows[%d] PROGMEM = {\n" % (name, height))
+    f.write(format_array(offsets, "%d", 12) + "\n};\n\n")
+    f.write("static const uint8_t %sData[%d] PROGMEM = {\n" % (name, len(data)))
+    f.write(format_array(data, "0x%02x", 16) + "\n};\n\n")
+    f.write("const PackedImage %s = { %d, %d, %sPalette, %sRows, %sData, %d };\n\n"
+            % (name, width, height, name, name, name, total_bytes))
+    return total_bytes
+
+
+def write_header(path, source, name, width, height, pixels, base=None):
+    guard = os.path.basename(path).replace(".", "_").upper()
+    raw_bytes = width * height * 2
+
+    rects = None
+    if base is not None:
+        base_pixels, base_name = base
+        rects = diff_rects(width, height, pixels, base_pixels)
+        area = sum(w * h for _, _, w, h in rects)
+        if area > width * height * KEYFRAME_RATIO:
+            print("%s: 差分が%d%%あるためキーフレームとして格納します" % (source, area * 100 // (width * height)))
+            rects = None
+
+    with open(path, "w", newline="\n") as f:
+        f.write("/*******************************************************************************\n")
+        f.write("* generated by tools/pack_character.py\n")
+        f.write("* source: %s (%dx%d)\n" % (source, width, height))
+        if rects is None:
+            f.write("* format: keyframe, palette + RLE, byte-swapped R5G6B5\n")
+        else:
+            f.write("* format: %d delta patches on %sImage, palette + RLE, byte-swapped R5G6B5\n"
+                    % (len(rects), base_name))
+        f.write("*******************************************************************************/\n")
+        f.write("#ifndef %s\n#define %s\n\n" % (guard, guard))
+        f.write('#include "../../include/image_types.h"\n\n')
+
+        total = 0
+        if rects is None:
+            total += write_image(f, name + "Image", width, height, *pack(width, height, pixels))
+            f.write("const CharacterPose %sPose = { &%sImage, NULL, 0 };\n\n" % (name, name))
+        else:
+            for i, rect in enumerate(rects):
+                patch = crop(width, pixels, rect)
+                total += write_image(f, "%sPatch%d" % (name, i), rect[2], rect[3], *pack(rect[2], rect[3], patch))
+            f.write("static const PosePatch %sPatches[%d] = {\n" % (name, len(rects)))
+            for i, rect in enumerate(rects):
+                f.write("    { %d, %d, &%sPatch%d },\n" % (rect[0], rect[1], name, i))
+            f.write("};\n\n")
+            f.write("const CharacterPose %sPose = { &%sImage, %sPatches, %d };\n\n"
+                    % (name, base_name, name, len(rects)))
+        f.write("#endif\n")
+
+    print("%s: %d bytes (raw %d bytes, %s)"
+          % (path, total, raw_bytes, "keyframe" if rects is None else "%d patches" % len(rects)))
+
+
+def main():
+    args = sys.argv[1:]
+    base = None
+    if "--base" in args:
+        i = args.index("--base")
+        if len(args) < i + 3:
+            print(__doc__)
+            sys.exit(1)
+        base_path, base_name = args[i + 1:i + 3]
+        del args[i:i + 3]
+        _, _, base_pixels = read_bmp_rgb565(base_path)
+        base = (base_pixels, base_name)
+    if len(args) != 3:
+        print(__doc__)
+        sys.exit(1)
+
+    source, name, output = args
+    width, height, pixels = read_bmp_rgb565(source)
+    if base is not None and len(base[0]) != len(pixels):
+        raise ValueError("ベース画像とサイズが異なります")
+    write_header(output, source, name, width, height, pixels, base)
+
+
+if __name__ == "__main__":
+    main()